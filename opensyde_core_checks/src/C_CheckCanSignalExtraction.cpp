@@ -0,0 +1,374 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Check and benchmark of the precompiled CAN signal extraction
+
+   C_OscCanSignalExtraction and C_OscCanMessageExtractionPlan replace the bit by bit extraction of
+   C_OscCanUtil::h_GetSignalValue in the message logger, CAN monitor and dashboards. Both have to give the same result:
+   - pseudo random signal layouts (byte order, start bit, length, content type) are extracted out of pseudo random
+     data bytes by both paths; the values and the DLC check have to be identical
+   - a message with eight signals is decoded by both paths for many frames; the scaled values have to be identical
+
+   The time per frame of both paths for the message with eight signals is printed to the console.
+   It is not checked, as the result depends on the machine.
+
+   The layouts and data bytes are generated pseudo randomly with a fixed seed, so each run checks the same cases.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <iostream>
+#include <cstring>
+
+#include "stwtypes.hpp"
+#include "stw_can.hpp"
+#include "TglTime.hpp"
+#include "C_OscCanUtil.hpp"
+#include "C_OscCanSignalExtraction.hpp"
+#include "C_OscCanMessageExtractionPlan.hpp"
+#include "C_OscNodeDataPoolContentUtil.hpp"
+#include "C_CheckCanSignalExtraction.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::can;
+using namespace stw::tgl;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint32_t C_CheckCanSignalExtraction::mhu32_NUM_RANDOM_SIGNALS = 100000U;
+const uint32_t C_CheckCanSignalExtraction::mhu32_NUM_BENCHMARK_FRAMES = 1000U;
+const uint32_t C_CheckCanSignalExtraction::mhu32_NUM_BENCHMARK_ROUNDS = 100U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Run check
+
+   \return
+   true     extraction plans give the same results as the bit by bit extraction
+   false    at least one difference found (details printed to console)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckCanSignalExtraction::h_Run(void)
+{
+   bool q_Return = mh_CheckRandomSignals();
+
+   q_Return = mh_RunBenchmark() && q_Return;
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Compare extraction of pseudo random signal layouts
+
+   \return
+   true     all values and DLC checks identical
+   false    at least one difference found (details printed to console)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckCanSignalExtraction::mh_CheckRandomSignals(void)
+{
+   bool q_Return = true;
+   uint32_t u32_State = 0x12345678U;
+
+   for (uint32_t u32_Signal = 0U; (u32_Signal < mhu32_NUM_RANDOM_SIGNALS) && (q_Return == true); ++u32_Signal)
+   {
+      C_OscCanSignal c_Signal;
+      C_OscNodeDataPoolContent::E_Type e_Type;
+      C_OscCanSignalExtraction c_Extraction;
+      C_OscNodeDataPoolContent c_Reference;
+      C_OscNodeDataPoolContent c_Value;
+      std::vector<uint8_t> c_ReferenceBlob;
+      std::vector<uint8_t> c_ValueBlob;
+      uint8_t au8_Data[8];
+
+      mh_CreateRandomSignal(u32_State, c_Signal, e_Type);
+      for (uint32_t u32_Byte = 0U; u32_Byte < sizeof(au8_Data); ++u32_Byte)
+      {
+         au8_Data[u32_Byte] = static_cast<uint8_t>(mh_GetRandom(u32_State));
+      }
+      c_Extraction.Compile(c_Signal, e_Type);
+
+      for (uint8_t u8_Dlc = 0U; u8_Dlc <= 8U; ++u8_Dlc)
+      {
+         if (c_Extraction.IsInMessage(u8_Dlc) != C_OscCanUtil::h_IsSignalInMessage(u8_Dlc, c_Signal))
+         {
+            std::cout << "DLC check differs for DLC " << static_cast<uint32_t>(u8_Dlc) << std::endl;
+            q_Return = false;
+         }
+      }
+
+      c_Reference.SetType(e_Type);
+      c_Value.SetType(e_Type);
+      mh_GetReferenceValue(au8_Data, c_Signal, c_Reference);
+      c_Extraction.SetContentValue(c_Extraction.ExtractRawValue(au8_Data), c_Value);
+      // compare the bytes, so float values which are no number are compared as well
+      c_Reference.GetValueAsLittleEndianBlob(c_ReferenceBlob);
+      c_Value.GetValueAsLittleEndianBlob(c_ValueBlob);
+      if (c_ReferenceBlob != c_ValueBlob)
+      {
+         std::cout << "Value differs" << std::endl;
+         q_Return = false;
+      }
+
+      if (q_Return == false)
+      {
+         std::cout << "   for signal " << u32_Signal << ": " <<
+            ((c_Signal.e_ComByteOrder == C_OscCanSignal::eBYTE_ORDER_INTEL) ? "Intel" : "Motorola") <<
+            ", start bit " << c_Signal.u16_ComBitStart << ", length " << c_Signal.u16_ComBitLength <<
+            ", type " << static_cast<uint32_t>(e_Type) << std::endl;
+      }
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Decode a message with eight signals with both paths and print the time per frame
+
+   \return
+   true     all scaled values identical
+   false    at least one difference found (details printed to console)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckCanSignalExtraction::mh_RunBenchmark(void)
+{
+   bool q_Return = true;
+   uint32_t u32_State = 0x87654321U;
+   std::vector<C_BenchmarkSignal> c_Signals;
+   std::vector<T_STWCAN_Msg_RX> c_Frames;
+   std::vector<float64_t> c_ReferenceValues;
+   std::vector<float64_t> c_PlanValues;
+   C_OscCanMessageExtractionPlan c_Plan;
+   uint64_t u64_Start;
+   uint64_t u64_ReferenceTimeUs;
+   uint64_t u64_PlanTimeUs;
+   uint32_t u32_Result;
+
+   mh_CreateBenchmarkSignals(c_Signals);
+   for (uint32_t u32_Signal = 0U; u32_Signal < c_Signals.size(); ++u32_Signal)
+   {
+      const C_BenchmarkSignal & rc_Signal = c_Signals[u32_Signal];
+      c_Plan.AddSignal(rc_Signal.c_Signal, rc_Signal.e_Type, rc_Signal.f64_Factor, rc_Signal.f64_Offset);
+   }
+
+   c_Frames.resize(mhu32_NUM_BENCHMARK_FRAMES);
+   for (uint32_t u32_Frame = 0U; u32_Frame < c_Frames.size(); ++u32_Frame)
+   {
+      c_Frames[u32_Frame].u8_DLC = 8U;
+      for (uint32_t u32_Byte = 0U; u32_Byte < 8U; ++u32_Byte)
+      {
+         c_Frames[u32_Frame].au8_Data[u32_Byte] = static_cast<uint8_t>(mh_GetRandom(u32_State));
+      }
+   }
+   c_ReferenceValues.resize(c_Frames.size() * c_Signals.size(), 0.0);
+   c_PlanValues.resize(c_Frames.size() * c_Signals.size(), 0.0);
+
+   //Bit by bit path as used before the extraction plans
+   u64_Start = TglGetTickCountUs();
+   for (uint32_t u32_Round = 0U; u32_Round < mhu32_NUM_BENCHMARK_ROUNDS; ++u32_Round)
+   {
+      u32_Result = 0U;
+      for (uint32_t u32_Frame = 0U; u32_Frame < c_Frames.size(); ++u32_Frame)
+      {
+         const T_STWCAN_Msg_RX & rc_Frame = c_Frames[u32_Frame];
+         for (uint32_t u32_Signal = 0U; u32_Signal < c_Signals.size(); ++u32_Signal)
+         {
+            const C_BenchmarkSignal & rc_Signal = c_Signals[u32_Signal];
+            if (C_OscCanUtil::h_IsSignalInMessage(rc_Frame.u8_DLC, rc_Signal.c_Signal) == true)
+            {
+               C_OscNodeDataPoolContent c_Value;
+               std::vector<uint8_t> c_Data;
+               float64_t f64_Value;
+
+               c_Value.SetType(rc_Signal.e_Type);
+               c_Data.resize(c_Value.GetSizeByte(), 0U);
+               C_OscCanUtil::h_GetSignalValue(rc_Frame.au8_Data, rc_Signal.c_Signal, c_Data, rc_Signal.e_Type);
+               c_Value.SetValueFromLittleEndianBlob(c_Data);
+               c_Value.GetAnyValueAsFloat64(f64_Value, 0U);
+               c_ReferenceValues[u32_Result] = (f64_Value * rc_Signal.f64_Factor) + rc_Signal.f64_Offset;
+            }
+            ++u32_Result;
+         }
+      }
+   }
+   u64_ReferenceTimeUs = TglGetTickCountUs() - u64_Start;
+
+   //Extraction plan
+   u64_Start = TglGetTickCountUs();
+   for (uint32_t u32_Round = 0U; u32_Round < mhu32_NUM_BENCHMARK_ROUNDS; ++u32_Round)
+   {
+      u32_Result = 0U;
+      for (uint32_t u32_Frame = 0U; u32_Frame < c_Frames.size(); ++u32_Frame)
+      {
+         const T_STWCAN_Msg_RX & rc_Frame = c_Frames[u32_Frame];
+         c_Plan.Decode(rc_Frame.au8_Data, rc_Frame.u8_DLC);
+         for (uint32_t u32_Signal = 0U; u32_Signal < c_Plan.GetSignalCount(); ++u32_Signal)
+         {
+            if (c_Plan.GetSignalState(u32_Signal) == C_OscCanMessageExtractionPlan::eSIGNAL_DECODED)
+            {
+               c_PlanValues[u32_Result] = c_Plan.GetScaledValue(u32_Signal);
+            }
+            ++u32_Result;
+         }
+      }
+   }
+   u64_PlanTimeUs = TglGetTickCountUs() - u64_Start;
+
+   // compare the bytes, so float values which are no number are compared as well
+   if (std::memcmp(&c_ReferenceValues[0], &c_PlanValues[0], c_ReferenceValues.size() * sizeof(float64_t)) != 0)
+   {
+      std::cout << "Scaled values of benchmark message differ" << std::endl;
+      q_Return = false;
+   }
+
+   std::cout << "Decoding a message with " << c_Signals.size() << " signals: bit by bit " <<
+      ((u64_ReferenceTimeUs * 1000U) / (static_cast<uint64_t>(c_Frames.size()) * mhu32_NUM_BENCHMARK_ROUNDS)) <<
+      " ns per frame, extraction plan " <<
+      ((u64_PlanTimeUs * 1000U) / (static_cast<uint64_t>(c_Frames.size()) * mhu32_NUM_BENCHMARK_ROUNDS)) <<
+      " ns per frame" << std::endl;
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create pseudo random signal layout which fits into eight data bytes
+
+   \param[in,out]  oru32_State   Generator state
+   \param[out]     orc_Signal    Signal
+   \param[out]     ore_Type      Content type of signal
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CheckCanSignalExtraction::mh_CreateRandomSignal(uint32_t & oru32_State, C_OscCanSignal & orc_Signal,
+                                                       C_OscNodeDataPoolContent::E_Type & ore_Type)
+{
+   const C_OscNodeDataPoolContent::E_Type ae_Types[] =
+   {
+      C_OscNodeDataPoolContent::eUINT8, C_OscNodeDataPoolContent::eUINT16, C_OscNodeDataPoolContent::eUINT32,
+      C_OscNodeDataPoolContent::eUINT64, C_OscNodeDataPoolContent::eSINT8, C_OscNodeDataPoolContent::eSINT16,
+      C_OscNodeDataPoolContent::eSINT32, C_OscNodeDataPoolContent::eSINT64, C_OscNodeDataPoolContent::eFLOAT32,
+      C_OscNodeDataPoolContent::eFLOAT64
+   };
+   uint32_t u32_TypeBits;
+
+   ore_Type = ae_Types[mh_GetRandom(oru32_State) % (sizeof(ae_Types) / sizeof(ae_Types[0]))];
+   u32_TypeBits = C_OscNodeDataPoolContentUtil::h_GetDataTypeSizeInByte(ore_Type) * 8U;
+
+   orc_Signal.e_ComByteOrder = ((mh_GetRandom(oru32_State) % 2U) == 0U) ? C_OscCanSignal::eBYTE_ORDER_INTEL :
+                               C_OscCanSignal::eBYTE_ORDER_MOTOROLA;
+   if ((ore_Type == C_OscNodeDataPoolContent::eFLOAT32) || (ore_Type == C_OscNodeDataPoolContent::eFLOAT64))
+   {
+      orc_Signal.u16_ComBitLength = static_cast<uint16_t>(u32_TypeBits);
+   }
+   else
+   {
+      orc_Signal.u16_ComBitLength = static_cast<uint16_t>((mh_GetRandom(oru32_State) % u32_TypeBits) + 1U);
+   }
+   // retry until the signal fits into the data bytes
+   do
+   {
+      orc_Signal.u16_ComBitStart = static_cast<uint16_t>(mh_GetRandom(oru32_State) % 64U);
+   }
+   while (C_OscCanUtil::h_IsSignalInMessage(8U, orc_Signal) == false);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create signals of the benchmark message
+
+   Mix of byte orders, aligned and unaligned signals, sign extension and a float signal.
+
+   \param[out]  orc_Signals   Signals
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CheckCanSignalExtraction::mh_CreateBenchmarkSignals(std::vector<C_BenchmarkSignal> & orc_Signals)
+{
+   const C_OscCanSignal::E_ByteOrderType ae_Orders[] =
+   {
+      C_OscCanSignal::eBYTE_ORDER_INTEL, C_OscCanSignal::eBYTE_ORDER_INTEL, C_OscCanSignal::eBYTE_ORDER_INTEL,
+      C_OscCanSignal::eBYTE_ORDER_MOTOROLA, C_OscCanSignal::eBYTE_ORDER_MOTOROLA, C_OscCanSignal::eBYTE_ORDER_INTEL,
+      C_OscCanSignal::eBYTE_ORDER_INTEL, C_OscCanSignal::eBYTE_ORDER_INTEL
+   };
+   const uint16_t au16_Starts[] =
+   {
+      0U, 8U, 20U, 24U, 40U, 48U, 51U, 32U
+   };
+   const uint16_t au16_Lengths[] =
+   {
+      8U, 12U, 4U, 16U, 10U, 3U, 13U, 32U
+   };
+   const C_OscNodeDataPoolContent::E_Type ae_Types[] =
+   {
+      C_OscNodeDataPoolContent::eUINT8, C_OscNodeDataPoolContent::eSINT16, C_OscNodeDataPoolContent::eUINT8,
+      C_OscNodeDataPoolContent::eUINT16, C_OscNodeDataPoolContent::eSINT16, C_OscNodeDataPoolContent::eUINT8,
+      C_OscNodeDataPoolContent::eSINT32, C_OscNodeDataPoolContent::eFLOAT32
+   };
+   const float64_t af64_Factors[] =
+   {
+      1.0, 0.1, 1.0, 0.01, 0.5, 1.0, 0.25, 1.0
+   };
+   const float64_t af64_Offsets[] =
+   {
+      0.0, -40.0, 0.0, 0.0, 10.0, 0.0, -100.0, 0.0
+   };
+
+   orc_Signals.resize(sizeof(au16_Starts) / sizeof(au16_Starts[0]));
+   for (uint32_t u32_Signal = 0U; u32_Signal < orc_Signals.size(); ++u32_Signal)
+   {
+      C_BenchmarkSignal & rc_Signal = orc_Signals[u32_Signal];
+      rc_Signal.c_Signal.e_ComByteOrder = ae_Orders[u32_Signal];
+      rc_Signal.c_Signal.u16_ComBitStart = au16_Starts[u32_Signal];
+      rc_Signal.c_Signal.u16_ComBitLength = au16_Lengths[u32_Signal];
+      rc_Signal.e_Type = ae_Types[u32_Signal];
+      rc_Signal.f64_Factor = af64_Factors[u32_Signal];
+      rc_Signal.f64_Offset = af64_Offsets[u32_Signal];
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Extract value with the bit by bit extraction
+
+   \param[in]      orau8_CanDb   Data bytes of CAN message
+   \param[in]      orc_Signal    Signal
+   \param[in,out]  orc_Value     Extracted value; type has to be set
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CheckCanSignalExtraction::mh_GetReferenceValue(const uint8_t (&orau8_CanDb)[8],
+                                                      const C_OscCanSignal & orc_Signal,
+                                                      C_OscNodeDataPoolContent & orc_Value)
+{
+   std::vector<uint8_t> c_Data;
+
+   c_Data.resize(orc_Value.GetSizeByte(), 0U);
+   C_OscCanUtil::h_GetSignalValue(orau8_CanDb, orc_Signal, c_Data, orc_Value.GetType());
+   orc_Value.SetValueFromLittleEndianBlob(c_Data);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get next pseudo random number
+
+   \param[in,out]  oru32_State   Generator state
+
+   \return
+   pseudo random number
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_CheckCanSignalExtraction::mh_GetRandom(uint32_t & oru32_State)
+{
+   // xorshift32
+   oru32_State ^= oru32_State << 13U;
+   oru32_State ^= oru32_State >> 17U;
+   oru32_State ^= oru32_State << 5U;
+   return oru32_State;
+}
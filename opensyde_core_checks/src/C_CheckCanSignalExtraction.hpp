@@ -0,0 +1,60 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Check and benchmark of the precompiled CAN signal extraction (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_CHECKCANSIGNALEXTRACTION_HPP
+#define C_CHECKCANSIGNALEXTRACTION_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
+
+#include "stwtypes.hpp"
+#include "C_OscCanSignal.hpp"
+#include "C_OscNodeDataPoolContent.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_CheckCanSignalExtraction
+{
+public:
+   static bool h_Run(void);
+
+private:
+   ///Signal of the benchmark message
+   class C_BenchmarkSignal
+   {
+   public:
+      stw::opensyde_core::C_OscCanSignal c_Signal;
+      stw::opensyde_core::C_OscNodeDataPoolContent::E_Type e_Type;
+      float64_t f64_Factor;
+      float64_t f64_Offset;
+   };
+
+   static bool mh_CheckRandomSignals(void);
+   static bool mh_RunBenchmark(void);
+   static void mh_CreateRandomSignal(uint32_t & oru32_State, stw::opensyde_core::C_OscCanSignal & orc_Signal,
+                                     stw::opensyde_core::C_OscNodeDataPoolContent::E_Type & ore_Type);
+   static void mh_CreateBenchmarkSignals(std::vector<C_BenchmarkSignal> & orc_Signals);
+   static void mh_GetReferenceValue(const uint8_t (&orau8_CanDb)[8],
+                                    const stw::opensyde_core::C_OscCanSignal & orc_Signal,
+                                    stw::opensyde_core::C_OscNodeDataPoolContent & orc_Value);
+   static uint32_t mh_GetRandom(uint32_t & oru32_State);
+
+   static const uint32_t mhu32_NUM_RANDOM_SIGNALS;
+   static const uint32_t mhu32_NUM_BENCHMARK_FRAMES;
+   static const uint32_t mhu32_NUM_BENCHMARK_ROUNDS;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+
+#endif
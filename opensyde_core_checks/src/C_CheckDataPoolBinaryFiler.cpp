@@ -0,0 +1,857 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Check of the binary Datapool filer against the XML Datapool filer
+
+   C_OscNodeDataPoolBinaryFiler is used for the clipboard instead of the XML based C_OscNodeDataPoolFiler.
+   Both have to result in the same content:
+   - a Datapool of each type (all element types, arrays, data sets, NVM and diagnostic properties) is saved and
+     loaded once via XML and once via the binary format; the loaded results are compared
+   - the same is done for the Datapool lists, list elements and data sets payloads
+   - binary buffers have to be consumed completely and each truncated buffer has to be rejected
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <iostream>
+
+#include "stwtypes.hpp"
+#include "stwerrors.hpp"
+#include "TglUtils.hpp"
+#include "C_OscXmlParser.hpp"
+#include "C_OscNodeDataPoolFiler.hpp"
+#include "C_OscNodeDataPoolBinaryFiler.hpp"
+#include "C_OscNodeDataPoolContentUtil.hpp"
+#include "C_CheckDataPoolBinaryFiler.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::scl;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Run check
+
+   \return
+   true     binary and XML filer give the same result for all Datapool types
+   false    at least one difference found (details printed to console)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckDataPoolBinaryFiler::h_Run(void)
+{
+   bool q_Return = true;
+   const C_OscNodeDataPool::E_Type ae_Types[] =
+   {
+      C_OscNodeDataPool::eDIAG, C_OscNodeDataPool::eNVM, C_OscNodeDataPool::eCOM, C_OscNodeDataPool::eHALC,
+      C_OscNodeDataPool::eHALC_NVM
+   };
+
+   for (uint32_t u32_Type = 0U; u32_Type < (sizeof(ae_Types) / sizeof(ae_Types[0])); ++u32_Type)
+   {
+      C_OscNodeDataPool c_DataPool;
+      bool q_Passed;
+
+      mh_CreateDataPool(ae_Types[u32_Type], c_DataPool);
+
+      q_Passed = mh_CheckDataPool(c_DataPool);
+      q_Passed = mh_CheckLists(c_DataPool) && q_Passed;
+      q_Passed = mh_CheckElements(c_DataPool) && q_Passed;
+      q_Passed = mh_CheckDataSets(c_DataPool) && q_Passed;
+      if (q_Passed == false)
+      {
+         std::cout << "   for Datapool type " <<
+            C_OscNodeDataPoolFiler::h_DataPoolToString(ae_Types[u32_Type]).c_str() << std::endl;
+         q_Return = false;
+      }
+   }
+   q_Return = mh_CheckInconsistentContent() && q_Return;
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create Datapool using all properties stored by the filers
+
+   List 0 contains one element of each content type, every second one is an array, and two data sets.
+   List 1 is empty.
+
+   \param[in]   oe_Type        Datapool type
+   \param[out]  orc_DataPool   Created Datapool
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CheckDataPoolBinaryFiler::mh_CreateDataPool(const C_OscNodeDataPool::E_Type oe_Type,
+                                                   C_OscNodeDataPool & orc_DataPool)
+{
+   const C_OscNodeDataPoolContent::E_Type ae_ContentTypes[] =
+   {
+      C_OscNodeDataPoolContent::eUINT8, C_OscNodeDataPoolContent::eUINT16, C_OscNodeDataPoolContent::eUINT32,
+      C_OscNodeDataPoolContent::eUINT64, C_OscNodeDataPoolContent::eSINT8, C_OscNodeDataPoolContent::eSINT16,
+      C_OscNodeDataPoolContent::eSINT32, C_OscNodeDataPoolContent::eSINT64, C_OscNodeDataPoolContent::eFLOAT32,
+      C_OscNodeDataPoolContent::eFLOAT64
+   };
+   const uint32_t u32_NUM_DATA_SETS = 2U;
+   const uint32_t u32_ARRAY_SIZE = 3U;
+   C_OscNodeDataPoolList c_List;
+
+   orc_DataPool.e_Type = oe_Type;
+   orc_DataPool.c_Name = "Pool_" + C_OscNodeDataPoolFiler::h_DataPoolToString(oe_Type);
+   orc_DataPool.au8_Version[0] = 1U;
+   orc_DataPool.au8_Version[1] = 2U;
+   orc_DataPool.au8_Version[2] = 3U;
+   orc_DataPool.u16_DefinitionCrcVersion = 2U;
+   orc_DataPool.c_Comment = "Comment with <markup> & \"quotes\"\nin two lines";
+   orc_DataPool.s32_RelatedDataBlockIndex = 1;
+   orc_DataPool.q_IsSafety = true;
+   orc_DataPool.q_ScopeIsPrivate = false;
+   orc_DataPool.u32_NvmStartAddress = 0x100U;
+   orc_DataPool.u32_NvmSize = 0x400U;
+   orc_DataPool.c_Lists.clear();
+
+   c_List.c_Name = "List";
+   c_List.c_Comment = "List comment";
+   c_List.q_NvmCrcActive = true;
+   c_List.u32_NvmCrc = 0x1234U;
+   c_List.u32_NvmStartAddress = 0x100U;
+   c_List.u32_NvmSize = 0x200U;
+   c_List.c_Elements.clear();
+   c_List.c_DataSets.clear();
+   for (uint32_t u32_DataSet = 0U; u32_DataSet < u32_NUM_DATA_SETS; ++u32_DataSet)
+   {
+      C_OscNodeDataPoolDataSet c_DataSet;
+      c_DataSet.c_Name = "DataSet_" + C_SclString::IntToStr(u32_DataSet);
+      c_DataSet.c_Comment = "Data set comment " + C_SclString::IntToStr(u32_DataSet);
+      c_List.c_DataSets.push_back(c_DataSet);
+   }
+   for (uint32_t u32_Element = 0U; u32_Element < (sizeof(ae_ContentTypes) / sizeof(ae_ContentTypes[0]));
+        ++u32_Element)
+   {
+      const bool q_Signed = (u32_Element >= 4U);
+      C_OscNodeDataPoolListElement c_Element;
+
+      c_Element.c_Name = "Element_" + C_SclString::IntToStr(u32_Element);
+      c_Element.c_Comment = "Element comment & <" + C_SclString::IntToStr(u32_Element) + ">";
+      c_Element.c_Unit = "mV";
+      c_Element.f64_Factor = 0.5;
+      c_Element.f64_Offset = -1.25;
+      c_Element.e_Access = ((u32_Element % 2U) == 0U) ? C_OscNodeDataPoolListElement::eACCESS_RW :
+                           C_OscNodeDataPoolListElement::eACCESS_RO;
+      c_Element.q_DiagEventCall = ((u32_Element % 3U) == 0U);
+      c_Element.u32_NvmStartAddress = 0x100U + (u32_Element * 0x10U);
+      c_Element.c_DataSetValues.resize(u32_NUM_DATA_SETS);
+      c_Element.SetType(ae_ContentTypes[u32_Element]);
+      c_Element.SetArray((u32_Element % 2U) == 1U);
+      if (c_Element.GetArray() == true)
+      {
+         c_Element.SetArraySize(u32_ARRAY_SIZE);
+      }
+      for (uint32_t u32_Index = 0U; u32_Index < c_Element.GetArraySize(); ++u32_Index)
+      {
+         const float64_t f64_Base = (q_Signed == true) ? -10.0 : 10.0;
+         const float64_t f64_Fraction = (u32_Element >= 8U) ? 0.375 : 0.0;
+         const float64_t f64_Index = static_cast<float64_t>(u32_Index);
+
+         C_OscNodeDataPoolContentUtil::h_SetValueInContent(f64_Base + f64_Index + f64_Fraction,
+                                                           c_Element.c_MinValue, u32_Index);
+         C_OscNodeDataPoolContentUtil::h_SetValueInContent(100.0 + f64_Index + f64_Fraction,
+                                                           c_Element.c_MaxValue, u32_Index);
+         C_OscNodeDataPoolContentUtil::h_SetValueInContent(50.0 + f64_Index, c_Element.c_Value, u32_Index);
+         C_OscNodeDataPoolContentUtil::h_SetValueInContent(60.0 + f64_Index, c_Element.c_NvmValue, u32_Index);
+         for (uint32_t u32_DataSet = 0U; u32_DataSet < u32_NUM_DATA_SETS; ++u32_DataSet)
+         {
+            C_OscNodeDataPoolContentUtil::h_SetValueInContent(
+               20.0 + (10.0 * static_cast<float64_t>(u32_DataSet)) + f64_Index + f64_Fraction,
+               c_Element.c_DataSetValues[u32_DataSet], u32_Index);
+         }
+      }
+      c_List.c_Elements.push_back(c_Element);
+   }
+   orc_DataPool.c_Lists.push_back(c_List);
+
+   c_List.c_Name = "EmptyList";
+   c_List.c_Comment = "";
+   c_List.q_NvmCrcActive = false;
+   c_List.u32_NvmCrc = 0U;
+   c_List.u32_NvmStartAddress = 0x300U;
+   c_List.c_Elements.clear();
+   c_List.c_DataSets.clear();
+   orc_DataPool.c_Lists.push_back(c_List);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check Datapool payload
+
+   \param[in]  orc_DataPool   Datapool to save and load
+
+   \return
+   true     binary result equals XML result
+   false    difference found (details printed to console)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckDataPoolBinaryFiler::mh_CheckDataPool(const C_OscNodeDataPool & orc_DataPool)
+{
+   bool q_Return = true;
+   C_SclString c_Xml;
+   C_OscXmlParser c_XmlWriter;
+   C_OscXmlParser c_XmlReader;
+   C_OscNodeDataPool c_XmlResult;
+   C_OscNodeDataPool c_BinaryResult;
+   std::vector<uint8_t> c_Buffer;
+   uint32_t u32_Position = 0U;
+   int32_t s32_XmlResult;
+   int32_t s32_BinaryResult;
+
+   c_XmlWriter.CreateAndSelectNodeChild("data-pool");
+   C_OscNodeDataPoolFiler::h_SaveDataPool(orc_DataPool, c_XmlWriter);
+   c_XmlWriter.SaveToString(c_Xml);
+   s32_XmlResult = c_XmlReader.LoadFromString(c_Xml);
+   if ((s32_XmlResult == C_NO_ERR) && (c_XmlReader.SelectRoot() == "data-pool"))
+   {
+      s32_XmlResult = C_OscNodeDataPoolFiler::h_LoadDataPool(c_XmlResult, c_XmlReader);
+   }
+
+   C_OscNodeDataPoolBinaryFiler::h_SaveHeader(C_OscNodeDataPoolBinaryFiler::eDATA_POOL, c_Buffer);
+   C_OscNodeDataPoolBinaryFiler::h_SaveDataPool(orc_DataPool, c_Buffer);
+   s32_BinaryResult = C_OscNodeDataPoolBinaryFiler::h_LoadHeader(C_OscNodeDataPoolBinaryFiler::eDATA_POOL, c_Buffer,
+                                                                  u32_Position);
+   if (s32_BinaryResult == C_NO_ERR)
+   {
+      s32_BinaryResult = C_OscNodeDataPoolBinaryFiler::h_LoadDataPool(c_BinaryResult, c_Buffer, u32_Position);
+   }
+
+   if ((s32_XmlResult != C_NO_ERR) || (s32_BinaryResult != C_NO_ERR) || (u32_Position != c_Buffer.size()))
+   {
+      std::cout << "Datapool could not be loaded: XML " << s32_XmlResult << ", binary " << s32_BinaryResult <<
+         " at " << u32_Position << " of " << c_Buffer.size() << " bytes" << std::endl;
+      q_Return = false;
+   }
+   else
+   {
+      uint32_t u32_XmlHash = 0xFFFFFFFFU;
+      uint32_t u32_BinaryHash = 0xFFFFFFFFU;
+
+      c_XmlResult.CalcHash(u32_XmlHash);
+      c_BinaryResult.CalcHash(u32_BinaryHash);
+      if (u32_XmlHash != u32_BinaryHash)
+      {
+         std::cout << "Datapool properties differ: " << orc_DataPool.c_Name.c_str() << std::endl;
+         q_Return = false;
+      }
+      q_Return = mh_CompareLists(c_XmlResult.c_Lists, c_BinaryResult.c_Lists) && q_Return;
+   }
+   q_Return = mh_CheckTruncatedBuffers(c_Buffer, &C_CheckDataPoolBinaryFiler::mh_LoadDataPool) && q_Return;
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check Datapool lists payload
+
+   \param[in]  orc_DataPool   Datapool with lists to save and load
+
+   \return
+   true     binary result equals XML result
+   false    difference found (details printed to console)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckDataPoolBinaryFiler::mh_CheckLists(const C_OscNodeDataPool & orc_DataPool)
+{
+   bool q_Return = true;
+   C_SclString c_Xml;
+   C_OscXmlParser c_XmlWriter;
+   C_OscXmlParser c_XmlReader;
+   std::vector<C_OscNodeDataPoolList> c_XmlResult;
+   std::vector<C_OscNodeDataPoolList> c_BinaryResult;
+   C_OscNodeDataPool::E_Type e_BinaryType = C_OscNodeDataPool::eDIAG;
+   std::vector<uint8_t> c_Buffer;
+   uint32_t u32_Position = 0U;
+   int32_t s32_XmlResult;
+   int32_t s32_BinaryResult;
+
+   c_XmlWriter.CreateAndSelectNodeChild("lists");
+   C_OscNodeDataPoolFiler::h_SaveDataPoolLists(orc_DataPool.c_Lists, c_XmlWriter, orc_DataPool.e_Type);
+   c_XmlWriter.SaveToString(c_Xml);
+   s32_XmlResult = c_XmlReader.LoadFromString(c_Xml);
+   if ((s32_XmlResult == C_NO_ERR) && (c_XmlReader.SelectRoot() == "lists"))
+   {
+      s32_XmlResult = C_OscNodeDataPoolFiler::h_LoadDataPoolLists(c_XmlResult, c_XmlReader);
+   }
+
+   C_OscNodeDataPoolBinaryFiler::h_SaveHeader(C_OscNodeDataPoolBinaryFiler::eLISTS, c_Buffer);
+   C_OscNodeDataPoolBinaryFiler::h_SaveDataPoolLists(orc_DataPool.c_Lists, orc_DataPool.e_Type, c_Buffer);
+   s32_BinaryResult = C_OscNodeDataPoolBinaryFiler::h_LoadHeader(C_OscNodeDataPoolBinaryFiler::eLISTS, c_Buffer,
+                                                                  u32_Position);
+   if (s32_BinaryResult == C_NO_ERR)
+   {
+      s32_BinaryResult = C_OscNodeDataPoolBinaryFiler::h_LoadDataPoolLists(c_BinaryResult, e_BinaryType, c_Buffer,
+                                                                           u32_Position);
+   }
+
+   if ((s32_XmlResult != C_NO_ERR) || (s32_BinaryResult != C_NO_ERR) || (u32_Position != c_Buffer.size()))
+   {
+      std::cout << "Lists could not be loaded: XML " << s32_XmlResult << ", binary " << s32_BinaryResult <<
+         " at " << u32_Position << " of " << c_Buffer.size() << " bytes" << std::endl;
+      q_Return = false;
+   }
+   else
+   {
+      if (e_BinaryType != orc_DataPool.e_Type)
+      {
+         std::cout << "Datapool type of lists differs" << std::endl;
+         q_Return = false;
+      }
+      q_Return = mh_CompareLists(c_XmlResult, c_BinaryResult) && q_Return;
+   }
+   q_Return = mh_CheckTruncatedBuffers(c_Buffer, &C_CheckDataPoolBinaryFiler::mh_LoadLists) && q_Return;
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check Datapool list elements payload
+
+   \param[in]  orc_DataPool   Datapool with elements in the first list to save and load
+
+   \return
+   true     binary result equals XML result
+   false    difference found (details printed to console)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckDataPoolBinaryFiler::mh_CheckElements(const C_OscNodeDataPool & orc_DataPool)
+{
+   bool q_Return = true;
+   const std::vector<C_OscNodeDataPoolListElement> & rc_Elements = orc_DataPool.c_Lists[0].c_Elements;
+   C_SclString c_Xml;
+   C_OscXmlParser c_XmlWriter;
+   C_OscXmlParser c_XmlReader;
+   std::vector<C_OscNodeDataPoolListElement> c_XmlResult;
+   std::vector<C_OscNodeDataPoolListElement> c_BinaryResult;
+   C_OscNodeDataPool::E_Type e_BinaryType = C_OscNodeDataPool::eDIAG;
+   std::vector<uint8_t> c_Buffer;
+   uint32_t u32_Position = 0U;
+   int32_t s32_XmlResult;
+   int32_t s32_BinaryResult;
+
+   c_XmlWriter.CreateAndSelectNodeChild("data-elements");
+   C_OscNodeDataPoolFiler::h_SaveDataPoolListElements(rc_Elements, c_XmlWriter, orc_DataPool.e_Type);
+   c_XmlWriter.SaveToString(c_Xml);
+   s32_XmlResult = c_XmlReader.LoadFromString(c_Xml);
+   if ((s32_XmlResult == C_NO_ERR) && (c_XmlReader.SelectRoot() == "data-elements"))
+   {
+      s32_XmlResult = C_OscNodeDataPoolFiler::h_LoadDataPoolListElements(c_XmlResult, c_XmlReader);
+   }
+
+   C_OscNodeDataPoolBinaryFiler::h_SaveHeader(C_OscNodeDataPoolBinaryFiler::eLIST_ELEMENTS, c_Buffer);
+   C_OscNodeDataPoolBinaryFiler::h_SaveDataPoolListElements(rc_Elements, orc_DataPool.e_Type, c_Buffer);
+   s32_BinaryResult = C_OscNodeDataPoolBinaryFiler::h_LoadHeader(C_OscNodeDataPoolBinaryFiler::eLIST_ELEMENTS,
+                                                                  c_Buffer, u32_Position);
+   if (s32_BinaryResult == C_NO_ERR)
+   {
+      s32_BinaryResult = C_OscNodeDataPoolBinaryFiler::h_LoadDataPoolListElements(c_BinaryResult, e_BinaryType,
+                                                                                  c_Buffer, u32_Position);
+   }
+
+   if ((s32_XmlResult != C_NO_ERR) || (s32_BinaryResult != C_NO_ERR) || (u32_Position != c_Buffer.size()))
+   {
+      std::cout << "Elements could not be loaded: XML " << s32_XmlResult << ", binary " << s32_BinaryResult <<
+         " at " << u32_Position << " of " << c_Buffer.size() << " bytes" << std::endl;
+      q_Return = false;
+   }
+   else
+   {
+      if (e_BinaryType != orc_DataPool.e_Type)
+      {
+         std::cout << "Datapool type of elements differs" << std::endl;
+         q_Return = false;
+      }
+      q_Return = mh_CompareElements(c_XmlResult, c_BinaryResult) && q_Return;
+   }
+   q_Return = mh_CheckTruncatedBuffers(c_Buffer, &C_CheckDataPoolBinaryFiler::mh_LoadElements) && q_Return;
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check Datapool list data sets payload
+
+   The values of each data set are taken from the elements of the first list, as done by the data set table.
+
+   \param[in]  orc_DataPool   Datapool with data sets in the first list to save and load
+
+   \return
+   true     binary result equals XML result
+   false    difference found (details printed to console)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckDataPoolBinaryFiler::mh_CheckDataSets(const C_OscNodeDataPool & orc_DataPool)
+{
+   bool q_Return = true;
+   const C_OscNodeDataPoolList & rc_List = orc_DataPool.c_Lists[0];
+   std::vector<std::vector<C_OscNodeDataPoolContent> > c_DataSetValues;
+   std::vector<C_OscNodeDataPoolDataSet> c_XmlDataSets;
+   std::vector<std::vector<C_OscNodeDataPoolContent> > c_XmlValues;
+   std::vector<C_OscNodeDataPoolDataSet> c_BinaryDataSets;
+   std::vector<std::vector<C_OscNodeDataPoolContent> > c_BinaryValues;
+   std::vector<uint8_t> c_Buffer;
+   uint32_t u32_Position = 0U;
+   int32_t s32_XmlResult;
+   int32_t s32_BinaryResult;
+
+   c_DataSetValues.resize(rc_List.c_DataSets.size());
+   for (uint32_t u32_DataSet = 0U; u32_DataSet < rc_List.c_DataSets.size(); ++u32_DataSet)
+   {
+      for (uint32_t u32_Element = 0U; u32_Element < rc_List.c_Elements.size(); ++u32_Element)
+      {
+         c_DataSetValues[u32_DataSet].push_back(rc_List.c_Elements[u32_Element].c_DataSetValues[u32_DataSet]);
+      }
+   }
+
+   s32_XmlResult = mh_RoundTripDataSetsXml(rc_List.c_DataSets, c_DataSetValues, c_XmlDataSets, c_XmlValues);
+
+   C_OscNodeDataPoolBinaryFiler::h_SaveHeader(C_OscNodeDataPoolBinaryFiler::eDATA_SETS, c_Buffer);
+   C_OscNodeDataPoolBinaryFiler::h_SaveDataPoolListDataSets(rc_List.c_DataSets, c_DataSetValues, c_Buffer);
+   s32_BinaryResult = C_OscNodeDataPoolBinaryFiler::h_LoadHeader(C_OscNodeDataPoolBinaryFiler::eDATA_SETS, c_Buffer,
+                                                                  u32_Position);
+   if (s32_BinaryResult == C_NO_ERR)
+   {
+      s32_BinaryResult = C_OscNodeDataPoolBinaryFiler::h_LoadDataPoolListDataSets(c_BinaryDataSets, c_BinaryValues,
+                                                                                  c_Buffer, u32_Position);
+   }
+
+   if ((s32_XmlResult != C_NO_ERR) || (s32_BinaryResult != C_NO_ERR) || (u32_Position != c_Buffer.size()))
+   {
+      std::cout << "Data sets could not be loaded: XML " << s32_XmlResult << ", binary " << s32_BinaryResult <<
+         " at " << u32_Position << " of " << c_Buffer.size() << " bytes" << std::endl;
+      q_Return = false;
+   }
+   else if ((c_XmlDataSets.size() != c_BinaryDataSets.size()) || (c_XmlValues != c_BinaryValues))
+   {
+      std::cout << "Data sets differ" << std::endl;
+      q_Return = false;
+   }
+   else
+   {
+      for (uint32_t u32_DataSet = 0U; u32_DataSet < c_XmlDataSets.size(); ++u32_DataSet)
+      {
+         uint32_t u32_XmlHash = 0xFFFFFFFFU;
+         uint32_t u32_BinaryHash = 0xFFFFFFFFU;
+
+         c_XmlDataSets[u32_DataSet].CalcHash(u32_XmlHash);
+         c_BinaryDataSets[u32_DataSet].CalcHash(u32_BinaryHash);
+         if (u32_XmlHash != u32_BinaryHash)
+         {
+            std::cout << "Data set differs: " << c_XmlDataSets[u32_DataSet].c_Name.c_str() << std::endl;
+            q_Return = false;
+         }
+      }
+   }
+   q_Return = mh_CheckTruncatedBuffers(c_Buffer, &C_CheckDataPoolBinaryFiler::mh_LoadDataSets) && q_Return;
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Compare lists loaded by the XML and by the binary filer
+
+   \param[in]  orc_Xml      Lists loaded by XML filer
+   \param[in]  orc_Binary   Lists loaded by binary filer
+
+   \return
+   true     equal
+   false    difference found (details printed to console)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckDataPoolBinaryFiler::mh_CompareLists(const std::vector<C_OscNodeDataPoolList> & orc_Xml,
+                                                 const std::vector<C_OscNodeDataPoolList> & orc_Binary)
+{
+   bool q_Return = true;
+
+   if (orc_Xml.size() == orc_Binary.size())
+   {
+      for (uint32_t u32_List = 0U; u32_List < orc_Xml.size(); ++u32_List)
+      {
+         const C_OscNodeDataPoolList & rc_Xml = orc_Xml[u32_List];
+         const C_OscNodeDataPoolList & rc_Binary = orc_Binary[u32_List];
+         uint32_t u32_XmlHash = 0xFFFFFFFFU;
+         uint32_t u32_BinaryHash = 0xFFFFFFFFU;
+
+         rc_Xml.CalcHash(u32_XmlHash);
+         rc_Binary.CalcHash(u32_BinaryHash);
+         //the CRC flag is not part of the hash
+         if ((u32_XmlHash != u32_BinaryHash) || (rc_Xml.q_NvmCrcActive != rc_Binary.q_NvmCrcActive))
+         {
+            std::cout << "List differs: " << rc_Xml.c_Name.c_str() << std::endl;
+            q_Return = false;
+         }
+         q_Return = mh_CompareElements(rc_Xml.c_Elements, rc_Binary.c_Elements) && q_Return;
+      }
+   }
+   else
+   {
+      std::cout << "Number of lists differs: " << orc_Xml.size() << " XML, " << orc_Binary.size() << " binary" <<
+         std::endl;
+      q_Return = false;
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Compare elements loaded by the XML and by the binary filer
+
+   \param[in]  orc_Xml      Elements loaded by XML filer
+   \param[in]  orc_Binary   Elements loaded by binary filer
+
+   \return
+   true     equal
+   false    difference found (details printed to console)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckDataPoolBinaryFiler::mh_CompareElements(const std::vector<C_OscNodeDataPoolListElement> & orc_Xml,
+                                                    const std::vector<C_OscNodeDataPoolListElement> & orc_Binary)
+{
+   bool q_Return = true;
+
+   if (orc_Xml.size() == orc_Binary.size())
+   {
+      for (uint32_t u32_Element = 0U; u32_Element < orc_Xml.size(); ++u32_Element)
+      {
+         const C_OscNodeDataPoolListElement & rc_Xml = orc_Xml[u32_Element];
+         const C_OscNodeDataPoolListElement & rc_Binary = orc_Binary[u32_Element];
+         uint32_t u32_XmlHash = 0xFFFFFFFFU;
+         uint32_t u32_BinaryHash = 0xFFFFFFFFU;
+
+         rc_Xml.CalcHash(u32_XmlHash);
+         rc_Binary.CalcHash(u32_BinaryHash);
+         //the values are not part of the hash
+         if ((u32_XmlHash != u32_BinaryHash) || (rc_Xml.c_Value != rc_Binary.c_Value) ||
+             (rc_Xml.c_NvmValue != rc_Binary.c_NvmValue))
+         {
+            std::cout << "Element differs: " << rc_Xml.c_Name.c_str() << std::endl;
+            q_Return = false;
+         }
+      }
+   }
+   else
+   {
+      std::cout << "Number of elements differs: " << orc_Xml.size() << " XML, " << orc_Binary.size() << " binary" <<
+         std::endl;
+      q_Return = false;
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Save and load data sets with values via XML
+
+   Uses the same structure as the XML clipboard content of data sets.
+
+   \param[in]   orc_DataSets              Data sets to save
+   \param[in]   orc_DataSetValues         Values of each data set to save
+   \param[out]  orc_LoadedDataSets        Loaded data sets
+   \param[out]  orc_LoadedDataSetValues   Loaded values of each data set
+
+   \return
+   C_NO_ERR   loaded
+   else       XML could not be loaded
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_CheckDataPoolBinaryFiler::mh_RoundTripDataSetsXml(
+   const std::vector<C_OscNodeDataPoolDataSet> & orc_DataSets,
+   const std::vector<std::vector<C_OscNodeDataPoolContent> > & orc_DataSetValues,
+   std::vector<C_OscNodeDataPoolDataSet> & orc_LoadedDataSets,
+   std::vector<std::vector<C_OscNodeDataPoolContent> > & orc_LoadedDataSetValues)
+{
+   int32_t s32_Return;
+   C_SclString c_Xml;
+   C_OscXmlParser c_XmlWriter;
+   C_OscXmlParser c_XmlReader;
+
+   c_XmlWriter.CreateAndSelectNodeChild("core");
+   c_XmlWriter.CreateAndSelectNodeChild("data-sets");
+   C_OscNodeDataPoolFiler::h_SaveDataPoolListDataSets(orc_DataSets, c_XmlWriter);
+   tgl_assert(c_XmlWriter.SelectNodeParent() == "core");
+   c_XmlWriter.CreateAndSelectNodeChild("data-sets-2");
+   for (uint32_t u32_DataSet = 0U; u32_DataSet < orc_DataSetValues.size(); ++u32_DataSet)
+   {
+      c_XmlWriter.CreateAndSelectNodeChild("data-set-values");
+      for (uint32_t u32_Value = 0U; u32_Value < orc_DataSetValues[u32_DataSet].size(); ++u32_Value)
+      {
+         c_XmlWriter.CreateAndSelectNodeChild("value");
+         C_OscNodeDataPoolFiler::h_SaveDataPoolContentV1(orc_DataSetValues[u32_DataSet][u32_Value], c_XmlWriter);
+         tgl_assert(c_XmlWriter.SelectNodeParent() == "data-set-values");
+      }
+      tgl_assert(c_XmlWriter.SelectNodeParent() == "data-sets-2");
+   }
+   c_XmlWriter.SaveToString(c_Xml);
+
+   orc_LoadedDataSets.clear();
+   orc_LoadedDataSetValues.clear();
+   s32_Return = c_XmlReader.LoadFromString(c_Xml);
+   if ((s32_Return == C_NO_ERR) && (c_XmlReader.SelectRoot() == "core") &&
+       (c_XmlReader.SelectNodeChild("data-sets") == "data-sets"))
+   {
+      s32_Return = C_OscNodeDataPoolFiler::h_LoadDataPoolListDataSets(orc_LoadedDataSets, c_XmlReader);
+      tgl_assert(c_XmlReader.SelectNodeParent() == "core");
+      if ((s32_Return == C_NO_ERR) && (c_XmlReader.SelectNodeChild("data-sets-2") == "data-sets-2"))
+      {
+         C_SclString c_CurNodeDataSet = c_XmlReader.SelectNodeChild("data-set-values");
+         while ((c_CurNodeDataSet == "data-set-values") && (s32_Return == C_NO_ERR))
+         {
+            std::vector<C_OscNodeDataPoolContent> c_Values;
+            if (c_XmlReader.SelectNodeChild("value") == "value")
+            {
+               do
+               {
+                  C_OscNodeDataPoolContent c_Value;
+                  s32_Return = C_OscNodeDataPoolFiler::h_LoadDataPoolContentV1(c_Value, c_XmlReader);
+                  c_Values.push_back(c_Value);
+               }
+               while ((s32_Return == C_NO_ERR) && (c_XmlReader.SelectNodeNext("value") == "value"));
+               tgl_assert(c_XmlReader.SelectNodeParent() == "data-set-values");
+            }
+            orc_LoadedDataSetValues.push_back(c_Values);
+            c_CurNodeDataSet = c_XmlReader.SelectNodeNext("data-set-values");
+         }
+      }
+      else
+      {
+         s32_Return = C_CONFIG;
+      }
+   }
+   else
+   {
+      s32_Return = C_CONFIG;
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check content with array size not matching its value size is rejected
+
+   Layout of a content: type (1 byte), array flag (1 byte), array size (4 bytes), value size (4 bytes), value.
+
+   \return
+   true     consistent content loaded, inconsistent ones rejected
+   false    else (details printed to console)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckDataPoolBinaryFiler::mh_CheckInconsistentContent(void)
+{
+   bool q_Return = true;
+   const uint32_t u32_ARRAY_SIZE_POSITION = 2U;
+   C_OscNodeDataPoolContent c_Content;
+   C_OscNodeDataPoolContent c_Result;
+   std::vector<uint8_t> c_Buffer;
+   std::vector<uint8_t> c_Corrupt;
+   uint32_t u32_Position = 0U;
+
+   c_Content.SetType(C_OscNodeDataPoolContent::eUINT16);
+   c_Content.SetArray(true);
+   c_Content.SetArraySize(3U);
+   C_OscNodeDataPoolBinaryFiler::h_SaveDataPoolContent(c_Content, c_Buffer);
+
+   if ((C_OscNodeDataPoolBinaryFiler::h_LoadDataPoolContent(c_Result, c_Buffer, u32_Position) != C_NO_ERR) ||
+       (c_Result.GetArraySize() != 3U))
+   {
+      std::cout << "Consistent array content was not loaded" << std::endl;
+      q_Return = false;
+   }
+
+   //huge array size: must be rejected before any array is allocated
+   c_Corrupt = c_Buffer;
+   c_Corrupt[u32_ARRAY_SIZE_POSITION + 3U] = 0x40U;
+   u32_Position = 0U;
+   if (C_OscNodeDataPoolBinaryFiler::h_LoadDataPoolContent(c_Result, c_Corrupt, u32_Position) == C_NO_ERR)
+   {
+      std::cout << "Content with array size exceeding its value size was accepted" << std::endl;
+      q_Return = false;
+   }
+
+   //smaller array size than the value contains
+   c_Corrupt = c_Buffer;
+   c_Corrupt[u32_ARRAY_SIZE_POSITION] = 2U;
+   u32_Position = 0U;
+   if (C_OscNodeDataPoolBinaryFiler::h_LoadDataPoolContent(c_Result, c_Corrupt, u32_Position) == C_NO_ERR)
+   {
+      std::cout << "Content with array size below its value size was accepted" << std::endl;
+      q_Return = false;
+   }
+
+   //non array content holding three values
+   c_Corrupt = c_Buffer;
+   c_Corrupt[1U] = 0U;
+   u32_Position = 0U;
+   if (C_OscNodeDataPoolBinaryFiler::h_LoadDataPoolContent(c_Result, c_Corrupt, u32_Position) == C_NO_ERR)
+   {
+      std::cout << "Non array content with array size 3 was accepted" << std::endl;
+      q_Return = false;
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check each truncated part of a binary buffer is rejected
+
+   \param[in]  orc_Buffer   Complete buffer
+   \param[in]  opr_Load     Load function for the payload type of the buffer
+
+   \return
+   true     all truncated buffers rejected
+   false    at least one truncated buffer accepted (details printed to console)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckDataPoolBinaryFiler::mh_CheckTruncatedBuffers(const std::vector<uint8_t> & orc_Buffer,
+                                                          const PR_LoadBuffer opr_Load)
+{
+   bool q_Return = true;
+
+   for (uint32_t u32_Size = 0U; (u32_Size < orc_Buffer.size()) && (q_Return == true); ++u32_Size)
+   {
+      const std::vector<uint8_t> c_Truncated(orc_Buffer.begin(), orc_Buffer.begin() + u32_Size);
+
+      if (opr_Load(c_Truncated) == C_NO_ERR)
+      {
+         std::cout << "Buffer truncated to " << u32_Size << " of " << orc_Buffer.size() << " bytes was accepted" <<
+            std::endl;
+         q_Return = false;
+      }
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Load complete binary buffer with Datapool payload
+
+   \param[in]  orc_Buffer   Buffer
+
+   \return
+   C_NO_ERR   loaded and buffer completely consumed
+   else       buffer invalid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_CheckDataPoolBinaryFiler::mh_LoadDataPool(const std::vector<uint8_t> & orc_Buffer)
+{
+   C_OscNodeDataPool c_DataPool;
+   uint32_t u32_Position = 0U;
+   int32_t s32_Return = C_OscNodeDataPoolBinaryFiler::h_LoadHeader(C_OscNodeDataPoolBinaryFiler::eDATA_POOL,
+                                                                   orc_Buffer, u32_Position);
+
+   if (s32_Return == C_NO_ERR)
+   {
+      s32_Return = C_OscNodeDataPoolBinaryFiler::h_LoadDataPool(c_DataPool, orc_Buffer, u32_Position);
+   }
+   if ((s32_Return == C_NO_ERR) && (u32_Position != orc_Buffer.size()))
+   {
+      s32_Return = C_CONFIG;
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Load complete binary buffer with lists payload
+
+   \param[in]  orc_Buffer   Buffer
+
+   \return
+   C_NO_ERR   loaded and buffer completely consumed
+   else       buffer invalid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_CheckDataPoolBinaryFiler::mh_LoadLists(const std::vector<uint8_t> & orc_Buffer)
+{
+   std::vector<C_OscNodeDataPoolList> c_Lists;
+   C_OscNodeDataPool::E_Type e_Type;
+   uint32_t u32_Position = 0U;
+   int32_t s32_Return = C_OscNodeDataPoolBinaryFiler::h_LoadHeader(C_OscNodeDataPoolBinaryFiler::eLISTS,
+                                                                   orc_Buffer, u32_Position);
+
+   if (s32_Return == C_NO_ERR)
+   {
+      s32_Return = C_OscNodeDataPoolBinaryFiler::h_LoadDataPoolLists(c_Lists, e_Type, orc_Buffer, u32_Position);
+   }
+   if ((s32_Return == C_NO_ERR) && (u32_Position != orc_Buffer.size()))
+   {
+      s32_Return = C_CONFIG;
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Load complete binary buffer with list elements payload
+
+   \param[in]  orc_Buffer   Buffer
+
+   \return
+   C_NO_ERR   loaded and buffer completely consumed
+   else       buffer invalid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_CheckDataPoolBinaryFiler::mh_LoadElements(const std::vector<uint8_t> & orc_Buffer)
+{
+   std::vector<C_OscNodeDataPoolListElement> c_Elements;
+   C_OscNodeDataPool::E_Type e_Type;
+   uint32_t u32_Position = 0U;
+   int32_t s32_Return = C_OscNodeDataPoolBinaryFiler::h_LoadHeader(C_OscNodeDataPoolBinaryFiler::eLIST_ELEMENTS,
+                                                                   orc_Buffer, u32_Position);
+
+   if (s32_Return == C_NO_ERR)
+   {
+      s32_Return = C_OscNodeDataPoolBinaryFiler::h_LoadDataPoolListElements(c_Elements, e_Type, orc_Buffer,
+                                                                            u32_Position);
+   }
+   if ((s32_Return == C_NO_ERR) && (u32_Position != orc_Buffer.size()))
+   {
+      s32_Return = C_CONFIG;
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Load complete binary buffer with data sets payload
+
+   \param[in]  orc_Buffer   Buffer
+
+   \return
+   C_NO_ERR   loaded and buffer completely consumed
+   else       buffer invalid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_CheckDataPoolBinaryFiler::mh_LoadDataSets(const std::vector<uint8_t> & orc_Buffer)
+{
+   std::vector<C_OscNodeDataPoolDataSet> c_DataSets;
+   std::vector<std::vector<C_OscNodeDataPoolContent> > c_Values;
+   uint32_t u32_Position = 0U;
+   int32_t s32_Return = C_OscNodeDataPoolBinaryFiler::h_LoadHeader(C_OscNodeDataPoolBinaryFiler::eDATA_SETS,
+                                                                   orc_Buffer, u32_Position);
+
+   if (s32_Return == C_NO_ERR)
+   {
+      s32_Return = C_OscNodeDataPoolBinaryFiler::h_LoadDataPoolListDataSets(c_DataSets, c_Values, orc_Buffer,
+                                                                            u32_Position);
+   }
+   if ((s32_Return == C_NO_ERR) && (u32_Position != orc_Buffer.size()))
+   {
+      s32_Return = C_CONFIG;
+   }
+   return s32_Return;
+}
@@ -0,0 +1,60 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Check of the binary Datapool filer against the XML Datapool filer (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_CHECKDATAPOOLBINARYFILER_HPP
+#define C_CHECKDATAPOOLBINARYFILER_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
+
+#include "stwtypes.hpp"
+#include "C_OscNodeDataPool.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_CheckDataPoolBinaryFiler
+{
+public:
+   static bool h_Run(void);
+
+private:
+   ///Loads a binary buffer of one payload type, returns C_NO_ERR only if the buffer is complete
+   typedef int32_t (* PR_LoadBuffer)(const std::vector<uint8_t> & orc_Buffer);
+
+   static void mh_CreateDataPool(const stw::opensyde_core::C_OscNodeDataPool::E_Type oe_Type,
+                                 stw::opensyde_core::C_OscNodeDataPool & orc_DataPool);
+   static bool mh_CheckDataPool(const stw::opensyde_core::C_OscNodeDataPool & orc_DataPool);
+   static bool mh_CheckLists(const stw::opensyde_core::C_OscNodeDataPool & orc_DataPool);
+   static bool mh_CheckElements(const stw::opensyde_core::C_OscNodeDataPool & orc_DataPool);
+   static bool mh_CheckDataSets(const stw::opensyde_core::C_OscNodeDataPool & orc_DataPool);
+   static bool mh_CompareLists(const std::vector<stw::opensyde_core::C_OscNodeDataPoolList> & orc_Xml,
+                               const std::vector<stw::opensyde_core::C_OscNodeDataPoolList> & orc_Binary);
+   static bool mh_CompareElements(const std::vector<stw::opensyde_core::C_OscNodeDataPoolListElement> & orc_Xml,
+                                  const std::vector<stw::opensyde_core::C_OscNodeDataPoolListElement> & orc_Binary);
+   static int32_t mh_RoundTripDataSetsXml(
+      const std::vector<stw::opensyde_core::C_OscNodeDataPoolDataSet> & orc_DataSets,
+      const std::vector<std::vector<stw::opensyde_core::C_OscNodeDataPoolContent> > & orc_DataSetValues,
+      std::vector<stw::opensyde_core::C_OscNodeDataPoolDataSet> & orc_LoadedDataSets,
+      std::vector<std::vector<stw::opensyde_core::C_OscNodeDataPoolContent> > & orc_LoadedDataSetValues);
+   static bool mh_CheckInconsistentContent(void);
+   static bool mh_CheckTruncatedBuffers(const std::vector<uint8_t> & orc_Buffer, const PR_LoadBuffer opr_Load);
+   static int32_t mh_LoadDataPool(const std::vector<uint8_t> & orc_Buffer);
+   static int32_t mh_LoadLists(const std::vector<uint8_t> & orc_Buffer);
+   static int32_t mh_LoadElements(const std::vector<uint8_t> & orc_Buffer);
+   static int32_t mh_LoadDataSets(const std::vector<uint8_t> & orc_Buffer);
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+
+#endif
@@ -0,0 +1,531 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Check of the in-place update of HAL Datapools
+
+   C_OscHalcMagicianGenerator::UpdateHalcDatapools only refills the values of the HALC domains and channels changed
+   since the last generation. The result has to equal a complete regeneration:
+   - HAL Datapools are generated and placed behind a datapool of another type
+   - configuration values are changed step by step (plain and struct parameters, use cases, complete domain
+     configurations, names and NVM start addresses)
+   - after each step the datapools are updated in place and compared to datapools generated from scratch
+
+   Each safety mode is checked with and without NVM based configuration.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <iostream>
+
+#include "stwtypes.hpp"
+#include "stwerrors.hpp"
+#include "C_OscHalcMagicianGenerator.hpp"
+#include "C_OscNodeDataPoolContentUtil.hpp"
+#include "C_CheckHalcDatapoolUpdate.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::scl;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint32_t C_CheckHalcDatapoolUpdate::mhu32_NUM_STEPS = 4U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Run check
+
+   \return
+   true     updated datapools equal regenerated ones for all configurations
+   false    at least one difference found (details printed to console)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckHalcDatapoolUpdate::h_Run(void)
+{
+   bool q_Return = true;
+   const C_OscHalcDefBase::E_SafetyMode ae_SafetyModes[] =
+   {
+      C_OscHalcDefBase::eTWO_LEVELS_WITH_DROPPING, C_OscHalcDefBase::eTWO_LEVELS_WITHOUT_DROPPING,
+      C_OscHalcDefBase::eONE_LEVEL_ALL_SAFE, C_OscHalcDefBase::eONE_LEVEL_ALL_NON_SAFE
+   };
+
+   for (uint32_t u32_Mode = 0U; u32_Mode < (sizeof(ae_SafetyModes) / sizeof(ae_SafetyModes[0])); ++u32_Mode)
+   {
+      q_Return = mh_CheckConfiguration(ae_SafetyModes[u32_Mode], false) && q_Return;
+      q_Return = mh_CheckConfiguration(ae_SafetyModes[u32_Mode], true) && q_Return;
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check update against regeneration for one HALC configuration
+
+   \param[in]  oe_SafetyMode  Safety mode of the configuration
+   \param[in]  oq_NvmBased    Flag if the configuration is NVM based
+
+   \return
+   true     updated datapools equal regenerated ones after each step
+   false    update failed or differs from regeneration
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckHalcDatapoolUpdate::mh_CheckConfiguration(const C_OscHalcDefBase::E_SafetyMode oe_SafetyMode,
+                                                      const bool oq_NvmBased)
+{
+   bool q_Return = true;
+   C_OscNode c_Node;
+   C_OscNodeDataPool c_OtherDatapool;
+   std::vector<C_OscNodeDataPool> c_Generated;
+   const C_OscHalcMagicianGenerator c_Magician(&c_Node);
+   int32_t s32_Result;
+
+   // The update has to skip datapools of other types
+   c_OtherDatapool.e_Type = C_OscNodeDataPool::eDIAG;
+   c_OtherDatapool.c_Name = "Other";
+   c_Node.c_DataPools.push_back(c_OtherDatapool);
+
+   mh_InitConfig(c_Node.c_HalcConfig, oe_SafetyMode, oq_NvmBased);
+   s32_Result = c_Magician.GenerateHalcDatapools(c_Generated);
+   c_Node.c_DataPools.insert(c_Node.c_DataPools.end(), c_Generated.begin(), c_Generated.end());
+   c_Node.c_HalcConfig.ResetChangeTracking();
+
+   for (uint32_t u32_Step = 0U; (u32_Step < mhu32_NUM_STEPS) && (q_Return == true); ++u32_Step)
+   {
+      if (s32_Result == C_NO_ERR)
+      {
+         s32_Result = mh_ChangeValues(c_Node.c_HalcConfig, u32_Step);
+      }
+      if (s32_Result == C_NO_ERR)
+      {
+         s32_Result = c_Magician.UpdateHalcDatapools(c_Node.c_DataPools);
+      }
+      if (s32_Result == C_NO_ERR)
+      {
+         s32_Result = c_Magician.GenerateHalcDatapools(c_Generated);
+      }
+
+      if (s32_Result == C_NO_ERR)
+      {
+         q_Return = mh_CompareDatapools(c_Node.c_DataPools, c_Generated);
+      }
+      else
+      {
+         std::cout << "Unexpected error " << s32_Result << std::endl;
+         q_Return = false;
+      }
+
+      if (q_Return == false)
+      {
+         std::cout << "   in step " << u32_Step << " with safety mode " << static_cast<uint32_t>(oe_SafetyMode) <<
+            ((oq_NvmBased == true) ? " (NVM based)" : "") << std::endl;
+      }
+      c_Node.c_HalcConfig.ResetChangeTracking();
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Initialize HALC configuration from a definition with and without channels
+
+   \param[out]  orc_Config     HALC configuration
+   \param[in]   oe_SafetyMode  Safety mode
+   \param[in]   oq_NvmBased    Flag if the configuration is NVM based
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CheckHalcDatapoolUpdate::mh_InitConfig(C_OscHalcConfig & orc_Config,
+                                              const C_OscHalcDefBase::E_SafetyMode oe_SafetyMode,
+                                              const bool oq_NvmBased)
+{
+   orc_Config.c_DeviceName = "CheckDevice";
+   orc_Config.c_FileString = "check definition";
+   orc_Config.u32_ContentVersion = 1U;
+   orc_Config.e_SafetyMode = oe_SafetyMode;
+   orc_Config.u8_NumConfigCopies = 2U;
+   orc_Config.q_NvmBasedConfig = oq_NvmBased;
+   if (oq_NvmBased == true)
+   {
+      orc_Config.c_NvmSafeAddressOffset.push_back(0x1000U);
+      orc_Config.c_NvmSafeAddressOffset.push_back(0x2000U);
+      orc_Config.c_NvmNonSafeAddressOffset.push_back(0x3000U);
+      orc_Config.c_NvmNonSafeAddressOffset.push_back(0x4000U);
+      orc_Config.u32_NvmReservedListSizeParameters = 512U;
+      orc_Config.u32_NvmReservedListSizeInputValues = 128U;
+      orc_Config.u32_NvmReservedListSizeOutputValues = 128U;
+      orc_Config.u32_NvmReservedListSizeStatusValues = 128U;
+   }
+   orc_Config.AddDomain(mh_CreateChannelDomain());
+   orc_Config.AddDomain(mh_CreateDomainWithoutChannels());
+   orc_Config.HandleFileLoadPostProcessing();
+
+   // Mixed safety and use cases
+   if ((oe_SafetyMode == C_OscHalcDefBase::eTWO_LEVELS_WITH_DROPPING) ||
+       (oe_SafetyMode == C_OscHalcDefBase::eTWO_LEVELS_WITHOUT_DROPPING))
+   {
+      orc_Config.SetDomainChannelConfigSafety(0U, 1U, true, true);
+   }
+   orc_Config.SetDomainChannelConfigUseCase(0U, 2U, true, 1U);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create definition of a domain with channels
+
+   Three channels with two use cases; each use case has parameters the other one does not have.
+
+   \return
+   Domain definition
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscHalcDefDomain C_CheckHalcDatapoolUpdate::mh_CreateChannelDomain(void)
+{
+   C_OscHalcDefDomain c_Domain;
+   C_OscHalcDefStruct c_Value;
+   C_OscHalcDefElement c_StructElement;
+   std::vector<uint32_t> c_UseCases;
+   const uint32_t u32_NUM_CHANNELS = 3U;
+
+   c_Domain.c_Id = "INPUTS";
+   c_Domain.c_Name = "Inputs";
+   c_Domain.c_SingularName = "Input";
+   c_Domain.e_Category = C_OscHalcDefDomain::eCA_INPUT;
+
+   for (uint32_t u32_Channel = 0U; u32_Channel < u32_NUM_CHANNELS; ++u32_Channel)
+   {
+      C_OscHalcDefChannelDef c_Channel;
+      c_Channel.c_Name = "IN" + C_SclString::IntToStr(u32_Channel);
+      c_Domain.c_Channels.push_back(c_Channel);
+   }
+   for (uint32_t u32_UseCase = 0U; u32_UseCase < 2U; ++u32_UseCase)
+   {
+      C_OscHalcDefChannelUseCase c_UseCase;
+      c_UseCase.c_Id = "USE_CASE_" + C_SclString::IntToStr(u32_UseCase);
+      c_UseCase.c_Display = c_UseCase.c_Id;
+      c_UseCase.c_Value.SetType(C_OscNodeDataPoolContent::eUINT8);
+      c_UseCase.c_Value.SetValueU8(static_cast<uint8_t>(u32_UseCase + 1U));
+      for (uint32_t u32_Channel = 0U; u32_Channel < u32_NUM_CHANNELS; ++u32_Channel)
+      {
+         C_OscHalcDefChannelAvailability c_Availability;
+         c_Availability.u32_ValueIndex = u32_Channel;
+         c_UseCase.c_Availability.push_back(c_Availability);
+         if (u32_UseCase == 0U)
+         {
+            c_UseCase.c_DefaultChannels.push_back(u32_Channel);
+         }
+      }
+      c_Domain.c_ChannelUseCases.push_back(c_UseCase);
+   }
+
+   // Parameters: first use case only, both use cases, second use case only (struct)
+   c_UseCases.push_back(0U);
+   mh_InitValue(c_Value, "FILTER", C_OscNodeDataPoolContent::eUINT16, c_UseCases);
+   c_Domain.c_ChannelValues.c_Parameters.push_back(c_Value);
+   c_UseCases.push_back(1U);
+   mh_InitValue(c_Value, "THRESHOLD", C_OscNodeDataPoolContent::eSINT32, c_UseCases);
+   c_Domain.c_ChannelValues.c_Parameters.push_back(c_Value);
+   c_UseCases.erase(c_UseCases.begin());
+   mh_InitValue(c_Value, "LIMITS", C_OscNodeDataPoolContent::eUINT8, c_UseCases);
+   mh_InitValue(c_StructElement, "LOW", C_OscNodeDataPoolContent::eUINT8, c_UseCases);
+   c_Value.c_StructElements.push_back(c_StructElement);
+   mh_InitValue(c_StructElement, "HIGH", C_OscNodeDataPoolContent::eUINT8, c_UseCases);
+   c_Value.c_StructElements.push_back(c_StructElement);
+   c_Domain.c_ChannelValues.c_Parameters.push_back(c_Value);
+
+   // Values of all use cases
+   c_UseCases.insert(c_UseCases.begin(), 0U);
+   c_Value.c_StructElements.clear();
+   mh_InitValue(c_Value, "VALUE", C_OscNodeDataPoolContent::eUINT16, c_UseCases);
+   c_Domain.c_ChannelValues.c_InputValues.push_back(c_Value);
+   mh_InitValue(c_Value, "STATE", C_OscNodeDataPoolContent::eUINT8, c_UseCases);
+   c_Domain.c_ChannelValues.c_StatusValues.push_back(c_Value);
+
+   return c_Domain;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create definition of a domain without channels
+
+   \return
+   Domain definition
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscHalcDefDomain C_CheckHalcDatapoolUpdate::mh_CreateDomainWithoutChannels(void)
+{
+   C_OscHalcDefDomain c_Domain;
+   C_OscHalcDefStruct c_Value;
+   const std::vector<uint32_t> c_UseCases;
+
+   c_Domain.c_Id = "SUPPLY";
+   c_Domain.c_Name = "Supply";
+   c_Domain.c_SingularName = "Supply";
+   c_Domain.e_Category = C_OscHalcDefDomain::eCA_OTHER;
+
+   mh_InitValue(c_Value, "VOLTAGE", C_OscNodeDataPoolContent::eUINT16, c_UseCases);
+   c_Domain.c_DomainValues.c_Parameters.push_back(c_Value);
+   mh_InitValue(c_Value, "MODE", C_OscNodeDataPoolContent::eUINT8, c_UseCases);
+   c_Domain.c_DomainValues.c_Parameters.push_back(c_Value);
+   mh_InitValue(c_Value, "FAULT", C_OscNodeDataPoolContent::eUINT8, c_UseCases);
+   c_Domain.c_DomainValues.c_StatusValues.push_back(c_Value);
+
+   return c_Domain;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Initialize definition of a value with range 0 .. 250 and initial value 1
+
+   \param[out]  orc_Value     Value definition
+   \param[in]   orc_Id        ID of the value
+   \param[in]   oe_Type       Type of the value
+   \param[in]   orc_UseCases  Use cases the value is available for
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CheckHalcDatapoolUpdate::mh_InitValue(C_OscHalcDefElement & orc_Value, const C_SclString & orc_Id,
+                                             const C_OscNodeDataPoolContent::E_Type oe_Type,
+                                             const std::vector<uint32_t> & orc_UseCases)
+{
+   orc_Value.c_Id = orc_Id;
+   orc_Value.c_Display = orc_Id;
+   orc_Value.SetType(oe_Type);
+   orc_Value.c_InitialValue = mh_GetContent(oe_Type, 1U);
+   orc_Value.c_MinValue = mh_GetContent(oe_Type, 0U);
+   orc_Value.c_MaxValue = mh_GetContent(oe_Type, 250U);
+   orc_Value.c_UseCaseAvailabilities = orc_UseCases;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get HALC content
+
+   \param[in]  oe_Type    Type of the content
+   \param[in]  ou8_Value  Value
+
+   \return
+   Content with value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscHalcDefContent C_CheckHalcDatapoolUpdate::mh_GetContent(const C_OscNodeDataPoolContent::E_Type oe_Type,
+                                                             const uint8_t ou8_Value)
+{
+   C_OscHalcDefContent c_Content;
+
+   c_Content.SetType(oe_Type);
+   C_OscNodeDataPoolContentUtil::h_SetValueInContent(static_cast<float64_t>(ou8_Value), c_Content);
+   return c_Content;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Change configuration values as the user would do
+
+   \param[in,out]  orc_Config  HALC configuration
+   \param[in]      ou32_Step   Step index
+
+   \return
+   C_NO_ERR    values changed
+   else        error of a change
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_CheckHalcDatapoolUpdate::mh_ChangeValues(C_OscHalcConfig & orc_Config, const uint32_t ou32_Step)
+{
+   int32_t s32_Return = C_NO_ERR;
+
+   switch (ou32_Step)
+   {
+   case 0U:
+      // Plain parameters of a channel and a domain
+      s32_Return = orc_Config.SetDomainChannelParameterConfigElementPlain(
+         0U, 1U, 1U, 0U, true, mh_GetContent(C_OscNodeDataPoolContent::eSINT32, 100U));
+      if (s32_Return == C_NO_ERR)
+      {
+         s32_Return = orc_Config.SetDomainChannelParameterConfigElementPlain(
+            1U, 0U, 0U, 0U, false, mh_GetContent(C_OscNodeDataPoolContent::eUINT16, 12U));
+      }
+      break;
+   case 1U:
+      // Other use case: its parameters get relevant, the ones of the previous use case fall back to initial values
+      s32_Return = orc_Config.SetDomainChannelConfigUseCase(0U, 0U, true, 1U);
+      if (s32_Return == C_NO_ERR)
+      {
+         s32_Return = orc_Config.SetDomainChannelParameterConfigElementPlain(
+            0U, 0U, 2U, 1U, true, mh_GetContent(C_OscNodeDataPoolContent::eUINT8, 200U));
+      }
+      if (s32_Return == C_NO_ERR)
+      {
+         // Parameter not relevant for the use case of the channel
+         s32_Return = orc_Config.SetDomainChannelParameterConfigElementPlain(
+            0U, 2U, 0U, 0U, true, mh_GetContent(C_OscNodeDataPoolContent::eUINT16, 7U));
+      }
+      break;
+   case 2U:
+      // Back to the first use case, channel name and complete domain configuration
+      s32_Return = orc_Config.SetDomainChannelConfigUseCase(0U, 0U, true, 0U);
+      if (s32_Return == C_NO_ERR)
+      {
+         s32_Return = orc_Config.SetDomainChannelConfigName(0U, 1U, true, "Renamed");
+      }
+      if (s32_Return == C_NO_ERR)
+      {
+         const C_OscHalcConfigDomain * const pc_Domain = orc_Config.GetDomainConfigDataConst(1U);
+         if ((pc_Domain != NULL) && (pc_Domain->c_DomainConfig.c_Parameters.size() > 1U))
+         {
+            C_OscHalcConfigDomain c_Domain = *pc_Domain;
+            c_Domain.c_DomainConfig.c_Parameters[1].c_Value = mh_GetContent(C_OscNodeDataPoolContent::eUINT8, 3U);
+            s32_Return = orc_Config.SetDomainConfig(1U, c_Domain);
+         }
+         else
+         {
+            s32_Return = C_CONFIG;
+         }
+      }
+      break;
+   case 3U:
+      // Moved NVM areas (if any) and a parameter of a channel with the second use case
+      for (uint32_t u32_Offset = 0U; u32_Offset < orc_Config.c_NvmSafeAddressOffset.size(); ++u32_Offset)
+      {
+         orc_Config.c_NvmSafeAddressOffset[u32_Offset] += 0x100U;
+      }
+      if (orc_Config.c_NvmNonSafeAddressOffset.size() > 0U)
+      {
+         orc_Config.c_NvmNonSafeAddressOffset[0] += 0x200U;
+      }
+      s32_Return = orc_Config.SetDomainChannelParameterConfigElementPlain(
+         0U, 2U, 1U, 0U, true, mh_GetContent(C_OscNodeDataPoolContent::eSINT32, 42U));
+      break;
+   default:
+      break;
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Compare the HAL Datapools of a node with generated ones
+
+   \param[in]  orc_NodeDatapools  All datapools of the node
+   \param[in]  orc_Generated      Generated HAL Datapools
+
+   \return
+   true     HAL Datapools equal
+   false    at least one difference (details printed to console)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckHalcDatapoolUpdate::mh_CompareDatapools(const std::vector<C_OscNodeDataPool> & orc_NodeDatapools,
+                                                    const std::vector<C_OscNodeDataPool> & orc_Generated)
+{
+   bool q_Return = true;
+   std::vector<const C_OscNodeDataPool *> c_HalcDatapools;
+
+   for (uint32_t u32_Datapool = 0U; u32_Datapool < orc_NodeDatapools.size(); ++u32_Datapool)
+   {
+      const C_OscNodeDataPool & rc_Datapool = orc_NodeDatapools[u32_Datapool];
+      if ((rc_Datapool.e_Type == C_OscNodeDataPool::eHALC) || (rc_Datapool.e_Type == C_OscNodeDataPool::eHALC_NVM))
+      {
+         c_HalcDatapools.push_back(&rc_Datapool);
+      }
+   }
+
+   if (c_HalcDatapools.size() == orc_Generated.size())
+   {
+      for (uint32_t u32_Datapool = 0U; u32_Datapool < c_HalcDatapools.size(); ++u32_Datapool)
+      {
+         q_Return = mh_CompareDatapool(*c_HalcDatapools[u32_Datapool], orc_Generated[u32_Datapool]) && q_Return;
+      }
+   }
+   else
+   {
+      std::cout << "Number of HAL Datapools differs: " << c_HalcDatapools.size() << " updated, " <<
+         orc_Generated.size() << " generated" << std::endl;
+      q_Return = false;
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Compare an updated datapool with a generated one
+
+   Compares all properties covered by the datapool hash and the current and NVM values of the elements.
+
+   \param[in]  orc_Updated    Datapool updated in place
+   \param[in]  orc_Generated  Datapool generated from scratch
+
+   \return
+   true     datapools equal
+   false    at least one difference (details printed to console)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckHalcDatapoolUpdate::mh_CompareDatapool(const C_OscNodeDataPool & orc_Updated,
+                                                   const C_OscNodeDataPool & orc_Generated)
+{
+   bool q_Return = true;
+   uint32_t u32_HashUpdated = 0xFFFFFFFFU;
+   uint32_t u32_HashGenerated = 0xFFFFFFFFU;
+
+   if (orc_Updated.c_Lists.size() == orc_Generated.c_Lists.size())
+   {
+      for (uint32_t u32_List = 0U; u32_List < orc_Updated.c_Lists.size(); ++u32_List)
+      {
+         const C_OscNodeDataPoolList & rc_Updated = orc_Updated.c_Lists[u32_List];
+         const C_OscNodeDataPoolList & rc_Generated = orc_Generated.c_Lists[u32_List];
+
+         if (rc_Updated.c_Elements.size() == rc_Generated.c_Elements.size())
+         {
+            for (uint32_t u32_Element = 0U; u32_Element < rc_Updated.c_Elements.size(); ++u32_Element)
+            {
+               const C_OscNodeDataPoolListElement & rc_ElementUpdated = rc_Updated.c_Elements[u32_Element];
+               const C_OscNodeDataPoolListElement & rc_ElementGenerated = rc_Generated.c_Elements[u32_Element];
+               u32_HashUpdated = 0xFFFFFFFFU;
+               u32_HashGenerated = 0xFFFFFFFFU;
+               rc_ElementUpdated.CalcHash(u32_HashUpdated);
+               rc_ElementGenerated.CalcHash(u32_HashGenerated);
+
+               if ((u32_HashUpdated != u32_HashGenerated) ||
+                   ((rc_ElementUpdated.c_Value == rc_ElementGenerated.c_Value) == false) ||
+                   ((rc_ElementUpdated.c_NvmValue == rc_ElementGenerated.c_NvmValue) == false))
+               {
+                  std::cout << "Element differs: " << orc_Updated.c_Name.c_str() << "::" <<
+                     rc_Updated.c_Name.c_str() << "::" << rc_ElementUpdated.c_Name.c_str() << std::endl;
+                  q_Return = false;
+               }
+            }
+         }
+         else
+         {
+            std::cout << "Number of elements differs: " << orc_Updated.c_Name.c_str() << "::" <<
+               rc_Updated.c_Name.c_str() << std::endl;
+            q_Return = false;
+         }
+      }
+   }
+   else
+   {
+      std::cout << "Number of lists differs: " << orc_Updated.c_Name.c_str() << std::endl;
+      q_Return = false;
+   }
+
+   // Datapool and list properties
+   if (q_Return == true)
+   {
+      u32_HashUpdated = 0xFFFFFFFFU;
+      u32_HashGenerated = 0xFFFFFFFFU;
+      orc_Updated.CalcHash(u32_HashUpdated);
+      orc_Generated.CalcHash(u32_HashGenerated);
+      if (u32_HashUpdated != u32_HashGenerated)
+      {
+         std::cout << "Datapool or list properties differ: " << orc_Updated.c_Name.c_str() << std::endl;
+         q_Return = false;
+      }
+   }
+
+   return q_Return;
+}
@@ -0,0 +1,56 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Check of the in-place update of HAL Datapools (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_CHECKHALCDATAPOOLUPDATE_HPP
+#define C_CHECKHALCDATAPOOLUPDATE_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
+
+#include "stwtypes.hpp"
+#include "C_OscNode.hpp"
+#include "C_OscHalcDefDomain.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_CheckHalcDatapoolUpdate
+{
+public:
+   static bool h_Run(void);
+
+private:
+   static bool mh_CheckConfiguration(const stw::opensyde_core::C_OscHalcDefBase::E_SafetyMode oe_SafetyMode,
+                                     const bool oq_NvmBased);
+   static void mh_InitConfig(stw::opensyde_core::C_OscHalcConfig & orc_Config,
+                             const stw::opensyde_core::C_OscHalcDefBase::E_SafetyMode oe_SafetyMode,
+                             const bool oq_NvmBased);
+   static stw::opensyde_core::C_OscHalcDefDomain mh_CreateChannelDomain(void);
+   static stw::opensyde_core::C_OscHalcDefDomain mh_CreateDomainWithoutChannels(void);
+   static void mh_InitValue(stw::opensyde_core::C_OscHalcDefElement & orc_Value, const stw::scl::C_SclString & orc_Id,
+                            const stw::opensyde_core::C_OscNodeDataPoolContent::E_Type oe_Type,
+                            const std::vector<uint32_t> & orc_UseCases);
+   static stw::opensyde_core::C_OscHalcDefContent mh_GetContent(
+      const stw::opensyde_core::C_OscNodeDataPoolContent::E_Type oe_Type, const uint8_t ou8_Value);
+   static int32_t mh_ChangeValues(stw::opensyde_core::C_OscHalcConfig & orc_Config, const uint32_t ou32_Step);
+   static bool mh_CompareDatapools(const std::vector<stw::opensyde_core::C_OscNodeDataPool> & orc_NodeDatapools,
+                                   const std::vector<stw::opensyde_core::C_OscNodeDataPool> & orc_Generated);
+   static bool mh_CompareDatapool(const stw::opensyde_core::C_OscNodeDataPool & orc_Updated,
+                                  const stw::opensyde_core::C_OscNodeDataPool & orc_Generated);
+
+   static const uint32_t mhu32_NUM_STEPS;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+
+#endif
@@ -0,0 +1,444 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Check and benchmark of the Linux IP dispatcher and the IP transport protocol
+
+   A local fake server on 127.0.0.1 port 13400 talks to C_OscProtocolDriverOsyTpIp via C_OscIpDispatcherLinuxSock:
+   - the server sends a response with a payload far beyond the limit of one service followed by a valid response;
+     the oversize response has to be dropped completely and the valid one has to be received
+   - the server echoes service requests; each response has to be identical to its request
+   - the server sends one block larger than the initial receive buffer of the dispatcher;
+     the dispatcher has to deliver it in one piece
+
+   The time per request/response round trip is printed to the console.
+   It is not checked, as the result depends on the machine.
+
+   If the port cannot be used (e.g. a real openSYDE server runs on this machine) the check is skipped.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <iostream>
+#include <cstring>
+#include <thread>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "stwtypes.hpp"
+#include "stwerrors.hpp"
+#include "TglTime.hpp"
+#include "C_CheckIpLoopback.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::tgl;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint8_t C_CheckIpLoopback::mhu8_CLIENT_BUS = 0U;
+const uint8_t C_CheckIpLoopback::mhu8_CLIENT_NODE = 126U;
+const uint8_t C_CheckIpLoopback::mhu8_SERVER_BUS = 3U;
+const uint8_t C_CheckIpLoopback::mhu8_SERVER_NODE = 17U;
+const uint32_t C_CheckIpLoopback::mhu32_NUM_ROUNDTRIPS = 2000U;
+const uint32_t C_CheckIpLoopback::mhu32_SERVICE_SIZE = 4000U;
+const uint32_t C_CheckIpLoopback::mhu32_OVERSIZE_PAYLOAD_SIZE = 100000U;
+const uint32_t C_CheckIpLoopback::mhu32_LARGE_BLOCK_SIZE = 200000U;
+const uint32_t C_CheckIpLoopback::mhu32_TIMEOUT_MS = 5000U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Run check
+
+   \return
+   true     all data received as sent by the server (or check skipped)
+   false    at least one difference found (details printed to console)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckIpLoopback::h_Run(void)
+{
+   bool q_Return = true;
+   //lint -e{8080,970} //using type to match library interface
+   const int x_ListenSocket = socket(AF_INET, SOCK_STREAM, 0);
+   int x_Enabled = 1; //lint !e8080 !e970 //using type to match library interface
+   sockaddr_in t_Address;
+
+   (void)memset(&t_Address, 0, sizeof(t_Address));
+   t_Address.sin_family = AF_INET;
+   t_Address.sin_port = htons(13400U);
+   t_Address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+   (void)setsockopt(x_ListenSocket, SOL_SOCKET, SO_REUSEADDR, &x_Enabled, sizeof(x_Enabled));
+   //lint -e{929,740}  Side-effect of the POSIX-style API. Match is guaranteed by the API.
+   if ((x_ListenSocket < 0) ||
+       (bind(x_ListenSocket, reinterpret_cast<sockaddr *>(&t_Address), sizeof(t_Address)) != 0) ||
+       (listen(x_ListenSocket, 1) != 0))
+   {
+      std::cout << "Local TCP port 13400 not available. Check skipped." << std::endl;
+   }
+   else
+   {
+      bool q_ServerSuccess = false;
+      std::thread c_Server(&C_CheckIpLoopback::mh_RunServer, x_ListenSocket, std::ref(q_ServerSuccess));
+      C_OscIpDispatcherLinuxSock c_Dispatcher;
+      C_OscProtocolDriverOsyTpIp c_TpIp;
+      const uint8_t au8_LOOPBACK[4] = { 127U, 0U, 0U, 1U };
+      uint32_t u32_Handle;
+
+      (void)c_Dispatcher.InitTcp(au8_LOOPBACK, u32_Handle);
+      (void)c_TpIp.SetDispatcher(&c_Dispatcher, u32_Handle);
+      (void)c_TpIp.SetNodeIdentifiers(C_OscProtocolDriverOsyNode(mhu8_CLIENT_BUS, mhu8_CLIENT_NODE),
+                                      C_OscProtocolDriverOsyNode(mhu8_SERVER_BUS, mhu8_SERVER_NODE));
+      if (c_TpIp.ReConnect() != C_NO_ERR)
+      {
+         std::cout << "Could not connect to local fake server." << std::endl;
+         q_Return = false;
+      }
+      else
+      {
+         q_Return = mh_CheckUnexpectedResponse(c_TpIp);
+         if (q_Return == true)
+         {
+            q_Return = mh_RunBenchmark(c_TpIp);
+         }
+         if (q_Return == true)
+         {
+            q_Return = mh_CheckLargeBlock(c_Dispatcher, u32_Handle);
+         }
+      }
+      //closing the connection ends the server; shutting down the listening socket ends a pending accept()
+      (void)c_TpIp.Disconnect();
+      (void)shutdown(x_ListenSocket, SHUT_RDWR);
+      c_Server.join();
+      if (q_ServerSuccess == false)
+      {
+         std::cout << "Local fake server reported a problem." << std::endl;
+         q_Return = false;
+      }
+   }
+   if (x_ListenSocket >= 0)
+   {
+      (void)close(x_ListenSocket);
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Fake openSYDE server
+
+   Accepts one connection and plays the server part of the sequence described in the file header.
+   Runs until the client closes the connection.
+
+   \param[in]   os32_ListenSocket   socket listening on the server port
+   \param[out]  orq_Success         true: sequence finished; false: problem on server side
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CheckIpLoopback::mh_RunServer(const int32_t os32_ListenSocket, bool & orq_Success)
+{
+   const int32_t s32_Socket = accept(os32_ListenSocket, NULL, NULL);
+
+   orq_Success = false;
+   if (s32_Socket >= 0)
+   {
+      std::vector<uint8_t> c_Service;
+      std::vector<uint8_t> c_Frame;
+      bool q_Ok;
+
+      //oversize response followed by a valid one:
+      c_Service.assign(mhu32_OVERSIZE_PAYLOAD_SIZE - 4U, 0xAAU);
+      mh_ComposeResponse(c_Service, c_Frame);
+      q_Ok = mh_SendAll(s32_Socket, c_Frame);
+      c_Service.assign(3U, 0x62U);
+      mh_ComposeResponse(c_Service, c_Frame);
+      q_Ok = q_Ok && mh_SendAll(s32_Socket, c_Frame);
+
+      //echo requests:
+      for (uint32_t u32_Roundtrip = 0U; (u32_Roundtrip < mhu32_NUM_ROUNDTRIPS) && (q_Ok == true); ++u32_Roundtrip)
+      {
+         std::vector<uint8_t> c_Header(12U);
+         q_Ok = mh_ReceiveAll(s32_Socket, c_Header);
+         if (q_Ok == true)
+         {
+            const uint32_t u32_PayloadSize = (static_cast<uint32_t>(c_Header[4]) << 24U) +
+                                             (static_cast<uint32_t>(c_Header[5]) << 16U) +
+                                             (static_cast<uint32_t>(c_Header[6]) << 8U) +
+                                             static_cast<uint32_t>(c_Header[7]);
+            c_Service.resize(u32_PayloadSize - 4U);
+            q_Ok = mh_ReceiveAll(s32_Socket, c_Service);
+         }
+         if (q_Ok == true)
+         {
+            mh_ComposeResponse(c_Service, c_Frame);
+            q_Ok = mh_SendAll(s32_Socket, c_Frame);
+         }
+      }
+
+      //block larger than the initial receive buffer; requested by the client with one byte so the transport
+      //protocol does not take it for responses:
+      c_Frame.resize(1U);
+      q_Ok = q_Ok && mh_ReceiveAll(s32_Socket, c_Frame);
+      c_Frame.resize(mhu32_LARGE_BLOCK_SIZE);
+      for (uint32_t u32_Byte = 0U; u32_Byte < mhu32_LARGE_BLOCK_SIZE; ++u32_Byte)
+      {
+         c_Frame[u32_Byte] = static_cast<uint8_t>(u32_Byte % 251U);
+      }
+      q_Ok = q_Ok && mh_SendAll(s32_Socket, c_Frame);
+
+      //wait for client to close
+      if (q_Ok == true)
+      {
+         uint8_t u8_Byte;
+         q_Ok = (recv(s32_Socket, &u8_Byte, 1U, 0) == 0);
+      }
+      orq_Success = q_Ok;
+      (void)close(s32_Socket);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check that an oversize response is dropped without losing the following response
+
+   \param[in,out]  orc_TpIp   connected transport protocol
+
+   \return
+   true     only the valid response received
+   false    problem found (details printed to console)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckIpLoopback::mh_CheckUnexpectedResponse(C_OscProtocolDriverOsyTpIp & orc_TpIp)
+{
+   bool q_Return;
+   C_OscProtocolDriverOsyService c_Response;
+
+   q_Return = mh_WaitForResponse(orc_TpIp, c_Response);
+   if ((q_Return == false) || (c_Response.c_Data != std::vector<uint8_t>(3U, 0x62U)))
+   {
+      std::cout << "Response after oversize response not received correctly." << std::endl;
+      q_Return = false;
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Measure request/response round trips via the fake server
+
+   \param[in,out]  orc_TpIp   connected transport protocol
+
+   \return
+   true     all responses identical to their requests
+   false    problem found (details printed to console)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckIpLoopback::mh_RunBenchmark(C_OscProtocolDriverOsyTpIp & orc_TpIp)
+{
+   bool q_Return = true;
+   C_OscProtocolDriverOsyService c_Request;
+   C_OscProtocolDriverOsyService c_Response;
+   uint64_t u64_Start;
+   uint64_t u64_Duration;
+
+   c_Request.c_Data.resize(mhu32_SERVICE_SIZE);
+   u64_Start = TglGetTickCountUs();
+   for (uint32_t u32_Roundtrip = 0U; (u32_Roundtrip < mhu32_NUM_ROUNDTRIPS) && (q_Return == true); ++u32_Roundtrip)
+   {
+      for (uint32_t u32_Byte = 0U; u32_Byte < mhu32_SERVICE_SIZE; ++u32_Byte)
+      {
+         c_Request.c_Data[u32_Byte] = static_cast<uint8_t>(u32_Roundtrip + u32_Byte);
+      }
+      q_Return = (orc_TpIp.SendRequest(c_Request) == C_NO_ERR);
+      q_Return = q_Return && mh_WaitForResponse(orc_TpIp, c_Response);
+      if ((q_Return == false) || (c_Response.c_Data != c_Request.c_Data))
+      {
+         std::cout << "Echo response " << u32_Roundtrip << " not received correctly." << std::endl;
+         q_Return = false;
+      }
+   }
+   u64_Duration = TglGetTickCountUs() - u64_Start;
+
+   if (q_Return == true)
+   {
+      std::cout << "Round trip with " << mhu32_SERVICE_SIZE << " bytes per service: " <<
+         (static_cast<float64_t>(u64_Duration) / static_cast<float64_t>(mhu32_NUM_ROUNDTRIPS)) << " us" <<
+         std::endl;
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check reception of one block larger than the initial receive buffer of the dispatcher
+
+   \param[in,out]  orc_Dispatcher   connected dispatcher
+   \param[in]      ou32_Handle      handle of connection
+
+   \return
+   true     block received as sent
+   false    problem found (details printed to console)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckIpLoopback::mh_CheckLargeBlock(C_OscIpDispatcherLinuxSock & orc_Dispatcher, const uint32_t ou32_Handle)
+{
+   bool q_Return = true;
+   std::vector<uint8_t> c_Block(mhu32_LARGE_BLOCK_SIZE);
+   const uint32_t u32_Start = TglGetTickCount();
+   int32_t s32_Result;
+
+   //request block
+   s32_Result = orc_Dispatcher.SendTcp(ou32_Handle, std::vector<uint8_t>(1U, 0U));
+   if (s32_Result == C_NO_ERR)
+   {
+      s32_Result = C_NOACT;
+   }
+   while ((s32_Result == C_NOACT) && ((TglGetTickCount() - u32_Start) < mhu32_TIMEOUT_MS))
+   {
+      s32_Result = orc_Dispatcher.ReadTcp(ou32_Handle, c_Block);
+   }
+   if (s32_Result != C_NO_ERR)
+   {
+      std::cout << "Large block not received. Result: " << s32_Result << std::endl;
+      q_Return = false;
+   }
+   else
+   {
+      for (uint32_t u32_Byte = 0U; (u32_Byte < mhu32_LARGE_BLOCK_SIZE) && (q_Return == true); ++u32_Byte)
+      {
+         if (c_Block[u32_Byte] != static_cast<uint8_t>(u32_Byte % 251U))
+         {
+            std::cout << "Large block differs at byte " << u32_Byte << std::endl;
+            q_Return = false;
+         }
+      }
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Cycle transport protocol until one response is available
+
+   \param[in,out]  orc_TpIp       connected transport protocol
+   \param[out]     orc_Response   received response
+
+   \return
+   true     response received
+   false    timeout
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckIpLoopback::mh_WaitForResponse(C_OscProtocolDriverOsyTpIp & orc_TpIp,
+                                           C_OscProtocolDriverOsyService & orc_Response)
+{
+   const uint32_t u32_Start = TglGetTickCount();
+   bool q_Received = false;
+
+   while ((q_Received == false) && ((TglGetTickCount() - u32_Start) < mhu32_TIMEOUT_MS))
+   {
+      (void)orc_TpIp.Cycle();
+      q_Received = (orc_TpIp.ReadResponse(orc_Response) == C_NO_ERR);
+   }
+   return q_Received;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Compose response frame of fake server
+
+   \param[in]   orc_Service   service data
+   \param[out]  orc_Frame     DoIp header, source and target address and service data
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CheckIpLoopback::mh_ComposeResponse(const std::vector<uint8_t> & orc_Service, std::vector<uint8_t> & orc_Frame)
+{
+   const uint32_t u32_PayloadSize = static_cast<uint32_t>(orc_Service.size()) + 4U;
+   const uint16_t u16_SourceAddress = static_cast<uint16_t>((static_cast<uint16_t>(mhu8_SERVER_BUS) << 7U) +
+                                                            mhu8_SERVER_NODE + 1U);
+   const uint16_t u16_TargetAddress = static_cast<uint16_t>((static_cast<uint16_t>(mhu8_CLIENT_BUS) << 7U) +
+                                                            mhu8_CLIENT_NODE + 1U);
+
+   orc_Frame.resize(12U);
+   orc_Frame[0] = 0x02U;
+   orc_Frame[1] = 0xFDU;
+   orc_Frame[2] = 0x80U; //diagnostic message
+   orc_Frame[3] = 0x01U;
+   orc_Frame[4] = static_cast<uint8_t>(u32_PayloadSize >> 24U);
+   orc_Frame[5] = static_cast<uint8_t>(u32_PayloadSize >> 16U);
+   orc_Frame[6] = static_cast<uint8_t>(u32_PayloadSize >> 8U);
+   orc_Frame[7] = static_cast<uint8_t>(u32_PayloadSize);
+   orc_Frame[8] = static_cast<uint8_t>(u16_SourceAddress >> 8U);
+   orc_Frame[9] = static_cast<uint8_t>(u16_SourceAddress);
+   orc_Frame[10] = static_cast<uint8_t>(u16_TargetAddress >> 8U);
+   orc_Frame[11] = static_cast<uint8_t>(u16_TargetAddress);
+   orc_Frame.insert(orc_Frame.end(), orc_Service.begin(), orc_Service.end());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Send all data on blocking socket
+
+   \param[in]  os32_Socket   socket
+   \param[in]  orc_Data      data to send
+
+   \return
+   true     all data sent
+   false    connection problem
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckIpLoopback::mh_SendAll(const int32_t os32_Socket, const std::vector<uint8_t> & orc_Data)
+{
+   uint32_t u32_Sent = 0U;
+   bool q_Ok = true;
+
+   while ((u32_Sent < orc_Data.size()) && (q_Ok == true))
+   {
+      const ssize_t x_Result = send(os32_Socket, &orc_Data[u32_Sent], orc_Data.size() - u32_Sent, MSG_NOSIGNAL);
+      if (x_Result > 0)
+      {
+         u32_Sent += static_cast<uint32_t>(x_Result);
+      }
+      else
+      {
+         q_Ok = false;
+      }
+   }
+   return q_Ok;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Receive the requested number of bytes from blocking socket
+
+   \param[in]      os32_Socket   socket
+   \param[in,out]  orc_Data      in: size defines number of bytes to receive; out: received data
+
+   \return
+   true     all data received
+   false    connection problem
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckIpLoopback::mh_ReceiveAll(const int32_t os32_Socket, std::vector<uint8_t> & orc_Data)
+{
+   uint32_t u32_Received = 0U;
+   bool q_Ok = true;
+
+   while ((u32_Received < orc_Data.size()) && (q_Ok == true))
+   {
+      const ssize_t x_Result = recv(os32_Socket, &orc_Data[u32_Received], orc_Data.size() - u32_Received, 0);
+      if (x_Result > 0)
+      {
+         u32_Received += static_cast<uint32_t>(x_Result);
+      }
+      else
+      {
+         q_Ok = false;
+      }
+   }
+   return q_Ok;
+}
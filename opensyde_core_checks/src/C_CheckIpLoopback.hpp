@@ -0,0 +1,57 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Check and benchmark of the Linux IP dispatcher and the IP transport protocol (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_CHECKIPLOOPBACK_HPP
+#define C_CHECKIPLOOPBACK_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
+
+#include "stwtypes.hpp"
+#include "C_OscIpDispatcherLinuxSock.hpp"
+#include "C_OscProtocolDriverOsyTpIp.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_CheckIpLoopback
+{
+public:
+   static bool h_Run(void);
+
+private:
+   static void mh_RunServer(const int32_t os32_ListenSocket, bool & orq_Success);
+   static bool mh_CheckUnexpectedResponse(stw::opensyde_core::C_OscProtocolDriverOsyTpIp & orc_TpIp);
+   static bool mh_RunBenchmark(stw::opensyde_core::C_OscProtocolDriverOsyTpIp & orc_TpIp);
+   static bool mh_CheckLargeBlock(stw::opensyde_core::C_OscIpDispatcherLinuxSock & orc_Dispatcher,
+                                  const uint32_t ou32_Handle);
+   static bool mh_WaitForResponse(stw::opensyde_core::C_OscProtocolDriverOsyTpIp & orc_TpIp,
+                                  stw::opensyde_core::C_OscProtocolDriverOsyService & orc_Response);
+   static void mh_ComposeResponse(const std::vector<uint8_t> & orc_Service, std::vector<uint8_t> & orc_Frame);
+   static bool mh_SendAll(const int32_t os32_Socket, const std::vector<uint8_t> & orc_Data);
+   static bool mh_ReceiveAll(const int32_t os32_Socket, std::vector<uint8_t> & orc_Data);
+
+   static const uint8_t mhu8_CLIENT_BUS;
+   static const uint8_t mhu8_CLIENT_NODE;
+   static const uint8_t mhu8_SERVER_BUS;
+   static const uint8_t mhu8_SERVER_NODE;
+   static const uint32_t mhu32_NUM_ROUNDTRIPS;
+   static const uint32_t mhu32_SERVICE_SIZE;
+   static const uint32_t mhu32_OVERSIZE_PAYLOAD_SIZE;
+   static const uint32_t mhu32_LARGE_BLOCK_SIZE;
+   static const uint32_t mhu32_TIMEOUT_MS;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+
+#endif
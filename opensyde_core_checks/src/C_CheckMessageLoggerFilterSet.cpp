@@ -0,0 +1,275 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Check of the compiled message logger filter set
+
+   C_OscComMessageLoggerFilterSet merges the configured filters into sorted ranges. The result of a message check
+   must not depend on the order of the configured filters and must match checking each filter one by one:
+   - a message matching a block filter is blocked
+   - if at least one pass filter is configured, a message needs to match a pass filter
+   - a filter only matches messages of exactly its ID type
+
+   The filter configurations are generated pseudo randomly with a fixed seed, so each run checks the same cases.
+   IDs at the limits of the ID ranges and of the filters are checked in particular.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <iostream>
+#include <algorithm>
+
+#include "stwtypes.hpp"
+#include "C_CheckMessageLoggerFilterSet.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::can;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint32_t C_CheckMessageLoggerFilterSet::mhau32_INTERESTING_IDS[] =
+{
+   0U, 1U, 2U, 0x7FEU, 0x7FFU, 0x800U, 0x1FFFFFFEU, 0x1FFFFFFFU, 0x20000000U, 0xFFFFFFFEU, 0xFFFFFFFFU
+};
+const uint32_t C_CheckMessageLoggerFilterSet::mhu32_NUM_INTERESTING_IDS =
+   static_cast<uint32_t>(sizeof(mhau32_INTERESTING_IDS) / sizeof(mhau32_INTERESTING_IDS[0]));
+
+static const uint32_t mu32_NUM_RANDOM_CONFIGURATIONS = 2000U;
+static const uint32_t mu32_MAX_RANDOM_FILTERS = 6U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Run check
+
+   \return
+   true     all filter configurations checked successfully
+   false    at least one message check result differs (details printed to console)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckMessageLoggerFilterSet::h_Run(void)
+{
+   bool q_Return = true;
+   uint32_t u32_State = 0x12345678U;
+   std::vector<C_OscComMessageLoggerFilter> c_Filters;
+   C_OscComMessageLoggerFilter c_Filter;
+
+   // Ranges starting at ID 0 and ending at the highest ID next to a gap
+   c_Filter.q_PassFilter = true;
+   c_Filter.u8_ExtendedId = 1U;
+   c_Filter.u32_StartId = 7U;
+   c_Filter.u32_EndId = 9U;
+   c_Filters.push_back(c_Filter);
+   c_Filter.u32_StartId = 0U;
+   c_Filter.u32_EndId = 5U;
+   c_Filters.push_back(c_Filter);
+   c_Filter.u32_StartId = 0xFFFFFFF0U;
+   c_Filter.u32_EndId = 0xFFFFFFFFU;
+   c_Filters.push_back(c_Filter);
+   c_Filter.u32_StartId = 0U;
+   c_Filter.u32_EndId = 0U;
+   c_Filters.push_back(c_Filter);
+   q_Return = mh_CheckFilters(c_Filters) && q_Return;
+
+   // Block filter and filter of another ID type
+   c_Filter.q_PassFilter = false;
+   c_Filter.u8_ExtendedId = 0U;
+   c_Filters.push_back(c_Filter);
+   c_Filter.q_PassFilter = true;
+   c_Filter.u8_ExtendedId = 2U;
+   c_Filter.u32_EndId = 0x7FFU;
+   c_Filters.push_back(c_Filter);
+   q_Return = mh_CheckFilters(c_Filters) && q_Return;
+
+   for (uint32_t u32_Configuration = 0U; u32_Configuration < mu32_NUM_RANDOM_CONFIGURATIONS; ++u32_Configuration)
+   {
+      const uint32_t u32_NumFilters = (mh_GetRandom(u32_State) % mu32_MAX_RANDOM_FILTERS) + 1U;
+
+      c_Filters.clear();
+      for (uint32_t u32_Filter = 0U; u32_Filter < u32_NumFilters; ++u32_Filter)
+      {
+         const uint32_t u32_IdType = mh_GetRandom(u32_State) % 16U;
+         // Mostly 11bit and 29bit filters, some of another ID type
+         c_Filter.u8_ExtendedId = static_cast<uint8_t>((u32_IdType < 15U) ? (u32_IdType % 2U) : 2U);
+         c_Filter.q_PassFilter = ((mh_GetRandom(u32_State) % 2U) == 0U);
+         c_Filter.u32_StartId = mh_GetRandomId(u32_State);
+         c_Filter.u32_EndId = mh_GetRandomId(u32_State);
+         // Mostly valid ranges, some empty ones
+         if (((mh_GetRandom(u32_State) % 8U) != 0U) && (c_Filter.u32_StartId > c_Filter.u32_EndId))
+         {
+            std::swap(c_Filter.u32_StartId, c_Filter.u32_EndId);
+         }
+         c_Filters.push_back(c_Filter);
+      }
+      q_Return = mh_CheckFilters(c_Filters) && q_Return;
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check one filter configuration in different orders
+
+   The filters are compiled in the given order, in reversed order and in all rotated orders.
+
+   \param[in]  orc_Filters    Filter configuration
+
+   \return
+   true     all message checks as expected
+   false    at least one message check result differs
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckMessageLoggerFilterSet::mh_CheckFilters(const std::vector<C_OscComMessageLoggerFilter> & orc_Filters)
+{
+   bool q_Return = true;
+   std::vector<uint32_t> c_Ids(&mhau32_INTERESTING_IDS[0], &mhau32_INTERESTING_IDS[mhu32_NUM_INTERESTING_IDS]);
+   std::vector<std::vector<C_OscComMessageLoggerFilter> > c_Orders;
+   std::vector<C_OscComMessageLoggerFilter> c_Order = orc_Filters;
+
+   for (uint32_t u32_Filter = 0U; u32_Filter < orc_Filters.size(); ++u32_Filter)
+   {
+      // Limits of the filters and their neighbors (wrap around intended)
+      const C_OscComMessageLoggerFilter & rc_Filter = orc_Filters[u32_Filter];
+      c_Ids.push_back(rc_Filter.u32_StartId - 1U);
+      c_Ids.push_back(rc_Filter.u32_StartId);
+      c_Ids.push_back(rc_Filter.u32_EndId);
+      c_Ids.push_back(rc_Filter.u32_EndId + 1U);
+
+      c_Orders.push_back(c_Order);
+      std::rotate(c_Order.begin(), c_Order.begin() + 1, c_Order.end());
+   }
+   std::reverse(c_Order.begin(), c_Order.end());
+   c_Orders.push_back(c_Order);
+
+   for (uint32_t u32_Order = 0U; (u32_Order < c_Orders.size()) && (q_Return == true); ++u32_Order)
+   {
+      C_OscComMessageLoggerFilterSet c_FilterSet;
+
+      c_FilterSet.Compile(c_Orders[u32_Order]);
+
+      for (uint32_t u32_Id = 0U; (u32_Id < c_Ids.size()) && (q_Return == true); ++u32_Id)
+      {
+         for (uint8_t u8_IdType = 0U; u8_IdType <= 2U; ++u8_IdType)
+         {
+            T_STWCAN_Msg_RX c_Msg;
+            c_Msg.u32_ID = c_Ids[u32_Id];
+            c_Msg.u8_XTD = u8_IdType;
+            c_Msg.u8_DLC = 0U;
+            c_Msg.u8_RTR = 0U;
+
+            if (c_FilterSet.CheckMessage(c_Msg) != mh_GetExpectedResult(orc_Filters, c_Msg))
+            {
+               std::cout << "Unexpected result for ID 0x" << std::hex << c_Msg.u32_ID << std::dec <<
+                  " (ID type " << static_cast<uint32_t>(u8_IdType) << ") with filter order " << u32_Order <<
+                  ":" << std::endl;
+               for (uint32_t u32_Filter = 0U; u32_Filter < c_Orders[u32_Order].size(); ++u32_Filter)
+               {
+                  const C_OscComMessageLoggerFilter & rc_Filter = c_Orders[u32_Order][u32_Filter];
+                  std::cout << "   " << ((rc_Filter.q_PassFilter == true) ? "pass" : "block") << " type " <<
+                     static_cast<uint32_t>(rc_Filter.u8_ExtendedId) << " 0x" << std::hex << rc_Filter.u32_StartId <<
+                     "..0x" << rc_Filter.u32_EndId << std::dec << std::endl;
+               }
+               q_Return = false;
+            }
+         }
+      }
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check a message against each filter one by one
+
+   \param[in]  orc_Filters    Filter configuration
+   \param[in]  orc_Msg        CAN message
+
+   \return
+   true     message passes
+   false    message is blocked
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckMessageLoggerFilterSet::mh_GetExpectedResult(const std::vector<C_OscComMessageLoggerFilter> & orc_Filters,
+                                                         const T_STWCAN_Msg_RX & orc_Msg)
+{
+   bool q_PassFilterAvailable = false;
+   bool q_Blocked = false;
+   bool q_Passed = false;
+
+   for (uint32_t u32_Filter = 0U; u32_Filter < orc_Filters.size(); ++u32_Filter)
+   {
+      const C_OscComMessageLoggerFilter & rc_Filter = orc_Filters[u32_Filter];
+      const bool q_Match = (rc_Filter.u8_ExtendedId == orc_Msg.u8_XTD) &&
+                           (orc_Msg.u32_ID >= rc_Filter.u32_StartId) && (orc_Msg.u32_ID <= rc_Filter.u32_EndId);
+
+      if (rc_Filter.q_PassFilter == true)
+      {
+         q_PassFilterAvailable = true;
+         q_Passed = q_Passed || q_Match;
+      }
+      else
+      {
+         q_Blocked = q_Blocked || q_Match;
+      }
+   }
+
+   return (q_Blocked == false) && ((q_PassFilterAvailable == false) || (q_Passed == true));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get next pseudo random number
+
+   \param[in,out]  oru32_State   Generator state
+
+   \return
+   pseudo random number
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_CheckMessageLoggerFilterSet::mh_GetRandom(uint32_t & oru32_State)
+{
+   // xorshift32
+   oru32_State ^= oru32_State << 13U;
+   oru32_State ^= oru32_State >> 17U;
+   oru32_State ^= oru32_State << 5U;
+   return oru32_State;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get pseudo random ID
+
+   IDs are taken from a small range or next to the interesting IDs, so the filters overlap or are adjacent often.
+
+   \param[in,out]  oru32_State   Generator state
+
+   \return
+   pseudo random ID
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_CheckMessageLoggerFilterSet::mh_GetRandomId(uint32_t & oru32_State)
+{
+   uint32_t u32_Return;
+
+   if ((mh_GetRandom(oru32_State) % 2U) == 0U)
+   {
+      u32_Return = mh_GetRandom(oru32_State) % 32U;
+   }
+   else
+   {
+      // Interesting ID with an offset of -2 .. 2 (wrap around intended)
+      u32_Return = mhau32_INTERESTING_IDS[mh_GetRandom(oru32_State) % mhu32_NUM_INTERESTING_IDS];
+      u32_Return += (mh_GetRandom(oru32_State) % 5U) - 2U;
+   }
+
+   return u32_Return;
+}
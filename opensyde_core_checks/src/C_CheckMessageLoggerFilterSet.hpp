@@ -0,0 +1,44 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Check of the compiled message logger filter set (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_CHECKMESSAGELOGGERFILTERSET_HPP
+#define C_CHECKMESSAGELOGGERFILTERSET_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
+
+#include "stwtypes.hpp"
+#include "C_OscComMessageLoggerFilterSet.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_CheckMessageLoggerFilterSet
+{
+public:
+   static bool h_Run(void);
+
+private:
+   static bool mh_CheckFilters(const std::vector<stw::opensyde_core::C_OscComMessageLoggerFilter> & orc_Filters);
+   static bool mh_GetExpectedResult(const std::vector<stw::opensyde_core::C_OscComMessageLoggerFilter> & orc_Filters,
+                                    const stw::can::T_STWCAN_Msg_RX & orc_Msg);
+   static uint32_t mh_GetRandom(uint32_t & oru32_State);
+   static uint32_t mh_GetRandomId(uint32_t & oru32_State);
+
+   static const uint32_t mhau32_INTERESTING_IDS[];
+   static const uint32_t mhu32_NUM_INTERESTING_IDS;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+
+#endif
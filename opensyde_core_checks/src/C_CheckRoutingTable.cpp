@@ -0,0 +1,354 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Check of the routing table against the per node routing calculation
+
+   C_OscRoutingTable calculates the routes to all nodes in one pass and remembers the results of the last
+   system configurations. The results have to be identical to one C_OscRoutingCalculation per target node:
+   - pseudo random meshed topologies (CAN and Ethernet buses, nodes with several interfaces, mixed flashloader types,
+     routing/update/diagnosis flags, inactive nodes) are checked in all three routing modes
+   - one topology is changed step by step and changed back; results taken from the cache have to match a fresh
+     per node calculation of the current configuration
+
+   The topologies are generated pseudo randomly with a fixed seed, so each run checks the same cases.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <iostream>
+
+#include "stwtypes.hpp"
+#include "stwerrors.hpp"
+#include "TglTime.hpp"
+#include "C_OscRoutingTable.hpp"
+#include "C_CheckRoutingTable.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::tgl;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint32_t C_CheckRoutingTable::mhu32_NUM_TOPOLOGIES = 1000U;
+const uint32_t C_CheckRoutingTable::mhu32_MAX_BUSES = 6U;
+const uint32_t C_CheckRoutingTable::mhu32_MAX_NODES = 20U;
+const uint32_t C_CheckRoutingTable::mhu32_MAX_INTERFACES = 3U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Run check
+
+   \return
+   true     routing table gives the same results as the per node calculation
+   false    at least one difference found (details printed to console)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckRoutingTable::h_Run(void)
+{
+   std::vector<C_OscDeviceDefinition> c_Devices;
+   bool q_Return;
+
+   mh_CreateDevices(c_Devices);
+   C_OscRoutingTable::h_ClearCache();
+   q_Return = mh_CheckRandomTopologies(c_Devices);
+   q_Return = mh_CheckCache(c_Devices) && q_Return;
+   C_OscRoutingTable::h_ClearCache();
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Compare results for pseudo random topologies in all modes
+
+   \param[in]  orc_Devices   Device definitions used by the nodes
+
+   \return
+   true     all results identical
+   false    at least one difference found (details printed to console)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckRoutingTable::mh_CheckRandomTopologies(const std::vector<C_OscDeviceDefinition> & orc_Devices)
+{
+   static const C_OscRoutingCalculation::E_Mode hae_MODES[] =
+   {
+      C_OscRoutingCalculation::eUPDATE, C_OscRoutingCalculation::eDIAGNOSTIC, C_OscRoutingCalculation::eROUTING_CHECK
+   };
+   bool q_Return = true;
+   uint32_t u32_State = 0x5EED2024U;
+   uint32_t u32_NumRouted = 0U;
+   uint32_t u32_NumTargets = 0U;
+
+   for (uint32_t u32_Topology = 0U; u32_Topology < mhu32_NUM_TOPOLOGIES; ++u32_Topology)
+   {
+      C_Topology c_Topology;
+
+      mh_CreateRandomTopology(u32_State, orc_Devices, c_Topology);
+      for (uint32_t u32_Mode = 0U; u32_Mode < (sizeof(hae_MODES) / sizeof(hae_MODES[0])); ++u32_Mode)
+      {
+         std::vector<C_OscRoutingTable::C_TargetRoute> c_Routes;
+         q_Return = mh_CompareWithPerNodeCalculation(c_Topology, hae_MODES[u32_Mode], u32_Topology) && q_Return;
+
+         //statistics (from cache)
+         C_OscRoutingTable::h_GetBestRoutes(c_Topology.c_Nodes, c_Topology.c_ActiveNodes,
+                                            c_Topology.u32_StartBusIndex, hae_MODES[u32_Mode], c_Routes);
+         for (uint32_t u32_Node = 0U; u32_Node < c_Routes.size(); ++u32_Node)
+         {
+            if (c_Routes[u32_Node].s32_State == C_NO_ERR)
+            {
+               ++u32_NumTargets;
+               if (c_Routes[u32_Node].c_Route.c_VecRoutePoints.size() > 0U)
+               {
+                  ++u32_NumRouted;
+               }
+            }
+         }
+      }
+   }
+   std::cout << "Reachable targets: " << u32_NumTargets << ", thereof via routing: " << u32_NumRouted << std::endl;
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check results taken from the cache
+
+   One topology is changed in several steps (more steps than cache entries) and then changed back step by step.
+   Each configuration is requested twice, so the second request is answered from the cache.
+   Going back the earlier configurations are found in the cache again as long as they were not dropped.
+
+   \param[in]  orc_Devices   Device definitions used by the nodes
+
+   \return
+   true     all results identical
+   false    at least one difference found (details printed to console)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckRoutingTable::mh_CheckCache(const std::vector<C_OscDeviceDefinition> & orc_Devices)
+{
+   bool q_Return = true;
+   uint32_t u32_State = 0xCAC4E001U;
+   C_Topology c_Topology;
+   std::vector<C_Topology> c_Steps;
+   uint64_t u64_TimeCalculation = 0U;
+   uint64_t u64_TimeCache = 0U;
+
+   mh_CreateRandomTopology(u32_State, orc_Devices, c_Topology);
+   c_Steps.push_back(c_Topology);
+   for (uint32_t u32_Step = 0U; u32_Step < (C_OscRoutingTable::hu32_MAX_CACHE_ENTRIES + 4U); ++u32_Step)
+   {
+      //change one routing relevant setting: flag of one interface, active flag or start bus
+      C_OscNode & rc_Node = c_Topology.c_Nodes[mh_GetRandom(u32_State) % c_Topology.c_Nodes.size()];
+      C_OscNodeComInterfaceSettings & rc_Itf =
+         rc_Node.c_Properties.c_ComInterfaces[mh_GetRandom(u32_State) % rc_Node.c_Properties.c_ComInterfaces.size()];
+      switch (u32_Step % 4U)
+      {
+      case 0U:
+         rc_Itf.q_IsRoutingEnabled = !rc_Itf.q_IsRoutingEnabled;
+         break;
+      case 1U:
+         rc_Itf.q_IsUpdateEnabled = !rc_Itf.q_IsUpdateEnabled;
+         rc_Itf.q_IsDiagnosisEnabled = !rc_Itf.q_IsDiagnosisEnabled;
+         break;
+      case 2U:
+         c_Topology.c_ActiveNodes[mh_GetRandom(u32_State) % c_Topology.c_ActiveNodes.size()] ^= 1U;
+         break;
+      default:
+         c_Topology.u32_StartBusIndex = (c_Topology.u32_StartBusIndex + 1U) % mhu32_MAX_BUSES;
+         break;
+      }
+      c_Steps.push_back(c_Topology);
+   }
+
+   //forward and back again
+   for (uint32_t u32_Run = 0U; u32_Run < (2U * c_Steps.size()); ++u32_Run)
+   {
+      const uint32_t u32_Step = (u32_Run < c_Steps.size()) ? u32_Run : ((2U * c_Steps.size()) - 1U - u32_Run);
+      const C_Topology & rc_Step = c_Steps[u32_Step];
+
+      for (uint32_t u32_Request = 0U; u32_Request < 2U; ++u32_Request)
+      {
+         std::vector<C_OscRoutingTable::C_TargetRoute> c_Routes;
+         const uint64_t u64_Start = TglGetTickCountUs();
+         C_OscRoutingTable::h_GetBestRoutes(rc_Step.c_Nodes, rc_Step.c_ActiveNodes, rc_Step.u32_StartBusIndex,
+                                            C_OscRoutingCalculation::eUPDATE, c_Routes);
+         if (u32_Request == 0U)
+         {
+            u64_TimeCalculation += TglGetTickCountUs() - u64_Start;
+         }
+         else
+         {
+            u64_TimeCache += TglGetTickCountUs() - u64_Start;
+         }
+      }
+      q_Return = mh_CompareWithPerNodeCalculation(rc_Step, C_OscRoutingCalculation::eUPDATE, u32_Step) && q_Return;
+   }
+   std::cout << "Routing table for " << (2U * c_Steps.size()) << " configurations: first request " <<
+      u64_TimeCalculation << " us, repeated request " << u64_TimeCache << " us" << std::endl;
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Compare routing table with one routing calculation per node
+
+   \param[in]  orc_Topology         System to check
+   \param[in]  oe_Mode              Routing mode
+   \param[in]  ou32_TopologyIndex   Index of topology for messages
+
+   \return
+   true     all results identical
+   false    at least one difference found (details printed to console)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CheckRoutingTable::mh_CompareWithPerNodeCalculation(const C_Topology & orc_Topology,
+                                                           const C_OscRoutingCalculation::E_Mode oe_Mode,
+                                                           const uint32_t ou32_TopologyIndex)
+{
+   bool q_Return = true;
+   std::vector<C_OscRoutingTable::C_TargetRoute> c_Routes;
+
+   C_OscRoutingTable::h_GetBestRoutes(orc_Topology.c_Nodes, orc_Topology.c_ActiveNodes,
+                                      orc_Topology.u32_StartBusIndex, oe_Mode, c_Routes);
+   if (c_Routes.size() != orc_Topology.c_Nodes.size())
+   {
+      std::cout << "Topology " << ou32_TopologyIndex << ": unexpected number of results." << std::endl;
+      q_Return = false;
+   }
+   for (uint32_t u32_Node = 0U; (u32_Node < c_Routes.size()) && (q_Return == true); ++u32_Node)
+   {
+      bool q_Same;
+      if (orc_Topology.c_ActiveNodes[u32_Node] == 1U)
+      {
+         const C_OscRoutingCalculation c_Calculation(orc_Topology.c_Nodes, orc_Topology.c_ActiveNodes,
+                                                     orc_Topology.u32_StartBusIndex, u32_Node, oe_Mode);
+         q_Same = (c_Calculation.GetState() == c_Routes[u32_Node].s32_State);
+         if ((q_Same == true) && (c_Calculation.GetState() == C_NO_ERR))
+         {
+            const C_OscRoutingRoute * const pc_Route = c_Calculation.GetBestRoute();
+            q_Same = (pc_Route != NULL) && (*pc_Route == c_Routes[u32_Node].c_Route);
+         }
+      }
+      else
+      {
+         q_Same = (c_Routes[u32_Node].s32_State == C_NOACT);
+      }
+      if (q_Same == false)
+      {
+         std::cout << "Topology " << ou32_TopologyIndex << ", mode " << static_cast<uint32_t>(oe_Mode) <<
+            ", node " << u32_Node << ": routing table differs from per node calculation." << std::endl;
+         q_Return = false;
+      }
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create device definitions with all combinations of flashloader types
+
+   Index bit 0: openSYDE Ethernet, bit 1: openSYDE CAN, bit 2: STW CAN flashloader.
+
+   \param[out]  orc_Devices   Device definitions
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CheckRoutingTable::mh_CreateDevices(std::vector<C_OscDeviceDefinition> & orc_Devices)
+{
+   orc_Devices.resize(8U);
+   for (uint32_t u32_Device = 0U; u32_Device < orc_Devices.size(); ++u32_Device)
+   {
+      C_OscSubDeviceDefinition c_SubDevice;
+      c_SubDevice.q_FlashloaderOpenSydeEthernet = ((u32_Device & 0x01U) != 0U);
+      c_SubDevice.q_FlashloaderOpenSydeCan = ((u32_Device & 0x02U) != 0U);
+      c_SubDevice.q_FlashloaderStwCan = ((u32_Device & 0x04U) != 0U);
+      orc_Devices[u32_Device].c_SubDevices.push_back(c_SubDevice);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create pseudo random meshed topology
+
+   Each bus is CAN or Ethernet; each node has up to mhu32_MAX_INTERFACES interfaces to random buses,
+   so there are usually several routes to one node.
+
+   \param[in,out]  oru32_State   State of pseudo random generator
+   \param[in]      orc_Devices   Device definitions to use (must stay valid as long as the topology is used)
+   \param[out]     orc_Topology  Created system
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CheckRoutingTable::mh_CreateRandomTopology(uint32_t & oru32_State,
+                                                  const std::vector<C_OscDeviceDefinition> & orc_Devices,
+                                                  C_Topology & orc_Topology)
+{
+   const uint32_t u32_NumBuses = 1U + (mh_GetRandom(oru32_State) % mhu32_MAX_BUSES);
+   const uint32_t u32_NumNodes = 1U + (mh_GetRandom(oru32_State) % mhu32_MAX_NODES);
+   std::vector<C_OscSystemBus::E_Type> c_BusTypes;
+
+   for (uint32_t u32_Bus = 0U; u32_Bus < u32_NumBuses; ++u32_Bus)
+   {
+      c_BusTypes.push_back(((mh_GetRandom(oru32_State) % 3U) == 0U) ? C_OscSystemBus::eETHERNET :
+                           C_OscSystemBus::eCAN);
+   }
+
+   orc_Topology.u32_StartBusIndex = mh_GetRandom(oru32_State) % u32_NumBuses;
+   orc_Topology.c_Nodes.clear();
+   orc_Topology.c_Nodes.resize(u32_NumNodes);
+   orc_Topology.c_ActiveNodes.resize(u32_NumNodes);
+   for (uint32_t u32_Node = 0U; u32_Node < u32_NumNodes; ++u32_Node)
+   {
+      C_OscNode & rc_Node = orc_Topology.c_Nodes[u32_Node];
+      const uint32_t u32_NumItfs = 1U + (mh_GetRandom(oru32_State) % mhu32_MAX_INTERFACES);
+      uint8_t au8_NextItfNumber[2] = { 0U, 0U };
+
+      rc_Node.pc_DeviceDefinition = &orc_Devices[mh_GetRandom(oru32_State) % orc_Devices.size()];
+      rc_Node.u32_SubDeviceIndex = 0U;
+      orc_Topology.c_ActiveNodes[u32_Node] = ((mh_GetRandom(oru32_State) % 8U) == 0U) ? 0U : 1U;
+
+      for (uint32_t u32_Itf = 0U; u32_Itf < u32_NumItfs; ++u32_Itf)
+      {
+         C_OscNodeComInterfaceSettings c_Itf;
+         const uint32_t u32_Bus = mh_GetRandom(oru32_State) % u32_NumBuses;
+         const uint32_t u32_Flags = mh_GetRandom(oru32_State);
+
+         c_Itf.e_InterfaceType = c_BusTypes[u32_Bus];
+         c_Itf.u8_InterfaceNumber = au8_NextItfNumber[static_cast<uint32_t>(c_BusTypes[u32_Bus])];
+         ++au8_NextItfNumber[static_cast<uint32_t>(c_BusTypes[u32_Bus])];
+         c_Itf.u8_NodeId = static_cast<uint8_t>(1U + (u32_Node % 120U));
+         c_Itf.q_IsRoutingEnabled = ((u32_Flags & 0x03U) != 0U);
+         c_Itf.q_IsUpdateEnabled = ((u32_Flags & 0x0CU) != 0U);
+         c_Itf.q_IsDiagnosisEnabled = ((u32_Flags & 0x30U) != 0U);
+         if ((u32_Flags & 0x1C0U) != 0U)
+         {
+            c_Itf.AddConnection(u32_Bus);
+         }
+         rc_Node.c_Properties.c_ComInterfaces.push_back(c_Itf);
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get next pseudo random number
+
+   \param[in,out]  oru32_State   State of generator (must not be zero)
+
+   \return
+   Pseudo random number
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_CheckRoutingTable::mh_GetRandom(uint32_t & oru32_State)
+{
+   // xorshift32
+   oru32_State ^= oru32_State << 13U;
+   oru32_State ^= oru32_State >> 17U;
+   oru32_State ^= oru32_State << 5U;
+   return oru32_State;
+}
@@ -0,0 +1,62 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Check of the routing table against the per node routing calculation (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_CHECKROUTINGTABLE_HPP
+#define C_CHECKROUTINGTABLE_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
+
+#include "stwtypes.hpp"
+#include "C_OscNode.hpp"
+#include "C_OscDeviceDefinition.hpp"
+#include "C_OscRoutingCalculation.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_CheckRoutingTable
+{
+public:
+   static bool h_Run(void);
+
+private:
+   ///one pseudo random system
+   class C_Topology
+   {
+   public:
+      std::vector<stw::opensyde_core::C_OscNode> c_Nodes;
+      std::vector<uint8_t> c_ActiveNodes;
+      uint32_t u32_StartBusIndex;
+   };
+
+   static bool mh_CheckRandomTopologies(const std::vector<stw::opensyde_core::C_OscDeviceDefinition> & orc_Devices);
+   static bool mh_CheckCache(const std::vector<stw::opensyde_core::C_OscDeviceDefinition> & orc_Devices);
+   static bool mh_CompareWithPerNodeCalculation(const C_Topology & orc_Topology,
+                                                const stw::opensyde_core::C_OscRoutingCalculation::E_Mode oe_Mode,
+                                                const uint32_t ou32_TopologyIndex);
+   static void mh_CreateDevices(std::vector<stw::opensyde_core::C_OscDeviceDefinition> & orc_Devices);
+   static void mh_CreateRandomTopology(uint32_t & oru32_State,
+                                       const std::vector<stw::opensyde_core::C_OscDeviceDefinition> & orc_Devices,
+                                       C_Topology & orc_Topology);
+   static uint32_t mh_GetRandom(uint32_t & oru32_State);
+
+   static const uint32_t mhu32_NUM_TOPOLOGIES;
+   static const uint32_t mhu32_MAX_BUSES;
+   static const uint32_t mhu32_MAX_NODES;
+   static const uint32_t mhu32_MAX_INTERFACES;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+
+#endif
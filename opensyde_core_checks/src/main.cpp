@@ -0,0 +1,98 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       openSYDE core checks main file
+
+   Console application running consistency checks of openSYDE core modules.
+   Without parameter all checks are run; with the name of a check as parameter only this check is run.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <iostream>
+
+#include "stwtypes.hpp"
+
+#include "C_CheckMessageLoggerFilterSet.hpp"
+#include "C_CheckHalcDatapoolUpdate.hpp"
+#include "C_CheckDataPoolBinaryFiler.hpp"
+#include "C_CheckCanSignalExtraction.hpp"
+#include "C_CheckIpLoopback.hpp"
+#include "C_CheckRoutingTable.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+///One check of the application
+class C_CoreCheck
+{
+public:
+   const char_t * pcn_Name; ///< Name used on the command line
+   bool (* pr_Run)(void);   ///< Check function; returns true if the check passed
+};
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+static const C_CoreCheck mac_CHECKS[] =
+{
+   { "message_logger_filter_set", &C_CheckMessageLoggerFilterSet::h_Run },
+   { "halc_datapool_update", &C_CheckHalcDatapoolUpdate::h_Run },
+   { "data_pool_binary_filer", &C_CheckDataPoolBinaryFiler::h_Run },
+   { "can_signal_extraction", &C_CheckCanSignalExtraction::h_Run },
+   { "ip_loopback", &C_CheckIpLoopback::h_Run },
+   { "routing_table", &C_CheckRoutingTable::h_Run }
+};
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   main
+
+   \param[in]   os32_Argc    Number of command line arguments
+   \param[in]   oppcn_Argv   Command line arguments
+
+   \return
+   0     all run checks passed
+   1     at least one check failed
+   2     unknown check name
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t main(const int32_t os32_Argc, char_t * const oppcn_Argv[])
+{
+   int32_t s32_Return = 0;
+   uint32_t u32_NumRun = 0U;
+   const stw::scl::C_SclString c_Requested = (os32_Argc > 1) ? oppcn_Argv[1] : "";
+
+   for (uint32_t u32_Check = 0U; u32_Check < (sizeof(mac_CHECKS) / sizeof(mac_CHECKS[0])); ++u32_Check)
+   {
+      const C_CoreCheck & rc_Check = mac_CHECKS[u32_Check];
+
+      if ((c_Requested == "") || (c_Requested == rc_Check.pcn_Name))
+      {
+         const bool q_Passed = rc_Check.pr_Run();
+         std::cout << rc_Check.pcn_Name << ": " << ((q_Passed == true) ? "passed" : "FAILED") << std::endl;
+         if (q_Passed == false)
+         {
+            s32_Return = 1;
+         }
+         ++u32_NumRun;
+      }
+   }
+
+   if (u32_NumRun == 0U)
+   {
+      std::cout << "Unknown check: " << c_Requested.c_str() << std::endl;
+      s32_Return = 2;
+   }
+
+   return s32_Return;
+}
@@ -0,0 +1,34 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Precompiled headers (header)
+
+   Contains a list of header files to be pre-compiled.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef PRECOMP_HEADERS_HPP
+#define PRECOMP_HEADERS_HPP
+
+//lint -esym(766,"precomp_headers.h")   effectively not used in lint "builds"; but that's exactly what we want
+#ifndef _lint //speed up linting: don't include all of the headers for each linted .cpp file
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+
+/* Add C includes here */
+
+#if defined __cplusplus
+/* Add C++ includes here */
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <map>
+#include <list>
+
+#include "C_SclString.hpp"
+
+#endif
+
+#endif
+
+#endif
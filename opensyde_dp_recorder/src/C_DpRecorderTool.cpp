@@ -0,0 +1,797 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Base class of openSYDE Datapool recorder
+
+   This contains the main functionality of the openSYDE Datapool recorder:
+   * record mode: connect to one openSYDE device via CAN, request cyclic transmission of the selected Datapool elements
+     and write all received values to a recording file (see C_OscDpRecordWriter) till the duration has elapsed or
+     Ctrl+C is pressed
+   * export mode: export a time range of a recording to a CSV file (see C_OscDpRecordReader)
+
+   See about.txt for detailed descriptions upon functionality and usage.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <getopt.h> //note: as we use getopt.h this application is not portable to all compilers
+#include <csignal>
+#include <iostream>
+
+#include "stwtypes.hpp"
+#include "stwerrors.hpp"
+#include "TglFile.hpp"
+#include "TglTime.hpp"
+#include "C_Can.hpp"
+#include "C_OscLoggingHandler.hpp"
+#include "C_OscSystemFilerUtil.hpp"
+#include "C_OscSystemDefinitionFiler.hpp"
+#include "C_OscProtocolDriverOsyTpCan.hpp"
+#include "C_OscDiagProtocolOsy.hpp"
+#include "C_OscDataDealerRecorder.hpp"
+#include "C_OscDpRecordReader.hpp"
+#include "C_OscDpRecordWriter.hpp"
+#include "C_DpRecorderTool.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::scl;
+using namespace stw::tgl;
+using namespace stw::errors;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const uint8_t mu8_CLIENT_NODE_ID = 126U;
+static const uint8_t mu8_RAIL = 0U;
+static const uint32_t mu32_TESTER_PRESENT_INTERVAL_MS = 1000U;
+static const uint32_t mu32_STATUS_INTERVAL_MS = 5000U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+static volatile std::sig_atomic_t ms32_StopRequested = 0;
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+static void m_HandleSignal(const int32_t os32_Signal);
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_DpRecorderTool::C_DpRecorderTool(void) :
+   mc_ProjectPath(""),
+   mc_DeviceDefPath(""),
+   mc_NodeName(""),
+   mc_CanInterface(""),
+   mu16_IntervalMs(10U),
+   mc_OutputPath(""),
+   mq_Compress(false),
+   mu32_DurationS(0U),
+   mc_RecordingPath(""),
+   mu64_ExportFromUs(0ULL),
+   mu64_ExportToUs(0xFFFFFFFFFFFFFFFFULL)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Initialization on tool startup
+
+   Show some information on command line and setup logging
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_DpRecorderTool::Init(void)
+{
+   C_SclString c_LogFile;
+   C_TglDateTime c_DateTime;
+
+   std::cout << "openSYDE Datapool recorder" << std::endl;
+
+   // setup logging
+   TglGetDateTimeNow(c_DateTime);
+   c_LogFile = C_OscLoggingHandler::h_UtilConvertDateTimeToString(c_DateTime);
+   // Convert  2023-08-28 09:47:50.459 to  2023-08-28_09-47-50
+   // i.e. replace " " with "_", replace ":" with "-" and cut decimals (number of characters is always the same)
+   c_LogFile = c_LogFile.Insert("_", 11); // " "
+   c_LogFile = c_LogFile.Delete(12, 1);
+   c_LogFile = c_LogFile.Insert("-", 14); // first ":"
+   c_LogFile = c_LogFile.Delete(15, 1);
+   c_LogFile = c_LogFile.Insert("-", 17); //second ":"
+   c_LogFile = c_LogFile.Delete(18, 1);
+   c_LogFile = c_LogFile.Delete(20, 4); // remove ".123"
+   c_LogFile = "./Logs/" + c_LogFile + ".syde_log";
+
+   C_OscLoggingHandler::h_SetCompleteLogFileLocation(c_LogFile);
+   C_OscLoggingHandler::h_SetWriteToFileActive(true);
+   C_OscLoggingHandler::h_SetWriteToConsoleActive(false);
+
+   std::cout << "Logging to file: " << c_LogFile.c_str() << "\n" << std::endl;
+
+   osc_write_log_info("Start", "openSYDE Datapool recorder started.");
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Parse command line
+
+   Parse command line arguments and write to internal data structure. Check that mandatory parameters got provided.
+
+   \param[in]  os32_Argc   Number of command line arguments
+   \param[in]  oppcn_Argv  Command line arguments
+
+   \return
+   eRESULT_OK                 everything ok
+   eRESULT_HELP_REQUESTED     command line option -h found -> only print help
+   eERR_PARSE_COMMAND_LINE    invalid or missing command line parameters
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_DpRecorderTool::E_Result C_DpRecorderTool::ParseCommandLine(const int32_t os32_Argc,
+                                                              char_t * const * const oppcn_Argv)
+{
+   E_Result e_Result = eRESULT_OK;
+   int32_t s32_Result;
+   bool q_ShowHelp = false;
+   bool q_ParseError = false;
+
+   const struct option ac_Options[] =
+   {
+      /* name, has_arg, flag, val */
+      {
+         "help",                       no_argument,         NULL,    'h'
+      },
+      {
+         "opensydeproject",            required_argument,   NULL,    's'
+      },
+      {
+         "devicedefinition",           required_argument,   NULL,    'd'
+      },
+      {
+         "node",                       required_argument,   NULL,    'n'
+      },
+      {
+         "element",                    required_argument,   NULL,    'e'
+      },
+      {
+         "caninterface",               required_argument,   NULL,    'i'
+      },
+      {
+         "interval",                   required_argument,   NULL,    'r'
+      },
+      {
+         "output",                     required_argument,   NULL,    'o'
+      },
+      {
+         "compress",                   no_argument,         NULL,    'z'
+      },
+      {
+         "duration",                   required_argument,   NULL,    't'
+      },
+      {
+         "export",                     required_argument,   NULL,    'x'
+      },
+      {
+         "from",                       required_argument,   NULL,    'f'
+      },
+      {
+         "to",                         required_argument,   NULL,    'u'
+      },
+      {
+         NULL,                         0,                   NULL,    0
+      }
+   };
+
+   do
+   {
+      int32_t s32_Index;
+      s32_Result = getopt_long(os32_Argc, oppcn_Argv, "hzs:d:n:e:i:r:o:t:x:f:u:", &ac_Options[0], &s32_Index);
+      if (s32_Result != -1)
+      {
+         switch (s32_Result)
+         {
+         case 'h':
+            q_ShowHelp = true;
+            break;
+         case 's':
+            mc_ProjectPath = optarg;
+            break;
+         case 'd':
+            mc_DeviceDefPath = optarg;
+            break;
+         case 'n':
+            mc_NodeName = optarg;
+            break;
+         case 'e':
+            mc_ElementNames.push_back(optarg);
+            break;
+         case 'i':
+            mc_CanInterface = optarg;
+            break;
+         case 'r':
+            try
+            {
+               const int32_t s32_Interval = static_cast<C_SclString>(optarg).ToInt();
+               if ((s32_Interval <= 0) || (s32_Interval > 0xFFFF))
+               {
+                  q_ParseError = true;
+               }
+               else
+               {
+                  mu16_IntervalMs = static_cast<uint16_t>(s32_Interval);
+               }
+            }
+            catch (...)
+            {
+               q_ParseError = true;
+            }
+            break;
+         case 'o':
+            mc_OutputPath = optarg;
+            break;
+         case 'z':
+            mq_Compress = true;
+            break;
+         case 't':
+            try
+            {
+               mu32_DurationS = static_cast<uint32_t>(static_cast<C_SclString>(optarg).ToInt64());
+            }
+            catch (...)
+            {
+               q_ParseError = true;
+            }
+            break;
+         case 'x':
+            mc_RecordingPath = optarg;
+            break;
+         case 'f':
+            if (mh_ParseSeconds(optarg, mu64_ExportFromUs) == false)
+            {
+               q_ParseError = true;
+            }
+            break;
+         case 'u':
+            if (mh_ParseSeconds(optarg, mu64_ExportToUs) == false)
+            {
+               q_ParseError = true;
+            }
+            break;
+         case '?': //parser reports error (missing parameter option)
+            q_ParseError = true;
+            break;
+         default:
+            q_ParseError = true;
+            break;
+         }
+      }
+   }
+   while (s32_Result != -1);
+
+   if ((q_ParseError == false) && (q_ShowHelp == false))
+   {
+      if (mc_RecordingPath != "")
+      {
+         //export mode
+         q_ParseError = (mc_OutputPath == "");
+      }
+      else
+      {
+         //record mode
+         q_ParseError = ((mc_ProjectPath == "") || (mc_DeviceDefPath == "") || (mc_NodeName == "") ||
+                         (mc_ElementNames.size() == 0U) || (mc_CanInterface == "") || (mc_OutputPath == ""));
+      }
+   }
+
+   if (q_ShowHelp == true)
+   {
+      mh_PrintHelp();
+      e_Result = eRESULT_HELP_REQUESTED;
+   }
+   else if (q_ParseError == true)
+   {
+      mh_PrintHelp();
+      std::cout << "Error: Invalid or missing command line parameters.\n\n";
+      e_Result = eERR_PARSE_COMMAND_LINE;
+   }
+   else
+   {
+      const C_SclString c_LogActivity = "Parameter Value";
+      if (mc_RecordingPath != "")
+      {
+         osc_write_log_info(c_LogActivity, "Recording to export: " + mc_RecordingPath);
+         osc_write_log_info(c_LogActivity, "CSV file: " + mc_OutputPath);
+      }
+      else
+      {
+         osc_write_log_info(c_LogActivity, "openSYDE project: " + mc_ProjectPath);
+         osc_write_log_info(c_LogActivity, "Device definition: " + mc_DeviceDefPath);
+         osc_write_log_info(c_LogActivity, "Node: " + mc_NodeName);
+         for (uint32_t u32_Element = 0U; u32_Element < mc_ElementNames.size(); ++u32_Element)
+         {
+            osc_write_log_info(c_LogActivity, "Element: " + mc_ElementNames[u32_Element]);
+         }
+         osc_write_log_info(c_LogActivity, "CAN interface: " + mc_CanInterface);
+         osc_write_log_info(c_LogActivity, "Interval in ms: " + C_SclString::IntToStr(mu16_IntervalMs));
+         osc_write_log_info(c_LogActivity, "Recording file: " + mc_OutputPath);
+         osc_write_log_info(c_LogActivity, "Compress: " + C_SclString((mq_Compress == true) ? "yes" : "no"));
+         osc_write_log_info(c_LogActivity, "Duration in s: " + C_SclString::IntToStr(mu32_DurationS));
+      }
+   }
+
+   return e_Result;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Record or export as selected on command line
+
+   \return
+   see m_Record and m_Export
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_DpRecorderTool::E_Result C_DpRecorderTool::Run(void)
+{
+   E_Result e_Result;
+
+   if (mc_RecordingPath != "")
+   {
+      e_Result = this->m_Export();
+   }
+   else
+   {
+      e_Result = this->m_Record();
+   }
+
+   // update log file to recent information
+   C_OscLoggingHandler::h_Flush();
+
+   if (e_Result != eRESULT_OK)
+   {
+      std::cout << "\nError: Result code: " << static_cast<int32_t>(e_Result) << ". See log file for details. " <<
+         std::endl;
+   }
+   return e_Result;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Record Datapool elements
+
+   The device is accessed directly on the given CAN interface (no routing).
+
+   \return
+   eRESULT_OK                    recording finished
+   eERR_LOAD_PROJECT             could not load project or find node or elements
+   eERR_INITIALIZATION_FAILED    could not set up CAN, protocol or recording file
+   eERR_CONNECT                  could not set session or security level
+   eERR_START_TRANSMISSION       could not request cyclic transmissions
+   eERR_RECORDING                writing the recording failed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_DpRecorderTool::E_Result C_DpRecorderTool::m_Record(void)
+{
+   E_Result e_Result;
+   C_OscSystemDefinition c_SystemDefinition;
+   uint32_t u32_NodeIndex = 0U;
+   std::vector<C_OscNodeDataPoolListElementId> c_Elements;
+   stw::can::C_Can c_Can;
+   C_OscProtocolDriverOsyTpCan c_TpCan;
+   C_OscDiagProtocolOsy c_Diag;
+   C_OscDataDealerRecorder c_Dealer;
+   C_OscDpRecordWriter c_Writer;
+   std::vector<C_OscDpRecordFormat::C_Channel> c_Channels;
+   C_SclString c_LogActivity = "Initialization";
+   int32_t s32_Return;
+   uint8_t u8_NrCode = 0U;
+
+   e_Result = this->m_LoadProject(c_SystemDefinition, u32_NodeIndex, c_Elements);
+
+   if (e_Result == eRESULT_OK)
+   {
+      C_OscNode & rc_Node = c_SystemDefinition.c_Nodes[u32_NodeIndex];
+      const C_OscNodeComInterfaceSettings * pc_Interface = NULL;
+
+      for (uint32_t u32_Interface = 0U; u32_Interface < rc_Node.c_Properties.c_ComInterfaces.size(); ++u32_Interface)
+      {
+         const C_OscNodeComInterfaceSettings & rc_Interface = rc_Node.c_Properties.c_ComInterfaces[u32_Interface];
+         if ((rc_Interface.e_InterfaceType == C_OscSystemBus::eCAN) && (rc_Interface.GetBusConnected() == true) &&
+             (rc_Interface.q_IsDiagnosisEnabled == true) && (pc_Interface == NULL))
+         {
+            pc_Interface = &rc_Interface;
+         }
+      }
+
+      if (pc_Interface == NULL)
+      {
+         osc_write_log_error(c_LogActivity, "Node has no CAN interface with diagnosis enabled.");
+         e_Result = eERR_INITIALIZATION_FAILED;
+      }
+      else
+      {
+         C_OscProtocolDriverOsyNode c_Client;
+         C_OscProtocolDriverOsyNode c_Server;
+         c_Client.u8_NodeIdentifier = mu8_CLIENT_NODE_ID;
+         c_Client.u8_BusIdentifier = c_SystemDefinition.c_Buses[pc_Interface->u32_BusIndex].u8_BusId;
+         c_Server.u8_NodeIdentifier = pc_Interface->u8_NodeId;
+         c_Server.u8_BusIdentifier = c_Client.u8_BusIdentifier;
+
+         s32_Return = c_Can.CAN_Init(mc_CanInterface);
+         if (s32_Return != C_NO_ERR)
+         {
+            osc_write_log_error(c_LogActivity, "Could not initialize the CAN interface \"" + mc_CanInterface + "\"!");
+         }
+         else
+         {
+            s32_Return = c_TpCan.SetDispatcher(&c_Can);
+         }
+         if (s32_Return == C_NO_ERR)
+         {
+            s32_Return = c_Diag.SetTransportProtocol(&c_TpCan);
+         }
+         if (s32_Return == C_NO_ERR)
+         {
+            s32_Return = c_Diag.SetNodeIdentifiers(c_Client, c_Server);
+         }
+         if (s32_Return == C_NO_ERR)
+         {
+            c_Dealer.Initialize(&rc_Node, u32_NodeIndex, &c_Diag);
+            s32_Return = c_Dealer.SetRecordedElements(c_Elements, c_Channels);
+         }
+         if (s32_Return == C_NO_ERR)
+         {
+            s32_Return = c_Writer.Open(mc_OutputPath, c_Channels, mq_Compress);
+         }
+         if (s32_Return != C_NO_ERR)
+         {
+            osc_write_log_error(c_LogActivity, "Initialization failed: " + C_OscLoggingHandler::h_StwError(s32_Return));
+            e_Result = eERR_INITIALIZATION_FAILED;
+         }
+      }
+   }
+
+   if (e_Result == eRESULT_OK)
+   {
+      bool q_SecureMode = false;
+      uint64_t u64_Seed;
+      uint8_t u8_SecurityAlgorithm;
+
+      c_LogActivity = "Connect";
+      s32_Return = c_Diag.OsyDiagnosticSessionControl(C_OscProtocolDriverOsy::hu8_DIAGNOSTIC_SESSION_EXTENDED_DIAGNOSIS,
+                                                      &u8_NrCode);
+      if (s32_Return == C_NO_ERR)
+      {
+         s32_Return = c_Diag.OsySecurityAccessRequestSeed(1U, q_SecureMode, u64_Seed, u8_SecurityAlgorithm,
+                                                          &u8_NrCode);
+      }
+      if ((s32_Return == C_NO_ERR) && (q_SecureMode == true))
+      {
+         osc_write_log_error(c_LogActivity, "Node requires secure authentication. Not supported by this tool.");
+         s32_Return = C_CONFIG;
+      }
+      if (s32_Return == C_NO_ERR)
+      {
+         const uint32_t u32_KEY = 23U; // fixed in UDS stack for non secure mode
+         s32_Return = c_Diag.OsySecurityAccessSendKey(1U, u32_KEY, &u8_NrCode);
+      }
+      if (s32_Return != C_NO_ERR)
+      {
+         osc_write_log_error(c_LogActivity, "Could not connect to node! Details: " +
+                             C_OscProtocolDriverOsy::h_GetOpenSydeServiceErrorDetails(s32_Return, u8_NrCode));
+         e_Result = eERR_CONNECT;
+      }
+   }
+
+   if (e_Result == eRESULT_OK)
+   {
+      c_LogActivity = "Start Transmission";
+      s32_Return = c_Diag.DataPoolSetEventDataRate(mu8_RAIL, mu16_IntervalMs);
+      c_Dealer.StartRecording(&c_Writer);
+      for (uint32_t u32_Element = 0U; (u32_Element < c_Elements.size()) && (s32_Return == C_NO_ERR); ++u32_Element)
+      {
+         const C_OscNodeDataPoolListElementId & rc_Id = c_Elements[u32_Element];
+         s32_Return = c_Diag.DataPoolReadCyclic(static_cast<uint8_t>(rc_Id.u32_DataPoolIndex),
+                                                static_cast<uint16_t>(rc_Id.u32_ListIndex),
+                                                static_cast<uint16_t>(rc_Id.u32_ElementIndex), mu8_RAIL, &u8_NrCode);
+      }
+      if (s32_Return != C_NO_ERR)
+      {
+         osc_write_log_error(c_LogActivity, "Could not request cyclic transmission! Details: " +
+                             C_OscProtocolDriverOsy::h_GetOpenSydeServiceErrorDetails(s32_Return, u8_NrCode));
+         e_Result = eERR_START_TRANSMISSION;
+      }
+   }
+
+   if (e_Result == eRESULT_OK)
+   {
+      const uint32_t u32_Start = TglGetTickCount();
+      uint32_t u32_LastTesterPresent = u32_Start;
+      uint32_t u32_LastStatus = u32_Start;
+      bool q_Continue = true;
+
+      c_LogActivity = "Recording";
+      osc_write_log_info(c_LogActivity, "Recording started.");
+      std::cout << "Recording ... press Ctrl+C to stop." << std::endl;
+      ms32_StopRequested = 0;
+      (void)std::signal(SIGINT, &m_HandleSignal);
+      (void)std::signal(SIGTERM, &m_HandleSignal);
+
+      while (q_Continue == true)
+      {
+         const uint32_t u32_Now = TglGetTickCount();
+
+         (void)c_Diag.Cycle();
+
+         if ((u32_Now - u32_LastTesterPresent) >= mu32_TESTER_PRESENT_INTERVAL_MS)
+         {
+            (void)c_Diag.OsyTesterPresent(1U);
+            u32_LastTesterPresent = u32_Now;
+         }
+         if ((u32_Now - u32_LastStatus) >= mu32_STATUS_INTERVAL_MS)
+         {
+            const C_OscDpRecordWriterStatistics c_Statistics = c_Writer.GetStatistics();
+            std::cout << "Samples written: " << c_Statistics.u64_SamplesWritten << ", bytes: " <<
+               c_Statistics.u64_BytesWritten << std::endl;
+            u32_LastStatus = u32_Now;
+         }
+
+         if ((ms32_StopRequested != 0) ||
+             ((mu32_DurationS > 0U) && ((u32_Now - u32_Start) >= (mu32_DurationS * 1000U))))
+         {
+            q_Continue = false;
+         }
+         else
+         {
+            TglSleep(1U);
+         }
+      }
+
+      (void)std::signal(SIGINT, SIG_DFL);
+      (void)std::signal(SIGTERM, SIG_DFL);
+      (void)c_Diag.DataPoolStopEventDriven();
+      c_Dealer.StopRecording();
+   }
+
+   if (c_Writer.IsOpen() == true)
+   {
+      s32_Return = c_Writer.Close();
+      if ((s32_Return != C_NO_ERR) && (e_Result == eRESULT_OK))
+      {
+         osc_write_log_error(c_LogActivity, "Writing the recording failed: " +
+                             C_OscLoggingHandler::h_StwError(s32_Return));
+         e_Result = eERR_RECORDING;
+      }
+      if (e_Result == eRESULT_OK)
+      {
+         const C_OscDpRecordWriterStatistics c_Statistics = c_Writer.GetStatistics();
+         const C_SclString c_Summary = "Recording finished. Samples: " +
+                                       C_SclString::IntToStr(c_Statistics.u64_SamplesWritten) + ", lost: " +
+                                       C_SclString::IntToStr(c_Statistics.u64_SamplesLost) + ", ignored events: " +
+                                       C_SclString::IntToStr(c_Dealer.GetIgnoredEventCount()) + ", bytes: " +
+                                       C_SclString::IntToStr(c_Statistics.u64_BytesWritten);
+         osc_write_log_info(c_LogActivity, c_Summary);
+         std::cout << c_Summary.c_str() << std::endl;
+      }
+   }
+   (void)c_Can.CAN_Exit();
+
+   return e_Result;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Export recording to CSV file
+
+   \return
+   eRESULT_OK     CSV file written
+   eERR_EXPORT    could not read recording or write CSV file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_DpRecorderTool::E_Result C_DpRecorderTool::m_Export(void)
+{
+   E_Result e_Result = eRESULT_OK;
+   C_OscDpRecordReader c_Reader;
+   int32_t s32_Return;
+
+   s32_Return = c_Reader.Open(mc_RecordingPath);
+   if (s32_Return == C_NO_ERR)
+   {
+      std::cout << "Recording started " << c_Reader.GetStartTime().c_str() << ", elements: " <<
+         c_Reader.GetChannels().size() << ", samples: " << c_Reader.GetSampleCount() << std::endl;
+      if (c_Reader.IsIndexRecovered() == true)
+      {
+         std::cout << "Recording was not closed properly; all complete chunks were recovered." << std::endl;
+      }
+      s32_Return = c_Reader.ExportCsv(mc_OutputPath, mu64_ExportFromUs, mu64_ExportToUs);
+   }
+
+   if (s32_Return != C_NO_ERR)
+   {
+      osc_write_log_error("Export", "Exporting \"" + mc_RecordingPath + "\" failed: " +
+                          C_OscLoggingHandler::h_StwError(s32_Return));
+      e_Result = eERR_EXPORT;
+   }
+   else
+   {
+      std::cout << "Exported to " << mc_OutputPath.c_str() << std::endl;
+   }
+   return e_Result;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Load system definition and resolve node and element names
+
+   \param[out]  orc_SystemDefinition   loaded system definition
+   \param[out]  oru32_NodeIndex        index of node to record
+   \param[out]  orc_Elements           elements to record
+
+   \return
+   eRESULT_OK           project loaded, node and all elements found
+   eERR_LOAD_PROJECT    otherwise (see log)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_DpRecorderTool::E_Result C_DpRecorderTool::m_LoadProject(C_OscSystemDefinition & orc_SystemDefinition,
+                                                           uint32_t & oru32_NodeIndex,
+                                                           std::vector<C_OscNodeDataPoolListElementId> & orc_Elements)
+const
+{
+   E_Result e_Result = eRESULT_OK;
+   const C_SclString c_LogActivity = "Load Project";
+   C_SclString c_SysDefPath;
+   bool q_NodeFound = false;
+
+   orc_Elements.clear();
+
+   if (TglFileExists(mc_ProjectPath) == false)
+   {
+      osc_write_log_error(c_LogActivity, "Project file \"" + mc_ProjectPath + "\" does not exist.");
+      e_Result = eERR_LOAD_PROJECT;
+   }
+   else
+   {
+      C_OscSystemFilerUtil::h_AdaptProjectPathToSystemDefinition(mc_ProjectPath, c_SysDefPath);
+      if (C_OscSystemDefinitionFiler::h_LoadSystemDefinitionFile(orc_SystemDefinition, c_SysDefPath,
+                                                                 mc_DeviceDefPath) != C_NO_ERR)
+      {
+         osc_write_log_error(c_LogActivity, "Could not load system definition \"" + c_SysDefPath + "\".");
+         e_Result = eERR_LOAD_PROJECT;
+      }
+   }
+
+   if (e_Result == eRESULT_OK)
+   {
+      for (uint32_t u32_Node = 0U; (u32_Node < orc_SystemDefinition.c_Nodes.size()) && (q_NodeFound == false);
+           ++u32_Node)
+      {
+         if (orc_SystemDefinition.c_Nodes[u32_Node].c_Properties.c_Name == mc_NodeName)
+         {
+            oru32_NodeIndex = u32_Node;
+            q_NodeFound = true;
+         }
+      }
+      if (q_NodeFound == false)
+      {
+         osc_write_log_error(c_LogActivity, "Node \"" + mc_NodeName + "\" not found.");
+         e_Result = eERR_LOAD_PROJECT;
+      }
+      else if (orc_SystemDefinition.c_Nodes[oru32_NodeIndex].c_Properties.e_DiagnosticServer !=
+               C_OscNodeProperties::eDS_OPEN_SYDE)
+      {
+         osc_write_log_error(c_LogActivity, "Node \"" + mc_NodeName + "\" is no openSYDE server.");
+         e_Result = eERR_LOAD_PROJECT;
+      }
+      else
+      {
+         //nothing to do
+      }
+   }
+
+   for (uint32_t u32_Element = 0U; (u32_Element < mc_ElementNames.size()) && (e_Result == eRESULT_OK);
+        ++u32_Element)
+   {
+      const C_OscNode & rc_Node = orc_SystemDefinition.c_Nodes[oru32_NodeIndex];
+      C_SclDynamicArray<C_SclString> c_Tokens;
+      bool q_Found = false;
+
+      mc_ElementNames[u32_Element].Tokenize(".", c_Tokens);
+      if (c_Tokens.GetLength() == 3)
+      {
+         for (uint32_t u32_DataPool = 0U; (u32_DataPool < rc_Node.c_DataPools.size()) && (q_Found == false);
+              ++u32_DataPool)
+         {
+            const C_OscNodeDataPool & rc_DataPool = rc_Node.c_DataPools[u32_DataPool];
+            for (uint32_t u32_List = 0U; (u32_List < rc_DataPool.c_Lists.size()) && (q_Found == false) &&
+                 (rc_DataPool.c_Name == c_Tokens[0]); ++u32_List)
+            {
+               const C_OscNodeDataPoolList & rc_List = rc_DataPool.c_Lists[u32_List];
+               for (uint32_t u32_Index = 0U; (u32_Index < rc_List.c_Elements.size()) && (q_Found == false) &&
+                    (rc_List.c_Name == c_Tokens[1]); ++u32_Index)
+               {
+                  if (rc_List.c_Elements[u32_Index].c_Name == c_Tokens[2])
+                  {
+                     orc_Elements.push_back(C_OscNodeDataPoolListElementId(oru32_NodeIndex, u32_DataPool, u32_List,
+                                                                           u32_Index));
+                     q_Found = true;
+                  }
+               }
+            }
+         }
+      }
+      if (q_Found == false)
+      {
+         osc_write_log_error(c_LogActivity, "Element \"" + mc_ElementNames[u32_Element] + "\" not found.");
+         e_Result = eERR_LOAD_PROJECT;
+      }
+   }
+
+   return e_Result;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Parse time in seconds (e.g. "12.5")
+
+   \param[in]   orc_Text       text to parse
+   \param[out]  oru64_TimeUs   time in us
+
+   \retval   true    valid time
+   \retval   false   no valid time
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_DpRecorderTool::mh_ParseSeconds(const C_SclString & orc_Text, uint64_t & oru64_TimeUs)
+{
+   bool q_Return = true;
+
+   try
+   {
+      const float64_t f64_Seconds = orc_Text.ToDouble();
+      if (f64_Seconds < 0.0)
+      {
+         q_Return = false;
+      }
+      else
+      {
+         oru64_TimeUs = static_cast<uint64_t>((f64_Seconds * 1000000.0) + 0.5);
+      }
+   }
+   catch (...)
+   {
+      q_Return = false;
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Print help information to command line
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_DpRecorderTool::mh_PrintHelp(void)
+{
+   std::cout << "Record mode:\n" <<
+      "-s  --opensydeproject   openSYDE project file (*.syde)\n" <<
+      "-d  --devicedefinition  Device definition file (devices.ini)\n" <<
+      "-n  --node              Name of node to record\n" <<
+      "-e  --element           Element to record as \"Datapool.List.Element\" (can be repeated)\n" <<
+      "-i  --caninterface      CAN interface (e.g. can0); bitrate is set up outside the tool\n" <<
+      "-r  --interval          Transmission interval in ms (optional; default: 10)\n" <<
+      "-o  --output            Recording file\n" <<
+      "-z  --compress          Compress recording (optional)\n" <<
+      "-t  --duration          Recording duration in s (optional; default: till Ctrl+C)\n" <<
+      "Export mode:\n" <<
+      "-x  --export            Recording file to export\n" <<
+      "-o  --output            CSV file\n" <<
+      "-f  --from              Start of time range in s (optional)\n" <<
+      "-u  --to                End of time range in s (optional)\n" <<
+      "-h  --help              Print this help\n" << std::endl;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Signal handler for stopping the recording
+
+   \param[in]  os32_Signal    signal number
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_HandleSignal(const int32_t os32_Signal)
+{
+   (void)os32_Signal;
+   ms32_StopRequested = 1;
+}
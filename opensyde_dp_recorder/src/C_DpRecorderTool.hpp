@@ -0,0 +1,80 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Base class of openSYDE Datapool recorder (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_DPRECORDERTOOL_HPP
+#define C_DPRECORDERTOOL_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
+
+#include "stwtypes.hpp"
+#include "C_SclString.hpp"
+#include "C_OscSystemDefinition.hpp"
+#include "C_OscNodeDataPoolListElementId.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_DpRecorderTool
+{
+public:
+   enum E_Result
+   {
+      eRESULT_OK = 0,
+      eRESULT_HELP_REQUESTED = 1,
+      eERR_PARSE_COMMAND_LINE = 10,
+      eERR_LOAD_PROJECT = 20,
+      eERR_INITIALIZATION_FAILED = 30,
+      eERR_CONNECT = 40,
+      eERR_START_TRANSMISSION = 50,
+      eERR_RECORDING = 60,
+      eERR_EXPORT = 70
+      // description of error codes in about.txt
+   };
+
+   C_DpRecorderTool(void);
+
+   void Init(void);
+   E_Result ParseCommandLine(const int32_t os32_Argc, char_t * const * const oppcn_Argv);
+   E_Result Run(void);
+
+private:
+   //Avoid call
+   C_DpRecorderTool(const C_DpRecorderTool &);
+   C_DpRecorderTool & operator =(const C_DpRecorderTool &);
+
+   stw::scl::C_SclString mc_ProjectPath;
+   stw::scl::C_SclString mc_DeviceDefPath;
+   stw::scl::C_SclString mc_NodeName;
+   std::vector<stw::scl::C_SclString> mc_ElementNames;
+   stw::scl::C_SclString mc_CanInterface;
+   uint16_t mu16_IntervalMs;
+   stw::scl::C_SclString mc_OutputPath;
+   bool mq_Compress;
+   uint32_t mu32_DurationS;
+   stw::scl::C_SclString mc_RecordingPath;
+   uint64_t mu64_ExportFromUs;
+   uint64_t mu64_ExportToUs;
+
+   E_Result m_Record(void);
+   E_Result m_Export(void);
+   E_Result m_LoadProject(stw::opensyde_core::C_OscSystemDefinition & orc_SystemDefinition,
+                          uint32_t & oru32_NodeIndex,
+                          std::vector<stw::opensyde_core::C_OscNodeDataPoolListElementId> & orc_Elements) const;
+   static bool mh_ParseSeconds(const stw::scl::C_SclString & orc_Text, uint64_t & oru64_TimeUs);
+   static void mh_PrintHelp(void);
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+
+#endif
@@ -0,0 +1,58 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       openSYDE Datapool recorder main file
+
+   Console application for recording Datapool elements of one device and exporting recordings to CSV.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include "stwtypes.hpp"
+
+#include "C_DpRecorderTool.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   main
+
+   \param[in]   os32_Argc    Number of command line arguments
+   \param[in]   oppcn_Argv   Command line arguments
+
+   \return
+   result code (see C_DpRecorderTool::E_Result and about.txt)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t main(const int32_t os32_Argc, char_t * const oppcn_Argv[])
+{
+   C_DpRecorderTool c_TheRecorder;
+
+   C_DpRecorderTool::E_Result e_ResultCode;
+
+   c_TheRecorder.Init();
+   e_ResultCode = c_TheRecorder.ParseCommandLine(os32_Argc, oppcn_Argv);
+
+   if (e_ResultCode == C_DpRecorderTool::eRESULT_OK)
+   {
+      e_ResultCode = c_TheRecorder.Run();
+   }
+
+   return static_cast<uint8_t>(e_ResultCode);
+}
@@ -565,6 +565,7 @@ contains(opensyde_core_skip_modules, opensyde_core_skip_protocol_drivers_system)
               $${PWD}/protocol_drivers/communication/C_OscComSequencesBase.cpp \
               $${PWD}/protocol_drivers/routing/C_OscRoutingCalculation.cpp \
               $${PWD}/protocol_drivers/routing/C_OscRoutingRoute.cpp \
+              $${PWD}/protocol_drivers/system_update/C_OscSuCheckpointJournal.cpp \
               $${PWD}/protocol_drivers/system_update/C_OscSuSequences.cpp \
               $${PWD}/protocol_drivers/system_update/C_OscSuSequencesNodeStates.cpp \
               $${PWD}/protocol_drivers/system_update/package/C_OscSupServiceUpdatePackageV1.cpp \
@@ -593,6 +594,7 @@ contains(opensyde_core_skip_modules, opensyde_core_skip_protocol_drivers_system)
               $${PWD}/protocol_drivers/communication/C_OscComSequencesBase.hpp \
               $${PWD}/protocol_drivers/routing/C_OscRoutingCalculation.hpp \
               $${PWD}/protocol_drivers/routing/C_OscRoutingRoute.hpp \
+              $${PWD}/protocol_drivers/system_update/C_OscSuCheckpointJournal.hpp \
               $${PWD}/protocol_drivers/system_update/C_OscSuSequences.hpp \
               $${PWD}/protocol_drivers/system_update/C_OscSuSequencesNodeStates.hpp \
               $${PWD}/protocol_drivers/system_update/package/C_OscSupServiceUpdatePackageV1.hpp \
@@ -0,0 +1,283 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Journal of nodes finished by a system update
+
+   Records each node that was updated completely by C_OscSuSequences::UpdateSystem.
+   If an update is interrupted (e.g. power loss or disconnected cable) the next run can skip the nodes listed here
+   instead of flashing them again.
+
+   A checkpoint is only used if
+   * the digest of the files and settings to write to the node is still the same,
+   * the node reports the same serial number and
+   * the application information read from the node is still the same as directly after its update.
+
+   The journal is written to disk after each finished node. It is written to a temporary file first so an
+   interruption while writing never leaves a partly written journal.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <cstdio>
+
+#include "stwtypes.hpp"
+#include "stwerrors.hpp"
+#include "TglFile.hpp"
+#include "C_SclIniFile.hpp"
+#include "C_SclStringList.hpp"
+#include "C_OscLoggingHandler.hpp"
+#include "C_OscSuCheckpointJournal.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::scl;
+using namespace stw::tgl;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const C_SclString mhc_SECTION_JOURNAL = "Journal";
+static const C_SclString mhc_KEY_SYSTEM_IDENTITY = "SystemIdentity";
+static const C_SclString mhc_SECTION_PREFIX = "Node";
+static const C_SclString mhc_KEY_DIGEST = "PackageDigest";
+static const C_SclString mhc_KEY_SERIAL_NUMBER = "SerialNumber";
+static const C_SclString mhc_KEY_FINGERPRINT = "Fingerprint";
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscSuCheckpointJournal::C_OscSuCheckpointJournal(void) :
+   mc_FilePath(""),
+   mc_SystemIdentity("")
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Use journal file
+
+   Loads the checkpoints from the file if it exists and was written for the same system.
+   If not, the journal starts empty and the file is (re-)created with the first checkpoint.
+   The node indices of the checkpoints are only meaningful for one system definition or update package.
+   So the caller passes an identity (e.g. project path and view name or update package digest)
+   that is stored with the checkpoints.
+
+   \param[in]  orc_FilePath         path of journal file
+   \param[in]  orc_SystemIdentity   identity of the system definition or update package to update
+
+   \return
+   C_NO_ERR    journal loaded or started empty
+   C_RD_WR     journal file exists but could not be read (journal starts empty)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscSuCheckpointJournal::Open(const C_SclString & orc_FilePath, const C_SclString & orc_SystemIdentity)
+{
+   int32_t s32_Return = C_NO_ERR;
+
+   this->mc_FilePath = orc_FilePath;
+   this->mc_SystemIdentity = orc_SystemIdentity;
+   this->mc_Checkpoints.clear();
+
+   if (TglFileExists(orc_FilePath) == true)
+   {
+      try
+      {
+         C_SclIniFile c_Ini(orc_FilePath);
+         C_SclStringList c_Sections;
+
+         if (c_Ini.ReadString(mhc_SECTION_JOURNAL, mhc_KEY_SYSTEM_IDENTITY, "") != orc_SystemIdentity)
+         {
+            osc_write_log_info("System Update", "Update checkpoint journal \"" + orc_FilePath +
+                               "\" belongs to another system. All nodes will be updated.");
+         }
+         else
+         {
+            c_Ini.ReadSections(&c_Sections);
+         }
+         for (uint32_t u32_Section = 0U; u32_Section < c_Sections.GetCount(); ++u32_Section)
+         {
+            const C_SclString & rc_Section = c_Sections.Strings[u32_Section];
+            if (rc_Section.Pos(mhc_SECTION_PREFIX) == 1U)
+            {
+               C_NodeCheckpoint c_Checkpoint;
+               uint32_t u32_NodeIndex;
+
+               try
+               {
+                  u32_NodeIndex = static_cast<uint32_t>(rc_Section.SubString(mhc_SECTION_PREFIX.Length() + 1U,
+                                                                             rc_Section.Length()).ToInt());
+                  c_Checkpoint.c_PackageDigest = c_Ini.ReadString(rc_Section, mhc_KEY_DIGEST, "");
+                  c_Checkpoint.c_SerialNumber = c_Ini.ReadString(rc_Section, mhc_KEY_SERIAL_NUMBER, "");
+                  c_Checkpoint.c_Fingerprint = c_Ini.ReadString(rc_Section, mhc_KEY_FINGERPRINT, "");
+                  if ((c_Checkpoint.c_PackageDigest != "") && (c_Checkpoint.c_Fingerprint != ""))
+                  {
+                     this->mc_Checkpoints[u32_NodeIndex] = c_Checkpoint;
+                  }
+               }
+               catch (...)
+               {
+                  //not a valid node index; ignore section
+               }
+            }
+         }
+      }
+      catch (...)
+      {
+         osc_write_log_warning("System Update", "Could not read update checkpoint journal \"" + orc_FilePath +
+                               "\". All nodes will be updated.");
+         this->mc_Checkpoints.clear();
+         s32_Return = C_RD_WR;
+      }
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Remove all checkpoints
+
+   To be called after a system update finished successfully so the next update of the same system starts over.
+
+   \return
+   C_NO_ERR    journal cleared
+   C_RD_WR     could not remove journal file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscSuCheckpointJournal::Clear(void)
+{
+   int32_t s32_Return = C_NO_ERR;
+
+   this->mc_Checkpoints.clear();
+   if ((this->mc_FilePath != "") && (TglFileExists(this->mc_FilePath) == true))
+   {
+      if (std::remove(this->mc_FilePath.c_str()) != 0)
+      {
+         s32_Return = C_RD_WR;
+      }
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get checkpoint of node
+
+   \param[in]   ou32_NodeIndex    index of node within system definition
+   \param[out]  orc_Checkpoint    checkpoint of node (only valid if true is returned)
+
+   \retval   true    node has a checkpoint
+   \retval   false   node has no checkpoint
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscSuCheckpointJournal::GetNodeCheckpoint(const uint32_t ou32_NodeIndex,
+                                                 C_NodeCheckpoint & orc_Checkpoint) const
+{
+   bool q_Return = false;
+   const std::map<uint32_t, C_NodeCheckpoint>::const_iterator c_It = this->mc_Checkpoints.find(ou32_NodeIndex);
+
+   if (c_It != this->mc_Checkpoints.end())
+   {
+      orc_Checkpoint = c_It->second;
+      q_Return = true;
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Record checkpoint of node and write journal file
+
+   \param[in]  ou32_NodeIndex    index of node within system definition
+   \param[in]  orc_Checkpoint    checkpoint of node
+
+   \return
+   C_NO_ERR    checkpoint recorded and written
+   C_CONFIG    no journal file set (Open() not called)
+   C_RD_WR     could not write journal file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscSuCheckpointJournal::SetNodeCheckpoint(const uint32_t ou32_NodeIndex,
+                                                    const C_NodeCheckpoint & orc_Checkpoint)
+{
+   this->mc_Checkpoints[ou32_NodeIndex] = orc_Checkpoint;
+   return this->m_Save();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write all checkpoints to journal file
+
+   \return
+   C_NO_ERR    journal written
+   C_CONFIG    no journal file set
+   C_RD_WR     could not write journal file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscSuCheckpointJournal::m_Save(void) const
+{
+   int32_t s32_Return = C_NO_ERR;
+
+   if (this->mc_FilePath == "")
+   {
+      s32_Return = C_CONFIG;
+   }
+   else
+   {
+      const C_SclString c_TempPath = this->mc_FilePath + ".tmp";
+
+      if (TglFileExists(c_TempPath) == true)
+      {
+         (void)std::remove(c_TempPath.c_str());
+      }
+
+      try
+      {
+         C_SclIniFile c_Ini(c_TempPath);
+         std::map<uint32_t, C_NodeCheckpoint>::const_iterator c_It;
+
+         c_Ini.WriteString(mhc_SECTION_JOURNAL, mhc_KEY_SYSTEM_IDENTITY, this->mc_SystemIdentity);
+         for (c_It = this->mc_Checkpoints.begin(); c_It != this->mc_Checkpoints.end(); ++c_It)
+         {
+            const C_SclString c_Section = mhc_SECTION_PREFIX + C_SclString::IntToStr(c_It->first);
+            c_Ini.WriteString(c_Section, mhc_KEY_DIGEST, c_It->second.c_PackageDigest);
+            c_Ini.WriteString(c_Section, mhc_KEY_SERIAL_NUMBER, c_It->second.c_SerialNumber);
+            c_Ini.WriteString(c_Section, mhc_KEY_FINGERPRINT, c_It->second.c_Fingerprint);
+         }
+         c_Ini.UpdateFile();
+      }
+      catch (...)
+      {
+         s32_Return = C_RD_WR;
+      }
+
+      if (s32_Return == C_NO_ERR)
+      {
+         //rename does not replace existing files on all platforms
+         if (TglFileExists(this->mc_FilePath) == true)
+         {
+            (void)std::remove(this->mc_FilePath.c_str());
+         }
+         if (std::rename(c_TempPath.c_str(), this->mc_FilePath.c_str()) != 0)
+         {
+            s32_Return = C_RD_WR;
+         }
+      }
+
+      if (s32_Return != C_NO_ERR)
+      {
+         osc_write_log_warning("System Update", "Could not write update checkpoint journal \"" +
+                               this->mc_FilePath + "\".");
+      }
+   }
+   return s32_Return;
+}
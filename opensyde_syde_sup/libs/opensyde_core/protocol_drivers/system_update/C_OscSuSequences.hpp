@@ -21,6 +21,7 @@
 #include "C_OscComFlashloaderInformation.hpp"
 #include "C_OscComSequencesBase.hpp"
 #include "C_OscSuSequencesNodeStates.hpp"
+#include "C_OscSuCheckpointJournal.hpp"
 #include "C_OscViewNodeUpdate.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
@@ -227,7 +228,9 @@ public:
       eRESET_SYSTEM_START,
       eRESET_SYSTEM_OSY_NODE_ERROR,
       eRESET_SYSTEM_OSY_ROUTED_NODE_ERROR,
-      eRESET_SYSTEM_FINISHED
+      eRESET_SYSTEM_FINISHED,
+
+      eUPDATE_SYSTEM_OSY_NODE_CHECKPOINT_SKIPPED //node was updated completely by an interrupted previous run
    };
 
    C_OscSuSequences(void);
@@ -248,6 +251,8 @@ public:
                         const std::vector<uint32_t> & orc_NodesOrder);
    int32_t ResetSystem(void);
 
+   void SetCheckpointJournal(C_OscSuCheckpointJournal * const opc_Journal);
+
    virtual int32_t GetConnectStates(std::vector<C_OscSuSequencesNodeConnectStates> & orc_ConnectStatesNodes)
    const;
    virtual int32_t GetUpdateStates(std::vector<C_OscSuSequencesNodeUpdateStates> & orc_UpdateStatesNodes)
@@ -291,6 +296,8 @@ private:
    std::vector<C_OscSuSequencesNodeConnectStates> mc_ConnectStatesNodes;
    std::vector<C_OscSuSequencesNodeUpdateStates> mc_UpdateStatesNodes;
 
+   C_OscSuCheckpointJournal * mpc_CheckpointJournal; ///< optional journal of finished nodes (NULL: not used)
+
    int32_t m_FlashNodeOpenSydeHex(const std::vector<stw::scl::C_SclString> & orc_FilesToFlash,
                                   const std::vector<stw::scl::C_SclString> & orc_OtherAcceptedDeviceNames,
                                   const uint32_t ou32_RequestDownloadTimeout, const uint32_t ou32_TransferDataTimeout,
@@ -324,6 +331,20 @@ private:
 
    int32_t m_WriteFingerPrintOsy(void);
 
+   static stw::scl::C_SclString mh_GetCheckpointDigest(const C_OscNode & orc_Node,
+                                                       const C_DoFlash & orc_ApplicationsToWrite);
+   static bool mh_AddFilesToCheckpointDigest(const stw::scl::C_SclString & orc_Category,
+                                             const std::vector<stw::scl::C_SclString> & orc_Files,
+                                             stw::scl::C_SclString & orc_Content);
+   int32_t m_ReadCheckpointFingerprintOsy(const uint32_t ou32_NodeIndex,
+                                          const C_OscProtocolDriverOsy::C_ListOfFeatures & orc_ProtocolFeatures,
+                                          stw::scl::C_SclString & orc_SerialNumber,
+                                          stw::scl::C_SclString & orc_Fingerprint);
+   bool m_IsNodeCheckpointValid(const uint32_t ou32_NodeIndex, const C_DoFlash & orc_ApplicationsToWrite,
+                                const C_OscProtocolDriverOsy::C_ListOfFeatures & orc_ProtocolFeatures);
+   void m_WriteNodeCheckpoint(const uint32_t ou32_NodeIndex, const C_DoFlash & orc_ApplicationsToWrite,
+                              const C_OscProtocolDriverOsy::C_ListOfFeatures & orc_ProtocolFeatures);
+
    int32_t m_FlashNodeXfl(const std::vector<stw::scl::C_SclString> & orc_FilesToFlash,
                           std::vector<C_OscSuSequencesNodeStwFlHexFileStates> & orc_StateHexFiles);
 
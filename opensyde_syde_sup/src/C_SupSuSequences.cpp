@@ -424,6 +424,7 @@ bool C_SupSuSequences::m_CheckErrorCase(const C_OscSuSequences::E_ProgressStep o
    case C_OscSuSequences::eUPDATE_SYSTEM_XFL_NODE_FINISHED:
    case C_OscSuSequences::eRESET_SYSTEM_START:
    case C_OscSuSequences::eRESET_SYSTEM_FINISHED:
+   case C_OscSuSequences::eUPDATE_SYSTEM_OSY_NODE_CHECKPOINT_SKIPPED:
    default:
       break;
    }
@@ -794,6 +795,9 @@ C_SclString C_SupSuSequences::m_GetStepName(const E_ProgressStep oe_Step) const
    case eRESET_SYSTEM_FINISHED:
       c_Text = "Reset System - Finished";
       break;
+   case eUPDATE_SYSTEM_OSY_NODE_CHECKPOINT_SKIPPED:
+      c_Text = "Update System - Node already updated by previous update run; skipped";
+      break;
    default:
       c_Text = "Unknown Step - How did you get here?";
       break;
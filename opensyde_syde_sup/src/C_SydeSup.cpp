@@ -31,6 +31,8 @@
 #include "C_SupCreatePackage.hpp"
 #include "C_OscBinaryHash.hpp"
 #include "C_OscHexFile.hpp"
+#include "C_OscSuCheckpointJournal.hpp"
+#include "C_Md5Checksum.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 using namespace stw::errors;
@@ -70,7 +72,8 @@ C_SydeSup::C_SydeSup(void) :
    mc_CertFolderPath(""),
    mc_OsyProjectPath(""),
    mc_ViewName(""),
-   mc_DeviceDefPath("")
+   mc_DeviceDefPath(""),
+   mc_JournalPath("")
 
 {
 }
@@ -105,6 +108,7 @@ C_SydeSup::~C_SydeSup(void)
    * -s for openSYDE project file path
    * -d for device definition file path
    * -w for view name
+   * -j for path to update checkpoint journal (optional)
 
    \param[in]  os32_Argc   number of command line arguments
    \param[in]  oppcn_Argv  command line arguments
@@ -178,6 +182,9 @@ C_SydeSup::E_Result C_SydeSup::ParseCommandLine(const int32_t os32_Argc, char_t
       {
          "password",          required_argument,   NULL,    'x'
       },
+      {
+         "journal",           required_argument,   NULL,    'j'
+      },
       {
          NULL,                0,                   NULL,    0
       }
@@ -186,7 +193,7 @@ C_SydeSup::E_Result C_SydeSup::ParseCommandLine(const int32_t os32_Argc, char_t
    do
    {
       int32_t s32_Index;
-      s32_Result = getopt_long(os32_Argc, oppcn_Argv, "hmvqnp:o:i:z:l:c:s:w:d:k:x:", &ac_Options[0], &s32_Index);
+      s32_Result = getopt_long(os32_Argc, oppcn_Argv, "hmvqnp:o:i:z:l:c:s:w:d:k:x:j:", &ac_Options[0], &s32_Index);
       if (s32_Result != -1)
       {
          switch (s32_Result)
@@ -240,6 +247,9 @@ C_SydeSup::E_Result C_SydeSup::ParseCommandLine(const int32_t os32_Argc, char_t
          case 'x':
             mc_Password = optarg;
             break;
+         case 'j':
+            mc_JournalPath = optarg;
+            break;
          case '?': //parser reports error (missing parameter option)
             q_ParseError = true;
             break;
@@ -930,11 +940,14 @@ void C_SydeSup::m_PrintInformation(const bool oq_Detailed) const
       "-w     --systemview        Name of view in openSYDE project                <none>          -w ViewCAN1\n"
       "-k     --publickey         Path to pem file with public key                <none>          -k public_crt.pem\n"
       "-x     --password          Password for the encrypted Update Package       <none>          -x unh4ckab1e\n"
+      "-j     --journal           Update checkpoint journal to resume an update   <none>          -j journal.ini\n"
       "The package file parameter \"-p\" is mandatory, all others are optional.\n"
       "If in update mode the active bus in the given Service Update Package is of CAN type, a CAN interface must be provided.\n"
       "In createpackage mode the parameters opensydeproject, systemview and devicedefinition are mandatory.\n"
       "If a Secure Update Package shall be loaded the parameter \"-k\" is mandatory."
-      "The parameter \"-x\" for a password is not allowed without the parameter \"-k\"." << &std::endl;
+      "The parameter \"-x\" for a password is not allowed without the parameter \"-k\".\n"
+      "With a journal file \"-j\" nodes completely updated by an interrupted previous run of the same package "
+      "are skipped." << &std::endl;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -1521,7 +1534,25 @@ int32_t C_SydeSup::m_UpdateSystem(C_SupSuSequences & orc_Sequence, const C_OscSy
 
    if ((s32_Result == C_NO_ERR) || (s32_Result == C_WARN))
    {
+      // the journal is keyed by the package content so checkpoints of another package are never reused
+      C_OscSuCheckpointJournal c_Journal;
+      const bool q_UseJournal = (this->mc_JournalPath != "");
+
+      if (q_UseJournal == true)
+      {
+         if (c_Journal.Open(this->mc_JournalPath,
+                            stw::md5::C_Md5Checksum::GetMD5(this->mc_SupFilePath).UpperCase()) != C_NO_ERR)
+         {
+            h_WriteLog("Update System", "Could not load update checkpoints from \"" + this->mc_JournalPath + "\".",
+                       false, this->mq_Quiet);
+         }
+         orc_Sequence.SetCheckpointJournal(&c_Journal);
+      }
       s32_Result = orc_Sequence.UpdateSystem(orc_ApplicationsToWrite, orc_NodesUpdateOrder);
+      if (q_UseJournal == true)
+      {
+         orc_Sequence.SetCheckpointJournal(NULL);
+      }
    }
    return s32_Result;
 }
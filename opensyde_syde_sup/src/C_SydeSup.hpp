@@ -128,6 +128,7 @@ protected:
    stw::scl::C_SclString mc_DeviceDefPath;
    stw::scl::C_SclString mc_PubKeyPemPath; //path to pem file with public key in case of secure update package
    stw::scl::C_SclString mc_Password; //optional password if the secure update package is also encrypted
+   stw::scl::C_SclString mc_JournalPath; //optional path to update checkpoint journal for resuming an interrupted update
 
    C_SydeSup::E_Result m_InitOptionalParameters(void);
 
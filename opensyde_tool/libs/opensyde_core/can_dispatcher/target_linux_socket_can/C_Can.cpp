@@ -174,19 +174,7 @@ int32_t C_Can::CAN_Init(const C_SclString & orc_InterfaceName, const int32_t os3
 
          setsockopt(s, SOL_CAN_RAW, CAN_RAW_FILTER, &rfilter, sizeof(rfilter));
          */
-         struct can_filter at_canFilter[1];
-
-         if (mu32_RXID == CAN_RX_ID_INVALID)
-         {
-            at_canFilter[0].can_id = 0;   // don't care
-            at_canFilter[0].can_mask = 0; // ALL frames will pass this filter
-         }
-         else
-         {
-            at_canFilter[0].can_id = mu32_RXID;
-            at_canFilter[0].can_mask = (mu32_RXID & 0x1fffffff) ? CAN_EFF_MASK : CAN_SFF_MASK;
-         }
-         if (setsockopt(ms32_Socket, SOL_CAN_RAW, CAN_RAW_FILTER, &at_canFilter, sizeof (at_canFilter)) == 0)
+         if (m_ApplyRxFilters() == C_NO_ERR)
          {
             t_addr.can_family = AF_CAN;
             // set the received index from the ioctl!!!
@@ -392,3 +380,101 @@ uint32_t C_Can::GetLimitRXID(void) const
 {
    return mu32_RXID;
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set receive filters applied by the kernel
+
+   A message is received if it passes at least one of the filters.
+   If the socket is already open the filters are applied immediately, else with the next call of CAN_Init.
+   Messages already received may still be read after the filters were changed.
+
+   \param[in]   orc_Filters   filters to apply; empty: use limit set by SetLimitRXID
+
+   \return
+   C_NO_ERR   filters set
+   C_RANGE    too many filters
+   C_CONFIG   filters could not be applied to the open socket
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_Can::SetRxFilters(const std::vector<C_CanRxFilter> & orc_Filters)
+{
+   int32_t s32_Return = C_NO_ERR;
+
+   if (orc_Filters.size() > hu32_MAX_RX_FILTERS)
+   {
+      s32_Return = C_RANGE;
+   }
+   else
+   {
+      mc_RxFilters = orc_Filters;
+      if (ms32_Socket >= 0)
+      {
+         s32_Return = m_ApplyRxFilters();
+      }
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Install the configured receive filters at the socket
+
+   \return
+   C_NO_ERR   filters installed
+   C_CONFIG   setsockopt failed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_Can::m_ApplyRxFilters(void) const
+{
+   int32_t s32_Return = C_NO_ERR;
+   std::vector<struct can_filter> c_CanFilters;
+
+   if (mc_RxFilters.empty() == true)
+   {
+      c_CanFilters.resize(1U);
+      if (mu32_RXID == CAN_RX_ID_INVALID)
+      {
+         c_CanFilters[0].can_id = 0;   // don't care
+         c_CanFilters[0].can_mask = 0; // ALL frames will pass this filter
+      }
+      else
+      {
+         c_CanFilters[0].can_id = mu32_RXID;
+         c_CanFilters[0].can_mask = (mu32_RXID & 0x1fffffff) ? CAN_EFF_MASK : CAN_SFF_MASK;
+      }
+   }
+   else
+   {
+      c_CanFilters.resize(mc_RxFilters.size());
+      for (uint32_t u32_Index = 0U; u32_Index < mc_RxFilters.size(); ++u32_Index)
+      {
+         const C_CanRxFilter & rc_Filter = mc_RxFilters[u32_Index];
+         const uint32_t u32_IdMask = (rc_Filter.q_XTD == true) ? CAN_EFF_MASK : CAN_SFF_MASK;
+
+         c_CanFilters[u32_Index].can_id = rc_Filter.u32_Code & u32_IdMask;
+         c_CanFilters[u32_Index].can_mask = rc_Filter.u32_Mask & u32_IdMask;
+         if (rc_Filter.q_XTD == true)
+         {
+            c_CanFilters[u32_Index].can_id |= CAN_EFF_FLAG;
+         }
+         if (rc_Filter.q_XTDMustMatch == true)
+         {
+            c_CanFilters[u32_Index].can_mask |= CAN_EFF_FLAG;
+         }
+         if (rc_Filter.q_RTR == true)
+         {
+            c_CanFilters[u32_Index].can_id |= CAN_RTR_FLAG;
+         }
+         if (rc_Filter.q_RTRMustMatch == true)
+         {
+            c_CanFilters[u32_Index].can_mask |= CAN_RTR_FLAG;
+         }
+      }
+   }
+
+   if (setsockopt(ms32_Socket, SOL_CAN_RAW, CAN_RAW_FILTER, &c_CanFilters[0],
+                  static_cast<socklen_t>(c_CanFilters.size() * sizeof(struct can_filter))) != 0)
+   {
+      s32_Return = C_CONFIG;
+   }
+   return s32_Return;
+}
@@ -13,6 +13,7 @@
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include <sys/time.h>
+#include <vector>
 
 #include "stwtypes.hpp"
 #include "C_CanDispatcher.hpp"
@@ -40,8 +41,10 @@ private:
    int32_t ms32_RxTimeout;
    uint32_t mu32_RXID;
    stw::scl::C_SclString mc_CanIfName;
+   std::vector<C_CanRxFilter> mc_RxFilters; // kernel receive filters; empty: use mu32_RXID
 
    void m_InitClass(const uint8_t ou8_CommChannel);
+   int32_t m_ApplyRxFilters(void) const;
 
 protected:
    //function from Dispatcher (mandatory to implement)
@@ -72,6 +75,11 @@ public:
 
    void SetLimitRXID(const uint32_t ou32_LimitRXID);
    uint32_t GetLimitRXID(void) const;
+
+   // Let the kernel discard messages not passing any of the filters (replaces the limit set by SetLimitRXID)
+   int32_t SetRxFilters(const std::vector<C_CanRxFilter> & orc_Filters);
+
+   static const uint32_t hu32_MAX_RX_FILTERS = 512U; // CAN_RAW_FILTER_MAX of the kernel
 };
 
 /* -- Global Variables ---------------------------------------------------------------------------------------------- */
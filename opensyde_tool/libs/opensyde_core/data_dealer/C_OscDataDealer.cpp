@@ -6,6 +6,9 @@
    Its main job is to place incoming data into the data pool.
    The application is responsible to not "::Cycle" and poll at the same time from different threads.
 
+   The values of the installed node are only accessed with the values lock of the node acquired, as the node
+   is usually shared with the application (see C_OscNode::GetValuesLock).
+
    \copyright   Copyright 2017 Sensor-Technik Wiedemann GmbH. All rights reserved.
 */
 //----------------------------------------------------------------------------------------------------------------------
@@ -180,6 +183,7 @@ int32_t C_OscDataDealer::DataPoolRead(const uint8_t ou8_DataPoolIndex, const uin
                //size OK
                //convert to native endianness depending on the type ...
                //no possible problem we did not check for already ...
+               this->m_LockNodeValues();
                if (mpc_DiagProtocol->GetEndianness() == C_OscDiagProtocolBase::mhu8_ENDIANNESS_BIG)
                {
                   (void)pc_Element->c_Value.SetValueFromBigEndianBlob(c_Data);
@@ -188,6 +192,7 @@ int32_t C_OscDataDealer::DataPoolRead(const uint8_t ou8_DataPoolIndex, const uin
                {
                   (void)pc_Element->c_Value.SetValueFromLittleEndianBlob(c_Data);
                }
+               this->m_UnlockNodeValues();
             }
          }
       }
@@ -254,6 +259,7 @@ int32_t C_OscDataDealer::DataPoolWrite(const uint8_t ou8_DataPoolIndex, const ui
          else
          {
             //convert native to protocol endianness depending on the type ...
+            this->m_LockNodeValues();
             if (mpc_DiagProtocol->GetEndianness() == C_OscDiagProtocolBase::mhu8_ENDIANNESS_BIG)
             {
                pc_Element->c_Value.GetValueAsBigEndianBlob(c_Data);
@@ -262,6 +268,7 @@ int32_t C_OscDataDealer::DataPoolWrite(const uint8_t ou8_DataPoolIndex, const ui
             {
                pc_Element->c_Value.GetValueAsLittleEndianBlob(c_Data);
             }
+            this->m_UnlockNodeValues();
 
             //use communication function matching the element type
             if (pc_Element->GetArray() == false)
@@ -280,6 +287,207 @@ int32_t C_OscDataDealer::DataPoolWrite(const uint8_t ou8_DataPoolIndex, const ui
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read a list of elements from server's data pools
+
+   Same as calling DataPoolRead for each element, but the protocol driver may keep several requests outstanding
+   at the same time. So reading long lists is not dominated by the round trip time of each single request.
+   Elements which do not exist in the local data pools are not requested.
+
+   \param[in]   orc_ElementIds   Elements to read; must be elements of the node of this data dealer
+   \param[out]  orc_Results      Result per element (same values as returned by DataPoolRead;
+                                 C_RANGE if the element is not part of the node of this data dealer)
+   \param[out]  orc_NrCodes      Negative response code per element in case of an error response
+
+   \return
+   C_NO_ERR    all elements read and placed in data pool
+   C_CONFIG    no node or diagnostic protocol are known (was this class properly Initialize()d ?)
+   C_WARN      at least one element could not be read (see orc_Results)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscDataDealer::DataPoolReadBatch(const std::vector<C_OscNodeDataPoolListElementId> & orc_ElementIds,
+                                           std::vector<int32_t> & orc_Results, std::vector<uint8_t> & orc_NrCodes)
+{
+   int32_t s32_Retval = C_NO_ERR;
+
+   orc_Results.assign(orc_ElementIds.size(), C_CONFIG);
+   orc_NrCodes.assign(orc_ElementIds.size(), 0U);
+
+   if ((mpc_Node == NULL) || (mpc_DiagProtocol == NULL))
+   {
+      s32_Retval = C_CONFIG;
+   }
+   else
+   {
+      std::vector<C_OscProtocolDataPoolAccess> c_Accesses;
+      std::vector<uint32_t> c_AccessIdIndexes;
+
+      c_Accesses.reserve(orc_ElementIds.size());
+      c_AccessIdIndexes.reserve(orc_ElementIds.size());
+      for (uint32_t u32_It = 0U; u32_It < orc_ElementIds.size(); ++u32_It)
+      {
+         const C_OscNodeDataPoolListElementId & rc_Id = orc_ElementIds[u32_It];
+         const C_OscNodeDataPoolListElement * const pc_Element =
+            this->mpc_Node->GetDataPoolListElement(rc_Id.u32_DataPoolIndex, rc_Id.u32_ListIndex,
+                                                   rc_Id.u32_ElementIndex);
+         if ((pc_Element == NULL) || (rc_Id.u32_NodeIndex != this->mu32_NodeIndex))
+         {
+            orc_Results[u32_It] = C_RANGE;
+         }
+         else
+         {
+            C_OscProtocolDataPoolAccess c_Access(static_cast<uint8_t>(rc_Id.u32_DataPoolIndex),
+                                                 static_cast<uint16_t>(rc_Id.u32_ListIndex),
+                                                 static_cast<uint16_t>(rc_Id.u32_ElementIndex));
+            // Set the expected size. It will be checked in the read functions.
+            c_Access.q_IsArray = pc_Element->GetArray();
+            c_Access.c_Data.resize(pc_Element->GetSizeByte());
+            c_Accesses.push_back(c_Access);
+            c_AccessIdIndexes.push_back(u32_It);
+         }
+      }
+
+      (void)mpc_DiagProtocol->DataPoolReadBatch(c_Accesses);
+
+      for (uint32_t u32_It = 0U; u32_It < c_Accesses.size(); ++u32_It)
+      {
+         const C_OscProtocolDataPoolAccess & rc_Access = c_Accesses[u32_It];
+         const uint32_t u32_IdIndex = c_AccessIdIndexes[u32_It];
+         int32_t s32_Return = rc_Access.s32_Result;
+
+         if (s32_Return == C_NO_ERR)
+         {
+            C_OscNodeDataPoolListElement * const pc_Element =
+               this->mpc_Node->GetDataPoolListElement(rc_Access.u8_DataPoolIndex, rc_Access.u16_ListIndex,
+                                                      rc_Access.u16_ElementIndex);
+            //we have data: is the size as expected ?
+            if ((pc_Element == NULL) || (rc_Access.c_Data.size() != pc_Element->GetSizeByte()))
+            {
+               s32_Return = C_OVERFLOW;
+            }
+            else
+            {
+               //convert to native endianness depending on the type ...
+               this->m_LockNodeValues();
+               if (mpc_DiagProtocol->GetEndianness() == C_OscDiagProtocolBase::mhu8_ENDIANNESS_BIG)
+               {
+                  (void)pc_Element->c_Value.SetValueFromBigEndianBlob(rc_Access.c_Data);
+               }
+               else
+               {
+                  (void)pc_Element->c_Value.SetValueFromLittleEndianBlob(rc_Access.c_Data);
+               }
+               this->m_UnlockNodeValues();
+            }
+         }
+         orc_Results[u32_IdIndex] = s32_Return;
+         orc_NrCodes[u32_IdIndex] = rc_Access.u8_NrCode;
+      }
+
+      for (uint32_t u32_It = 0U; u32_It < orc_Results.size(); ++u32_It)
+      {
+         if (orc_Results[u32_It] != C_NO_ERR)
+         {
+            s32_Retval = C_WARN;
+         }
+      }
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write a list of elements to server's data pools
+
+   Same as calling DataPoolWrite for each element, but the protocol driver may keep several requests outstanding
+   at the same time. The elements are sent in the order of the list.
+   Elements which do not exist or whose value is out of the defined min/max range are not sent.
+
+   \param[in]   orc_ElementIds   Elements to write; must be elements of the node of this data dealer
+   \param[out]  orc_Results      Result per element (same values as returned by DataPoolWrite;
+                                 C_RANGE if the element is not part of the node of this data dealer)
+   \param[out]  orc_NrCodes      Negative response code per element in case of an error response
+
+   \return
+   C_NO_ERR    all elements written to server
+   C_CONFIG    no node or diagnostic protocol are known (was this class properly Initialize()d ?)
+   C_WARN      at least one element could not be written (see orc_Results)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscDataDealer::DataPoolWriteBatch(const std::vector<C_OscNodeDataPoolListElementId> & orc_ElementIds,
+                                            std::vector<int32_t> & orc_Results, std::vector<uint8_t> & orc_NrCodes)
+{
+   int32_t s32_Retval = C_NO_ERR;
+
+   orc_Results.assign(orc_ElementIds.size(), C_CONFIG);
+   orc_NrCodes.assign(orc_ElementIds.size(), 0U);
+
+   if ((mpc_Node == NULL) || (mpc_DiagProtocol == NULL))
+   {
+      s32_Retval = C_CONFIG;
+   }
+   else
+   {
+      std::vector<C_OscProtocolDataPoolAccess> c_Accesses;
+      std::vector<uint32_t> c_AccessIdIndexes;
+
+      c_Accesses.reserve(orc_ElementIds.size());
+      c_AccessIdIndexes.reserve(orc_ElementIds.size());
+      for (uint32_t u32_It = 0U; u32_It < orc_ElementIds.size(); ++u32_It)
+      {
+         const C_OscNodeDataPoolListElementId & rc_Id = orc_ElementIds[u32_It];
+         const C_OscNodeDataPoolListElement * const pc_Element =
+            this->mpc_Node->GetDataPoolListElement(rc_Id.u32_DataPoolIndex, rc_Id.u32_ListIndex,
+                                                   rc_Id.u32_ElementIndex);
+         if ((pc_Element == NULL) || (rc_Id.u32_NodeIndex != this->mu32_NodeIndex))
+         {
+            orc_Results[u32_It] = C_RANGE;
+         }
+         //is the value within the defines min/max ranges ?
+         else if (pc_Element->CheckValueRange() != C_NO_ERR)
+         {
+            orc_Results[u32_It] = C_OVERFLOW;
+         }
+         else
+         {
+            C_OscProtocolDataPoolAccess c_Access(static_cast<uint8_t>(rc_Id.u32_DataPoolIndex),
+                                                 static_cast<uint16_t>(rc_Id.u32_ListIndex),
+                                                 static_cast<uint16_t>(rc_Id.u32_ElementIndex));
+            c_Access.q_IsArray = pc_Element->GetArray();
+            //convert native to protocol endianness depending on the type ...
+            this->m_LockNodeValues();
+            if (mpc_DiagProtocol->GetEndianness() == C_OscDiagProtocolBase::mhu8_ENDIANNESS_BIG)
+            {
+               pc_Element->c_Value.GetValueAsBigEndianBlob(c_Access.c_Data);
+            }
+            else
+            {
+               pc_Element->c_Value.GetValueAsLittleEndianBlob(c_Access.c_Data);
+            }
+            this->m_UnlockNodeValues();
+            c_Accesses.push_back(c_Access);
+            c_AccessIdIndexes.push_back(u32_It);
+         }
+      }
+
+      (void)mpc_DiagProtocol->DataPoolWriteBatch(c_Accesses);
+
+      for (uint32_t u32_It = 0U; u32_It < c_Accesses.size(); ++u32_It)
+      {
+         orc_Results[c_AccessIdIndexes[u32_It]] = c_Accesses[u32_It].s32_Result;
+         orc_NrCodes[c_AccessIdIndexes[u32_It]] = c_Accesses[u32_It].u8_NrCode;
+      }
+
+      for (uint32_t u32_It = 0U; u32_It < orc_Results.size(); ++u32_It)
+      {
+         if (orc_Results[u32_It] != C_NO_ERR)
+         {
+            s32_Retval = C_WARN;
+         }
+      }
+   }
+   return s32_Retval;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Read data from server's NVM
 
@@ -340,6 +548,7 @@ int32_t C_OscDataDealer::NvmRead(const uint8_t ou8_DataPoolIndex, const uint16_t
             //we have data
             //convert to native endianness depending on the type ...
             //no possible problem we did not check for already ...
+            this->m_LockNodeValues();
             if (mpc_DiagProtocol->GetEndianness() == C_OscDiagProtocolBase::mhu8_ENDIANNESS_BIG)
             {
                (void)pc_Element->c_NvmValue.SetValueFromBigEndianBlob(c_Data);
@@ -348,6 +557,7 @@ int32_t C_OscDataDealer::NvmRead(const uint8_t ou8_DataPoolIndex, const uint16_t
             {
                (void)pc_Element->c_NvmValue.SetValueFromLittleEndianBlob(c_Data);
             }
+            this->m_UnlockNodeValues();
          }
       }
    }
@@ -420,6 +630,7 @@ int32_t C_OscDataDealer::NvmWrite(const uint8_t ou8_DataPoolIndex, const uint16_
          else
          {
             //convert native to protocol endianness depending on the type ...
+            this->m_LockNodeValues();
             if (mpc_DiagProtocol->GetEndianness() == C_OscDiagProtocolBase::mhu8_ENDIANNESS_BIG)
             {
                pc_Element->c_NvmValue.GetValueAsBigEndianBlob(c_Data);
@@ -428,6 +639,7 @@ int32_t C_OscDataDealer::NvmWrite(const uint8_t ou8_DataPoolIndex, const uint16_
             {
                pc_Element->c_NvmValue.GetValueAsLittleEndianBlob(c_Data);
             }
+            this->m_UnlockNodeValues();
 
             //write data to server:
             s32_Return = mpc_DiagProtocol->NvmWrite(pc_Element->u32_NvmStartAddress, c_Data, opu8_NrCode);
@@ -460,6 +672,31 @@ void C_OscDataDealer::m_OnReadDataPoolEventReceived(const uint8_t ou8_DataPoolIn
    osc_write_log_warning("Asynchronous communication", c_Info);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Handler for raw value of async response
+
+   Called by the DataDealer before it places the data in the data pool content structure.
+   Allows recording the values without converting them.
+
+   Default implementation: nothing to do
+
+   \param[in]  ou8_DataPoolIndex   data pool index that data was received for
+   \param[in]  ou16_ListIndex      list index that data was received for
+   \param[in]  ou16_ElementIndex   element index that data was received for
+   \param[in]  orc_Value           raw value in endianness of protocol (size of element)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDataDealer::m_OnReadDataPoolEventValueReceived(const uint8_t ou8_DataPoolIndex,
+                                                         const uint16_t ou16_ListIndex,
+                                                         const uint16_t ou16_ElementIndex,
+                                                         const std::vector<uint8_t> & orc_Value)
+{
+   (void)ou8_DataPoolIndex;
+   (void)ou16_ListIndex;
+   (void)ou16_ElementIndex;
+   (void)orc_Value;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Handler for reception of async error response
 
@@ -506,6 +743,33 @@ void C_OscDataDealer::m_OnReadDataPoolNvmEventReceived(const uint8_t ou8_DataPoo
    osc_write_log_warning("Asynchronous communication", c_Info);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Acquire the values lock of the installed node
+
+   Needs to be held while accessing c_Value, c_NvmValue or the NVM flags of the node's Datapool elements.
+   The lock only covers the installed node; data dealers of other nodes are not blocked.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDataDealer::m_LockNodeValues(void) const
+{
+   if (this->mpc_Node != NULL)
+   {
+      this->mpc_Node->GetValuesLock().Acquire();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Release the values lock of the installed node
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDataDealer::m_UnlockNodeValues(void) const
+{
+   if (this->mpc_Node != NULL)
+   {
+      this->mpc_Node->GetValuesLock().Release();
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Initialization of the data dealer
 */
@@ -609,19 +873,29 @@ void C_OscDataDealer::m_ReadDataPoolDataEventReceived(const uint8_t ou8_DataPool
          else
          {
             //size OK; cut off potential cruft
-            std::vector<uint8_t> c_Data = orc_Value;
-            c_Data.resize(pc_Element->GetSizeByte());
+            //only copy if there is cruft; events can arrive at high rates
+            std::vector<uint8_t> c_Data;
+            const std::vector<uint8_t> * pc_Data = &orc_Value;
+            if (orc_Value.size() > pc_Element->GetSizeByte())
+            {
+               c_Data.assign(orc_Value.begin(), orc_Value.begin() + pc_Element->GetSizeByte());
+               pc_Data = &c_Data;
+            }
+
+            m_OnReadDataPoolEventValueReceived(ou8_DataPoolIndex, ou16_ListIndex, ou16_ElementIndex, *pc_Data);
 
             //convert to native endianness depending on the type ...
             //no possible problem we did not check for already ...
+            this->m_LockNodeValues();
             if (mpc_DiagProtocol->GetEndianness() == C_OscDiagProtocolBase::mhu8_ENDIANNESS_BIG)
             {
-               (void)pc_Element->c_Value.SetValueFromBigEndianBlob(c_Data);
+               (void)pc_Element->c_Value.SetValueFromBigEndianBlob(*pc_Data);
             }
             else
             {
-               (void)pc_Element->c_Value.SetValueFromLittleEndianBlob(c_Data);
+               (void)pc_Element->c_Value.SetValueFromLittleEndianBlob(*pc_Data);
             }
+            this->m_UnlockNodeValues();
             //inform application
             m_OnReadDataPoolEventReceived(ou8_DataPoolIndex, ou16_ListIndex, ou16_ElementIndex);
          }
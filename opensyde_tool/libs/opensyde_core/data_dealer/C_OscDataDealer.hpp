@@ -17,6 +17,7 @@
 #include "stwtypes.hpp"
 
 #include "C_OscNode.hpp"
+#include "C_OscNodeDataPoolListElementId.hpp"
 #include "C_OscDiagProtocolBase.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
@@ -45,6 +46,10 @@ public:
                                 const uint16_t ou16_ElementIndex, uint8_t * const opu8_NrCode);
    int32_t DataPoolWrite(const uint8_t ou8_DataPoolIndex, const uint16_t ou16_ListIndex,
                          const uint16_t ou16_ElementIndex, uint8_t * const opu8_NrCode);
+   virtual int32_t DataPoolReadBatch(const std::vector<C_OscNodeDataPoolListElementId> & orc_ElementIds,
+                                     std::vector<int32_t> & orc_Results, std::vector<uint8_t> & orc_NrCodes);
+   int32_t DataPoolWriteBatch(const std::vector<C_OscNodeDataPoolListElementId> & orc_ElementIds,
+                              std::vector<int32_t> & orc_Results, std::vector<uint8_t> & orc_NrCodes);
    virtual int32_t NvmRead(const uint8_t ou8_DataPoolIndex, const uint16_t ou16_ListIndex,
                            const uint16_t ou16_ElementIndex, uint8_t * const opu8_NrCode);
    int32_t NvmWrite(const uint8_t ou8_DataPoolIndex, const uint16_t ou16_ListIndex, const uint16_t ou16_ElementIndex,
@@ -55,6 +60,10 @@ protected:
    // the installed node.
    virtual void m_OnReadDataPoolEventReceived(const uint8_t ou8_DataPoolIndex, const uint16_t ou16_ListIndex,
                                               const uint16_t ou16_ElementIndex);
+   //Called by the DataDealer with the raw value (protocol endianness) before it is placed in the data pool.
+   virtual void m_OnReadDataPoolEventValueReceived(const uint8_t ou8_DataPoolIndex, const uint16_t ou16_ListIndex,
+                                                   const uint16_t ou16_ElementIndex,
+                                                   const std::vector<uint8_t> & orc_Value);
    //called by the DataDealer after it has received an error response for a cyclic transmission.
    virtual void m_OnReadDataPoolEventErrorReceived(const uint8_t ou8_DataPoolIndex, const uint16_t ou16_ListIndex,
                                                    const uint16_t ou16_ElementIndex, const uint8_t ou8_ErrorCode);
@@ -63,6 +72,9 @@ protected:
    virtual void m_OnReadDataPoolNvmEventReceived(const uint8_t ou8_DataPoolIndex, const uint16_t ou16_ListIndex,
                                                  const uint16_t ou16_ElementIndex);
 
+   void m_LockNodeValues(void) const;
+   void m_UnlockNodeValues(void) const;
+
    C_OscNode * mpc_Node;
    uint32_t mu32_NodeIndex;
    C_OscDiagProtocolBase * mpc_DiagProtocol;
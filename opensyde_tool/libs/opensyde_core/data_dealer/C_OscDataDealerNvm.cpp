@@ -96,6 +96,7 @@ uint16_t C_OscDataDealerNvm::NvmCalcCrc(const C_OscNodeDataPoolList & orc_List)
 
          //convert to native endianness depending on the type ...
          //no possible problem we did not check for already ...
+         this->m_LockNodeValues();
          if (u8_Endianness == C_OscDiagProtocolBase::mhu8_ENDIANNESS_BIG)
          {
             pc_Element->c_NvmValue.GetValueAsBigEndianBlob(c_Data);
@@ -104,6 +105,7 @@ uint16_t C_OscDataDealerNvm::NvmCalcCrc(const C_OscNodeDataPoolList & orc_List)
          {
             pc_Element->c_NvmValue.GetValueAsLittleEndianBlob(c_Data);
          }
+         this->m_UnlockNodeValues();
          stw::scl::C_SclChecksums::CalcCRC16(&c_Data[0], static_cast<uint32_t>(c_Data.size()), u16_Crc);
       }
    }
@@ -343,6 +345,7 @@ int32_t C_OscDataDealerNvm::m_SaveDumpValuesToListValues(std::vector<uint8_t> &
          //we have data
          //convert to native endianness depending on the type ...
          //no possible problem we did not check for already ...
+         this->m_LockNodeValues();
          if (this->mpc_DiagProtocol->GetEndianness() == C_OscDiagProtocolBase::mhu8_ENDIANNESS_BIG)
          {
             (void)pc_Element->c_NvmValue.SetValueFromBigEndianBlob(c_ElementData);
@@ -352,6 +355,7 @@ int32_t C_OscDataDealerNvm::m_SaveDumpValuesToListValues(std::vector<uint8_t> &
             (void)pc_Element->c_NvmValue.SetValueFromLittleEndianBlob(c_ElementData);
          }
          pc_Element->q_NvmValueIsValid = true;
+         this->m_UnlockNodeValues();
       }
       else
       {
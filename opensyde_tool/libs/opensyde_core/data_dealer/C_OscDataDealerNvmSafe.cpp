@@ -21,6 +21,9 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "precomp_headers.hpp"
 
+#include <algorithm>
+#include <cstring>
+
 #include "stwtypes.hpp"
 #include "stwerrors.hpp"
 #include "TglFile.hpp"
@@ -50,6 +53,81 @@ using namespace stw::opensyde_core;
 
 /* -- Implementation ------------------------------------------------------------------------------------------------ */
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set up class with all counters at zero
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscDataDealerNvmSafe::C_NvmAccessStatistics::C_NvmAccessStatistics(void)
+{
+   this->Clear();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Reset all counters
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDataDealerNvmSafe::C_NvmAccessStatistics::Clear(void)
+{
+   this->u32_ReadRequests = 0U;
+   this->u64_ReadBytes = 0U;
+   this->u32_WriteRequests = 0U;
+   this->u64_WriteBytes = 0U;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set up empty range
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscDataDealerNvmSafe::C_NvmRange::C_NvmRange(void) :
+   u32_StartAddress(0U),
+   u32_Size(0U),
+   u32_DataPoolIndex(0U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set up range covering one item
+
+   \param[in]  ou32_StartAddress    NVM address of first byte
+   \param[in]  ou32_Size            Number of bytes
+   \param[in]  ou32_DataPoolIndex   Index of the datapool of the item
+   \param[in]  ou32_Item            Index of the item (list or element) in the caller's list
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscDataDealerNvmSafe::C_NvmRange::C_NvmRange(const uint32_t ou32_StartAddress, const uint32_t ou32_Size,
+                                               const uint32_t ou32_DataPoolIndex, const uint32_t ou32_Item) :
+   u32_StartAddress(ou32_StartAddress),
+   u32_Size(ou32_Size),
+   u32_DataPoolIndex(ou32_DataPoolIndex)
+{
+   this->c_Items.push_back(ou32_Item);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Sort by address
+
+   \param[in]  orc_Cmp  Range compared to our instance
+
+   \return
+   true     current smaller than orc_Cmp
+   false    current equal or bigger than orc_Cmp
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscDataDealerNvmSafe::C_NvmRange::operator <(const C_NvmRange & orc_Cmp) const
+{
+   bool q_Return;
+
+   if (this->u32_StartAddress != orc_Cmp.u32_StartAddress)
+   {
+      q_Return = (this->u32_StartAddress < orc_Cmp.u32_StartAddress);
+   }
+   else
+   {
+      q_Return = (this->u32_Size < orc_Cmp.u32_Size);
+   }
+   return q_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Set up class
 
@@ -59,7 +137,9 @@ using namespace stw::opensyde_core;
 C_OscDataDealerNvmSafe::C_OscDataDealerNvmSafe(void) :
    C_OscDataDealerNvm(),
    me_CreateParameterSetWorkflowState(C_OscDataDealerNvmSafe::eCPSFS_IDLE),
-   me_ParameterSetFileState(C_OscDataDealerNvmSafe::ePSFS_IDLE)
+   me_ParameterSetFileState(C_OscDataDealerNvmSafe::ePSFS_IDLE),
+   mq_CoalesceNvmAccess(true),
+   mu32_MaxNvmReadGap(hu32_DEFAULT_NVM_READ_GAP)
 {
 }
 
@@ -77,7 +157,9 @@ C_OscDataDealerNvmSafe::C_OscDataDealerNvmSafe(C_OscNode * const opc_Node, const
                                                C_OscDiagProtocolBase * const opc_DiagProtocol) :
    C_OscDataDealerNvm(opc_Node, ou32_NodeIndex, opc_DiagProtocol),
    me_CreateParameterSetWorkflowState(C_OscDataDealerNvmSafe::eCPSFS_IDLE),
-   me_ParameterSetFileState(C_OscDataDealerNvmSafe::ePSFS_IDLE)
+   me_ParameterSetFileState(C_OscDataDealerNvmSafe::ePSFS_IDLE),
+   mq_CoalesceNvmAccess(true),
+   mu32_MaxNvmReadGap(hu32_DEFAULT_NVM_READ_GAP)
 {
 }
 
@@ -259,102 +341,122 @@ int32_t C_OscDataDealerNvmSafe::NvmSafeWriteChangedValues(
             if ((pc_DataPool->e_Type == C_OscNodeDataPool::eNVM) ||
                 (pc_DataPool->e_Type == C_OscNodeDataPool::eHALC_NVM))
             {
+               std::vector<C_OscNodeDataPoolListElementId> c_PlannedElements;
+               std::vector<C_NvmRange> c_Items;
                uint32_t u32_ListCounter;
                uint32_t u32_Elementcounter;
-               uint16_t u16_AccessCount = 0U;
 
-               // Count the changed elements
-               for (u32_ListCounter = 0U; u32_ListCounter < pc_DataPool->c_Lists.size(); ++u32_ListCounter)
+               // Collect the changed elements
+               for (u32_ListCounter = 0U;
+                    (u32_ListCounter < pc_DataPool->c_Lists.size()) && (s32_Return != C_OVERFLOW);
+                    ++u32_ListCounter)
                {
-                  for (u32_Elementcounter = 0U;
-                       u32_Elementcounter < pc_DataPool->c_Lists[u32_ListCounter].c_Elements.size();
-                       ++u32_Elementcounter)
+                  const C_OscNodeDataPoolList & rc_List = pc_DataPool->c_Lists[u32_ListCounter];
+
+                  c_ElementId.u32_ListIndex = u32_ListCounter;
+                  for (u32_Elementcounter = 0U; u32_Elementcounter < rc_List.c_Elements.size(); ++u32_Elementcounter)
                   {
-                     if (pc_DataPool->c_Lists[u32_ListCounter].c_Elements[u32_Elementcounter].q_NvmValueChanged == true)
+                     const C_OscNodeDataPoolListElement & rc_Element = rc_List.c_Elements[u32_Elementcounter];
+
+                     // Check range if value was changed
+                     if (rc_Element.q_NvmValueChanged == true)
                      {
-                        // Element was changed and must be written.
-                        ++u16_AccessCount;
+                        if (rc_Element.CheckNvmValueRange() == C_NO_ERR)
+                        {
+                           // Element was changed and must be written.
+                           c_ElementId.u32_ElementIndex = u32_Elementcounter;
+                           c_Items.push_back(C_NvmRange(rc_Element.u32_NvmStartAddress, rc_Element.GetSizeByte(),
+                                                        u32_DataPoolCounter,
+                                                        static_cast<uint32_t>(c_PlannedElements.size())));
+                           c_PlannedElements.push_back(c_ElementId);
+                        }
+                        else
+                        {
+                           s32_Return = C_OVERFLOW;
+                           break;
+                        }
                      }
                   }
                }
 
-               if (u16_AccessCount > 0U)
+               if ((s32_Return != C_OVERFLOW) && (c_Items.size() > 0U))
                {
+                  std::vector<C_NvmRange> c_Ranges;
+
+                  // Only directly adjacent elements are joined; there are no known values for any gaps
+                  this->m_PlanNvmRanges(c_Items, 0U, c_Ranges);
+
                   // Prepare the transaction for this datapool
                   s32_Return = this->mpc_DiagProtocol->NvmWriteStartTransaction(
                      static_cast<uint8_t>(u32_DataPoolCounter),
-                     u16_AccessCount);
+                     static_cast<uint16_t>(c_Ranges.size()));
                   if (s32_Return == C_NO_ERR)
                   {
-                     // Write the concrete elements
-                     for (u32_ListCounter = 0U; u32_ListCounter < pc_DataPool->c_Lists.size(); ++u32_ListCounter)
+                     // Write the ranges of concrete elements
+                     for (uint32_t u32_RangeCounter = 0U; u32_RangeCounter < c_Ranges.size(); ++u32_RangeCounter)
                      {
-                        C_OscNodeDataPoolList * const pc_List = &pc_DataPool->c_Lists[u32_ListCounter];
-                        C_OscNodeDataPoolListId c_ListId;
-
-                        c_ElementId.u32_ListIndex = u32_ListCounter;
-                        c_ListId = c_ElementId;
+                        const C_NvmRange & rc_Range = c_Ranges[u32_RangeCounter];
+                        std::vector<uint8_t> c_RangeData;
+                        uint32_t u32_ItemCounter;
 
-                        for (u32_Elementcounter = 0U;
-                             u32_Elementcounter < pc_List->c_Elements.size();
-                             ++u32_Elementcounter)
+                        c_RangeData.resize(rc_Range.u32_Size);
+                        for (u32_ItemCounter = 0U; u32_ItemCounter < rc_Range.c_Items.size(); ++u32_ItemCounter)
                         {
-                           C_OscNodeDataPoolListElement * const pc_Element = &pc_List->c_Elements[u32_Elementcounter];
-
-                           // Check range if value was changed
-                           if (pc_Element->q_NvmValueChanged == true)
+                           const C_OscNodeDataPoolListElementId & rc_Id =
+                              c_PlannedElements[rc_Range.c_Items[u32_ItemCounter]];
+                           const C_OscNodeDataPoolListElement & rc_Element =
+                              pc_DataPool->c_Lists[rc_Id.u32_ListIndex].c_Elements[rc_Id.u32_ElementIndex];
+                           const uint32_t u32_Offset = rc_Element.u32_NvmStartAddress - rc_Range.u32_StartAddress;
+                           std::vector<uint8_t> c_ElementData;
+
+                           //convert to native endianness depending on the type ...
+                           //no possible problem we did not check for already ...
+                           this->m_LockNodeValues();
+                           if (this->mpc_DiagProtocol->GetEndianness() == C_OscDiagProtocolBase::mhu8_ENDIANNESS_BIG)
                            {
-                              if (pc_Element->CheckNvmValueRange() == C_NO_ERR)
-                              {
-                                 std::vector<uint8_t> c_ElementData;
-
-                                 //convert to native endianness depending on the type ...
-                                 //no possible problem we did not check for already ...
-                                 if (this->mpc_DiagProtocol->GetEndianness() ==
-                                     C_OscDiagProtocolBase::mhu8_ENDIANNESS_BIG)
-                                 {
-                                    pc_Element->c_NvmValue.GetValueAsBigEndianBlob(c_ElementData);
-                                 }
-                                 else
-                                 {
-                                    pc_Element->c_NvmValue.GetValueAsLittleEndianBlob(c_ElementData);
-                                 }
+                              rc_Element.c_NvmValue.GetValueAsBigEndianBlob(c_ElementData);
+                           }
+                           else
+                           {
+                              rc_Element.c_NvmValue.GetValueAsLittleEndianBlob(c_ElementData);
+                           }
+                           this->m_UnlockNodeValues();
+                           if ((c_ElementData.size() > 0U) &&
+                               ((static_cast<size_t>(u32_Offset) + c_ElementData.size()) <= c_RangeData.size()))
+                           {
+                              (void)std::memcpy(&c_RangeData[u32_Offset], &c_ElementData[0], c_ElementData.size());
+                           }
+                        }
 
-                                 // Element value was changed and is valid
-                                 s32_Return =
-                                    this->mpc_DiagProtocol->NvmWrite(pc_Element->u32_NvmStartAddress, c_ElementData,
-                                                                     opu8_NrCode);
-                                 // Adapt errorcode
-                                 s32_Return = C_OscDataDealerNvm::mh_AdaptProtocolReturnValue(s32_Return);
+                        // Element values were changed and are valid
+                        this->mc_NvmAccessStatistics.u32_WriteRequests += this->m_GetNvmServiceCount(rc_Range.u32_Size);
+                        this->mc_NvmAccessStatistics.u64_WriteBytes += rc_Range.u32_Size;
+                        s32_Return = this->mpc_DiagProtocol->NvmWrite(rc_Range.u32_StartAddress, c_RangeData,
+                                                                      opu8_NrCode);
+                        // Adapt errorcode
+                        s32_Return = C_OscDataDealerNvm::mh_AdaptProtocolReturnValue(s32_Return);
 
-                                 if (s32_Return == C_NO_ERR)
-                                 {
-                                    // Element written
-                                    // Return the entire element id
-                                    c_ElementId.u32_ElementIndex = u32_Elementcounter;
-                                    orc_ChangedElements.push_back(c_ElementId);
+                        if (s32_Return == C_NO_ERR)
+                        {
+                           for (u32_ItemCounter = 0U; u32_ItemCounter < rc_Range.c_Items.size(); ++u32_ItemCounter)
+                           {
+                              const C_OscNodeDataPoolListElementId & rc_Id =
+                                 c_PlannedElements[rc_Range.c_Items[u32_ItemCounter]];
+                              const C_OscNodeDataPoolListId c_ListId = rc_Id;
 
-                                    // Reset the flag
-                                    pc_Element->q_NvmValueChanged = false;
+                              // Element written
+                              // Return the entire element id
+                              orc_ChangedElements.push_back(rc_Id);
 
-                                    // Save the list index as changed list. Will be used by NvmSafeReadValues.
-                                    this->mc_ChangedLists.insert(c_ListId);
-                                 }
-                              }
-                              else
-                              {
-                                 s32_Return = C_OVERFLOW;
-                              }
-                           }
+                              // Reset the flag
+                              pc_DataPool->c_Lists[rc_Id.u32_ListIndex].c_Elements[rc_Id.u32_ElementIndex].
+                              q_NvmValueChanged = false;
 
-                           if (s32_Return != C_NO_ERR)
-                           {
-                              // Service failed. Abort writing.
-                              break;
+                              // Save the list index as changed list. Will be used by NvmSafeReadValues.
+                              this->mc_ChangedLists.insert(c_ListId);
                            }
                         }
-
-                        if (s32_Return != C_NO_ERR)
+                        else
                         {
                            // Service failed. Abort writing.
                            break;
@@ -430,13 +532,19 @@ int32_t C_OscDataDealerNvmSafe::NvmSafeReadValues(const C_OscNode * (&orpc_NodeC
       s32_Return = C_RD_WR;
 
       // Copy the original instance
+      this->m_LockNodeValues();
       this->mc_NodeCopy = *this->mpc_Node;
+      this->m_UnlockNodeValues();
 
       if (this->mc_ChangedLists.size() > 0)
       {
          std::set<C_OscNodeDataPoolListId>::const_iterator c_ItChangedList;
+         std::vector<C_OscNodeDataPoolListId> c_PlannedLists;
+         std::vector<C_NvmRange> c_Items;
 
-         // Read all changed lists
+         s32_Return = C_NO_ERR;
+
+         // Check all changed lists before reading
          for (c_ItChangedList = this->mc_ChangedLists.begin();
               c_ItChangedList != this->mc_ChangedLists.end();
               ++c_ItChangedList)
@@ -448,7 +556,6 @@ int32_t C_OscDataDealerNvmSafe::NvmSafeReadValues(const C_OscNode * (&orpc_NodeC
                C_OscNodeDataPoolList & rc_List =
                   this->mc_NodeCopy.c_DataPools[(*c_ItChangedList).u32_DataPoolIndex].c_Lists[(*c_ItChangedList).
                                                                                               u32_ListIndex];
-               std::vector<uint8_t> c_Values;
                uint32_t u32_ElementCounter;
 
                // Reset of all valid flags
@@ -457,10 +564,60 @@ int32_t C_OscDataDealerNvmSafe::NvmSafeReadValues(const C_OscNode * (&orpc_NodeC
                   rc_List.c_Elements[u32_ElementCounter].q_NvmValueIsValid = false;
                }
 
-               s32_Return = this->m_NvmReadListRaw(rc_List, c_Values, opu8_NrCode);
+               // If CRC is active, at least 2 byte are necessary for the CRC (see m_NvmReadListRaw)
+               if ((rc_List.u32_NvmSize > 2U) ||
+                   ((rc_List.u32_NvmSize > 0U) && (rc_List.q_NvmCrcActive == false)))
+               {
+                  c_Items.push_back(C_NvmRange(rc_List.u32_NvmStartAddress, rc_List.GetNumBytesUsed(),
+                                               (*c_ItChangedList).u32_DataPoolIndex,
+                                               static_cast<uint32_t>(c_PlannedLists.size())));
+                  c_PlannedLists.push_back(*c_ItChangedList);
+               }
+               else
+               {
+                  s32_Return = C_OVERFLOW;
+               }
+            }
+            else
+            {
+               s32_Return = C_RANGE;
+            }
 
-               if (s32_Return == C_NO_ERR)
+            if (s32_Return != C_NO_ERR)
+            {
+               break;
+            }
+         }
+
+         if (s32_Return == C_NO_ERR)
+         {
+            std::vector<C_NvmRange> c_Ranges;
+
+            // Read all changed lists; lists of one datapool close to each other are read with one access
+            this->m_PlanNvmRanges(c_Items, this->mu32_MaxNvmReadGap, c_Ranges);
+            for (uint32_t u32_RangeCounter = 0U; u32_RangeCounter < c_Ranges.size(); ++u32_RangeCounter)
+            {
+               const C_NvmRange & rc_Range = c_Ranges[u32_RangeCounter];
+               std::vector<uint8_t> c_RangeData;
+
+               // Size is input parameter for NvmRead
+               c_RangeData.resize(rc_Range.u32_Size);
+               this->mc_NvmAccessStatistics.u32_ReadRequests += this->m_GetNvmServiceCount(rc_Range.u32_Size);
+               this->mc_NvmAccessStatistics.u64_ReadBytes += rc_Range.u32_Size;
+               s32_Return = this->mpc_DiagProtocol->NvmRead(rc_Range.u32_StartAddress, c_RangeData, opu8_NrCode);
+               // Adapt return value
+               s32_Return = C_OscDataDealerNvm::mh_AdaptProtocolReturnValue(s32_Return);
+
+               for (uint32_t u32_ItemCounter = 0U;
+                    (u32_ItemCounter < rc_Range.c_Items.size()) && (s32_Return == C_NO_ERR); ++u32_ItemCounter)
                {
+                  const C_OscNodeDataPoolListId & rc_Id = c_PlannedLists[rc_Range.c_Items[u32_ItemCounter]];
+                  C_OscNodeDataPoolList & rc_List =
+                     this->mc_NodeCopy.c_DataPools[rc_Id.u32_DataPoolIndex].c_Lists[rc_Id.u32_ListIndex];
+                  const std::vector<uint8_t>::const_iterator c_ItListStart =
+                     c_RangeData.begin() + (rc_List.u32_NvmStartAddress - rc_Range.u32_StartAddress);
+                  std::vector<uint8_t> c_Values(c_ItListStart, c_ItListStart + rc_List.GetNumBytesUsed());
+
                   // Store the read values into the copy without checking and updating the CRC.
                   // The valid flag will be set to true if the element was read
                   s32_Return = this->m_SaveDumpValuesToListValues(c_Values, rc_List);
@@ -471,15 +628,11 @@ int32_t C_OscDataDealerNvmSafe::NvmSafeReadValues(const C_OscNode * (&orpc_NodeC
                      s32_Return = C_RANGE;
                   }
                }
-            }
-            else
-            {
-               s32_Return = C_RANGE;
-            }
 
-            if (s32_Return != C_NO_ERR)
-            {
-               break;
+               if (s32_Return != C_NO_ERR)
+               {
+                  break;
+               }
             }
          }
       }
@@ -690,6 +843,48 @@ int32_t C_OscDataDealerNvmSafe::NvmSafeWriteCrcs(uint8_t * const opu8_NrCode)
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Configure joining of NVM accesses
+
+   Used by NvmSafeWriteChangedValues and NvmSafeReadValues.
+   If active:
+   * changed elements which are directly adjacent in NVM are written with one access
+   * changed lists are read with one access if the unused bytes between them do not exceed ou32_MaxReadGap
+   In both cases a joined access is only used if it does not need more protocol services than the separate accesses
+   (see C_OscDiagProtocolBase::GetNvmMaxBlockSize).
+   If not active each element is written and each list is read with its own access.
+
+   \param[in]  oq_Active         true: join accesses; false: one access per element / list
+   \param[in]  ou32_MaxReadGap   Maximum number of unused bytes read to join two lists
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDataDealerNvmSafe::SetNvmAccessCoalescing(const bool oq_Active, const uint32_t ou32_MaxReadGap)
+{
+   this->mq_CoalesceNvmAccess = oq_Active;
+   this->mu32_MaxNvmReadGap = ou32_MaxReadGap;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get counters of NVM services issued by NvmSafeWriteChangedValues and NvmSafeReadValues
+
+   \return
+   counters accumulated since construction or the last call of ClearNvmAccessStatistics
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_OscDataDealerNvmSafe::C_NvmAccessStatistics & C_OscDataDealerNvmSafe::GetNvmAccessStatistics(void) const
+{
+   return this->mc_NvmAccessStatistics;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Reset counters of NVM services
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDataDealerNvmSafe::ClearNvmAccessStatistics(void)
+{
+   this->mc_NvmAccessStatistics.Clear();
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Clear internally stored content
 */
@@ -1569,3 +1764,78 @@ int32_t C_OscDataDealerNvmSafe::m_CreateRawEntryAndPrepareInterpretedData(C_OscN
    }
    return s32_Retval;
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Plan NVM accesses for a set of items
+
+   Items are sorted by address. An item is joined with the preceding range if
+   * joining is active (see SetNvmAccessCoalescing)
+   * both belong to the same datapool, so a gap only covers the NVM area of that datapool's own lists
+   * the number of bytes between both does not exceed ou32_MaxGap
+   * the joined range does not need more protocol services than both on their own
+
+   \param[in,out]  orc_Items     Items to access (one range per item as created by the item constructor of C_NvmRange);
+                                 will be sorted by address
+   \param[in]      ou32_MaxGap   Maximum number of unused bytes between two joined items
+   \param[out]     orc_Ranges    Planned accesses in ascending address order
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDataDealerNvmSafe::m_PlanNvmRanges(std::vector<C_NvmRange> & orc_Items, const uint32_t ou32_MaxGap,
+                                             std::vector<C_NvmRange> & orc_Ranges) const
+{
+   orc_Ranges.clear();
+   orc_Ranges.reserve(orc_Items.size());
+   std::sort(orc_Items.begin(), orc_Items.end());
+
+   for (uint32_t u32_ItItem = 0U; u32_ItItem < orc_Items.size(); ++u32_ItItem)
+   {
+      const C_NvmRange & rc_Item = orc_Items[u32_ItItem];
+      bool q_Join = false;
+
+      if ((this->mq_CoalesceNvmAccess == true) && (orc_Ranges.size() > 0U) &&
+          (orc_Ranges.back().u32_DataPoolIndex == rc_Item.u32_DataPoolIndex))
+      {
+         const C_NvmRange & rc_Last = orc_Ranges.back();
+         const uint64_t u64_LastEnd = static_cast<uint64_t>(rc_Last.u32_StartAddress) + rc_Last.u32_Size;
+         const uint64_t u64_ItemEnd = static_cast<uint64_t>(rc_Item.u32_StartAddress) + rc_Item.u32_Size;
+         const uint64_t u64_JoinedSize = std::max(u64_LastEnd, u64_ItemEnd) - rc_Last.u32_StartAddress;
+
+         if ((static_cast<uint64_t>(rc_Item.u32_StartAddress) <= (u64_LastEnd + ou32_MaxGap)) &&
+             (u64_JoinedSize <= 0xFFFFFFFFUL) &&
+             (this->m_GetNvmServiceCount(static_cast<uint32_t>(u64_JoinedSize)) <=
+              (this->m_GetNvmServiceCount(rc_Last.u32_Size) + this->m_GetNvmServiceCount(rc_Item.u32_Size))))
+         {
+            C_NvmRange & rc_Joined = orc_Ranges.back();
+            rc_Joined.u32_Size = static_cast<uint32_t>(u64_JoinedSize);
+            rc_Joined.c_Items.insert(rc_Joined.c_Items.end(), rc_Item.c_Items.begin(), rc_Item.c_Items.end());
+            q_Join = true;
+         }
+      }
+
+      if (q_Join == false)
+      {
+         orc_Ranges.push_back(rc_Item);
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of protocol services needed to transfer a number of NVM bytes
+
+   \param[in]  ou32_Size   Number of bytes of one NvmRead or NvmWrite call
+
+   \return
+   Number of services
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscDataDealerNvmSafe::m_GetNvmServiceCount(const uint32_t ou32_Size) const
+{
+   const uint32_t u32_BlockSize = this->mpc_DiagProtocol->GetNvmMaxBlockSize();
+   uint32_t u32_Count = 1U;
+
+   if ((u32_BlockSize > 0U) && (ou32_Size > u32_BlockSize))
+   {
+      u32_Count = ((ou32_Size - 1U) / u32_BlockSize) + 1U;
+   }
+   return u32_Count;
+}
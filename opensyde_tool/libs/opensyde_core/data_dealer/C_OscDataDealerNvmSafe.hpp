@@ -13,6 +13,7 @@
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include <set>
+#include <vector>
 
 #include "C_OscDataDealerNvm.hpp"
 #include "C_OscParamSetHandler.hpp"
@@ -37,6 +38,19 @@ class C_OscDataDealerNvmSafe :
    public C_OscDataDealerNvm
 {
 public:
+   ///Counters of NVM services issued by this class (to compare access strategies)
+   class C_NvmAccessStatistics
+   {
+   public:
+      C_NvmAccessStatistics(void);
+      void Clear(void);
+
+      uint32_t u32_ReadRequests;  ///< Number of NVM read services
+      uint64_t u64_ReadBytes;     ///< Number of NVM bytes read (including gaps between coalesced lists)
+      uint32_t u32_WriteRequests; ///< Number of NVM write services
+      uint64_t u64_WriteBytes;    ///< Number of NVM bytes written
+   };
+
    C_OscDataDealerNvmSafe(void);
    C_OscDataDealerNvmSafe(C_OscNode * const opc_Node, const uint32_t ou32_NodeIndex,
                           C_OscDiagProtocolBase * const opc_DiagProtocol);
@@ -49,6 +63,12 @@ public:
    int32_t NvmSafeReadValues(const C_OscNode * (&orpc_NodeCopy), uint8_t * const opu8_NrCode);
    int32_t NvmSafeWriteCrcs(uint8_t * const opu8_NrCode);
 
+   void SetNvmAccessCoalescing(const bool oq_Active, const uint32_t ou32_MaxReadGap = hu32_DEFAULT_NVM_READ_GAP);
+   const C_NvmAccessStatistics & GetNvmAccessStatistics(void) const;
+   void ClearNvmAccessStatistics(void);
+
+   static const uint32_t hu32_DEFAULT_NVM_READ_GAP = 64U; ///< Default for unused bytes read to join two lists
+
    //Create file process
    void NvmSafeClearInternalContent(void);
    int32_t NvmSafeReadParameterValues(const std::vector<C_OscNodeDataPoolListId> & orc_ListIds,
@@ -65,6 +85,25 @@ public:
    int32_t NvmSafeWriteParameterSetFile(const stw::scl::C_SclString & orc_Path, int32_t & ors32_ResultDetail);
 
 private:
+   ///Address range of one NVM access and the planned items (lists or elements) of one datapool it covers
+   class C_NvmRange
+   {
+   public:
+      C_NvmRange(void);
+      C_NvmRange(const uint32_t ou32_StartAddress, const uint32_t ou32_Size, const uint32_t ou32_DataPoolIndex,
+                 const uint32_t ou32_Item);
+
+      bool operator <(const C_NvmRange & orc_Cmp) const;
+
+      uint32_t u32_StartAddress;
+      uint32_t u32_Size;
+      uint32_t u32_DataPoolIndex;    ///< Datapool of all covered items
+      std::vector<uint32_t> c_Items; ///< Indexes of the covered items in ascending address order
+   };
+
+   void m_PlanNvmRanges(std::vector<C_NvmRange> & orc_Items, const uint32_t ou32_MaxGap,
+                        std::vector<C_NvmRange> & orc_Ranges) const;
+   uint32_t m_GetNvmServiceCount(const uint32_t ou32_Size) const;
    static void mh_CreateInterpretedList(const C_OscNodeDataPoolList & orc_List,
                                         C_OscParamSetInterpretedList & orc_InterpretedList);
    int32_t m_CheckParameterFileContent(const C_OscParamSetRawNode & orc_Node) const;
@@ -93,6 +132,9 @@ private:
    C_OscNode mc_NodeCopy;
    C_OscParamSetHandler mc_ImageFileHandler;
    std::set<C_OscNodeDataPoolListId> mc_ChangedLists;
+   bool mq_CoalesceNvmAccess;
+   uint32_t mu32_MaxNvmReadGap;
+   C_NvmAccessStatistics mc_NvmAccessStatistics;
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
@@ -0,0 +1,258 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Data dealer passing received Datapool events to a recording
+
+   Event driven responses of the recorded elements are passed to a C_OscDpRecordWriter with the raw value as
+   received. The value is not converted per sample; the byte order is stored once in the channel description.
+
+   Looking up the channel of a received element is done by index so the reception path does not allocate memory.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include "stwtypes.hpp"
+#include "stwerrors.hpp"
+#include "TglTime.hpp"
+#include "C_OscDataDealerRecorder.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::scl;
+using namespace stw::tgl;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint16_t C_OscDataDealerRecorder::mhu16_NO_CHANNEL = 0xFFFFU;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscDataDealerRecorder::C_OscDataDealerRecorder(void) :
+   C_OscDataDealer(),
+   mpc_Writer(NULL),
+   mu64_StartTimeUs(0ULL),
+   mu64_IgnoredEvents(0ULL)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set elements to record
+
+   Node and diagnostic protocol must be set with Initialize before.
+
+   \param[in]   orc_Elements   elements to record (node index is ignored; elements of the installed node are used)
+   \param[out]  orc_Channels   channel descriptions for C_OscDpRecordWriter::Open (same order as orc_Elements)
+
+   \return
+   C_NO_ERR    channels set up
+   C_CONFIG    no node or diagnostic protocol installed
+   C_RANGE     element does not exist, is listed twice or too many elements
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscDataDealerRecorder::SetRecordedElements(const std::vector<C_OscNodeDataPoolListElementId> & orc_Elements,
+                                                     std::vector<C_OscDpRecordFormat::C_Channel> & orc_Channels)
+{
+   int32_t s32_Return = C_NO_ERR;
+
+   orc_Channels.clear();
+   this->mc_Channels.clear();
+
+   if ((this->mpc_Node == NULL) || (this->mpc_DiagProtocol == NULL))
+   {
+      s32_Return = C_CONFIG;
+   }
+   else if (orc_Elements.size() >= mhu16_NO_CHANNEL)
+   {
+      s32_Return = C_RANGE;
+   }
+   else
+   {
+      const bool q_BigEndian =
+         (this->mpc_DiagProtocol->GetEndianness() == C_OscDiagProtocolBase::mhu8_ENDIANNESS_BIG);
+
+      this->mc_Channels.resize(this->mpc_Node->c_DataPools.size());
+      for (uint32_t u32_DataPool = 0U; u32_DataPool < this->mpc_Node->c_DataPools.size(); ++u32_DataPool)
+      {
+         const C_OscNodeDataPool & rc_DataPool = this->mpc_Node->c_DataPools[u32_DataPool];
+         this->mc_Channels[u32_DataPool].resize(rc_DataPool.c_Lists.size());
+         for (uint32_t u32_List = 0U; u32_List < rc_DataPool.c_Lists.size(); ++u32_List)
+         {
+            this->mc_Channels[u32_DataPool][u32_List].resize(rc_DataPool.c_Lists[u32_List].c_Elements.size(),
+                                                             mhu16_NO_CHANNEL);
+         }
+      }
+
+      for (uint32_t u32_Channel = 0U; (u32_Channel < orc_Elements.size()) && (s32_Return == C_NO_ERR);
+           ++u32_Channel)
+      {
+         const C_OscNodeDataPoolListElementId & rc_Id = orc_Elements[u32_Channel];
+         const C_OscNodeDataPoolListElement * const pc_Element =
+            this->mpc_Node->GetDataPoolListElement(rc_Id.u32_DataPoolIndex, rc_Id.u32_ListIndex,
+                                                   rc_Id.u32_ElementIndex);
+         if ((pc_Element == NULL) ||
+             (this->mc_Channels[rc_Id.u32_DataPoolIndex][rc_Id.u32_ListIndex][rc_Id.u32_ElementIndex] !=
+              mhu16_NO_CHANNEL))
+         {
+            s32_Return = C_RANGE;
+         }
+         else
+         {
+            const C_OscNodeDataPool & rc_DataPool = this->mpc_Node->c_DataPools[rc_Id.u32_DataPoolIndex];
+            C_OscDpRecordFormat::C_Channel c_Channel;
+
+            c_Channel.u32_NodeIndex = this->mu32_NodeIndex;
+            c_Channel.u8_DataPoolIndex = static_cast<uint8_t>(rc_Id.u32_DataPoolIndex);
+            c_Channel.u16_ListIndex = static_cast<uint16_t>(rc_Id.u32_ListIndex);
+            c_Channel.u16_ElementIndex = static_cast<uint16_t>(rc_Id.u32_ElementIndex);
+            c_Channel.u8_Type = static_cast<uint8_t>(pc_Element->GetType());
+            c_Channel.u32_ArraySize = pc_Element->GetArraySize();
+            c_Channel.u32_ValueSize = pc_Element->GetSizeByte();
+            c_Channel.q_BigEndian = q_BigEndian;
+            c_Channel.f64_Factor = pc_Element->f64_Factor;
+            c_Channel.f64_Offset = pc_Element->f64_Offset;
+            c_Channel.c_Name = this->mpc_Node->c_Properties.c_Name + "::" + rc_DataPool.c_Name + "::" +
+                               rc_DataPool.c_Lists[rc_Id.u32_ListIndex].c_Name + "::" + pc_Element->c_Name;
+            c_Channel.c_Unit = pc_Element->c_Unit;
+            orc_Channels.push_back(c_Channel);
+
+            this->mc_Channels[rc_Id.u32_DataPoolIndex][rc_Id.u32_ListIndex][rc_Id.u32_ElementIndex] =
+               static_cast<uint16_t>(u32_Channel);
+         }
+      }
+   }
+
+   if (s32_Return != C_NO_ERR)
+   {
+      orc_Channels.clear();
+      this->mc_Channels.clear();
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Start passing received values to recording
+
+   Time stamps of the samples are relative to the call of this function.
+
+   \param[in]  opc_Writer  opened recording (with channels from SetRecordedElements)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDataDealerRecorder::StartRecording(C_OscDpRecordWriter * const opc_Writer)
+{
+   this->mu64_IgnoredEvents = 0ULL;
+   this->mu64_StartTimeUs = TglGetTickCountUs();
+   this->mpc_Writer = opc_Writer;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Stop passing received values to recording
+
+   Does not close the recording.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDataDealerRecorder::StopRecording(void)
+{
+   this->mpc_Writer = NULL;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of received events that were not recorded
+
+   Events of elements that are not recorded or that could not be added to the recording.
+
+   \return
+   number of ignored events since StartRecording
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_OscDataDealerRecorder::GetIgnoredEventCount(void) const
+{
+   return this->mu64_IgnoredEvents;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Handler for reception of async response
+
+   The value was already passed to the recording; nothing left to do (base class would log every event).
+
+   \param[in]  ou8_DataPoolIndex   data pool index that data was received for
+   \param[in]  ou16_ListIndex      list index that data was received for
+   \param[in]  ou16_ElementIndex   element index that data was received for
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDataDealerRecorder::m_OnReadDataPoolEventReceived(const uint8_t ou8_DataPoolIndex,
+                                                            const uint16_t ou16_ListIndex,
+                                                            const uint16_t ou16_ElementIndex)
+{
+   (void)ou8_DataPoolIndex;
+   (void)ou16_ListIndex;
+   (void)ou16_ElementIndex;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Pass raw value of async response to recording
+
+   \param[in]  ou8_DataPoolIndex   data pool index that data was received for
+   \param[in]  ou16_ListIndex      list index that data was received for
+   \param[in]  ou16_ElementIndex   element index that data was received for
+   \param[in]  orc_Value           raw value in endianness of protocol (size of element)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDataDealerRecorder::m_OnReadDataPoolEventValueReceived(const uint8_t ou8_DataPoolIndex,
+                                                                 const uint16_t ou16_ListIndex,
+                                                                 const uint16_t ou16_ElementIndex,
+                                                                 const std::vector<uint8_t> & orc_Value)
+{
+   if (this->mpc_Writer != NULL)
+   {
+      const uint16_t u16_Channel = this->m_GetChannel(ou8_DataPoolIndex, ou16_ListIndex, ou16_ElementIndex);
+
+      if ((u16_Channel == mhu16_NO_CHANNEL) || (orc_Value.size() == 0U) ||
+          (this->mpc_Writer->AddSample(u16_Channel, TglGetTickCountUs() - this->mu64_StartTimeUs, &orc_Value[0],
+                                       static_cast<uint32_t>(orc_Value.size())) != C_NO_ERR))
+      {
+         this->mu64_IgnoredEvents++;
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get channel of element
+
+   \param[in]  ou8_DataPoolIndex   data pool index
+   \param[in]  ou16_ListIndex      list index
+   \param[in]  ou16_ElementIndex   element index
+
+   \return
+   channel index; mhu16_NO_CHANNEL if element is not recorded
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint16_t C_OscDataDealerRecorder::m_GetChannel(const uint8_t ou8_DataPoolIndex, const uint16_t ou16_ListIndex,
+                                               const uint16_t ou16_ElementIndex) const
+{
+   uint16_t u16_Channel = mhu16_NO_CHANNEL;
+
+   if ((ou8_DataPoolIndex < this->mc_Channels.size()) &&
+       (ou16_ListIndex < this->mc_Channels[ou8_DataPoolIndex].size()) &&
+       (ou16_ElementIndex < this->mc_Channels[ou8_DataPoolIndex][ou16_ListIndex].size()))
+   {
+      u16_Channel = this->mc_Channels[ou8_DataPoolIndex][ou16_ListIndex][ou16_ElementIndex];
+   }
+   return u16_Channel;
+}
@@ -0,0 +1,71 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Data dealer passing received Datapool events to a recording (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCDATADEALERRECORDER_HPP
+#define C_OSCDATADEALERRECORDER_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
+
+#include "stwtypes.hpp"
+#include "C_OscDataDealer.hpp"
+#include "C_OscDpRecordWriter.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_OscDataDealerRecorder :
+   public C_OscDataDealer
+{
+public:
+   C_OscDataDealerRecorder(void);
+
+   int32_t SetRecordedElements(const std::vector<C_OscNodeDataPoolListElementId> & orc_Elements,
+                               std::vector<C_OscDpRecordFormat::C_Channel> & orc_Channels);
+   void StartRecording(C_OscDpRecordWriter * const opc_Writer);
+   void StopRecording(void);
+
+   uint64_t GetIgnoredEventCount(void) const;
+
+protected:
+   virtual void m_OnReadDataPoolEventReceived(const uint8_t ou8_DataPoolIndex, const uint16_t ou16_ListIndex,
+                                              const uint16_t ou16_ElementIndex);
+   virtual void m_OnReadDataPoolEventValueReceived(const uint8_t ou8_DataPoolIndex, const uint16_t ou16_ListIndex,
+                                                   const uint16_t ou16_ElementIndex,
+                                                   const std::vector<uint8_t> & orc_Value);
+
+private:
+   //Avoid call
+   C_OscDataDealerRecorder(const C_OscDataDealerRecorder &);
+   C_OscDataDealerRecorder & operator =(const C_OscDataDealerRecorder &);
+
+   uint16_t m_GetChannel(const uint8_t ou8_DataPoolIndex, const uint16_t ou16_ListIndex,
+                         const uint16_t ou16_ElementIndex) const;
+
+   ///Channel of each recorded element: [Datapool][List][Element]; mhu16_NO_CHANNEL if not recorded
+   std::vector<std::vector<std::vector<uint16_t> > > mc_Channels;
+   C_OscDpRecordWriter * mpc_Writer;
+   uint64_t mu64_StartTimeUs;
+   uint64_t mu64_IgnoredEvents;
+
+   static const uint16_t mhu16_NO_CHANNEL;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
@@ -0,0 +1,333 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       File format of Datapool recordings
+
+   A recording file stores samples of Datapool elements (time stamp, element, raw value) in chunks.
+   All numbers are stored little endian.
+
+   \code
+   File header:
+      u32   file magic "OSDR"
+      u32   format version
+      u32   flags (hu32_FLAG_COMPRESSED)
+      u32   maximum number of samples per chunk
+      str   start time of recording (u32 length + characters)
+      u32   number of channels
+      ...   channels (see h_AppendChannel)
+   Chunk (repeated):
+      u32   chunk magic "CHNK"
+      u32   number of samples
+      u64   time stamp of first sample in us
+      u64   time stamp of last sample in us
+      u32   size of payload
+      u32   size of stored payload (equal to size of payload if not compressed)
+      u32   CRC32 over stored payload
+      ...   stored payload
+   Index (written on close):
+      u32   index magic "INDX"
+      u32   number of chunks
+      ...   per chunk: u64 first time stamp, u64 last time stamp, u64 file offset, u32 number of samples
+   Trailer:
+      u64   file offset of index
+      u32   end magic "OEND"
+   \endcode
+
+   The payload of a chunk is stored column by column, which compresses a lot better than sample by sample:
+   * time stamp column: u32 time stamp offset to first sample of chunk in us for each sample
+   * channel column: u16 channel index for each sample
+   * value column: raw values of all samples; the size of each value is defined by its channel
+
+   If a recording was not closed (e.g. power loss) index and trailer are missing.
+   The chunks can still be read by scanning the file; only the chunk being written at that time is lost.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <cstring>
+
+#include "stwtypes.hpp"
+#include "C_OscDpRecordFormat.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::scl;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint32_t C_OscDpRecordFormat::hu32_FILE_MAGIC = 0x5244534FUL;  // "OSDR"
+const uint32_t C_OscDpRecordFormat::hu32_CHUNK_MAGIC = 0x4B4E4843UL; // "CHNK"
+const uint32_t C_OscDpRecordFormat::hu32_INDEX_MAGIC = 0x58444E49UL; // "INDX"
+const uint32_t C_OscDpRecordFormat::hu32_END_MAGIC = 0x444E454FUL;   // "OEND"
+const uint32_t C_OscDpRecordFormat::hu32_FORMAT_VERSION = 1U;
+const uint32_t C_OscDpRecordFormat::hu32_FLAG_COMPRESSED = 0x00000001UL;
+const uint32_t C_OscDpRecordFormat::hu32_CHUNK_HEADER_SIZE = 36U;
+const uint32_t C_OscDpRecordFormat::hu32_INDEX_ENTRY_SIZE = 28U;
+const uint32_t C_OscDpRecordFormat::hu32_TRAILER_SIZE = 12U;
+const uint32_t C_OscDpRecordFormat::hu32_TIME_STAMP_COLUMN_ENTRY_SIZE = 4U;
+const uint32_t C_OscDpRecordFormat::hu32_CHANNEL_COLUMN_ENTRY_SIZE = 2U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscDpRecordFormat::C_Channel::C_Channel(void) :
+   u32_NodeIndex(0U),
+   u8_DataPoolIndex(0U),
+   u16_ListIndex(0U),
+   u16_ElementIndex(0U),
+   u8_Type(0U),
+   u32_ArraySize(1U),
+   u32_ValueSize(0U),
+   q_BigEndian(false),
+   f64_Factor(1.0),
+   f64_Offset(0.0),
+   c_Name(""),
+   c_Unit("")
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscDpRecordFormat::C_ChunkInfo::C_ChunkInfo(void) :
+   u64_FirstTimeStampUs(0ULL),
+   u64_LastTimeStampUs(0ULL),
+   u64_FileOffset(0ULL),
+   u32_SampleCount(0U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Append one byte to buffer
+
+   \param[in]      ou8_Value    value
+   \param[in,out]  orc_Buffer   buffer to append to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDpRecordFormat::h_AppendU8(const uint8_t ou8_Value, std::vector<uint8_t> & orc_Buffer)
+{
+   orc_Buffer.push_back(ou8_Value);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Append 16 bit value to buffer (little endian)
+
+   \param[in]      ou16_Value   value
+   \param[in,out]  orc_Buffer   buffer to append to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDpRecordFormat::h_AppendU16(const uint16_t ou16_Value, std::vector<uint8_t> & orc_Buffer)
+{
+   const uint32_t u32_Position = static_cast<uint32_t>(orc_Buffer.size());
+
+   orc_Buffer.resize(static_cast<size_t>(u32_Position) + 2U);
+   h_SetU16(ou16_Value, &orc_Buffer[u32_Position]);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Append 32 bit value to buffer (little endian)
+
+   \param[in]      ou32_Value   value
+   \param[in,out]  orc_Buffer   buffer to append to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDpRecordFormat::h_AppendU32(const uint32_t ou32_Value, std::vector<uint8_t> & orc_Buffer)
+{
+   const uint32_t u32_Position = static_cast<uint32_t>(orc_Buffer.size());
+
+   orc_Buffer.resize(static_cast<size_t>(u32_Position) + 4U);
+   h_SetU32(ou32_Value, &orc_Buffer[u32_Position]);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Append 64 bit value to buffer (little endian)
+
+   \param[in]      ou64_Value   value
+   \param[in,out]  orc_Buffer   buffer to append to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDpRecordFormat::h_AppendU64(const uint64_t ou64_Value, std::vector<uint8_t> & orc_Buffer)
+{
+   const uint32_t u32_Position = static_cast<uint32_t>(orc_Buffer.size());
+
+   orc_Buffer.resize(static_cast<size_t>(u32_Position) + 8U);
+   h_SetU64(ou64_Value, &orc_Buffer[u32_Position]);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Append 64 bit floating point value to buffer (IEEE 754, little endian)
+
+   \param[in]      of64_Value   value
+   \param[in,out]  orc_Buffer   buffer to append to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDpRecordFormat::h_AppendF64(const float64_t of64_Value, std::vector<uint8_t> & orc_Buffer)
+{
+   uint64_t u64_Value;
+
+   (void)std::memcpy(&u64_Value, &of64_Value, sizeof(u64_Value));
+   h_AppendU64(u64_Value, orc_Buffer);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Append string to buffer (length followed by characters)
+
+   \param[in]      orc_Value    value
+   \param[in,out]  orc_Buffer   buffer to append to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDpRecordFormat::h_AppendString(const C_SclString & orc_Value, std::vector<uint8_t> & orc_Buffer)
+{
+   const uint32_t u32_Length = orc_Value.Length();
+
+   h_AppendU32(u32_Length, orc_Buffer);
+   if (u32_Length > 0U)
+   {
+      const uint8_t * const pu8_Start = reinterpret_cast<const uint8_t *>(orc_Value.c_str());
+      orc_Buffer.insert(orc_Buffer.end(), pu8_Start, pu8_Start + u32_Length);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Append channel description to buffer
+
+   \param[in]      orc_Channel  channel
+   \param[in,out]  orc_Buffer   buffer to append to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDpRecordFormat::h_AppendChannel(const C_Channel & orc_Channel, std::vector<uint8_t> & orc_Buffer)
+{
+   h_AppendU32(orc_Channel.u32_NodeIndex, orc_Buffer);
+   h_AppendU8(orc_Channel.u8_DataPoolIndex, orc_Buffer);
+   h_AppendU16(orc_Channel.u16_ListIndex, orc_Buffer);
+   h_AppendU16(orc_Channel.u16_ElementIndex, orc_Buffer);
+   h_AppendU8(orc_Channel.u8_Type, orc_Buffer);
+   h_AppendU32(orc_Channel.u32_ArraySize, orc_Buffer);
+   h_AppendU32(orc_Channel.u32_ValueSize, orc_Buffer);
+   h_AppendU8((orc_Channel.q_BigEndian == true) ? 1U : 0U, orc_Buffer);
+   h_AppendF64(orc_Channel.f64_Factor, orc_Buffer);
+   h_AppendF64(orc_Channel.f64_Offset, orc_Buffer);
+   h_AppendString(orc_Channel.c_Name, orc_Buffer);
+   h_AppendString(orc_Channel.c_Unit, orc_Buffer);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write 16 bit value to memory (little endian)
+
+   \param[in]   ou16_Value    value
+   \param[out]  opu8_Target   target (at least 2 bytes)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDpRecordFormat::h_SetU16(const uint16_t ou16_Value, uint8_t * const opu8_Target)
+{
+   opu8_Target[0] = static_cast<uint8_t>(ou16_Value);
+   opu8_Target[1] = static_cast<uint8_t>(ou16_Value >> 8U);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write 32 bit value to memory (little endian)
+
+   \param[in]   ou32_Value    value
+   \param[out]  opu8_Target   target (at least 4 bytes)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDpRecordFormat::h_SetU32(const uint32_t ou32_Value, uint8_t * const opu8_Target)
+{
+   opu8_Target[0] = static_cast<uint8_t>(ou32_Value);
+   opu8_Target[1] = static_cast<uint8_t>(ou32_Value >> 8U);
+   opu8_Target[2] = static_cast<uint8_t>(ou32_Value >> 16U);
+   opu8_Target[3] = static_cast<uint8_t>(ou32_Value >> 24U);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write 64 bit value to memory (little endian)
+
+   \param[in]   ou64_Value    value
+   \param[out]  opu8_Target   target (at least 8 bytes)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDpRecordFormat::h_SetU64(const uint64_t ou64_Value, uint8_t * const opu8_Target)
+{
+   h_SetU32(static_cast<uint32_t>(ou64_Value), &opu8_Target[0]);
+   h_SetU32(static_cast<uint32_t>(ou64_Value >> 32U), &opu8_Target[4]);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read 16 bit value from memory (little endian)
+
+   \param[in]  opu8_Source    source (at least 2 bytes)
+
+   \return
+   value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint16_t C_OscDpRecordFormat::h_GetU16(const uint8_t * const opu8_Source)
+{
+   return static_cast<uint16_t>(static_cast<uint16_t>(opu8_Source[0]) |
+                                static_cast<uint16_t>(static_cast<uint16_t>(opu8_Source[1]) << 8U));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read 32 bit value from memory (little endian)
+
+   \param[in]  opu8_Source    source (at least 4 bytes)
+
+   \return
+   value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscDpRecordFormat::h_GetU32(const uint8_t * const opu8_Source)
+{
+   return static_cast<uint32_t>(opu8_Source[0]) |
+          (static_cast<uint32_t>(opu8_Source[1]) << 8U) |
+          (static_cast<uint32_t>(opu8_Source[2]) << 16U) |
+          (static_cast<uint32_t>(opu8_Source[3]) << 24U);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read 64 bit value from memory (little endian)
+
+   \param[in]  opu8_Source    source (at least 8 bytes)
+
+   \return
+   value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_OscDpRecordFormat::h_GetU64(const uint8_t * const opu8_Source)
+{
+   return static_cast<uint64_t>(h_GetU32(&opu8_Source[0])) |
+          (static_cast<uint64_t>(h_GetU32(&opu8_Source[4])) << 32U);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read 64 bit floating point value from memory (IEEE 754, little endian)
+
+   \param[in]  opu8_Source    source (at least 8 bytes)
+
+   \return
+   value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+float64_t C_OscDpRecordFormat::h_GetF64(const uint8_t * const opu8_Source)
+{
+   const uint64_t u64_Value = h_GetU64(opu8_Source);
+   float64_t f64_Value;
+
+   (void)std::memcpy(&f64_Value, &u64_Value, sizeof(f64_Value));
+   return f64_Value;
+}
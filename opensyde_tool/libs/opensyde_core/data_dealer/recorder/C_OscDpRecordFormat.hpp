@@ -0,0 +1,97 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       File format of Datapool recordings (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCDPRECORDFORMAT_HPP
+#define C_OSCDPRECORDFORMAT_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
+
+#include "stwtypes.hpp"
+#include "C_SclString.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_OscDpRecordFormat
+{
+public:
+   ///Description of one recorded Datapool element
+   class C_Channel
+   {
+   public:
+      C_Channel(void);
+
+      uint32_t u32_NodeIndex;        ///< Index of node within system definition
+      uint8_t u8_DataPoolIndex;      ///< Index of Datapool within node
+      uint16_t u16_ListIndex;        ///< Index of list within Datapool
+      uint16_t u16_ElementIndex;     ///< Index of element within list
+      uint8_t u8_Type;               ///< C_OscNodeDataPoolContent::E_Type of the element
+      uint32_t u32_ArraySize;        ///< Number of values of the element (1 for non-array elements)
+      uint32_t u32_ValueSize;        ///< Size of one recorded raw value in bytes
+      bool q_BigEndian;              ///< Byte order of the recorded raw value
+      float64_t f64_Factor;          ///< Factor for physical value
+      float64_t f64_Offset;          ///< Offset for physical value
+      stw::scl::C_SclString c_Name;  ///< Full name of the element ("Node::Datapool::List::Element")
+      stw::scl::C_SclString c_Unit;  ///< Unit of the physical value
+   };
+
+   ///Position and time range of one chunk of samples
+   class C_ChunkInfo
+   {
+   public:
+      C_ChunkInfo(void);
+
+      uint64_t u64_FirstTimeStampUs; ///< Time stamp of first sample in chunk
+      uint64_t u64_LastTimeStampUs;  ///< Time stamp of last sample in chunk
+      uint64_t u64_FileOffset;       ///< Offset of chunk header in file
+      uint32_t u32_SampleCount;      ///< Number of samples in chunk
+   };
+
+   static const uint32_t hu32_FILE_MAGIC;
+   static const uint32_t hu32_CHUNK_MAGIC;
+   static const uint32_t hu32_INDEX_MAGIC;
+   static const uint32_t hu32_END_MAGIC;
+   static const uint32_t hu32_FORMAT_VERSION;
+   static const uint32_t hu32_FLAG_COMPRESSED;
+   static const uint32_t hu32_CHUNK_HEADER_SIZE;
+   static const uint32_t hu32_INDEX_ENTRY_SIZE;
+   static const uint32_t hu32_TRAILER_SIZE;
+   static const uint32_t hu32_TIME_STAMP_COLUMN_ENTRY_SIZE;
+   static const uint32_t hu32_CHANNEL_COLUMN_ENTRY_SIZE;
+
+   static void h_AppendU8(const uint8_t ou8_Value, std::vector<uint8_t> & orc_Buffer);
+   static void h_AppendU16(const uint16_t ou16_Value, std::vector<uint8_t> & orc_Buffer);
+   static void h_AppendU32(const uint32_t ou32_Value, std::vector<uint8_t> & orc_Buffer);
+   static void h_AppendU64(const uint64_t ou64_Value, std::vector<uint8_t> & orc_Buffer);
+   static void h_AppendF64(const float64_t of64_Value, std::vector<uint8_t> & orc_Buffer);
+   static void h_AppendString(const stw::scl::C_SclString & orc_Value, std::vector<uint8_t> & orc_Buffer);
+   static void h_AppendChannel(const C_Channel & orc_Channel, std::vector<uint8_t> & orc_Buffer);
+
+   static void h_SetU16(const uint16_t ou16_Value, uint8_t * const opu8_Target);
+   static void h_SetU32(const uint32_t ou32_Value, uint8_t * const opu8_Target);
+   static void h_SetU64(const uint64_t ou64_Value, uint8_t * const opu8_Target);
+   static uint16_t h_GetU16(const uint8_t * const opu8_Source);
+   static uint32_t h_GetU32(const uint8_t * const opu8_Source);
+   static uint64_t h_GetU64(const uint8_t * const opu8_Source);
+   static float64_t h_GetF64(const uint8_t * const opu8_Source);
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
@@ -0,0 +1,948 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Reader for Datapool recordings
+
+   Reads recordings written by C_OscDpRecordWriter (see C_OscDpRecordFormat for the file layout).
+
+   On Open only the header and the chunk index are read. Time range queries use the index to find the first
+   relevant chunk and only read the chunks overlapping the requested range.
+   If the recording was not closed properly (no index) the index is rebuilt by scanning the chunk headers.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <cstring>
+
+#include "stwtypes.hpp"
+#include "stwerrors.hpp"
+#include "C_SclChecksums.hpp"
+#include "C_OscUtils.hpp"
+#include "C_OscZipData.hpp"
+#include "C_OscNodeDataPoolContent.hpp"
+#include "C_OscLoggingHandler.hpp"
+#include "C_OscDpRecordReader.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::scl;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+//u32 magic, u32 version, u32 flags, u32 chunk sample count
+static const uint32_t mu32_FILE_HEADER_FIXED_SIZE = 16U;
+//u32 node, u8 Datapool, u16 list, u16 element, u8 type, u32 array size, u32 value size, u8 endianness,
+// f64 factor, f64 offset
+static const uint32_t mu32_CHANNEL_FIXED_SIZE = 35U;
+static const uint32_t mu32_CSV_WRITE_BUFFER_SIZE = 65536U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+static void m_AppendCsvField(const C_SclString & orc_Field, std::string & orc_Output);
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Remove all samples (keeps allocated memory)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDpRecordReader::C_Samples::Clear(void)
+{
+   this->c_TimeStampsUs.clear();
+   this->c_Channels.clear();
+   this->c_ValueOffsets.clear();
+   this->c_Values.clear();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscDpRecordReader::C_OscDpRecordReader(void) :
+   mu64_FileSize(0ULL),
+   mu64_DataOffset(0ULL),
+   mc_StartTime(""),
+   mq_IndexRecovered(false)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default destructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscDpRecordReader::~C_OscDpRecordReader(void)
+{
+   try
+   {
+      this->Close();
+   }
+   catch (...)
+   {
+      //not much we can do here ...
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Open recording and read header and chunk index
+
+   \param[in]  orc_FilePath   path of recording file
+
+   \return
+   C_NO_ERR    recording opened (see IsIndexRecovered for recordings that were not closed properly)
+   C_RD_WR     could not open or read file
+   C_CONFIG    file is not a Datapool recording or has an unknown format version
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscDpRecordReader::Open(const C_SclString & orc_FilePath)
+{
+   int32_t s32_Return = C_NO_ERR;
+
+   this->Close();
+
+   this->mc_File.open(orc_FilePath.c_str(), std::ios::in | std::ios::binary);
+   if (this->mc_File.is_open() == false)
+   {
+      s32_Return = C_RD_WR;
+   }
+   else
+   {
+      this->mc_File.seekg(0, std::ios::end);
+      this->mu64_FileSize = static_cast<uint64_t>(this->mc_File.tellg());
+      s32_Return = this->m_ReadHeader();
+   }
+
+   if (s32_Return == C_NO_ERR)
+   {
+      if (this->m_ReadIndex() != C_NO_ERR)
+      {
+         osc_write_log_warning("Datapool Recorder", "Recording \"" + orc_FilePath +
+                               "\" was not closed properly. Recovering chunk index ...");
+         this->m_RecoverIndex();
+         this->mq_IndexRecovered = true;
+      }
+   }
+   else
+   {
+      this->Close();
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Close recording
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDpRecordReader::Close(void)
+{
+   if (this->mc_File.is_open() == true)
+   {
+      this->mc_File.close();
+   }
+   this->mc_File.clear();
+   this->mu64_FileSize = 0ULL;
+   this->mu64_DataOffset = 0ULL;
+   this->mc_StartTime = "";
+   this->mc_Channels.clear();
+   this->mc_Chunks.clear();
+   this->mq_IndexRecovered = false;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get recorded Datapool elements
+
+   \return
+   channels; the index within the vector is the channel index of the samples
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const std::vector<C_OscDpRecordFormat::C_Channel> & C_OscDpRecordReader::GetChannels(void) const
+{
+   return this->mc_Channels;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get chunk index
+
+   \return
+   chunks ordered by time
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const std::vector<C_OscDpRecordFormat::C_ChunkInfo> & C_OscDpRecordReader::GetChunks(void) const
+{
+   return this->mc_Chunks;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get time the recording was started
+
+   \return
+   start time as formatted by the logging handler ("YYYY-MM-DD hh:mm:ss.mmm")
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_SclString & C_OscDpRecordReader::GetStartTime(void) const
+{
+   return this->mc_StartTime;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check whether the chunk index had to be rebuilt
+
+   \retval   true    recording was not closed properly; index was rebuilt by scanning the file
+   \retval   false   index was read from file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscDpRecordReader::IsIndexRecovered(void) const
+{
+   return this->mq_IndexRecovered;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get total number of samples
+
+   \return
+   number of samples in all chunks
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_OscDpRecordReader::GetSampleCount(void) const
+{
+   uint64_t u64_Count = 0ULL;
+
+   for (uint32_t u32_Chunk = 0U; u32_Chunk < this->mc_Chunks.size(); ++u32_Chunk)
+   {
+      u64_Count += this->mc_Chunks[u32_Chunk].u32_SampleCount;
+   }
+   return u64_Count;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read all samples within time range
+
+   \param[in]   ou64_StartUs   start of time range in us (inclusive)
+   \param[in]   ou64_EndUs     end of time range in us (inclusive)
+   \param[out]  orc_Samples    samples within time range ordered by time
+
+   \return
+   C_NO_ERR    samples read
+   C_CONFIG    no recording open
+   C_RD_WR     could not read file
+   C_CHECKSUM  chunk is corrupt
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscDpRecordReader::ReadSamples(const uint64_t ou64_StartUs, const uint64_t ou64_EndUs,
+                                         C_Samples & orc_Samples)
+{
+   int32_t s32_Return = C_NO_ERR;
+
+   orc_Samples.Clear();
+   if (this->mc_File.is_open() == false)
+   {
+      s32_Return = C_CONFIG;
+   }
+   else
+   {
+      for (uint32_t u32_Chunk = this->m_GetFirstChunk(ou64_StartUs);
+           (u32_Chunk < this->mc_Chunks.size()) && (s32_Return == C_NO_ERR) &&
+           (this->mc_Chunks[u32_Chunk].u64_FirstTimeStampUs <= ou64_EndUs); ++u32_Chunk)
+      {
+         s32_Return = this->m_ReadChunk(u32_Chunk, ou64_StartUs, ou64_EndUs, orc_Samples);
+      }
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Export samples within time range to CSV file
+
+   One line per sample: time stamp in seconds, element name, value and unit.
+   Numeric values are scaled with factor and offset of the element; array values are separated by spaces.
+   The chunks are read one after the other so memory usage does not depend on the size of the recording.
+
+   \param[in]  orc_CsvPath    path of CSV file (overwritten if it exists)
+   \param[in]  ou64_StartUs   start of time range in us (inclusive)
+   \param[in]  ou64_EndUs     end of time range in us (inclusive)
+
+   \return
+   C_NO_ERR    CSV file written
+   C_CONFIG    no recording open
+   C_RD_WR     could not read recording or write CSV file
+   C_CHECKSUM  chunk is corrupt (all samples before were exported)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscDpRecordReader::ExportCsv(const C_SclString & orc_CsvPath, const uint64_t ou64_StartUs,
+                                       const uint64_t ou64_EndUs)
+{
+   int32_t s32_Return = C_NO_ERR;
+   std::ofstream c_Csv;
+
+   if (this->mc_File.is_open() == false)
+   {
+      s32_Return = C_CONFIG;
+   }
+   else
+   {
+      c_Csv.open(orc_CsvPath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+      if (c_Csv.is_open() == false)
+      {
+         s32_Return = C_RD_WR;
+      }
+   }
+
+   if (s32_Return == C_NO_ERR)
+   {
+      std::string c_Output = "Timestamp[s];Element;Value;Unit\n";
+      C_Samples c_Samples;
+
+      for (uint32_t u32_Chunk = this->m_GetFirstChunk(ou64_StartUs);
+           (u32_Chunk < this->mc_Chunks.size()) && (s32_Return == C_NO_ERR) &&
+           (this->mc_Chunks[u32_Chunk].u64_FirstTimeStampUs <= ou64_EndUs); ++u32_Chunk)
+      {
+         c_Samples.Clear();
+         s32_Return = this->m_ReadChunk(u32_Chunk, ou64_StartUs, ou64_EndUs, c_Samples);
+         for (uint32_t u32_Sample = 0U; u32_Sample < c_Samples.c_TimeStampsUs.size(); ++u32_Sample)
+         {
+            const C_OscDpRecordFormat::C_Channel & rc_Channel = this->mc_Channels[c_Samples.c_Channels[u32_Sample]];
+            const uint64_t u64_TimeStamp = c_Samples.c_TimeStampsUs[u32_Sample];
+            C_SclString c_TimeStamp;
+
+            c_TimeStamp.PrintFormatted("%llu.%06llu", static_cast<unsigned long long>(u64_TimeStamp / 1000000ULL),
+                                       static_cast<unsigned long long>(u64_TimeStamp % 1000000ULL));
+            c_Output += c_TimeStamp.c_str();
+            c_Output += ';';
+            m_AppendCsvField(rc_Channel.c_Name, c_Output);
+            c_Output += ';';
+            c_Output += h_FormatValue(rc_Channel, &c_Samples.c_Values[c_Samples.c_ValueOffsets[u32_Sample]]).c_str();
+            c_Output += ';';
+            m_AppendCsvField(rc_Channel.c_Unit, c_Output);
+            c_Output += '\n';
+
+            if (c_Output.size() >= mu32_CSV_WRITE_BUFFER_SIZE)
+            {
+               c_Csv.write(c_Output.c_str(), c_Output.size());
+               c_Output.clear();
+            }
+         }
+      }
+
+      c_Csv.write(c_Output.c_str(), c_Output.size());
+      if (c_Csv.good() == false)
+      {
+         s32_Return = C_RD_WR;
+      }
+      c_Csv.close();
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Format raw value of one sample
+
+   Numeric values are scaled with factor and offset of the channel. Array values are separated by spaces.
+   If the value size does not match the type of the channel the raw bytes are returned as hex.
+
+   \param[in]  orc_Channel    channel of sample
+   \param[in]  opu8_Value     raw value of sample (value size of channel)
+
+   \return
+   formatted value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SclString C_OscDpRecordReader::h_FormatValue(const C_OscDpRecordFormat::C_Channel & orc_Channel,
+                                               const uint8_t * const opu8_Value)
+{
+   C_SclString c_Text;
+   const uint32_t u32_TypeSize = mh_GetTypeSize(orc_Channel.u8_Type);
+
+   if ((u32_TypeSize == 0U) || ((u32_TypeSize * orc_Channel.u32_ArraySize) > orc_Channel.u32_ValueSize))
+   {
+      for (uint32_t u32_Byte = 0U; u32_Byte < orc_Channel.u32_ValueSize; ++u32_Byte)
+      {
+         c_Text += C_SclString::IntToHex(opu8_Value[u32_Byte], 2U);
+      }
+   }
+   else
+   {
+      const bool q_Scaled = C_OscUtils::h_IsScalingActive(orc_Channel.f64_Factor, orc_Channel.f64_Offset);
+
+      for (uint32_t u32_Value = 0U; u32_Value < orc_Channel.u32_ArraySize; ++u32_Value)
+      {
+         bool q_IsInteger;
+         int64_t s64_Value;
+         const float64_t f64_Value = mh_GetRawValue(orc_Channel.u8_Type, orc_Channel.q_BigEndian,
+                                                    &opu8_Value[u32_Value * u32_TypeSize], q_IsInteger, s64_Value);
+         if (u32_Value > 0U)
+         {
+            c_Text += " ";
+         }
+         if ((q_IsInteger == true) && (q_Scaled == false))
+         {
+            if (orc_Channel.u8_Type == static_cast<uint8_t>(C_OscNodeDataPoolContent::eUINT64))
+            {
+               c_Text += C_SclString::IntToStr(static_cast<uint64_t>(s64_Value));
+            }
+            else
+            {
+               c_Text += C_SclString::IntToStr(s64_Value);
+            }
+         }
+         else
+         {
+            C_SclString c_Value;
+            c_Value.PrintFormatted("%.15g", C_OscUtils::h_GetValueScaled(f64_Value, orc_Channel.f64_Factor,
+                                                                         orc_Channel.f64_Offset));
+            c_Text += c_Value;
+         }
+      }
+   }
+   return c_Text;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read file header with channel descriptions
+
+   \return
+   C_NO_ERR    header read
+   C_RD_WR     could not read file (e.g. file too short)
+   C_CONFIG    file is not a Datapool recording or has an unknown format version
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscDpRecordReader::m_ReadHeader(void)
+{
+   int32_t s32_Return = C_NO_ERR;
+   std::vector<uint8_t> c_Data;
+   uint64_t u64_Offset = 0ULL;
+   uint32_t u32_Length = 0U;
+   uint32_t u32_ChannelCount = 0U;
+
+   if (this->m_ReadFromFile(u64_Offset, mu32_FILE_HEADER_FIXED_SIZE + 4U, c_Data) == false)
+   {
+      s32_Return = C_RD_WR;
+   }
+   else if ((C_OscDpRecordFormat::h_GetU32(&c_Data[0]) != C_OscDpRecordFormat::hu32_FILE_MAGIC) ||
+            (C_OscDpRecordFormat::h_GetU32(&c_Data[4]) != C_OscDpRecordFormat::hu32_FORMAT_VERSION))
+   {
+      s32_Return = C_CONFIG;
+   }
+   else
+   {
+      u32_Length = C_OscDpRecordFormat::h_GetU32(&c_Data[mu32_FILE_HEADER_FIXED_SIZE]);
+      u64_Offset += static_cast<uint64_t>(mu32_FILE_HEADER_FIXED_SIZE) + 4U;
+   }
+
+   if (s32_Return == C_NO_ERR)
+   {
+      if (this->m_ReadFromFile(u64_Offset, u32_Length + 4U, c_Data) == false)
+      {
+         s32_Return = C_RD_WR;
+      }
+      else
+      {
+         const std::string c_StartTime(reinterpret_cast<const char_t *>(&c_Data[0]), u32_Length);
+         this->mc_StartTime = c_StartTime.c_str();
+         u32_ChannelCount = C_OscDpRecordFormat::h_GetU32(&c_Data[u32_Length]);
+         u64_Offset += static_cast<uint64_t>(u32_Length) + 4U;
+         if ((static_cast<uint64_t>(u32_ChannelCount) * mu32_CHANNEL_FIXED_SIZE) > this->mu64_FileSize)
+         {
+            s32_Return = C_RD_WR;
+         }
+      }
+   }
+
+   if (s32_Return == C_NO_ERR)
+   {
+      this->mc_Channels.resize(u32_ChannelCount);
+      for (uint32_t u32_Channel = 0U; (u32_Channel < u32_ChannelCount) && (s32_Return == C_NO_ERR); ++u32_Channel)
+      {
+         C_OscDpRecordFormat::C_Channel & rc_Channel = this->mc_Channels[u32_Channel];
+
+         //fixed part and length of name
+         if (this->m_ReadFromFile(u64_Offset, mu32_CHANNEL_FIXED_SIZE + 4U, c_Data) == false)
+         {
+            s32_Return = C_RD_WR;
+         }
+         else
+         {
+            rc_Channel.u32_NodeIndex = C_OscDpRecordFormat::h_GetU32(&c_Data[0]);
+            rc_Channel.u8_DataPoolIndex = c_Data[4];
+            rc_Channel.u16_ListIndex = C_OscDpRecordFormat::h_GetU16(&c_Data[5]);
+            rc_Channel.u16_ElementIndex = C_OscDpRecordFormat::h_GetU16(&c_Data[7]);
+            rc_Channel.u8_Type = c_Data[9];
+            rc_Channel.u32_ArraySize = C_OscDpRecordFormat::h_GetU32(&c_Data[10]);
+            rc_Channel.u32_ValueSize = C_OscDpRecordFormat::h_GetU32(&c_Data[14]);
+            rc_Channel.q_BigEndian = (c_Data[18] != 0U);
+            rc_Channel.f64_Factor = C_OscDpRecordFormat::h_GetF64(&c_Data[19]);
+            rc_Channel.f64_Offset = C_OscDpRecordFormat::h_GetF64(&c_Data[27]);
+            u32_Length = C_OscDpRecordFormat::h_GetU32(&c_Data[mu32_CHANNEL_FIXED_SIZE]);
+            u64_Offset += static_cast<uint64_t>(mu32_CHANNEL_FIXED_SIZE) + 4U;
+         }
+
+         //name and length of unit
+         if (s32_Return == C_NO_ERR)
+         {
+            if (this->m_ReadFromFile(u64_Offset, u32_Length + 4U, c_Data) == false)
+            {
+               s32_Return = C_RD_WR;
+            }
+            else
+            {
+               const std::string c_Name(reinterpret_cast<const char_t *>(&c_Data[0]), u32_Length);
+               rc_Channel.c_Name = c_Name.c_str();
+               u64_Offset += static_cast<uint64_t>(u32_Length) + 4U;
+               u32_Length = C_OscDpRecordFormat::h_GetU32(&c_Data[u32_Length]);
+            }
+         }
+
+         //unit
+         if (s32_Return == C_NO_ERR)
+         {
+            if (this->m_ReadFromFile(u64_Offset, u32_Length, c_Data) == false)
+            {
+               s32_Return = C_RD_WR;
+            }
+            else
+            {
+               if (u32_Length > 0U)
+               {
+                  const std::string c_Unit(reinterpret_cast<const char_t *>(&c_Data[0]), u32_Length);
+                  rc_Channel.c_Unit = c_Unit.c_str();
+               }
+               u64_Offset += u32_Length;
+            }
+         }
+
+         if ((s32_Return == C_NO_ERR) && (rc_Channel.u32_ValueSize == 0U))
+         {
+            s32_Return = C_CONFIG;
+         }
+      }
+   }
+
+   this->mu64_DataOffset = u64_Offset;
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read chunk index written on close
+
+   \return
+   C_NO_ERR    index read
+   C_NOACT     no valid index and trailer at end of file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscDpRecordReader::m_ReadIndex(void)
+{
+   int32_t s32_Return = C_NOACT;
+   std::vector<uint8_t> c_Data;
+
+   if ((this->mu64_FileSize >= (this->mu64_DataOffset + 8U + C_OscDpRecordFormat::hu32_TRAILER_SIZE)) &&
+       (this->m_ReadFromFile(this->mu64_FileSize - C_OscDpRecordFormat::hu32_TRAILER_SIZE,
+                             C_OscDpRecordFormat::hu32_TRAILER_SIZE, c_Data) == true) &&
+       (C_OscDpRecordFormat::h_GetU32(&c_Data[8]) == C_OscDpRecordFormat::hu32_END_MAGIC))
+   {
+      const uint64_t u64_IndexOffset = C_OscDpRecordFormat::h_GetU64(&c_Data[0]);
+      const uint64_t u64_IndexEnd = this->mu64_FileSize - C_OscDpRecordFormat::hu32_TRAILER_SIZE;
+
+      if ((u64_IndexOffset >= this->mu64_DataOffset) && ((u64_IndexOffset + 8U) <= u64_IndexEnd) &&
+          (this->m_ReadFromFile(u64_IndexOffset, 8U, c_Data) == true) &&
+          (C_OscDpRecordFormat::h_GetU32(&c_Data[0]) == C_OscDpRecordFormat::hu32_INDEX_MAGIC))
+      {
+         const uint32_t u32_Count = C_OscDpRecordFormat::h_GetU32(&c_Data[4]);
+         const uint64_t u64_Size = static_cast<uint64_t>(u32_Count) * C_OscDpRecordFormat::hu32_INDEX_ENTRY_SIZE;
+
+         if (((u64_IndexOffset + 8U + u64_Size) == u64_IndexEnd) &&
+             (this->m_ReadFromFile(u64_IndexOffset + 8U, static_cast<uint32_t>(u64_Size), c_Data) == true))
+         {
+            this->mc_Chunks.resize(u32_Count);
+            for (uint32_t u32_Chunk = 0U; u32_Chunk < u32_Count; ++u32_Chunk)
+            {
+               const uint8_t * const pu8_Entry = &c_Data[u32_Chunk * C_OscDpRecordFormat::hu32_INDEX_ENTRY_SIZE];
+               C_OscDpRecordFormat::C_ChunkInfo & rc_Info = this->mc_Chunks[u32_Chunk];
+               rc_Info.u64_FirstTimeStampUs = C_OscDpRecordFormat::h_GetU64(&pu8_Entry[0]);
+               rc_Info.u64_LastTimeStampUs = C_OscDpRecordFormat::h_GetU64(&pu8_Entry[8]);
+               rc_Info.u64_FileOffset = C_OscDpRecordFormat::h_GetU64(&pu8_Entry[16]);
+               rc_Info.u32_SampleCount = C_OscDpRecordFormat::h_GetU32(&pu8_Entry[24]);
+            }
+            s32_Return = C_NO_ERR;
+         }
+      }
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Rebuild chunk index by scanning the chunk headers
+
+   Scanning stops at the first incomplete chunk (e.g. the chunk being written when the recording was interrupted).
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDpRecordReader::m_RecoverIndex(void)
+{
+   std::vector<uint8_t> c_Header;
+   uint64_t u64_Offset = this->mu64_DataOffset;
+   bool q_Continue = true;
+
+   this->mc_Chunks.clear();
+   while ((q_Continue == true) &&
+          ((u64_Offset + C_OscDpRecordFormat::hu32_CHUNK_HEADER_SIZE) <= this->mu64_FileSize) &&
+          (this->m_ReadFromFile(u64_Offset, C_OscDpRecordFormat::hu32_CHUNK_HEADER_SIZE, c_Header) == true))
+   {
+      const uint32_t u32_StoredSize = C_OscDpRecordFormat::h_GetU32(&c_Header[28]);
+      const uint64_t u64_End = u64_Offset + C_OscDpRecordFormat::hu32_CHUNK_HEADER_SIZE + u32_StoredSize;
+
+      if ((C_OscDpRecordFormat::h_GetU32(&c_Header[0]) == C_OscDpRecordFormat::hu32_CHUNK_MAGIC) &&
+          (u64_End <= this->mu64_FileSize))
+      {
+         C_OscDpRecordFormat::C_ChunkInfo c_Info;
+         c_Info.u32_SampleCount = C_OscDpRecordFormat::h_GetU32(&c_Header[4]);
+         c_Info.u64_FirstTimeStampUs = C_OscDpRecordFormat::h_GetU64(&c_Header[8]);
+         c_Info.u64_LastTimeStampUs = C_OscDpRecordFormat::h_GetU64(&c_Header[16]);
+         c_Info.u64_FileOffset = u64_Offset;
+         this->mc_Chunks.push_back(c_Info);
+         u64_Offset = u64_End;
+      }
+      else
+      {
+         q_Continue = false;
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Find first chunk that may contain samples at or after the start time
+
+   \param[in]  ou64_StartUs   start of time range in us
+
+   \return
+   index of first chunk whose last sample is not before ou64_StartUs (number of chunks if there is none)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscDpRecordReader::m_GetFirstChunk(const uint64_t ou64_StartUs) const
+{
+   uint32_t u32_Low = 0U;
+   uint32_t u32_High = static_cast<uint32_t>(this->mc_Chunks.size());
+
+   while (u32_Low < u32_High)
+   {
+      const uint32_t u32_Middle = u32_Low + ((u32_High - u32_Low) / 2U);
+      if (this->mc_Chunks[u32_Middle].u64_LastTimeStampUs < ou64_StartUs)
+      {
+         u32_Low = u32_Middle + 1U;
+      }
+      else
+      {
+         u32_High = u32_Middle;
+      }
+   }
+   return u32_Low;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read samples of one chunk within time range
+
+   \param[in]      ou32_Chunk     index of chunk
+   \param[in]      ou64_StartUs   start of time range in us (inclusive)
+   \param[in]      ou64_EndUs     end of time range in us (inclusive)
+   \param[in,out]  orc_Samples    samples are appended
+
+   \return
+   C_NO_ERR    samples read
+   C_RD_WR     could not read file
+   C_CHECKSUM  chunk is corrupt
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscDpRecordReader::m_ReadChunk(const uint32_t ou32_Chunk, const uint64_t ou64_StartUs,
+                                         const uint64_t ou64_EndUs, C_Samples & orc_Samples)
+{
+   int32_t s32_Return = C_NO_ERR;
+   const C_OscDpRecordFormat::C_ChunkInfo & rc_Info = this->mc_Chunks[ou32_Chunk];
+   std::vector<uint8_t> c_Header;
+   uint32_t u32_Count = 0U;
+   uint32_t u32_PayloadSize = 0U;
+   uint32_t u32_StoredSize = 0U;
+   const uint8_t * pu8_Payload = NULL;
+
+   if (this->m_ReadFromFile(rc_Info.u64_FileOffset, C_OscDpRecordFormat::hu32_CHUNK_HEADER_SIZE, c_Header) == false)
+   {
+      s32_Return = C_RD_WR;
+   }
+   else
+   {
+      u32_Count = C_OscDpRecordFormat::h_GetU32(&c_Header[4]);
+      u32_PayloadSize = C_OscDpRecordFormat::h_GetU32(&c_Header[24]);
+      u32_StoredSize = C_OscDpRecordFormat::h_GetU32(&c_Header[28]);
+      if ((C_OscDpRecordFormat::h_GetU32(&c_Header[0]) != C_OscDpRecordFormat::hu32_CHUNK_MAGIC) ||
+          (u32_Count != rc_Info.u32_SampleCount) || (u32_Count == 0U) || (u32_StoredSize > u32_PayloadSize) ||
+          ((static_cast<uint64_t>(u32_Count) * (C_OscDpRecordFormat::hu32_TIME_STAMP_COLUMN_ENTRY_SIZE +
+                                                C_OscDpRecordFormat::hu32_CHANNEL_COLUMN_ENTRY_SIZE)) >
+           u32_PayloadSize))
+      {
+         s32_Return = C_CHECKSUM;
+      }
+      else if (this->m_ReadFromFile(rc_Info.u64_FileOffset + C_OscDpRecordFormat::hu32_CHUNK_HEADER_SIZE,
+                                    u32_StoredSize, this->mc_StoredBuffer) == false)
+      {
+         s32_Return = C_RD_WR;
+      }
+      else
+      {
+         uint32_t u32_Crc = 0xFFFFFFFFUL;
+         C_SclChecksums::CalcCRC32((u32_StoredSize > 0U) ? &this->mc_StoredBuffer[0] : NULL, u32_StoredSize,
+                                   u32_Crc);
+         if (u32_Crc != C_OscDpRecordFormat::h_GetU32(&c_Header[32]))
+         {
+            s32_Return = C_CHECKSUM;
+         }
+      }
+   }
+
+   if (s32_Return == C_NO_ERR)
+   {
+      if (u32_StoredSize < u32_PayloadSize)
+      {
+         uint32_t u32_UnzippedSize = u32_PayloadSize;
+         this->mc_PayloadBuffer.resize(u32_PayloadSize);
+         if ((C_OscZipData::h_Unzip(&this->mc_PayloadBuffer[0], u32_UnzippedSize, &this->mc_StoredBuffer[0],
+                                    u32_StoredSize) != C_NO_ERR) || (u32_UnzippedSize != u32_PayloadSize))
+         {
+            s32_Return = C_CHECKSUM;
+         }
+         else
+         {
+            pu8_Payload = &this->mc_PayloadBuffer[0];
+         }
+      }
+      else
+      {
+         pu8_Payload = &this->mc_StoredBuffer[0];
+      }
+   }
+
+   if (s32_Return == C_NO_ERR)
+   {
+      const uint8_t * const pu8_ChannelColumn =
+         &pu8_Payload[u32_Count * C_OscDpRecordFormat::hu32_TIME_STAMP_COLUMN_ENTRY_SIZE];
+      uint32_t u32_ValueOffset = u32_Count * (C_OscDpRecordFormat::hu32_TIME_STAMP_COLUMN_ENTRY_SIZE +
+                                              C_OscDpRecordFormat::hu32_CHANNEL_COLUMN_ENTRY_SIZE);
+
+      for (uint32_t u32_Sample = 0U; (u32_Sample < u32_Count) && (s32_Return == C_NO_ERR); ++u32_Sample)
+      {
+         const uint64_t u64_TimeStamp = rc_Info.u64_FirstTimeStampUs +
+                                        C_OscDpRecordFormat::h_GetU32(
+            &pu8_Payload[u32_Sample * C_OscDpRecordFormat::hu32_TIME_STAMP_COLUMN_ENTRY_SIZE]);
+         const uint16_t u16_Channel = C_OscDpRecordFormat::h_GetU16(
+            &pu8_ChannelColumn[u32_Sample * C_OscDpRecordFormat::hu32_CHANNEL_COLUMN_ENTRY_SIZE]);
+
+         if ((u16_Channel >= this->mc_Channels.size()) ||
+             ((u32_ValueOffset + this->mc_Channels[u16_Channel].u32_ValueSize) > u32_PayloadSize))
+         {
+            s32_Return = C_CHECKSUM;
+         }
+         else
+         {
+            const uint32_t u32_ValueSize = this->mc_Channels[u16_Channel].u32_ValueSize;
+            if ((u64_TimeStamp >= ou64_StartUs) && (u64_TimeStamp <= ou64_EndUs))
+            {
+               orc_Samples.c_TimeStampsUs.push_back(u64_TimeStamp);
+               orc_Samples.c_Channels.push_back(u16_Channel);
+               orc_Samples.c_ValueOffsets.push_back(static_cast<uint32_t>(orc_Samples.c_Values.size()));
+               orc_Samples.c_Values.insert(orc_Samples.c_Values.end(), &pu8_Payload[u32_ValueOffset],
+                                           &pu8_Payload[u32_ValueOffset] + u32_ValueSize);
+            }
+            u32_ValueOffset += u32_ValueSize;
+         }
+      }
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read data from recording file
+
+   \param[in]   ou64_Offset   file offset
+   \param[in]   ou32_Size     number of bytes to read
+   \param[out]  orc_Data      read data (resized to ou32_Size)
+
+   \retval   true    data read
+   \retval   false   could not read (e.g. beyond end of file)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscDpRecordReader::m_ReadFromFile(const uint64_t ou64_Offset, const uint32_t ou32_Size,
+                                         std::vector<uint8_t> & orc_Data)
+{
+   bool q_Return = false;
+
+   if ((ou64_Offset + ou32_Size) <= this->mu64_FileSize)
+   {
+      orc_Data.resize(ou32_Size);
+      this->mc_File.clear();
+      this->mc_File.seekg(static_cast<std::streamoff>(ou64_Offset), std::ios::beg);
+      if (ou32_Size > 0U)
+      {
+         //lint -e{9176} //binary stream interface uses char
+         this->mc_File.read(reinterpret_cast<char_t *>(&orc_Data[0]), ou32_Size);
+      }
+      q_Return = this->mc_File.good();
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Decode one raw value
+
+   \param[in]   ou8_Type             C_OscNodeDataPoolContent::E_Type of value
+   \param[in]   oq_BigEndian         byte order of raw value
+   \param[in]   opu8_Value           raw value (size of type)
+   \param[out]  orq_IsInteger        true: integer type; ors64_IntegerValue holds the exact value
+   \param[out]  ors64_IntegerValue   exact value of integer types (bit pattern for eUINT64)
+
+   \return
+   value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+float64_t C_OscDpRecordReader::mh_GetRawValue(const uint8_t ou8_Type, const bool oq_BigEndian,
+                                              const uint8_t * const opu8_Value, bool & orq_IsInteger,
+                                              int64_t & ors64_IntegerValue)
+{
+   float64_t f64_Value = 0.0;
+   const uint32_t u32_Size = mh_GetTypeSize(ou8_Type);
+   uint64_t u64_Raw = 0ULL;
+
+   for (uint32_t u32_Byte = 0U; u32_Byte < u32_Size; ++u32_Byte)
+   {
+      const uint32_t u32_Shift = (oq_BigEndian == true) ? ((u32_Size - 1U - u32_Byte) * 8U) : (u32_Byte * 8U);
+      u64_Raw |= static_cast<uint64_t>(opu8_Value[u32_Byte]) << u32_Shift;
+   }
+
+   orq_IsInteger = true;
+   switch (static_cast<C_OscNodeDataPoolContent::E_Type>(ou8_Type))
+   {
+   case C_OscNodeDataPoolContent::eUINT8:
+   case C_OscNodeDataPoolContent::eUINT16:
+   case C_OscNodeDataPoolContent::eUINT32:
+      ors64_IntegerValue = static_cast<int64_t>(u64_Raw);
+      f64_Value = static_cast<float64_t>(u64_Raw);
+      break;
+   case C_OscNodeDataPoolContent::eUINT64:
+      ors64_IntegerValue = static_cast<int64_t>(u64_Raw);
+      f64_Value = static_cast<float64_t>(u64_Raw);
+      break;
+   case C_OscNodeDataPoolContent::eSINT8:
+      ors64_IntegerValue = static_cast<int8_t>(static_cast<uint8_t>(u64_Raw));
+      f64_Value = static_cast<float64_t>(ors64_IntegerValue);
+      break;
+   case C_OscNodeDataPoolContent::eSINT16:
+      ors64_IntegerValue = static_cast<int16_t>(static_cast<uint16_t>(u64_Raw));
+      f64_Value = static_cast<float64_t>(ors64_IntegerValue);
+      break;
+   case C_OscNodeDataPoolContent::eSINT32:
+      ors64_IntegerValue = static_cast<int32_t>(static_cast<uint32_t>(u64_Raw));
+      f64_Value = static_cast<float64_t>(ors64_IntegerValue);
+      break;
+   case C_OscNodeDataPoolContent::eSINT64:
+      ors64_IntegerValue = static_cast<int64_t>(u64_Raw);
+      f64_Value = static_cast<float64_t>(ors64_IntegerValue);
+      break;
+   case C_OscNodeDataPoolContent::eFLOAT32:
+      {
+         const uint32_t u32_Raw = static_cast<uint32_t>(u64_Raw);
+         float32_t f32_Value;
+         (void)std::memcpy(&f32_Value, &u32_Raw, sizeof(f32_Value));
+         f64_Value = static_cast<float64_t>(f32_Value);
+         orq_IsInteger = false;
+         ors64_IntegerValue = 0;
+      }
+      break;
+   case C_OscNodeDataPoolContent::eFLOAT64:
+      (void)std::memcpy(&f64_Value, &u64_Raw, sizeof(f64_Value));
+      orq_IsInteger = false;
+      ors64_IntegerValue = 0;
+      break;
+   default:
+      orq_IsInteger = false;
+      ors64_IntegerValue = 0;
+      break;
+   }
+   return f64_Value;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get size of one value of type
+
+   \param[in]  ou8_Type    C_OscNodeDataPoolContent::E_Type
+
+   \return
+   size in bytes (0 for unknown types)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscDpRecordReader::mh_GetTypeSize(const uint8_t ou8_Type)
+{
+   uint32_t u32_Size;
+
+   switch (static_cast<C_OscNodeDataPoolContent::E_Type>(ou8_Type))
+   {
+   case C_OscNodeDataPoolContent::eUINT8:
+   case C_OscNodeDataPoolContent::eSINT8:
+      u32_Size = 1U;
+      break;
+   case C_OscNodeDataPoolContent::eUINT16:
+   case C_OscNodeDataPoolContent::eSINT16:
+      u32_Size = 2U;
+      break;
+   case C_OscNodeDataPoolContent::eUINT32:
+   case C_OscNodeDataPoolContent::eSINT32:
+   case C_OscNodeDataPoolContent::eFLOAT32:
+      u32_Size = 4U;
+      break;
+   case C_OscNodeDataPoolContent::eUINT64:
+   case C_OscNodeDataPoolContent::eSINT64:
+   case C_OscNodeDataPoolContent::eFLOAT64:
+      u32_Size = 8U;
+      break;
+   default:
+      u32_Size = 0U;
+      break;
+   }
+   return u32_Size;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Append one CSV field; fields containing separators or quotes are quoted
+
+   \param[in]      orc_Field    Field content
+   \param[in,out]  orc_Output   Output buffer
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_AppendCsvField(const C_SclString & orc_Field, std::string & orc_Output)
+{
+   const std::string & rc_Field = *orc_Field.AsStdString();
+
+   if (rc_Field.find_first_of(";\"\n") == std::string::npos)
+   {
+      orc_Output += rc_Field;
+   }
+   else
+   {
+      orc_Output += '"';
+      for (uint32_t u32_Pos = 0U; u32_Pos < rc_Field.size(); ++u32_Pos)
+      {
+         if (rc_Field[u32_Pos] == '"')
+         {
+            orc_Output += '"';
+         }
+         orc_Output += rc_Field[u32_Pos];
+      }
+      orc_Output += '"';
+   }
+}
@@ -0,0 +1,97 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Reader for Datapool recordings (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCDPRECORDREADER_HPP
+#define C_OSCDPRECORDREADER_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
+#include <fstream>
+
+#include "stwtypes.hpp"
+#include "C_SclString.hpp"
+#include "C_OscDpRecordFormat.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_OscDpRecordReader
+{
+public:
+   ///Samples read from a recording, stored column by column
+   class C_Samples
+   {
+   public:
+      void Clear(void);
+
+      std::vector<uint64_t> c_TimeStampsUs;
+      std::vector<uint16_t> c_Channels;
+      std::vector<uint32_t> c_ValueOffsets; ///< Offset of the value of each sample within c_Values
+      std::vector<uint8_t> c_Values;
+   };
+
+   C_OscDpRecordReader(void);
+   virtual ~C_OscDpRecordReader(void);
+
+   int32_t Open(const stw::scl::C_SclString & orc_FilePath);
+   void Close(void);
+
+   const std::vector<C_OscDpRecordFormat::C_Channel> & GetChannels(void) const;
+   const std::vector<C_OscDpRecordFormat::C_ChunkInfo> & GetChunks(void) const;
+   const stw::scl::C_SclString & GetStartTime(void) const;
+   bool IsIndexRecovered(void) const;
+   uint64_t GetSampleCount(void) const;
+
+   int32_t ReadSamples(const uint64_t ou64_StartUs, const uint64_t ou64_EndUs, C_Samples & orc_Samples);
+   int32_t ExportCsv(const stw::scl::C_SclString & orc_CsvPath, const uint64_t ou64_StartUs,
+                     const uint64_t ou64_EndUs);
+
+   static stw::scl::C_SclString h_FormatValue(const C_OscDpRecordFormat::C_Channel & orc_Channel,
+                                              const uint8_t * const opu8_Value);
+
+private:
+   //Avoid call
+   C_OscDpRecordReader(const C_OscDpRecordReader &);
+   C_OscDpRecordReader & operator =(const C_OscDpRecordReader &);
+
+   int32_t m_ReadHeader(void);
+   int32_t m_ReadIndex(void);
+   void m_RecoverIndex(void);
+   uint32_t m_GetFirstChunk(const uint64_t ou64_StartUs) const;
+   int32_t m_ReadChunk(const uint32_t ou32_Chunk, const uint64_t ou64_StartUs, const uint64_t ou64_EndUs,
+                       C_Samples & orc_Samples);
+   bool m_ReadFromFile(const uint64_t ou64_Offset, const uint32_t ou32_Size, std::vector<uint8_t> & orc_Data);
+
+   static float64_t mh_GetRawValue(const uint8_t ou8_Type, const bool oq_BigEndian, const uint8_t * const opu8_Value,
+                                   bool & orq_IsInteger, int64_t & ors64_IntegerValue);
+   static uint32_t mh_GetTypeSize(const uint8_t ou8_Type);
+
+   std::ifstream mc_File;
+   uint64_t mu64_FileSize;
+   uint64_t mu64_DataOffset; ///< Offset of first chunk
+   stw::scl::C_SclString mc_StartTime;
+   std::vector<C_OscDpRecordFormat::C_Channel> mc_Channels;
+   std::vector<C_OscDpRecordFormat::C_ChunkInfo> mc_Chunks;
+   bool mq_IndexRecovered;
+   std::vector<uint8_t> mc_StoredBuffer;
+   std::vector<uint8_t> mc_PayloadBuffer;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
@@ -0,0 +1,675 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Writer for Datapool recordings
+
+   Appends samples of Datapool elements to a recording file (see C_OscDpRecordFormat for the file layout).
+
+   Samples are collected column by column in a preallocated chunk buffer. Adding a sample only copies the time stamp,
+   the channel index and the raw value; it never allocates memory.
+   Full chunks are handed to a writer thread which serializes, optionally compresses and writes them.
+   If the writer thread has not finished the previous chunk when the next one is full, the producer waits.
+   So no sample is dropped; the waits are counted in the statistics.
+
+   A chunk is also written if it is older than mhu32_MAX_CHUNK_AGE_MS. So if the recording is interrupted only the
+   most recent samples are lost.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <cstring>
+#include <chrono>
+
+#include "stwtypes.hpp"
+#include "stwerrors.hpp"
+#include "TglFile.hpp"
+#include "TglTime.hpp"
+#include "C_SclChecksums.hpp"
+#include "C_OscUtils.hpp"
+#include "C_OscZipData.hpp"
+#include "C_OscLoggingHandler.hpp"
+#include "C_OscDpRecordWriter.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::scl;
+using namespace stw::tgl;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint32_t C_OscDpRecordWriter::mhu32_MAX_CHUNK_AGE_MS = 1000U;
+//time stamps within a chunk are stored as 32 bit offsets in us
+const uint64_t C_OscDpRecordWriter::mhu64_MAX_CHUNK_SPAN_US = 0xFFFFFFFFULL;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscDpRecordWriterStatistics::C_OscDpRecordWriterStatistics(void) :
+   u64_SamplesWritten(0ULL),
+   u64_SamplesLost(0ULL),
+   u64_BytesWritten(0ULL),
+   u32_ChunksWritten(0U),
+   u32_ProducerBlocks(0U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscDpRecordWriter::C_Chunk::C_Chunk(void) :
+   u32_SampleCount(0U),
+   u32_ValueBytes(0U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Exchange content with other chunk without copying the buffers
+
+   \param[in,out]  orc_Other  other chunk
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDpRecordWriter::C_Chunk::Swap(C_Chunk & orc_Other)
+{
+   const uint32_t u32_SampleCount = this->u32_SampleCount;
+   const uint32_t u32_ValueBytes = this->u32_ValueBytes;
+
+   this->c_TimeStampsUs.swap(orc_Other.c_TimeStampsUs);
+   this->c_Channels.swap(orc_Other.c_Channels);
+   this->c_Values.swap(orc_Other.c_Values);
+   this->u32_SampleCount = orc_Other.u32_SampleCount;
+   this->u32_ValueBytes = orc_Other.u32_ValueBytes;
+   orc_Other.u32_SampleCount = u32_SampleCount;
+   orc_Other.u32_ValueBytes = u32_ValueBytes;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscDpRecordWriter::C_OscDpRecordWriter(void) :
+   mu32_ChunkSampleCount(hu32_DEFAULT_CHUNK_SAMPLE_COUNT),
+   mq_Compress(false),
+   mu64_FileOffset(0ULL),
+   mq_WriterRunning(false),
+   mq_StopRequested(false),
+   mq_FlushRequested(false),
+   mq_BackChunkPending(false),
+   ms32_WriteResult(C_NO_ERR)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default destructor
+
+   Writes all buffered samples and closes the file.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscDpRecordWriter::~C_OscDpRecordWriter(void)
+{
+   try
+   {
+      (void)this->Close();
+   }
+   catch (...)
+   {
+      //not much we can do here ...
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create recording file and start writer thread
+
+   An existing file is overwritten. A recording that is still open is closed first.
+
+   \param[in]  orc_FilePath            path of recording file
+   \param[in]  orc_Channels            recorded Datapool elements; the index within this vector is the channel index
+                                       to pass to AddSample
+   \param[in]  oq_Compress             true: compress chunks
+   \param[in]  ou32_ChunkSampleCount   maximum number of samples per chunk
+
+   \return
+   C_NO_ERR    file created
+   C_RANGE     no channel, too many channels, channel without value size or chunk size zero
+   C_RD_WR     could not create folder or file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscDpRecordWriter::Open(const C_SclString & orc_FilePath,
+                                  const std::vector<C_OscDpRecordFormat::C_Channel> & orc_Channels,
+                                  const bool oq_Compress, const uint32_t ou32_ChunkSampleCount)
+{
+   int32_t s32_Return = C_NO_ERR;
+   uint32_t u32_MaxValueSize = 0U;
+
+   (void)this->Close();
+
+   if ((orc_Channels.size() == 0U) || (orc_Channels.size() > 0xFFFFU) || (ou32_ChunkSampleCount == 0U))
+   {
+      s32_Return = C_RANGE;
+   }
+   else
+   {
+      this->mc_ValueSizes.resize(orc_Channels.size());
+      for (uint32_t u32_Channel = 0U; u32_Channel < orc_Channels.size(); ++u32_Channel)
+      {
+         const uint32_t u32_ValueSize = orc_Channels[u32_Channel].u32_ValueSize;
+         if (u32_ValueSize == 0U)
+         {
+            s32_Return = C_RANGE;
+         }
+         else if (u32_ValueSize > u32_MaxValueSize)
+         {
+            u32_MaxValueSize = u32_ValueSize;
+         }
+         else
+         {
+            //nothing to do
+         }
+         this->mc_ValueSizes[u32_Channel] = u32_ValueSize;
+      }
+   }
+
+   if (s32_Return == C_NO_ERR)
+   {
+      const C_SclString c_FolderPath = TglExtractFilePath(orc_FilePath);
+      if ((c_FolderPath != "") && (TglDirectoryExists(c_FolderPath) == false))
+      {
+         if (C_OscUtils::h_CreateFolderRecursively(c_FolderPath) != C_NO_ERR)
+         {
+            s32_Return = C_RD_WR;
+         }
+      }
+   }
+
+   if (s32_Return == C_NO_ERR)
+   {
+      this->mc_File.open(orc_FilePath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+      if (this->mc_File.is_open() == false)
+      {
+         osc_write_log_error("Datapool Recorder", "Could not create recording file \"" + orc_FilePath + "\".");
+         s32_Return = C_RD_WR;
+      }
+   }
+
+   if (s32_Return == C_NO_ERR)
+   {
+      std::vector<uint8_t> c_Header;
+      C_TglDateTime c_StartTime;
+
+      TglGetDateTimeNow(c_StartTime);
+      C_OscDpRecordFormat::h_AppendU32(C_OscDpRecordFormat::hu32_FILE_MAGIC, c_Header);
+      C_OscDpRecordFormat::h_AppendU32(C_OscDpRecordFormat::hu32_FORMAT_VERSION, c_Header);
+      C_OscDpRecordFormat::h_AppendU32((oq_Compress == true) ? C_OscDpRecordFormat::hu32_FLAG_COMPRESSED : 0U,
+                                       c_Header);
+      C_OscDpRecordFormat::h_AppendU32(ou32_ChunkSampleCount, c_Header);
+      C_OscDpRecordFormat::h_AppendString(C_OscLoggingHandler::h_UtilConvertDateTimeToString(c_StartTime).c_str(),
+                                          c_Header);
+      C_OscDpRecordFormat::h_AppendU32(static_cast<uint32_t>(orc_Channels.size()), c_Header);
+      for (uint32_t u32_Channel = 0U; u32_Channel < orc_Channels.size(); ++u32_Channel)
+      {
+         C_OscDpRecordFormat::h_AppendChannel(orc_Channels[u32_Channel], c_Header);
+      }
+
+      this->mu64_FileOffset = 0ULL;
+      this->ms32_WriteResult = C_NO_ERR;
+      this->mc_Statistics = C_OscDpRecordWriterStatistics();
+      this->mc_Index.clear();
+      s32_Return = this->m_WriteToFile(&c_Header[0], static_cast<uint32_t>(c_Header.size()));
+      if (s32_Return != C_NO_ERR)
+      {
+         this->mc_File.close();
+      }
+      this->mc_Statistics.u64_BytesWritten = this->mu64_FileOffset;
+   }
+
+   if (s32_Return == C_NO_ERR)
+   {
+      const uint32_t u32_MaxValueBytes = ou32_ChunkSampleCount * u32_MaxValueSize;
+      const uint32_t u32_MaxPayloadSize = (ou32_ChunkSampleCount *
+                                           (C_OscDpRecordFormat::hu32_TIME_STAMP_COLUMN_ENTRY_SIZE +
+                                            C_OscDpRecordFormat::hu32_CHANNEL_COLUMN_ENTRY_SIZE)) +
+                                          u32_MaxValueBytes;
+
+      this->mu32_ChunkSampleCount = ou32_ChunkSampleCount;
+      this->mq_Compress = oq_Compress;
+
+      this->mc_FrontChunk.c_TimeStampsUs.resize(ou32_ChunkSampleCount);
+      this->mc_FrontChunk.c_Channels.resize(ou32_ChunkSampleCount);
+      this->mc_FrontChunk.c_Values.resize(u32_MaxValueBytes);
+      this->mc_FrontChunk.u32_SampleCount = 0U;
+      this->mc_FrontChunk.u32_ValueBytes = 0U;
+      this->mc_BackChunk.c_TimeStampsUs.resize(ou32_ChunkSampleCount);
+      this->mc_BackChunk.c_Channels.resize(ou32_ChunkSampleCount);
+      this->mc_BackChunk.c_Values.resize(u32_MaxValueBytes);
+      this->mc_BackChunk.u32_SampleCount = 0U;
+      this->mc_BackChunk.u32_ValueBytes = 0U;
+      this->mc_Payload.resize(u32_MaxPayloadSize);
+      if (oq_Compress == true)
+      {
+         this->mc_Compressed.resize(C_OscZipData::h_GetRequiredBufSizeForZipping(u32_MaxPayloadSize));
+      }
+
+      {
+         const std::lock_guard<std::mutex> c_Lock(this->mc_BufferMutex);
+         this->mq_StopRequested = false;
+         this->mq_FlushRequested = false;
+         this->mq_BackChunkPending = false;
+         this->mq_WriterRunning = true;
+         this->mc_WriterThread = std::thread(&C_OscDpRecordWriter::m_WriterThread, this);
+      }
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Add one sample
+
+   Only copies the sample into the current chunk; does not allocate memory.
+   If the chunk is full while the writer thread is still busy with the previous one, this function waits.
+
+   \param[in]  ou16_Channel       channel index (index within channels passed to Open)
+   \param[in]  ou64_TimeStampUs   time stamp of sample in us; must not decrease from sample to sample
+   \param[in]  opu8_Value         raw value
+   \param[in]  ou32_ValueSize     size of opu8_Value in bytes; only the value size of the channel is recorded
+
+   \return
+   C_NO_ERR    sample added
+   C_CONFIG    no recording open
+   C_RANGE     unknown channel or value smaller than value size of channel
+   C_RD_WR     sample added but writing to the file failed before; samples are lost
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscDpRecordWriter::AddSample(const uint16_t ou16_Channel, const uint64_t ou64_TimeStampUs,
+                                       const uint8_t * const opu8_Value, const uint32_t ou32_ValueSize)
+{
+   int32_t s32_Return = C_NO_ERR;
+
+   std::unique_lock<std::mutex> c_Lock(this->mc_BufferMutex);
+
+   if (this->mq_WriterRunning == false)
+   {
+      s32_Return = C_CONFIG;
+   }
+   else if ((ou16_Channel >= this->mc_ValueSizes.size()) || (opu8_Value == NULL) ||
+            (ou32_ValueSize < this->mc_ValueSizes[ou16_Channel]))
+   {
+      s32_Return = C_RANGE;
+   }
+   else
+   {
+      const uint32_t u32_ValueSize = this->mc_ValueSizes[ou16_Channel];
+      bool q_ChunkAvailable = true;
+
+      if ((this->mc_FrontChunk.u32_SampleCount >= this->mu32_ChunkSampleCount) ||
+          ((this->mc_FrontChunk.u32_SampleCount > 0U) &&
+           ((ou64_TimeStampUs < this->mc_FrontChunk.c_TimeStampsUs[0]) ||
+            ((ou64_TimeStampUs - this->mc_FrontChunk.c_TimeStampsUs[0]) > mhu64_MAX_CHUNK_SPAN_US))))
+      {
+         if (this->mq_BackChunkPending == true)
+         {
+            ++this->mc_Statistics.u32_ProducerBlocks;
+            while ((this->mq_BackChunkPending == true) && (this->mq_WriterRunning == true))
+            {
+               this->mc_SpaceAvailable.wait(c_Lock);
+            }
+         }
+         if (this->mq_BackChunkPending == false)
+         {
+            this->m_HandOverFrontChunk();
+         }
+         else
+         {
+            //writer thread stopped while waiting
+            q_ChunkAvailable = false;
+         }
+      }
+
+      if (q_ChunkAvailable == true)
+      {
+         C_Chunk & rc_Chunk = this->mc_FrontChunk;
+         const uint32_t u32_Sample = rc_Chunk.u32_SampleCount;
+
+         rc_Chunk.c_TimeStampsUs[u32_Sample] = ou64_TimeStampUs;
+         rc_Chunk.c_Channels[u32_Sample] = ou16_Channel;
+         (void)std::memcpy(&rc_Chunk.c_Values[rc_Chunk.u32_ValueBytes], opu8_Value, u32_ValueSize);
+         rc_Chunk.u32_ValueBytes += u32_ValueSize;
+         ++rc_Chunk.u32_SampleCount;
+
+         s32_Return = this->ms32_WriteResult;
+      }
+      else
+      {
+         s32_Return = C_CONFIG;
+      }
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Waits till all added samples are written to the file
+
+   Returns immediately if no recording is open.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDpRecordWriter::Flush(void)
+{
+   std::unique_lock<std::mutex> c_Lock(this->mc_BufferMutex);
+
+   if (this->mq_WriterRunning == true)
+   {
+      this->mq_FlushRequested = true;
+      this->mc_DataAvailable.notify_one();
+      while (((this->mc_FrontChunk.u32_SampleCount > 0U) || (this->mq_BackChunkPending == true)) &&
+             (this->mq_WriterRunning == true))
+      {
+         this->mc_SpaceAvailable.wait(c_Lock);
+      }
+      this->mq_FlushRequested = false;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write all buffered samples and the chunk index and close the file
+
+   \return
+   C_NO_ERR    file closed (or no file open)
+   C_RD_WR     writing to the file failed; samples are lost
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscDpRecordWriter::Close(void)
+{
+   int32_t s32_Return;
+
+   {
+      const std::lock_guard<std::mutex> c_Lock(this->mc_BufferMutex);
+      this->mq_StopRequested = true;
+      this->mc_DataAvailable.notify_one();
+   }
+
+   if (this->mc_WriterThread.joinable() == true)
+   {
+      this->mc_WriterThread.join();
+   }
+
+   {
+      const std::lock_guard<std::mutex> c_Lock(this->mc_BufferMutex);
+      this->mq_WriterRunning = false;
+      this->mc_SpaceAvailable.notify_all();
+      s32_Return = this->ms32_WriteResult;
+   }
+
+   if (this->mc_File.is_open() == true)
+   {
+      if (s32_Return == C_NO_ERR)
+      {
+         s32_Return = this->m_WriteIndex();
+      }
+      this->mc_File.close();
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check if a recording is open
+
+   \retval   true    recording open
+   \retval   false   no recording open
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscDpRecordWriter::IsOpen(void) const
+{
+   return this->mc_File.is_open();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Returns the current writer statistics
+
+   \return
+   Copy of statistics
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscDpRecordWriterStatistics C_OscDpRecordWriter::GetStatistics(void)
+{
+   const std::lock_guard<std::mutex> c_Lock(this->mc_BufferMutex);
+
+   return this->mc_Statistics;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Writer thread function
+
+   Writes the back chunk outside of the lock.
+   If no full chunk was handed over for mhu32_MAX_CHUNK_AGE_MS the partly filled front chunk is written.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDpRecordWriter::m_WriterThread(void)
+{
+   std::unique_lock<std::mutex> c_Lock(this->mc_BufferMutex);
+   bool q_Stop = false;
+
+   while (q_Stop == false)
+   {
+      if ((this->mq_BackChunkPending == false) && (this->mq_StopRequested == false) &&
+          ((this->mq_FlushRequested == false) || (this->mc_FrontChunk.u32_SampleCount == 0U)))
+      {
+         //lint -e{8080} //using type expected by the library for compatibility
+         this->mc_DataAvailable.wait_for(c_Lock, std::chrono::milliseconds(mhu32_MAX_CHUNK_AGE_MS));
+      }
+
+      if ((this->mq_BackChunkPending == false) && (this->mc_FrontChunk.u32_SampleCount > 0U))
+      {
+         this->m_HandOverFrontChunk();
+      }
+
+      if (this->mq_BackChunkPending == true)
+      {
+         int32_t s32_Result;
+         const uint32_t u32_SampleCount = this->mc_BackChunk.u32_SampleCount;
+         const uint64_t u64_PreviousFileOffset = this->mu64_FileOffset;
+
+         c_Lock.unlock();
+         try
+         {
+            s32_Result = this->m_WriteChunk(this->mc_BackChunk);
+         }
+         catch (...)
+         {
+            s32_Result = C_RD_WR;
+         }
+         c_Lock.lock();
+
+         this->mc_Statistics.u64_BytesWritten += this->mu64_FileOffset - u64_PreviousFileOffset;
+         if (s32_Result == C_NO_ERR)
+         {
+            this->mc_Statistics.u64_SamplesWritten += u32_SampleCount;
+            ++this->mc_Statistics.u32_ChunksWritten;
+         }
+         else
+         {
+            this->mc_Statistics.u64_SamplesLost += u32_SampleCount;
+            this->ms32_WriteResult = C_RD_WR;
+         }
+         this->mc_BackChunk.u32_SampleCount = 0U;
+         this->mc_BackChunk.u32_ValueBytes = 0U;
+         this->mq_BackChunkPending = false;
+         this->mc_SpaceAvailable.notify_all();
+      }
+      else
+      {
+         q_Stop = this->mq_StopRequested;
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Hand front chunk to writer thread
+
+   Caller must hold the buffer lock and make sure the back chunk is not pending.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDpRecordWriter::m_HandOverFrontChunk(void)
+{
+   if ((this->mq_BackChunkPending == false) && (this->mc_FrontChunk.u32_SampleCount > 0U))
+   {
+      this->mc_FrontChunk.Swap(this->mc_BackChunk);
+      this->mq_BackChunkPending = true;
+      this->mc_DataAvailable.notify_one();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Serialize, compress and write one chunk
+
+   Called by the writer thread without holding the buffer lock.
+
+   \param[in]  orc_Chunk   chunk to write
+
+   \return
+   C_NO_ERR    chunk written
+   C_RD_WR     could not write to file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscDpRecordWriter::m_WriteChunk(const C_Chunk & orc_Chunk)
+{
+   int32_t s32_Return;
+   const uint32_t u32_Count = orc_Chunk.u32_SampleCount;
+   const uint64_t u64_FirstTimeStamp = orc_Chunk.c_TimeStampsUs[0];
+   uint8_t * const pu8_Payload = &this->mc_Payload[0];
+   uint8_t * const pu8_ChannelColumn = &pu8_Payload[u32_Count * C_OscDpRecordFormat::hu32_TIME_STAMP_COLUMN_ENTRY_SIZE];
+   const uint32_t u32_ValueColumnOffset = u32_Count * (C_OscDpRecordFormat::hu32_TIME_STAMP_COLUMN_ENTRY_SIZE +
+                                                       C_OscDpRecordFormat::hu32_CHANNEL_COLUMN_ENTRY_SIZE);
+   const uint32_t u32_PayloadSize = u32_ValueColumnOffset + orc_Chunk.u32_ValueBytes;
+   const uint8_t * pu8_Stored = pu8_Payload;
+   uint32_t u32_StoredSize = u32_PayloadSize;
+   uint32_t u32_Crc = 0xFFFFFFFFUL;
+   uint8_t au8_Header[C_OscDpRecordFormat::hu32_CHUNK_HEADER_SIZE];
+   C_OscDpRecordFormat::C_ChunkInfo c_Info;
+
+   for (uint32_t u32_Sample = 0U; u32_Sample < u32_Count; ++u32_Sample)
+   {
+      C_OscDpRecordFormat::h_SetU32(static_cast<uint32_t>(orc_Chunk.c_TimeStampsUs[u32_Sample] - u64_FirstTimeStamp),
+                                    &pu8_Payload[u32_Sample * C_OscDpRecordFormat::hu32_TIME_STAMP_COLUMN_ENTRY_SIZE]);
+      C_OscDpRecordFormat::h_SetU16(orc_Chunk.c_Channels[u32_Sample],
+                                    &pu8_ChannelColumn[u32_Sample *
+                                                       C_OscDpRecordFormat::hu32_CHANNEL_COLUMN_ENTRY_SIZE]);
+   }
+   if (orc_Chunk.u32_ValueBytes > 0U)
+   {
+      (void)std::memcpy(&pu8_Payload[u32_ValueColumnOffset], &orc_Chunk.c_Values[0], orc_Chunk.u32_ValueBytes);
+   }
+
+   if (this->mq_Compress == true)
+   {
+      uint32_t u32_CompressedSize = static_cast<uint32_t>(this->mc_Compressed.size());
+      if ((C_OscZipData::h_Zip(&this->mc_Compressed[0], u32_CompressedSize, pu8_Payload,
+                               u32_PayloadSize) == C_NO_ERR) && (u32_CompressedSize < u32_PayloadSize))
+      {
+         pu8_Stored = &this->mc_Compressed[0];
+         u32_StoredSize = u32_CompressedSize;
+      }
+   }
+   C_SclChecksums::CalcCRC32(pu8_Stored, u32_StoredSize, u32_Crc);
+
+   c_Info.u64_FirstTimeStampUs = u64_FirstTimeStamp;
+   c_Info.u64_LastTimeStampUs = orc_Chunk.c_TimeStampsUs[u32_Count - 1U];
+   c_Info.u64_FileOffset = this->mu64_FileOffset;
+   c_Info.u32_SampleCount = u32_Count;
+
+   C_OscDpRecordFormat::h_SetU32(C_OscDpRecordFormat::hu32_CHUNK_MAGIC, &au8_Header[0]);
+   C_OscDpRecordFormat::h_SetU32(u32_Count, &au8_Header[4]);
+   C_OscDpRecordFormat::h_SetU64(c_Info.u64_FirstTimeStampUs, &au8_Header[8]);
+   C_OscDpRecordFormat::h_SetU64(c_Info.u64_LastTimeStampUs, &au8_Header[16]);
+   C_OscDpRecordFormat::h_SetU32(u32_PayloadSize, &au8_Header[24]);
+   C_OscDpRecordFormat::h_SetU32(u32_StoredSize, &au8_Header[28]);
+   C_OscDpRecordFormat::h_SetU32(u32_Crc, &au8_Header[32]);
+
+   s32_Return = this->m_WriteToFile(&au8_Header[0], C_OscDpRecordFormat::hu32_CHUNK_HEADER_SIZE);
+   if (s32_Return == C_NO_ERR)
+   {
+      s32_Return = this->m_WriteToFile(pu8_Stored, u32_StoredSize);
+   }
+   if (s32_Return == C_NO_ERR)
+   {
+      this->mc_File.flush();
+      this->mc_Index.push_back(c_Info);
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write chunk index and trailer
+
+   \return
+   C_NO_ERR    index written
+   C_RD_WR     could not write to file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscDpRecordWriter::m_WriteIndex(void)
+{
+   const uint64_t u64_IndexOffset = this->mu64_FileOffset;
+   std::vector<uint8_t> c_Index;
+
+   c_Index.reserve(8U + (this->mc_Index.size() * C_OscDpRecordFormat::hu32_INDEX_ENTRY_SIZE) +
+                   C_OscDpRecordFormat::hu32_TRAILER_SIZE);
+   C_OscDpRecordFormat::h_AppendU32(C_OscDpRecordFormat::hu32_INDEX_MAGIC, c_Index);
+   C_OscDpRecordFormat::h_AppendU32(static_cast<uint32_t>(this->mc_Index.size()), c_Index);
+   for (uint32_t u32_Chunk = 0U; u32_Chunk < this->mc_Index.size(); ++u32_Chunk)
+   {
+      const C_OscDpRecordFormat::C_ChunkInfo & rc_Info = this->mc_Index[u32_Chunk];
+      C_OscDpRecordFormat::h_AppendU64(rc_Info.u64_FirstTimeStampUs, c_Index);
+      C_OscDpRecordFormat::h_AppendU64(rc_Info.u64_LastTimeStampUs, c_Index);
+      C_OscDpRecordFormat::h_AppendU64(rc_Info.u64_FileOffset, c_Index);
+      C_OscDpRecordFormat::h_AppendU32(rc_Info.u32_SampleCount, c_Index);
+   }
+   C_OscDpRecordFormat::h_AppendU64(u64_IndexOffset, c_Index);
+   C_OscDpRecordFormat::h_AppendU32(C_OscDpRecordFormat::hu32_END_MAGIC, c_Index);
+
+   return this->m_WriteToFile(&c_Index[0], static_cast<uint32_t>(c_Index.size()));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Append data to file
+
+   \param[in]  opu8_Data   data
+   \param[in]  ou32_Size   size of data in bytes
+
+   \return
+   C_NO_ERR    data written
+   C_RD_WR     could not write to file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscDpRecordWriter::m_WriteToFile(const uint8_t * const opu8_Data, const uint32_t ou32_Size)
+{
+   int32_t s32_Return = C_NO_ERR;
+
+   //lint -e{9176} //binary stream interface uses char
+   this->mc_File.write(reinterpret_cast<const char_t *>(opu8_Data), ou32_Size);
+   if (this->mc_File.good() == false)
+   {
+      s32_Return = C_RD_WR;
+   }
+   else
+   {
+      this->mu64_FileOffset += ou32_Size;
+   }
+   return s32_Return;
+}
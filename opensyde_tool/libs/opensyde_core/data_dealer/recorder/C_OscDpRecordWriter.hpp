@@ -0,0 +1,123 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Writer for Datapool recordings (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCDPRECORDWRITER_HPP
+#define C_OSCDPRECORDWRITER_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
+#include <fstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "stwtypes.hpp"
+#include "C_SclString.hpp"
+#include "C_OscDpRecordFormat.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_OscDpRecordWriterStatistics
+{
+public:
+   C_OscDpRecordWriterStatistics(void);
+
+   uint64_t u64_SamplesWritten;  ///< Number of samples written to the file
+   uint64_t u64_SamplesLost;     ///< Number of samples lost because the file could not be written
+   uint64_t u64_BytesWritten;    ///< Number of bytes written to the file
+   uint32_t u32_ChunksWritten;   ///< Number of chunks written to the file
+   uint32_t u32_ProducerBlocks;  ///< Number of times the producer had to wait for the writer thread
+};
+
+class C_OscDpRecordWriter
+{
+public:
+   C_OscDpRecordWriter(void);
+   virtual ~C_OscDpRecordWriter(void);
+
+   int32_t Open(const stw::scl::C_SclString & orc_FilePath,
+                const std::vector<C_OscDpRecordFormat::C_Channel> & orc_Channels, const bool oq_Compress,
+                const uint32_t ou32_ChunkSampleCount = hu32_DEFAULT_CHUNK_SAMPLE_COUNT);
+   int32_t AddSample(const uint16_t ou16_Channel, const uint64_t ou64_TimeStampUs, const uint8_t * const opu8_Value,
+                     const uint32_t ou32_ValueSize);
+   void Flush(void);
+   int32_t Close(void);
+
+   bool IsOpen(void) const;
+   C_OscDpRecordWriterStatistics GetStatistics(void);
+
+   static const uint32_t hu32_DEFAULT_CHUNK_SAMPLE_COUNT = 8192U;
+
+private:
+   ///Column buffers of one chunk; allocated on Open so adding a sample never allocates
+   class C_Chunk
+   {
+   public:
+      C_Chunk(void);
+
+      void Swap(C_Chunk & orc_Other);
+
+      std::vector<uint64_t> c_TimeStampsUs;
+      std::vector<uint16_t> c_Channels;
+      std::vector<uint8_t> c_Values;
+      uint32_t u32_SampleCount;
+      uint32_t u32_ValueBytes;
+   };
+
+   //Avoid call
+   C_OscDpRecordWriter(const C_OscDpRecordWriter &);
+   C_OscDpRecordWriter & operator =(const C_OscDpRecordWriter &);
+
+   void m_WriterThread(void);
+   void m_HandOverFrontChunk(void);
+   int32_t m_WriteChunk(const C_Chunk & orc_Chunk);
+   int32_t m_WriteIndex(void);
+   int32_t m_WriteToFile(const uint8_t * const opu8_Data, const uint32_t ou32_Size);
+
+   std::ofstream mc_File;
+   std::vector<uint32_t> mc_ValueSizes; ///< Value size of each channel
+   uint32_t mu32_ChunkSampleCount;
+   bool mq_Compress;
+   uint64_t mu64_FileOffset;
+   std::vector<C_OscDpRecordFormat::C_ChunkInfo> mc_Index;
+
+   // Double buffer: the producer fills the front chunk, the writer thread compresses and writes the back chunk
+   C_Chunk mc_FrontChunk;
+   C_Chunk mc_BackChunk;
+   std::vector<uint8_t> mc_Payload;    ///< Serialized columns (writer thread only)
+   std::vector<uint8_t> mc_Compressed; ///< Compressed payload (writer thread only)
+
+   std::mutex mc_BufferMutex;
+   std::condition_variable mc_DataAvailable;
+   std::condition_variable mc_SpaceAvailable;
+   std::thread mc_WriterThread;
+   bool mq_WriterRunning;
+   bool mq_StopRequested;
+   bool mq_FlushRequested;
+   bool mq_BackChunkPending;
+   int32_t ms32_WriteResult;
+   C_OscDpRecordWriterStatistics mc_Statistics;
+
+   static const uint32_t mhu32_MAX_CHUNK_AGE_MS;
+   static const uint64_t mhu64_MAX_CHUNK_SPAN_US;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
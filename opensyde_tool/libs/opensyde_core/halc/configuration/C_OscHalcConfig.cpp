@@ -39,7 +39,9 @@ using namespace stw::opensyde_core;
 */
 //----------------------------------------------------------------------------------------------------------------------
 C_OscHalcConfig::C_OscHalcConfig(void) :
-   C_OscHalcDefBase()
+   C_OscHalcDefBase(),
+   mq_ChangeTrackingValid(false),
+   mu32_ChangeTrackingLayoutHash(0UL)
 {
 }
 
@@ -105,6 +107,7 @@ void C_OscHalcConfig::Clear()
 {
    C_OscHalcDefBase::Clear();
    this->mc_Domains.clear();
+   this->InvalidateChangeTracking();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -135,6 +138,7 @@ bool C_OscHalcConfig::IsClear(void) const
 void C_OscHalcConfig::AddDomain(const C_OscHalcDefDomain & orc_Domain)
 {
    this->mc_Domains.push_back(orc_Domain);
+   this->InvalidateChangeTracking();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -147,6 +151,7 @@ void C_OscHalcConfig::HandleFileLoadPostProcessing(void)
    {
       this->mc_Domains[u32_It].HandleFileLoadPostProcessing(this->e_SafetyMode);
    }
+   this->InvalidateChangeTracking();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -166,7 +171,26 @@ int32_t C_OscHalcConfig::SetDomainConfig(const uint32_t ou32_Index, const C_OscH
 
    if (ou32_Index < this->mc_Domains.size())
    {
-      this->mc_Domains[ou32_Index] = orc_Domain;
+      C_OscHalcConfigDomain & rc_Domain = this->mc_Domains[ou32_Index];
+      bool q_SameSafety = (rc_Domain.c_ChannelConfigs.size() == orc_Domain.c_ChannelConfigs.size()) &&
+                          (rc_Domain.c_DomainConfig.q_SafetyRelevant == orc_Domain.c_DomainConfig.q_SafetyRelevant);
+
+      for (uint32_t u32_ItChannel = 0UL; (u32_ItChannel < rc_Domain.c_ChannelConfigs.size()) && q_SameSafety;
+           ++u32_ItChannel)
+      {
+         q_SameSafety = (rc_Domain.c_ChannelConfigs[u32_ItChannel].q_SafetyRelevant ==
+                         orc_Domain.c_ChannelConfigs[u32_ItChannel].q_SafetyRelevant);
+      }
+      rc_Domain = orc_Domain;
+      //Unchanged safety keeps the datapool layout, so the domain values can be refilled
+      if (q_SameSafety)
+      {
+         this->m_RegisterChange(ou32_Index, 0UL, false);
+      }
+      else
+      {
+         this->InvalidateChangeTracking();
+      }
    }
    else
    {
@@ -197,6 +221,8 @@ int32_t C_OscHalcConfig::SetDomainChannelConfig(const uint32_t ou32_DomainIndex,
                                                 const uint32_t ou32_UseCaseIndex)
 {
    int32_t s32_Retval = C_NO_ERR;
+   const bool q_PreviousSafetyRelevant = this->m_GetSafetyRelevant(ou32_DomainIndex, ou32_ChannelIndex,
+                                                                   oq_UseChannelIndex);
 
    if (ou32_DomainIndex < this->mc_Domains.size())
    {
@@ -229,6 +255,10 @@ int32_t C_OscHalcConfig::SetDomainChannelConfig(const uint32_t ou32_DomainIndex,
    {
       s32_Retval = C_RANGE;
    }
+   if (s32_Retval == C_NO_ERR)
+   {
+      this->m_RegisterSafetyChange(ou32_DomainIndex, ou32_ChannelIndex, oq_UseChannelIndex, q_PreviousSafetyRelevant);
+   }
    return s32_Retval;
 }
 
@@ -248,6 +278,8 @@ int32_t C_OscHalcConfig::ResetDomainChannelConfig(const uint32_t ou32_DomainInde
                                                   const bool oq_UseChannelIndex)
 {
    int32_t s32_Retval = C_NO_ERR;
+   const bool q_PreviousSafetyRelevant = this->m_GetSafetyRelevant(ou32_DomainIndex, ou32_ChannelIndex,
+                                                                   oq_UseChannelIndex);
 
    if (ou32_DomainIndex < this->mc_Domains.size())
    {
@@ -265,6 +297,10 @@ int32_t C_OscHalcConfig::ResetDomainChannelConfig(const uint32_t ou32_DomainInde
    {
       s32_Retval = C_RANGE;
    }
+   if (s32_Retval == C_NO_ERR)
+   {
+      this->m_RegisterSafetyChange(ou32_DomainIndex, ou32_ChannelIndex, oq_UseChannelIndex, q_PreviousSafetyRelevant);
+   }
    return s32_Retval;
 }
 
@@ -298,6 +334,10 @@ int32_t C_OscHalcConfig::ResetDomainChannelUseCase(const uint32_t ou32_DomainInd
    {
       s32_Retval = C_RANGE;
    }
+   if (s32_Retval == C_NO_ERR)
+   {
+      this->m_RegisterChange(ou32_DomainIndex, ou32_ChannelIndex, oq_UseChannelIndex);
+   }
    return s32_Retval;
 }
 
@@ -412,6 +452,8 @@ int32_t C_OscHalcConfig::SetDomainChannelConfigSafety(const uint32_t ou32_Domain
                                                       const bool oq_UseChannelIndex, const bool oq_SafetyRelevant)
 {
    int32_t s32_Retval = C_NO_ERR;
+   const bool q_PreviousSafetyRelevant = this->m_GetSafetyRelevant(ou32_DomainIndex, ou32_ChannelIndex,
+                                                                   oq_UseChannelIndex);
 
    if (ou32_DomainIndex < this->mc_Domains.size())
    {
@@ -438,6 +480,10 @@ int32_t C_OscHalcConfig::SetDomainChannelConfigSafety(const uint32_t ou32_Domain
    {
       s32_Retval = C_RANGE;
    }
+   if (s32_Retval == C_NO_ERR)
+   {
+      this->m_RegisterSafetyChange(ou32_DomainIndex, ou32_ChannelIndex, oq_UseChannelIndex, q_PreviousSafetyRelevant);
+   }
    return s32_Retval;
 }
 
@@ -485,6 +531,10 @@ int32_t C_OscHalcConfig::SetDomainChannelConfigUseCase(const uint32_t ou32_Domai
    {
       s32_Retval = C_RANGE;
    }
+   if (s32_Retval == C_NO_ERR)
+   {
+      this->m_RegisterChange(ou32_DomainIndex, ou32_ChannelIndex, oq_UseChannelIndex);
+   }
    return s32_Retval;
 }
 
@@ -549,6 +599,10 @@ int32_t C_OscHalcConfig::SetDomainChannelParameterConfig(const uint32_t ou32_Dom
    {
       s32_Retval = C_RANGE;
    }
+   if (s32_Retval == C_NO_ERR)
+   {
+      this->m_RegisterChange(ou32_DomainIndex, ou32_ChannelIndex, oq_UseChannelIndex);
+   }
    return s32_Retval;
 }
 
@@ -631,6 +685,10 @@ int32_t C_OscHalcConfig::SetDomainChannelParameterConfigElement(const uint32_t o
    {
       s32_Retval = C_RANGE;
    }
+   if (s32_Retval == C_NO_ERR)
+   {
+      this->m_RegisterChange(ou32_DomainIndex, ou32_ChannelIndex, oq_UseChannelIndex);
+   }
    return s32_Retval;
 }
 
@@ -729,6 +787,10 @@ int32_t C_OscHalcConfig::SetDomainChannelParameterConfigElementPlain(const uint3
    {
       s32_Retval = C_RANGE;
    }
+   if (s32_Retval == C_NO_ERR)
+   {
+      this->m_RegisterChange(ou32_DomainIndex, ou32_ChannelIndex, oq_UseChannelIndex);
+   }
    return s32_Retval;
 }
 
@@ -828,6 +890,10 @@ int32_t C_OscHalcConfig::SetDomainChannelParameterConfigElementEnum(const uint32
    {
       s32_Retval = C_RANGE;
    }
+   if (s32_Retval == C_NO_ERR)
+   {
+      this->m_RegisterChange(ou32_DomainIndex, ou32_ChannelIndex, oq_UseChannelIndex);
+   }
    return s32_Retval;
 }
 
@@ -929,6 +995,10 @@ int32_t C_OscHalcConfig::SetDomainChannelParameterConfigElementBitmask(const uin
    {
       s32_Retval = C_RANGE;
    }
+   if (s32_Retval == C_NO_ERR)
+   {
+      this->m_RegisterChange(ou32_DomainIndex, ou32_ChannelIndex, oq_UseChannelIndex);
+   }
    return s32_Retval;
 }
 
@@ -1113,3 +1183,195 @@ void C_OscHalcConfig::HandleNameMaxCharLimit(const uint32_t ou32_NameMaxCharLimi
       this->mc_Domains[u32_ItDomain].HandleNameMaxCharLimit(ou32_NameMaxCharLimit, opc_ChangedItems);
    }
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Check if change tracking is valid
+
+   Valid means: since the last reset only domain or channel values changed, so datapools generated at that time
+   keep their layout and only the changed domains and channels need to be refilled.
+
+   \retval   true    Changes are completely known by changed domains and channels
+   \retval   false   Unknown or layout relevant changes, complete regeneration necessary
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscHalcConfig::IsChangeTrackingValid(void) const
+{
+   bool q_Retval = this->mq_ChangeTrackingValid;
+
+   if (q_Retval == true)
+   {
+      uint32_t u32_LayoutHash = 0xFFFFFFFFUL;
+      this->m_CalcLayoutHash(u32_LayoutHash);
+      q_Retval = (u32_LayoutHash == this->mu32_ChangeTrackingLayoutHash);
+   }
+   return q_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get domains with changed domain configuration since last reset
+
+   \return
+   Domain indices
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const std::set<uint32_t> & C_OscHalcConfig::GetChangedDomains(void) const
+{
+   return this->mc_ChangedDomains;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get changed channels since last reset
+
+   \return
+   Channel indices per domain index
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const std::map<uint32_t, std::set<uint32_t> > & C_OscHalcConfig::GetChangedChannels(void) const
+{
+   return this->mc_ChangedChannels;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Reset change tracking
+
+   To be called as soon as the datapools match the current configuration.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscHalcConfig::ResetChangeTracking(void)
+{
+   this->mc_ChangedDomains.clear();
+   this->mc_ChangedChannels.clear();
+   this->mu32_ChangeTrackingLayoutHash = 0xFFFFFFFFUL;
+   this->m_CalcLayoutHash(this->mu32_ChangeTrackingLayoutHash);
+   this->mq_ChangeTrackingValid = true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Invalidate change tracking
+
+   To be called for changes which are not tracked in detail (e.g. replacement of complete configuration).
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscHalcConfig::InvalidateChangeTracking(void)
+{
+   this->mc_ChangedDomains.clear();
+   this->mc_ChangedChannels.clear();
+   this->mq_ChangeTrackingValid = false;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get safety relevant flag of domain or channel
+
+   \param[in]  ou32_DomainIndex     Domain index
+   \param[in]  ou32_ChannelIndex    Channel index
+   \param[in]  oq_UseChannelIndex   Use channel index
+
+   \return
+   Safety relevant flag (false if index invalid)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscHalcConfig::m_GetSafetyRelevant(const uint32_t ou32_DomainIndex, const uint32_t ou32_ChannelIndex,
+                                          const bool oq_UseChannelIndex) const
+{
+   bool q_Retval = false;
+
+   if (ou32_DomainIndex < this->mc_Domains.size())
+   {
+      const C_OscHalcConfigDomain & rc_Domain = this->mc_Domains[ou32_DomainIndex];
+      if (oq_UseChannelIndex)
+      {
+         if (ou32_ChannelIndex < rc_Domain.c_ChannelConfigs.size())
+         {
+            q_Retval = rc_Domain.c_ChannelConfigs[ou32_ChannelIndex].q_SafetyRelevant;
+         }
+      }
+      else
+      {
+         q_Retval = rc_Domain.c_DomainConfig.q_SafetyRelevant;
+      }
+   }
+   return q_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Register value change of domain or channel
+
+   \param[in]  ou32_DomainIndex     Domain index
+   \param[in]  ou32_ChannelIndex    Channel index
+   \param[in]  oq_UseChannelIndex   Use channel index
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscHalcConfig::m_RegisterChange(const uint32_t ou32_DomainIndex, const uint32_t ou32_ChannelIndex,
+                                       const bool oq_UseChannelIndex)
+{
+   //Nothing to remember if everything has to be regenerated anyways
+   if (this->mq_ChangeTrackingValid)
+   {
+      if (oq_UseChannelIndex)
+      {
+         this->mc_ChangedChannels[ou32_DomainIndex].insert(ou32_ChannelIndex);
+      }
+      else
+      {
+         this->mc_ChangedDomains.insert(ou32_DomainIndex);
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Register change of domain or channel which might have changed the safety relevant flag
+
+   A changed safety flag moves the channel between safe and non-safe datapool and therefore changes the layout.
+
+   \param[in]  ou32_DomainIndex           Domain index
+   \param[in]  ou32_ChannelIndex          Channel index
+   \param[in]  oq_UseChannelIndex         Use channel index
+   \param[in]  oq_PreviousSafetyRelevant  Safety relevant flag before the change
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscHalcConfig::m_RegisterSafetyChange(const uint32_t ou32_DomainIndex, const uint32_t ou32_ChannelIndex,
+                                             const bool oq_UseChannelIndex, const bool oq_PreviousSafetyRelevant)
+{
+   if (this->m_GetSafetyRelevant(ou32_DomainIndex, ou32_ChannelIndex, oq_UseChannelIndex) ==
+       oq_PreviousSafetyRelevant)
+   {
+      this->m_RegisterChange(ou32_DomainIndex, ou32_ChannelIndex, oq_UseChannelIndex);
+   }
+   else
+   {
+      this->InvalidateChangeTracking();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Calculate hash over all properties which define the layout of the generated datapools
+
+   The public base properties cannot be tracked by setters, so they are compared by hash.
+   NVM start addresses are excluded as they can be updated without regeneration.
+
+   \param[in,out]  oru32_HashValue  Hash value with initial [in] value and result [out] value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscHalcConfig::m_CalcLayoutHash(uint32_t & oru32_HashValue) const
+{
+   const uint32_t u32_DomainCount = static_cast<uint32_t>(this->mc_Domains.size());
+   const uint32_t u32_SafeOffsetCount = static_cast<uint32_t>(this->c_NvmSafeAddressOffset.size());
+   const uint32_t u32_NonSafeOffsetCount = static_cast<uint32_t>(this->c_NvmNonSafeAddressOffset.size());
+
+   stw::scl::C_SclChecksums::CalcCRC32(&this->u32_ContentVersion, sizeof(this->u32_ContentVersion), oru32_HashValue);
+   stw::scl::C_SclChecksums::CalcCRC32(this->c_FileString.c_str(), this->c_FileString.Length(), oru32_HashValue);
+   stw::scl::C_SclChecksums::CalcCRC32(&this->e_SafetyMode, sizeof(this->e_SafetyMode), oru32_HashValue);
+   stw::scl::C_SclChecksums::CalcCRC32(&this->u8_NumConfigCopies, sizeof(this->u8_NumConfigCopies), oru32_HashValue);
+   stw::scl::C_SclChecksums::CalcCRC32(&this->q_NvmBasedConfig, sizeof(this->q_NvmBasedConfig), oru32_HashValue);
+   stw::scl::C_SclChecksums::CalcCRC32(&u32_SafeOffsetCount, sizeof(u32_SafeOffsetCount), oru32_HashValue);
+   stw::scl::C_SclChecksums::CalcCRC32(&u32_NonSafeOffsetCount, sizeof(u32_NonSafeOffsetCount), oru32_HashValue);
+   stw::scl::C_SclChecksums::CalcCRC32(&this->u32_NvmReservedListSizeParameters,
+                                       sizeof(this->u32_NvmReservedListSizeParameters), oru32_HashValue);
+   stw::scl::C_SclChecksums::CalcCRC32(&this->u32_NvmReservedListSizeInputValues,
+                                       sizeof(this->u32_NvmReservedListSizeInputValues), oru32_HashValue);
+   stw::scl::C_SclChecksums::CalcCRC32(&this->u32_NvmReservedListSizeOutputValues,
+                                       sizeof(this->u32_NvmReservedListSizeOutputValues), oru32_HashValue);
+   stw::scl::C_SclChecksums::CalcCRC32(&this->u32_NvmReservedListSizeStatusValues,
+                                       sizeof(this->u32_NvmReservedListSizeStatusValues), oru32_HashValue);
+   stw::scl::C_SclChecksums::CalcCRC32(&u32_DomainCount, sizeof(u32_DomainCount), oru32_HashValue);
+}
@@ -9,6 +9,9 @@
 #define C_OSCHALCCONFIG_HPP
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <set>
+#include <map>
+
 #include "C_OscHalcDefBase.hpp"
 #include "C_OscHalcConfigDomain.hpp"
 
@@ -90,8 +93,28 @@ public:
    void HandleNameMaxCharLimit(const uint32_t ou32_NameMaxCharLimit,
                                std::list<C_OscSystemNameMaxCharLimitChangeReportItem> * const opc_ChangedItems);
 
+   //Change tracking (for incremental datapool generation)
+   bool IsChangeTrackingValid(void) const;
+   const std::set<uint32_t> & GetChangedDomains(void) const;
+   const std::map<uint32_t, std::set<uint32_t> > & GetChangedChannels(void) const;
+   void ResetChangeTracking(void);
+   void InvalidateChangeTracking(void);
+
 private:
    std::vector<C_OscHalcConfigDomain> mc_Domains; ///< Domains of HALC configuration (synced with C_OscHalcDefBase)
+
+   bool mq_ChangeTrackingValid;                                 ///< Flag if all changes since last reset are known
+   uint32_t mu32_ChangeTrackingLayoutHash;                      ///< Layout hash at last reset
+   std::set<uint32_t> mc_ChangedDomains;                        ///< Domains with changed domain configuration
+   std::map<uint32_t, std::set<uint32_t> > mc_ChangedChannels; ///< Changed channel indices per domain
+
+   bool m_GetSafetyRelevant(const uint32_t ou32_DomainIndex, const uint32_t ou32_ChannelIndex,
+                            const bool oq_UseChannelIndex) const;
+   void m_RegisterChange(const uint32_t ou32_DomainIndex, const uint32_t ou32_ChannelIndex,
+                         const bool oq_UseChannelIndex);
+   void m_RegisterSafetyChange(const uint32_t ou32_DomainIndex, const uint32_t ou32_ChannelIndex,
+                               const bool oq_UseChannelIndex, const bool oq_PreviousSafetyRelevant);
+   void m_CalcLayoutHash(uint32_t & oru32_HashValue) const;
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
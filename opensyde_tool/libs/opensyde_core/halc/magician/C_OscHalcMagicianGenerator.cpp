@@ -89,6 +89,117 @@ int32_t C_OscHalcMagicianGenerator::GenerateHalcDatapools(std::vector<C_OscNodeD
    return s32_Retval;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Update previously generated HALC datapools in place
+
+   Only refills the values of the domains and channels changed since the last reset of the HALC configuration change
+   tracking, and the NVM start addresses. The result equals a complete regeneration as long as the change tracking
+   is valid, because configured values only end up in the first dataset of the parameter lists of the original
+   (non-copied) datapools.
+
+   \param[in,out]  orc_NodeDatapools    All datapools of the node, HALC datapools get updated
+
+   \return
+   C_NO_ERR Datapools updated
+   C_NOACT  Change tracking invalid, complete regeneration necessary
+   C_CONFIG Datapools do not match configuration, complete regeneration necessary
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscHalcMagicianGenerator::UpdateHalcDatapools(std::vector<C_OscNodeDataPool> & orc_NodeDatapools) const
+{
+   int32_t s32_Retval = C_NO_ERR;
+
+   if ((this->mpc_Node != NULL) && (this->mpc_Node->c_HalcConfig.IsChangeTrackingValid()))
+   {
+      const uint16_t u16_TimerId = osc_write_log_performance_start();
+      const C_OscHalcConfig & rc_Config = this->mpc_Node->c_HalcConfig;
+      const uint32_t u32_NumOriginal = this->m_CheckTwoDp() ? 2UL : 1UL;
+      std::vector<C_OscNodeDataPool *> c_HalcDatapools;
+
+      for (std::vector<C_OscNodeDataPool>::iterator c_ItDp = orc_NodeDatapools.begin();
+           c_ItDp != orc_NodeDatapools.end(); ++c_ItDp)
+      {
+         if ((c_ItDp->e_Type == C_OscNodeDataPool::eHALC) || (c_ItDp->e_Type == C_OscNodeDataPool::eHALC_NVM))
+         {
+            c_HalcDatapools.push_back(&(*c_ItDp));
+         }
+      }
+
+      //Check structure: original datapools are generated first, copies follow
+      if ((rc_Config.u8_NumConfigCopies == 0U) ||
+          (c_HalcDatapools.size() != (u32_NumOriginal * static_cast<uint32_t>(rc_Config.u8_NumConfigCopies))))
+      {
+         s32_Retval = C_CONFIG;
+      }
+      for (uint32_t u32_ItDp = 0UL; (u32_ItDp < u32_NumOriginal) && (s32_Retval == C_NO_ERR); ++u32_ItDp)
+      {
+         const C_OscNodeDataPool & rc_Datapool = *c_HalcDatapools[u32_ItDp];
+         if ((rc_Datapool.c_Lists.size() != 4UL) ||
+             (rc_Datapool.c_Name != C_OscHalcMagicianUtil::h_GetDatapoolName(rc_Datapool.q_IsSafety, 0UL)))
+         {
+            s32_Retval = C_CONFIG;
+         }
+      }
+
+      //Refill changed values
+      for (uint32_t u32_ItDp = 0UL; (u32_ItDp < u32_NumOriginal) && (s32_Retval == C_NO_ERR); ++u32_ItDp)
+      {
+         C_OscNodeDataPool & rc_Datapool = *c_HalcDatapools[u32_ItDp];
+         C_OscNodeDataPoolList & rc_List = rc_Datapool.c_Lists[0UL];
+         const C_OscHalcMagicianDatapoolListHandler c_Handler(rc_Config, C_OscHalcDefDomain::eVA_PARAM,
+                                                              rc_Datapool.q_IsSafety);
+         const std::set<uint32_t> & rc_ChangedDomains = rc_Config.GetChangedDomains();
+         const std::map<uint32_t, std::set<uint32_t> > & rc_ChangedChannels = rc_Config.GetChangedChannels();
+
+         for (std::set<uint32_t>::const_iterator c_ItDomain = rc_ChangedDomains.begin();
+              (c_ItDomain != rc_ChangedDomains.end()) && (s32_Retval == C_NO_ERR); ++c_ItDomain)
+         {
+            const C_OscHalcConfigDomain * const pc_Domain = rc_Config.GetDomainConfigDataConst(*c_ItDomain);
+            if (pc_Domain != NULL)
+            {
+               s32_Retval = C_OscHalcMagicianGenerator::mh_FillHalcDatapoolsDomain(rc_List, *pc_Domain, c_Handler,
+                                                                                   *c_ItDomain);
+            }
+         }
+         for (std::map<uint32_t, std::set<uint32_t> >::const_iterator c_ItDomain = rc_ChangedChannels.begin();
+              (c_ItDomain != rc_ChangedChannels.end()) && (s32_Retval == C_NO_ERR); ++c_ItDomain)
+         {
+            const C_OscHalcConfigDomain * const pc_Domain = rc_Config.GetDomainConfigDataConst(c_ItDomain->first);
+            //Completely refilled domains do not need another pass
+            if ((pc_Domain != NULL) && (rc_ChangedDomains.count(c_ItDomain->first) == 0UL))
+            {
+               s32_Retval = C_OscHalcMagicianGenerator::mh_FillHalcDatapoolsDomain(rc_List, *pc_Domain, c_Handler,
+                                                                                   c_ItDomain->first,
+                                                                                   &c_ItDomain->second);
+            }
+         }
+      }
+
+      //NVM start addresses are not part of the tracked layout
+      if ((s32_Retval == C_NO_ERR) && (rc_Config.q_NvmBasedConfig))
+      {
+         const bool q_BothDps = this->m_CheckTwoDp();
+         if (q_BothDps || (rc_Config.e_SafetyMode == C_OscHalcDefBase::eONE_LEVEL_ALL_SAFE))
+         {
+            s32_Retval = mh_UpdateNvmDpOffset(c_HalcDatapools, rc_Config.c_NvmSafeAddressOffset, true);
+         }
+         if ((s32_Retval == C_NO_ERR) &&
+             (q_BothDps || (rc_Config.e_SafetyMode == C_OscHalcDefBase::eONE_LEVEL_ALL_NON_SAFE)))
+         {
+            s32_Retval = mh_UpdateNvmDpOffset(c_HalcDatapools, rc_Config.c_NvmNonSafeAddressOffset, false);
+         }
+      }
+
+      osc_write_log_performance_stop(u16_TimerId, "Update of HAL Datapools");
+   }
+   else
+   {
+      s32_Retval = C_NOACT;
+   }
+
+   return s32_Retval;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Generate HALC datapools definition
 
@@ -341,10 +452,11 @@ int32_t C_OscHalcMagicianGenerator::m_FillHalcDatapools(std::vector<C_OscNodeDat
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Fill HALC datapools domain
 
-   \param[in,out]  orc_List         List
-   \param[in]      orc_Domain       Domain
-   \param[in]      orc_Handler      Handler
-   \param[in]      ou32_ItDomain    Iterator domain
+   \param[in,out]  orc_List            List
+   \param[in]      orc_Domain          Domain
+   \param[in]      orc_Handler         Handler
+   \param[in]      ou32_ItDomain       Iterator domain
+   \param[in]      opc_ChannelFilter   Optional channel indices to fill (NULL: complete domain)
 
    \return
    C_NO_ERR Datapool definition generated
@@ -354,7 +466,8 @@ int32_t C_OscHalcMagicianGenerator::m_FillHalcDatapools(std::vector<C_OscNodeDat
 int32_t C_OscHalcMagicianGenerator::mh_FillHalcDatapoolsDomain(C_OscNodeDataPoolList & orc_List,
                                                                const C_OscHalcConfigDomain & orc_Domain,
                                                                const C_OscHalcMagicianDatapoolListHandler & orc_Handler,
-                                                               const uint32_t ou32_ItDomain)
+                                                               const uint32_t ou32_ItDomain,
+                                                               const std::set<uint32_t> * const opc_ChannelFilter)
 {
    int32_t s32_Retval = C_NO_ERR;
    //Count
@@ -366,7 +479,7 @@ int32_t C_OscHalcMagicianGenerator::mh_FillHalcDatapoolsDomain(C_OscNodeDataPool
       std::vector<uint32_t> c_RelevantParameters;
       uint32_t u32_ItRelevantChannel = 0UL;
 
-      if (orc_Domain.c_ChannelConfigs.size() == 0UL)
+      if ((orc_Domain.c_ChannelConfigs.size() == 0UL) && (opc_ChannelFilter == NULL))
       {
          //Fill domain values
          if (orc_Handler.CheckChanPresent(orc_Domain.c_DomainConfig))
@@ -409,58 +522,64 @@ int32_t C_OscHalcMagicianGenerator::mh_FillHalcDatapoolsDomain(C_OscNodeDataPool
          const C_OscHalcConfigChannel & rc_Channel = orc_Domain.c_ChannelConfigs[u32_ItChannel];
          if (orc_Handler.CheckChanPresent(rc_Channel))
          {
-            //Fill channel
-            if (orc_Handler.CheckChanNumVariableNecessary(orc_Domain))
+            //Skip channels which are not requested (only the relevant index is necessary for those)
+            if ((opc_ChannelFilter == NULL) || (opc_ChannelFilter->count(u32_ItChannel) > 0UL))
             {
-               s32_Retval = C_OscHalcMagicianGenerator::mh_FillHalcDatapoolsChanNum(
-                  orc_List, orc_Handler, ou32_ItDomain, u32_ItRelevantChannel, u32_ItChannel);
-            }
+               //Fill channel
+               if (orc_Handler.CheckChanNumVariableNecessary(orc_Domain))
+               {
+                  s32_Retval = C_OscHalcMagicianGenerator::mh_FillHalcDatapoolsChanNum(
+                     orc_List, orc_Handler, ou32_ItDomain, u32_ItRelevantChannel, u32_ItChannel);
+               }
 
-            if (s32_Retval == C_NO_ERR)
-            {
-               if (orc_Handler.CheckSafetyFlagVariableNecessary())
+               if (s32_Retval == C_NO_ERR)
                {
-                  //Fill Use-case
-                  s32_Retval = C_OscHalcMagicianGenerator::mh_FillHalcDatapoolsSafetyFlag(
-                     orc_List, orc_Handler, ou32_ItDomain, u32_ItRelevantChannel, rc_Channel.q_SafetyRelevant);
+                  if (orc_Handler.CheckSafetyFlagVariableNecessary())
+                  {
+                     //Fill Use-case
+                     s32_Retval = C_OscHalcMagicianGenerator::mh_FillHalcDatapoolsSafetyFlag(
+                        orc_List, orc_Handler, ou32_ItDomain, u32_ItRelevantChannel, rc_Channel.q_SafetyRelevant);
+                  }
                }
-            }
 
-            if (s32_Retval == C_NO_ERR)
-            {
-               if (orc_Handler.CheckUseCaseVariableNecessary(orc_Domain))
+               if (s32_Retval == C_NO_ERR)
                {
-                  //Get use-case value from index:
-                  //use case index out of range of known use cases would mean we'd have a configuration error
-                  tgl_assert(rc_Channel.u32_UseCaseIndex < orc_Domain.c_ChannelUseCases.size());
+                  if (orc_Handler.CheckUseCaseVariableNecessary(orc_Domain))
+                  {
+                     //Get use-case value from index:
+                     //use case index out of range of known use cases would mean we'd have a configuration error
+                     tgl_assert(rc_Channel.u32_UseCaseIndex < orc_Domain.c_ChannelUseCases.size());
 
-                  const C_OscNodeDataPoolContent & rc_UseCaseContent =
-                     orc_Domain.c_ChannelUseCases[rc_Channel.u32_UseCaseIndex].c_Value;
+                     const C_OscNodeDataPoolContent & rc_UseCaseContent =
+                        orc_Domain.c_ChannelUseCases[rc_Channel.u32_UseCaseIndex].c_Value;
 
-                  //definition: only uint8 supported for use case
-                  tgl_assert(rc_UseCaseContent.GetType() == C_OscNodeDataPoolContent::eUINT8);
+                     //definition: only uint8 supported for use case
+                     tgl_assert(rc_UseCaseContent.GetType() == C_OscNodeDataPoolContent::eUINT8);
 
-                  //Fill Use-case
-                  s32_Retval = C_OscHalcMagicianGenerator::mh_FillHalcDatapoolsUseCase(
-                     orc_List, orc_Handler, ou32_ItDomain, u32_ItRelevantChannel,
-                     rc_UseCaseContent.GetValueU8());
+                     //Fill Use-case
+                     s32_Retval = C_OscHalcMagicianGenerator::mh_FillHalcDatapoolsUseCase(
+                        orc_List, orc_Handler, ou32_ItDomain, u32_ItRelevantChannel,
+                        rc_UseCaseContent.GetValueU8());
+                  }
                }
-            }
 
-            if (s32_Retval == C_NO_ERR)
-            {
-               if (orc_Domain.GetRelevantIndicesForSelectedUseCase(u32_ItChannel, true, &c_RelevantParameters, NULL,
-                                                                   NULL, NULL) == C_NO_ERR)
-               {
-                  s32_Retval = C_OscHalcMagicianGenerator::mh_FillHalcDatapoolsChannel(
-                     orc_List, rc_Channel, orc_Handler, ou32_ItDomain,
-                     u32_ItRelevantChannel, c_RelevantParameters,
-                     orc_Domain.c_ChannelValues.c_Parameters);
-               }
-               else
+               if (s32_Retval == C_NO_ERR)
                {
-                  s32_Retval = C_CONFIG;
-                  osc_write_log_warning("HALC datapool generation", "unexpected error: failed relevancy check");
+                  //Relevance depends on the use case of each channel, so do not keep the indices of other channels
+                  c_RelevantParameters.clear();
+                  if (orc_Domain.GetRelevantIndicesForSelectedUseCase(u32_ItChannel, true, &c_RelevantParameters, NULL,
+                                                                      NULL, NULL) == C_NO_ERR)
+                  {
+                     s32_Retval = C_OscHalcMagicianGenerator::mh_FillHalcDatapoolsChannel(
+                        orc_List, rc_Channel, orc_Handler, ou32_ItDomain,
+                        u32_ItRelevantChannel, c_RelevantParameters,
+                        orc_Domain.c_ChannelValues.c_Parameters);
+                  }
+                  else
+                  {
+                     s32_Retval = C_CONFIG;
+                     osc_write_log_warning("HALC datapool generation", "unexpected error: failed relevancy check");
+                  }
                }
             }
             //Iterate
@@ -1627,6 +1746,55 @@ int32_t C_OscHalcMagicianGenerator::m_HandleNvmDpOffset(std::vector<C_OscNodeDat
    return s32_Retval;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Update NVM datapool offsets of already generated datapools
+
+   Addresses of lists and elements are only recalculated for moved datapools.
+
+   \param[in]  orc_Datapools    Datapools
+   \param[in]  orc_Offsets      Offsets
+   \param[in]  oq_IsSafe        Is safe
+
+   \return
+   C_NO_ERR Offsets updated
+   C_CONFIG Configuration invalid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscHalcMagicianGenerator::mh_UpdateNvmDpOffset(const std::vector<C_OscNodeDataPool *> & orc_Datapools,
+                                                         const std::vector<uint32_t> & orc_Offsets,
+                                                         const bool oq_IsSafe)
+{
+   int32_t s32_Retval = C_NO_ERR;
+   uint32_t u32_ItOffset = 0UL;
+
+   for (uint32_t u32_ItDp = 0UL; (u32_ItDp < orc_Datapools.size()) && (s32_Retval == C_NO_ERR); ++u32_ItDp)
+   {
+      C_OscNodeDataPool & rc_Datapool = *orc_Datapools[u32_ItDp];
+      if (rc_Datapool.q_IsSafety == oq_IsSafe)
+      {
+         if (u32_ItOffset < orc_Offsets.size())
+         {
+            if (rc_Datapool.u32_NvmStartAddress != orc_Offsets[u32_ItOffset])
+            {
+               rc_Datapool.u32_NvmStartAddress = orc_Offsets[u32_ItOffset];
+               rc_Datapool.RecalculateAddress();
+            }
+            //Iterate
+            ++u32_ItOffset;
+         }
+         else
+         {
+            s32_Retval = C_CONFIG;
+         }
+      }
+   }
+   if (u32_ItOffset != orc_Offsets.size())
+   {
+      s32_Retval = C_CONFIG;
+   }
+   return s32_Retval;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Handle version
 
@@ -9,6 +9,8 @@
 #define C_OSCHALCMAGICIANGENERATOR_HPP
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <set>
+
 #include "C_OscNode.hpp"
 #include "C_OscHalcMagicianDatapoolListHandler.hpp"
 
@@ -27,6 +29,7 @@ public:
    C_OscHalcMagicianGenerator(const C_OscNode * const opc_Node);
 
    int32_t GenerateHalcDatapools(std::vector<C_OscNodeDataPool> & orc_Datapools) const;
+   int32_t UpdateHalcDatapools(std::vector<C_OscNodeDataPool> & orc_NodeDatapools) const;
 
 private:
    const C_OscNode * const mpc_Node;
@@ -35,7 +38,8 @@ private:
    int32_t m_FillHalcDatapools(std::vector<C_OscNodeDataPool> & orc_Datapools) const;
    static int32_t mh_FillHalcDatapoolsDomain(C_OscNodeDataPoolList & orc_List, const C_OscHalcConfigDomain & orc_Domain,
                                              const C_OscHalcMagicianDatapoolListHandler & orc_Handler,
-                                             const uint32_t ou32_ItDomain);
+                                             const uint32_t ou32_ItDomain,
+                                             const std::set<uint32_t> * const opc_ChannelFilter = NULL);
    static int32_t mh_FillHalcDatapoolsChanNum(C_OscNodeDataPoolList & orc_List,
                                               const C_OscHalcMagicianDatapoolListHandler & orc_Handler,
                                               const uint32_t ou32_ItDomain, const uint32_t ou32_RelevantIndex,
@@ -94,6 +98,8 @@ private:
    int32_t m_HandleNvm(std::vector<C_OscNodeDataPool> & orc_Datapools) const;
    int32_t m_HandleNvmDpOffset(std::vector<C_OscNodeDataPool> & orc_Datapools,
                                const std::vector<uint32_t> & orc_Offsets, const bool oq_IsSafe) const;
+   static int32_t mh_UpdateNvmDpOffset(const std::vector<C_OscNodeDataPool *> & orc_Datapools,
+                                       const std::vector<uint32_t> & orc_Offsets, const bool oq_IsSafe);
    void m_HandleVersion(C_OscNodeDataPool & orc_Datapool) const;
 };
 
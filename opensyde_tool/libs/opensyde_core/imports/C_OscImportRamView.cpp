@@ -18,6 +18,7 @@
 #include "CKFXDATFile.hpp"
 #include "CKFXProjectOptions.hpp"
 #include "C_OscLoggingHandler.hpp"
+#include "C_OscSystemNameMultiset.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 using namespace stw::scl;
@@ -58,6 +59,10 @@ using namespace stw::diag_lib;
 
    Other elements will not be touched.
 
+   The lists are built in place within orc_DataPool in one pass over the loaded RAMView lists.
+   As names are adapted (e.g. cut to the maximum length) the result might contain duplicate list or element names.
+   Those are detected using a name index and reported in orc_ImportInformation.
+
    Error reporting:
    When loading the RAMView project we assume we have correct project files that load ok in RAMView.
    Details about errors when loading the project will be logged using the OSC logger.
@@ -82,7 +87,10 @@ int32_t C_OscImportRamView::h_ImportDataPoolFromRamViewDefProject(const C_SclStr
 {
    stw::diag_lib::C_KFXProjectOptions c_ProjectOptions;
    stw::diag_lib::C_KFXVariableLists c_VariableLists;
+   C_OscSystemNameMultiset c_ListNames;
+   uint8_t u8_NumCommentSets = 0U;
    int32_t s32_Result = C_NO_ERR;
+   const uint16_t u16_TimerId = osc_write_log_performance_start();
 
    orc_ImportInformation.Clear();
 
@@ -127,6 +135,17 @@ int32_t C_OscImportRamView::h_ImportDataPoolFromRamViewDefProject(const C_SclStr
 
       //copy over lists contents:
       orc_DataPool.c_Lists.clear();
+      orc_DataPool.c_Lists.reserve(mh_GetNumMatchingLists(c_VariableLists, orc_DataPool.e_Type));
+
+      //number of comment sets is a project setting; same for all elements:
+      for (uint8_t u8_CommentIndex = 0U; u8_CommentIndex < KFX_DATA_MAX_NUM_LANGUAGES; u8_CommentIndex++)
+      {
+         if (c_ProjectOptions.ac_CommentDescriptions[u8_CommentIndex] == "")
+         {
+            break;
+         }
+         u8_NumCommentSets++;
+      }
 
       for (uint16_t u16_ListRamView = 0U; u16_ListRamView < c_VariableLists.GetLength(); u16_ListRamView++)
       {
@@ -136,21 +155,24 @@ int32_t C_OscImportRamView::h_ImportDataPoolFromRamViewDefProject(const C_SclStr
              ((orc_DataPool.e_Type == C_OscNodeDataPool::eDIAG) &&
               (c_VariableLists[u16_ListRamView].u8_ListType == KFX_VARIABLE_TYPE_RAM)))
          {
-            //this is a list we are interested in:
-            C_OscNodeDataPoolList c_List;
+            //this is a list we are interested in; fill it in place to avoid copying all elements:
+            C_OscSystemNameMultiset c_ElementNames;
+            orc_DataPool.c_Lists.push_back(C_OscNodeDataPoolList());
+            C_OscNodeDataPoolList & rc_List = orc_DataPool.c_Lists.back();
 
-            c_List.c_Name = c_VariableLists[u16_ListRamView].c_ListName;
-            c_List.c_Comment = ""; //comments not available in RAMView project
+            rc_List.c_Name = c_VariableLists[u16_ListRamView].c_ListName;
+            rc_List.c_Comment = ""; //comments not available in RAMView project
             //make sure the name is openSYDE compliant:
-            C_OscImportRamView::mh_AdaptName(c_List.c_Name, c_List.c_Comment, "list", orc_ImportInformation);
+            C_OscImportRamView::mh_AdaptName(rc_List.c_Name, rc_List.c_Comment, "list", orc_ImportInformation);
+            C_OscImportRamView::mh_CheckUniqueName(c_ListNames, rc_List.c_Name, "list", orc_ImportInformation);
 
             //Dataset information
-            c_List.c_DataSets.resize(c_VariableLists[u16_ListRamView].GetNumDefaults());
+            rc_List.c_DataSets.resize(c_VariableLists[u16_ListRamView].GetNumDefaults());
             //In RAMView we do not have names of sets per list but as a basic project setting.
             //Adopt names of named sets:
-            for (uint16_t u16_DataSet = 0U; u16_DataSet < c_List.c_DataSets.size(); u16_DataSet++)
+            for (uint16_t u16_DataSet = 0U; u16_DataSet < rc_List.c_DataSets.size(); u16_DataSet++)
             {
-               C_OscNodeDataPoolDataSet & rc_DataSet = c_List.c_DataSets[u16_DataSet];
+               C_OscNodeDataPoolDataSet & rc_DataSet = rc_List.c_DataSets[u16_DataSet];
 
                if (u16_DataSet < c_VariableLists.ac_DefaultNames.GetLength())
                {
@@ -171,14 +193,14 @@ int32_t C_OscImportRamView::h_ImportDataPoolFromRamViewDefProject(const C_SclStr
             //setting specific to the type of list resp. Datapool:
             if (orc_DataPool.e_Type == C_OscNodeDataPool::eNVM)
             {
-               c_List.q_NvmCrcActive = c_VariableLists[u16_ListRamView].q_CheckSummed;
+               rc_List.q_NvmCrcActive = c_VariableLists[u16_ListRamView].q_CheckSummed;
             }
             else
             {
-               c_List.q_NvmCrcActive = false;
+               rc_List.q_NvmCrcActive = false;
             }
-            c_List.u32_NvmSize = 0U; //will be increased when adding NVM elements
-            c_List.u32_NvmStartAddress = 0U;
+            rc_List.u32_NvmSize = 0U; //will be increased when adding NVM elements
+            rc_List.u32_NvmStartAddress = 0U;
 
             //Elements
             //Note that the type "KFX_DATA_TYPE_CRC" is only used in code generated by RAMView.
@@ -188,10 +210,10 @@ int32_t C_OscImportRamView::h_ImportDataPoolFromRamViewDefProject(const C_SclStr
             //If a list is covered by a CRC it will occupy 2 bytes of NVM
             if (c_VariableLists[u16_ListRamView].q_CheckSummed == true)
             {
-               c_List.u32_NvmSize = 2U; //set offset
+               rc_List.u32_NvmSize = 2U; //set offset
             }
 
-            c_List.c_Elements.resize(c_VariableLists[u16_ListRamView].VariableList.GetLength());
+            rc_List.c_Elements.resize(c_VariableLists[u16_ListRamView].VariableList.GetLength());
 
             for (uint32_t u32_ElementIndex = 0U; u32_ElementIndex <
                  static_cast<uint32_t>(c_VariableLists[u16_ListRamView].VariableList.GetLength());
@@ -199,23 +221,14 @@ int32_t C_OscImportRamView::h_ImportDataPoolFromRamViewDefProject(const C_SclStr
             {
                const C_KFXVariableBase & rc_ElementRamView =
                   c_VariableLists[u16_ListRamView].VariableList[u32_ElementIndex];
-               C_OscNodeDataPoolListElement & rc_Element = c_List.c_Elements[u32_ElementIndex];
+               C_OscNodeDataPoolListElement & rc_Element = rc_List.c_Elements[u32_ElementIndex];
                int32_t s32_TypeSetResult;
-               uint8_t u8_NumCommentSets = 0U;
 
                rc_Element.c_Name = rc_ElementRamView.c_Name;
                //Only one comment is supported in openSYDE.
                //If there is only one comment set defined then this comment will be imported
                //If there are more comment sets defined: add one line of comment for each RAMView comment set
                // with pattern: <symbolic_name>: <comment>\n
-               for (uint8_t u8_CommentIndex = 0U; u8_CommentIndex < KFX_DATA_MAX_NUM_LANGUAGES; u8_CommentIndex++)
-               {
-                  if (c_ProjectOptions.ac_CommentDescriptions[u8_CommentIndex] == "")
-                  {
-                     break;
-                  }
-                  u8_NumCommentSets++;
-               }
 
                //zero or one named sets: use first comment only:
                if (u8_NumCommentSets <= 1U)
@@ -241,15 +254,18 @@ int32_t C_OscImportRamView::h_ImportDataPoolFromRamViewDefProject(const C_SclStr
                //make sure the name is openSYDE compliant:
                C_OscImportRamView::mh_AdaptName(rc_Element.c_Name, rc_Element.c_Comment, "element",
                                                 orc_ImportInformation);
+               C_OscImportRamView::mh_CheckUniqueName(c_ElementNames, rc_Element.c_Name,
+                                                      "element of list \"" + rc_List.c_Name + "\"",
+                                                      orc_ImportInformation);
 
                //apply number of datasets from list:
-               rc_Element.c_DataSetValues.resize(c_List.c_DataSets.size());
+               rc_Element.c_DataSetValues.resize(rc_List.c_DataSets.size());
 
                //set type:
                s32_TypeSetResult = mh_ImportElementType(rc_ElementRamView, rc_Element);
                if (s32_TypeSetResult != C_NO_ERR)
                {
-                  const C_SclString c_Info = "Variable \"" + c_List.c_Name + "." + rc_Element.c_Name +
+                  const C_SclString c_Info = "Variable \"" + rc_List.c_Name + "." + rc_Element.c_Name +
                                              "\" has an unsupported type. It was imported as uint8.";
                   orc_ImportInformation.Add(c_Info);
                }
@@ -263,7 +279,7 @@ int32_t C_OscImportRamView::h_ImportDataPoolFromRamViewDefProject(const C_SclStr
                //report and handle collapsing arrays:
                if ((rc_ElementRamView.IsArrayType() == true) && (rc_ElementRamView.GetNumberOfArrayElements() == 1))
                {
-                  const C_SclString c_Info = "Variable \"" + c_List.c_Name + "." + rc_Element.c_Name +
+                  const C_SclString c_Info = "Variable \"" + rc_List.c_Name + "." + rc_Element.c_Name +
                                              "\" is an array with only one entry. It was imported as non-array element.";
                   orc_ImportInformation.Add(c_Info);
 
@@ -283,7 +299,7 @@ int32_t C_OscImportRamView::h_ImportDataPoolFromRamViewDefProject(const C_SclStr
                   rc_Element.e_Access = C_OscNodeDataPoolListElement::eACCESS_RW;
 
                   //count up number of occupied bytes in NVM:
-                  c_List.u32_NvmSize += rc_Element.GetSizeByte();
+                  rc_List.u32_NvmSize += rc_Element.GetSizeByte();
                }
                else
                {
@@ -306,9 +322,9 @@ int32_t C_OscImportRamView::h_ImportDataPoolFromRamViewDefProject(const C_SclStr
                      if (rc_ElementRamView.GetStringDefault(u16_DataSetIndex).Length() == rc_ElementRamView.GetSize())
                      {
                         //filled up to the max -> patch it
-                        const C_SclString c_Info = "Datapool element \"" + c_List.c_Name + "." + rc_Element.c_Name +
+                        const C_SclString c_Info = "Datapool element \"" + rc_List.c_Name + "." + rc_Element.c_Name +
                                                    "\" is a string array. Dataset \"" +
-                                                   c_List.c_DataSets[u16_DataSetIndex].c_Name +
+                                                   rc_List.c_DataSets[u16_DataSetIndex].c_Name +
                                                    "\" contains value \"" +
                                                    rc_ElementRamView.GetStringDefault(u16_DataSetIndex) +
                                                    "\" without zero termination. "
@@ -321,7 +337,6 @@ int32_t C_OscImportRamView::h_ImportDataPoolFromRamViewDefProject(const C_SclStr
                   }
                }
             }
-            orc_DataPool.c_Lists.push_back(c_List);
          }
       }
 
@@ -340,9 +355,39 @@ int32_t C_OscImportRamView::h_ImportDataPoolFromRamViewDefProject(const C_SclStr
                          "Number of imported lists: " + C_SclString::IntToStr(orc_DataPool.c_Lists.size()) + ".");
    }
 
+   osc_write_log_performance_stop(u16_TimerId, "Import of RAMView project");
+
    return s32_Result;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get number of RAMView lists matching the Datapool type
+
+   \param[in]  orc_VariableLists   Loaded RAMView lists
+   \param[in]  oe_DataPoolType     Type of target Datapool
+
+   \return
+   Number of lists that will be imported
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscImportRamView::mh_GetNumMatchingLists(const stw::diag_lib::C_KFXVariableLists & orc_VariableLists,
+                                                    const C_OscNodeDataPool::E_Type oe_DataPoolType)
+{
+   uint32_t u32_Retval = 0UL;
+
+   for (uint16_t u16_ListRamView = 0U; u16_ListRamView < orc_VariableLists.GetLength(); u16_ListRamView++)
+   {
+      if (((oe_DataPoolType == C_OscNodeDataPool::eNVM) &&
+           (orc_VariableLists[u16_ListRamView].u8_ListType == KFX_VARIABLE_TYPE_EEPROM)) ||
+          ((oe_DataPoolType == C_OscNodeDataPool::eDIAG) &&
+           (orc_VariableLists[u16_ListRamView].u8_ListType == KFX_VARIABLE_TYPE_RAM)))
+      {
+         ++u32_Retval;
+      }
+   }
+   return u32_Retval;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Utility to set openSYDE type based on RAMView type
 
@@ -1015,3 +1060,27 @@ void C_OscImportRamView::mh_AdaptName(C_SclString & orc_Name, C_SclString & orc_
       orc_Name = c_NewName;
    }
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Add name to index of already imported names and report if it is a duplicate
+
+   Names can only become duplicates after adaptation (e.g. two long names with the same first 31 characters).
+   The imported content is kept as is; the user has to resolve the conflict after the import.
+
+   \param[in,out] orc_Names              Index of names already imported on the same level
+   \param[in]     orc_Name               Adapted name to add
+   \param[in]     orc_ElementDesignator  Description of item type for reporting
+   \param[in,out] orc_ImportInformation  Textual information about issues when importing
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscImportRamView::mh_CheckUniqueName(C_OscSystemNameMultiset & orc_Names, const C_SclString & orc_Name,
+                                            const stw::scl::C_SclString & orc_ElementDesignator,
+                                            stw::scl::C_SclStringList & orc_ImportInformation)
+{
+   orc_Names.Add(orc_Name);
+   if (orc_Names.GetCount(orc_Name) == 2UL)
+   {
+      orc_ImportInformation.Add("Name of " + orc_ElementDesignator + " \"" + orc_Name +
+                                "\" is not unique. Please rename the affected items after the import.");
+   }
+}
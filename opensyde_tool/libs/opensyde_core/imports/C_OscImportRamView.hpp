@@ -14,6 +14,7 @@
 #include "C_SclString.hpp"
 #include "C_SclStringList.hpp"
 #include "C_OscNodeDataPool.hpp"
+#include "C_OscSystemNameMultiset.hpp"
 #include "CKFXVariableLists.hpp"
 #include "CKFXProjectOptions.hpp"
 
@@ -34,6 +35,8 @@ public:
                                                         stw::scl::C_SclStringList & orc_ImportInformation);
 
 private:
+   static uint32_t mh_GetNumMatchingLists(const stw::diag_lib::C_KFXVariableLists & orc_VariableLists,
+                                          const C_OscNodeDataPool::E_Type oe_DataPoolType);
    static int32_t mh_ImportElementType(const stw::diag_lib::C_KFXVariableBase & orc_RamViewElement,
                                        C_OscNodeDataPoolListElement & orc_Element);
    static void mh_ImportElementMinMax(const stw::diag_lib::C_KFXVariableBase & orc_RamViewElement,
@@ -43,6 +46,9 @@ private:
    static void mh_AdaptName(stw::scl::C_SclString & orc_Name, stw::scl::C_SclString & orc_Comment,
                             const stw::scl::C_SclString & orc_ElementDesignator,
                             stw::scl::C_SclStringList & orc_ImportInformation);
+   static void mh_CheckUniqueName(C_OscSystemNameMultiset & orc_Names, const stw::scl::C_SclString & orc_Name,
+                                  const stw::scl::C_SclString & orc_ElementDesignator,
+                                  stw::scl::C_SclStringList & orc_ImportInformation);
 
    static int32_t mh_LoadRamViewDefProject(const stw::scl::C_SclString & orc_ProjectPath,
                                            stw::diag_lib::C_KFXProjectOptions & orc_ProjectOptions,
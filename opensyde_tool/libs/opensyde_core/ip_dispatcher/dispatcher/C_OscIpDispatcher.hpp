@@ -22,6 +22,7 @@
 #define C_OSCIPDISPATCHER_HPP
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
 #include "stwtypes.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
@@ -196,6 +197,44 @@ public:
    //-----------------------------------------------------------------------------
    virtual int32_t SendTcp(const uint32_t ou32_Handle, const std::vector<uint8_t> & orc_Data) = 0;
 
+   //-----------------------------------------------------------------------------
+   /*!
+      \brief   Send package consisting of header and payload on TCP socket
+
+      Jobs to perform:
+      - send header followed by payload to configured TCP socket as one package
+
+      The default implementation combines both parts and uses SendTcp().
+      Implementations supporting scatter/gather I/O can send both parts without copying.
+
+      \param[in]  ou32_Handle      handle obtained by InitTcp()
+      \param[in]  opu8_Header      header data to sent
+      \param[in]  ou32_HeaderSize  number of header bytes
+      \param[in]  orc_Payload      payload data to sent (can be empty)
+
+      \return
+      C_NO_ERR   data sent successfully
+      C_RD_WR    error sending data
+      C_RANGE    invalid handle
+   */
+   //-----------------------------------------------------------------------------
+   virtual int32_t SendTcpFrame(const uint32_t ou32_Handle, const uint8_t * const opu8_Header,
+                                const uint32_t ou32_HeaderSize, const std::vector<uint8_t> & orc_Payload)
+   {
+      std::vector<uint8_t> c_Data;
+
+      //copy the header by index: an iterator range over a fixed size header array caused false array-bounds
+      // warnings when this function was inlined into the caller
+      c_Data.reserve(static_cast<std::vector<uint8_t>::size_type>(ou32_HeaderSize) + orc_Payload.size());
+      c_Data.resize(ou32_HeaderSize);
+      for (uint32_t u32_Byte = 0U; u32_Byte < ou32_HeaderSize; ++u32_Byte)
+      {
+         c_Data[u32_Byte] = opu8_Header[u32_Byte];
+      }
+      c_Data.insert(c_Data.end(), orc_Payload.begin(), orc_Payload.end());
+      return this->SendTcp(ou32_Handle, c_Data);
+   }
+
    //-----------------------------------------------------------------------------
    /*!
       \brief   Read data from TCP socket
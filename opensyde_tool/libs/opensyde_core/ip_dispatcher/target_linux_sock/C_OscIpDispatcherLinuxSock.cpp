@@ -10,6 +10,7 @@
 //----------------------------------------------------------------------------------------------------------------------
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <algorithm>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -19,7 +20,10 @@
 #include <sys/select.h>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
+#include <sys/epoll.h>
+#include <sys/uio.h>
 #include <netinet/in.h>
+#include <netinet/tcp.h>
 #include <arpa/inet.h>
 #include <ifaddrs.h>
 
@@ -37,6 +41,7 @@ using namespace stw::tgl;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
 #define INVALID_SOCKET     (-1)
+static const int mhsn_MAX_EPOLL_EVENTS = 64; //lint !e8080 !e970 //using type to match library interface
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
@@ -111,6 +116,145 @@ bool C_OscIpDispatcherLinuxSock::C_BufferIdentifier::operator <(
    return q_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set up class
+
+   Initialize class elements
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscIpDispatcherLinuxSock::C_TcpConnection::C_TcpConnection(void) :
+   s32_Socket(INVALID_SOCKET),
+   u32_RxReadIndex(0U),
+   u32_RxCount(0U),
+   q_PeerClosed(false)
+{
+   (void)memset(&au8_IpAddress[0], 0, sizeof(au8_IpAddress));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Discard all received data and reset connection state
+
+   Allocates the receive ring buffer on first call.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscIpDispatcherLinuxSock::C_TcpConnection::ResetRx(void)
+{
+   if (this->c_RxRing.size() != mhu32_RX_RING_SIZE)
+   {
+      this->c_RxRing.resize(mhu32_RX_RING_SIZE);
+   }
+   this->u32_RxReadIndex = 0U;
+   this->u32_RxCount = 0U;
+   this->q_PeerClosed = false;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Enlarge receive ring buffer
+
+   Used if one read request is larger than the ring buffer; otherwise the request could never be fulfilled.
+   The unread data is kept and moved to the start of the new buffer.
+   The buffer is set back to its initial size by ResetRx().
+
+   \param[in]  ou32_Size   required size of ring buffer in bytes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscIpDispatcherLinuxSock::C_TcpConnection::GrowRx(const uint32_t ou32_Size)
+{
+   if (ou32_Size > this->c_RxRing.size())
+   {
+      std::vector<uint8_t> c_NewRing;
+      const uint32_t u32_Count = this->u32_RxCount;
+
+      c_NewRing.resize(ou32_Size);
+      if (u32_Count > 0U)
+      {
+         this->ReadFromRing(&c_NewRing[0], u32_Count);
+      }
+      this->c_RxRing.swap(c_NewRing);
+      this->u32_RxReadIndex = 0U;
+      this->u32_RxCount = u32_Count;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read all available data from socket into receive ring buffer
+
+   Uses one readv() call covering the (possibly wrapped) free space of the ring buffer.
+   Sets q_PeerClosed if the connection was closed by the server or is broken.
+
+   \return
+   number of bytes read
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscIpDispatcherLinuxSock::C_TcpConnection::ReceiveFromSocket(void)
+{
+   uint32_t u32_Return = 0U;
+   const uint32_t u32_Free = static_cast<uint32_t>(this->c_RxRing.size()) - this->u32_RxCount;
+
+   if (u32_Free > 0U)
+   {
+      const uint32_t u32_WriteIndex = (this->u32_RxReadIndex + this->u32_RxCount) %
+                                      static_cast<uint32_t>(this->c_RxRing.size());
+      const uint32_t u32_FirstPart = std::min(u32_Free,
+                                              static_cast<uint32_t>(this->c_RxRing.size()) - u32_WriteIndex);
+      struct iovec at_Parts[2];
+      int x_PartCount = 1; //lint !e8080 !e970 //using type to match library interface
+      ssize_t x_BytesRead;
+
+      at_Parts[0].iov_base = &this->c_RxRing[u32_WriteIndex];
+      at_Parts[0].iov_len = u32_FirstPart;
+      if (u32_FirstPart < u32_Free)
+      {
+         //free space wraps around
+         at_Parts[1].iov_base = &this->c_RxRing[0];
+         at_Parts[1].iov_len = u32_Free - u32_FirstPart;
+         x_PartCount = 2;
+      }
+      x_BytesRead = readv(this->s32_Socket, &at_Parts[0], x_PartCount);
+      if (x_BytesRead > 0)
+      {
+         u32_Return = static_cast<uint32_t>(x_BytesRead);
+         this->u32_RxCount += u32_Return;
+      }
+      else if (x_BytesRead == 0)
+      {
+         //orderly shutdown by server
+         this->q_PeerClosed = true;
+      }
+      else
+      {
+         if ((errno != EWOULDBLOCK) && (errno != EAGAIN) && (errno != EINTR))
+         {
+            this->q_PeerClosed = true;
+         }
+      }
+   }
+   return u32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Take data from receive ring buffer
+
+   Caller has to make sure enough data is available.
+
+   \param[out]  opu8_Data   buffer to copy data to
+   \param[in]   ou32_Size   number of bytes to take
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscIpDispatcherLinuxSock::C_TcpConnection::ReadFromRing(uint8_t * const opu8_Data, const uint32_t ou32_Size)
+{
+   const uint32_t u32_RingSize = static_cast<uint32_t>(this->c_RxRing.size());
+   const uint32_t u32_FirstPart = std::min(ou32_Size, u32_RingSize - this->u32_RxReadIndex);
+
+   (void)memcpy(opu8_Data, &this->c_RxRing[this->u32_RxReadIndex], u32_FirstPart);
+   if (u32_FirstPart < ou32_Size)
+   {
+      (void)memcpy(&opu8_Data[u32_FirstPart], &this->c_RxRing[0], ou32_Size - u32_FirstPart);
+   }
+   this->u32_RxReadIndex = (this->u32_RxReadIndex + ou32_Size) % u32_RingSize;
+   this->u32_RxCount -= ou32_Size;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Set up class
 
@@ -118,8 +262,16 @@ bool C_OscIpDispatcherLinuxSock::C_BufferIdentifier::operator <(
 */
 //----------------------------------------------------------------------------------------------------------------------
 C_OscIpDispatcherLinuxSock::C_OscIpDispatcherLinuxSock(void) :
-   C_OscIpDispatcher()
+   C_OscIpDispatcher(),
+   ms32_SocketUdpServer(INVALID_SOCKET)
 {
+   this->ms32_EpollHandle = epoll_create1(EPOLL_CLOEXEC);
+   if (this->ms32_EpollHandle < 0)
+   {
+      C_SclString c_ErrnoStr = strerror(errno);
+      osc_write_log_warning("openSYDE IP-TP", "epoll_create1() failed. Falling back to polling all TCP sockets. "
+                            "Error: " + c_ErrnoStr);
+   }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -136,6 +288,10 @@ C_OscIpDispatcherLinuxSock::~C_OscIpDispatcherLinuxSock(void)
       this->CloseTcp(u16_Index);
    }
    this->CloseUdp();
+   if (this->ms32_EpollHandle >= 0)
+   {
+      (void)close(this->ms32_EpollHandle);
+   }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -163,8 +319,10 @@ int32_t C_OscIpDispatcherLinuxSock::InitTcp(const uint8_t (&orau8_Ip)[4], uint32
    (void)memcpy(&c_NewConnection.au8_IpAddress[0], &orau8_Ip[0], 4U);
    c_NewConnection.s32_Socket = INVALID_SOCKET;
 
+   this->mc_LockTcp.Acquire();
    this->mc_SocketsTcp.push_back(c_NewConnection);
    oru32_Handle = static_cast<uint32_t>(mc_SocketsTcp.size() - 1U);
+   this->mc_LockTcp.Release();
 
    return C_NO_ERR;
 }
@@ -379,6 +537,201 @@ int32_t C_OscIpDispatcherLinuxSock::m_ConnectTcp(C_TcpConnection & orc_Connectio
    return (q_Error == true) ? C_BUSY : C_NO_ERR;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Utility: prepare connected TCP socket for reception
+
+   - disable Nagle algorithm (services are small and latency matters)
+   - reset receive buffer
+   - add socket to epoll instance
+
+   \param[in]  ou32_Handle   handle obtained by InitTcp() (must be valid; socket must be open)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscIpDispatcherLinuxSock::m_RegisterTcp(const uint32_t ou32_Handle)
+{
+   C_TcpConnection & rc_Connection = this->mc_SocketsTcp[ou32_Handle];
+   int x_Enabled = 1; //lint !e8080 !e970 //using type to match library interface
+
+   if (setsockopt(rc_Connection.s32_Socket, IPPROTO_TCP, TCP_NODELAY, &x_Enabled, sizeof(x_Enabled)) < 0)
+   {
+      C_SclString c_ErrnoStr = strerror(errno);
+      osc_write_log_warning("openSYDE IP-TP", "TCP_NODELAY could not be set. Error: " + c_ErrnoStr);
+   }
+
+   rc_Connection.ResetRx();
+
+   if (this->ms32_EpollHandle >= 0)
+   {
+      struct epoll_event t_Event;
+      t_Event.events = static_cast<uint32_t>(EPOLLIN) | static_cast<uint32_t>(EPOLLRDHUP);
+      t_Event.data.u64 = 0U;
+      t_Event.data.u32 = ou32_Handle;
+      if (epoll_ctl(this->ms32_EpollHandle, EPOLL_CTL_ADD, rc_Connection.s32_Socket, &t_Event) != 0)
+      {
+         C_SclString c_ErrnoStr = strerror(errno);
+         osc_write_log_error("openSYDE IP-TP", "epoll_ctl() failed. Error: " + c_ErrnoStr + " IP-Address: " +
+                             mh_IpToText(rc_Connection.au8_IpAddress));
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Utility: close TCP socket and discard received data
+
+   Closing the socket also removes it from the epoll instance.
+   Caller has to hold mc_LockTcp.
+
+   \param[in]  ou32_Handle   handle obtained by InitTcp() (must be valid)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscIpDispatcherLinuxSock::m_CloseTcpSocket(const uint32_t ou32_Handle)
+{
+   C_TcpConnection & rc_Connection = this->mc_SocketsTcp[ou32_Handle];
+
+   if (rc_Connection.s32_Socket != INVALID_SOCKET)
+   {
+      (void)close(rc_Connection.s32_Socket);
+      rc_Connection.s32_Socket = INVALID_SOCKET;
+   }
+   rc_Connection.ResetRx();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Utility: read all pending TCP data of all connections into their receive buffers
+
+   One epoll_wait() reports all readable sockets; each of them is then drained with one readv().
+   Without epoll all open sockets are tried.
+   Caller has to hold mc_LockTcp.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscIpDispatcherLinuxSock::m_PollTcp(void)
+{
+   if (this->ms32_EpollHandle >= 0)
+   {
+      struct epoll_event at_Events[mhsn_MAX_EPOLL_EVENTS];
+      //lint -e{8080,970} //using type to match library interface
+      const int x_Count = epoll_wait(this->ms32_EpollHandle, &at_Events[0], mhsn_MAX_EPOLL_EVENTS, 0);
+
+      //lint -e{8080,970} //using type to match library interface
+      for (int x_Event = 0; x_Event < x_Count; ++x_Event)
+      {
+         const uint32_t u32_Handle = at_Events[x_Event].data.u32;
+         if (u32_Handle < this->mc_SocketsTcp.size())
+         {
+            C_TcpConnection & rc_Connection = this->mc_SocketsTcp[u32_Handle];
+            if ((rc_Connection.s32_Socket != INVALID_SOCKET) && (rc_Connection.q_PeerClosed == false))
+            {
+               (void)rc_Connection.ReceiveFromSocket();
+               if (rc_Connection.q_PeerClosed == true)
+               {
+                  //no more events of interest; the socket stays open until closed by the application
+                  (void)epoll_ctl(this->ms32_EpollHandle, EPOLL_CTL_DEL, rc_Connection.s32_Socket, NULL);
+                  osc_write_log_info("openSYDE IP-TP", "TCP connection closed by server or broken. IP-Address: " +
+                                     mh_IpToText(rc_Connection.au8_IpAddress));
+               }
+            }
+         }
+      }
+   }
+   else
+   {
+      for (uint32_t u32_Handle = 0U; u32_Handle < this->mc_SocketsTcp.size(); ++u32_Handle)
+      {
+         C_TcpConnection & rc_Connection = this->mc_SocketsTcp[u32_Handle];
+         if ((rc_Connection.s32_Socket != INVALID_SOCKET) && (rc_Connection.q_PeerClosed == false))
+         {
+            (void)rc_Connection.ReceiveFromSocket();
+         }
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Utility: send data parts on TCP socket
+
+   All parts are sent with one system call.
+
+   \param[in]   ou32_Handle     handle obtained by InitTcp()
+   \param[in]   opt_Parts       data parts to send
+   \param[in]   ou32_PartCount  number of parts
+   \param[in]   ou32_Size       total number of bytes of all parts
+
+   \return
+   C_NO_ERR   data sent successfully
+   C_CONFIG   required socket not initialized
+   C_RD_WR    error sending data
+   C_RANGE    handle invalid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscIpDispatcherLinuxSock::m_SendTcp(const uint32_t ou32_Handle, const struct iovec * const opt_Parts,
+                                              const uint32_t ou32_PartCount, const uint32_t ou32_Size)
+{
+   int32_t s32_Return;
+   bool q_Dropped = false;
+
+   //the sockets are non-blocking, so holding the lock while sending does not stall the other connections
+   this->mc_LockTcp.Acquire();
+   if (ou32_Handle >= this->mc_SocketsTcp.size())
+   {
+      osc_write_log_error("openSYDE IP-TP", "SendTcp called with invalid handle.");
+      s32_Return = C_RANGE;
+   }
+   else
+   {
+      s32_Return = C_NO_ERR;
+
+      if (this->mc_SocketsTcp[ou32_Handle].s32_Socket == INVALID_SOCKET)
+      {
+         osc_write_log_error("openSYDE IP-TP", "SendTcp called with invalid socket.");
+         s32_Return = C_CONFIG;
+      }
+      else
+      {
+         struct msghdr t_Message;
+         ssize_t x_BytesSent;
+
+         (void)memset(&t_Message, 0, sizeof(t_Message));
+         t_Message.msg_iov = const_cast<struct iovec *>(opt_Parts);
+         t_Message.msg_iovlen = ou32_PartCount;
+         //no SIGPIPE if the server dropped the connection; we get EPIPE instead
+         x_BytesSent = sendmsg(this->mc_SocketsTcp[ou32_Handle].s32_Socket, &t_Message, MSG_NOSIGNAL);
+         if (x_BytesSent != static_cast<ssize_t>(ou32_Size))
+         {
+            if (x_BytesSent == -1)
+            {
+               C_SclString c_ErrnoStr = strerror(errno);
+               osc_write_log_error("openSYDE IP-TP",
+                                   "SendTcp: Could not send TCP service. Data lost. Error: " + c_ErrnoStr +
+                                   " IP-Address: " + mh_IpToText(this->mc_SocketsTcp[ou32_Handle].au8_IpAddress));
+               if ((errno == ENOTCONN) || (errno == ECONNRESET) || (errno == EPIPE))
+               {
+                  //we got kicked out; we'll remember that ...
+                  osc_write_log_warning("openSYDE IP-TP", "SendTcp: Connection aborted or reset ... IP-Address: " +
+                                        mh_IpToText(this->mc_SocketsTcp[ou32_Handle].au8_IpAddress));
+                  this->m_CloseTcpSocket(ou32_Handle);
+                  q_Dropped = true;
+               }
+            }
+            else
+            {
+               osc_write_log_error("openSYDE IP-TP",
+                                   "SendTcp: Could not send all data: tried: " +
+                                   C_SclString::IntToStr(ou32_Size) +
+                                   "sent: " + C_SclString::IntToStr(x_BytesSent));
+            }
+            s32_Return = C_RD_WR;
+         }
+      }
+   }
+   this->mc_LockTcp.Release();
+
+   if (q_Dropped == true)
+   {
+      m_OnTcpConnectionDropped(ou32_Handle);
+   }
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Utility: configure UDP socket
 
@@ -577,43 +930,39 @@ int32_t C_OscIpDispatcherLinuxSock::IsTcpConnected(const uint32_t ou32_Handle)
 {
    int32_t s32_Return = C_NOACT;
 
+   this->mc_LockTcp.Acquire();
    if (ou32_Handle >= this->mc_SocketsTcp.size())
    {
       osc_write_log_error("openSYDE IP-TP", "ReConnectTcp called with invalid handle.");
       s32_Return = C_RANGE;
    }
-   else if (this->mc_SocketsTcp[ou32_Handle].s32_Socket == INVALID_SOCKET)
-   {
-      // Socket not opened yet
-      s32_Return = C_NOACT;
-   }
    else
    {
-      char_t cn_Byte;
-      // Dummy read to check the connection.
-      // The parameter MSG_PEEK avoid that received data will removed from the queue when read
-      //lint !e8080 !e970 //using type to match library interface
-      const int x_BytesRead = recv(this->mc_SocketsTcp[ou32_Handle].s32_Socket, &cn_Byte, 1, MSG_PEEK);
-
-      if (x_BytesRead > 0)
-      {
-         s32_Return = C_NO_ERR;
-      }
-      else if (x_BytesRead == 0)
+      if (this->mc_SocketsTcp[ou32_Handle].s32_Socket == INVALID_SOCKET)
       {
-         // Connection closed by remote peer
+         // Socket not opened yet
          s32_Return = C_NOACT;
       }
       else
       {
-         // Resource temporarily unavailable. It means that no bytes culd be read, because of an empty queue.
-         // But the connection is already established.
-         if ((errno == EWOULDBLOCK) || (errno == EAGAIN))
+         const C_TcpConnection & rc_Connection = this->mc_SocketsTcp[ou32_Handle];
+         // Update the state of all connections (received data is kept in the receive buffers)
+         if (rc_Connection.q_PeerClosed == false)
+         {
+            this->m_PollTcp();
+         }
+         // Report a closed connection only after all data received before was read
+         if ((rc_Connection.q_PeerClosed == true) && (rc_Connection.u32_RxCount == 0U))
+         {
+            s32_Return = C_NOACT;
+         }
+         else
          {
             s32_Return = C_NO_ERR;
          }
       }
    }
+   this->mc_LockTcp.Release();
 
    return s32_Return;
 }
@@ -640,27 +989,36 @@ int32_t C_OscIpDispatcherLinuxSock::ReConnectTcp(const uint32_t ou32_Handle)
 {
    int32_t s32_Return;
 
+   this->mc_LockTcp.Acquire();
    if (ou32_Handle >= this->mc_SocketsTcp.size())
    {
+      this->mc_LockTcp.Release();
       osc_write_log_error("openSYDE IP-TP", "ReConnectTcp called with invalid handle.");
       s32_Return = C_RANGE;
    }
    else
    {
-      //still connected ?
-      if (this->mc_SocketsTcp[ou32_Handle].s32_Socket != INVALID_SOCKET)
+      C_TcpConnection c_Connection;
+
+      //still connected ? disconnect first:
+      this->m_CloseTcpSocket(ou32_Handle);
+      (void)memcpy(&c_Connection.au8_IpAddress[0], &this->mc_SocketsTcp[ou32_Handle].au8_IpAddress[0], 4U);
+      this->mc_LockTcp.Release();
+
+      //connect (without holding the lock; this might take some time):
+      s32_Return = this->m_ConnectTcp(c_Connection);
+
+      this->mc_LockTcp.Acquire();
+      this->mc_SocketsTcp[ou32_Handle].s32_Socket = c_Connection.s32_Socket;
+      if (s32_Return != C_NO_ERR)
       {
-         //disconnect first:
-         (void)close(this->mc_SocketsTcp[ou32_Handle].s32_Socket);
-         this->mc_SocketsTcp[ou32_Handle].s32_Socket = INVALID_SOCKET;
+         this->m_CloseTcpSocket(ou32_Handle);
       }
-      //connect:
-      s32_Return = this->m_ConnectTcp(this->mc_SocketsTcp[ou32_Handle]);
-      if (s32_Return != C_NO_ERR)
+      else
       {
-         (void)close(this->mc_SocketsTcp[ou32_Handle].s32_Socket);
-         this->mc_SocketsTcp[ou32_Handle].s32_Socket = INVALID_SOCKET;
+         this->m_RegisterTcp(ou32_Handle);
       }
+      this->mc_LockTcp.Release();
    }
    return s32_Return;
 }
@@ -682,9 +1040,11 @@ int32_t C_OscIpDispatcherLinuxSock::CloseTcp(const uint32_t ou32_Handle)
 {
    int32_t s32_Return;
 
+   this->mc_LockTcp.Acquire();
    if ((ou32_Handle >= this->mc_SocketsTcp.size()) ||
        (this->mc_SocketsTcp[ou32_Handle].s32_Socket == INVALID_SOCKET))
    {
+      this->mc_LockTcp.Release();
       osc_write_log_error("openSYDE IP-TP", "CloseTcp called with invalid handle.");
       s32_Return = C_RANGE;
    }
@@ -692,18 +1052,21 @@ int32_t C_OscIpDispatcherLinuxSock::CloseTcp(const uint32_t ou32_Handle)
    {
       sockaddr_in t_SocketInfo;
       socklen_t un_Size = sizeof(t_SocketInfo);
+      C_TcpConnection & rc_Connection = this->mc_SocketsTcp[ou32_Handle];
+      const C_SclString c_IpText = mh_IpToText(rc_Connection.au8_IpAddress);
 
       //lint -e{929,740}  Side-effect of the POSIX-style API. Match is guaranteed by the API.
-      getsockname(this->mc_SocketsTcp[ou32_Handle].s32_Socket, reinterpret_cast<sockaddr *>(&t_SocketInfo), &un_Size);
+      getsockname(rc_Connection.s32_Socket, reinterpret_cast<sockaddr *>(&t_SocketInfo), &un_Size);
 
-      shutdown(this->mc_SocketsTcp[ou32_Handle].s32_Socket, SHUT_RDWR);
+      shutdown(rc_Connection.s32_Socket, SHUT_RDWR);
 
-      s32_Return = close(this->mc_SocketsTcp[ou32_Handle].s32_Socket);
-      this->mc_SocketsTcp[ou32_Handle].s32_Socket = INVALID_SOCKET;
+      s32_Return = close(rc_Connection.s32_Socket);
+      rc_Connection.s32_Socket = INVALID_SOCKET;
+      rc_Connection.ResetRx();
+      this->mc_LockTcp.Release();
 
       osc_write_log_info("openSYDE IP-TP",
-                         "TCP closesocket() OK. IP-Address: " +
-                         mh_IpToText(this->mc_SocketsTcp[ou32_Handle].au8_IpAddress) +
+                         "TCP closesocket() OK. IP-Address: " + c_IpText +
                          " on client port: " + C_SclString::IntToStr(ntohs(t_SocketInfo.sin_port)));
    }
 
@@ -759,58 +1122,47 @@ int32_t C_OscIpDispatcherLinuxSock::CloseUdp(void)
 //----------------------------------------------------------------------------------------------------------------------
 int32_t C_OscIpDispatcherLinuxSock::SendTcp(const uint32_t ou32_Handle, const std::vector<uint8_t> & orc_Data)
 {
-   int32_t s32_Return;
+   struct iovec t_Part;
 
-   if (ou32_Handle >= this->mc_SocketsTcp.size())
-   {
-      osc_write_log_error("openSYDE IP-TP", "SendTcp called with invalid handle.");
-      s32_Return = C_RANGE;
-   }
-   else
-   {
-      s32_Return = C_NO_ERR;
+   t_Part.iov_base = const_cast<uint8_t *>(orc_Data.data());
+   t_Part.iov_len = orc_Data.size();
+   return this->m_SendTcp(ou32_Handle, &t_Part, 1U, static_cast<uint32_t>(orc_Data.size()));
+}
 
-      if (this->mc_SocketsTcp[ou32_Handle].s32_Socket == INVALID_SOCKET)
-      {
-         osc_write_log_error("openSYDE IP-TP", "SendTcp called with invalid socket.");
-         s32_Return = C_CONFIG;
-      }
-      else
-      {
-         //lint -e{926}  Side-effect of the "char"-based API. No side effects as long as we are on the Windows platform.
-         //lint !e970 //using type to match library interface
-         const ssize_t x_BytesSent = send(this->mc_SocketsTcp[ou32_Handle].s32_Socket,
-                                          reinterpret_cast<const char_t *>(&orc_Data[0]), orc_Data.size(), 0);
-         if (x_BytesSent != static_cast<ssize_t>(orc_Data.size()))
-         {
-            if (x_BytesSent == -1)
-            {
-               C_SclString c_ErrnoStr = strerror(errno);
-               osc_write_log_error("openSYDE IP-TP",
-                                   "SendTcp: Could not send TCP service. Data lost. Error: " + c_ErrnoStr +
-                                   " IP-Address: " + mh_IpToText(this->mc_SocketsTcp[ou32_Handle].au8_IpAddress));
-               if ((errno == ENOTCONN) || (errno == ECONNRESET))
-               {
-                  //we got kicked out; we'll remember that ...
-                  osc_write_log_warning("openSYDE IP-TP", "SendTcp: Connection aborted or reset ... IP-Address: " +
-                                        mh_IpToText(this->mc_SocketsTcp[ou32_Handle].au8_IpAddress));
-                  (void)close(this->mc_SocketsTcp[ou32_Handle].s32_Socket);
-                  this->mc_SocketsTcp[ou32_Handle].s32_Socket = INVALID_SOCKET;
-                  m_OnTcpConnectionDropped(ou32_Handle);
-               }
-            }
-            else
-            {
-               osc_write_log_error("openSYDE IP-TP",
-                                   "SendTcp: Could not send all data: tried: " +
-                                   C_SclString::IntToStr(static_cast<int32_t>(orc_Data.size())) +
-                                   "sent: " + C_SclString::IntToStr(x_BytesSent));
-            }
-            s32_Return = C_RD_WR;
-         }
-      }
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Send package composed of header and payload on TCP socket
+
+   Both parts are passed to the kernel with one system call; there is no need to assemble them in one buffer.
+
+   \param[in]   ou32_Handle      handle obtained by InitTcp()
+   \param[in]   opu8_Header      header data to send first
+   \param[in]   ou32_HeaderSize  number of bytes of header
+   \param[in]   orc_Payload      payload data to send after the header
+
+   \return
+   C_NO_ERR   data sent successfully
+   C_CONFIG   required socket not initialized
+   C_RD_WR    error sending data
+   C_RANGE    handle invalid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscIpDispatcherLinuxSock::SendTcpFrame(const uint32_t ou32_Handle, const uint8_t * const opu8_Header,
+                                                 const uint32_t ou32_HeaderSize,
+                                                 const std::vector<uint8_t> & orc_Payload)
+{
+   struct iovec at_Parts[2];
+   uint32_t u32_PartCount = 1U;
+
+   at_Parts[0].iov_base = const_cast<uint8_t *>(opu8_Header);
+   at_Parts[0].iov_len = ou32_HeaderSize;
+   if (orc_Payload.size() > 0)
+   {
+      at_Parts[1].iov_base = const_cast<uint8_t *>(orc_Payload.data());
+      at_Parts[1].iov_len = orc_Payload.size();
+      u32_PartCount = 2U;
    }
-   return s32_Return;
+   return this->m_SendTcp(ou32_Handle, &at_Parts[0], u32_PartCount,
+                          ou32_HeaderSize + static_cast<uint32_t>(orc_Payload.size()));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -821,6 +1173,7 @@ int32_t C_OscIpDispatcherLinuxSock::SendTcp(const uint32_t ou32_Handle, const st
    - read those bytes
 
     The function shall not return any data unless it can provide as many data bytes as specified.
+    If more bytes are requested than fit into the receive buffer the buffer is enlarged.
 
    \param[in]      ou32_Handle   handle obtained by InitTcp()
    \param[in,out]  orc_Data      in: the expected number of bytes is set by the caller (orc_Data.size());
@@ -838,6 +1191,7 @@ int32_t C_OscIpDispatcherLinuxSock::ReadTcp(const uint32_t ou32_Handle, std::vec
 {
    int32_t s32_Return;
 
+   this->mc_LockTcp.Acquire();
    if (ou32_Handle >= this->mc_SocketsTcp.size())
    {
       osc_write_log_error("openSYDE IP-TP", "ReadTcp called with invalid handle.");
@@ -845,8 +1199,6 @@ int32_t C_OscIpDispatcherLinuxSock::ReadTcp(const uint32_t ou32_Handle, std::vec
    }
    else
    {
-      s32_Return = C_NOACT;
-
       if (this->mc_SocketsTcp[ou32_Handle].s32_Socket == INVALID_SOCKET)
       {
          osc_write_log_error("openSYDE IP-TP", "ReadTcp called with invalid socket.");
@@ -854,45 +1206,40 @@ int32_t C_OscIpDispatcherLinuxSock::ReadTcp(const uint32_t ou32_Handle, std::vec
       }
       else
       {
-         int x_Return; //lint !e8080 !e970 //using type to match library interface
-         int x_SizeInBuffer;
-         //do we have enough bytes in RX buffer ?
-         x_Return = ioctl(this->mc_SocketsTcp[ou32_Handle].s32_Socket, FIONREAD, &x_SizeInBuffer);
-         //lint !e970 //using type to match library interface
-         if ((x_Return == 0) && (x_SizeInBuffer >= static_cast<int>(orc_Data.size())))
+         const uint32_t u32_Size = static_cast<uint32_t>(orc_Data.size());
+         C_TcpConnection & rc_Connection = this->mc_SocketsTcp[ou32_Handle];
+
+         //frame larger than the receive buffer ? enlarge it; otherwise we would never get all bytes
+         if (u32_Size > rc_Connection.c_RxRing.size())
          {
-            //enough bytes: read
-            //lint -e{926}  Side-effect of the "char"-based API. No side effects as long as we are on the Windows
-            // platform.
-            //lint !e970 //using type to match library interface
-            ssize_t x_BytesRead = recv(this->mc_SocketsTcp[ou32_Handle].s32_Socket,
-                                       reinterpret_cast<char_t *>(&orc_Data[0]), orc_Data.size(), 0);
-            if (x_BytesRead == static_cast<ssize_t>(orc_Data.size()))
-            {
-               s32_Return = C_NO_ERR;
-            }
-            else
-            {
-               //comm error: no data read even though it was reported by ioctl
-               osc_write_log_error("openSYDE IP-TP",
-                                   "TCP unexpected error: data reported as available but reading failed. IP-Address: " +
-                                   mh_IpToText(this->mc_SocketsTcp[ou32_Handle].au8_IpAddress));
-               s32_Return = C_RD_WR;
-            }
+            osc_write_log_info("openSYDE IP-TP", "ReadTcp: Enlarging receive buffer to " +
+                               C_SclString::IntToStr(u32_Size) + " bytes. IP-Address: " +
+                               mh_IpToText(rc_Connection.au8_IpAddress));
+            rc_Connection.GrowRx(u32_Size);
+         }
+
+         //do we have enough bytes in RX buffer ? if not: fetch what arrived on all sockets
+         if (rc_Connection.u32_RxCount < u32_Size)
+         {
+            this->m_PollTcp();
          }
-         else if (x_Return == -1)
+         if (rc_Connection.u32_RxCount >= u32_Size)
          {
-            C_SclString c_ErrnoStr = strerror(errno);
-            osc_write_log_error("openSYDE IP-TP", "Could not read TCP: buffer count could not be read. Error: " +
-                                c_ErrnoStr + " IP-Address: " +
-                                mh_IpToText(this->mc_SocketsTcp[ou32_Handle].au8_IpAddress));
+            //enough bytes: take them
+            if (u32_Size > 0U)
+            {
+               rc_Connection.ReadFromRing(&orc_Data[0], u32_Size);
+            }
+            s32_Return = C_NO_ERR;
          }
          else
          {
             //not enough data -> done here
+            s32_Return = C_NOACT;
          }
       }
    }
+   this->mc_LockTcp.Release();
    return s32_Return;
 }
 
@@ -8,6 +8,10 @@
 
    Implements target specific IP routines.
    Here: for Linux using BSD Socket API
+
+   TCP reception is driven by one epoll instance for all connections:
+   whenever data is requested that is not buffered yet all readable sockets are drained into
+   per-connection receive ring buffers. Subsequent reads are served from these buffers without system calls.
 */
 //----------------------------------------------------------------------------------------------------------------------
 #ifndef C_OSCIPDISPATCHERLINUXSOCK_HPP
@@ -17,6 +21,7 @@
 #include <vector>
 #include <map>
 #include <list>
+#include <sys/uio.h>
 #include "stwtypes.hpp"
 #include "C_OscIpDispatcher.hpp"
 #include "C_SclString.hpp"
@@ -38,8 +43,20 @@ private:
    class C_TcpConnection
    {
    public:
+      C_TcpConnection(void);
+
       int32_t s32_Socket;       ///< client socket
       uint8_t au8_IpAddress[4]; ///< server's IP (remembered for reconnecting)
+
+      std::vector<uint8_t> c_RxRing; ///< received but not yet read data
+      uint32_t u32_RxReadIndex;      ///< position of oldest unread byte in c_RxRing
+      uint32_t u32_RxCount;          ///< number of unread bytes in c_RxRing
+      bool q_PeerClosed;             ///< connection closed by server or broken
+
+      void ResetRx(void);
+      void GrowRx(const uint32_t ou32_Size);
+      uint32_t ReceiveFromSocket(void);
+      void ReadFromRing(uint8_t * const opu8_Data, const uint32_t ou32_Size);
    };
 
    class C_BufferIdentifier
@@ -72,8 +89,18 @@ private:
    static std::map<C_BufferIdentifier, std::list<std::vector<uint8_t> > > mhc_TcpBuffer; ///< dispatcher buffer
    static stw::tgl::C_TglCriticalSection mhc_LockBuffer;
 
+   int32_t ms32_EpollHandle;                  ///< epoll instance watching all TCP sockets
+   stw::tgl::C_TglCriticalSection mc_LockTcp; ///< protects receive buffers and connection states
+
+   static const uint32_t mhu32_RX_RING_SIZE = 65536U; ///< initial size of receive ring buffer per connection
+
    int32_t m_GetAllInstalledInterfaceIps(void);
    int32_t m_ConnectTcp(C_TcpConnection & orc_Connection) const;
+   void m_RegisterTcp(const uint32_t ou32_Handle);
+   void m_CloseTcpSocket(const uint32_t ou32_Handle);
+   void m_PollTcp(void);
+   int32_t m_SendTcp(const uint32_t ou32_Handle, const struct iovec * const opt_Parts, const uint32_t ou32_PartCount,
+                     const uint32_t ou32_Size);
    int32_t m_ConfigureUdpSocket(const bool oq_ServerPort, const uint32_t ou32_IpToBindTo, int32_t & ors32_Socket) const;
 
    static stw::scl::C_SclString mh_IpToText(const uint8_t (&orau8_Ip)[4]);
@@ -90,6 +117,8 @@ public:
    virtual int32_t CloseTcp(const uint32_t ou32_Handle);
    virtual int32_t CloseUdp(void);
    virtual int32_t SendTcp(const uint32_t ou32_Handle, const std::vector<uint8_t> & orc_Data);
+   virtual int32_t SendTcpFrame(const uint32_t ou32_Handle, const uint8_t * const opu8_Header,
+                                const uint32_t ou32_HeaderSize, const std::vector<uint8_t> & orc_Payload);
    virtual int32_t ReadTcp(const uint32_t ou32_Handle, std::vector<uint8_t> & orc_Data);
    virtual int32_t ReadTcp(const uint32_t ou32_Handle, const uint8_t ou8_ClientBusIdentifier,
                            const uint8_t ou8_ClientNodeIdentifier, const uint8_t ou8_ServerBusIdentifier,
@@ -13,11 +13,14 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include <unistd.h>
 #include <signal.h>
+#include <time.h>
 #include "stwtypes.hpp"
+#include "stwerrors.hpp"
 #include "TglTasks.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 
+using namespace stw::errors;
 using namespace stw::tgl;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
@@ -75,3 +78,142 @@ void C_TglCriticalSection::Release(void)
 }
 
 //----------------------------------------------------------------------------------------------------------------------
+
+C_TglEvent::C_TglEvent(void) :
+   mq_Signaled(false)
+{
+   pthread_mutex_init(&mt_Mutex, NULL);
+   pthread_cond_init(&mt_Condition, NULL);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_TglEvent::~C_TglEvent(void)
+{
+   pthread_cond_destroy(&mt_Condition);
+   pthread_mutex_destroy(&mt_Mutex);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//set event to signaled state; one waiting thread is released
+void C_TglEvent::Signal(void)
+{
+   pthread_mutex_lock(&mt_Mutex);
+   mq_Signaled = true;
+   pthread_cond_signal(&mt_Condition);
+   pthread_mutex_unlock(&mt_Mutex);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   wait till the event is signaled or the timeout expired
+
+   The event is reset when the function returns.
+
+   \param[in]  ou32_TimeoutMs   maximum time to wait in milliseconds
+
+   \return
+   true      event was signaled
+   false     timeout
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_TglEvent::Wait(const uint32_t ou32_TimeoutMs)
+{
+   bool q_Return;
+   struct timespec t_Timeout;
+   int sn_Ret = 0;
+
+   clock_gettime(CLOCK_REALTIME, &t_Timeout);
+   t_Timeout.tv_sec += static_cast<time_t>(ou32_TimeoutMs / 1000U);
+   t_Timeout.tv_nsec += static_cast<long>((ou32_TimeoutMs % 1000U) * 1000000U);
+   if (t_Timeout.tv_nsec >= 1000000000L)
+   {
+      t_Timeout.tv_sec++;
+      t_Timeout.tv_nsec -= 1000000000L;
+   }
+
+   pthread_mutex_lock(&mt_Mutex);
+   while ((mq_Signaled == false) && (sn_Ret == 0))
+   {
+      sn_Ret = pthread_cond_timedwait(&mt_Condition, &mt_Mutex, &t_Timeout);
+   }
+   q_Return = mq_Signaled;
+   mq_Signaled = false;
+   pthread_mutex_unlock(&mt_Mutex);
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_TglThread::C_TglThread(void) :
+   mpr_Function(NULL),
+   mpv_Instance(NULL),
+   mq_Started(false)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//the thread function must have returned before the instance is destroyed; a running thread is waited for
+C_TglThread::~C_TglThread(void)
+{
+   this->WaitForFinish();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   start thread executing the given function
+
+   \param[in]  opr_Function   function to execute
+   \param[in]  opv_Instance   parameter passed to opr_Function
+
+   \return
+   C_NO_ERR    thread started
+   C_BUSY      thread already started and not yet waited for
+   C_NOACT     thread could not be created
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_TglThread::Start(const PR_ThreadFunction opr_Function, void * const opv_Instance)
+{
+   int32_t s32_Return = C_NO_ERR;
+
+   if (this->mq_Started == true)
+   {
+      s32_Return = C_BUSY;
+   }
+   else
+   {
+      this->mpr_Function = opr_Function;
+      this->mpv_Instance = opv_Instance;
+      if (pthread_create(&this->mt_Thread, NULL, &C_TglThread::mh_ThreadFunc, this) == 0)
+      {
+         this->mq_Started = true;
+      }
+      else
+      {
+         s32_Return = C_NOACT;
+      }
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//block until the thread function returned; returns immediately if the thread was not started
+void C_TglThread::WaitForFinish(void)
+{
+   if (this->mq_Started == true)
+   {
+      pthread_join(this->mt_Thread, NULL);
+      this->mq_Started = false;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+void * C_TglThread::mh_ThreadFunc(void * const opv_Instance)
+{
+   C_TglThread * const pc_Thread = reinterpret_cast<C_TglThread *>(opv_Instance);
+
+   pc_Thread->mpr_Function(pc_Thread->mpv_Instance);
+   return NULL;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
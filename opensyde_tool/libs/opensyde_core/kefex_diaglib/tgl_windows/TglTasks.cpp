@@ -80,3 +80,121 @@ void C_TglCriticalSection::Release(void)
 }
 
 //----------------------------------------------------------------------------------------------------------------------
+
+C_TglEvent::C_TglEvent(void)
+{
+   mpv_Event = CreateEvent(NULL, FALSE, FALSE, NULL);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_TglEvent::~C_TglEvent(void)
+{
+   if (mpv_Event != NULL)
+   {
+      (void)CloseHandle(mpv_Event);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//set event to signaled state; one waiting thread is released
+void C_TglEvent::Signal(void)
+{
+   (void)SetEvent(mpv_Event);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   wait till the event is signaled or the timeout expired
+
+   The event is reset when the function returns.
+
+   \param[in]  ou32_TimeoutMs   maximum time to wait in milliseconds
+
+   \return
+   true      event was signaled
+   false     timeout
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_TglEvent::Wait(const uint32_t ou32_TimeoutMs)
+{
+   return (WaitForSingleObject(mpv_Event, ou32_TimeoutMs) == WAIT_OBJECT_0) ? true : false;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+C_TglThread::C_TglThread(void) :
+   mpv_Thread(NULL),
+   mpr_Function(NULL),
+   mpv_Instance(NULL),
+   mq_Started(false)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//the thread function must have returned before the instance is destroyed; a running thread is waited for
+C_TglThread::~C_TglThread(void)
+{
+   this->WaitForFinish();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   start thread executing the given function
+
+   \param[in]  opr_Function   function to execute
+   \param[in]  opv_Instance   parameter passed to opr_Function
+
+   \return
+   C_NO_ERR    thread started
+   C_BUSY      thread already started and not yet waited for
+   C_NOACT     thread could not be created
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_TglThread::Start(const PR_ThreadFunction opr_Function, void * const opv_Instance)
+{
+   int32_t s32_Return = C_NO_ERR;
+
+   if (this->mq_Started == true)
+   {
+      s32_Return = C_BUSY;
+   }
+   else
+   {
+      this->mpr_Function = opr_Function;
+      this->mpv_Instance = opv_Instance;
+      this->mpv_Thread = CreateThread(NULL, 0U, &C_TglThread::mh_ThreadFunc, this, 0U, NULL);
+      if (this->mpv_Thread != NULL)
+      {
+         this->mq_Started = true;
+      }
+      else
+      {
+         s32_Return = C_NOACT;
+      }
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//block until the thread function returned; returns immediately if the thread was not started
+void C_TglThread::WaitForFinish(void)
+{
+   if (this->mq_Started == true)
+   {
+      (void)WaitForSingleObject(this->mpv_Thread, INFINITE);
+      (void)CloseHandle(this->mpv_Thread);
+      this->mpv_Thread = NULL;
+      this->mq_Started = false;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+DWORD WINAPI C_TglThread::mh_ThreadFunc(LPVOID opv_Instance)
+{
+   C_TglThread * const pc_Thread = reinterpret_cast<C_TglThread *>(opv_Instance);
+
+   pc_Thread->mpr_Function(pc_Thread->mpv_Instance);
+   return 0U;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
@@ -44,6 +44,54 @@ public:
    void Release(void);
 };
 
+///Implements an auto-reset event one thread can wait for
+class C_TglEvent
+{
+protected:
+   HANDLE mpv_Event; ///< synchronization object
+
+private:
+   //this class can not be copied:
+   C_TglEvent(const C_TglEvent & orc_Source);
+   C_TglEvent & operator = (const C_TglEvent & orc_Source);
+
+public:
+   C_TglEvent(void);
+   virtual ~C_TglEvent(void);
+
+   void Signal(void);
+   bool Wait(const uint32_t ou32_TimeoutMs);
+};
+
+///Implements a thread executing one function till it returns
+class C_TglThread
+{
+public:
+   ///Function executed by the thread
+   typedef void (* PR_ThreadFunction)(void * const opv_Instance);
+
+protected:
+   HANDLE mpv_Thread; ///< thread handle
+
+   PR_ThreadFunction mpr_Function; ///< function executed by the thread
+   void * mpv_Instance;            ///< parameter passed to mpr_Function
+   bool mq_Started;                ///< true: thread was started and not yet joined
+
+private:
+   //this class can not be copied:
+   C_TglThread(const C_TglThread & orc_Source);
+   C_TglThread & operator = (const C_TglThread & orc_Source);
+
+   static DWORD WINAPI mh_ThreadFunc(LPVOID opv_Instance);
+
+public:
+   C_TglThread(void);
+   virtual ~C_TglThread(void);
+
+   int32_t Start(const PR_ThreadFunction opr_Function, void * const opv_Instance);
+   void WaitForFinish(void);
+};
+
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
 }
 }
@@ -224,6 +224,7 @@ contains(opensyde_core_skip_modules, opensyde_core_skip_project_handling) {
        $${PWD}/project/system/C_OscSystemDefinition.cpp \
        $${PWD}/project/system/C_OscSystemDefinitionFiler.cpp \
        $${PWD}/project/system/C_OscSystemNameMaxCharLimitChangeReportItem.cpp \
+       $${PWD}/project/system/C_OscSystemNameMultiset.cpp \
        $${PWD}/project/system/C_OscSystemFilerUtil.cpp \
        $${PWD}/project/system/device_definition/C_OscDeviceDefinitionFiler.cpp \
        $${PWD}/project/system/device_definition/C_OscDeviceDefinitionFilerV1.cpp \
@@ -239,11 +240,13 @@ contains(opensyde_core_skip_modules, opensyde_core_skip_project_handling) {
        $${PWD}/project/system/FileLoadersV2/C_OscSystemBusFilerV2.cpp \
        $${PWD}/project/system/FileLoadersV2/C_OscSystemDefinitionFilerV2.cpp \
        $${PWD}/project/system/node/can/C_OscCanMessage.cpp \
+       $${PWD}/project/system/node/can/C_OscCanMessageExtractionPlan.cpp \
        $${PWD}/project/system/node/can/C_OscCanMessageUniqueId.cpp \
        $${PWD}/project/system/node/can/C_OscCanMessageContainer.cpp \
        $${PWD}/project/system/node/can/C_OscCanMessageIdentificationIndices.cpp \
        $${PWD}/project/system/node/can/C_OscCanProtocol.cpp \
        $${PWD}/project/system/node/can/C_OscCanSignal.cpp \
+       $${PWD}/project/system/node/can/C_OscCanSignalExtraction.cpp \
        $${PWD}/project/system/node/can/C_OscCanUtil.cpp \
        $${PWD}/project/system/node/data_logger/C_OscDataLoggerJob.cpp \
        $${PWD}/project/system/node/data_logger/C_OscDataLoggerJobFiler.cpp \
@@ -256,7 +259,9 @@ contains(opensyde_core_skip_modules, opensyde_core_skip_project_handling) {
        $${PWD}/project/system/node/C_OscNodeCodeExportSettings.cpp \
        $${PWD}/project/system/node/C_OscNodeComInterfaceSettings.cpp \
        $${PWD}/project/system/node/C_OscNodeDataPool.cpp \
+       $${PWD}/project/system/node/C_OscNodeDataPoolBinaryFiler.cpp \
        $${PWD}/project/system/node/C_OscNodeDataPoolContent.cpp \
+       $${PWD}/project/system/node/C_OscNodeDataPoolContentBuffer.cpp \
        $${PWD}/project/system/node/C_OscNodeDataPoolContentUtil.cpp \
        $${PWD}/project/system/node/C_OscNodeDataPoolDataSet.cpp \
        $${PWD}/project/system/node/C_OscNodeDataPoolFiler.cpp \
@@ -265,10 +270,12 @@ contains(opensyde_core_skip_modules, opensyde_core_skip_project_handling) {
        $${PWD}/project/system/node/C_OscNodeDataPoolListElementId.cpp \
        $${PWD}/project/system/node/C_OscNodeDataPoolListElementOptArrayId.cpp \
        $${PWD}/project/system/node/C_OscNodeDataPoolListId.cpp \
+       $${PWD}/project/system/node/C_OscNodeErrorCheckCache.cpp \
        $${PWD}/project/system/node/C_OscNodeFiler.cpp \
        $${PWD}/project/system/node/C_OscNodeOpenSydeServerSettings.cpp \
        $${PWD}/project/system/node/C_OscNodeProperties.cpp \
        $${PWD}/project/system/node/C_OscNodeStwFlashloaderSettings.cpp \
+       $${PWD}/project/system/node/C_OscNodeValuesLock.cpp \
        $${PWD}/project/system/node/C_OscNodeCommFiler.cpp \
        $${PWD}/project/system/node/C_OscNodeDataPoolId.cpp \
        $${PWD}/project/system/node/can/C_OscCanInterfaceId.cpp \
@@ -324,6 +331,7 @@ contains(opensyde_core_skip_modules, opensyde_core_skip_project_handling) {
        $${PWD}/project/system/C_OscSystemDefinition.hpp \
        $${PWD}/project/system/C_OscSystemDefinitionFiler.hpp \
        $${PWD}/project/system/C_OscSystemNameMaxCharLimitChangeReportItem.hpp \
+       $${PWD}/project/system/C_OscSystemNameMultiset.hpp \
        $${PWD}/project/system/C_OscSystemFilerUtil.hpp \
        $${PWD}/project/system/device_definition/C_OscDeviceDefinition.hpp \
        $${PWD}/project/system/device_definition/C_OscDeviceDefinitionFiler.hpp \
@@ -348,7 +356,9 @@ contains(opensyde_core_skip_modules, opensyde_core_skip_project_handling) {
        $${PWD}/project/system/node/C_OscNodeComInterfaceSettings.hpp \
        $${PWD}/project/system/node/C_OscNodeCommFiler.hpp \
        $${PWD}/project/system/node/C_OscNodeDataPool.hpp \
+       $${PWD}/project/system/node/C_OscNodeDataPoolBinaryFiler.hpp \
        $${PWD}/project/system/node/C_OscNodeDataPoolContent.hpp \
+       $${PWD}/project/system/node/C_OscNodeDataPoolContentBuffer.hpp \
        $${PWD}/project/system/node/C_OscNodeDataPoolDataSet.hpp \
        $${PWD}/project/system/node/C_OscNodeDataPoolFiler.hpp \
        $${PWD}/project/system/node/C_OscNodeDataPoolList.hpp \
@@ -356,16 +366,20 @@ contains(opensyde_core_skip_modules, opensyde_core_skip_project_handling) {
        $${PWD}/project/system/node/C_OscNodeDataPoolListElementId.hpp \
        $${PWD}/project/system/node/C_OscNodeDataPoolListElementOptArrayId.hpp \
        $${PWD}/project/system/node/C_OscNodeDataPoolListId.hpp \
+       $${PWD}/project/system/node/C_OscNodeErrorCheckCache.hpp \
        $${PWD}/project/system/node/C_OscNodeFiler.hpp \
        $${PWD}/project/system/node/C_OscNodeOpenSydeServerSettings.hpp \
        $${PWD}/project/system/node/C_OscNodeProperties.hpp \
        $${PWD}/project/system/node/C_OscNodeStwFlashloaderSettings.hpp \
+       $${PWD}/project/system/node/C_OscNodeValuesLock.hpp \
        $${PWD}/project/system/node/can/C_OscCanMessage.hpp \
+       $${PWD}/project/system/node/can/C_OscCanMessageExtractionPlan.hpp \
        $${PWD}/project/system/node/can/C_OscCanMessageUniqueId.hpp \
        $${PWD}/project/system/node/can/C_OscCanMessageContainer.hpp \
        $${PWD}/project/system/node/can/C_OscCanMessageIdentificationIndices.hpp \
        $${PWD}/project/system/node/can/C_OscCanProtocol.hpp \
        $${PWD}/project/system/node/can/C_OscCanSignal.hpp \
+       $${PWD}/project/system/node/can/C_OscCanSignalExtraction.hpp \
        $${PWD}/project/system/node/can/C_OscCanUtil.hpp \
        $${PWD}/project/system/node/can/C_OscCanInterfaceId.hpp \
        $${PWD}/project/system/node/can/can_open/C_OscCanOpenManagerMappableSignal.hpp \
@@ -485,6 +499,7 @@ contains(opensyde_core_skip_modules, opensyde_core_skip_protocol_drivers_common)
               $${PWD}/protocol_drivers/C_OscDiagProtocolOsy.cpp \
               $${PWD}/protocol_drivers/C_OscFlashProtocolStwFlashloader.cpp \
               $${PWD}/protocol_drivers/C_OscProtocolSerialNumber.cpp \
+              $${PWD}/protocol_drivers/C_OscProtocolDataPoolAccess.cpp \
               $${PWD}/protocol_drivers/C_OscProtocolDriverOsy.cpp \
               $${PWD}/protocol_drivers/C_OscProtocolDriverOsyTpBase.cpp \
               $${PWD}/protocol_drivers/C_OscProtocolDriverOsyTpCan.cpp \
@@ -512,6 +527,7 @@ contains(opensyde_core_skip_modules, opensyde_core_skip_protocol_drivers_common)
               $${PWD}/protocol_drivers/C_OscDiagProtocolOsy.hpp \
               $${PWD}/protocol_drivers/C_OscFlashProtocolStwFlashloader.hpp \
               $${PWD}/protocol_drivers/C_OscProtocolSerialNumber.hpp \
+              $${PWD}/protocol_drivers/C_OscProtocolDataPoolAccess.hpp \
               $${PWD}/protocol_drivers/C_OscProtocolDriverOsy.hpp \
               $${PWD}/protocol_drivers/C_OscProtocolDriverOsyTpBase.hpp \
               $${PWD}/protocol_drivers/C_OscProtocolDriverOsyTpCan.hpp \
@@ -547,6 +563,7 @@ contains(opensyde_core_skip_modules, opensyde_core_skip_protocol_drivers_system)
    message("opensyde_core_skip_protocol_drivers_system not detected ... dragging in package")
 
    INCLUDEPATH += $${PWD}/data_dealer \
+                  $${PWD}/data_dealer/recorder \
                   $${PWD}/security \
                   $${PWD}/protocol_drivers \
                   $${PWD}/protocol_drivers/basic_update \
@@ -563,6 +580,10 @@ contains(opensyde_core_skip_modules, opensyde_core_skip_protocol_drivers_system)
    SOURCES += $${PWD}/data_dealer/C_OscDataDealer.cpp \
               $${PWD}/data_dealer/C_OscDataDealerNvm.cpp \
               $${PWD}/data_dealer/C_OscDataDealerNvmSafe.cpp \
+              $${PWD}/data_dealer/recorder/C_OscDataDealerRecorder.cpp \
+              $${PWD}/data_dealer/recorder/C_OscDpRecordFormat.cpp \
+              $${PWD}/data_dealer/recorder/C_OscDpRecordReader.cpp \
+              $${PWD}/data_dealer/recorder/C_OscDpRecordWriter.cpp \
               $${PWD}/security/C_OscSecurityPem.cpp \
               $${PWD}/security/C_OscSecurityPemBase.cpp \
               $${PWD}/security/C_OscSecurityPemDatabase.cpp \
@@ -575,7 +596,9 @@ contains(opensyde_core_skip_modules, opensyde_core_skip_protocol_drivers_system)
               $${PWD}/protocol_drivers/communication/C_OscComDriverProtocol.cpp \
               $${PWD}/protocol_drivers/communication/C_OscComSequencesBase.cpp \
               $${PWD}/protocol_drivers/routing/C_OscRoutingCalculation.cpp \
+              $${PWD}/protocol_drivers/routing/C_OscRoutingTable.cpp \
               $${PWD}/protocol_drivers/routing/C_OscRoutingRoute.cpp \
+              $${PWD}/protocol_drivers/system_update/C_OscSuCheckpointJournal.cpp \
               $${PWD}/protocol_drivers/system_update/C_OscSuSequences.cpp \
               $${PWD}/protocol_drivers/system_update/C_OscSuSequencesNodeStates.cpp \
               $${PWD}/protocol_drivers/system_update/package/C_OscSupServiceUpdatePackageV1.cpp \
@@ -591,6 +614,10 @@ contains(opensyde_core_skip_modules, opensyde_core_skip_protocol_drivers_system)
    HEADERS += $${PWD}/data_dealer/C_OscDataDealer.hpp \
               $${PWD}/data_dealer/C_OscDataDealerNvm.hpp \
               $${PWD}/data_dealer/C_OscDataDealerNvmSafe.hpp \
+              $${PWD}/data_dealer/recorder/C_OscDataDealerRecorder.hpp \
+              $${PWD}/data_dealer/recorder/C_OscDpRecordFormat.hpp \
+              $${PWD}/data_dealer/recorder/C_OscDpRecordReader.hpp \
+              $${PWD}/data_dealer/recorder/C_OscDpRecordWriter.hpp \
               $${PWD}/security/C_OscSecurityPem.hpp \
               $${PWD}/security/C_OscSecurityPemBase.hpp \
               $${PWD}/security/C_OscSecurityPemDatabase.hpp \
@@ -603,7 +630,9 @@ contains(opensyde_core_skip_modules, opensyde_core_skip_protocol_drivers_system)
               $${PWD}/protocol_drivers/communication/C_OscComDriverProtocol.hpp \
               $${PWD}/protocol_drivers/communication/C_OscComSequencesBase.hpp \
               $${PWD}/protocol_drivers/routing/C_OscRoutingCalculation.hpp \
+              $${PWD}/protocol_drivers/routing/C_OscRoutingTable.hpp \
               $${PWD}/protocol_drivers/routing/C_OscRoutingRoute.hpp \
+              $${PWD}/protocol_drivers/system_update/C_OscSuCheckpointJournal.hpp \
               $${PWD}/protocol_drivers/system_update/C_OscSuSequences.hpp \
               $${PWD}/protocol_drivers/system_update/C_OscSuSequencesNodeStates.hpp \
               $${PWD}/protocol_drivers/system_update/package/C_OscSupServiceUpdatePackageV1.hpp \
@@ -646,7 +675,12 @@ contains(opensyde_core_skip_modules, opensyde_core_skip_protocol_logging) {
               $${PWD}/protocol_drivers/communication/C_OscComMessageLoggerData.cpp \
               $${PWD}/protocol_drivers/communication/C_OscComMessageLoggerFileAsc.cpp \
               $${PWD}/protocol_drivers/communication/C_OscComMessageLoggerFileBase.cpp \
-              $${PWD}/protocol_drivers/communication/C_OscComMessageLoggerOsySysDefConfig.cpp
+              $${PWD}/protocol_drivers/communication/C_OscComMessageLoggerFileCsv.cpp \
+              $${PWD}/protocol_drivers/communication/C_OscComMessageLoggerFilterSet.cpp \
+              $${PWD}/protocol_drivers/communication/C_OscComMessageLoggerOsySysDefConfig.cpp \
+              $${PWD}/protocol_drivers/communication/C_OscComTraceReaderAsc.cpp \
+              $${PWD}/protocol_drivers/communication/C_OscComTraceReaderBase.cpp \
+              $${PWD}/protocol_drivers/communication/C_OscComTraceReplay.cpp
 
    HEADERS += $${PWD}/kefex_diaglib/cmonprotocol/C_CanMonProtocol.hpp \
               $${PWD}/kefex_diaglib/cmonprotocol/C_CanMonProtocolBase.hpp \
@@ -666,7 +700,12 @@ contains(opensyde_core_skip_modules, opensyde_core_skip_protocol_logging) {
               $${PWD}/protocol_drivers/communication/C_OscComMessageLoggerData.hpp \
               $${PWD}/protocol_drivers/communication/C_OscComMessageLoggerFileAsc.hpp \
               $${PWD}/protocol_drivers/communication/C_OscComMessageLoggerFileBase.hpp \
-              $${PWD}/protocol_drivers/communication/C_OscComMessageLoggerOsySysDefConfig.hpp
+              $${PWD}/protocol_drivers/communication/C_OscComMessageLoggerFileCsv.hpp \
+              $${PWD}/protocol_drivers/communication/C_OscComMessageLoggerFilterSet.hpp \
+              $${PWD}/protocol_drivers/communication/C_OscComMessageLoggerOsySysDefConfig.hpp \
+              $${PWD}/protocol_drivers/communication/C_OscComTraceReaderAsc.hpp \
+              $${PWD}/protocol_drivers/communication/C_OscComTraceReaderBase.hpp \
+              $${PWD}/protocol_drivers/communication/C_OscComTraceReplay.hpp
 
    ! contains(SOURCES, $${PWD}/protocol_drivers/communication/C_OscComDriverBase.cpp) {
       SOURCES += $${PWD}/protocol_drivers/communication/C_OscComDriverBase.cpp
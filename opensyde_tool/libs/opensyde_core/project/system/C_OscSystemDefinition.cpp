@@ -496,34 +496,24 @@ const
       if (opq_NameConflict != NULL)
       {
          //check for node name used more than once (independent of character case)
-         *opq_NameConflict = false;
-         for (uint32_t u32_ItNode = 0; u32_ItNode < this->c_Nodes.size(); ++u32_ItNode)
+         const C_OscSystemNameMultiset & rc_NodeNames = this->m_GetNodeNames();
+         uint32_t u32_Count = rc_NodeNames.GetCount(rc_CheckedNode.c_Properties.c_Name);
+         uint32_t u32_GroupIndex;
+         //Skip the checked node itself (its entry is the squad base name for sub nodes)
+         if (C_OscNodeSquad::h_CheckIsMultiDevice(ou32_NodeIndex, this->c_NodeSquads, &u32_GroupIndex))
          {
-            if (u32_ItNode != ou32_NodeIndex)
+            if ((u32_GroupIndex < this->c_NodeSquads.size()) &&
+                (rc_NodeNames.IsSameName(this->c_NodeSquads[u32_GroupIndex].c_BaseName,
+                                         rc_CheckedNode.c_Properties.c_Name) == true))
             {
-               uint32_t u32_GroupIndex;
-               stw::scl::C_SclString c_CurName;
-               if (C_OscNodeSquad::h_CheckIsMultiDevice(u32_ItNode, this->c_NodeSquads, &u32_GroupIndex))
-               {
-                  tgl_assert(u32_GroupIndex < this->c_NodeSquads.size());
-                  if (u32_GroupIndex < this->c_NodeSquads.size())
-                  {
-                     const C_OscNodeSquad & rc_Group = this->c_NodeSquads[u32_GroupIndex];
-                     c_CurName = rc_Group.c_BaseName;
-                  }
-               }
-               else
-               {
-                  const C_OscNode & rc_CurrentNode = this->c_Nodes[u32_ItNode];
-                  c_CurName = rc_CurrentNode.c_Properties.c_Name;
-               }
-               if (rc_CheckedNode.c_Properties.c_Name.LowerCase() == c_CurName.LowerCase())
-               {
-                  *opq_NameConflict = true;
-                  break;
-               }
+               --u32_Count;
             }
          }
+         else
+         {
+            --u32_Count;
+         }
+         *opq_NameConflict = (u32_Count > 0UL);
       }
       if (opq_NameInvalid != NULL)
       {
@@ -971,17 +961,8 @@ int32_t C_OscSystemDefinition::CheckErrorBus(const uint32_t ou32_BusIndex, bool
       if (ou32_BusIndex < this->c_Buses.size())
       {
          const C_OscSystemBus & rc_CheckedBus = this->c_Buses[ou32_BusIndex];
-         for (uint32_t u32_ItBus = 0; u32_ItBus < this->c_Buses.size(); ++u32_ItBus)
-         {
-            if (u32_ItBus != ou32_BusIndex)
-            {
-               const C_OscSystemBus & rc_CurrentBus = this->c_Buses[u32_ItBus];
-               if (rc_CheckedBus.c_Name.LowerCase() == rc_CurrentBus.c_Name.LowerCase())
-               {
-                  *opq_NameConflict = true;
-               }
-            }
-         }
+         //The checked bus itself is part of the names
+         *opq_NameConflict = (this->m_GetBusNames().GetCount(rc_CheckedBus.c_Name) > 1UL);
       }
    }
    if (opq_NameInvalid != NULL)
@@ -2039,3 +2020,97 @@ void C_OscSystemDefinition::m_HandleNameMaxCharLimitNodeName(const uint32_t ou32
                                                                                 opc_ChangedItems);
    }
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get names of all nodes for the name conflict check
+
+   Sub nodes of a squad are represented by the base name of the squad.
+   The names are only counted again if any node name or squad differs from the last call.
+
+   \return
+   Names of all nodes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_OscSystemNameMultiset & C_OscSystemDefinition::m_GetNodeNames(void) const
+{
+   bool q_Changed = (this->mc_NodeNamesSnapshot.size() != this->c_Nodes.size()) ||
+                    (this->mc_NodeSquadsSnapshot.size() != this->c_NodeSquads.size());
+
+   for (uint32_t u32_ItNode = 0UL; (u32_ItNode < this->c_Nodes.size()) && (q_Changed == false); ++u32_ItNode)
+   {
+      q_Changed = (this->mc_NodeNamesSnapshot[u32_ItNode] != this->c_Nodes[u32_ItNode].c_Properties.c_Name);
+   }
+   for (uint32_t u32_ItSquad = 0UL; (u32_ItSquad < this->c_NodeSquads.size()) && (q_Changed == false);
+        ++u32_ItSquad)
+   {
+      const C_OscNodeSquad & rc_Squad = this->c_NodeSquads[u32_ItSquad];
+      const C_OscNodeSquad & rc_Snapshot = this->mc_NodeSquadsSnapshot[u32_ItSquad];
+      q_Changed = ((rc_Snapshot.c_BaseName != rc_Squad.c_BaseName) ||
+                   (rc_Snapshot.c_SubNodeIndexes != rc_Squad.c_SubNodeIndexes));
+   }
+
+   if (q_Changed == true)
+   {
+      std::vector<const C_SclString *> c_Names;
+
+      this->mc_NodeNamesSnapshot.clear();
+      this->mc_NodeNamesSnapshot.reserve(this->c_Nodes.size());
+      c_Names.reserve(this->c_Nodes.size());
+      for (uint32_t u32_ItNode = 0UL; u32_ItNode < this->c_Nodes.size(); ++u32_ItNode)
+      {
+         this->mc_NodeNamesSnapshot.push_back(this->c_Nodes[u32_ItNode].c_Properties.c_Name);
+         c_Names.push_back(&this->c_Nodes[u32_ItNode].c_Properties.c_Name);
+      }
+      this->mc_NodeSquadsSnapshot = this->c_NodeSquads;
+      for (uint32_t u32_ItSquad = 0UL; u32_ItSquad < this->c_NodeSquads.size(); ++u32_ItSquad)
+      {
+         const C_OscNodeSquad & rc_Squad = this->c_NodeSquads[u32_ItSquad];
+         for (uint32_t u32_ItSubNode = 0UL; u32_ItSubNode < rc_Squad.c_SubNodeIndexes.size(); ++u32_ItSubNode)
+         {
+            const uint32_t u32_NodeIndex = rc_Squad.c_SubNodeIndexes[u32_ItSubNode];
+            if (u32_NodeIndex < c_Names.size())
+            {
+               c_Names[u32_NodeIndex] = &rc_Squad.c_BaseName;
+            }
+         }
+      }
+      this->mc_NodeNames.Clear();
+      for (uint32_t u32_ItName = 0UL; u32_ItName < c_Names.size(); ++u32_ItName)
+      {
+         this->mc_NodeNames.Add(*c_Names[u32_ItName]);
+      }
+   }
+   return this->mc_NodeNames;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get names of all buses for the name conflict check
+
+   The names are only counted again if any bus name differs from the last call.
+
+   \return
+   Names of all buses
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_OscSystemNameMultiset & C_OscSystemDefinition::m_GetBusNames(void) const
+{
+   bool q_Changed = (this->mc_BusNamesSnapshot.size() != this->c_Buses.size());
+
+   for (uint32_t u32_ItBus = 0UL; (u32_ItBus < this->c_Buses.size()) && (q_Changed == false); ++u32_ItBus)
+   {
+      q_Changed = (this->mc_BusNamesSnapshot[u32_ItBus] != this->c_Buses[u32_ItBus].c_Name);
+   }
+
+   if (q_Changed == true)
+   {
+      this->mc_BusNamesSnapshot.clear();
+      this->mc_BusNamesSnapshot.reserve(this->c_Buses.size());
+      this->mc_BusNames.Clear();
+      for (uint32_t u32_ItBus = 0UL; u32_ItBus < this->c_Buses.size(); ++u32_ItBus)
+      {
+         this->mc_BusNamesSnapshot.push_back(this->c_Buses[u32_ItBus].c_Name);
+         this->mc_BusNames.Add(this->c_Buses[u32_ItBus].c_Name);
+      }
+   }
+   return this->mc_BusNames;
+}
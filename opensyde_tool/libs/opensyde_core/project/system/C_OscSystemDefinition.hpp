@@ -23,6 +23,7 @@
 #include "C_OscDeviceManager.hpp"
 #include "C_OscCanProtocol.hpp"
 #include "C_OscSystemNameMaxCharLimitChangeReportItem.hpp"
+#include "C_OscSystemNameMultiset.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 namespace stw
@@ -115,6 +116,15 @@ private:
                                  std::list<C_OscSystemNameMaxCharLimitChangeReportItem> * const opc_ChangedItems);
    void m_HandleNameMaxCharLimitNodeName(const uint32_t ou32_NodeIndex, const uint32_t ou32_NameMaxCharLimit,
                                          std::list<C_OscSystemNameMaxCharLimitChangeReportItem> * const opc_ChangedItems);
+   const C_OscSystemNameMultiset & m_GetNodeNames(void) const;
+   const C_OscSystemNameMultiset & m_GetBusNames(void) const;
+
+   // Names for the node and bus name conflict checks; rebuilt as soon as the names differ from the snapshots
+   mutable C_OscSystemNameMultiset mc_NodeNames; ///< Node names; base name for all sub nodes of a squad
+   mutable std::vector<stw::scl::C_SclString> mc_NodeNamesSnapshot;
+   mutable std::vector<C_OscNodeSquad> mc_NodeSquadsSnapshot;
+   mutable C_OscSystemNameMultiset mc_BusNames;
+   mutable std::vector<stw::scl::C_SclString> mc_BusNamesSnapshot;
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
@@ -0,0 +1,155 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Multiset of names for fast name conflict checks (implementation)
+
+   Counts the occurrences of each name of one scope (e.g. all Datapools of one node) so a name conflict check
+   becomes one lookup instead of a comparison with each sibling.
+   By default names are compared independent of character case; each name is only case folded once when it is
+   added or looked up.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include "C_OscSystemNameMultiset.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::scl;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+
+   \param[in]  oq_CaseSensitive  Flag if names which only differ in character case are different names
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscSystemNameMultiset::C_OscSystemNameMultiset(const bool oq_CaseSensitive) :
+   mq_CaseSensitive(oq_CaseSensitive)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Remove all names
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscSystemNameMultiset::Clear(void)
+{
+   this->mc_Counts.clear();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Add one occurrence of a name
+
+   \param[in]  orc_Name    Name
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscSystemNameMultiset::Add(const C_SclString & orc_Name)
+{
+   ++this->mc_Counts[this->m_GetKey(orc_Name)];
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Remove one occurrence of a name
+
+   \param[in]  orc_Name    Name
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscSystemNameMultiset::Remove(const C_SclString & orc_Name)
+{
+   const std::map<C_SclString, uint32_t>::iterator c_It = this->mc_Counts.find(this->m_GetKey(orc_Name));
+
+   if (c_It != this->mc_Counts.end())
+   {
+      if (c_It->second > 1UL)
+      {
+         --c_It->second;
+      }
+      else
+      {
+         this->mc_Counts.erase(c_It);
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get number of occurrences of a name
+
+   \param[in]  orc_Name    Name
+
+   \return
+   Number of added names equal to the name
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscSystemNameMultiset::GetCount(const C_SclString & orc_Name) const
+{
+   uint32_t u32_Retval = 0UL;
+   const std::map<C_SclString, uint32_t>::const_iterator c_It = this->mc_Counts.find(this->m_GetKey(orc_Name));
+
+   if (c_It != this->mc_Counts.end())
+   {
+      u32_Retval = c_It->second;
+   }
+   return u32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Check if two names are equal using the comparison of this multiset
+
+   \param[in]  orc_Name1   Name 1
+   \param[in]  orc_Name2   Name 2
+
+   \return
+   true     same name
+   false    different names
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscSystemNameMultiset::IsSameName(const C_SclString & orc_Name1, const C_SclString & orc_Name2) const
+{
+   bool q_Retval = (orc_Name1 == orc_Name2);
+
+   if (((q_Retval == false) && (this->mq_CaseSensitive == false)) && (orc_Name1.Length() == orc_Name2.Length()))
+   {
+      q_Retval = (orc_Name1.LowerCase() == orc_Name2.LowerCase());
+   }
+   return q_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get map key for name
+
+   \param[in]  orc_Name    Name
+
+   \return
+   Name as is or case folded name
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SclString C_OscSystemNameMultiset::m_GetKey(const C_SclString & orc_Name) const
+{
+   C_SclString c_Retval;
+
+   if (this->mq_CaseSensitive == true)
+   {
+      c_Retval = orc_Name;
+   }
+   else
+   {
+      c_Retval = orc_Name.LowerCase();
+   }
+   return c_Retval;
+}
@@ -0,0 +1,51 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Multiset of names for fast name conflict checks (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCSYSTEMNAMEMULTISET_HPP
+#define C_OSCSYSTEMNAMEMULTISET_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <map>
+
+#include "stwtypes.hpp"
+#include "C_SclString.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_OscSystemNameMultiset
+{
+public:
+   C_OscSystemNameMultiset(const bool oq_CaseSensitive = false);
+
+   void Clear(void);
+   void Add(const stw::scl::C_SclString & orc_Name);
+   void Remove(const stw::scl::C_SclString & orc_Name);
+   uint32_t GetCount(const stw::scl::C_SclString & orc_Name) const;
+   bool IsSameName(const stw::scl::C_SclString & orc_Name1, const stw::scl::C_SclString & orc_Name2) const;
+
+private:
+   stw::scl::C_SclString m_GetKey(const stw::scl::C_SclString & orc_Name) const;
+
+   bool mq_CaseSensitive;
+   std::map<stw::scl::C_SclString, uint32_t> mc_Counts; ///< Number of occurrences per (case folded) name
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
@@ -83,6 +83,7 @@ void C_OscNode::Initialize(void)
    {
       c_DataLoggerJobs.resize(1);
    }
+   this->mc_ErrorCheckCache.InvalidateAll();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -117,6 +118,7 @@ int32_t C_OscNode::InsertDataPool(const uint32_t ou32_DataPoolIndex, const C_Osc
    {
       s32_Retval = C_RANGE;
    }
+   this->mc_ErrorCheckCache.InvalidateAll();
    return s32_Retval;
 }
 
@@ -151,6 +153,7 @@ int32_t C_OscNode::DeleteDataPool(const uint32_t ou32_DataPoolIndex)
    {
       s32_Retval = C_RANGE;
    }
+   this->mc_ErrorCheckCache.InvalidateAll();
    return s32_Retval;
 }
 
@@ -196,6 +199,7 @@ int32_t C_OscNode::MoveDataPool(const uint32_t ou32_Start, const uint32_t ou32_T
       s32_Return = C_NO_ERR;
    }
 
+   this->mc_ErrorCheckCache.InvalidateAll();
    return s32_Return;
 }
 
@@ -280,6 +284,7 @@ int32_t C_OscNode::InsertMessage(const C_OscCanProtocol::E_Type oe_ComProtocol,
       s32_Retval = C_RANGE;
    }
 
+   this->mc_ErrorCheckCache.InvalidateDataPool(ou32_DatapoolIndex);
    return s32_Retval;
 }
 
@@ -374,6 +379,7 @@ int32_t C_OscNode::SetMessage(const C_OscCanProtocol::E_Type oe_ComProtocol, con
          rc_MessageContainer.ReCalcDataElementIndices();
       }
    }
+   this->mc_ErrorCheckCache.InvalidateDataPool(ou32_DatapoolIndex);
    return s32_Retval;
 }
 
@@ -450,6 +456,7 @@ int32_t C_OscNode::DeleteMessage(const C_OscCanProtocol::E_Type oe_ComProtocol,
       s32_Retval = C_RANGE;
    }
 
+   this->mc_ErrorCheckCache.InvalidateDataPool(ou32_DatapoolIndex);
    return s32_Retval;
 }
 
@@ -540,6 +547,7 @@ int32_t C_OscNode::InsertSignal(const C_OscCanProtocol::E_Type oe_ComProtocol, c
       s32_Retval = C_RANGE;
    }
 
+   this->mc_ErrorCheckCache.InvalidateDataPool(ou32_DatapoolIndex);
    return s32_Retval;
 }
 
@@ -614,6 +622,7 @@ int32_t C_OscNode::SetSignal(const C_OscCanProtocol::E_Type oe_ComProtocol, cons
       s32_Retval = C_RANGE;
    }
 
+   this->mc_ErrorCheckCache.InvalidateDataPool(ou32_DatapoolIndex);
    return s32_Retval;
 }
 
@@ -680,6 +689,7 @@ int32_t C_OscNode::SetSignalPosition(const C_OscCanProtocol::E_Type oe_ComProtoc
       s32_Retval = C_RANGE;
    }
 
+   this->mc_ErrorCheckCache.InvalidateDataPool(ou32_DatapoolIndex);
    return s32_Retval;
 }
 
@@ -743,6 +753,7 @@ int32_t C_OscNode::SetSignalMuxValue(const C_OscCanProtocol::E_Type oe_ComProtoc
       s32_Retval = C_RANGE;
    }
 
+   this->mc_ErrorCheckCache.InvalidateDataPool(ou32_DatapoolIndex);
    return s32_Retval;
 }
 
@@ -815,6 +826,7 @@ int32_t C_OscNode::DeleteSignal(const C_OscCanProtocol::E_Type oe_ComProtocol, c
       s32_Retval = C_RANGE;
    }
 
+   this->mc_ErrorCheckCache.InvalidateDataPool(ou32_DatapoolIndex);
    return s32_Retval;
 }
 
@@ -1699,22 +1711,10 @@ void C_OscNode::CheckErrorDataPool(const uint32_t ou32_DataPoolIndex, bool * con
             *opq_NameInvalid = false;
          }
       }
-      //Is the data pool name used more than once ?
+      //Is the data pool name used more than once ? (the checked Datapool itself is part of the names)
       if (opq_NameConflict != NULL)
       {
-         *opq_NameConflict = false;
-         for (uint32_t u32_ItElement = 0; u32_ItElement < this->c_DataPools.size(); ++u32_ItElement)
-         {
-            if (u32_ItElement != ou32_DataPoolIndex)
-            {
-               const C_OscNodeDataPool & rc_CurrentDataPool = this->c_DataPools[u32_ItElement];
-               if (rc_CheckedDataPool.c_Name.LowerCase() == rc_CurrentDataPool.c_Name.LowerCase())
-               {
-                  *opq_NameConflict = true;
-                  break;
-               }
-            }
-         }
+         *opq_NameConflict = (this->m_GetDataPoolNames().GetCount(rc_CheckedDataPool.c_Name) > 1UL);
       }
       //Lists
       if (opq_IsErrorInListOrMessage != NULL)
@@ -1743,7 +1743,6 @@ void C_OscNode::CheckErrorDataPool(const uint32_t ou32_DataPoolIndex, bool * con
             const C_OscCanProtocol * const pc_Protocol = this->GetRelatedCanProtocolConst(ou32_DataPoolIndex);
             if (pc_Protocol != NULL)
             {
-               static std::map<std::vector<uint32_t>, bool> hc_PreviousResults;
                for (uint32_t u32_ItContainer = 0; u32_ItContainer < pc_Protocol->c_ComMessages.size();
                     ++u32_ItContainer)
                {
@@ -1754,97 +1753,22 @@ void C_OscNode::CheckErrorDataPool(const uint32_t ou32_DataPoolIndex, bool * con
                       (C_OscCanProtocol::h_GetComListIndex(rc_CheckedDataPool, u32_ItContainer, false,
                                                            u32_RxListIndex) == C_NO_ERR))
                   {
-                     // Parameter oq_CanOpenPdoSyncValid is true in case of no CANopen protocol
-                     // to avoid a check for this scenario
-                     bool q_CanOpenPdoSyncValid = true;
-                     //Get Hash for all relevant data
-                     const uint32_t u32_HashCon = this->m_GetContainerHash(ou32_DataPoolIndex, u32_ItContainer);
-                     const uint32_t u32_HashTx = this->m_GetListHash(ou32_DataPoolIndex, u32_TxListIndex);
-                     const uint32_t u32_HashRx = this->m_GetListHash(ou32_DataPoolIndex, u32_RxListIndex);
-                     std::vector<uint32_t> c_Hashes;
-                     std::map<std::vector<uint32_t>, bool>::const_iterator c_It;
-                     c_Hashes.push_back(u32_HashCon);
-                     c_Hashes.push_back(u32_HashTx);
-                     c_Hashes.push_back(u32_HashRx);
-
-                     // Special case CANopen
-                     if (pc_Protocol->e_Type == C_OscCanProtocol::eCAN_OPEN)
-                     {
-                        // Get the CANopen Manager
-                        tgl_assert(u32_ItContainer < this->c_Properties.c_ComInterfaces.size());
-                        if (u32_ItContainer < this->c_Properties.c_ComInterfaces.size())
-                        {
-                           const std::map<uint8_t,
-                                          C_OscCanOpenManagerInfo>::const_iterator c_ItCoManager =
-                              this->c_CanOpenManagers.find(this->c_Properties.c_ComInterfaces[
-                                                              u32_ItContainer].u8_InterfaceNumber);
-
-                           // Check if it is the CANopen Manager of this bus
-                           if (c_ItCoManager != this->c_CanOpenManagers.end())
-                           {
-                              uint32_t u32_HashManager;
-                              const C_OscCanOpenManagerInfo & rc_Manager = c_ItCoManager->second;
-                              // When PDO SYNC message is produces, a configured TX method with PDO SYNC
-                              // is valid
-                              q_CanOpenPdoSyncValid = rc_Manager.q_ProduceSyncMessage;
-
-                              // Due to impacts on the error detection in case of changes of CANopen Manger
-                              // configuration, the hash of the CANopen Manager is relevant too
-                              rc_Manager.CalcHash(u32_HashManager);
-                              c_Hashes.push_back(u32_HashManager);
-                           }
-                        }
-                     }
+                     bool q_Error;
 
-                     //Check if check was already performed in the past
-                     c_It = hc_PreviousResults.find(c_Hashes);
-                     if (c_It == hc_PreviousResults.end())
+                     //Check if check was already performed since the last change
+                     if (this->mc_ErrorCheckCache.GetContainerResult(ou32_DataPoolIndex, u32_ItContainer,
+                                                                     q_Error) == false)
                      {
-                        if ((u32_TxListIndex < rc_CheckedDataPool.c_Lists.size()) &&
-                            (u32_RxListIndex < rc_CheckedDataPool.c_Lists.size()))
-                        {
-                           const C_OscCanMessageContainer & rc_Container = pc_Protocol->c_ComMessages[u32_ItContainer];
-
-                           const bool q_Error = rc_Container.CheckLocalError(
-                              rc_CheckedDataPool.c_Lists[u32_TxListIndex],
-                              rc_CheckedDataPool.c_Lists[u32_RxListIndex],
-                              C_OscCanProtocol::h_GetCanMessageValidSignalsDlcOffset(pc_Protocol->e_Type),
-                              C_OscCanProtocol::h_GetCanMessageSignalGapsValid(pc_Protocol->e_Type),
-                              C_OscCanProtocol::h_GetCanMessageSignalByteAlignmentRequired(pc_Protocol->e_Type),
-                              C_OscCanProtocol::h_GetCanMessageSignalsRequired(pc_Protocol->e_Type),
-                              q_CanOpenPdoSyncValid);
-                           if (q_Error == true)
-                           {
-                              *opq_IsErrorInListOrMessage = true;
-                              if (opc_InvalidListIndices != NULL)
-                              {
-                                 opc_InvalidListIndices->push_back(u32_ItContainer);
-                              }
-                              //Append for possible reusing this result
-                              hc_PreviousResults[c_Hashes] = true;
-                           }
-                           else
-                           {
-                              //Append for possible reusing this result
-                              hc_PreviousResults[c_Hashes] = false;
-                           }
-                        }
-                        else
-                        {
-                           *opq_IsErrorInListOrMessage = true;
-                           if (opc_InvalidListIndices != NULL)
-                           {
-                              opc_InvalidListIndices->push_back(u32_ItContainer);
-                           }
-                           //Append for possible reusing this result
-                           hc_PreviousResults[c_Hashes] = true;
-                        }
+                        q_Error = this->m_CheckErrorMessageContainer(*pc_Protocol, rc_CheckedDataPool,
+                                                                     u32_ItContainer, u32_TxListIndex,
+                                                                     u32_RxListIndex);
+                        //Append for possible reusing this result
+                        this->mc_ErrorCheckCache.SetContainerResult(ou32_DataPoolIndex, u32_ItContainer, q_Error);
                      }
-                     else
+                     if (q_Error == true)
                      {
-                        //Do not reset error
-                        *opq_IsErrorInListOrMessage = (*opq_IsErrorInListOrMessage) || (c_It->second);
-                        if ((opc_InvalidListIndices != NULL) && (c_It->second))
+                        *opq_IsErrorInListOrMessage = true;
+                        if (opc_InvalidListIndices != NULL)
                         {
                            opc_InvalidListIndices->push_back(u32_ItContainer);
                         }
@@ -1860,7 +1784,6 @@ void C_OscNode::CheckErrorDataPool(const uint32_t ou32_DataPoolIndex, bool * con
          else
          {
             std::map<stw::scl::C_SclString, uint32_t> c_PreviousNames;
-            static std::map<uint32_t, bool> hc_PreviousResults;
             bool q_CheckSize;
             bool q_NameInvalid;
             bool q_UsageInvalid;
@@ -1913,14 +1836,11 @@ void C_OscNode::CheckErrorDataPool(const uint32_t ou32_DataPoolIndex, bool * con
                }
                else
                {
-                  //Get Hash for all relevant data
-                  const uint32_t u32_Hash = this->m_GetListHash(ou32_DataPoolIndex, u32_ItList);
-                  //Check if check was already performed in the past
-                  const std::map<uint32_t, bool>::const_iterator c_ItErr = hc_PreviousResults.find(u32_Hash);
+                  bool q_Error;
                   //Append new name
                   c_PreviousNames[rc_List.c_Name.LowerCase()] = u32_ItList;
-                  //Element specific checks
-                  if (c_ItErr == hc_PreviousResults.end())
+                  //Element specific checks; check if check was already performed since the last change
+                  if (this->mc_ErrorCheckCache.GetListResult(ou32_DataPoolIndex, u32_ItList, q_Error) == false)
                   {
                      q_NameInvalid = false;
                      q_UsageInvalid = false;
@@ -1935,28 +1855,16 @@ void C_OscNode::CheckErrorDataPool(const uint32_t ou32_DataPoolIndex, bool * con
                         q_UsageInvalid = false;
                         q_OutOfDataPool = false;
                      }
-                     if (((((q_NameInvalid == true) || (q_UsageInvalid == true)) ||
-                           (q_ElementsInvalid == true)) || (q_OutOfDataPool == true)) || (q_DataSetsInvalid == true))
-                     {
-                        *opq_IsErrorInListOrMessage = true;
-                        if (opc_InvalidListIndices != NULL)
-                        {
-                           opc_InvalidListIndices->push_back(u32_ItList);
-                        }
-                        //Append for possible reusing this result
-                        hc_PreviousResults[u32_Hash] = true;
-                     }
-                     else
-                     {
-                        //Append for possible reusing this result
-                        hc_PreviousResults[u32_Hash] = false;
-                     }
+                     q_Error = ((((q_NameInvalid == true) || (q_UsageInvalid == true)) ||
+                                 (q_ElementsInvalid == true)) || (q_OutOfDataPool == true)) ||
+                               (q_DataSetsInvalid == true);
+                     //Append for possible reusing this result
+                     this->mc_ErrorCheckCache.SetListResult(ou32_DataPoolIndex, u32_ItList, q_Error);
                   }
-                  else
+                  if (q_Error == true)
                   {
-                     //Do not reset error
-                     *opq_IsErrorInListOrMessage = (*opq_IsErrorInListOrMessage) || (c_ItErr->second);
-                     if ((opc_InvalidListIndices != NULL) && (c_ItErr->second))
+                     *opq_IsErrorInListOrMessage = true;
+                     if (opc_InvalidListIndices != NULL)
                      {
                         opc_InvalidListIndices->push_back(u32_ItList);
                      }
@@ -2042,22 +1950,30 @@ void C_OscNode::CheckMessageName(const uint32_t ou32_InterfaceIndex, const stw::
 {
    if (C_OscUtils::h_CheckValidCeName(orc_MessageName) == true)
    {
-      std::vector<const C_OscCanMessage *> c_Messages;
-      m_GetAllMessages(ou32_InterfaceIndex, c_Messages, ope_SkipComProtocol, opu32_SkipInterfaceIndex,
-                       opq_SkipMessageIsTxFlag, opu32_SkipMessageIndex);
-      orq_Valid = true;
-      for (uint32_t u32_ItMessage = 0; u32_ItMessage < c_Messages.size(); ++u32_ItMessage)
+      uint32_t u32_Count = this->m_GetMessageNames(ou32_InterfaceIndex).GetCount(orc_MessageName);
+
+      //Remove the skipped messages from the count (same matching as in m_AppendAllProtocolMessages)
+      if (((((ope_SkipComProtocol != NULL) && (opu32_SkipInterfaceIndex != NULL)) &&
+            (opq_SkipMessageIsTxFlag != NULL)) && (opu32_SkipMessageIndex != NULL)) &&
+          (*opu32_SkipInterfaceIndex == ou32_InterfaceIndex))
       {
-         const C_OscCanMessage * const pc_CurMessage = c_Messages[u32_ItMessage];
-         if (pc_CurMessage != NULL)
+         for (uint32_t u32_ItCanProtocol = 0; u32_ItCanProtocol < this->c_ComProtocols.size(); ++u32_ItCanProtocol)
          {
-            //No skip necessary as they should be already filtered
-            if (pc_CurMessage->c_Name == orc_MessageName)
+            const C_OscCanProtocol & rc_CanProtocol = this->c_ComProtocols[u32_ItCanProtocol];
+            if ((rc_CanProtocol.e_Type == *ope_SkipComProtocol) &&
+                (ou32_InterfaceIndex < rc_CanProtocol.c_ComMessages.size()))
             {
-               orq_Valid = false;
+               const std::vector<C_OscCanMessage> & rc_Messages =
+                  rc_CanProtocol.c_ComMessages[ou32_InterfaceIndex].GetMessagesConst(*opq_SkipMessageIsTxFlag);
+               if ((*opu32_SkipMessageIndex < rc_Messages.size()) &&
+                   ((rc_Messages[*opu32_SkipMessageIndex].c_Name == orc_MessageName) && (u32_Count > 0UL)))
+               {
+                  --u32_Count;
+               }
             }
          }
       }
+      orq_Valid = (u32_Count == 0UL);
    }
    else
    {
@@ -2065,6 +1981,61 @@ void C_OscNode::CheckMessageName(const uint32_t ou32_InterfaceIndex, const stw::
    }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Check if the list name is used more than once in its Datapool (independent of character case)
+
+   \param[in]  ou32_DataPoolIndex   Datapool index
+   \param[in]  ou32_ListIndex       List index
+
+   \return
+   true     name conflict
+   false    no conflict or list does not exist
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscNode::CheckListNameConflict(const uint32_t ou32_DataPoolIndex, const uint32_t ou32_ListIndex) const
+{
+   bool q_Retval = false;
+
+   if ((ou32_DataPoolIndex < this->c_DataPools.size()) &&
+       (ou32_ListIndex < this->c_DataPools[ou32_DataPoolIndex].c_Lists.size()))
+   {
+      const C_OscNodeDataPoolList & rc_List = this->c_DataPools[ou32_DataPoolIndex].c_Lists[ou32_ListIndex];
+      q_Retval = (this->m_GetListNames(ou32_DataPoolIndex).GetCount(rc_List.c_Name) > 1UL);
+   }
+   return q_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Check if the element name is used more than once in its list (independent of character case)
+
+   \param[in]  ou32_DataPoolIndex   Datapool index
+   \param[in]  ou32_ListIndex       List index
+   \param[in]  ou32_ElementIndex    Element index
+
+   \return
+   true     name conflict
+   false    no conflict or element does not exist
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscNode::CheckElementNameConflict(const uint32_t ou32_DataPoolIndex, const uint32_t ou32_ListIndex,
+                                         const uint32_t ou32_ElementIndex) const
+{
+   bool q_Retval = false;
+
+   if ((ou32_DataPoolIndex < this->c_DataPools.size()) &&
+       (ou32_ListIndex < this->c_DataPools[ou32_DataPoolIndex].c_Lists.size()))
+   {
+      const C_OscNodeDataPoolList & rc_List = this->c_DataPools[ou32_DataPoolIndex].c_Lists[ou32_ListIndex];
+      if (ou32_ElementIndex < rc_List.c_Elements.size())
+      {
+         const C_OscNodeDataPoolListElement & rc_Element = rc_List.c_Elements[ou32_ElementIndex];
+         q_Retval =
+            (this->m_GetElementNames(ou32_DataPoolIndex, ou32_ListIndex).GetCount(rc_Element.c_Name) > 1UL);
+      }
+   }
+   return q_Retval;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Check application process ID valid
 
@@ -2153,6 +2124,7 @@ void C_OscNode::ReCalcCanProtocolDataPoolIndices(void)
          }
       }
    }
+   this->mc_ErrorCheckCache.InvalidateAll();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -2237,6 +2209,7 @@ void C_OscNode::RecalculateAddress(void)
          u32_Offset += rc_DataPool.u32_NvmSize;
       }
    }
+   this->mc_ErrorCheckCache.InvalidateAll();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -2292,6 +2265,7 @@ void C_OscNode::HandleNameMaxCharLimit(const uint32_t ou32_NameMaxCharLimit,
                                                                                 rc_Datablock.c_Name,
                                                                                 opc_ChangedItems);
    }
+   this->mc_ErrorCheckCache.InvalidateAll();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -2315,6 +2289,198 @@ C_OscNodeDataPoolListElement * C_OscNode::GetDataPoolListElement(const uint32_t
 {
    C_OscNodeDataPoolListElement * pc_Element = NULL;
 
+   if ((ou32_DataPoolIndex < this->c_DataPools.size()) &&
+       (ou32_ListIndex < this->c_DataPools[ou32_DataPoolIndex].c_Lists.size()) &&
+       (ou32_ElementIndex < this->c_DataPools[ou32_DataPoolIndex].c_Lists[ou32_ListIndex].c_Elements.size()))
+   {
+      pc_Element = &this->c_DataPools[ou32_DataPoolIndex].c_Lists[ou32_ListIndex].c_Elements[ou32_ElementIndex];
+      //The element might get changed by the caller
+      this->mc_ErrorCheckCache.InvalidateDataPool(ou32_DataPoolIndex);
+   }
+   return pc_Element;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get current value of data pool element
+
+   Copies the value with the values lock acquired, so it can be used while data dealers write the value.
+
+   \param[in]   ou32_DataPoolIndex   data pool index
+   \param[in]   ou32_ListIndex       list index
+   \param[in]   ou32_ElementIndex    element index
+   \param[out]  orc_Value            value of element (c_Value)
+
+   \return
+   C_NO_ERR   value copied
+   C_RANGE    one of the parameters is out of range
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscNode::GetDataPoolListElementValue(const uint32_t ou32_DataPoolIndex, const uint32_t ou32_ListIndex,
+                                               const uint32_t ou32_ElementIndex,
+                                               C_OscNodeDataPoolContent & orc_Value) const
+{
+   int32_t s32_Retval = C_RANGE;
+   const C_OscNodeDataPoolListElement * const pc_Element = this->m_GetDataPoolListElementConst(ou32_DataPoolIndex,
+                                                                                               ou32_ListIndex,
+                                                                                               ou32_ElementIndex);
+
+   if (pc_Element != NULL)
+   {
+      this->mc_ValuesLock.Acquire();
+      orc_Value = pc_Element->c_Value;
+      this->mc_ValuesLock.Release();
+      s32_Retval = C_NO_ERR;
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Set current value of data pool element
+
+   Copies the value with the values lock acquired, so it can be used while data dealers access the value.
+
+   \param[in]  ou32_DataPoolIndex   data pool index
+   \param[in]  ou32_ListIndex       list index
+   \param[in]  ou32_ElementIndex    element index
+   \param[in]  orc_Value            new value of element (c_Value)
+
+   \return
+   C_NO_ERR   value set
+   C_RANGE    one of the parameters is out of range
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscNode::SetDataPoolListElementValue(const uint32_t ou32_DataPoolIndex, const uint32_t ou32_ListIndex,
+                                               const uint32_t ou32_ElementIndex,
+                                               const C_OscNodeDataPoolContent & orc_Value)
+{
+   int32_t s32_Retval = C_RANGE;
+
+   if (this->m_GetDataPoolListElementConst(ou32_DataPoolIndex, ou32_ListIndex, ou32_ElementIndex) != NULL)
+   {
+      C_OscNodeDataPoolListElement & rc_Element =
+         this->c_DataPools[ou32_DataPoolIndex].c_Lists[ou32_ListIndex].c_Elements[ou32_ElementIndex];
+      this->mc_ValuesLock.Acquire();
+      rc_Element.c_Value = orc_Value;
+      this->mc_ValuesLock.Release();
+      s32_Retval = C_NO_ERR;
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get NVM value of data pool element
+
+   Copies the value with the values lock acquired, so it can be used while data dealers write the value.
+
+   \param[in]   ou32_DataPoolIndex   data pool index
+   \param[in]   ou32_ListIndex       list index
+   \param[in]   ou32_ElementIndex    element index
+   \param[out]  orc_Value            NVM value of element (c_NvmValue)
+
+   \return
+   C_NO_ERR   value copied
+   C_RANGE    one of the parameters is out of range
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscNode::GetDataPoolListElementNvmValue(const uint32_t ou32_DataPoolIndex, const uint32_t ou32_ListIndex,
+                                                  const uint32_t ou32_ElementIndex,
+                                                  C_OscNodeDataPoolContent & orc_Value) const
+{
+   int32_t s32_Retval = C_RANGE;
+   const C_OscNodeDataPoolListElement * const pc_Element = this->m_GetDataPoolListElementConst(ou32_DataPoolIndex,
+                                                                                               ou32_ListIndex,
+                                                                                               ou32_ElementIndex);
+
+   if (pc_Element != NULL)
+   {
+      this->mc_ValuesLock.Acquire();
+      orc_Value = pc_Element->c_NvmValue;
+      this->mc_ValuesLock.Release();
+      s32_Retval = C_NO_ERR;
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Set NVM value of data pool element
+
+   Copies the value with the values lock acquired, so it can be used while data dealers access the value.
+
+   \param[in]  ou32_DataPoolIndex   data pool index
+   \param[in]  ou32_ListIndex       list index
+   \param[in]  ou32_ElementIndex    element index
+   \param[in]  orc_Value            new NVM value of element (c_NvmValue)
+
+   \return
+   C_NO_ERR   value set
+   C_RANGE    one of the parameters is out of range
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscNode::SetDataPoolListElementNvmValue(const uint32_t ou32_DataPoolIndex, const uint32_t ou32_ListIndex,
+                                                  const uint32_t ou32_ElementIndex,
+                                                  const C_OscNodeDataPoolContent & orc_Value)
+{
+   int32_t s32_Retval = C_RANGE;
+
+   if (this->m_GetDataPoolListElementConst(ou32_DataPoolIndex, ou32_ListIndex, ou32_ElementIndex) != NULL)
+   {
+      C_OscNodeDataPoolListElement & rc_Element =
+         this->c_DataPools[ou32_DataPoolIndex].c_Lists[ou32_ListIndex].c_Elements[ou32_ElementIndex];
+      this->mc_ValuesLock.Acquire();
+      rc_Element.c_NvmValue = orc_Value;
+      this->mc_ValuesLock.Release();
+      s32_Retval = C_NO_ERR;
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get lock of the communication values of this node
+
+   The data dealers write c_Value, c_NvmValue and the NVM flags of the data pool elements of their node
+   from the communication thread, with this lock acquired.
+   Other threads accessing these values of the same node need to hold this lock as well;
+   for single values use the value getters and setters of the node which do so.
+   The lock is not recursive and only covers this node.
+
+   \return
+   Lock of this node
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscNodeValuesLock & C_OscNode::GetValuesLock(void) const
+{
+   return this->mc_ValuesLock;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Drop all cached Datapool list and message container check results
+
+   Has to be called after changing the node content directly (i.e. not via the node functions)
+   so the next call of CheckErrorDataPool checks the changed content again.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNode::InvalidateErrorCheckCache(void)
+{
+   this->mc_ErrorCheckCache.InvalidateAll();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Utility: get specific data pool element without invalidating the cached check results
+
+   \param[in]  ou32_DataPoolIndex   data pool index
+   \param[in]  ou32_ListIndex       list index
+   \param[in]  ou32_ElementIndex    element index
+
+   \return
+   Pointer to specified data pool element; NULL if one of the parameters is out of range
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_OscNodeDataPoolListElement * C_OscNode::m_GetDataPoolListElementConst(const uint32_t ou32_DataPoolIndex,
+                                                                            const uint32_t ou32_ListIndex,
+                                                                            const uint32_t ou32_ElementIndex) const
+{
+   const C_OscNodeDataPoolListElement * pc_Element = NULL;
+
    if ((ou32_DataPoolIndex < this->c_DataPools.size()) &&
        (ou32_ListIndex < this->c_DataPools[ou32_DataPoolIndex].c_Lists.size()) &&
        (ou32_ElementIndex < this->c_DataPools[ou32_DataPoolIndex].c_Lists[ou32_ListIndex].c_Elements.size()))
@@ -2445,55 +2611,63 @@ void C_OscNode::m_AppendAllProtocolMessages(const uint32_t ou32_InterfaceIndex,
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-/*! \brief  Get hash for list
-
-   \param[in]  ou32_DataPoolIndex   Data pool index
-   \param[in]  ou32_ListIndex       List index
-
-   \return
-   Hash for list
-*/
-//----------------------------------------------------------------------------------------------------------------------
-uint32_t C_OscNode::m_GetListHash(const uint32_t ou32_DataPoolIndex, const uint32_t ou32_ListIndex) const
-{
-   uint32_t u32_Retval = 0xFFFFFFFFUL;
-
-   if (ou32_DataPoolIndex < this->c_DataPools.size())
-   {
-      const C_OscNodeDataPool & rc_Dp = this->c_DataPools[ou32_DataPoolIndex];
-      if (ou32_ListIndex < rc_Dp.c_Lists.size())
-      {
-         const C_OscNodeDataPoolList & rc_List = rc_Dp.c_Lists[ou32_ListIndex];
-         rc_List.CalcHash(u32_Retval);
-      }
-   }
-   return u32_Retval;
-}
-
-//----------------------------------------------------------------------------------------------------------------------
-/*! \brief  Get hash for container
+/*! \brief  Check one message container and the related lists of a COM Datapool
 
-   \param[in]  ou32_DataPoolIndex   Data pool index
+   \param[in]  orc_Protocol         Protocol of the COM Datapool
+   \param[in]  orc_DataPool         COM Datapool
    \param[in]  ou32_ContainerIndex  Container index
+   \param[in]  ou32_TxListIndex     Tx list index
+   \param[in]  ou32_RxListIndex     Rx list index
 
    \return
-   Hash for container
+   true     error detected
+   false    no error
 */
 //----------------------------------------------------------------------------------------------------------------------
-uint32_t C_OscNode::m_GetContainerHash(const uint32_t ou32_DataPoolIndex, const uint32_t ou32_ContainerIndex) const
+bool C_OscNode::m_CheckErrorMessageContainer(const C_OscCanProtocol & orc_Protocol,
+                                             const C_OscNodeDataPool & orc_DataPool,
+                                             const uint32_t ou32_ContainerIndex, const uint32_t ou32_TxListIndex,
+                                             const uint32_t ou32_RxListIndex) const
 {
-   uint32_t u32_Retval = 0xFFFFFFFFUL;
-   const C_OscCanProtocol * const pc_Protocol = this->GetRelatedCanProtocolConst(ou32_DataPoolIndex);
+   bool q_Error = true;
 
-   if (pc_Protocol != NULL)
+   if (((ou32_TxListIndex < orc_DataPool.c_Lists.size()) && (ou32_RxListIndex < orc_DataPool.c_Lists.size())) &&
+       (ou32_ContainerIndex < orc_Protocol.c_ComMessages.size()))
    {
-      if (ou32_ContainerIndex < pc_Protocol->c_ComMessages.size())
+      // Parameter oq_CanOpenPdoSyncValid is true in case of no CANopen protocol
+      // to avoid a check for this scenario
+      bool q_CanOpenPdoSyncValid = true;
+
+      // Special case CANopen
+      if (orc_Protocol.e_Type == C_OscCanProtocol::eCAN_OPEN)
       {
-         const C_OscCanMessageContainer & rc_Container = pc_Protocol->c_ComMessages[ou32_ContainerIndex];
-         rc_Container.CalcHash(u32_Retval);
+         // Get the CANopen Manager
+         tgl_assert(ou32_ContainerIndex < this->c_Properties.c_ComInterfaces.size());
+         if (ou32_ContainerIndex < this->c_Properties.c_ComInterfaces.size())
+         {
+            const std::map<uint8_t, C_OscCanOpenManagerInfo>::const_iterator c_ItCoManager =
+               this->c_CanOpenManagers.find(this->c_Properties.c_ComInterfaces[ou32_ContainerIndex].u8_InterfaceNumber);
+
+            // Check if it is the CANopen Manager of this bus
+            if (c_ItCoManager != this->c_CanOpenManagers.end())
+            {
+               // When PDO SYNC message is produces, a configured TX method with PDO SYNC
+               // is valid
+               q_CanOpenPdoSyncValid = c_ItCoManager->second.q_ProduceSyncMessage;
+            }
+         }
       }
+
+      q_Error = orc_Protocol.c_ComMessages[ou32_ContainerIndex].CheckLocalError(
+         orc_DataPool.c_Lists[ou32_TxListIndex],
+         orc_DataPool.c_Lists[ou32_RxListIndex],
+         C_OscCanProtocol::h_GetCanMessageValidSignalsDlcOffset(orc_Protocol.e_Type),
+         C_OscCanProtocol::h_GetCanMessageSignalGapsValid(orc_Protocol.e_Type),
+         C_OscCanProtocol::h_GetCanMessageSignalByteAlignmentRequired(orc_Protocol.e_Type),
+         C_OscCanProtocol::h_GetCanMessageSignalsRequired(orc_Protocol.e_Type),
+         q_CanOpenPdoSyncValid);
    }
-   return u32_Retval;
+   return q_Error;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -2597,3 +2771,122 @@ bool C_OscNode::m_CheckErrorTooFewElements(const uint32_t ou32_DataPoolIndex) co
    }
    return orq_TooFewListsOrElements;
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get names of all Datapools (built on demand and cached until the next change)
+
+   \return
+   Names of all Datapools
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_OscSystemNameMultiset & C_OscNode::m_GetDataPoolNames(void) const
+{
+   const C_OscSystemNameMultiset * pc_Names = this->mc_ErrorCheckCache.GetDataPoolNames();
+
+   if (pc_Names == NULL)
+   {
+      C_OscSystemNameMultiset c_Names;
+      for (uint32_t u32_ItDataPool = 0UL; u32_ItDataPool < this->c_DataPools.size(); ++u32_ItDataPool)
+      {
+         c_Names.Add(this->c_DataPools[u32_ItDataPool].c_Name);
+      }
+      this->mc_ErrorCheckCache.SetDataPoolNames(c_Names);
+      pc_Names = this->mc_ErrorCheckCache.GetDataPoolNames();
+   }
+   tgl_assert(pc_Names != NULL);
+   return *pc_Names;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get names of all lists of one Datapool (built on demand and cached until the next change)
+
+   \param[in]  ou32_DataPoolIndex   Datapool index (has to be valid)
+
+   \return
+   Names of all lists
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_OscSystemNameMultiset & C_OscNode::m_GetListNames(const uint32_t ou32_DataPoolIndex) const
+{
+   const C_OscSystemNameMultiset * pc_Names = this->mc_ErrorCheckCache.GetListNames(ou32_DataPoolIndex);
+
+   if (pc_Names == NULL)
+   {
+      C_OscSystemNameMultiset c_Names;
+      const C_OscNodeDataPool & rc_DataPool = this->c_DataPools[ou32_DataPoolIndex];
+      for (uint32_t u32_ItList = 0UL; u32_ItList < rc_DataPool.c_Lists.size(); ++u32_ItList)
+      {
+         c_Names.Add(rc_DataPool.c_Lists[u32_ItList].c_Name);
+      }
+      this->mc_ErrorCheckCache.SetListNames(ou32_DataPoolIndex, c_Names);
+      pc_Names = this->mc_ErrorCheckCache.GetListNames(ou32_DataPoolIndex);
+   }
+   tgl_assert(pc_Names != NULL);
+   return *pc_Names;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get names of all elements of one list (built on demand and cached until the next change)
+
+   \param[in]  ou32_DataPoolIndex   Datapool index (has to be valid)
+   \param[in]  ou32_ListIndex       List index (has to be valid)
+
+   \return
+   Names of all elements
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_OscSystemNameMultiset & C_OscNode::m_GetElementNames(const uint32_t ou32_DataPoolIndex,
+                                                             const uint32_t ou32_ListIndex) const
+{
+   const C_OscSystemNameMultiset * pc_Names = this->mc_ErrorCheckCache.GetElementNames(ou32_DataPoolIndex,
+                                                                                       ou32_ListIndex);
+
+   if (pc_Names == NULL)
+   {
+      C_OscSystemNameMultiset c_Names;
+      const C_OscNodeDataPoolList & rc_List = this->c_DataPools[ou32_DataPoolIndex].c_Lists[ou32_ListIndex];
+      for (uint32_t u32_ItElement = 0UL; u32_ItElement < rc_List.c_Elements.size(); ++u32_ItElement)
+      {
+         c_Names.Add(rc_List.c_Elements[u32_ItElement].c_Name);
+      }
+      this->mc_ErrorCheckCache.SetElementNames(ou32_DataPoolIndex, ou32_ListIndex, c_Names);
+      pc_Names = this->mc_ErrorCheckCache.GetElementNames(ou32_DataPoolIndex, ou32_ListIndex);
+   }
+   tgl_assert(pc_Names != NULL);
+   return *pc_Names;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get names of all messages of one interface (built on demand and cached until the next change)
+
+   Contains the messages of all protocols. Message names are case sensitive.
+
+   \param[in]  ou32_InterfaceIndex  Interface index
+
+   \return
+   Names of all messages
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_OscSystemNameMultiset & C_OscNode::m_GetMessageNames(const uint32_t ou32_InterfaceIndex) const
+{
+   const C_OscSystemNameMultiset * pc_Names = this->mc_ErrorCheckCache.GetMessageNames(ou32_InterfaceIndex);
+
+   if (pc_Names == NULL)
+   {
+      C_OscSystemNameMultiset c_Names(true);
+      std::vector<const C_OscCanMessage *> c_Messages;
+      this->m_GetAllMessages(ou32_InterfaceIndex, c_Messages);
+      for (uint32_t u32_ItMessage = 0UL; u32_ItMessage < c_Messages.size(); ++u32_ItMessage)
+      {
+         const C_OscCanMessage * const pc_Message = c_Messages[u32_ItMessage];
+         if (pc_Message != NULL)
+         {
+            c_Names.Add(pc_Message->c_Name);
+         }
+      }
+      this->mc_ErrorCheckCache.SetMessageNames(ou32_InterfaceIndex, c_Names);
+      pc_Names = this->mc_ErrorCheckCache.GetMessageNames(ou32_InterfaceIndex);
+   }
+   tgl_assert(pc_Names != NULL);
+   return *pc_Names;
+}
@@ -23,6 +23,8 @@
 #include "C_OscDataLoggerJob.hpp"
 #include "C_OscCanMessageUniqueId.hpp"
 #include "C_OscCanOpenManagerInfo.hpp"
+#include "C_OscNodeErrorCheckCache.hpp"
+#include "C_OscNodeValuesLock.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 namespace stw
@@ -131,6 +133,9 @@ public:
                          const uint32_t * const opu32_SkipInterfaceIndex = NULL,
                          const bool * const opq_SkipMessageIsTxFlag = NULL,
                          const uint32_t * const opu32_SkipMessageIndex = NULL) const;
+   bool CheckListNameConflict(const uint32_t ou32_DataPoolIndex, const uint32_t ou32_ListIndex) const;
+   bool CheckElementNameConflict(const uint32_t ou32_DataPoolIndex, const uint32_t ou32_ListIndex,
+                                 const uint32_t ou32_ElementIndex) const;
    int32_t CheckApplicationProcessIdValid(const uint32_t ou32_ApplicationIndex, bool & orq_Valid) const;
    void CheckHalcConfigValid(bool * const opq_ConfigInvalid,
                              std::vector<uint32_t> * const opc_InvalidDomainIndices) const;
@@ -145,6 +150,17 @@ public:
    C_OscNodeDataPoolListElement * GetDataPoolListElement(const uint32_t ou32_DataPoolIndex,
                                                          const uint32_t ou32_ListIndex,
                                                          const uint32_t ou32_ElementIndex);
+   int32_t GetDataPoolListElementValue(const uint32_t ou32_DataPoolIndex, const uint32_t ou32_ListIndex,
+                                       const uint32_t ou32_ElementIndex, C_OscNodeDataPoolContent & orc_Value) const;
+   int32_t SetDataPoolListElementValue(const uint32_t ou32_DataPoolIndex, const uint32_t ou32_ListIndex,
+                                       const uint32_t ou32_ElementIndex, const C_OscNodeDataPoolContent & orc_Value);
+   int32_t GetDataPoolListElementNvmValue(const uint32_t ou32_DataPoolIndex, const uint32_t ou32_ListIndex,
+                                          const uint32_t ou32_ElementIndex,
+                                          C_OscNodeDataPoolContent & orc_Value) const;
+   int32_t SetDataPoolListElementNvmValue(const uint32_t ou32_DataPoolIndex, const uint32_t ou32_ListIndex,
+                                          const uint32_t ou32_ElementIndex, const C_OscNodeDataPoolContent & orc_Value);
+   C_OscNodeValuesLock & GetValuesLock(void) const;
+   void InvalidateErrorCheckCache(void);
 
    const C_OscDeviceDefinition * pc_DeviceDefinition; ///< Pointer to device definition
    uint32_t u32_SubDeviceIndex;
@@ -188,13 +204,28 @@ private:
                                     const uint32_t * const opu32_SkipInterfaceIndex = NULL,
                                     const bool * const opq_SkipMessageIsTxFlag = NULL,
                                     const uint32_t * const opu32_SkipMessageIndex = NULL) const;
-   uint32_t m_GetListHash(const uint32_t ou32_DataPoolIndex, const uint32_t ou32_ListIndex) const;
-   uint32_t m_GetContainerHash(const uint32_t ou32_DataPoolIndex, const uint32_t ou32_ContainerIndex) const;
+   bool m_CheckErrorMessageContainer(const C_OscCanProtocol & orc_Protocol, const C_OscNodeDataPool & orc_DataPool,
+                                     const uint32_t ou32_ContainerIndex, const uint32_t ou32_TxListIndex,
+                                     const uint32_t ou32_RxListIndex) const;
    static void mh_CheckErrorCanProtocolDirection(const std::vector<C_OscCanMessage> & orc_Messages,
                                                  const C_OscCanProtocol::E_Type oe_ComProtocol,
                                                  bool & orq_InvalidMaxSignalCount, bool & orq_InvalidCoPdoCount,
                                                  bool & orq_InvalidMinSignalCount);
    bool m_CheckErrorTooFewElements(const uint32_t ou32_DataPoolIndex) const;
+   const C_OscSystemNameMultiset & m_GetDataPoolNames(void) const;
+   const C_OscSystemNameMultiset & m_GetListNames(const uint32_t ou32_DataPoolIndex) const;
+   const C_OscSystemNameMultiset & m_GetElementNames(const uint32_t ou32_DataPoolIndex,
+                                                     const uint32_t ou32_ListIndex) const;
+   const C_OscSystemNameMultiset & m_GetMessageNames(const uint32_t ou32_InterfaceIndex) const;
+   const C_OscNodeDataPoolListElement * m_GetDataPoolListElementConst(const uint32_t ou32_DataPoolIndex,
+                                                                      const uint32_t ou32_ListIndex,
+                                                                      const uint32_t ou32_ElementIndex) const;
+
+   // Results of the list and message container checks of CheckErrorDataPool and the names of each scope;
+   // invalidated on changes
+   mutable C_OscNodeErrorCheckCache mc_ErrorCheckCache;
+   // Protects the values written by the data dealers of an active communication (see GetValuesLock)
+   mutable C_OscNodeValuesLock mc_ValuesLock;
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
@@ -0,0 +1,1105 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Compact binary reader/writer for node data pool content (implementation)
+
+   Binary counterpart of the XML node data pool filer for fast in-process transfers like clipboard copy and paste.
+   Saves and restores exactly the information the XML filer stores (same conditional NVM and diagnostic fields, same
+   restored current and NVM values) so both representations load to the same content.
+
+   Layout: little endian fixed size integers, IEEE 754 float64 values, strings and vectors prefixed by their
+   length. Each buffer starts with a header (magic, format version, payload type); buffers with an unknown version
+   are rejected so the caller can fall back to the XML representation.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <cstring>
+
+#include "stwerrors.hpp"
+#include "C_OscNodeDataPoolBinaryFiler.hpp"
+#include "C_OscNodeDataPoolContentUtil.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::scl;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint32_t C_OscNodeDataPoolBinaryFiler::hu32_MAGIC = 0x4244534FUL; // "OSDB"
+const uint32_t C_OscNodeDataPoolBinaryFiler::hu32_FORMAT_VERSION = 1UL;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Append buffer header
+
+   \param[in]      oe_Payload    Content type of the buffer
+   \param[in,out]  orc_Buffer    Buffer to append to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeDataPoolBinaryFiler::h_SaveHeader(const E_Payload oe_Payload, std::vector<uint8_t> & orc_Buffer)
+{
+   h_AppendU32(hu32_MAGIC, orc_Buffer);
+   h_AppendU32(hu32_FORMAT_VERSION, orc_Buffer);
+   h_AppendU8(static_cast<uint8_t>(oe_Payload), orc_Buffer);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Read and check buffer header
+
+   \param[in]      oe_Payload       Expected content type of the buffer
+   \param[in]      orc_Buffer       Buffer
+   \param[in,out]  oru32_Position   Read position
+
+   \return
+   C_NO_ERR   header valid
+   C_CONFIG   no valid header, unknown format version or other content type
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscNodeDataPoolBinaryFiler::h_LoadHeader(const E_Payload oe_Payload, const std::vector<uint8_t> & orc_Buffer,
+                                                   uint32_t & oru32_Position)
+{
+   uint32_t u32_Magic = 0UL;
+   uint32_t u32_Version = 0UL;
+   uint8_t u8_Payload = 0U;
+   int32_t s32_Retval = h_ReadU32(orc_Buffer, oru32_Position, u32_Magic);
+
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = h_ReadU32(orc_Buffer, oru32_Position, u32_Version);
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = h_ReadU8(orc_Buffer, oru32_Position, u8_Payload);
+   }
+   if ((s32_Retval == C_NO_ERR) &&
+       (((u32_Magic != hu32_MAGIC) || (u32_Version != hu32_FORMAT_VERSION)) ||
+        (u8_Payload != static_cast<uint8_t>(oe_Payload))))
+   {
+      s32_Retval = C_CONFIG;
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Save node data pool
+
+   \param[in]      orc_NodeDataPool    Data pool
+   \param[in,out]  orc_Buffer          Buffer to append to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeDataPoolBinaryFiler::h_SaveDataPool(const C_OscNodeDataPool & orc_NodeDataPool,
+                                                  std::vector<uint8_t> & orc_Buffer)
+{
+   h_AppendU8(static_cast<uint8_t>(orc_NodeDataPool.e_Type), orc_Buffer);
+   h_AppendU32(static_cast<uint32_t>(orc_NodeDataPool.s32_RelatedDataBlockIndex), orc_Buffer);
+   h_AppendBool(orc_NodeDataPool.q_IsSafety, orc_Buffer);
+   h_AppendBool(orc_NodeDataPool.q_ScopeIsPrivate, orc_Buffer);
+   h_AppendU32(orc_NodeDataPool.u16_DefinitionCrcVersion, orc_Buffer);
+   if (mh_IsNvm(orc_NodeDataPool.e_Type) == true)
+   {
+      h_AppendU32(orc_NodeDataPool.u32_NvmStartAddress, orc_Buffer);
+      h_AppendU32(orc_NodeDataPool.u32_NvmSize, orc_Buffer);
+   }
+   h_AppendString(orc_NodeDataPool.c_Name, orc_Buffer);
+   h_AppendU8(orc_NodeDataPool.au8_Version[0], orc_Buffer);
+   h_AppendU8(orc_NodeDataPool.au8_Version[1], orc_Buffer);
+   h_AppendU8(orc_NodeDataPool.au8_Version[2], orc_Buffer);
+   h_AppendString(orc_NodeDataPool.c_Comment, orc_Buffer);
+   mh_SaveDataPoolListsOnly(orc_NodeDataPool.c_Lists, orc_NodeDataPool.e_Type, orc_Buffer);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Load node data pool
+
+   \param[out]     orc_NodeDataPool    Data pool
+   \param[in]      orc_Buffer          Buffer
+   \param[in,out]  oru32_Position      Read position
+
+   \return
+   C_NO_ERR   data read
+   C_CONFIG   content is invalid or incomplete
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscNodeDataPoolBinaryFiler::h_LoadDataPool(C_OscNodeDataPool & orc_NodeDataPool,
+                                                     const std::vector<uint8_t> & orc_Buffer,
+                                                     uint32_t & oru32_Position)
+{
+   uint32_t u32_Value = 0UL;
+   int32_t s32_Retval = mh_LoadDataPoolType(orc_NodeDataPool.e_Type, orc_Buffer, oru32_Position);
+
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = h_ReadU32(orc_Buffer, oru32_Position, u32_Value);
+      orc_NodeDataPool.s32_RelatedDataBlockIndex = static_cast<int32_t>(u32_Value);
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = h_ReadBool(orc_Buffer, oru32_Position, orc_NodeDataPool.q_IsSafety);
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = h_ReadBool(orc_Buffer, oru32_Position, orc_NodeDataPool.q_ScopeIsPrivate);
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = h_ReadU32(orc_Buffer, oru32_Position, u32_Value);
+      orc_NodeDataPool.u16_DefinitionCrcVersion = static_cast<uint16_t>(u32_Value);
+   }
+   orc_NodeDataPool.u32_NvmStartAddress = 0UL;
+   orc_NodeDataPool.u32_NvmSize = 0UL;
+   if ((s32_Retval == C_NO_ERR) && (mh_IsNvm(orc_NodeDataPool.e_Type) == true))
+   {
+      s32_Retval = h_ReadU32(orc_Buffer, oru32_Position, orc_NodeDataPool.u32_NvmStartAddress);
+      if (s32_Retval == C_NO_ERR)
+      {
+         s32_Retval = h_ReadU32(orc_Buffer, oru32_Position, orc_NodeDataPool.u32_NvmSize);
+      }
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = h_ReadString(orc_Buffer, oru32_Position, orc_NodeDataPool.c_Name);
+   }
+   for (uint32_t u32_ItVersion = 0UL; (u32_ItVersion < 3UL) && (s32_Retval == C_NO_ERR); ++u32_ItVersion)
+   {
+      s32_Retval = h_ReadU8(orc_Buffer, oru32_Position, orc_NodeDataPool.au8_Version[u32_ItVersion]);
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = h_ReadString(orc_Buffer, oru32_Position, orc_NodeDataPool.c_Comment);
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = mh_LoadDataPoolListsOnly(orc_NodeDataPool.c_Lists, orc_NodeDataPool.e_Type, orc_Buffer,
+                                            oru32_Position);
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Save node data pool lists
+
+   \param[in]      orc_NodeDataPoolLists  Lists
+   \param[in]      oe_DatapoolType        Type of the data pool containing the lists
+   \param[in,out]  orc_Buffer             Buffer to append to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeDataPoolBinaryFiler::h_SaveDataPoolLists(const std::vector<C_OscNodeDataPoolList> & orc_NodeDataPoolLists,
+                                                       const C_OscNodeDataPool::E_Type oe_DatapoolType,
+                                                       std::vector<uint8_t> & orc_Buffer)
+{
+   h_AppendU8(static_cast<uint8_t>(oe_DatapoolType), orc_Buffer);
+   mh_SaveDataPoolListsOnly(orc_NodeDataPoolLists, oe_DatapoolType, orc_Buffer);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Load node data pool lists
+
+   \param[out]     orc_NodeDataPoolLists  Lists
+   \param[out]     ore_DatapoolType       Type of the data pool the lists were saved from
+   \param[in]      orc_Buffer             Buffer
+   \param[in,out]  oru32_Position         Read position
+
+   \return
+   C_NO_ERR   data read
+   C_CONFIG   content is invalid or incomplete
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscNodeDataPoolBinaryFiler::h_LoadDataPoolLists(std::vector<C_OscNodeDataPoolList> & orc_NodeDataPoolLists,
+                                                          C_OscNodeDataPool::E_Type & ore_DatapoolType,
+                                                          const std::vector<uint8_t> & orc_Buffer,
+                                                          uint32_t & oru32_Position)
+{
+   int32_t s32_Retval = mh_LoadDataPoolType(ore_DatapoolType, orc_Buffer, oru32_Position);
+
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = mh_LoadDataPoolListsOnly(orc_NodeDataPoolLists, ore_DatapoolType, orc_Buffer, oru32_Position);
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Save node data pool list elements
+
+   \param[in]      orc_NodeDataPoolListElements    Elements
+   \param[in]      oe_DatapoolType                 Type of the data pool containing the elements
+   \param[in,out]  orc_Buffer                      Buffer to append to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeDataPoolBinaryFiler::h_SaveDataPoolListElements(
+   const std::vector<C_OscNodeDataPoolListElement> & orc_NodeDataPoolListElements,
+   const C_OscNodeDataPool::E_Type oe_DatapoolType, std::vector<uint8_t> & orc_Buffer)
+{
+   h_AppendU8(static_cast<uint8_t>(oe_DatapoolType), orc_Buffer);
+   mh_SaveDataPoolElementsOnly(orc_NodeDataPoolListElements, oe_DatapoolType, orc_Buffer);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Load node data pool list elements
+
+   \param[out]     orc_NodeDataPoolListElements    Elements
+   \param[out]     ore_DatapoolType                Type of the data pool the elements were saved from
+   \param[in]      orc_Buffer                      Buffer
+   \param[in,out]  oru32_Position                  Read position
+
+   \return
+   C_NO_ERR   data read
+   C_CONFIG   content is invalid or incomplete
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscNodeDataPoolBinaryFiler::h_LoadDataPoolListElements(
+   std::vector<C_OscNodeDataPoolListElement> & orc_NodeDataPoolListElements,
+   C_OscNodeDataPool::E_Type & ore_DatapoolType, const std::vector<uint8_t> & orc_Buffer, uint32_t & oru32_Position)
+{
+   int32_t s32_Retval = mh_LoadDataPoolType(ore_DatapoolType, orc_Buffer, oru32_Position);
+
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = mh_LoadDataPoolElementsOnly(orc_NodeDataPoolListElements, ore_DatapoolType, orc_Buffer,
+                                               oru32_Position);
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Save node data pool list data sets and their values
+
+   \param[in]      orc_DataSets        Data sets
+   \param[in]      orc_DataSetValues   Values per data set
+   \param[in,out]  orc_Buffer          Buffer to append to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeDataPoolBinaryFiler::h_SaveDataPoolListDataSets(
+   const std::vector<C_OscNodeDataPoolDataSet> & orc_DataSets,
+   const std::vector<std::vector<C_OscNodeDataPoolContent> > & orc_DataSetValues, std::vector<uint8_t> & orc_Buffer)
+{
+   mh_SaveDataSets(orc_DataSets, orc_Buffer);
+   h_AppendU32(static_cast<uint32_t>(orc_DataSetValues.size()), orc_Buffer);
+   for (uint32_t u32_ItDataSet = 0UL; u32_ItDataSet < orc_DataSetValues.size(); ++u32_ItDataSet)
+   {
+      const std::vector<C_OscNodeDataPoolContent> & rc_Values = orc_DataSetValues[u32_ItDataSet];
+      h_AppendU32(static_cast<uint32_t>(rc_Values.size()), orc_Buffer);
+      for (uint32_t u32_ItValue = 0UL; u32_ItValue < rc_Values.size(); ++u32_ItValue)
+      {
+         h_SaveDataPoolContent(rc_Values[u32_ItValue], orc_Buffer);
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Load node data pool list data sets and their values
+
+   \param[out]     orc_DataSets        Data sets
+   \param[out]     orc_DataSetValues   Values per data set
+   \param[in]      orc_Buffer          Buffer
+   \param[in,out]  oru32_Position      Read position
+
+   \return
+   C_NO_ERR   data read
+   C_CONFIG   content is invalid or incomplete
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscNodeDataPoolBinaryFiler::h_LoadDataPoolListDataSets(
+   std::vector<C_OscNodeDataPoolDataSet> & orc_DataSets,
+   std::vector<std::vector<C_OscNodeDataPoolContent> > & orc_DataSetValues, const std::vector<uint8_t> & orc_Buffer,
+   uint32_t & oru32_Position)
+{
+   uint32_t u32_DataSetCount = 0UL;
+   int32_t s32_Retval = mh_LoadDataSets(orc_DataSets, orc_Buffer, oru32_Position);
+
+   orc_DataSetValues.clear();
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = h_ReadCount(orc_Buffer, oru32_Position, u32_DataSetCount);
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      orc_DataSetValues.resize(u32_DataSetCount);
+   }
+   for (uint32_t u32_ItDataSet = 0UL; (u32_ItDataSet < u32_DataSetCount) && (s32_Retval == C_NO_ERR);
+        ++u32_ItDataSet)
+   {
+      std::vector<C_OscNodeDataPoolContent> & rc_Values = orc_DataSetValues[u32_ItDataSet];
+      uint32_t u32_ValueCount = 0UL;
+      s32_Retval = h_ReadCount(orc_Buffer, oru32_Position, u32_ValueCount);
+      if (s32_Retval == C_NO_ERR)
+      {
+         rc_Values.resize(u32_ValueCount);
+      }
+      for (uint32_t u32_ItValue = 0UL; (u32_ItValue < u32_ValueCount) && (s32_Retval == C_NO_ERR); ++u32_ItValue)
+      {
+         s32_Retval = h_LoadDataPoolContent(rc_Values[u32_ItValue], orc_Buffer, oru32_Position);
+      }
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Save content with type and value(s)
+
+   \param[in]      orc_Content   Content
+   \param[in,out]  orc_Buffer    Buffer to append to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeDataPoolBinaryFiler::h_SaveDataPoolContent(const C_OscNodeDataPoolContent & orc_Content,
+                                                         std::vector<uint8_t> & orc_Buffer)
+{
+   std::vector<uint8_t> c_Value;
+
+   h_AppendU8(static_cast<uint8_t>(orc_Content.GetType()), orc_Buffer);
+   h_AppendBool(orc_Content.GetArray(), orc_Buffer);
+   h_AppendU32(orc_Content.GetArraySize(), orc_Buffer);
+   orc_Content.GetValueAsLittleEndianBlob(c_Value);
+   h_AppendU32(static_cast<uint32_t>(c_Value.size()), orc_Buffer);
+   orc_Buffer.insert(orc_Buffer.end(), c_Value.begin(), c_Value.end());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Load content with type and value(s)
+
+   \param[out]     orc_Content      Content
+   \param[in]      orc_Buffer       Buffer
+   \param[in,out]  oru32_Position   Read position
+
+   \return
+   C_NO_ERR   data read
+   C_CONFIG   content is invalid or incomplete
+              (value size does not match array size and type, non array content with array size other than 1)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscNodeDataPoolBinaryFiler::h_LoadDataPoolContent(C_OscNodeDataPoolContent & orc_Content,
+                                                            const std::vector<uint8_t> & orc_Buffer,
+                                                            uint32_t & oru32_Position)
+{
+   uint8_t u8_Type = 0U;
+   bool q_Array = false;
+   uint32_t u32_ArraySize = 0UL;
+   uint32_t u32_ValueSize = 0UL;
+   int32_t s32_Retval = h_ReadU8(orc_Buffer, oru32_Position, u8_Type);
+
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = h_ReadBool(orc_Buffer, oru32_Position, q_Array);
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = h_ReadU32(orc_Buffer, oru32_Position, u32_ArraySize);
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = h_ReadCount(orc_Buffer, oru32_Position, u32_ValueSize);
+   }
+   if ((s32_Retval == C_NO_ERR) && (u8_Type > static_cast<uint8_t>(C_OscNodeDataPoolContent::eFLOAT64)))
+   {
+      s32_Retval = C_CONFIG;
+   }
+   //Check the value size before any array size is applied; 64 bit so a huge array size cannot overflow
+   if (s32_Retval == C_NO_ERR)
+   {
+      const uint32_t u32_TypeSize = C_OscNodeDataPoolContentUtil::h_GetDataTypeSizeInByte(
+         static_cast<C_OscNodeDataPoolContent::E_Type>(u8_Type));
+      const uint64_t u64_ExpectedSize = static_cast<uint64_t>(u32_ArraySize) * static_cast<uint64_t>(u32_TypeSize);
+      if ((u64_ExpectedSize != static_cast<uint64_t>(u32_ValueSize)) ||
+          ((q_Array == false) && (u32_ArraySize != 1UL)))
+      {
+         s32_Retval = C_CONFIG;
+      }
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      const std::vector<uint8_t> c_Value(orc_Buffer.begin() + oru32_Position,
+                                         orc_Buffer.begin() + oru32_Position + u32_ValueSize);
+      oru32_Position += u32_ValueSize;
+      orc_Content.SetType(static_cast<C_OscNodeDataPoolContent::E_Type>(u8_Type));
+      orc_Content.SetArray(q_Array);
+      if (q_Array == true)
+      {
+         orc_Content.SetArraySize(u32_ArraySize);
+      }
+      s32_Retval = orc_Content.SetValueFromLittleEndianBlob(c_Value);
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Append unsigned 8 bit value
+
+   \param[in]      ou8_Value     Value
+   \param[in,out]  orc_Buffer    Buffer to append to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeDataPoolBinaryFiler::h_AppendU8(const uint8_t ou8_Value, std::vector<uint8_t> & orc_Buffer)
+{
+   orc_Buffer.push_back(ou8_Value);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Append flag as one byte
+
+   \param[in]      oq_Value      Value
+   \param[in,out]  orc_Buffer    Buffer to append to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeDataPoolBinaryFiler::h_AppendBool(const bool oq_Value, std::vector<uint8_t> & orc_Buffer)
+{
+   orc_Buffer.push_back((oq_Value == true) ? 1U : 0U);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Append unsigned 32 bit value (little endian)
+
+   \param[in]      ou32_Value    Value
+   \param[in,out]  orc_Buffer    Buffer to append to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeDataPoolBinaryFiler::h_AppendU32(const uint32_t ou32_Value, std::vector<uint8_t> & orc_Buffer)
+{
+   orc_Buffer.push_back(static_cast<uint8_t>(ou32_Value));
+   orc_Buffer.push_back(static_cast<uint8_t>(ou32_Value >> 8U));
+   orc_Buffer.push_back(static_cast<uint8_t>(ou32_Value >> 16U));
+   orc_Buffer.push_back(static_cast<uint8_t>(ou32_Value >> 24U));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Append 64 bit floating point value (little endian IEEE 754)
+
+   \param[in]      of64_Value    Value
+   \param[in,out]  orc_Buffer    Buffer to append to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeDataPoolBinaryFiler::h_AppendF64(const float64_t of64_Value, std::vector<uint8_t> & orc_Buffer)
+{
+   uint64_t u64_Value;
+
+   (void)std::memcpy(&u64_Value, &of64_Value, sizeof(u64_Value));
+   h_AppendU32(static_cast<uint32_t>(u64_Value), orc_Buffer);
+   h_AppendU32(static_cast<uint32_t>(u64_Value >> 32U), orc_Buffer);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Append string with length prefix
+
+   \param[in]      orc_Value     Value
+   \param[in,out]  orc_Buffer    Buffer to append to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeDataPoolBinaryFiler::h_AppendString(const C_SclString & orc_Value, std::vector<uint8_t> & orc_Buffer)
+{
+   const uint32_t u32_Length = orc_Value.Length();
+   const uint8_t * const pu8_Data = reinterpret_cast<const uint8_t *>(orc_Value.c_str());
+
+   h_AppendU32(u32_Length, orc_Buffer);
+   orc_Buffer.insert(orc_Buffer.end(), pu8_Data, pu8_Data + u32_Length);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Read unsigned 8 bit value
+
+   \param[in]      orc_Buffer       Buffer
+   \param[in,out]  oru32_Position   Read position
+   \param[out]     oru8_Value       Value
+
+   \return
+   C_NO_ERR   data read
+   C_CONFIG   end of buffer reached
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscNodeDataPoolBinaryFiler::h_ReadU8(const std::vector<uint8_t> & orc_Buffer, uint32_t & oru32_Position,
+                                               uint8_t & oru8_Value)
+{
+   int32_t s32_Retval = C_NO_ERR;
+
+   if (oru32_Position < orc_Buffer.size())
+   {
+      oru8_Value = orc_Buffer[oru32_Position];
+      ++oru32_Position;
+   }
+   else
+   {
+      s32_Retval = C_CONFIG;
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Read flag
+
+   \param[in]      orc_Buffer       Buffer
+   \param[in,out]  oru32_Position   Read position
+   \param[out]     orq_Value        Value
+
+   \return
+   C_NO_ERR   data read
+   C_CONFIG   end of buffer reached
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscNodeDataPoolBinaryFiler::h_ReadBool(const std::vector<uint8_t> & orc_Buffer, uint32_t & oru32_Position,
+                                                 bool & orq_Value)
+{
+   uint8_t u8_Value = 0U;
+   const int32_t s32_Retval = h_ReadU8(orc_Buffer, oru32_Position, u8_Value);
+
+   orq_Value = (u8_Value != 0U);
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Read unsigned 32 bit value (little endian)
+
+   \param[in]      orc_Buffer       Buffer
+   \param[in,out]  oru32_Position   Read position
+   \param[out]     oru32_Value      Value
+
+   \return
+   C_NO_ERR   data read
+   C_CONFIG   end of buffer reached
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscNodeDataPoolBinaryFiler::h_ReadU32(const std::vector<uint8_t> & orc_Buffer, uint32_t & oru32_Position,
+                                                uint32_t & oru32_Value)
+{
+   int32_t s32_Retval = C_NO_ERR;
+
+   if ((orc_Buffer.size() >= 4UL) && (oru32_Position <= (orc_Buffer.size() - 4UL)))
+   {
+      const uint8_t * const pu8_Data = &orc_Buffer[oru32_Position];
+      oru32_Value = static_cast<uint32_t>(pu8_Data[0]) |
+                    (static_cast<uint32_t>(pu8_Data[1]) << 8U) |
+                    (static_cast<uint32_t>(pu8_Data[2]) << 16U) |
+                    (static_cast<uint32_t>(pu8_Data[3]) << 24U);
+      oru32_Position += 4UL;
+   }
+   else
+   {
+      s32_Retval = C_CONFIG;
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Read 64 bit floating point value (little endian IEEE 754)
+
+   \param[in]      orc_Buffer       Buffer
+   \param[in,out]  oru32_Position   Read position
+   \param[out]     orf64_Value      Value
+
+   \return
+   C_NO_ERR   data read
+   C_CONFIG   end of buffer reached
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscNodeDataPoolBinaryFiler::h_ReadF64(const std::vector<uint8_t> & orc_Buffer, uint32_t & oru32_Position,
+                                                float64_t & orf64_Value)
+{
+   uint32_t u32_Low = 0UL;
+   uint32_t u32_High = 0UL;
+   int32_t s32_Retval = h_ReadU32(orc_Buffer, oru32_Position, u32_Low);
+
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = h_ReadU32(orc_Buffer, oru32_Position, u32_High);
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      const uint64_t u64_Value = static_cast<uint64_t>(u32_Low) | (static_cast<uint64_t>(u32_High) << 32U);
+      (void)std::memcpy(&orf64_Value, &u64_Value, sizeof(orf64_Value));
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Read string with length prefix
+
+   \param[in]      orc_Buffer       Buffer
+   \param[in,out]  oru32_Position   Read position
+   \param[out]     orc_Value        Value
+
+   \return
+   C_NO_ERR   data read
+   C_CONFIG   end of buffer reached
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscNodeDataPoolBinaryFiler::h_ReadString(const std::vector<uint8_t> & orc_Buffer, uint32_t & oru32_Position,
+                                                   C_SclString & orc_Value)
+{
+   uint32_t u32_Length = 0UL;
+   const int32_t s32_Retval = h_ReadCount(orc_Buffer, oru32_Position, u32_Length);
+
+   if (s32_Retval == C_NO_ERR)
+   {
+      orc_Value = C_SclString(std::string(orc_Buffer.begin() + oru32_Position,
+                                          orc_Buffer.begin() + oru32_Position + u32_Length).c_str());
+      oru32_Position += u32_Length;
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Read number of following entries or bytes
+
+   Each entry needs at least one byte so a count bigger than the remaining buffer is rejected before anything
+   is allocated for it.
+
+   \param[in]      orc_Buffer       Buffer
+   \param[in,out]  oru32_Position   Read position
+   \param[out]     oru32_Count      Count
+
+   \return
+   C_NO_ERR   data read
+   C_CONFIG   end of buffer reached or count exceeds remaining buffer
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscNodeDataPoolBinaryFiler::h_ReadCount(const std::vector<uint8_t> & orc_Buffer, uint32_t & oru32_Position,
+                                                  uint32_t & oru32_Count)
+{
+   int32_t s32_Retval = h_ReadU32(orc_Buffer, oru32_Position, oru32_Count);
+
+   if ((s32_Retval == C_NO_ERR) && (oru32_Count > (orc_Buffer.size() - oru32_Position)))
+   {
+      s32_Retval = C_CONFIG;
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscNodeDataPoolBinaryFiler::C_OscNodeDataPoolBinaryFiler(void)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Save one list
+
+   \param[in]      orc_NodeDataPoolList   List
+   \param[in]      oe_DatapoolType        Type of the data pool containing the list
+   \param[in,out]  orc_Buffer             Buffer to append to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeDataPoolBinaryFiler::mh_SaveDataPoolList(const C_OscNodeDataPoolList & orc_NodeDataPoolList,
+                                                       const C_OscNodeDataPool::E_Type oe_DatapoolType,
+                                                       std::vector<uint8_t> & orc_Buffer)
+{
+   if (mh_IsNvm(oe_DatapoolType) == true)
+   {
+      h_AppendBool(orc_NodeDataPoolList.q_NvmCrcActive, orc_Buffer);
+      h_AppendU32(orc_NodeDataPoolList.u32_NvmCrc, orc_Buffer);
+      h_AppendU32(orc_NodeDataPoolList.u32_NvmStartAddress, orc_Buffer);
+      h_AppendU32(orc_NodeDataPoolList.u32_NvmSize, orc_Buffer);
+   }
+   h_AppendString(orc_NodeDataPoolList.c_Name, orc_Buffer);
+   h_AppendString(orc_NodeDataPoolList.c_Comment, orc_Buffer);
+   mh_SaveDataPoolElementsOnly(orc_NodeDataPoolList.c_Elements, oe_DatapoolType, orc_Buffer);
+   mh_SaveDataSets(orc_NodeDataPoolList.c_DataSets, orc_Buffer);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Load one list
+
+   \param[out]     orc_NodeDataPoolList   List
+   \param[in]      oe_DatapoolType        Type of the data pool containing the list
+   \param[in]      orc_Buffer             Buffer
+   \param[in,out]  oru32_Position         Read position
+
+   \return
+   C_NO_ERR   data read
+   C_CONFIG   content is invalid or incomplete
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscNodeDataPoolBinaryFiler::mh_LoadDataPoolList(C_OscNodeDataPoolList & orc_NodeDataPoolList,
+                                                          const C_OscNodeDataPool::E_Type oe_DatapoolType,
+                                                          const std::vector<uint8_t> & orc_Buffer,
+                                                          uint32_t & oru32_Position)
+{
+   int32_t s32_Retval = C_NO_ERR;
+
+   orc_NodeDataPoolList.q_NvmCrcActive = false;
+   orc_NodeDataPoolList.u32_NvmCrc = 0UL;
+   orc_NodeDataPoolList.u32_NvmStartAddress = 0UL;
+   orc_NodeDataPoolList.u32_NvmSize = 0UL;
+   if (mh_IsNvm(oe_DatapoolType) == true)
+   {
+      s32_Retval = h_ReadBool(orc_Buffer, oru32_Position, orc_NodeDataPoolList.q_NvmCrcActive);
+      if (s32_Retval == C_NO_ERR)
+      {
+         s32_Retval = h_ReadU32(orc_Buffer, oru32_Position, orc_NodeDataPoolList.u32_NvmCrc);
+      }
+      if (s32_Retval == C_NO_ERR)
+      {
+         s32_Retval = h_ReadU32(orc_Buffer, oru32_Position, orc_NodeDataPoolList.u32_NvmStartAddress);
+      }
+      if (s32_Retval == C_NO_ERR)
+      {
+         s32_Retval = h_ReadU32(orc_Buffer, oru32_Position, orc_NodeDataPoolList.u32_NvmSize);
+      }
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = h_ReadString(orc_Buffer, oru32_Position, orc_NodeDataPoolList.c_Name);
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = h_ReadString(orc_Buffer, oru32_Position, orc_NodeDataPoolList.c_Comment);
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = mh_LoadDataPoolElementsOnly(orc_NodeDataPoolList.c_Elements, oe_DatapoolType, orc_Buffer,
+                                               oru32_Position);
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = mh_LoadDataSets(orc_NodeDataPoolList.c_DataSets, orc_Buffer, oru32_Position);
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Save lists without data pool type
+
+   \param[in]      orc_NodeDataPoolLists  Lists
+   \param[in]      oe_DatapoolType        Type of the data pool containing the lists
+   \param[in,out]  orc_Buffer             Buffer to append to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeDataPoolBinaryFiler::mh_SaveDataPoolListsOnly(
+   const std::vector<C_OscNodeDataPoolList> & orc_NodeDataPoolLists, const C_OscNodeDataPool::E_Type oe_DatapoolType,
+   std::vector<uint8_t> & orc_Buffer)
+{
+   h_AppendU32(static_cast<uint32_t>(orc_NodeDataPoolLists.size()), orc_Buffer);
+   for (uint32_t u32_ItList = 0UL; u32_ItList < orc_NodeDataPoolLists.size(); ++u32_ItList)
+   {
+      mh_SaveDataPoolList(orc_NodeDataPoolLists[u32_ItList], oe_DatapoolType, orc_Buffer);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Load lists without data pool type
+
+   \param[out]     orc_NodeDataPoolLists  Lists
+   \param[in]      oe_DatapoolType        Type of the data pool containing the lists
+   \param[in]      orc_Buffer             Buffer
+   \param[in,out]  oru32_Position         Read position
+
+   \return
+   C_NO_ERR   data read
+   C_CONFIG   content is invalid or incomplete
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscNodeDataPoolBinaryFiler::mh_LoadDataPoolListsOnly(
+   std::vector<C_OscNodeDataPoolList> & orc_NodeDataPoolLists, const C_OscNodeDataPool::E_Type oe_DatapoolType,
+   const std::vector<uint8_t> & orc_Buffer, uint32_t & oru32_Position)
+{
+   uint32_t u32_Count = 0UL;
+   int32_t s32_Retval = h_ReadCount(orc_Buffer, oru32_Position, u32_Count);
+
+   orc_NodeDataPoolLists.clear();
+   if (s32_Retval == C_NO_ERR)
+   {
+      orc_NodeDataPoolLists.resize(u32_Count);
+   }
+   for (uint32_t u32_ItList = 0UL; (u32_ItList < u32_Count) && (s32_Retval == C_NO_ERR); ++u32_ItList)
+   {
+      s32_Retval = mh_LoadDataPoolList(orc_NodeDataPoolLists[u32_ItList], oe_DatapoolType, orc_Buffer,
+                                       oru32_Position);
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Save one element
+
+   \param[in]      orc_NodeDataPoolListElement  Element
+   \param[in]      oe_DatapoolType              Type of the data pool containing the element
+   \param[in,out]  orc_Buffer                   Buffer to append to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeDataPoolBinaryFiler::mh_SaveDataPoolElement(
+   const C_OscNodeDataPoolListElement & orc_NodeDataPoolListElement, const C_OscNodeDataPool::E_Type oe_DatapoolType,
+   std::vector<uint8_t> & orc_Buffer)
+{
+   h_AppendF64(orc_NodeDataPoolListElement.f64_Factor, orc_Buffer);
+   h_AppendF64(orc_NodeDataPoolListElement.f64_Offset, orc_Buffer);
+   if (oe_DatapoolType == C_OscNodeDataPool::eDIAG)
+   {
+      h_AppendBool(orc_NodeDataPoolListElement.q_DiagEventCall, orc_Buffer);
+   }
+   else if (mh_IsNvm(oe_DatapoolType) == true)
+   {
+      h_AppendU32(orc_NodeDataPoolListElement.u32_NvmStartAddress, orc_Buffer);
+   }
+   else
+   {
+      //No type specific content
+   }
+   h_AppendString(orc_NodeDataPoolListElement.c_Name, orc_Buffer);
+   h_AppendString(orc_NodeDataPoolListElement.c_Comment, orc_Buffer);
+   h_AppendString(orc_NodeDataPoolListElement.c_Unit, orc_Buffer);
+   h_AppendU8(static_cast<uint8_t>(orc_NodeDataPoolListElement.e_Access), orc_Buffer);
+   h_SaveDataPoolContent(orc_NodeDataPoolListElement.c_MinValue, orc_Buffer);
+   h_SaveDataPoolContent(orc_NodeDataPoolListElement.c_MaxValue, orc_Buffer);
+   h_AppendU32(static_cast<uint32_t>(orc_NodeDataPoolListElement.c_DataSetValues.size()), orc_Buffer);
+   for (uint32_t u32_ItValue = 0UL; u32_ItValue < orc_NodeDataPoolListElement.c_DataSetValues.size(); ++u32_ItValue)
+   {
+      h_SaveDataPoolContent(orc_NodeDataPoolListElement.c_DataSetValues[u32_ItValue], orc_Buffer);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Load one element
+
+   As with the XML filer the current and NVM value are initialized with the minimum.
+
+   \param[out]     orc_NodeDataPoolListElement  Element
+   \param[in]      oe_DatapoolType              Type of the data pool containing the element
+   \param[in]      orc_Buffer                   Buffer
+   \param[in,out]  oru32_Position               Read position
+
+   \return
+   C_NO_ERR   data read
+   C_CONFIG   content is invalid or incomplete
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscNodeDataPoolBinaryFiler::mh_LoadDataPoolElement(C_OscNodeDataPoolListElement & orc_NodeDataPoolListElement,
+                                                             const C_OscNodeDataPool::E_Type oe_DatapoolType,
+                                                             const std::vector<uint8_t> & orc_Buffer,
+                                                             uint32_t & oru32_Position)
+{
+   uint8_t u8_Access = 0U;
+   uint32_t u32_Count = 0UL;
+   int32_t s32_Retval = h_ReadF64(orc_Buffer, oru32_Position, orc_NodeDataPoolListElement.f64_Factor);
+
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = h_ReadF64(orc_Buffer, oru32_Position, orc_NodeDataPoolListElement.f64_Offset);
+   }
+   orc_NodeDataPoolListElement.q_DiagEventCall = false;
+   orc_NodeDataPoolListElement.u32_NvmStartAddress = 0UL;
+   if ((s32_Retval == C_NO_ERR) && (oe_DatapoolType == C_OscNodeDataPool::eDIAG))
+   {
+      s32_Retval = h_ReadBool(orc_Buffer, oru32_Position, orc_NodeDataPoolListElement.q_DiagEventCall);
+   }
+   if ((s32_Retval == C_NO_ERR) && (mh_IsNvm(oe_DatapoolType) == true))
+   {
+      s32_Retval = h_ReadU32(orc_Buffer, oru32_Position, orc_NodeDataPoolListElement.u32_NvmStartAddress);
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = h_ReadString(orc_Buffer, oru32_Position, orc_NodeDataPoolListElement.c_Name);
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = h_ReadString(orc_Buffer, oru32_Position, orc_NodeDataPoolListElement.c_Comment);
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = h_ReadString(orc_Buffer, oru32_Position, orc_NodeDataPoolListElement.c_Unit);
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = h_ReadU8(orc_Buffer, oru32_Position, u8_Access);
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      if (u8_Access <= static_cast<uint8_t>(C_OscNodeDataPoolListElement::eACCESS_RO))
+      {
+         orc_NodeDataPoolListElement.e_Access = static_cast<C_OscNodeDataPoolListElement::E_Access>(u8_Access);
+      }
+      else
+      {
+         s32_Retval = C_CONFIG;
+      }
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = h_LoadDataPoolContent(orc_NodeDataPoolListElement.c_MinValue, orc_Buffer, oru32_Position);
+      orc_NodeDataPoolListElement.c_NvmValue = orc_NodeDataPoolListElement.c_MinValue;
+      orc_NodeDataPoolListElement.c_Value = orc_NodeDataPoolListElement.c_MinValue;
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = h_LoadDataPoolContent(orc_NodeDataPoolListElement.c_MaxValue, orc_Buffer, oru32_Position);
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = h_ReadCount(orc_Buffer, oru32_Position, u32_Count);
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      orc_NodeDataPoolListElement.c_DataSetValues.resize(u32_Count);
+   }
+   for (uint32_t u32_ItValue = 0UL; (u32_ItValue < u32_Count) && (s32_Retval == C_NO_ERR); ++u32_ItValue)
+   {
+      s32_Retval = h_LoadDataPoolContent(orc_NodeDataPoolListElement.c_DataSetValues[u32_ItValue], orc_Buffer,
+                                         oru32_Position);
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Save elements without data pool type
+
+   \param[in]      orc_NodeDataPoolListElements    Elements
+   \param[in]      oe_DatapoolType                 Type of the data pool containing the elements
+   \param[in,out]  orc_Buffer                      Buffer to append to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeDataPoolBinaryFiler::mh_SaveDataPoolElementsOnly(
+   const std::vector<C_OscNodeDataPoolListElement> & orc_NodeDataPoolListElements,
+   const C_OscNodeDataPool::E_Type oe_DatapoolType, std::vector<uint8_t> & orc_Buffer)
+{
+   h_AppendU32(static_cast<uint32_t>(orc_NodeDataPoolListElements.size()), orc_Buffer);
+   for (uint32_t u32_ItElement = 0UL; u32_ItElement < orc_NodeDataPoolListElements.size(); ++u32_ItElement)
+   {
+      mh_SaveDataPoolElement(orc_NodeDataPoolListElements[u32_ItElement], oe_DatapoolType, orc_Buffer);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Load elements without data pool type
+
+   \param[out]     orc_NodeDataPoolListElements    Elements
+   \param[in]      oe_DatapoolType                 Type of the data pool containing the elements
+   \param[in]      orc_Buffer                      Buffer
+   \param[in,out]  oru32_Position                  Read position
+
+   \return
+   C_NO_ERR   data read
+   C_CONFIG   content is invalid or incomplete
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscNodeDataPoolBinaryFiler::mh_LoadDataPoolElementsOnly(
+   std::vector<C_OscNodeDataPoolListElement> & orc_NodeDataPoolListElements,
+   const C_OscNodeDataPool::E_Type oe_DatapoolType, const std::vector<uint8_t> & orc_Buffer,
+   uint32_t & oru32_Position)
+{
+   uint32_t u32_Count = 0UL;
+   int32_t s32_Retval = h_ReadCount(orc_Buffer, oru32_Position, u32_Count);
+
+   orc_NodeDataPoolListElements.clear();
+   if (s32_Retval == C_NO_ERR)
+   {
+      orc_NodeDataPoolListElements.resize(u32_Count);
+   }
+   for (uint32_t u32_ItElement = 0UL; (u32_ItElement < u32_Count) && (s32_Retval == C_NO_ERR); ++u32_ItElement)
+   {
+      s32_Retval = mh_LoadDataPoolElement(orc_NodeDataPoolListElements[u32_ItElement], oe_DatapoolType, orc_Buffer,
+                                          oru32_Position);
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Save data set names and comments
+
+   \param[in]      orc_DataSets  Data sets
+   \param[in,out]  orc_Buffer    Buffer to append to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeDataPoolBinaryFiler::mh_SaveDataSets(const std::vector<C_OscNodeDataPoolDataSet> & orc_DataSets,
+                                                   std::vector<uint8_t> & orc_Buffer)
+{
+   h_AppendU32(static_cast<uint32_t>(orc_DataSets.size()), orc_Buffer);
+   for (uint32_t u32_ItDataSet = 0UL; u32_ItDataSet < orc_DataSets.size(); ++u32_ItDataSet)
+   {
+      h_AppendString(orc_DataSets[u32_ItDataSet].c_Name, orc_Buffer);
+      h_AppendString(orc_DataSets[u32_ItDataSet].c_Comment, orc_Buffer);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Load data set names and comments
+
+   \param[out]     orc_DataSets     Data sets
+   \param[in]      orc_Buffer       Buffer
+   \param[in,out]  oru32_Position   Read position
+
+   \return
+   C_NO_ERR   data read
+   C_CONFIG   content is invalid or incomplete
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscNodeDataPoolBinaryFiler::mh_LoadDataSets(std::vector<C_OscNodeDataPoolDataSet> & orc_DataSets,
+                                                      const std::vector<uint8_t> & orc_Buffer,
+                                                      uint32_t & oru32_Position)
+{
+   uint32_t u32_Count = 0UL;
+   int32_t s32_Retval = h_ReadCount(orc_Buffer, oru32_Position, u32_Count);
+
+   orc_DataSets.clear();
+   if (s32_Retval == C_NO_ERR)
+   {
+      orc_DataSets.resize(u32_Count);
+   }
+   for (uint32_t u32_ItDataSet = 0UL; (u32_ItDataSet < u32_Count) && (s32_Retval == C_NO_ERR); ++u32_ItDataSet)
+   {
+      s32_Retval = h_ReadString(orc_Buffer, oru32_Position, orc_DataSets[u32_ItDataSet].c_Name);
+      if (s32_Retval == C_NO_ERR)
+      {
+         s32_Retval = h_ReadString(orc_Buffer, oru32_Position, orc_DataSets[u32_ItDataSet].c_Comment);
+      }
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Load and check data pool type
+
+   \param[out]     ore_DatapoolType    Data pool type
+   \param[in]      orc_Buffer          Buffer
+   \param[in,out]  oru32_Position      Read position
+
+   \return
+   C_NO_ERR   data read
+   C_CONFIG   end of buffer reached or unknown type
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscNodeDataPoolBinaryFiler::mh_LoadDataPoolType(C_OscNodeDataPool::E_Type & ore_DatapoolType,
+                                                          const std::vector<uint8_t> & orc_Buffer,
+                                                          uint32_t & oru32_Position)
+{
+   uint8_t u8_Type = 0U;
+   int32_t s32_Retval = h_ReadU8(orc_Buffer, oru32_Position, u8_Type);
+
+   if (s32_Retval == C_NO_ERR)
+   {
+      if (u8_Type <= static_cast<uint8_t>(C_OscNodeDataPool::eHALC_NVM))
+      {
+         ore_DatapoolType = static_cast<C_OscNodeDataPool::E_Type>(u8_Type);
+      }
+      else
+      {
+         s32_Retval = C_CONFIG;
+      }
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Check if data pool type stores NVM addresses
+
+   \param[in]  oe_DatapoolType   Data pool type
+
+   \return
+   true  NVM or HALC NVM data pool
+   false Other type
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscNodeDataPoolBinaryFiler::mh_IsNvm(const C_OscNodeDataPool::E_Type oe_DatapoolType)
+{
+   return (oe_DatapoolType == C_OscNodeDataPool::eNVM) || (oe_DatapoolType == C_OscNodeDataPool::eHALC_NVM);
+}
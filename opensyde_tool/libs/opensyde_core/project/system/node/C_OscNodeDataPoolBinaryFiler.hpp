@@ -0,0 +1,129 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Compact binary reader/writer for node data pool content (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCNODEDATAPOOLBINARYFILER_HPP
+#define C_OSCNODEDATAPOOLBINARYFILER_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
+
+#include "stwtypes.hpp"
+#include "C_SclString.hpp"
+#include "C_OscNodeDataPool.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_OscNodeDataPoolBinaryFiler
+{
+public:
+   enum E_Payload ///< Content type of one binary buffer
+   {
+      eDATA_POOL,     ///< One Datapool
+      eLISTS,         ///< Datapool lists
+      eLIST_ELEMENTS, ///< Datapool list elements
+      eDATA_SETS      ///< Datapool list data sets with values
+   };
+
+   static void h_SaveHeader(const E_Payload oe_Payload, std::vector<uint8_t> & orc_Buffer);
+   static int32_t h_LoadHeader(const E_Payload oe_Payload, const std::vector<uint8_t> & orc_Buffer,
+                               uint32_t & oru32_Position);
+
+   static void h_SaveDataPool(const C_OscNodeDataPool & orc_NodeDataPool, std::vector<uint8_t> & orc_Buffer);
+   static int32_t h_LoadDataPool(C_OscNodeDataPool & orc_NodeDataPool, const std::vector<uint8_t> & orc_Buffer,
+                                 uint32_t & oru32_Position);
+   static void h_SaveDataPoolLists(const std::vector<C_OscNodeDataPoolList> & orc_NodeDataPoolLists,
+                                   const C_OscNodeDataPool::E_Type oe_DatapoolType,
+                                   std::vector<uint8_t> & orc_Buffer);
+   static int32_t h_LoadDataPoolLists(std::vector<C_OscNodeDataPoolList> & orc_NodeDataPoolLists,
+                                      C_OscNodeDataPool::E_Type & ore_DatapoolType,
+                                      const std::vector<uint8_t> & orc_Buffer, uint32_t & oru32_Position);
+   static void h_SaveDataPoolListElements(
+      const std::vector<C_OscNodeDataPoolListElement> & orc_NodeDataPoolListElements,
+      const C_OscNodeDataPool::E_Type oe_DatapoolType, std::vector<uint8_t> & orc_Buffer);
+   static int32_t h_LoadDataPoolListElements(std::vector<C_OscNodeDataPoolListElement> & orc_NodeDataPoolListElements,
+                                             C_OscNodeDataPool::E_Type & ore_DatapoolType,
+                                             const std::vector<uint8_t> & orc_Buffer, uint32_t & oru32_Position);
+   static void h_SaveDataPoolListDataSets(const std::vector<C_OscNodeDataPoolDataSet> & orc_DataSets,
+                                          const std::vector<std::vector<C_OscNodeDataPoolContent> > & orc_DataSetValues,
+                                          std::vector<uint8_t> & orc_Buffer);
+   static int32_t h_LoadDataPoolListDataSets(std::vector<C_OscNodeDataPoolDataSet> & orc_DataSets,
+                                             std::vector<std::vector<C_OscNodeDataPoolContent> > & orc_DataSetValues,
+                                             const std::vector<uint8_t> & orc_Buffer, uint32_t & oru32_Position);
+   static void h_SaveDataPoolContent(const C_OscNodeDataPoolContent & orc_Content, std::vector<uint8_t> & orc_Buffer);
+   static int32_t h_LoadDataPoolContent(C_OscNodeDataPoolContent & orc_Content, const std::vector<uint8_t> & orc_Buffer,
+                                        uint32_t & oru32_Position);
+
+   static void h_AppendU8(const uint8_t ou8_Value, std::vector<uint8_t> & orc_Buffer);
+   static void h_AppendBool(const bool oq_Value, std::vector<uint8_t> & orc_Buffer);
+   static void h_AppendU32(const uint32_t ou32_Value, std::vector<uint8_t> & orc_Buffer);
+   static void h_AppendF64(const float64_t of64_Value, std::vector<uint8_t> & orc_Buffer);
+   static void h_AppendString(const stw::scl::C_SclString & orc_Value, std::vector<uint8_t> & orc_Buffer);
+   static int32_t h_ReadU8(const std::vector<uint8_t> & orc_Buffer, uint32_t & oru32_Position, uint8_t & oru8_Value);
+   static int32_t h_ReadBool(const std::vector<uint8_t> & orc_Buffer, uint32_t & oru32_Position, bool & orq_Value);
+   static int32_t h_ReadU32(const std::vector<uint8_t> & orc_Buffer, uint32_t & oru32_Position,
+                            uint32_t & oru32_Value);
+   static int32_t h_ReadF64(const std::vector<uint8_t> & orc_Buffer, uint32_t & oru32_Position,
+                            float64_t & orf64_Value);
+   static int32_t h_ReadString(const std::vector<uint8_t> & orc_Buffer, uint32_t & oru32_Position,
+                               stw::scl::C_SclString & orc_Value);
+   static int32_t h_ReadCount(const std::vector<uint8_t> & orc_Buffer, uint32_t & oru32_Position,
+                              uint32_t & oru32_Count);
+
+   static const uint32_t hu32_MAGIC;          ///< Identifies buffers of this filer
+   static const uint32_t hu32_FORMAT_VERSION; ///< Increment on each incompatible layout change
+
+private:
+   C_OscNodeDataPoolBinaryFiler(void);
+
+   static void mh_SaveDataPoolList(const C_OscNodeDataPoolList & orc_NodeDataPoolList,
+                                   const C_OscNodeDataPool::E_Type oe_DatapoolType,
+                                   std::vector<uint8_t> & orc_Buffer);
+   static int32_t mh_LoadDataPoolList(C_OscNodeDataPoolList & orc_NodeDataPoolList,
+                                      const C_OscNodeDataPool::E_Type oe_DatapoolType,
+                                      const std::vector<uint8_t> & orc_Buffer, uint32_t & oru32_Position);
+   static void mh_SaveDataPoolListsOnly(const std::vector<C_OscNodeDataPoolList> & orc_NodeDataPoolLists,
+                                        const C_OscNodeDataPool::E_Type oe_DatapoolType,
+                                        std::vector<uint8_t> & orc_Buffer);
+   static int32_t mh_LoadDataPoolListsOnly(std::vector<C_OscNodeDataPoolList> & orc_NodeDataPoolLists,
+                                           const C_OscNodeDataPool::E_Type oe_DatapoolType,
+                                           const std::vector<uint8_t> & orc_Buffer, uint32_t & oru32_Position);
+   static void mh_SaveDataPoolElement(const C_OscNodeDataPoolListElement & orc_NodeDataPoolListElement,
+                                      const C_OscNodeDataPool::E_Type oe_DatapoolType,
+                                      std::vector<uint8_t> & orc_Buffer);
+   static int32_t mh_LoadDataPoolElement(C_OscNodeDataPoolListElement & orc_NodeDataPoolListElement,
+                                         const C_OscNodeDataPool::E_Type oe_DatapoolType,
+                                         const std::vector<uint8_t> & orc_Buffer, uint32_t & oru32_Position);
+   static void mh_SaveDataPoolElementsOnly(
+      const std::vector<C_OscNodeDataPoolListElement> & orc_NodeDataPoolListElements,
+      const C_OscNodeDataPool::E_Type oe_DatapoolType, std::vector<uint8_t> & orc_Buffer);
+   static int32_t mh_LoadDataPoolElementsOnly(std::vector<C_OscNodeDataPoolListElement> & orc_NodeDataPoolListElements,
+                                              const C_OscNodeDataPool::E_Type oe_DatapoolType,
+                                              const std::vector<uint8_t> & orc_Buffer, uint32_t & oru32_Position);
+   static void mh_SaveDataSets(const std::vector<C_OscNodeDataPoolDataSet> & orc_DataSets,
+                               std::vector<uint8_t> & orc_Buffer);
+   static int32_t mh_LoadDataSets(std::vector<C_OscNodeDataPoolDataSet> & orc_DataSets,
+                                  const std::vector<uint8_t> & orc_Buffer, uint32_t & oru32_Position);
+   static int32_t mh_LoadDataPoolType(C_OscNodeDataPool::E_Type & ore_DatapoolType,
+                                      const std::vector<uint8_t> & orc_Buffer, uint32_t & oru32_Position);
+   static bool mh_IsNvm(const C_OscNodeDataPool::E_Type oe_DatapoolType);
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
@@ -0,0 +1,234 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Byte storage of data pool content with inline space for small values (implementation)
+
+   All scalar types and short arrays of up to hu32_LOCAL_SIZE bytes are stored inside the instance itself.
+   Only bigger arrays allocate memory on the heap.
+   So creating and copying the vast majority of data pool contents (min, max, init and dataset values of
+   plain elements) does not require any heap operation.
+
+   Copying into a buffer of the same size reuses the existing memory.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <cstring>
+
+#include "stwtypes.hpp"
+#include "C_OscNodeDataPoolContentBuffer.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+
+   Creates an empty buffer.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscNodeDataPoolContentBuffer::C_OscNodeDataPoolContentBuffer(void) :
+   mu32_Size(0U)
+{
+   this->mu_Storage.u64_Local = 0U;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Copy constructor
+
+   \param[in]  orc_Source  Reference to source
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscNodeDataPoolContentBuffer::C_OscNodeDataPoolContentBuffer(const C_OscNodeDataPoolContentBuffer & orc_Source) :
+   mu32_Size(orc_Source.mu32_Size)
+{
+   if (orc_Source.m_IsLocal() == true)
+   {
+      this->mu_Storage.u64_Local = orc_Source.mu_Storage.u64_Local;
+   }
+   else
+   {
+      this->mu_Storage.pu8_Heap = new uint8_t[orc_Source.mu32_Size];
+      (void)std::memcpy(this->mu_Storage.pu8_Heap, orc_Source.mu_Storage.pu8_Heap, orc_Source.mu32_Size);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Copy operator
+
+   \param[in]  orc_Source  Reference to source
+
+   \return
+   reference to new instance
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscNodeDataPoolContentBuffer & C_OscNodeDataPoolContentBuffer::operator =(
+   const C_OscNodeDataPoolContentBuffer & orc_Source)
+{
+   if (this != &orc_Source)
+   {
+      if (orc_Source.m_IsLocal() == true)
+      {
+         this->m_Release();
+         this->mu_Storage.u64_Local = orc_Source.mu_Storage.u64_Local;
+      }
+      else
+      {
+         if (this->mu32_Size != orc_Source.mu32_Size)
+         {
+            this->m_Release();
+            this->mu_Storage.pu8_Heap = new uint8_t[orc_Source.mu32_Size];
+         }
+         (void)std::memcpy(this->mu_Storage.pu8_Heap, orc_Source.mu_Storage.pu8_Heap, orc_Source.mu32_Size);
+      }
+      this->mu32_Size = orc_Source.mu32_Size;
+   }
+
+   return (*this);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default destructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscNodeDataPoolContentBuffer::~C_OscNodeDataPoolContentBuffer(void)
+{
+   this->m_Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Change number of used bytes
+
+   Existing bytes are kept up to the new size. Added bytes are set to zero.
+
+   \param[in]  ou32_Size   New size in bytes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeDataPoolContentBuffer::Resize(const uint32_t ou32_Size)
+{
+   if (ou32_Size != this->mu32_Size)
+   {
+      const uint32_t u32_KeptSize = (ou32_Size < this->mu32_Size) ? ou32_Size : this->mu32_Size;
+
+      if (ou32_Size <= hu32_LOCAL_SIZE)
+      {
+         U_Storage u_NewStorage;
+         u_NewStorage.u64_Local = 0U;
+         (void)std::memcpy(&u_NewStorage.au8_Local[0], this->GetData(), u32_KeptSize);
+         this->m_Release();
+         this->mu_Storage = u_NewStorage;
+      }
+      else
+      {
+         uint8_t * const pu8_NewData = new uint8_t[ou32_Size];
+         (void)std::memcpy(pu8_NewData, this->GetData(), u32_KeptSize);
+         (void)std::memset(&pu8_NewData[u32_KeptSize], 0, static_cast<size_t>(ou32_Size - u32_KeptSize));
+         this->m_Release();
+         this->mu_Storage.pu8_Heap = pu8_NewData;
+      }
+      this->mu32_Size = ou32_Size;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get number of used bytes
+
+   \return
+   number of used bytes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscNodeDataPoolContentBuffer::GetSize(void) const
+{
+   return this->mu32_Size;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get access to the stored bytes
+
+   The pointer is valid until the next call of Resize or the copy operator.
+
+   \return
+   pointer to first byte
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint8_t * C_OscNodeDataPoolContentBuffer::GetData(void)
+{
+   uint8_t * pu8_Retval;
+
+   if (this->m_IsLocal() == true)
+   {
+      pu8_Retval = &this->mu_Storage.au8_Local[0];
+   }
+   else
+   {
+      pu8_Retval = this->mu_Storage.pu8_Heap;
+   }
+   return pu8_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get read access to the stored bytes
+
+   The pointer is valid until the next call of Resize or the copy operator.
+
+   \return
+   pointer to first byte
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const uint8_t * C_OscNodeDataPoolContentBuffer::GetData(void) const
+{
+   const uint8_t * pu8_Retval;
+
+   if (this->m_IsLocal() == true)
+   {
+      pu8_Retval = &this->mu_Storage.au8_Local[0];
+   }
+   else
+   {
+      pu8_Retval = this->mu_Storage.pu8_Heap;
+   }
+   return pu8_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Check if the data is stored inside the instance
+
+   \retval   true    local storage is active
+   \retval   false   heap storage is active
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscNodeDataPoolContentBuffer::m_IsLocal(void) const
+{
+   return (this->mu32_Size <= hu32_LOCAL_SIZE);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Free heap storage (if any)
+
+   Leaves the instance with cleared local storage. The size is not changed; the caller has to set it.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeDataPoolContentBuffer::m_Release(void)
+{
+   if (this->m_IsLocal() == false)
+   {
+      delete[] this->mu_Storage.pu8_Heap;
+   }
+   this->mu_Storage.u64_Local = 0U;
+}
@@ -0,0 +1,61 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Byte storage of data pool content with inline space for small values (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCNODEDATAPOOLCONTENTBUFFER_HPP
+#define C_OSCNODEDATAPOOLCONTENTBUFFER_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "stwtypes.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_OscNodeDataPoolContentBuffer
+{
+public:
+   C_OscNodeDataPoolContentBuffer(void);
+   C_OscNodeDataPoolContentBuffer(const C_OscNodeDataPoolContentBuffer & orc_Source);
+   C_OscNodeDataPoolContentBuffer & operator = (const C_OscNodeDataPoolContentBuffer & orc_Source);
+   ~C_OscNodeDataPoolContentBuffer(void);
+
+   void Resize(const uint32_t ou32_Size);
+   uint32_t GetSize(void) const;
+   uint8_t * GetData(void);
+   const uint8_t * GetData(void) const;
+
+   static const uint32_t hu32_LOCAL_SIZE = 8U; ///< Number of bytes stored without heap allocation
+
+private:
+   //lint -e{9018} //union is intended; only one of the storages is active depending on the size
+   union U_Storage
+   {
+      uint64_t u64_Local;                ///< Only for alignment of the local storage
+      uint8_t au8_Local[hu32_LOCAL_SIZE]; ///< Storage for values up to hu32_LOCAL_SIZE bytes
+      uint8_t * pu8_Heap;                ///< Storage for bigger values
+   };
+
+   U_Storage mu_Storage;
+   uint32_t mu32_Size; ///< Number of used bytes
+
+   bool m_IsLocal(void) const;
+   void m_Release(void);
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
@@ -0,0 +1,365 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Cached results of node Datapool list and message container checks (implementation)
+
+   Stores the result of the expensive per list (non COM Datapools) and per message container (COM Datapools)
+   checks of one node. The results are identified by their indices, so the owning node has to invalidate them
+   whenever the content or the order of its Datapools, protocols or CANopen managers changes.
+   The number of entries is bounded; on overflow all results are dropped and computed again on demand.
+
+   Additionally the names of each scope (Datapools of the node, lists per Datapool, elements per list and messages
+   per interface) are stored for the name conflict checks. They follow the same invalidation.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include "C_OscNodeErrorCheckCache.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscNodeErrorCheckCache::C_OscNodeErrorCheckCache(void)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get cached result of list check
+
+   \param[in]   ou32_DataPoolIndex  Datapool index
+   \param[in]   ou32_ListIndex      List index
+   \param[out]  orq_Error           Cached result (only valid if found)
+
+   \return
+   true     result found
+   false    no result cached
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscNodeErrorCheckCache::GetListResult(const uint32_t ou32_DataPoolIndex, const uint32_t ou32_ListIndex,
+                                             bool & orq_Error) const
+{
+   return this->m_GetResult(mh_GetKey(ou32_DataPoolIndex, false, ou32_ListIndex), orq_Error);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Store result of list check
+
+   \param[in]  ou32_DataPoolIndex   Datapool index
+   \param[in]  ou32_ListIndex       List index
+   \param[in]  oq_Error             Check result
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeErrorCheckCache::SetListResult(const uint32_t ou32_DataPoolIndex, const uint32_t ou32_ListIndex,
+                                             const bool oq_Error)
+{
+   this->m_SetResult(mh_GetKey(ou32_DataPoolIndex, false, ou32_ListIndex), oq_Error);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get cached result of message container check
+
+   \param[in]   ou32_DataPoolIndex     COM Datapool index
+   \param[in]   ou32_ContainerIndex    Message container (interface) index
+   \param[out]  orq_Error              Cached result (only valid if found)
+
+   \return
+   true     result found
+   false    no result cached
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscNodeErrorCheckCache::GetContainerResult(const uint32_t ou32_DataPoolIndex,
+                                                  const uint32_t ou32_ContainerIndex, bool & orq_Error) const
+{
+   return this->m_GetResult(mh_GetKey(ou32_DataPoolIndex, true, ou32_ContainerIndex), orq_Error);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Store result of message container check
+
+   \param[in]  ou32_DataPoolIndex   COM Datapool index
+   \param[in]  ou32_ContainerIndex  Message container (interface) index
+   \param[in]  oq_Error             Check result
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeErrorCheckCache::SetContainerResult(const uint32_t ou32_DataPoolIndex,
+                                                  const uint32_t ou32_ContainerIndex, const bool oq_Error)
+{
+   this->m_SetResult(mh_GetKey(ou32_DataPoolIndex, true, ou32_ContainerIndex), oq_Error);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get cached names of all Datapools
+
+   \return
+   NULL     no names cached
+   Else     names of all Datapools
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_OscSystemNameMultiset * C_OscNodeErrorCheckCache::GetDataPoolNames(void) const
+{
+   return this->m_GetNameSet(mhu32_NODE_SCOPE, mhu32_ALL_ITEMS);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Store names of all Datapools
+
+   \param[in]  orc_Names  Names of all Datapools
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeErrorCheckCache::SetDataPoolNames(const C_OscSystemNameMultiset & orc_Names)
+{
+   this->m_SetNameSet(mhu32_NODE_SCOPE, mhu32_ALL_ITEMS, orc_Names);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get cached names of all lists of one Datapool
+
+   \param[in]  ou32_DataPoolIndex   Datapool index
+
+   \return
+   NULL     no names cached
+   Else     names of all lists
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_OscSystemNameMultiset * C_OscNodeErrorCheckCache::GetListNames(const uint32_t ou32_DataPoolIndex) const
+{
+   return this->m_GetNameSet(ou32_DataPoolIndex, mhu32_ALL_ITEMS);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Store names of all lists of one Datapool
+
+   \param[in]  ou32_DataPoolIndex   Datapool index
+   \param[in]  orc_Names            Names of all lists
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeErrorCheckCache::SetListNames(const uint32_t ou32_DataPoolIndex,
+                                            const C_OscSystemNameMultiset & orc_Names)
+{
+   this->m_SetNameSet(ou32_DataPoolIndex, mhu32_ALL_ITEMS, orc_Names);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get cached names of all elements of one list
+
+   \param[in]  ou32_DataPoolIndex   Datapool index
+   \param[in]  ou32_ListIndex       List index
+
+   \return
+   NULL     no names cached
+   Else     names of all elements
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_OscSystemNameMultiset * C_OscNodeErrorCheckCache::GetElementNames(const uint32_t ou32_DataPoolIndex,
+                                                                          const uint32_t ou32_ListIndex) const
+{
+   return this->m_GetNameSet(ou32_DataPoolIndex, ou32_ListIndex);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Store names of all elements of one list
+
+   \param[in]  ou32_DataPoolIndex   Datapool index
+   \param[in]  ou32_ListIndex       List index
+   \param[in]  orc_Names            Names of all elements
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeErrorCheckCache::SetElementNames(const uint32_t ou32_DataPoolIndex, const uint32_t ou32_ListIndex,
+                                               const C_OscSystemNameMultiset & orc_Names)
+{
+   this->m_SetNameSet(ou32_DataPoolIndex, ou32_ListIndex, orc_Names);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get cached names of all messages of one interface (all protocols)
+
+   \param[in]  ou32_InterfaceIndex  Interface index
+
+   \return
+   NULL     no names cached
+   Else     names of all messages
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_OscSystemNameMultiset * C_OscNodeErrorCheckCache::GetMessageNames(const uint32_t ou32_InterfaceIndex) const
+{
+   return this->m_GetNameSet(mhu32_NODE_SCOPE, ou32_InterfaceIndex);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Store names of all messages of one interface (all protocols)
+
+   \param[in]  ou32_InterfaceIndex  Interface index
+   \param[in]  orc_Names            Names of all messages
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeErrorCheckCache::SetMessageNames(const uint32_t ou32_InterfaceIndex,
+                                               const C_OscSystemNameMultiset & orc_Names)
+{
+   this->m_SetNameSet(mhu32_NODE_SCOPE, ou32_InterfaceIndex, orc_Names);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Drop all results of one Datapool
+
+   The node scope names are dropped too as the Datapool name or its messages might have changed.
+
+   \param[in]  ou32_DataPoolIndex   Datapool index
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeErrorCheckCache::InvalidateDataPool(const uint32_t ou32_DataPoolIndex)
+{
+   const std::map<uint64_t, bool>::iterator c_ItBegin =
+      this->mc_Results.lower_bound(static_cast<uint64_t>(ou32_DataPoolIndex) << 32U);
+   const std::map<uint64_t, bool>::iterator c_ItEnd =
+      this->mc_Results.lower_bound((static_cast<uint64_t>(ou32_DataPoolIndex) + 1U) << 32U);
+
+   this->mc_Results.erase(c_ItBegin, c_ItEnd);
+   this->m_EraseNameSets(ou32_DataPoolIndex);
+   this->m_EraseNameSets(mhu32_NODE_SCOPE);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Drop all results
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeErrorCheckCache::InvalidateAll(void)
+{
+   this->mc_Results.clear();
+   this->mc_NameSets.clear();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get cached result
+
+   \param[in]   ou64_Key   Key
+   \param[out]  orq_Error  Cached result (only valid if found)
+
+   \return
+   true     result found
+   false    no result cached
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscNodeErrorCheckCache::m_GetResult(const uint64_t ou64_Key, bool & orq_Error) const
+{
+   bool q_Retval = false;
+   const std::map<uint64_t, bool>::const_iterator c_It = this->mc_Results.find(ou64_Key);
+
+   if (c_It != this->mc_Results.end())
+   {
+      orq_Error = c_It->second;
+      q_Retval = true;
+   }
+   return q_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Store result
+
+   \param[in]  ou64_Key    Key
+   \param[in]  oq_Error    Check result
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeErrorCheckCache::m_SetResult(const uint64_t ou64_Key, const bool oq_Error)
+{
+   if ((this->mc_Results.size() >= hu32_MAX_ENTRIES) && (this->mc_Results.find(ou64_Key) == this->mc_Results.end()))
+   {
+      this->mc_Results.clear();
+   }
+   this->mc_Results[ou64_Key] = oq_Error;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get key sorted by Datapool index
+
+   \param[in]  ou32_DataPoolIndex   Datapool index
+   \param[in]  oq_IsContainer       Flag if the index is a message container index (else list index)
+   \param[in]  ou32_Index           List or message container index
+
+   \return
+   Key
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_OscNodeErrorCheckCache::mh_GetKey(const uint32_t ou32_DataPoolIndex, const bool oq_IsContainer,
+                                             const uint32_t ou32_Index)
+{
+   const uint64_t u64_ContainerFlag = oq_IsContainer ? 0x80000000ULL : 0ULL;
+
+   return (static_cast<uint64_t>(ou32_DataPoolIndex) << 32U) | u64_ContainerFlag |
+          static_cast<uint64_t>(ou32_Index & 0x7FFFFFFFUL);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get cached names
+
+   \param[in]  ou32_ScopeIndex   Datapool index or node scope
+   \param[in]  ou32_Index        List or interface index or all items of the scope
+
+   \return
+   NULL     no names cached
+   Else     cached names
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_OscSystemNameMultiset * C_OscNodeErrorCheckCache::m_GetNameSet(const uint32_t ou32_ScopeIndex,
+                                                                       const uint32_t ou32_Index) const
+{
+   const C_OscSystemNameMultiset * pc_Retval = NULL;
+   const std::map<uint64_t, C_OscSystemNameMultiset>::const_iterator c_It =
+      this->mc_NameSets.find((static_cast<uint64_t>(ou32_ScopeIndex) << 32U) | static_cast<uint64_t>(ou32_Index));
+
+   if (c_It != this->mc_NameSets.end())
+   {
+      pc_Retval = &c_It->second;
+   }
+   return pc_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Store names
+
+   \param[in]  ou32_ScopeIndex   Datapool index or node scope
+   \param[in]  ou32_Index        List or interface index or all items of the scope
+   \param[in]  orc_Names         Names
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeErrorCheckCache::m_SetNameSet(const uint32_t ou32_ScopeIndex, const uint32_t ou32_Index,
+                                            const C_OscSystemNameMultiset & orc_Names)
+{
+   this->mc_NameSets[(static_cast<uint64_t>(ou32_ScopeIndex) << 32U) | static_cast<uint64_t>(ou32_Index)] =
+      orc_Names;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Drop all names of one scope
+
+   \param[in]  ou32_ScopeIndex   Datapool index or node scope
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeErrorCheckCache::m_EraseNameSets(const uint32_t ou32_ScopeIndex)
+{
+   const uint64_t u64_First = static_cast<uint64_t>(ou32_ScopeIndex) << 32U;
+   const std::map<uint64_t, C_OscSystemNameMultiset>::iterator c_ItBegin = this->mc_NameSets.lower_bound(u64_First);
+   const std::map<uint64_t, C_OscSystemNameMultiset>::iterator c_ItEnd =
+      this->mc_NameSets.upper_bound(u64_First | 0xFFFFFFFFULL);
+
+   this->mc_NameSets.erase(c_ItBegin, c_ItEnd);
+}
@@ -0,0 +1,77 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Cached results of node Datapool list and message container checks (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCNODEERRORCHECKCACHE_HPP
+#define C_OSCNODEERRORCHECKCACHE_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <map>
+
+#include "stwtypes.hpp"
+#include "C_OscSystemNameMultiset.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_OscNodeErrorCheckCache
+{
+public:
+   C_OscNodeErrorCheckCache(void);
+
+   bool GetListResult(const uint32_t ou32_DataPoolIndex, const uint32_t ou32_ListIndex, bool & orq_Error) const;
+   void SetListResult(const uint32_t ou32_DataPoolIndex, const uint32_t ou32_ListIndex, const bool oq_Error);
+   bool GetContainerResult(const uint32_t ou32_DataPoolIndex, const uint32_t ou32_ContainerIndex,
+                           bool & orq_Error) const;
+   void SetContainerResult(const uint32_t ou32_DataPoolIndex, const uint32_t ou32_ContainerIndex,
+                           const bool oq_Error);
+   const C_OscSystemNameMultiset * GetDataPoolNames(void) const;
+   void SetDataPoolNames(const C_OscSystemNameMultiset & orc_Names);
+   const C_OscSystemNameMultiset * GetListNames(const uint32_t ou32_DataPoolIndex) const;
+   void SetListNames(const uint32_t ou32_DataPoolIndex, const C_OscSystemNameMultiset & orc_Names);
+   const C_OscSystemNameMultiset * GetElementNames(const uint32_t ou32_DataPoolIndex,
+                                                   const uint32_t ou32_ListIndex) const;
+   void SetElementNames(const uint32_t ou32_DataPoolIndex, const uint32_t ou32_ListIndex,
+                        const C_OscSystemNameMultiset & orc_Names);
+   const C_OscSystemNameMultiset * GetMessageNames(const uint32_t ou32_InterfaceIndex) const;
+   void SetMessageNames(const uint32_t ou32_InterfaceIndex, const C_OscSystemNameMultiset & orc_Names);
+   void InvalidateDataPool(const uint32_t ou32_DataPoolIndex);
+   void InvalidateAll(void);
+
+   static const uint32_t hu32_MAX_ENTRIES = 8192U;
+
+private:
+   bool m_GetResult(const uint64_t ou64_Key, bool & orq_Error) const;
+   void m_SetResult(const uint64_t ou64_Key, const bool oq_Error);
+   static uint64_t mh_GetKey(const uint32_t ou32_DataPoolIndex, const bool oq_IsContainer,
+                             const uint32_t ou32_Index);
+   const C_OscSystemNameMultiset * m_GetNameSet(const uint32_t ou32_ScopeIndex, const uint32_t ou32_Index) const;
+   void m_SetNameSet(const uint32_t ou32_ScopeIndex, const uint32_t ou32_Index,
+                     const C_OscSystemNameMultiset & orc_Names);
+   void m_EraseNameSets(const uint32_t ou32_ScopeIndex);
+
+   static const uint32_t mhu32_NODE_SCOPE = 0xFFFFFFFFUL;
+   static const uint32_t mhu32_ALL_ITEMS = 0xFFFFFFFFUL;
+
+   std::map<uint64_t, bool> mc_Results; ///< Check result (true: error) per Datapool and list or container
+   // Names per scope; key: Datapool index (or node scope) and list index (or all items of the scope)
+   std::map<uint64_t, C_OscSystemNameMultiset> mc_NameSets;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
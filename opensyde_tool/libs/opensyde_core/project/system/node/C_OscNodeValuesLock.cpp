@@ -0,0 +1,90 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Lock of the communication values of one node (implementation)
+
+   Protects the values a data dealer writes from its communication thread (c_Value, c_NvmValue and the NVM flags
+   of the Datapool elements) against concurrent access of other threads to the same node.
+   Each instance owns its lock: copying a node creates a new lock and does not take over the one of the source.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include "C_OscNodeValuesLock.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscNodeValuesLock::C_OscNodeValuesLock(void)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Copy constructor
+
+   Creates a new lock; the lock of the source is not shared.
+
+   \param[in]  orc_Source  Source (unused)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscNodeValuesLock::C_OscNodeValuesLock(const C_OscNodeValuesLock & orc_Source)
+{
+   (void)orc_Source;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Assignment operator
+
+   Keeps the own lock.
+
+   \param[in]  orc_Source  Source (unused)
+
+   \return
+   reference to new instance
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscNodeValuesLock & C_OscNodeValuesLock::operator =(const C_OscNodeValuesLock & orc_Source)
+{
+   (void)orc_Source;
+   return *this;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Acquire lock
+
+   Not recursive: do not acquire the lock of the same node again before releasing it.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeValuesLock::Acquire(void)
+{
+   this->mc_CriticalSection.Acquire();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Release lock
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeValuesLock::Release(void)
+{
+   this->mc_CriticalSection.Release();
+}
@@ -0,0 +1,46 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Lock of the communication values of one node (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCNODEVALUESLOCK_HPP
+#define C_OSCNODEVALUESLOCK_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "TglTasks.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_OscNodeValuesLock
+{
+public:
+   C_OscNodeValuesLock(void);
+   C_OscNodeValuesLock(const C_OscNodeValuesLock & orc_Source);
+   //lint -esym(1539,stw::opensyde_core::C_OscNodeValuesLock::mc_CriticalSection)
+   //The lock of the copy is intended to remain unchanged.
+   C_OscNodeValuesLock & operator = (const C_OscNodeValuesLock & orc_Source);
+
+   void Acquire(void);
+   void Release(void);
+
+private:
+   stw::tgl::C_TglCriticalSection mc_CriticalSection;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
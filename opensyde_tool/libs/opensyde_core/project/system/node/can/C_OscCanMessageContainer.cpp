@@ -16,6 +16,7 @@
 #include "C_OscCanMessageContainer.hpp"
 #include "C_SclChecksums.hpp"
 #include "C_OscUtils.hpp"
+#include "C_OscSystemNameMultiset.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 
@@ -464,12 +465,25 @@ bool C_OscCanMessageContainer::CheckLocalError(const C_OscNodeDataPoolList & orc
                                                std::vector<uint32_t> * const opc_InvalidRxMessages) const
 {
    bool q_Error = false;
+   //Count all names once instead of comparing each message with all others (same as CheckMessageLocalError)
+   C_OscSystemNameMultiset c_Names;
+
+   for (uint32_t u32_ItMessage = 0; u32_ItMessage < this->c_TxMessages.size(); ++u32_ItMessage)
+   {
+      c_Names.Add(this->c_TxMessages[u32_ItMessage].c_Name);
+   }
+   for (uint32_t u32_ItMessage = 0; u32_ItMessage < this->c_RxMessages.size(); ++u32_ItMessage)
+   {
+      c_Names.Add(this->c_RxMessages[u32_ItMessage].c_Name);
+   }
 
    for (uint32_t u32_ItMessage = 0;
         (u32_ItMessage < this->c_TxMessages.size()) && ((q_Error == false) || (opc_InvalidTxMessages != NULL));
         ++u32_ItMessage)
    {
-      bool q_NameConflict = false;
+      const C_OscCanMessage & rc_Message = this->c_TxMessages[u32_ItMessage];
+      const bool q_NameConflict = (rc_Message.q_CanOpenManagerMessageActive == true) &&
+                                  (c_Names.GetCount(rc_Message.c_Name) > 1UL);
       bool q_NameInvalid = false;
       bool q_DelayInvalid = false;
       bool q_IdConflict = false;
@@ -477,7 +491,7 @@ bool C_OscCanMessageContainer::CheckLocalError(const C_OscNodeDataPoolList & orc
       bool q_SignalInvalid = false;
       bool q_NoSignalsInvalid = false;
       bool q_TxMethodInvalid = false;
-      this->CheckMessageLocalError(&orc_ListTx, u32_ItMessage, true, &q_NameConflict, &q_NameInvalid, &q_DelayInvalid,
+      this->CheckMessageLocalError(&orc_ListTx, u32_ItMessage, true, NULL, &q_NameInvalid, &q_DelayInvalid,
                                    &q_IdConflict, &q_IdInvalid, &q_SignalInvalid, &q_NoSignalsInvalid,
                                    &q_TxMethodInvalid,
                                    ou32_CanMessageValidSignalsDlcOffset,
@@ -498,7 +512,9 @@ bool C_OscCanMessageContainer::CheckLocalError(const C_OscNodeDataPoolList & orc
         (u32_ItMessage < this->c_RxMessages.size()) && ((q_Error == false) || (opc_InvalidRxMessages != NULL));
         ++u32_ItMessage)
    {
-      bool q_NameConflict = false;
+      const C_OscCanMessage & rc_Message = this->c_RxMessages[u32_ItMessage];
+      const bool q_NameConflict = (rc_Message.q_CanOpenManagerMessageActive == true) &&
+                                  (c_Names.GetCount(rc_Message.c_Name) > 1UL);
       bool q_NameInvalid = false;
       bool q_DelayInvalid = false;
       bool q_IdConflict = false;
@@ -506,7 +522,7 @@ bool C_OscCanMessageContainer::CheckLocalError(const C_OscNodeDataPoolList & orc
       bool q_SignalInvalid = false;
       bool q_NoSignalsInvalid = false;
       bool q_TxMethodInvalid = false;
-      this->CheckMessageLocalError(&orc_ListRx, u32_ItMessage, false, &q_NameConflict, &q_NameInvalid, &q_DelayInvalid,
+      this->CheckMessageLocalError(&orc_ListRx, u32_ItMessage, false, NULL, &q_NameInvalid, &q_DelayInvalid,
                                    &q_IdConflict, &q_IdInvalid, &q_SignalInvalid, &q_NoSignalsInvalid,
                                    &q_TxMethodInvalid,
                                    ou32_CanMessageValidSignalsDlcOffset,
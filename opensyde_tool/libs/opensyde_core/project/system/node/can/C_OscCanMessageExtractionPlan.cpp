@@ -0,0 +1,310 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Precompiled signal extraction for all signals of a CAN message (implementation)
+
+   The plan is compiled once per message configuration. Each signal gets a C_OscCanSignalExtraction step with
+   its scaling. Multiplexed signals are sorted into a dispatch table by their multiplex value.
+
+   Decode extracts all active signals of one received message in a single pass into preallocated result arrays.
+   No memory is allocated while decoding.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include "stwtypes.hpp"
+#include "TglUtils.hpp"
+#include "C_OscCanMessageExtractionPlan.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscCanMessageExtractionPlan::C_OscCanMessageExtractionPlan(void) :
+   mq_HasMultiplexer(false),
+   mu32_MultiplexerIndex(0U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Removes all signals
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscCanMessageExtractionPlan::Clear(void)
+{
+   this->mc_Extractions.clear();
+   this->mc_Factors.clear();
+   this->mc_Offsets.clear();
+   this->mc_DefaultSignals.clear();
+   this->mc_MultiplexGroups.clear();
+   this->mq_HasMultiplexer = false;
+   this->mu32_MultiplexerIndex = 0U;
+   this->mc_RawValues.clear();
+   this->mc_ScaledValues.clear();
+   this->mc_States.clear();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Adds a signal to the plan
+
+   The signal index is the order of the calls. Only the first multiplexer signal is used.
+
+   \param[in]  orc_Signal        Signal configuration
+   \param[in]  oe_ContentType    Type of the Datapool element of the signal
+   \param[in]  of64_Factor       Factor for scaled value
+   \param[in]  of64_Offset       Offset for scaled value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscCanMessageExtractionPlan::AddSignal(const C_OscCanSignal & orc_Signal,
+                                              const C_OscNodeDataPoolContent::E_Type oe_ContentType,
+                                              const float64_t of64_Factor, const float64_t of64_Offset)
+{
+   const uint32_t u32_Index = static_cast<uint32_t>(this->mc_Extractions.size());
+   C_OscCanSignalExtraction c_Extraction;
+
+   c_Extraction.Compile(orc_Signal, oe_ContentType);
+   this->mc_Extractions.push_back(c_Extraction);
+   this->mc_Factors.push_back(of64_Factor);
+   this->mc_Offsets.push_back(of64_Offset);
+
+   if (orc_Signal.e_MultiplexerType == C_OscCanSignal::eMUX_MULTIPLEXED_SIGNAL)
+   {
+      this->mc_MultiplexGroups[orc_Signal.u16_MultiplexValue].push_back(u32_Index);
+   }
+   else if ((orc_Signal.e_MultiplexerType == C_OscCanSignal::eMUX_MULTIPLEXER_SIGNAL) &&
+            (this->mq_HasMultiplexer == false))
+   {
+      this->mq_HasMultiplexer = true;
+      this->mu32_MultiplexerIndex = u32_Index;
+   }
+   else
+   {
+      this->mc_DefaultSignals.push_back(u32_Index);
+   }
+
+   this->mc_RawValues.push_back(0U);
+   this->mc_ScaledValues.push_back(0.0);
+   this->mc_States.push_back(eSIGNAL_NOT_PRESENT);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Compiles the plan for all signals of a message
+
+   The signal indices of the plan are the signal indices of the message.
+   Signals without a matching list element are handled as unscaled uint8 values.
+
+   \param[in]  orc_Message    Message configuration
+   \param[in]  orc_List       Datapool list with the elements of the signals
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscCanMessageExtractionPlan::Compile(const C_OscCanMessage & orc_Message, const C_OscNodeDataPoolList & orc_List)
+{
+   this->Clear();
+   this->mc_Extractions.reserve(orc_Message.c_Signals.size());
+   this->mc_Factors.reserve(orc_Message.c_Signals.size());
+   this->mc_Offsets.reserve(orc_Message.c_Signals.size());
+   this->mc_RawValues.reserve(orc_Message.c_Signals.size());
+   this->mc_ScaledValues.reserve(orc_Message.c_Signals.size());
+   this->mc_States.reserve(orc_Message.c_Signals.size());
+
+   for (uint32_t u32_Counter = 0U; u32_Counter < orc_Message.c_Signals.size(); ++u32_Counter)
+   {
+      const C_OscCanSignal & rc_Signal = orc_Message.c_Signals[u32_Counter];
+
+      if (rc_Signal.u32_ComDataElementIndex < orc_List.c_Elements.size())
+      {
+         const C_OscNodeDataPoolListElement & rc_Element = orc_List.c_Elements[rc_Signal.u32_ComDataElementIndex];
+         this->AddSignal(rc_Signal, rc_Element.c_Value.GetType(), rc_Element.f64_Factor, rc_Element.f64_Offset);
+      }
+      else
+      {
+         this->AddSignal(rc_Signal, C_OscNodeDataPoolContent::eUINT8, 1.0, 0.0);
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Decodes all signals of a received message
+
+   Multiplexed signals are only decoded if the multiplexer could be read and has their multiplex value.
+
+   \param[in]  orau8_CanDb    Data bytes of CAN message
+   \param[in]  ou8_Dlc        DLC of CAN message
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscCanMessageExtractionPlan::Decode(const uint8_t (&orau8_CanDb)[8], const uint8_t ou8_Dlc)
+{
+   uint32_t u32_Counter;
+
+   for (u32_Counter = 0U; u32_Counter < this->mc_States.size(); ++u32_Counter)
+   {
+      this->mc_States[u32_Counter] = eSIGNAL_NOT_PRESENT;
+   }
+
+   for (u32_Counter = 0U; u32_Counter < this->mc_DefaultSignals.size(); ++u32_Counter)
+   {
+      this->m_DecodeSignal(this->mc_DefaultSignals[u32_Counter], orau8_CanDb, ou8_Dlc);
+   }
+
+   if (this->mq_HasMultiplexer == true)
+   {
+      this->m_DecodeSignal(this->mu32_MultiplexerIndex, orau8_CanDb, ou8_Dlc);
+
+      if (this->mc_States[this->mu32_MultiplexerIndex] == eSIGNAL_DECODED)
+      {
+         const uint16_t u16_MultiplexValue = static_cast<uint16_t>(this->mc_RawValues[this->mu32_MultiplexerIndex]);
+         const std::map<uint16_t, std::vector<uint32_t> >::const_iterator c_ItGroup =
+            this->mc_MultiplexGroups.find(u16_MultiplexValue);
+
+         if (c_ItGroup != this->mc_MultiplexGroups.end())
+         {
+            for (u32_Counter = 0U; u32_Counter < c_ItGroup->second.size(); ++u32_Counter)
+            {
+               this->m_DecodeSignal(c_ItGroup->second[u32_Counter], orau8_CanDb, ou8_Dlc);
+            }
+         }
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get number of signals
+
+   \return
+   Number of signals
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscCanMessageExtractionPlan::GetSignalCount(void) const
+{
+   return static_cast<uint32_t>(this->mc_Extractions.size());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get state of a signal of the last Decode
+
+   \param[in]  ou32_SignalIndex  Signal index
+
+   \return
+   Signal state
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscCanMessageExtractionPlan::E_SignalState C_OscCanMessageExtractionPlan::GetSignalState(
+   const uint32_t ou32_SignalIndex) const
+{
+   tgl_assert(ou32_SignalIndex < this->mc_States.size());
+   return this->mc_States[ou32_SignalIndex];
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get raw value of a signal of the last Decode
+
+   Only valid if the state is eSIGNAL_DECODED.
+
+   \param[in]  ou32_SignalIndex  Signal index
+
+   \return
+   Raw value with the width of the content type
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_OscCanMessageExtractionPlan::GetRawValue(const uint32_t ou32_SignalIndex) const
+{
+   tgl_assert(ou32_SignalIndex < this->mc_RawValues.size());
+   return this->mc_RawValues[ou32_SignalIndex];
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get scaled value of a signal of the last Decode
+
+   Only valid if the state is eSIGNAL_DECODED.
+
+   \param[in]  ou32_SignalIndex  Signal index
+
+   \return
+   Value with factor and offset applied
+*/
+//----------------------------------------------------------------------------------------------------------------------
+float64_t C_OscCanMessageExtractionPlan::GetScaledValue(const uint32_t ou32_SignalIndex) const
+{
+   tgl_assert(ou32_SignalIndex < this->mc_ScaledValues.size());
+   return this->mc_ScaledValues[ou32_SignalIndex];
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get compiled extraction step of a signal
+
+   \param[in]  ou32_SignalIndex  Signal index
+
+   \return
+   Extraction step
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_OscCanSignalExtraction & C_OscCanMessageExtractionPlan::GetSignalExtraction(const uint32_t ou32_SignalIndex)
+const
+{
+   tgl_assert(ou32_SignalIndex < this->mc_Extractions.size());
+   return this->mc_Extractions[ou32_SignalIndex];
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get index of the multiplexer signal
+
+   \param[out]  oru32_SignalIndex   Signal index of multiplexer
+
+   \return
+   true     Message has a multiplexer signal
+   false    No multiplexer signal
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscCanMessageExtractionPlan::GetMultiplexerSignalIndex(uint32_t & oru32_SignalIndex) const
+{
+   oru32_SignalIndex = this->mu32_MultiplexerIndex;
+   return this->mq_HasMultiplexer;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Decodes one signal into the result arrays
+
+   \param[in]  ou32_SignalIndex  Signal index
+   \param[in]  orau8_CanDb       Data bytes of CAN message
+   \param[in]  ou8_Dlc           DLC of CAN message
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscCanMessageExtractionPlan::m_DecodeSignal(const uint32_t ou32_SignalIndex, const uint8_t (&orau8_CanDb)[8],
+                                                   const uint8_t ou8_Dlc)
+{
+   const C_OscCanSignalExtraction & rc_Extraction = this->mc_Extractions[ou32_SignalIndex];
+
+   if (rc_Extraction.IsInMessage(ou8_Dlc) == true)
+   {
+      const uint64_t u64_Raw = rc_Extraction.ExtractRawValue(orau8_CanDb);
+
+      this->mc_RawValues[ou32_SignalIndex] = u64_Raw;
+      this->mc_ScaledValues[ou32_SignalIndex] =
+         (rc_Extraction.GetValueAsFloat64(u64_Raw) * this->mc_Factors[ou32_SignalIndex]) +
+         this->mc_Offsets[ou32_SignalIndex];
+      this->mc_States[ou32_SignalIndex] = eSIGNAL_DECODED;
+   }
+   else
+   {
+      this->mc_States[ou32_SignalIndex] = eSIGNAL_DLC_ERROR;
+   }
+}
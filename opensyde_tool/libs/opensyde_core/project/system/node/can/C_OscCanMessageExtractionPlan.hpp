@@ -0,0 +1,80 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Precompiled signal extraction for all signals of a CAN message (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCCANMESSAGEEXTRACTIONPLAN_HPP
+#define C_OSCCANMESSAGEEXTRACTIONPLAN_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
+#include <map>
+
+#include "stwtypes.hpp"
+#include "C_OscCanMessage.hpp"
+#include "C_OscNodeDataPoolList.hpp"
+#include "C_OscCanSignalExtraction.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_OscCanMessageExtractionPlan
+{
+public:
+   enum E_SignalState
+   {
+      eSIGNAL_DECODED,    ///< Value of signal was extracted
+      eSIGNAL_DLC_ERROR,  ///< Signal is active but does not fit into the received data bytes
+      eSIGNAL_NOT_PRESENT ///< Multiplexed signal of another multiplex group or multiplexer could not be read
+   };
+
+   C_OscCanMessageExtractionPlan(void);
+
+   void Clear(void);
+   void AddSignal(const C_OscCanSignal & orc_Signal, const C_OscNodeDataPoolContent::E_Type oe_ContentType,
+                  const float64_t of64_Factor, const float64_t of64_Offset);
+   void Compile(const C_OscCanMessage & orc_Message, const C_OscNodeDataPoolList & orc_List);
+
+   void Decode(const uint8_t (&orau8_CanDb)[8], const uint8_t ou8_Dlc);
+
+   uint32_t GetSignalCount(void) const;
+   E_SignalState GetSignalState(const uint32_t ou32_SignalIndex) const;
+   uint64_t GetRawValue(const uint32_t ou32_SignalIndex) const;
+   float64_t GetScaledValue(const uint32_t ou32_SignalIndex) const;
+   const C_OscCanSignalExtraction & GetSignalExtraction(const uint32_t ou32_SignalIndex) const;
+   bool GetMultiplexerSignalIndex(uint32_t & oru32_SignalIndex) const;
+
+private:
+   void m_DecodeSignal(const uint32_t ou32_SignalIndex, const uint8_t (&orau8_CanDb)[8], const uint8_t ou8_Dlc);
+
+   // Compiled plan
+   std::vector<C_OscCanSignalExtraction> mc_Extractions;
+   std::vector<float64_t> mc_Factors;
+   std::vector<float64_t> mc_Offsets;
+   std::vector<uint32_t> mc_DefaultSignals;                       ///< Signals independent of a multiplexer
+   std::map<uint16_t, std::vector<uint32_t> > mc_MultiplexGroups; ///< Dispatch table multiplex value to signals
+   bool mq_HasMultiplexer;
+   uint32_t mu32_MultiplexerIndex;
+
+   // Results of last Decode, preallocated by AddSignal
+   std::vector<uint64_t> mc_RawValues;
+   std::vector<float64_t> mc_ScaledValues;
+   std::vector<E_SignalState> mc_States;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
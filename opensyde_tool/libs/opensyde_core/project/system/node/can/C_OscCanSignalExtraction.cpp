@@ -0,0 +1,313 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Precompiled extraction step for one CAN signal (implementation)
+
+   Compile converts the bit layout of a signal once into a shift and a mask on a 64 bit word of the message
+   data bytes. Intel signals are read from the little endian interpretation of the data bytes, Motorola signals
+   from the big endian interpretation. In the big endian word all bits of a Motorola signal are contiguous.
+   So the extraction of a value is a single shift, mask and optional sign extension, without any temporary buffer.
+
+   The results are identical to C_OscCanUtil::h_GetSignalValue.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <cstring>
+
+#include "stwtypes.hpp"
+#include "C_OscCanSignalExtraction.hpp"
+#include "C_OscNodeDataPoolContentUtil.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+
+   A default constructed extraction does not fit into any message.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscCanSignalExtraction::C_OscCanSignalExtraction(void) :
+   mq_Intel(true),
+   mu8_Shift(0U),
+   mu64_Mask(0U),
+   mu64_SignBit(0U),
+   mu64_SignExtension(0U),
+   mu16_NeededBytes(0xFFFFU),
+   me_ContentType(C_OscNodeDataPoolContent::eUINT8)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Precomputes shift, mask and sign handling for a signal
+
+   \param[in]  orc_Signal        Signal configuration
+   \param[in]  oe_ContentType    Type of the Datapool element of the signal
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscCanSignalExtraction::Compile(const C_OscCanSignal & orc_Signal,
+                                       const C_OscNodeDataPoolContent::E_Type oe_ContentType)
+{
+   const uint32_t u32_TypeBits = C_OscNodeDataPoolContentUtil::h_GetDataTypeSizeInByte(oe_ContentType) * 8U;
+   const uint16_t u16_Length = orc_Signal.u16_ComBitLength;
+
+   this->me_ContentType = oe_ContentType;
+   this->mq_Intel = (orc_Signal.e_ComByteOrder == C_OscCanSignal::eBYTE_ORDER_INTEL);
+   this->mu8_Shift = 0U;
+   this->mu64_Mask = 0U;
+   this->mu64_SignBit = 0U;
+   this->mu64_SignExtension = 0U;
+   this->mu16_NeededBytes = 0xFFFFU;
+
+   if ((u16_Length > 0U) && (u16_Length <= 64U))
+   {
+      const uint16_t u16_LastBit = orc_Signal.GetDataBytesBitPosOfSignalBit(u16_Length - 1U);
+      const uint16_t u16_NeededBytes = (u16_LastBit / 8U) + 1U;
+
+      if ((u16_NeededBytes <= 8U) && (orc_Signal.u16_ComBitStart < 64U))
+      {
+         const uint64_t u64_SignalMask = (u16_Length == 64U) ? 0xFFFFFFFFFFFFFFFFULL :
+                                         ((1ULL << u16_Length) - 1ULL);
+         const uint64_t u64_TypeMask = (u32_TypeBits >= 64U) ? 0xFFFFFFFFFFFFFFFFULL :
+                                       ((1ULL << u32_TypeBits) - 1ULL);
+
+         this->mu16_NeededBytes = u16_NeededBytes;
+         this->mu64_Mask = u64_SignalMask & u64_TypeMask;
+
+         if (this->mq_Intel == true)
+         {
+            this->mu8_Shift = static_cast<uint8_t>(orc_Signal.u16_ComBitStart);
+         }
+         else
+         {
+            // Position of the last signal bit (LSB) in the big endian word
+            this->mu8_Shift = static_cast<uint8_t>(((7U - (u16_LastBit / 8U)) * 8U) + (u16_LastBit % 8U));
+         }
+
+         // Like h_GetSignalValue sign extension is only done for signals with an incomplete last byte
+         if (((oe_ContentType == C_OscNodeDataPoolContent::eSINT8) ||
+              (oe_ContentType == C_OscNodeDataPoolContent::eSINT16) ||
+              (oe_ContentType == C_OscNodeDataPoolContent::eSINT32) ||
+              (oe_ContentType == C_OscNodeDataPoolContent::eSINT64)) &&
+             ((u16_Length % 8U) != 0U) && (u16_Length < u32_TypeBits))
+         {
+            this->mu64_SignBit = 1ULL << (u16_Length - 1U);
+            this->mu64_SignExtension = u64_TypeMask & (~u64_SignalMask);
+         }
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Checks if the signal fits into a CAN message with a specific DLC
+
+   Same result as C_OscCanUtil::h_IsSignalInMessage
+
+   \param[in]  ou8_Dlc  Length of CAN message
+
+   \return
+   true     Signal fits into message
+   false    Signal does not fit into message
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscCanSignalExtraction::IsInMessage(const uint8_t ou8_Dlc) const
+{
+   return (this->mu16_NeededBytes <= ou8_Dlc);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Extracts the raw value of the signal out of the CAN message data bytes
+
+   The result has the width of the content type; signed values are sign extended to this width.
+
+   \param[in]  orau8_CanDb  Data bytes of CAN message
+
+   \return
+   Raw value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_OscCanSignalExtraction::ExtractRawValue(const uint8_t (&orau8_CanDb)[8]) const
+{
+   uint64_t u64_Frame;
+   uint64_t u64_Value;
+
+   if (this->mq_Intel == true)
+   {
+      u64_Frame = (static_cast<uint64_t>(orau8_CanDb[0])) |
+                  (static_cast<uint64_t>(orau8_CanDb[1]) << 8U) |
+                  (static_cast<uint64_t>(orau8_CanDb[2]) << 16U) |
+                  (static_cast<uint64_t>(orau8_CanDb[3]) << 24U) |
+                  (static_cast<uint64_t>(orau8_CanDb[4]) << 32U) |
+                  (static_cast<uint64_t>(orau8_CanDb[5]) << 40U) |
+                  (static_cast<uint64_t>(orau8_CanDb[6]) << 48U) |
+                  (static_cast<uint64_t>(orau8_CanDb[7]) << 56U);
+   }
+   else
+   {
+      u64_Frame = (static_cast<uint64_t>(orau8_CanDb[0]) << 56U) |
+                  (static_cast<uint64_t>(orau8_CanDb[1]) << 48U) |
+                  (static_cast<uint64_t>(orau8_CanDb[2]) << 40U) |
+                  (static_cast<uint64_t>(orau8_CanDb[3]) << 32U) |
+                  (static_cast<uint64_t>(orau8_CanDb[4]) << 24U) |
+                  (static_cast<uint64_t>(orau8_CanDb[5]) << 16U) |
+                  (static_cast<uint64_t>(orau8_CanDb[6]) << 8U) |
+                  (static_cast<uint64_t>(orau8_CanDb[7]));
+   }
+
+   u64_Value = (u64_Frame >> this->mu8_Shift) & this->mu64_Mask;
+
+   if ((u64_Value & this->mu64_SignBit) != 0U)
+   {
+      u64_Value |= this->mu64_SignExtension;
+   }
+
+   return u64_Value;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Sets an extracted raw value to a content
+
+   \param[in]      ou64_RawValue  Raw value of ExtractRawValue
+   \param[in,out]  orc_Value      Content with the type used for Compile
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscCanSignalExtraction::SetContentValue(const uint64_t ou64_RawValue, C_OscNodeDataPoolContent & orc_Value) const
+{
+   switch (this->me_ContentType)
+   {
+   case C_OscNodeDataPoolContent::eUINT8:
+      orc_Value.SetValueU8(static_cast<uint8_t>(ou64_RawValue));
+      break;
+   case C_OscNodeDataPoolContent::eUINT16:
+      orc_Value.SetValueU16(static_cast<uint16_t>(ou64_RawValue));
+      break;
+   case C_OscNodeDataPoolContent::eUINT32:
+      orc_Value.SetValueU32(static_cast<uint32_t>(ou64_RawValue));
+      break;
+   case C_OscNodeDataPoolContent::eUINT64:
+      orc_Value.SetValueU64(ou64_RawValue);
+      break;
+   case C_OscNodeDataPoolContent::eSINT8:
+      orc_Value.SetValueS8(static_cast<int8_t>(static_cast<uint8_t>(ou64_RawValue)));
+      break;
+   case C_OscNodeDataPoolContent::eSINT16:
+      orc_Value.SetValueS16(static_cast<int16_t>(static_cast<uint16_t>(ou64_RawValue)));
+      break;
+   case C_OscNodeDataPoolContent::eSINT32:
+      orc_Value.SetValueS32(static_cast<int32_t>(static_cast<uint32_t>(ou64_RawValue)));
+      break;
+   case C_OscNodeDataPoolContent::eSINT64:
+      orc_Value.SetValueS64(static_cast<int64_t>(ou64_RawValue));
+      break;
+   case C_OscNodeDataPoolContent::eFLOAT32:
+      {
+         const uint32_t u32_Bits = static_cast<uint32_t>(ou64_RawValue);
+         float32_t f32_Value;
+         (void)std::memcpy(&f32_Value, &u32_Bits, sizeof(f32_Value));
+         orc_Value.SetValueF32(f32_Value);
+      }
+      break;
+   case C_OscNodeDataPoolContent::eFLOAT64:
+      {
+         float64_t f64_Value;
+         (void)std::memcpy(&f64_Value, &ou64_RawValue, sizeof(f64_Value));
+         orc_Value.SetValueF64(f64_Value);
+      }
+      break;
+   default:
+      break;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Converts an extracted raw value to an unscaled floating point value
+
+   \param[in]  ou64_RawValue  Raw value of ExtractRawValue
+
+   \return
+   Unscaled value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+float64_t C_OscCanSignalExtraction::GetValueAsFloat64(const uint64_t ou64_RawValue) const
+{
+   float64_t f64_Value;
+
+   switch (this->me_ContentType)
+   {
+   case C_OscNodeDataPoolContent::eSINT8:
+      f64_Value = static_cast<float64_t>(static_cast<int8_t>(static_cast<uint8_t>(ou64_RawValue)));
+      break;
+   case C_OscNodeDataPoolContent::eSINT16:
+      f64_Value = static_cast<float64_t>(static_cast<int16_t>(static_cast<uint16_t>(ou64_RawValue)));
+      break;
+   case C_OscNodeDataPoolContent::eSINT32:
+      f64_Value = static_cast<float64_t>(static_cast<int32_t>(static_cast<uint32_t>(ou64_RawValue)));
+      break;
+   case C_OscNodeDataPoolContent::eSINT64:
+      f64_Value = static_cast<float64_t>(static_cast<int64_t>(ou64_RawValue));
+      break;
+   case C_OscNodeDataPoolContent::eFLOAT32:
+      {
+         const uint32_t u32_Bits = static_cast<uint32_t>(ou64_RawValue);
+         float32_t f32_Value;
+         (void)std::memcpy(&f32_Value, &u32_Bits, sizeof(f32_Value));
+         f64_Value = static_cast<float64_t>(f32_Value);
+      }
+      break;
+   case C_OscNodeDataPoolContent::eFLOAT64:
+      (void)std::memcpy(&f64_Value, &ou64_RawValue, sizeof(f64_Value));
+      break;
+   case C_OscNodeDataPoolContent::eUINT8:
+   case C_OscNodeDataPoolContent::eUINT16:
+   case C_OscNodeDataPoolContent::eUINT32:
+   case C_OscNodeDataPoolContent::eUINT64:
+   default:
+      f64_Value = static_cast<float64_t>(ou64_RawValue);
+      break;
+   }
+
+   return f64_Value;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get content type used for Compile
+
+   \return
+   Content type
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscNodeDataPoolContent::E_Type C_OscCanSignalExtraction::GetContentType(void) const
+{
+   return this->me_ContentType;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Checks if the content type is a floating point type
+
+   \return
+   true     Float32 or float64
+   false    Integer type
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscCanSignalExtraction::IsFloat(void) const
+{
+   return (this->me_ContentType == C_OscNodeDataPoolContent::eFLOAT32) ||
+          (this->me_ContentType == C_OscNodeDataPoolContent::eFLOAT64);
+}
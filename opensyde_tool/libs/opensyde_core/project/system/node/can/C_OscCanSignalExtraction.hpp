@@ -0,0 +1,57 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Precompiled extraction step for one CAN signal (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCCANSIGNALEXTRACTION_HPP
+#define C_OSCCANSIGNALEXTRACTION_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "stwtypes.hpp"
+#include "C_OscCanSignal.hpp"
+#include "C_OscNodeDataPoolContent.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_OscCanSignalExtraction
+{
+public:
+   C_OscCanSignalExtraction(void);
+
+   void Compile(const C_OscCanSignal & orc_Signal, const C_OscNodeDataPoolContent::E_Type oe_ContentType);
+
+   bool IsInMessage(const uint8_t ou8_Dlc) const;
+   uint64_t ExtractRawValue(const uint8_t (&orau8_CanDb)[8]) const;
+   void SetContentValue(const uint64_t ou64_RawValue, C_OscNodeDataPoolContent & orc_Value) const;
+   float64_t GetValueAsFloat64(const uint64_t ou64_RawValue) const;
+
+   C_OscNodeDataPoolContent::E_Type GetContentType(void) const;
+   bool IsFloat(void) const;
+
+private:
+   bool mq_Intel;               ///< Byte order of signal; selects the frame word
+   uint8_t mu8_Shift;           ///< Position of the signal LSB in the frame word
+   uint64_t mu64_Mask;          ///< Mask for the signal bits after shifting
+   uint64_t mu64_SignBit;       ///< Sign bit of signal; 0 if no sign extension is necessary
+   uint64_t mu64_SignExtension; ///< Bits to set for negative values up to the width of the content type
+   uint16_t mu16_NeededBytes;   ///< Minimum DLC for the signal
+   C_OscNodeDataPoolContent::E_Type me_ContentType;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
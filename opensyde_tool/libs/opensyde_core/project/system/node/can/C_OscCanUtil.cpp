@@ -13,6 +13,7 @@
 #include "stwtypes.hpp"
 #include "C_OscCanUtil.hpp"
 #include "C_OscNodeDataPoolContentUtil.hpp"
+#include "C_OscCanSignalExtraction.hpp"
 #include "TglUtils.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
@@ -247,6 +248,9 @@ void C_OscCanUtil::h_GetSignalValue(const uint8_t (&orau8_CanDb)[8], const C_Osc
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Gets value for signal out of CAN message data bytes
 
+   For repeated extraction of the same signal keep a compiled C_OscCanSignalExtraction
+   or C_OscCanMessageExtractionPlan instead.
+
    \param[in]      orau8_CanDb   Data bytes of CAN message
    \param[in]      orc_Signal    Signal configuration used for extraction
    \param[in,out]  orc_Value     Extracted value and source for size of value
@@ -255,13 +259,10 @@ void C_OscCanUtil::h_GetSignalValue(const uint8_t (&orau8_CanDb)[8], const C_Osc
 void C_OscCanUtil::h_GetSignalValue(const uint8_t (&orau8_CanDb)[8], const C_OscCanSignal & orc_Signal,
                                     C_OscNodeDataPoolContent & orc_Value)
 {
-   std::vector<uint8_t> c_Data;
-
-   c_Data.resize(orc_Value.GetSizeByte(), 0U);
-   // The result is in little endian. The function converts in case of Motorola format automatically.
-   h_GetSignalValue(orau8_CanDb, orc_Signal, c_Data, orc_Value.GetType());
+   C_OscCanSignalExtraction c_Extraction;
 
-   orc_Value.SetValueFromLittleEndianBlob(c_Data);
+   c_Extraction.Compile(orc_Signal, orc_Value.GetType());
+   c_Extraction.SetContentValue(c_Extraction.ExtractRawValue(orau8_CanDb), orc_Value);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
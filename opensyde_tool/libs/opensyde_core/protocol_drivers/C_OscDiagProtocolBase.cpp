@@ -13,9 +13,11 @@
 #include "precomp_headers.hpp"
 
 #include <iostream>
+#include "stwerrors.hpp"
 #include "C_OscDiagProtocolBase.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
 using namespace stw::opensyde_core;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
@@ -74,3 +76,106 @@ void C_OscDiagProtocolBase::Initialize(const PR_DataPoolReadEventReceived opr_Da
    mpr_OnDataPoolReadEventReceived = opr_DataPoolReadEventReceived;
    mpv_OnAsyncInstance = opv_Instance;
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get maximum number of NVM bytes transferred with one protocol service
+
+   NvmRead and NvmWrite accept bigger records and split them up internally.
+   Callers can use this size to plan their accesses so no service transfers only a small rest.
+
+   Default implementation: no limit known
+
+   \return
+   maximum number of bytes per service (0: no limit known)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscDiagProtocolBase::GetNvmMaxBlockSize(void) const
+{
+   return 0U;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read a list of elements from server's Datapools
+
+   Default implementation: read the elements one after another with DataPoolReadNumeric / DataPoolReadArray.
+   Protocols supporting several outstanding requests shall overwrite this function.
+
+   \param[in,out]  orc_Accesses   in: elements to read and expected size of data
+                                  out: read data and result per element (see DataPoolReadNumeric)
+
+   \return
+   C_NO_ERR   all elements read
+   C_WARN     at least one element could not be read (see s32_Result of the accesses)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscDiagProtocolBase::DataPoolReadBatch(std::vector<C_OscProtocolDataPoolAccess> & orc_Accesses)
+{
+   int32_t s32_Retval = C_NO_ERR;
+
+   for (uint32_t u32_It = 0U; u32_It < orc_Accesses.size(); ++u32_It)
+   {
+      C_OscProtocolDataPoolAccess & rc_Access = orc_Accesses[u32_It];
+
+      rc_Access.u8_NrCode = 0U;
+      if (rc_Access.q_IsArray == false)
+      {
+         rc_Access.s32_Result = this->DataPoolReadNumeric(rc_Access.u8_DataPoolIndex, rc_Access.u16_ListIndex,
+                                                          rc_Access.u16_ElementIndex, rc_Access.c_Data,
+                                                          &rc_Access.u8_NrCode);
+      }
+      else
+      {
+         rc_Access.s32_Result = this->DataPoolReadArray(rc_Access.u8_DataPoolIndex, rc_Access.u16_ListIndex,
+                                                        rc_Access.u16_ElementIndex, rc_Access.c_Data,
+                                                        &rc_Access.u8_NrCode);
+      }
+      if (rc_Access.s32_Result != C_NO_ERR)
+      {
+         s32_Retval = C_WARN;
+      }
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write a list of elements to server's Datapools
+
+   Default implementation: write the elements one after another with DataPoolWriteNumeric / DataPoolWriteArray.
+   Protocols supporting several outstanding requests shall overwrite this function.
+
+   \param[in,out]  orc_Accesses   in: elements and data to write
+                                  out: result per element (see DataPoolWriteNumeric)
+
+   \return
+   C_NO_ERR   all elements written
+   C_WARN     at least one element could not be written (see s32_Result of the accesses)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscDiagProtocolBase::DataPoolWriteBatch(std::vector<C_OscProtocolDataPoolAccess> & orc_Accesses)
+{
+   int32_t s32_Retval = C_NO_ERR;
+
+   for (uint32_t u32_It = 0U; u32_It < orc_Accesses.size(); ++u32_It)
+   {
+      C_OscProtocolDataPoolAccess & rc_Access = orc_Accesses[u32_It];
+
+      rc_Access.u8_NrCode = 0U;
+      if (rc_Access.q_IsArray == false)
+      {
+         rc_Access.s32_Result = this->DataPoolWriteNumeric(rc_Access.u8_DataPoolIndex, rc_Access.u16_ListIndex,
+                                                           rc_Access.u16_ElementIndex, rc_Access.c_Data,
+                                                           &rc_Access.u8_NrCode);
+      }
+      else
+      {
+         rc_Access.s32_Result = this->DataPoolWriteArray(rc_Access.u8_DataPoolIndex, rc_Access.u16_ListIndex,
+                                                         rc_Access.u16_ElementIndex, rc_Access.c_Data,
+                                                         &rc_Access.u8_NrCode);
+      }
+      if (rc_Access.s32_Result != C_NO_ERR)
+      {
+         s32_Retval = C_WARN;
+      }
+   }
+   return s32_Retval;
+}
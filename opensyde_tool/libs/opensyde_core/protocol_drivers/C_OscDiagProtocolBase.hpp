@@ -19,6 +19,7 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "stwtypes.hpp"
 #include "C_SclString.hpp"
+#include "C_OscProtocolDataPoolAccess.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 namespace stw
@@ -89,6 +90,7 @@ public:
    */
    //-----------------------------------------------------------------------------
    virtual uint8_t GetEndianness(void) const = 0;
+   virtual uint32_t GetNvmMaxBlockSize(void) const;
 
    //-----------------------------------------------------------------------------
    /*!
@@ -225,6 +227,9 @@ public:
                                       const uint16_t ou16_ElementIndex, const std::vector<uint8_t> & orc_DataToWrite,
                                       uint8_t * const opu8_NrCode) = 0;
 
+   virtual int32_t DataPoolReadBatch(std::vector<C_OscProtocolDataPoolAccess> & orc_Accesses);
+   virtual int32_t DataPoolWriteBatch(std::vector<C_OscProtocolDataPoolAccess> & orc_Accesses);
+
    //-----------------------------------------------------------------------------
    /*!
       \brief   Set rate of event driven transmissions
@@ -127,6 +127,22 @@ uint8_t C_OscDiagProtocolOsy::GetEndianness(void) const
    return mhu8_ENDIANNESS_BIG;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get maximum number of NVM bytes transferred with one protocol service
+
+   Here: block size used by OsyWriteMemoryByAddress.
+   OsyReadMemoryByAddress uses bigger blocks so this is a limit for both directions.
+
+   \return
+   maximum number of bytes per service
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscDiagProtocolOsy::GetNvmMaxBlockSize(void) const
+{
+   //same worst case protocol overhead as considered by OsyWriteMemoryByAddress
+   return static_cast<uint32_t>(this->GetMaxServiceSize()) - 10U;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Perform cyclic communication tasks
 
@@ -274,6 +290,74 @@ int32_t C_OscDiagProtocolOsy::DataPoolWriteArray(const uint8_t ou8_DataPoolIndex
                                      opu8_NrCode);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read a list of elements from server's data pools
+
+   Keeps several requests outstanding at the same time (see C_OscProtocolDriverOsy::OsyReadDataPoolDataBatch).
+   In the openSYDE protocol the implementation is the same for array and numeric data.
+
+   \param[in,out]  orc_Accesses   in: elements to read and expected size of data
+                                  out: read data and result per element (see DataPoolReadArray)
+
+   \return
+   C_NO_ERR   all elements read
+   C_WARN     at least one element could not be read (see s32_Result of the accesses)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscDiagProtocolOsy::DataPoolReadBatch(std::vector<C_OscProtocolDataPoolAccess> & orc_Accesses)
+{
+   int32_t s32_Retval = C_NO_ERR;
+   std::vector<uint32_t> c_ExpectedSizes;
+
+   c_ExpectedSizes.reserve(orc_Accesses.size());
+   for (uint32_t u32_It = 0U; u32_It < orc_Accesses.size(); ++u32_It)
+   {
+      c_ExpectedSizes.push_back(static_cast<uint32_t>(orc_Accesses[u32_It].c_Data.size()));
+   }
+
+   (void)this->OsyReadDataPoolDataBatch(orc_Accesses);
+
+   for (uint32_t u32_It = 0U; u32_It < orc_Accesses.size(); ++u32_It)
+   {
+      C_OscProtocolDataPoolAccess & rc_Access = orc_Accesses[u32_It];
+      if (rc_Access.c_Data.size() != c_ExpectedSizes[u32_It])
+      {
+         rc_Access.s32_Result = C_RD_WR;
+      }
+      if (rc_Access.s32_Result != C_NO_ERR)
+      {
+         s32_Retval = C_WARN;
+      }
+   }
+
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write a list of elements to server's data pools
+
+   Keeps several requests outstanding at the same time (see C_OscProtocolDriverOsy::OsyWriteDataPoolDataBatch).
+   In the openSYDE protocol the implementation is the same for array and numeric data.
+
+   \param[in,out]  orc_Accesses   in: elements and data to write
+                                  out: result per element (see DataPoolWriteArray)
+
+   \return
+   C_NO_ERR   all elements written
+   C_WARN     at least one element could not be written (see s32_Result of the accesses)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscDiagProtocolOsy::DataPoolWriteBatch(std::vector<C_OscProtocolDataPoolAccess> & orc_Accesses)
+{
+   int32_t s32_Retval = this->OsyWriteDataPoolDataBatch(orc_Accesses);
+
+   if (s32_Retval != C_NO_ERR)
+   {
+      s32_Retval = C_WARN;
+   }
+   return s32_Retval;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Set rate of event driven transmissions
 
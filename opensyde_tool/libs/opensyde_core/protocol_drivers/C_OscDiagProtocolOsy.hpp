@@ -63,6 +63,7 @@ public:
 
    //implemented functions from C_OscDiagProtocolBase:
    virtual uint8_t GetEndianness(void) const;
+   virtual uint32_t GetNvmMaxBlockSize(void) const;
 
    //this is intended to implement the pure virtual function from C_OscDiagProtocolBase
    virtual int32_t Cycle(void); //lint !e1511
@@ -79,6 +80,8 @@ public:
    virtual int32_t DataPoolWriteArray(const uint8_t ou8_DataPoolIndex, const uint16_t ou16_ListIndex,
                                       const uint16_t ou16_ElementIndex, const std::vector<uint8_t> & orc_DataToWrite,
                                       uint8_t * const opu8_NrCode);
+   virtual int32_t DataPoolReadBatch(std::vector<C_OscProtocolDataPoolAccess> & orc_Accesses);
+   virtual int32_t DataPoolWriteBatch(std::vector<C_OscProtocolDataPoolAccess> & orc_Accesses);
    virtual int32_t DataPoolSetEventDataRate(const uint8_t ou8_Rail, const uint16_t ou16_IntervalMs);
    virtual int32_t DataPoolReadCyclic(const uint8_t ou8_DataPoolIndex, const uint16_t ou16_ListIndex,
                                       const uint16_t ou16_ElementIndex, const uint8_t ou8_Rail,
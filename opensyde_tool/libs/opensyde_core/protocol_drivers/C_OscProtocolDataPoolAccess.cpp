@@ -0,0 +1,67 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Description and result of one Datapool element access of a batch
+
+   Used to pass a list of Datapool element reads or writes to the protocol drivers at once
+   so they can be handled with several requests outstanding at the same time.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include "stwerrors.hpp"
+#include "C_OscProtocolDataPoolAccess.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscProtocolDataPoolAccess::C_OscProtocolDataPoolAccess(void) :
+   u8_DataPoolIndex(0U),
+   u16_ListIndex(0U),
+   u16_ElementIndex(0U),
+   q_IsArray(false),
+   s32_Result(C_NOACT),
+   u8_NrCode(0U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Constructor for access to specific element
+
+   \param[in]  ou8_DataPoolIndex    Datapool index
+   \param[in]  ou16_ListIndex       List index
+   \param[in]  ou16_ElementIndex    Element index
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscProtocolDataPoolAccess::C_OscProtocolDataPoolAccess(const uint8_t ou8_DataPoolIndex,
+                                                         const uint16_t ou16_ListIndex,
+                                                         const uint16_t ou16_ElementIndex) :
+   u8_DataPoolIndex(ou8_DataPoolIndex),
+   u16_ListIndex(ou16_ListIndex),
+   u16_ElementIndex(ou16_ElementIndex),
+   q_IsArray(false),
+   s32_Result(C_NOACT),
+   u8_NrCode(0U)
+{
+}
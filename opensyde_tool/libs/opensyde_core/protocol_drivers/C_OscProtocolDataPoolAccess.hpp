@@ -0,0 +1,48 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Description and result of one Datapool element access of a batch (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCPROTOCOLDATAPOOLACCESS_HPP
+#define C_OSCPROTOCOLDATAPOOLACCESS_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
+
+#include "stwtypes.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_OscProtocolDataPoolAccess
+{
+public:
+   C_OscProtocolDataPoolAccess(void);
+   C_OscProtocolDataPoolAccess(const uint8_t ou8_DataPoolIndex, const uint16_t ou16_ListIndex,
+                               const uint16_t ou16_ElementIndex);
+
+   uint8_t u8_DataPoolIndex;
+   uint16_t u16_ListIndex;
+   uint16_t u16_ElementIndex;
+   bool q_IsArray;              ///< Only relevant for protocols with different services for numeric and array data
+   std::vector<uint8_t> c_Data; ///< Read: in: expected size; out: read data; Write: data to write
+   int32_t s32_Result;          ///< Result of the access; same values as for the single element service
+   uint8_t u8_NrCode;           ///< Negative response code if s32_Result is C_WARN
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
@@ -14,6 +14,7 @@
 
 #include <iostream>
 #include <cstring>
+#include <algorithm>
 #include "stwtypes.hpp"
 #include "stwerrors.hpp"
 #include "C_SclString.hpp"
@@ -72,7 +73,8 @@ C_OscProtocolDriverOsy::C_OscProtocolDriverOsy(void) :
    mpv_OnOsyWaitTimeInstance(NULL),
    mpc_TransportProtocol(NULL),
    mu32_TimeoutPollingMs(hu32_DEFAULT_TIMEOUT),
-   mu16_MaxServiceSize(C_OscProtocolDriverOsyTpBase::hu16_OSY_MAXIMUM_SERVICE_SIZE)
+   mu16_MaxServiceSize(C_OscProtocolDriverOsyTpBase::hu16_OSY_MAXIMUM_SERVICE_SIZE),
+   mu8_MaxPendingDataPoolRequests(hu8_DEFAULT_MAX_PENDING_DATA_POOL_REQUESTS)
 {
 }
 
@@ -127,6 +129,34 @@ void C_OscProtocolDriverOsy::SetMaxServiceSize(const uint16_t ou16_MaxServiceSiz
    mu16_MaxServiceSize = ou16_MaxServiceSize;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get maximum service size used for writing memory
+
+   \return
+   maximum service size (including header)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint16_t C_OscProtocolDriverOsy::GetMaxServiceSize(void) const
+{
+   return mu16_MaxServiceSize;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set maximum number of outstanding Datapool data requests
+
+   Used by OsyReadDataPoolDataBatch and OsyWriteDataPoolDataBatch.
+   The value must not exceed the number of requests the server can queue.
+   With 1 the batch services behave like calling the single element services one after another.
+
+   \param[in]  ou8_MaxPendingRequests   Maximum number of requests sent without having received the response
+                                        (0 is treated as 1)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscProtocolDriverOsy::SetMaxPendingDataPoolRequests(const uint8_t ou8_MaxPendingRequests)
+{
+   mu8_MaxPendingDataPoolRequests = (ou8_MaxPendingRequests == 0U) ? 1U : ou8_MaxPendingRequests;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Initialization of the async handling of tunneled CAN messages
 
@@ -2392,6 +2422,54 @@ int32_t C_OscProtocolDriverOsy::OsyWriteDataPoolData(const uint8_t ou8_DataPoolI
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   ReadDataPoolDataByIdentifier service for a list of elements
+
+   Reads all elements with several requests outstanding at the same time
+   (see SetMaxPendingDataPoolRequests).
+   So the transfer time is not dominated by the round trip time of each single request.
+
+   The result of each access is placed in the access itself.
+   The results are the same as for OsyReadDataPoolData.
+
+   \param[in,out]  orc_Accesses   in: elements to read (client indexes)
+                                  out: read data (size as sent by server) and result per element
+
+   \return
+   C_NO_ERR   all elements read
+   C_WARN     at least one element could not be read (see s32_Result of the accesses)
+   C_CONFIG   no transport protocol installed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscProtocolDriverOsy::OsyReadDataPoolDataBatch(std::vector<C_OscProtocolDataPoolAccess> & orc_Accesses)
+{
+   return this->m_DataPoolDataBatch(false, orc_Accesses);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   WriteDataPoolDataByIdentifier service for a list of elements
+
+   Writes all elements with several requests outstanding at the same time
+   (see SetMaxPendingDataPoolRequests).
+   The elements are sent in the order of the list.
+
+   The result of each access is placed in the access itself.
+   The results are the same as for OsyWriteDataPoolData.
+
+   \param[in,out]  orc_Accesses   in: elements (client indexes) and data to write
+                                  out: result per element
+
+   \return
+   C_NO_ERR   all elements written
+   C_WARN     at least one element could not be written (see s32_Result of the accesses)
+   C_CONFIG   no transport protocol installed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscProtocolDriverOsy::OsyWriteDataPoolDataBatch(std::vector<C_OscProtocolDataPoolAccess> & orc_Accesses)
+{
+   return this->m_DataPoolDataBatch(true, orc_Accesses);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   WriteDataPoolEventDataRate service request implementation
 
@@ -3664,6 +3742,285 @@ int32_t C_OscProtocolDriverOsy::OsyCheckFlashMemoryAvailable(const uint32_t ou32
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read or write a list of Datapool elements with several requests outstanding
+
+   Keeps up to mu8_MaxPendingDataPoolRequests requests on the way.
+   The server handles the requests one after another, so:
+   * positive responses are assigned by the data identifier they contain
+   * negative responses do not contain the data identifier and are assigned to the oldest outstanding request
+   The timeout applies to the wait time for each response (i.e. it is restarted with each response).
+   If a response is not received within the timeout, the assignment of negative responses is not reliable anymore
+   (a late response would be assigned to the wrong request). So the batch is aborted:
+   * the timed out request and all requests not sent yet are reported as C_TIMEOUT
+   * responses to the outstanding requests are received till no response arrives within the timeout;
+     positive responses are still assigned by data identifier, negative responses are discarded
+   * outstanding requests without positive response are reported as C_TIMEOUT
+
+   \param[in]      oq_Write       true: write elements; false: read elements
+   \param[in,out]  orc_Accesses   accesses to handle; results are placed in there
+
+   \return
+   C_NO_ERR   all accesses finished successfully
+   C_WARN     at least one access failed
+   C_CONFIG   no transport protocol installed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscProtocolDriverOsy::m_DataPoolDataBatch(const bool oq_Write,
+                                                    std::vector<C_OscProtocolDataPoolAccess> & orc_Accesses)
+{
+   int32_t s32_Retval = C_NO_ERR;
+
+   if (mpc_TransportProtocol == NULL)
+   {
+      for (uint32_t u32_It = 0U; u32_It < orc_Accesses.size(); ++u32_It)
+      {
+         orc_Accesses[u32_It].s32_Result = C_CONFIG;
+      }
+      s32_Retval = C_CONFIG;
+   }
+   else
+   {
+      const uint8_t u8_ServiceId = (oq_Write == true) ? mhu8_OSY_SI_WRITE_DATA_POOL_DATA_BY_ID :
+                                   mhu8_OSY_SI_READ_DATA_POOL_DATA_BY_ID;
+      std::vector<uint32_t> c_PackedIds(orc_Accesses.size(), 0U);
+      std::vector<uint32_t> c_Pending; //indexes of sent accesses in order of sending
+      uint32_t u32_NextToSend = 0U;
+      uint32_t u32_WaitStartTime = stw::tgl::TglGetTickCount();
+      uint32_t u32_LastWaitTimeHandled = u32_WaitStartTime;
+      int32_t s32_ComError = C_NO_ERR;
+      bool q_Draining = false; //true: batch aborted after timeout, discarding responses to outstanding requests
+
+      c_Pending.reserve(mu8_MaxPendingDataPoolRequests);
+
+      //lock access to "polling" (see m_PollForSpecificServiceResponse)
+      mc_LockReception.Acquire();
+
+      while (((u32_NextToSend < orc_Accesses.size()) || (c_Pending.size() > 0U) || (q_Draining == true)) &&
+             (s32_ComError == C_NO_ERR))
+      {
+         bool q_TxQueueFull = false;
+
+         //keep the configured number of requests on the way
+         while ((u32_NextToSend < orc_Accesses.size()) &&
+                (c_Pending.size() < static_cast<size_t>(mu8_MaxPendingDataPoolRequests)) && (q_TxQueueFull == false))
+         {
+            C_OscProtocolDataPoolAccess & rc_Access = orc_Accesses[u32_NextToSend];
+            uint8_t au8_Identifier[3];
+
+            rc_Access.u8_NrCode = 0U;
+            if ((m_PackDataPoolIdentifier(rc_Access.u8_DataPoolIndex, rc_Access.u16_ListIndex,
+                                          rc_Access.u16_ElementIndex, au8_Identifier) != C_NO_ERR) ||
+                ((oq_Write == true) && (rc_Access.c_Data.size() == 0U)))
+            {
+               rc_Access.s32_Result = C_RANGE;
+               ++u32_NextToSend;
+            }
+            else
+            {
+               C_OscProtocolDriverOsyService c_Request;
+               const size_t x_DataSize = (oq_Write == true) ? rc_Access.c_Data.size() : 0U;
+
+               c_Request.c_Data.resize(4U + x_DataSize);
+               c_Request.c_Data[0] = u8_ServiceId;
+               c_Request.c_Data[1] = au8_Identifier[0];
+               c_Request.c_Data[2] = au8_Identifier[1];
+               c_Request.c_Data[3] = au8_Identifier[2];
+               if (x_DataSize > 0U)
+               {
+                  (void)std::memcpy(&c_Request.c_Data[4], &rc_Access.c_Data[0], x_DataSize);
+               }
+               if (mpc_TransportProtocol->SendRequest(c_Request) == C_NO_ERR)
+               {
+                  if (c_Pending.size() == 0U)
+                  {
+                     u32_WaitStartTime = stw::tgl::TglGetTickCount();
+                  }
+                  c_PackedIds[u32_NextToSend] = (static_cast<uint32_t>(au8_Identifier[0]) << 16U) +
+                                                (static_cast<uint32_t>(au8_Identifier[1]) << 8U) +
+                                                static_cast<uint32_t>(au8_Identifier[2]);
+                  c_Pending.push_back(u32_NextToSend);
+                  ++u32_NextToSend;
+               }
+               else if (c_Pending.size() == 0U)
+               {
+                  rc_Access.s32_Result = C_NOACT;
+                  ++u32_NextToSend;
+               }
+               else
+               {
+                  //try again after the next response
+                  q_TxQueueFull = true;
+               }
+            }
+         }
+
+         if ((c_Pending.size() > 0U) || (q_Draining == true))
+         {
+            C_OscProtocolDriverOsyService c_Response;
+            const int32_t s32_Return = this->m_Cycle(true, u8_ServiceId, &c_Response);
+
+            if (s32_Return == C_NO_ERR)
+            {
+               //while draining each response to the service shows that the server is still answering
+               if ((this->m_HandleDataPoolDataBatchResponse(c_Response, oq_Write, q_Draining, orc_Accesses,
+                                                            c_PackedIds, c_Pending) == true) ||
+                   (q_Draining == true))
+               {
+                  u32_WaitStartTime = stw::tgl::TglGetTickCount();
+                  u32_LastWaitTimeHandled = u32_WaitStartTime;
+               }
+            }
+            else if ((s32_Return == C_COM) || (s32_Return == C_CONFIG))
+            {
+               s32_ComError = s32_Return;
+            }
+            else
+            {
+               const uint32_t u32_CurrentTime = stw::tgl::TglGetTickCount();
+               if (u32_CurrentTime >= (u32_WaitStartTime + mu32_TimeoutPollingMs))
+               {
+                  if (q_Draining == true)
+                  {
+                     //no more responses: the outstanding requests will not be answered anymore
+                     for (uint32_t u32_It = 0U; u32_It < c_Pending.size(); ++u32_It)
+                     {
+                        orc_Accesses[c_Pending[u32_It]].s32_Result = C_TIMEOUT;
+                     }
+                     c_Pending.clear();
+                     q_Draining = false;
+                  }
+                  else
+                  {
+                     //oldest request will not be answered in time; a late negative response would be assigned
+                     // to the wrong request, so abort the batch and discard the outstanding responses
+                     orc_Accesses[c_Pending[0]].s32_Result = C_TIMEOUT;
+                     c_Pending.erase(c_Pending.begin());
+                     for (uint32_t u32_It = u32_NextToSend; u32_It < orc_Accesses.size(); ++u32_It)
+                     {
+                        orc_Accesses[u32_It].s32_Result = C_TIMEOUT;
+                     }
+                     u32_NextToSend = static_cast<uint32_t>(orc_Accesses.size());
+                     q_Draining = true;
+                  }
+                  u32_WaitStartTime = u32_CurrentTime;
+               }
+               else
+               {
+                  // Handle long waiting time by registered function
+                  if ((this->mpr_OnOsyWaitTime != NULL) &&
+                      ((u32_CurrentTime - hu32_DEFAULT_HANDLE_WAIT_TIME) > u32_LastWaitTimeHandled))
+                  {
+                     this->mpr_OnOsyWaitTime(this->mpv_OnOsyWaitTimeInstance);
+                     u32_LastWaitTimeHandled = u32_CurrentTime;
+                  }
+                  stw::tgl::TglSleep(0U); //rescind CPU time to other threads ...
+               }
+            }
+         }
+      }
+      mc_LockReception.Release();
+
+      if (s32_ComError != C_NO_ERR)
+      {
+         for (uint32_t u32_It = 0U; u32_It < c_Pending.size(); ++u32_It)
+         {
+            orc_Accesses[c_Pending[u32_It]].s32_Result = s32_ComError;
+         }
+         for (uint32_t u32_It = u32_NextToSend; u32_It < orc_Accesses.size(); ++u32_It)
+         {
+            orc_Accesses[u32_It].s32_Result = s32_ComError;
+         }
+      }
+
+      for (uint32_t u32_It = 0U; u32_It < orc_Accesses.size(); ++u32_It)
+      {
+         const C_OscProtocolDataPoolAccess & rc_Access = orc_Accesses[u32_It];
+         if (rc_Access.s32_Result != C_NO_ERR)
+         {
+            C_SclString c_ErrorText;
+            c_ErrorText.PrintFormatted("%sDataPoolData(Client indexes: Datapool: %d, List: %d, Element: %d)",
+                                       (oq_Write == true) ? "Write" : "Read", rc_Access.u8_DataPoolIndex,
+                                       rc_Access.u16_ListIndex, rc_Access.u16_ElementIndex);
+            m_LogServiceError(c_ErrorText, rc_Access.s32_Result, rc_Access.u8_NrCode);
+            s32_Retval = C_WARN;
+         }
+      }
+   }
+
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Assign one received response to the matching outstanding batch access
+
+   \param[in]      orc_Response   received (positive or negative) response to the batch service
+   \param[in]      oq_Write       true: write service; false: read service
+   \param[in]      oq_Draining    true: batch was aborted; negative responses can not be assigned and are discarded
+   \param[in,out]  orc_Accesses   all accesses of the batch; result is placed in the matching access
+   \param[in]      orc_PackedIds  packed data identifier of each access
+   \param[in,out]  orc_Pending    indexes of outstanding accesses in order of sending; matching entry is removed
+
+   \retval   true    response was progress of the server (access finished, response pending reported or
+                     negative response discarded while draining)
+   \retval   false   response could not be assigned and was ignored
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscProtocolDriverOsy::m_HandleDataPoolDataBatchResponse(const C_OscProtocolDriverOsyService & orc_Response,
+                                                               const bool oq_Write, const bool oq_Draining,
+                                                               std::vector<C_OscProtocolDataPoolAccess> & orc_Accesses,
+                                                               const std::vector<uint32_t> & orc_PackedIds,
+                                                               std::vector<uint32_t> & orc_Pending) const
+{
+   bool q_Progress = false;
+
+   if ((orc_Response.c_Data.size() >= 3U) && (orc_Response.c_Data[0] == mhu8_OSY_NR_SI))
+   {
+      q_Progress = true;
+      if ((orc_Response.c_Data[2] != hu8_NR_CODE_RESPONSE_PENDING) && (oq_Draining == false))
+      {
+         C_OscProtocolDataPoolAccess & rc_Access = orc_Accesses[orc_Pending[0]];
+         rc_Access.s32_Result = C_WARN;
+         rc_Access.u8_NrCode = orc_Response.c_Data[2];
+         orc_Pending.erase(orc_Pending.begin());
+      }
+   }
+   else if ((orc_Response.c_Data.size() >= 4U) && ((oq_Write == false) || (orc_Response.c_Data.size() == 4U)))
+   {
+      const uint32_t u32_PackedId = (static_cast<uint32_t>(orc_Response.c_Data[1]) << 16U) +
+                                    (static_cast<uint32_t>(orc_Response.c_Data[2]) << 8U) +
+                                    static_cast<uint32_t>(orc_Response.c_Data[3]);
+
+      for (std::vector<uint32_t>::iterator c_It = orc_Pending.begin(); c_It != orc_Pending.end(); ++c_It)
+      {
+         if (orc_PackedIds[*c_It] == u32_PackedId)
+         {
+            C_OscProtocolDataPoolAccess & rc_Access = orc_Accesses[*c_It];
+            if (oq_Write == false)
+            {
+               rc_Access.c_Data.assign(orc_Response.c_Data.begin() + 4, orc_Response.c_Data.end());
+            }
+            rc_Access.s32_Result = C_NO_ERR;
+            orc_Pending.erase(c_It);
+            q_Progress = true;
+            break;
+         }
+      }
+   }
+   else
+   {
+      //nothing to do; logged below
+   }
+
+   if (q_Progress == false)
+   {
+      m_LogErrorWithHeader("Synchronous communication",
+                           "Response to unknown Datapool data request received. Ignoring.", TGL_UTIL_FUNC_ID);
+   }
+
+   return q_Progress;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   RoutineControl utility wrapper
 
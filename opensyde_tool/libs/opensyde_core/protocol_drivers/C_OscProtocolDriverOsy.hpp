@@ -26,6 +26,7 @@
 
 #include "stwtypes.hpp"
 #include "C_OscProtocolSerialNumber.hpp"
+#include "C_OscProtocolDataPoolAccess.hpp"
 #include "C_OscProtocolDriverOsyTpBase.hpp"
 #include "stw_can.hpp" //for CAN message type
 
@@ -63,6 +64,9 @@ private:
    //maximum service size including header (used in WriteMemoryByAddress):
    uint16_t mu16_MaxServiceSize;
 
+   //maximum number of Datapool data requests sent without waiting for the responses (batch access):
+   uint8_t mu8_MaxPendingDataPoolRequests;
+
    std::map<uint8_t, uint8_t> mc_DataPoolMappingClientToServer;
    std::map<uint8_t, uint8_t> mc_DataPoolMappingServerToClient;
 
@@ -90,6 +94,12 @@ private:
                                     uint8_t(&orau8_PackedId)[3]) const;
    void m_UnpackDataPoolIdentifier(const uint8_t(&orau8_PackedId)[3], uint8_t & oru8_DataPoolIndex,
                                    uint16_t & oru16_ListIndex, uint16_t & oru16_ElementIndex) const;
+   int32_t m_DataPoolDataBatch(const bool oq_Write, std::vector<C_OscProtocolDataPoolAccess> & orc_Accesses);
+   bool m_HandleDataPoolDataBatchResponse(const C_OscProtocolDriverOsyService & orc_Response, const bool oq_Write,
+                                          const bool oq_Draining,
+                                          std::vector<C_OscProtocolDataPoolAccess> & orc_Accesses,
+                                          const std::vector<uint32_t> & orc_PackedIds,
+                                          std::vector<uint32_t> & orc_Pending) const;
    int32_t m_RoutineControl(const uint16_t ou16_RoutineIdentifier, const uint8_t ou8_SubFunction,
                             const std::vector<uint8_t> & orc_SendData, const uint16_t ou16_ExpectedPayloadSize,
                             const bool oq_ExactSizeExpected, std::vector<uint8_t> & orc_ReadData, uint8_t & oru8_NrCode,
@@ -261,6 +271,8 @@ public:
    void SetTimeoutPolling(const uint32_t ou32_TimeoutPollingMs);
    void ResetTimeoutPolling(void);
    void SetMaxServiceSize(const uint16_t ou16_MaxServiceSize);
+   uint16_t GetMaxServiceSize(void) const;
+   void SetMaxPendingDataPoolRequests(const uint8_t ou8_MaxPendingRequests);
 
    void InitializeTunnelCanMessage(const PR_OsyTunnelCanMessageReceived opr_OsyTunnelCanMessageReceived,
                                    void * const opv_Instance);
@@ -355,6 +367,8 @@ public:
    int32_t OsyWriteDataPoolData(const uint8_t ou8_DataPoolIndex, const uint16_t ou16_ListIndex,
                                 const uint16_t ou16_ElementIndex, const std::vector<uint8_t> & orc_DataToWrite,
                                 uint8_t * const opu8_NrCode = NULL);
+   int32_t OsyReadDataPoolDataBatch(std::vector<C_OscProtocolDataPoolAccess> & orc_Accesses);
+   int32_t OsyWriteDataPoolDataBatch(std::vector<C_OscProtocolDataPoolAccess> & orc_Accesses);
    int32_t OsyWriteDataPoolEventDataRate(const uint8_t ou8_TransmissionRail, const uint16_t ou16_DataRate,
                                          uint8_t * const opu8_NrCode = NULL);
    int32_t OsyReadDataPoolDataCyclic(const uint8_t ou8_DataPoolIndex, const uint16_t ou16_ListIndex,
@@ -426,6 +440,8 @@ public:
    static const uint32_t hu32_DEFAULT_TIMEOUT = 1000U; // In ms
    // Cyclic time till the registered function mpr_OnOsyWaitTime will be called in m_PollForSpecificServiceResponse
    static const uint32_t hu32_DEFAULT_HANDLE_WAIT_TIME = 2000U; // In ms
+   // Default number of Datapool data requests kept outstanding by the batch access services
+   static const uint8_t hu8_DEFAULT_MAX_PENDING_DATA_POOL_REQUESTS = 4U;
    // Sessions for service OsyDiagnosticSessionControl
    static const uint8_t hu8_DIAGNOSTIC_SESSION_DEFAULT            = 0x01U;
    static const uint8_t hu8_DIAGNOSTIC_SESSION_EXTENDED_DIAGNOSIS = 0x03U;
@@ -31,6 +31,7 @@ using namespace stw::scl;
 using namespace stw::tgl;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const uint32_t mu32_DISCARD_BLOCK_SIZE = 1024U; ///< bytes to drop per read of an unexpected response
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
@@ -122,14 +123,25 @@ int32_t C_OscProtocolDriverOsyTpIp::C_DoIpHeader::DecodeHeader(const std::vector
 void C_OscProtocolDriverOsyTpIp::C_DoIpHeader::ComposeHeader(std::vector<uint8_t> & orc_Header) const
 {
    orc_Header.resize(static_cast<uint32_t>(hu8_DOIP_HEADER_SIZE + u32_PayloadSize));
-   orc_Header[0] = 0x02U;         //protocol version DoIP ISO 13400-2:2012
-   orc_Header[1] = 0x02U ^ 0xFFU; //inverted protocol version
-   orc_Header[2] = static_cast<uint8_t>(u16_PayloadType >> 8U);
-   orc_Header[3] = static_cast<uint8_t>(u16_PayloadType & 0xFFU);
-   orc_Header[4] = static_cast<uint8_t>(u32_PayloadSize >> 24U);
-   orc_Header[5] = static_cast<uint8_t>(u32_PayloadSize >> 16U);
-   orc_Header[6] = static_cast<uint8_t>(u32_PayloadSize >> 8U);
-   orc_Header[7] = static_cast<uint8_t>(u32_PayloadSize);
+   this->ComposeHeader(&orc_Header[0]);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Compose DoIp request header into existing buffer
+
+   \param[out]   opu8_Header        composed header (buffer must provide hu8_DOIP_HEADER_SIZE bytes)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscProtocolDriverOsyTpIp::C_DoIpHeader::ComposeHeader(uint8_t * const opu8_Header) const
+{
+   opu8_Header[0] = 0x02U;         //protocol version DoIP ISO 13400-2:2012
+   opu8_Header[1] = 0x02U ^ 0xFFU; //inverted protocol version
+   opu8_Header[2] = static_cast<uint8_t>(u16_PayloadType >> 8U);
+   opu8_Header[3] = static_cast<uint8_t>(u16_PayloadType & 0xFFU);
+   opu8_Header[4] = static_cast<uint8_t>(u32_PayloadSize >> 24U);
+   opu8_Header[5] = static_cast<uint8_t>(u32_PayloadSize >> 16U);
+   opu8_Header[6] = static_cast<uint8_t>(u32_PayloadSize >> 8U);
+   opu8_Header[7] = static_cast<uint8_t>(u32_PayloadSize);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -139,7 +151,8 @@ void C_OscProtocolDriverOsyTpIp::C_DoIpHeader::ComposeHeader(std::vector<uint8_t
 */
 //----------------------------------------------------------------------------------------------------------------------
 C_OscProtocolDriverOsyTpIp::C_TcpRxServiceState::C_TcpRxServiceState(void) :
-   e_Status(eIDLE)
+   e_Status(eIDLE),
+   u32_BytesToDiscard(0U)
 {
 }
 
@@ -955,18 +968,20 @@ C_OscProtocolDriverOsyTpIp::~C_OscProtocolDriverOsyTpIp(void)
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-/*! \brief   Compose DoIp request
+/*! \brief   Compose DoIp request header
 
-   Set up one DoIp frame:
+   Set up the start of one DoIp frame:
    - DoIp header with payload type "DiagnosticMessage"
-   - Service data as payload
+   - source and target address
+
+   The service data itself is not copied; it is sent directly after the composed header.
 
-   \param[in]    orc_Service    service to put into request
-   \param[out]   orc_Request    composed data, ready for sending via IP
+   \param[in]    orc_Service           service to put into request
+   \param[out]   orau8_RequestHeader   composed header, to be followed by the service data
 */
 //----------------------------------------------------------------------------------------------------------------------
 void C_OscProtocolDriverOsyTpIp::m_ComposeRequest(const C_OscProtocolDriverOsyService & orc_Service,
-                                                  std::vector<uint8_t> & orc_Request) const
+                                                  uint8_t (&orau8_RequestHeader)[mhu8_REQUEST_HEADER_SIZE]) const
 {
    const uint16_t u16_SourceAddress =
       (static_cast<uint16_t>(static_cast<uint16_t>(mc_ClientId.u8_BusIdentifier) << 7U) +
@@ -990,19 +1005,14 @@ void C_OscProtocolDriverOsyTpIp::m_ComposeRequest(const C_OscProtocolDriverOsySe
       c_Header.u16_PayloadType = C_DoIpHeader::hu16_PAYLOAD_TYPE_CAN_ROUTING_WITHOUT_FC_REQ;
    }
 
-   c_Header.ComposeHeader(orc_Request);
+   c_Header.ComposeHeader(&orau8_RequestHeader[0]);
 
    //add payload:
    //source and target address:
-   orc_Request[8]  = static_cast<uint8_t>(u16_SourceAddress >> 8U);
-   orc_Request[9]  = static_cast<uint8_t>(u16_SourceAddress);
-   orc_Request[10] = static_cast<uint8_t>(u16_TargetAddress >> 8U);
-   orc_Request[11] = static_cast<uint8_t>(u16_TargetAddress);
-   //service:
-   if (orc_Service.c_Data.size() > 0)
-   {
-      (void)std::memcpy(&orc_Request[12], &orc_Service.c_Data[0], orc_Service.c_Data.size());
-   }
+   orau8_RequestHeader[8]  = static_cast<uint8_t>(u16_SourceAddress >> 8U);
+   orau8_RequestHeader[9]  = static_cast<uint8_t>(u16_SourceAddress);
+   orau8_RequestHeader[10] = static_cast<uint8_t>(u16_TargetAddress >> 8U);
+   orau8_RequestHeader[11] = static_cast<uint8_t>(u16_TargetAddress);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -1039,11 +1049,12 @@ int32_t C_OscProtocolDriverOsyTpIp::Cycle(void)
          s32_Return = this->m_GetFromTxQueue(c_Service);
          if (s32_Return == C_NO_ERR)
          {
-            //send data on TCP:
-            std::vector<uint8_t> c_Request;
-            m_ComposeRequest(c_Service, c_Request);
+            //send data on TCP (header and service data in one go):
+            uint8_t au8_RequestHeader[mhu8_REQUEST_HEADER_SIZE];
+            m_ComposeRequest(c_Service, au8_RequestHeader);
 
-            s32_Return = mpc_Dispatcher->SendTcp(this->mu32_DispatcherHandle, c_Request);
+            s32_Return = mpc_Dispatcher->SendTcpFrame(this->mu32_DispatcherHandle, &au8_RequestHeader[0],
+                                                      mhu8_REQUEST_HEADER_SIZE, c_Service.c_Data);
             if (s32_Return != C_NO_ERR)
             {
                m_LogWarningWithHeader("Could not send TCP request. Service data lost.", TGL_UTIL_FUNC_ID);
@@ -1105,8 +1116,11 @@ int32_t C_OscProtocolDriverOsyTpIp::Cycle(void)
                      }
                      else
                      {
-                        m_LogWarningWithHeader("TCP response with unexpected payload size received. Ignoring.",
-                                               TGL_UTIL_FUNC_ID);
+                        //drop the payload; otherwise it would be interpreted as the start of the next response
+                        m_LogWarningWithHeader("TCP response with unexpected payload size or type received. "
+                                               "Ignoring.", TGL_UTIL_FUNC_ID);
+                        mc_RxState.u32_BytesToDiscard = mc_RxState.c_ServiceHeader.u32_PayloadSize;
+                        mc_RxState.e_Status = C_TcpRxServiceState::eDISCARD;
                      }
                      break;
                   case C_CONFIG:
@@ -1129,8 +1143,31 @@ int32_t C_OscProtocolDriverOsyTpIp::Cycle(void)
                mc_RxState.c_ServiceHeader.u16_PayloadType = C_DoIpHeader::hu16_PAYLOAD_TYPE_DIAGNOSTIC_MESSAGE;
             }
          }
+         //drop payload of unexpected response in small blocks:
+         if (mc_RxState.e_Status == C_TcpRxServiceState::eDISCARD)
+         {
+            c_Data.resize(std::min(mc_RxState.u32_BytesToDiscard, mu32_DISCARD_BLOCK_SIZE));
+            s32_Return = mpc_Dispatcher->ReadTcp(this->mu32_DispatcherHandle, c_Data);
+            if (s32_Return == C_NO_ERR)
+            {
+               mc_RxState.u32_BytesToDiscard -= static_cast<uint32_t>(c_Data.size());
+               if (mc_RxState.u32_BytesToDiscard == 0U)
+               {
+                  mc_RxState.e_Status = C_TcpRxServiceState::eIDLE;
+               }
+            }
+            else if (s32_Return != C_NOACT)
+            {
+               //connection lost: the rest of the frame will never arrive
+               mc_RxState.e_Status = C_TcpRxServiceState::eIDLE;
+            }
+            else
+            {
+               //wait for more data
+            }
+         }
          //"wait" for payload:
-         if (mc_RxState.e_Status == C_TcpRxServiceState::ePARTIAL)
+         else if (mc_RxState.e_Status == C_TcpRxServiceState::ePARTIAL)
          {
             if (q_DataFromBuffer == false)
             {
@@ -1155,8 +1192,9 @@ int32_t C_OscProtocolDriverOsyTpIp::Cycle(void)
                {
                   if (mc_RxState.c_ServiceHeader.u16_PayloadType == C_DoIpHeader::hu16_PAYLOAD_TYPE_DIAGNOSTIC_MESSAGE)
                   {
-                     c_Service.c_Data.resize(c_Data.size() - 4U);
-                     (void)std::memcpy(&c_Service.c_Data[0], &c_Data[4], c_Data.size() - 4U);
+                     //take over the received buffer and drop the address bytes in place; no second buffer needed
+                     c_Service.c_Data.swap(c_Data);
+                     c_Service.c_Data.erase(c_Service.c_Data.begin(), c_Service.c_Data.begin() + 4);
                      //add to queue:
                      s32_Return = m_AddToRxQueue(c_Service);
                      if (s32_Return != C_NO_ERR)
@@ -1180,6 +1218,12 @@ int32_t C_OscProtocolDriverOsyTpIp::Cycle(void)
                mc_RxState.e_Status = C_TcpRxServiceState::eIDLE;
                s32_Return = C_NO_ERR;
             }
+            else if (s32_Return != C_NOACT)
+            {
+               //Socket closed or invalid: the rest of this response will never arrive.
+               //Start with a new header after reconnecting instead of waiting for this payload forever.
+               mc_RxState.e_Status = C_TcpRxServiceState::eIDLE;
+            }
             else
             {
                //No new data -> nothing to do
@@ -62,6 +62,7 @@ private:
 
       int32_t DecodeHeader(const std::vector<uint8_t> & orc_Header);
       void ComposeHeader(std::vector<uint8_t> & orc_Header) const;
+      void ComposeHeader(uint8_t * const opu8_Header) const;
    };
 
    ///information about ongoing TCP Rx transmission
@@ -73,12 +74,14 @@ private:
       enum E_ServiceStatus
       {
          eIDLE,
-         ePARTIAL
+         ePARTIAL,
+         eDISCARD
       };
 
       C_DoIpHeader c_ServiceHeader;
 
       E_ServiceStatus e_Status;
+      uint32_t u32_BytesToDiscard; ///< remaining payload bytes of an unexpected frame (in state eDISCARD)
    };
 
    C_TcpRxServiceState mc_RxState;
@@ -86,7 +89,10 @@ private:
    C_OscIpDispatcher * mpc_Dispatcher; ///< driver to use for accessing local IP stack
    uint32_t mu32_DispatcherHandle;     ///< handler to use for dispatcher TDP functions
 
-   void m_ComposeRequest(const C_OscProtocolDriverOsyService & orc_Service, std::vector<uint8_t> & orc_Request) const;
+   static const uint8_t mhu8_REQUEST_HEADER_SIZE = 12U; ///< DoIp header + source and target address
+
+   void m_ComposeRequest(const C_OscProtocolDriverOsyService & orc_Service,
+                         uint8_t (&orau8_RequestHeader)[mhu8_REQUEST_HEADER_SIZE]) const;
 
 protected:
    void m_LogWarningWithHeader(const stw::scl::C_SclString & orc_Information, const char_t * const opcn_Function) const;
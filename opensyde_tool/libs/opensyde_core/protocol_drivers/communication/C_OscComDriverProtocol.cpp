@@ -29,6 +29,7 @@
 #include "C_OscProtocolDriverOsyTpCan.hpp"
 #include "C_OscProtocolDriverOsyTpIp.hpp"
 #include "C_OscRoutingCalculation.hpp"
+#include "C_OscRoutingTable.hpp"
 #include "C_OscSecurityRsa.hpp"
 #include "TglUtils.hpp"
 #include "TglTime.hpp"
@@ -2678,6 +2679,7 @@ void C_OscComDriverProtocol::m_StopRoutingSpecific(const uint32_t ou32_ActiveNod
 /*! \brief   Initialize Routes for each node
 
    Route configuration depends on child implementation of m_GetRoutingMode.
+   The routes to all nodes are calculated in one go (and remembered for further connects with the same configuration).
 
    \return
    C_NO_ERR      Operation success
@@ -2695,39 +2697,41 @@ int32_t C_OscComDriverProtocol::m_InitRoutesAndActiveNodes(void)
       //Count active nodes
       C_OscRoutingCalculation::E_Mode e_Mode;
       const bool q_RoutingUsed = this->m_GetRoutingMode(e_Mode);
+      std::vector<C_OscRoutingTable::C_TargetRoute> c_BestRoutes;
 
       this->mu32_ActiveNodeCount = 0;
       this->mc_ActiveNodesIndexes.clear();
       this->mc_Routes.clear();
 
+      //Calculate best routes to all nodes
+      C_OscRoutingTable::h_GetBestRoutes(this->mpc_SysDef->c_Nodes, this->mc_ActiveNodesSystem,
+                                         this->mu32_ActiveBusIndex, e_Mode, c_BestRoutes);
+
       //Init routes
       for (uint32_t u32_ItActiveFlag = 0; u32_ItActiveFlag < this->mc_ActiveNodesSystem.size(); ++u32_ItActiveFlag)
       {
          if (this->mc_ActiveNodesSystem[u32_ItActiveFlag] == 1U)
          {
-            //Calculate all routes
-            const C_OscRoutingCalculation c_RouteCalculation(this->mpc_SysDef->c_Nodes, this->mc_ActiveNodesSystem,
-                                                             this->mu32_ActiveBusIndex,
-                                                             u32_ItActiveFlag, e_Mode);
-            s32_Retval = c_RouteCalculation.GetState();
+            if (u32_ItActiveFlag < c_BestRoutes.size())
+            {
+               s32_Retval = c_BestRoutes[u32_ItActiveFlag].s32_State;
+            }
+            else
+            {
+               //same as for single route calculation: target node does not exist
+               s32_Retval = C_RANGE;
+            }
             if (s32_Retval == C_NO_ERR)
             {
                // Get the best route for this node
-               const C_OscRoutingRoute * const pc_Route = c_RouteCalculation.GetBestRoute();
-               if (pc_Route != NULL)
+               const C_OscRoutingRoute & rc_Route = c_BestRoutes[u32_ItActiveFlag].c_Route;
+               // If no routing shall be used, register only nodes which are connected to the PC bus directly
+               if ((q_RoutingUsed == true) ||
+                   (rc_Route.c_VecRoutePoints.size() == 0))
                {
-                  // If no routing shall be used, register only nodes which are connected to the PC bus directly
-                  if ((q_RoutingUsed == true) ||
-                      (pc_Route->c_VecRoutePoints.size() == 0))
-                  {
-                     this->mc_Routes.push_back(*pc_Route);
-                     this->mc_ActiveNodesIndexes.push_back(u32_ItActiveFlag);
-                     ++this->mu32_ActiveNodeCount;
-                  }
-               }
-               else
-               {
-                  s32_Retval = C_CONFIG;
+                  this->mc_Routes.push_back(rc_Route);
+                  this->mc_ActiveNodesIndexes.push_back(u32_ItActiveFlag);
+                  ++this->mu32_ActiveNodeCount;
                }
             }
             else if (s32_Retval == C_NOACT)
@@ -26,8 +26,8 @@
 #include "C_OscComMessageLogger.hpp"
 #include "C_OscSystemDefinitionFiler.hpp"
 #include "C_CanMonProtocol.hpp"
-#include "C_OscCanUtil.hpp"
 #include "C_OscComMessageLoggerFileAsc.hpp"
+#include "C_OscComMessageLoggerFileCsv.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 
@@ -55,43 +55,6 @@ const uint32_t C_OscComMessageLogger::mhu32_ECES_MAX_MESSAGE_COUNTER = 255;
 
 /* -- Implementation ------------------------------------------------------------------------------------------------ */
 
-//----------------------------------------------------------------------------------------------------------------------
-/*! \brief  Default constructor
-*/
-//----------------------------------------------------------------------------------------------------------------------
-C_OscComMessageLoggerFilter::C_OscComMessageLoggerFilter(void) :
-   u8_ExtendedId(0U),
-   u32_StartId(0U),
-   u32_EndId(0U),
-   q_PassFilter(false)
-{
-}
-
-//----------------------------------------------------------------------------------------------------------------------
-/*! \brief  Check if current equal to orc_Cmp
-
-   \param[in] orc_Cmp Compared instance
-
-   \return
-   Current equal to orc_Cmp
-   Else false
-*/
-//----------------------------------------------------------------------------------------------------------------------
-bool C_OscComMessageLoggerFilter::operator ==(const C_OscComMessageLoggerFilter & orc_Cmp) const
-{
-   bool q_Return = false;
-
-   if ((this->u8_ExtendedId == orc_Cmp.u8_ExtendedId) &&
-       (this->q_PassFilter == orc_Cmp.q_PassFilter) &&
-       (this->u32_StartId == orc_Cmp.u32_StartId) &&
-       (this->u32_EndId == orc_Cmp.u32_EndId))
-   {
-      q_Return = true;
-   }
-
-   return q_Return;
-}
-
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Default constructor
 */
@@ -162,13 +125,20 @@ void C_OscComMessageLogger::Pause(void)
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Function to react on the stop of the communication
 
-   Reset all CAN message counter
+   Reset all CAN message counter and write all buffered messages of the log files
 */
 //----------------------------------------------------------------------------------------------------------------------
 void C_OscComMessageLogger::Stop(void)
 {
+   std::map<stw::scl::C_SclString, C_OscComMessageLoggerFileBase * const>::const_iterator c_ItFile;
+
    this->m_ResetCounter();
    this->m_ResetEcesMessages();
+
+   for (c_ItFile = this->mc_LoggingFiles.begin(); c_ItFile != this->mc_LoggingFiles.end(); ++c_ItFile)
+   {
+      c_ItFile->second->Flush();
+   }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -449,6 +419,8 @@ int32_t C_OscComMessageLogger::RemoveDatabase(const C_SclString & orc_Path)
 
       // Remove the entry
       this->mc_OsySysDefs.erase(c_ItSysDef);
+      // The plans may refer to messages of the removed system definition
+      this->mc_OsySysDefExtractionPlans.clear();
 
       s32_Return = C_NO_ERR;
    }
@@ -529,10 +501,37 @@ int32_t C_OscComMessageLogger::AddLogFileAsc(const C_SclString & orc_FilePath, c
    return s32_Return; //lint !e429  //no memory leak of pc_File because of handling of instance in map mc_LoggingFiles
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Adds a CSV log file with the interpreted messages
+
+   \param[in] orc_FilePath               Path with file name. File extension must be .csv
+   \param[in] oq_HexActive               Mode for writing CAN Id and CAN data (hexadecimal or decimal)
+
+   \return
+   C_NO_ERR    File added successfully
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscComMessageLogger::AddLogFileCsv(const C_SclString & orc_FilePath, const bool oq_HexActive)
+{
+   int32_t s32_Return;
+   C_OscComMessageLoggerFileCsv * pc_File;
+   C_SclString c_ProtocolName;
+
+   this->mc_ProtocolDec.GetProtocolName(this->me_Protocol, c_ProtocolName);
+   pc_File = new C_OscComMessageLoggerFileCsv(orc_FilePath, c_ProtocolName, oq_HexActive);
+   s32_Return = pc_File->OpenFile();
+
+   this->mc_LoggingFiles.insert(std::pair<C_SclString,
+                                          C_OscComMessageLoggerFileBase * const>(orc_FilePath, pc_File));
+
+   return s32_Return; //lint !e429  //no memory leak of pc_File because of handling of instance in map mc_LoggingFiles
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Remove an specific log file
 
    The written file is not removed. The log file is removed from the list of active log files.
+   All buffered messages are written before the file is closed.
 
    \param[in] orc_FilePath Path with file name. File extension must be .asc
 
@@ -577,6 +576,24 @@ void C_OscComMessageLogger::RemoveAllLogFiles(void)
    this->mc_LoggingFiles.clear();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Sets the buffer overflow handling of all registered log files
+
+   Offline processing (e.g. trace replay) should use eOVERFLOW_BLOCK to not lose any message.
+
+   \param[in] oe_Mode  Overflow mode
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComMessageLogger::SetLogFilesOverflowMode(const C_OscComMessageLoggerFileBase::E_OverflowMode oe_Mode)
+{
+   std::map<stw::scl::C_SclString, C_OscComMessageLoggerFileBase * const>::const_iterator c_ItFile;
+
+   for (c_ItFile = this->mc_LoggingFiles.begin(); c_ItFile != this->mc_LoggingFiles.end(); ++c_ItFile)
+   {
+      c_ItFile->second->SetOverflowMode(oe_Mode);
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Adds a new filter configuration
 
@@ -586,6 +603,7 @@ void C_OscComMessageLogger::RemoveAllLogFiles(void)
 void C_OscComMessageLogger::AddFilter(const C_OscComMessageLoggerFilter & orc_Filter)
 {
    this->mc_CanFilterConfig.push_back(orc_Filter);
+   this->mc_CompiledCanFilter.Compile(this->mc_CanFilterConfig);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -604,6 +622,7 @@ void C_OscComMessageLogger::RemoveFilter(const C_OscComMessageLoggerFilter & orc
       {
          // Filter found, remove it
          this->mc_CanFilterConfig.erase(this->mc_CanFilterConfig.begin() + u32_Counter);
+         this->mc_CompiledCanFilter.Compile(this->mc_CanFilterConfig);
          break;
       }
    }
@@ -616,6 +635,7 @@ void C_OscComMessageLogger::RemoveFilter(const C_OscComMessageLoggerFilter & orc
 void C_OscComMessageLogger::RemoveAllFilter(void)
 {
    this->mc_CanFilterConfig.clear();
+   this->mc_CompiledCanFilter.Compile(this->mc_CanFilterConfig);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -633,6 +653,22 @@ uint32_t C_OscComMessageLogger::GetFilteredMessages(void) const
    return this->mu32_FilteredMessages;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Returns the compiled filter configuration
+
+   Can be used to let the CAN driver discard messages not passing the pass filters
+   (see C_OscComMessageLoggerFilterSet::GetAcceptanceFilters).
+   Only useful if the CAN driver receives messages for this logger only.
+
+   \return
+   Compiled filter configuration
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_OscComMessageLoggerFilterSet & C_OscComMessageLogger::GetCompiledFilter(void) const
+{
+   return this->mc_CompiledCanFilter;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  If necessary handle and log the CAN message
 
@@ -802,67 +838,7 @@ const C_OscComMessageLoggerData & C_OscComMessageLogger::m_GetHandledCanMessage(
 //----------------------------------------------------------------------------------------------------------------------
 bool C_OscComMessageLogger::m_CheckFilter(const T_STWCAN_Msg_RX & orc_Msg)
 {
-   bool q_Return = false;
-
-   if (this->mc_CanFilterConfig.size() > 0)
-   {
-      uint32_t u32_FilterCounter;
-      bool q_Blocked = false;
-      bool q_PassFilterAvailable = false;
-
-      // Check all block filters first
-      for (u32_FilterCounter = 0U; u32_FilterCounter < this->mc_CanFilterConfig.size(); ++u32_FilterCounter)
-      {
-         if (this->mc_CanFilterConfig[u32_FilterCounter].q_PassFilter == false)
-         {
-            if ((orc_Msg.u8_XTD == this->mc_CanFilterConfig[u32_FilterCounter].u8_ExtendedId) &&
-                (orc_Msg.u32_ID >= this->mc_CanFilterConfig[u32_FilterCounter].u32_StartId) &&
-                (orc_Msg.u32_ID <= this->mc_CanFilterConfig[u32_FilterCounter].u32_EndId))
-            {
-               // Message is not relevant. No further checks necessary.
-               q_Blocked = true;
-               break;
-            }
-         }
-         else
-         {
-            // At least one pass filter is configured
-            // The pass filters will be checked separately if not blocked
-            q_PassFilterAvailable = true;
-         }
-      }
-
-      if (q_Blocked == false)
-      {
-         if (q_PassFilterAvailable == true)
-         {
-            // Check only if the CAN message was not already blocked explicitly and at least one pass filter
-            // was configured
-            for (u32_FilterCounter = 0U; u32_FilterCounter < this->mc_CanFilterConfig.size(); ++u32_FilterCounter)
-            {
-               if ((orc_Msg.u8_XTD == this->mc_CanFilterConfig[u32_FilterCounter].u8_ExtendedId) &&
-                   (orc_Msg.u32_ID >= this->mc_CanFilterConfig[u32_FilterCounter].u32_StartId) &&
-                   (orc_Msg.u32_ID <= this->mc_CanFilterConfig[u32_FilterCounter].u32_EndId))
-               {
-                  // This pass filter matched. CAN message is not blocked and relevant.
-                  q_Return = true;
-                  break;
-               }
-            }
-         }
-         else
-         {
-            // The message is not blocked and no pass filter configured.
-            // That means that all messages, which are not blocked are relevant.
-            q_Return = true;
-         }
-      }
-   }
-   else
-   {
-      // No filter configured, all messages are welcome
-      q_Return = true;
-   }
+   const bool q_Return = this->mc_CompiledCanFilter.CheckMessage(orc_Msg);
 
    if ((q_Return == false) &&
        (this->mu32_FilteredMessages < 0xFFFFFFFFU))
@@ -1124,59 +1100,44 @@ bool C_OscComMessageLogger::m_InterpretSysDef(C_OscComMessageLoggerData & orc_Me
        (this->mpc_OsySysDefDataPoolList != NULL))
    {
       uint32_t u32_Counter;
-      bool q_MultiplexerFound = false;
-      uint32_t u32_MultiplexerIndex = 0U;
-      uint16_t u16_MultiplexValue = 0U;
+      uint32_t u32_MultiplexerIndex;
+      std::map<const C_OscCanMessage *, C_OscCanMessageExtractionPlan>::iterator c_ItPlan =
+         this->mc_OsySysDefExtractionPlans.find(this->mpc_OsySysDefMessage);
 
-      orc_MessageData.c_Name = this->mpc_OsySysDefMessage->c_Name.c_str();
-
-      // Check if a multiplexer signal exists
-      for (u32_Counter = 0U; u32_Counter < this->mpc_OsySysDefMessage->c_Signals.size(); ++u32_Counter)
+      if (c_ItPlan == this->mc_OsySysDefExtractionPlans.end())
       {
-         const C_OscCanSignal & rc_OscSignal = this->mpc_OsySysDefMessage->c_Signals[u32_Counter];
+         // First reception of this message. Compile the plan once.
+         c_ItPlan = this->mc_OsySysDefExtractionPlans.insert(
+            std::pair<const C_OscCanMessage *, C_OscCanMessageExtractionPlan>(this->mpc_OsySysDefMessage,
+                                                                             C_OscCanMessageExtractionPlan())).first;
+         c_ItPlan->second.Compile(*this->mpc_OsySysDefMessage, *this->mpc_OsySysDefDataPoolList);
+      }
 
-         if (rc_OscSignal.e_MultiplexerType == C_OscCanSignal::eMUX_MULTIPLEXER_SIGNAL)
-         {
-            this->m_InterpretSysDefCanSignal(orc_MessageData, rc_OscSignal);
+      C_OscCanMessageExtractionPlan & rc_Plan = c_ItPlan->second;
+      const bool q_HasMultiplexer = rc_Plan.GetMultiplexerSignalIndex(u32_MultiplexerIndex);
 
-            if (orc_MessageData.c_Signals.size() > 0)
-            {
-               C_OscComMessageLoggerDataSignal & rc_Signal =
-                  orc_MessageData.c_Signals[orc_MessageData.c_Signals.size() - 1];
+      orc_MessageData.c_Name = this->mpc_OsySysDefMessage->c_Name.c_str();
 
-               if (rc_Signal.q_DlcError == false)
-               {
-                  try
-                  {
-                     u16_MultiplexValue = static_cast<uint16_t>(rc_Signal.c_RawValueDec.ToInt());
-                     rc_Signal.c_Name += " (Multiplexer)";
-                     q_MultiplexerFound = true;
-                     u32_MultiplexerIndex = u32_Counter;
-                  }
-                  catch (...)
-                  {
-                  }
-               }
-            }
-            break;
-         }
-      }
+      // Extract all signals in one step. Multiplexed signals are only extracted for the matching multiplexer value.
+      rc_Plan.Decode(orc_MessageData.c_CanMsg.au8_Data, orc_MessageData.c_CanMsg.u8_DLC);
 
       // Interpret the signals
-      for (u32_Counter = 0U; u32_Counter < this->mpc_OsySysDefMessage->c_Signals.size(); ++u32_Counter)
+      for (u32_Counter = 0U; u32_Counter < rc_Plan.GetSignalCount(); ++u32_Counter)
       {
-         // Skip the multiplexer signal if one was found. It was added already.
-         if ((q_MultiplexerFound == false) ||
-             (u32_Counter != u32_MultiplexerIndex))
+         const C_OscCanMessageExtractionPlan::E_SignalState e_State = rc_Plan.GetSignalState(u32_Counter);
+
+         if (e_State != C_OscCanMessageExtractionPlan::eSIGNAL_NOT_PRESENT)
          {
-            const C_OscCanSignal & rc_OscSignal = this->mpc_OsySysDefMessage->c_Signals[u32_Counter];
+            const uint32_t u32_SignalCountBefore = static_cast<uint32_t>(orc_MessageData.c_Signals.size());
+
+            this->m_InterpretSysDefCanSignal(orc_MessageData, this->mpc_OsySysDefMessage->c_Signals[u32_Counter],
+                                             rc_Plan, u32_Counter);
 
-            // Interpret all not multiplexed signals and all multiplexed signals with the matching multiplexer value
-            if ((rc_OscSignal.e_MultiplexerType == C_OscCanSignal::eMUX_DEFAULT) ||
-                ((q_MultiplexerFound == true) &&
-                 (u16_MultiplexValue == rc_OscSignal.u16_MultiplexValue)))
+            if ((q_HasMultiplexer == true) && (u32_Counter == u32_MultiplexerIndex) &&
+                (e_State == C_OscCanMessageExtractionPlan::eSIGNAL_DECODED) &&
+                (orc_MessageData.c_Signals.size() > u32_SignalCountBefore))
             {
-               this->m_InterpretSysDefCanSignal(orc_MessageData, rc_OscSignal);
+               orc_MessageData.c_Signals[orc_MessageData.c_Signals.size() - 1].c_Name += " (Multiplexer)";
             }
          }
       }
@@ -1284,48 +1245,51 @@ void C_OscComMessageLogger::mh_InterpretCanSignalValue(C_OscComMessageLoggerData
                                                        const C_OscNodeDataPoolContent & orc_OscValue,
                                                        const float64_t of64_Factor, const float64_t of64_Offset)
 {
-   const bool q_SignalFits = C_OscCanUtil::h_IsSignalInMessage(ou8_CanDlc, orc_OscSignal);
+   C_OscCanSignalExtraction c_Extraction;
 
-   if (q_SignalFits == true)
+   c_Extraction.Compile(orc_OscSignal, orc_OscValue.GetType());
+
+   if (c_Extraction.IsInMessage(ou8_CanDlc) == true)
    {
-      uint8_t u8_RawDataCounter;
-      std::vector<uint8_t> c_SignalRawData;
-      std::string c_StringValue;
-      C_OscNodeDataPoolContent c_OscValue = orc_OscValue;
-      uint64_t u64_Value = 0U;
-
-      // Get the signal as raw value in the first step
-      c_SignalRawData.resize(c_OscValue.GetSizeByte());
-      C_OscCanUtil::h_GetSignalValue(orau8_CanDb, orc_OscSignal, c_SignalRawData, orc_OscValue.GetType());
-      // And the interpreted value
-      c_OscValue.SetValueFromLittleEndianBlob(c_SignalRawData);
-
-      // Raw values
-      // Signal data is converted to little endian by h_GetSignalValue
-      for (u8_RawDataCounter = 0U; u8_RawDataCounter < c_SignalRawData.size(); ++u8_RawDataCounter)
-      {
-         const uint64_t u64_ShiftValue = static_cast<uint64_t>(u8_RawDataCounter) * 8U;
-         u64_Value += static_cast<uint64_t>(c_SignalRawData[u8_RawDataCounter]) << u64_ShiftValue;
-      }
+      mh_FormatCanSignalValue(orc_Signal, c_Extraction, c_Extraction.ExtractRawValue(orau8_CanDb), orc_OscValue,
+                              of64_Factor, of64_Offset);
+   }
+   else
+   {
+      // Signal is outside of the set data bytes (DLC is not big enough)
+      orc_Signal.c_RawValueDec = "N/A";
+      orc_Signal.c_RawValueHex = "N/A";
+      orc_Signal.c_Value = "N/A";
 
-      if ((orc_OscValue.GetType() == C_OscNodeDataPoolContent::eFLOAT32) ||
-          (orc_OscValue.GetType() == C_OscNodeDataPoolContent::eFLOAT64))
-      {
-         // In case of a float value, the raw value does not make any sense in byte form.
-         // Use the value without scaling as raw value.
-         c_OscValue.GetValueAsScaledString(1.0, 0.0, c_StringValue, 0U, true, true);
-         orc_Signal.c_RawValueDec = c_StringValue.c_str();
-         orc_Signal.c_RawValueHex = c_StringValue.c_str();
-      }
-      else
-      {
-         orc_Signal.c_RawValueDec = C_SclString::IntToStr(u64_Value);
-         orc_Signal.c_RawValueHex = C_SclString::IntToHex(static_cast<int64_t>(u64_Value), 1).UpperCase();
-      }
+      orc_Signal.q_DlcError = true;
+   }
+
+   orc_Signal.c_OscSignal = orc_OscSignal;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Interprets a CAN signal value decoded by an extraction plan
 
-      // Interpreted value
-      c_OscValue.GetValueAsScaledString(of64_Factor, of64_Offset, c_StringValue, 0U, true, true);
-      orc_Signal.c_Value = c_StringValue.c_str();
+   \param[in,out]     orc_Signal        Signal interpretation
+   \param[in]         orc_Plan          Extraction plan after Decode
+   \param[in]         ou32_SignalIndex  Index of signal in plan
+   \param[in]         orc_OscSignal     openSYDE CAN signal configuration
+   \param[in]         orc_OscValue      Datapool element content for type configuration
+   \param[in]         of64_Factor       Factor for resulting value
+   \param[in]         of64_Offset       Offset for resulting value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComMessageLogger::mh_InterpretCanSignalValue(C_OscComMessageLoggerDataSignal & orc_Signal,
+                                                       const C_OscCanMessageExtractionPlan & orc_Plan,
+                                                       const uint32_t ou32_SignalIndex,
+                                                       const C_OscCanSignal & orc_OscSignal,
+                                                       const C_OscNodeDataPoolContent & orc_OscValue,
+                                                       const float64_t of64_Factor, const float64_t of64_Offset)
+{
+   if (orc_Plan.GetSignalState(ou32_SignalIndex) == C_OscCanMessageExtractionPlan::eSIGNAL_DECODED)
+   {
+      mh_FormatCanSignalValue(orc_Signal, orc_Plan.GetSignalExtraction(ou32_SignalIndex),
+                              orc_Plan.GetRawValue(ou32_SignalIndex), orc_OscValue, of64_Factor, of64_Offset);
    }
    else
    {
@@ -1379,8 +1343,6 @@ C_SclString C_OscComMessageLogger::m_GetProtocolStringDecHook(void) const
 //----------------------------------------------------------------------------------------------------------------------
 void C_OscComMessageLogger::m_ConvertCanMessage(const T_STWCAN_Msg_RX & orc_Msg, const bool oq_IsTx)
 {
-   uint8_t u8_DbCounter;
-
    // Clear not handled data in this function
    this->mc_HandledCanMessage.c_Name = "";
    this->mc_HandledCanMessage.c_ProtocolTextHex = "";
@@ -1391,41 +1353,8 @@ void C_OscComMessageLogger::m_ConvertCanMessage(const T_STWCAN_Msg_RX & orc_Msg,
 
    // Save the L2 message. Needed for the interpretation partly
    this->mc_HandledCanMessage.c_CanMsg = orc_Msg;
-
-   // Prepare the data for the ui
-   this->mc_HandledCanMessage.c_CanIdDec = C_SclString::IntToStr(orc_Msg.u32_ID);
-   this->mc_HandledCanMessage.c_CanIdHex = C_SclString::IntToHex(orc_Msg.u32_ID, 1).UpperCase();
-   if (orc_Msg.u8_XTD > 0U)
-   {
-      // Extended Id
-      this->mc_HandledCanMessage.c_CanIdDec += "x";
-      this->mc_HandledCanMessage.c_CanIdHex += "x";
-   }
-   this->mc_HandledCanMessage.c_CanDlc = C_SclString::IntToStr(orc_Msg.u8_DLC);
    this->mc_HandledCanMessage.q_IsTx = oq_IsTx;
 
-   this->mc_HandledCanMessage.c_CanDataDec = "";
-   this->mc_HandledCanMessage.c_CanDataHex = "";
-   for (u8_DbCounter = 0U; u8_DbCounter < orc_Msg.u8_DLC; ++u8_DbCounter)
-   {
-      if (orc_Msg.au8_Data[u8_DbCounter] < 100)
-      {
-         this->mc_HandledCanMessage.c_CanDataDec += " ";
-         if (orc_Msg.au8_Data[u8_DbCounter] < 10)
-         {
-            this->mc_HandledCanMessage.c_CanDataDec += " ";
-         }
-      }
-      this->mc_HandledCanMessage.c_CanDataDec += C_SclString::IntToStr(orc_Msg.au8_Data[u8_DbCounter]);
-      this->mc_HandledCanMessage.c_CanDataHex += C_SclString::IntToHex(orc_Msg.au8_Data[u8_DbCounter], 2).UpperCase();
-
-      if (u8_DbCounter < (orc_Msg.u8_DLC - 1U))
-      {
-         this->mc_HandledCanMessage.c_CanDataDec += " ";
-         this->mc_HandledCanMessage.c_CanDataHex += " ";
-      }
-   }
-
    // It is possible that communication between a tool on the same CAN bus on the virtual side and a real
    // hardware communication partner cause a problem in the CAN message order.
    // The internal send CAN messages can be seen by other tools on the same internal network earlier than
@@ -1459,12 +1388,8 @@ void C_OscComMessageLogger::m_ConvertCanMessage(const T_STWCAN_Msg_RX & orc_Msg,
       this->mc_HandledCanMessage.u64_TimeStampRelative = 0ULL;
    }
 
-   this->mc_HandledCanMessage.c_TimeStampAbsoluteStart =
-      C_OscComMessageLoggerData::h_GetTimestampAsString(this->mc_HandledCanMessage.u64_TimeStampAbsoluteStart);
-   this->mc_HandledCanMessage.c_TimeStampAbsoluteTimeOfDay =
-      C_OscComMessageLoggerData::h_GetTimestampAsString(this->mc_HandledCanMessage.u64_TimeStampAbsoluteTimeOfDay);
-   this->mc_HandledCanMessage.c_TimeStampRelative =
-      C_OscComMessageLoggerData::h_GetTimestampAsString(this->mc_HandledCanMessage.u64_TimeStampRelative);
+   // Prepare the data for the ui
+   this->mc_HandledCanMessage.UpdateCanMessageStrings();
    // Save the timestamp for the next message to calculate the relative timestamp
    this->mu64_LastTimeStamp = orc_Msg.u64_TimeStamp;
 
@@ -1505,12 +1430,16 @@ void C_OscComMessageLogger::m_ConvertCanMessage(const T_STWCAN_Msg_RX & orc_Msg,
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Interprets the system definition message signal
 
-   \param[in,out] orc_MessageData Message data target for the interpretation
-   \param[in]     orc_OscSignal   CAN signal of system definition
+   \param[in,out] orc_MessageData    Message data target for the interpretation
+   \param[in]     orc_OscSignal      CAN signal of system definition
+   \param[in]     orc_Plan           Extraction plan of message after Decode
+   \param[in]     ou32_SignalIndex   Index of signal in message and plan
 */
 //----------------------------------------------------------------------------------------------------------------------
 void C_OscComMessageLogger::m_InterpretSysDefCanSignal(C_OscComMessageLoggerData & orc_MessageData,
-                                                       const C_OscCanSignal & orc_OscSignal) const
+                                                       const C_OscCanSignal & orc_OscSignal,
+                                                       const C_OscCanMessageExtractionPlan & orc_Plan,
+                                                       const uint32_t ou32_SignalIndex) const
 {
    if ((this->mpc_OsySysDefDataPoolList != NULL) &&
        (orc_OscSignal.u32_ComDataElementIndex < this->mpc_OsySysDefDataPoolList->c_Elements.size()))
@@ -1524,14 +1453,54 @@ void C_OscComMessageLogger::m_InterpretSysDefCanSignal(C_OscComMessageLoggerData
       c_Signal.c_Comment = rc_OscElement.c_Comment.c_str();
 
       // Get the current value for the correct type configuration
-      mh_InterpretCanSignalValue(c_Signal, orc_MessageData.c_CanMsg.au8_Data, orc_MessageData.c_CanMsg.u8_DLC,
-                                 orc_OscSignal, rc_OscElement.c_Value, rc_OscElement.f64_Factor,
-                                 rc_OscElement.f64_Offset);
+      mh_InterpretCanSignalValue(c_Signal, orc_Plan, ou32_SignalIndex, orc_OscSignal, rc_OscElement.c_Value,
+                                 rc_OscElement.f64_Factor, rc_OscElement.f64_Offset);
 
       orc_MessageData.c_Signals.push_back(c_Signal);
    }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Fills the value strings of a signal interpretation with an extracted raw value
+
+   \param[in,out]     orc_Signal        Signal interpretation
+   \param[in]         orc_Extraction    Compiled extraction of the signal
+   \param[in]         ou64_RawValue     Extracted raw value
+   \param[in]         orc_OscValue      Datapool element content for type configuration
+   \param[in]         of64_Factor       Factor for resulting value
+   \param[in]         of64_Offset       Offset for resulting value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComMessageLogger::mh_FormatCanSignalValue(C_OscComMessageLoggerDataSignal & orc_Signal,
+                                                    const C_OscCanSignalExtraction & orc_Extraction,
+                                                    const uint64_t ou64_RawValue,
+                                                    const C_OscNodeDataPoolContent & orc_OscValue,
+                                                    const float64_t of64_Factor, const float64_t of64_Offset)
+{
+   std::string c_StringValue;
+   C_OscNodeDataPoolContent c_OscValue = orc_OscValue;
+
+   orc_Extraction.SetContentValue(ou64_RawValue, c_OscValue);
+
+   if (orc_Extraction.IsFloat() == true)
+   {
+      // In case of a float value, the raw value does not make any sense in byte form.
+      // Use the value without scaling as raw value.
+      c_OscValue.GetValueAsScaledString(1.0, 0.0, c_StringValue, 0U, true, true);
+      orc_Signal.c_RawValueDec = c_StringValue.c_str();
+      orc_Signal.c_RawValueHex = c_StringValue.c_str();
+   }
+   else
+   {
+      orc_Signal.c_RawValueDec = C_SclString::IntToStr(ou64_RawValue);
+      orc_Signal.c_RawValueHex = C_SclString::IntToHex(static_cast<int64_t>(ou64_RawValue), 1).UpperCase();
+   }
+
+   // Interpreted value
+   c_OscValue.GetValueAsScaledString(of64_Factor, of64_Offset, c_StringValue, 0U, true, true);
+   orc_Signal.c_Value = c_StringValue.c_str();
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Resets all CAN message counter
 */
@@ -24,7 +24,9 @@
 #include "C_OscComMessageLoggerOsySysDefConfig.hpp"
 #include "C_OscComMessageLoggerData.hpp"
 #include "C_OscComMessageLoggerFileBase.hpp"
+#include "C_OscComMessageLoggerFilterSet.hpp"
 #include "C_OscCanSignal.hpp"
+#include "C_OscCanMessageExtractionPlan.hpp"
 #include "C_OscComAutoSupport.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
@@ -36,19 +38,6 @@ namespace opensyde_core
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
-class C_OscComMessageLoggerFilter
-{
-public:
-   C_OscComMessageLoggerFilter(void);
-
-   bool operator ==(const C_OscComMessageLoggerFilter & orc_Cmp) const;
-
-   uint8_t u8_ExtendedId; ///< 0 -> 11bit ID; 1 -> 29bit ID
-   uint32_t u32_StartId;  ///< First CAN ID which is relevant for the filter configuration
-   uint32_t u32_EndId;    ///< Last CAN ID which is relevant for the filter configuration
-   bool q_PassFilter;     ///< true -> Filter for passing; false -> Filter for blocking configured CAN IDs
-};
-
 class C_OscComMessageLogger
 {
 public:
@@ -78,14 +67,17 @@ public:
    // Logging handling
    virtual int32_t AddLogFileAsc(const stw::scl::C_SclString & orc_FilePath, const bool oq_HexActive,
                                  const bool oq_RelativeTimeStampActive);
+   virtual int32_t AddLogFileCsv(const stw::scl::C_SclString & orc_FilePath, const bool oq_HexActive);
    virtual int32_t RemoveLogFile(const stw::scl::C_SclString & orc_FilePath);
    virtual void RemoveAllLogFiles(void);
+   virtual void SetLogFilesOverflowMode(const C_OscComMessageLoggerFileBase::E_OverflowMode oe_Mode);
 
    // Filter handling
    virtual void AddFilter(const C_OscComMessageLoggerFilter & orc_Filter);
    virtual void RemoveFilter(const C_OscComMessageLoggerFilter & orc_Filter);
    virtual void RemoveAllFilter(void);
    virtual uint32_t GetFilteredMessages(void) const;
+   const C_OscComMessageLoggerFilterSet & GetCompiledFilter(void) const;
 
    // CAN bus handling
    virtual int32_t HandleCanMessage(const stw::can::T_STWCAN_Msg_RX & orc_Msg, const bool oq_IsTx);
@@ -122,6 +114,12 @@ protected:
                                           const stw::opensyde_core::C_OscCanSignal & orc_OscSignal,
                                           const stw::opensyde_core::C_OscNodeDataPoolContent & orc_OscValue,
                                           const float64_t of64_Factor, const float64_t of64_Offset);
+   static void mh_InterpretCanSignalValue(stw::opensyde_core::C_OscComMessageLoggerDataSignal & orc_Signal,
+                                          const stw::opensyde_core::C_OscCanMessageExtractionPlan & orc_Plan,
+                                          const uint32_t ou32_SignalIndex,
+                                          const stw::opensyde_core::C_OscCanSignal & orc_OscSignal,
+                                          const stw::opensyde_core::C_OscNodeDataPoolContent & orc_OscValue,
+                                          const float64_t of64_Factor, const float64_t of64_Offset);
 
    virtual stw::scl::C_SclString m_GetProtocolStringHexHook(void) const;
    virtual stw::scl::C_SclString m_GetProtocolStringDecHook(void) const;
@@ -144,8 +142,13 @@ private:
    C_OscComMessageLogger & operator =(const C_OscComMessageLogger &);
 
    void m_ConvertCanMessage(const stw::can::T_STWCAN_Msg_RX & orc_Msg, const bool oq_IsTx);
-   void m_InterpretSysDefCanSignal(C_OscComMessageLoggerData & orc_MessageData,
-                                   const C_OscCanSignal & orc_OscSignal) const;
+   void m_InterpretSysDefCanSignal(C_OscComMessageLoggerData & orc_MessageData, const C_OscCanSignal & orc_OscSignal,
+                                   const C_OscCanMessageExtractionPlan & orc_Plan,
+                                   const uint32_t ou32_SignalIndex) const;
+   static void mh_FormatCanSignalValue(C_OscComMessageLoggerDataSignal & orc_Signal,
+                                       const C_OscCanSignalExtraction & orc_Extraction, const uint64_t ou64_RawValue,
+                                       const C_OscNodeDataPoolContent & orc_OscValue, const float64_t of64_Factor,
+                                       const float64_t of64_Offset);
    void m_ResetCounter(void);
    static void mh_PostProcessSysDef(stw::opensyde_core::C_OscSystemDefinition & orc_SystemDefinition);
    static void mh_AddSpecialEcesSignals(C_OscNode & orc_Node, const C_OscCanMessageIdentificationIndices & orc_Id,
@@ -168,9 +171,13 @@ private:
 
    // Database interpretation
    std::map<stw::scl::C_SclString, C_OscComMessageLoggerOsySysDefConfig> mc_OsySysDefs;
+   // Compiled signal extraction per system definition message. Filled on first reception of a message.
+   // It is mutable because the interpretation functions are const.
+   mutable std::map<const C_OscCanMessage *, C_OscCanMessageExtractionPlan> mc_OsySysDefExtractionPlans;
 
    // Filtering
    std::vector<C_OscComMessageLoggerFilter> mc_CanFilterConfig;
+   C_OscComMessageLoggerFilterSet mc_CompiledCanFilter; // rebuilt on each change of mc_CanFilterConfig
    uint32_t mu32_FilteredMessages; //number of messages that did not pass the filter
 
    // Message counting
@@ -112,6 +112,54 @@ void C_OscComMessageLoggerData::SortSignals(void)
    std::sort(this->c_Signals.begin(), this->c_Signals.end());
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Update the string representations of the raw CAN message
+
+   Sets the CAN identifier, DLC, data bytes and time stamp strings based on c_CanMsg and the
+   numeric time stamps. All other members are not changed.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComMessageLoggerData::UpdateCanMessageStrings(void)
+{
+   this->c_CanIdDec = C_SclString::IntToStr(this->c_CanMsg.u32_ID);
+   this->c_CanIdHex = C_SclString::IntToHex(this->c_CanMsg.u32_ID, 1).UpperCase();
+   if (this->c_CanMsg.u8_XTD > 0U)
+   {
+      // Extended Id
+      this->c_CanIdDec += "x";
+      this->c_CanIdHex += "x";
+   }
+   this->c_CanDlc = C_SclString::IntToStr(this->c_CanMsg.u8_DLC);
+
+   this->c_CanDataDec = "";
+   this->c_CanDataHex = "";
+   for (uint8_t u8_DbCounter = 0U; u8_DbCounter < this->c_CanMsg.u8_DLC; ++u8_DbCounter)
+   {
+      if (this->c_CanMsg.au8_Data[u8_DbCounter] < 100)
+      {
+         this->c_CanDataDec += " ";
+         if (this->c_CanMsg.au8_Data[u8_DbCounter] < 10)
+         {
+            this->c_CanDataDec += " ";
+         }
+      }
+      this->c_CanDataDec += C_SclString::IntToStr(this->c_CanMsg.au8_Data[u8_DbCounter]);
+      this->c_CanDataHex += C_SclString::IntToHex(this->c_CanMsg.au8_Data[u8_DbCounter], 2).UpperCase();
+
+      if (u8_DbCounter < (this->c_CanMsg.u8_DLC - 1U))
+      {
+         this->c_CanDataDec += " ";
+         this->c_CanDataHex += " ";
+      }
+   }
+
+   this->c_TimeStampAbsoluteStart = C_OscComMessageLoggerData::h_GetTimestampAsString(
+      this->u64_TimeStampAbsoluteStart);
+   this->c_TimeStampAbsoluteTimeOfDay = C_OscComMessageLoggerData::h_GetTimestampAsString(
+      this->u64_TimeStampAbsoluteTimeOfDay);
+   this->c_TimeStampRelative = C_OscComMessageLoggerData::h_GetTimestampAsString(this->u64_TimeStampRelative);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Returns the timestamp as string
 
@@ -53,6 +53,7 @@ public:
    virtual ~C_OscComMessageLoggerData(void);
 
    void SortSignals(void);
+   void UpdateCanMessageStrings(void);
    static stw::scl::C_SclString h_GetTimestampAsString(const uint64_t ou64_TimeStamp);
 
    uint64_t u64_TimeStampRelative;
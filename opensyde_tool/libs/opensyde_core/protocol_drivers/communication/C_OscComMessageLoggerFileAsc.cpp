@@ -30,6 +30,7 @@ using namespace stw::tgl;
 using namespace stw::opensyde_core;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint32_t C_OscComMessageLoggerFileAsc::mhu32_WRITE_BUFFER_SIZE = 256U * 1024U;
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
@@ -58,18 +59,20 @@ C_OscComMessageLoggerFileAsc::C_OscComMessageLoggerFileAsc(const C_SclString & o
    mq_HexActive(oq_HexActive),
    mq_RelativeTimeStampActive(oq_RelativeTimeStampActive)
 {
+   this->mc_WriteBuffer.reserve(mhu32_WRITE_BUFFER_SIZE);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Default destructor
 
-   Writes the end line and closes the open file
+   Writes all buffered messages, the end line and closes the open file
 */
 //----------------------------------------------------------------------------------------------------------------------
 C_OscComMessageLoggerFileAsc::~C_OscComMessageLoggerFileAsc(void)
 {
    try
    {
+      this->m_StopWriter();
       if (this->mc_File.is_open() == true)
       {
          const C_SclString c_EndLine = "End TriggerBlock";
@@ -97,6 +100,9 @@ int32_t C_OscComMessageLoggerFileAsc::OpenFile(void)
 {
    int32_t s32_Return;
 
+   // Write the pending messages of the previous file
+   this->m_StopWriter();
+
    if (this->mc_File.is_open() == true)
    {
       // Close the file if it is open. The previous file will be deleted
@@ -124,129 +130,166 @@ int32_t C_OscComMessageLoggerFileAsc::OpenFile(void)
          // File was not created
          s32_Return = C_RD_WR;
       }
+      else
+      {
+         this->m_StartWriter();
+      }
    }
 
    return s32_Return;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-/*! \brief   Adding of a concrete CAN message to the log file
+/*! \brief   Writes a batch of buffered CAN messages to the log file
+
+   Called by the writer thread. All messages are formatted into one buffer which is written with one call.
 
-   \param[in]     orc_MessageData      Current CAN message
+   \param[in]  ou32_Count     Number of buffered CAN messages
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OscComMessageLoggerFileAsc::AddMessageToFile(const C_OscComMessageLoggerData & orc_MessageData)
+void C_OscComMessageLoggerFileAsc::m_WriteMessages(const uint32_t ou32_Count)
 {
    if (this->mc_File.is_open() == true)
    {
-      uint32_t u32_SignalCounter;
-      C_SclString c_LogEntry = "   ";
-      C_SclString c_Temp;
+      uint32_t u32_Counter;
+      C_SclString c_ProtocolName;
 
-      // Timestamp
-      if (this->mq_RelativeTimeStampActive == true)
+      this->mc_WriteBuffer.clear();
+      for (u32_Counter = 0U; u32_Counter < ou32_Count; ++u32_Counter)
       {
-         c_LogEntry += mh_AdaptTimeStamp(orc_MessageData.u64_TimeStampRelative);
-      }
-      else
-      {
-         c_LogEntry += mh_AdaptTimeStamp(orc_MessageData.u64_TimeStampAbsoluteStart);
+         const C_OscComMessageLoggerData & rc_Message = this->m_GetBufferedMessage(u32_Counter, c_ProtocolName);
+         this->m_FormatMessage(rc_Message, c_ProtocolName, this->mc_WriteBuffer);
+
+         if (this->mc_WriteBuffer.size() >= mhu32_WRITE_BUFFER_SIZE)
+         {
+            this->mc_File.write(this->mc_WriteBuffer.c_str(), this->mc_WriteBuffer.size());
+            this->mc_WriteBuffer.clear();
+         }
       }
+      this->mc_File.write(this->mc_WriteBuffer.c_str(), this->mc_WriteBuffer.size());
+      this->mc_File.flush();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Formats a concrete CAN message for the log file
+
+   \param[in]      orc_MessageData      Current CAN message
+   \param[in]      orc_ProtocolName     Protocol name set when the message was logged
+   \param[in,out]  orc_Output           Buffer the formatted entry is appended to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComMessageLoggerFileAsc::m_FormatMessage(const C_OscComMessageLoggerData & orc_MessageData,
+                                                   const C_SclString & orc_ProtocolName,
+                                                   std::string & orc_Output) const
+{
+   uint32_t u32_SignalCounter;
+   C_SclString c_LogEntry = "   ";
+   C_SclString c_Temp;
+
+   // Timestamp
+   if (this->mq_RelativeTimeStampActive == true)
+   {
+      c_LogEntry += mh_AdaptTimeStamp(orc_MessageData.u64_TimeStampRelative);
+   }
+   else
+   {
+      c_LogEntry += mh_AdaptTimeStamp(orc_MessageData.u64_TimeStampAbsoluteStart);
+   }
 
-      // Channel
-      c_LogEntry += " 1 ";
+   // Channel
+   c_LogEntry += " 1 ";
 
-      // CAN Id
-      // ASC specification defines a width of fixed 15 chars for CAN Id. Plus one for the space to the direction
+   // CAN Id
+   // ASC specification defines a width of fixed 15 chars for CAN Id. Plus one for the space to the direction
+   if (this->mq_HexActive == true)
+   {
+      c_Temp.PrintFormatted("%-16s", orc_MessageData.c_CanIdHex.c_str());
+   }
+   else
+   {
+      c_Temp.PrintFormatted("%-16s", orc_MessageData.c_CanIdDec.c_str());
+   }
+   c_LogEntry += c_Temp;
+
+   // Direction
+   // ASC specification defines a width of fixed 4 chars for direction. Plus one for the space to the next section
+   if (orc_MessageData.q_IsTx == false)
+   {
+      c_LogEntry += "Rx   ";
+   }
+   else
+   {
+      c_LogEntry += "Tx   ";
+   }
+
+   // Special case RTR
+   if (orc_MessageData.c_CanMsg.u8_RTR > 0U)
+   {
+      c_LogEntry += "r";
+   }
+   else
+   {
+      // DLC and data
+      c_LogEntry += "d " + orc_MessageData.c_CanDlc + " ";
       if (this->mq_HexActive == true)
       {
-         c_Temp.PrintFormatted("%-16s", orc_MessageData.c_CanIdHex.c_str());
+         c_LogEntry += orc_MessageData.c_CanDataHex;
       }
       else
       {
-         c_Temp.PrintFormatted("%-16s", orc_MessageData.c_CanIdDec.c_str());
+         c_LogEntry += orc_MessageData.c_CanDataDec;
       }
-      c_LogEntry += c_Temp;
+   }
 
-      // Direction
-      // ASC specification defines a width of fixed 4 chars for direction. Plus one for the space to the next section
-      if (orc_MessageData.q_IsTx == false)
-      {
-         c_LogEntry += "Rx   ";
-      }
-      else
-      {
-         c_LogEntry += "Tx   ";
-      }
+   // State for specified message flags are not known here
+   c_LogEntry += "\n";
 
-      // Special case RTR
-      if (orc_MessageData.c_CanMsg.u8_RTR > 0U)
+   // Protocol interpretation
+   if (orc_MessageData.c_ProtocolTextDec != "")
+   {
+      c_LogEntry += "   //" + orc_ProtocolName + " ";
+      if (this->mq_HexActive == true)
       {
-         c_LogEntry += "r";
+         c_LogEntry += orc_MessageData.c_ProtocolTextHex;
       }
       else
       {
-         // DLC and data
-         c_LogEntry += "d " + orc_MessageData.c_CanDlc + " ";
-         if (this->mq_HexActive == true)
-         {
-            c_LogEntry += orc_MessageData.c_CanDataHex;
-         }
-         else
-         {
-            c_LogEntry += orc_MessageData.c_CanDataDec;
-         }
+         c_LogEntry += orc_MessageData.c_ProtocolTextDec;
       }
-
-      // State for specified message flags are not known here
       c_LogEntry += "\n";
+   }
 
-      // Protocol interpretation
-      if (orc_MessageData.c_ProtocolTextDec != "")
-      {
-         c_LogEntry += "   //" + this->mc_ProtocolName + " ";
-         if (this->mq_HexActive == true)
-         {
-            c_LogEntry += orc_MessageData.c_ProtocolTextHex;
-         }
-         else
-         {
-            c_LogEntry += orc_MessageData.c_ProtocolTextDec;
-         }
-         c_LogEntry += "\n";
-      }
+   // Message information
+   if (orc_MessageData.c_Name != "")
+   {
+      c_LogEntry += "   //Message  " + orc_MessageData.c_Name;
 
-      // Message information
-      if (orc_MessageData.c_Name != "")
+      if (orc_MessageData.q_CanDlcError == true)
       {
-         c_LogEntry += "   //Message  " + orc_MessageData.c_Name;
-
-         if (orc_MessageData.q_CanDlcError == true)
-         {
-            c_LogEntry += " (DLC error)";
-         }
-         c_LogEntry += "\n";
+         c_LogEntry += " (DLC error)";
       }
+      c_LogEntry += "\n";
+   }
 
-      // Detected signals
-      for (u32_SignalCounter = 0U; u32_SignalCounter < orc_MessageData.c_Signals.size(); u32_SignalCounter++)
-      {
-         const C_OscComMessageLoggerDataSignal & rc_Signal = orc_MessageData.c_Signals[u32_SignalCounter];
-         c_LogEntry += "   //Signal   " + rc_Signal.c_Name + " = " + rc_Signal.c_Value;
-         if (rc_Signal.c_Unit != "")
-         {
-            c_LogEntry += " " + rc_Signal.c_Unit;
-         }
-         c_LogEntry += "\n";
-      }
-      if (orc_MessageData.c_Status != "")
+   // Detected signals
+   for (u32_SignalCounter = 0U; u32_SignalCounter < orc_MessageData.c_Signals.size(); u32_SignalCounter++)
+   {
+      const C_OscComMessageLoggerDataSignal & rc_Signal = orc_MessageData.c_Signals[u32_SignalCounter];
+      c_LogEntry += "   //Signal   " + rc_Signal.c_Name + " = " + rc_Signal.c_Value;
+      if (rc_Signal.c_Unit != "")
       {
-         c_LogEntry += "   //Status  " + orc_MessageData.c_Status;
-         c_LogEntry += "\n";
+         c_LogEntry += " " + rc_Signal.c_Unit;
       }
-
-      this->mc_File.write(c_LogEntry.c_str(), c_LogEntry.Length());
+      c_LogEntry += "\n";
    }
+   if (orc_MessageData.c_Status != "")
+   {
+      c_LogEntry += "   //Status  " + orc_MessageData.c_Status;
+      c_LogEntry += "\n";
+   }
+
+   orc_Output.append(c_LogEntry.c_str(), c_LogEntry.Length());
 }
 
 //----------------------------------------------------------------------------------------------------------------------
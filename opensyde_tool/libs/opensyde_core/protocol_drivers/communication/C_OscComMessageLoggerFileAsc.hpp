@@ -13,6 +13,7 @@
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include <fstream>
+#include <string>
 
 #include "C_SclString.hpp"
 
@@ -37,7 +38,9 @@ public:
    virtual ~C_OscComMessageLoggerFileAsc(void);
 
    virtual int32_t OpenFile(void);
-   virtual void AddMessageToFile(const C_OscComMessageLoggerData & orc_MessageData);
+
+protected:
+   virtual void m_WriteMessages(const uint32_t ou32_Count);
 
 private:
    //Avoid call
@@ -45,6 +48,8 @@ private:
    C_OscComMessageLoggerFileAsc & operator =(const C_OscComMessageLoggerFileAsc &);
 
    void m_WriteHeader(void);
+   void m_FormatMessage(const C_OscComMessageLoggerData & orc_MessageData,
+                        const stw::scl::C_SclString & orc_ProtocolName, std::string & orc_Output) const;
    static stw::scl::C_SclString mh_GetAscTimeString(void);
    static stw::scl::C_SclString mh_GetDay(const int32_t os32_Day);
    static stw::scl::C_SclString mh_GetMonth(const int32_t os32_Month);
@@ -53,6 +58,9 @@ private:
    const bool mq_HexActive;
    const bool mq_RelativeTimeStampActive;
    std::ofstream mc_File;
+   std::string mc_WriteBuffer; ///< Formatted batch; only accessed by the writer thread
+
+   static const uint32_t mhu32_WRITE_BUFFER_SIZE;
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
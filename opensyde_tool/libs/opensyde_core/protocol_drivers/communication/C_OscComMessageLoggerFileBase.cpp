@@ -11,6 +11,7 @@
 #include "precomp_headers.hpp"
 
 #include <cstdio>
+#include <cstring>
 
 #include "stwtypes.hpp"
 #include "stwerrors.hpp"
@@ -26,6 +27,11 @@ using namespace stw::tgl;
 using namespace stw::opensyde_core;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint32_t C_OscComMessageLoggerFileBase::hu32_BUFFER_SIZE = 2048U;
+const uint32_t C_OscComMessageLoggerFileBase::mhu32_BATCH_TIMEOUT_MS = 20U;
+const uint32_t C_OscComMessageLoggerFileBase::mhu32_WAIT_TIMEOUT_MS = 100U;
+const uint32_t C_OscComMessageLoggerFileBase::mhu32_TEXT_BUFFER_SIZE = 256U * 1024U;
+const uint32_t C_OscComMessageLoggerFileBase::mhu32_NO_TEXT = 0xFFFFFFFFU;
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
@@ -37,6 +43,33 @@ using namespace stw::opensyde_core;
 
 /* -- Implementation ------------------------------------------------------------------------------------------------ */
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscComMessageLoggerFileStatistics::C_OscComMessageLoggerFileStatistics(void) :
+   u64_MessagesWritten(0ULL),
+   u64_MessagesDropped(0ULL),
+   u32_MaxBufferLevel(0U),
+   u32_WriteBatches(0U),
+   u32_ProducerBlocks(0U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+
+   Allocates the entries and the text buffer, so the CAN thread only copies into existing memory.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscComMessageLoggerFileBase::C_Buffer::C_Buffer(void) :
+   u32_Count(0U),
+   u32_ProtocolNameIndex(mhu32_NO_TEXT)
+{
+   this->c_Entries.resize(hu32_BUFFER_SIZE);
+   this->c_Texts.reserve(mhu32_TEXT_BUFFER_SIZE);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Default constructor
 
@@ -47,16 +80,34 @@ using namespace stw::opensyde_core;
 C_OscComMessageLoggerFileBase::C_OscComMessageLoggerFileBase(const stw::scl::C_SclString & orc_FilePath,
                                                              const C_SclString & orc_ProtocolName) :
    mc_FilePath(orc_FilePath),
-   mc_ProtocolName(orc_ProtocolName)
+   mq_RawFramesOnly(false),
+   mu32_FrontBuffer(0U),
+   mc_ProtocolName(orc_ProtocolName),
+   mq_WriterRunning(false),
+   mq_StopRequested(false),
+   mq_FlushRequested(false),
+   mq_WriterBusy(false),
+   me_OverflowMode(eOVERFLOW_DROP)
 {
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Default destructor
+
+   Derived classes must call m_StopWriter in their own destructor,
+   as the writer thread calls the derived implementation of m_WriteMessages.
 */
 //----------------------------------------------------------------------------------------------------------------------
 C_OscComMessageLoggerFileBase::~C_OscComMessageLoggerFileBase(void)
 {
+   try
+   {
+      this->m_StopWriter();
+   }
+   catch (...)
+   {
+      //not much we can do here ...
+   }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -103,10 +154,512 @@ int32_t C_OscComMessageLoggerFileBase::OpenFile(void)
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Sets the current protocol name
 
+   Already buffered messages keep the protocol name that was set when they were added.
+
    \param[in]     orc_ProtocolName         Current protocol name
 */
 //----------------------------------------------------------------------------------------------------------------------
 void C_OscComMessageLoggerFileBase::SetProtocolName(const C_SclString & orc_ProtocolName)
 {
+   this->mc_BufferLock.Acquire();
    this->mc_ProtocolName = orc_ProtocolName;
+   // The next message with protocol interpretation adds the new name to the front buffer
+   this->mac_Buffers[this->mu32_FrontBuffer].u32_ProtocolNameIndex = mhu32_NO_TEXT;
+   this->mc_BufferLock.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Adding of a concrete CAN message to the log file
+
+   Only the raw CAN frame, the time stamps and the texts of the interpretation are copied into the front buffer.
+   The strings of the log entry are created and written by the writer thread.
+   If the entries or the text buffer are full the message is dropped or the caller waits, depending on the
+   overflow mode. Messages with more text than the complete text buffer can hold are always dropped.
+
+   \param[in]     orc_MessageData      Current CAN message
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComMessageLoggerFileBase::AddMessageToFile(const C_OscComMessageLoggerData & orc_MessageData)
+{
+   this->mc_BufferLock.Acquire();
+
+   if (this->mq_WriterRunning == true)
+   {
+      const uint32_t u32_TextSize = this->m_GetTextSize(orc_MessageData);
+      bool q_Add = true;
+
+      if (u32_TextSize > mhu32_TEXT_BUFFER_SIZE)
+      {
+         ++this->mc_Statistics.u64_MessagesDropped;
+         q_Add = false;
+      }
+      else if (mh_HasSpace(this->mac_Buffers[this->mu32_FrontBuffer], u32_TextSize) == false)
+      {
+         if (this->me_OverflowMode == eOVERFLOW_BLOCK)
+         {
+            ++this->mc_Statistics.u32_ProducerBlocks;
+            this->mc_DataAvailable.Signal();
+            while ((mh_HasSpace(this->mac_Buffers[this->mu32_FrontBuffer], u32_TextSize) == false) &&
+                   (this->mq_WriterRunning == true))
+            {
+               this->m_WaitForEvent(this->mc_SpaceAvailable, mhu32_WAIT_TIMEOUT_MS);
+            }
+            q_Add = this->mq_WriterRunning;
+         }
+         else
+         {
+            ++this->mc_Statistics.u64_MessagesDropped;
+            q_Add = false;
+         }
+      }
+      else
+      {
+         //Space available
+      }
+
+      if (q_Add == true)
+      {
+         C_Buffer & rc_Buffer = this->mac_Buffers[this->mu32_FrontBuffer];
+         const uint32_t u32_PreviousTextSize = static_cast<uint32_t>(rc_Buffer.c_Texts.size());
+
+         this->m_CopyToBuffer(orc_MessageData, rc_Buffer);
+
+         if (rc_Buffer.u32_Count > this->mc_Statistics.u32_MaxBufferLevel)
+         {
+            this->mc_Statistics.u32_MaxBufferLevel = rc_Buffer.u32_Count;
+         }
+
+         // Only wake the writer for the first message of a batch and when the entries or texts are big enough
+         if ((rc_Buffer.u32_Count == 1U) || (rc_Buffer.u32_Count == (hu32_BUFFER_SIZE / 2U)) ||
+             ((u32_PreviousTextSize < (mhu32_TEXT_BUFFER_SIZE / 2U)) &&
+              (rc_Buffer.c_Texts.size() >= (mhu32_TEXT_BUFFER_SIZE / 2U))))
+         {
+            this->mc_DataAvailable.Signal();
+         }
+      }
+   }
+
+   this->mc_BufferLock.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Waits till all buffered messages are handed to the file
+
+   Returns immediately if the writer thread is not running.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComMessageLoggerFileBase::Flush(void)
+{
+   this->mc_BufferLock.Acquire();
+
+   if (this->mq_WriterRunning == true)
+   {
+      this->mq_FlushRequested = true;
+      this->mc_DataAvailable.Signal();
+      while (((this->mac_Buffers[this->mu32_FrontBuffer].u32_Count > 0U) || (this->mq_WriterBusy == true)) &&
+             (this->mq_WriterRunning == true))
+      {
+         this->m_WaitForEvent(this->mc_SpaceAvailable, mhu32_WAIT_TIMEOUT_MS);
+      }
+      this->mq_FlushRequested = false;
+   }
+
+   this->mc_BufferLock.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Sets the behavior for a full buffer
+
+   \param[in]  oe_Mode  Overflow mode
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComMessageLoggerFileBase::SetOverflowMode(const E_OverflowMode oe_Mode)
+{
+   this->mc_BufferLock.Acquire();
+   this->me_OverflowMode = oe_Mode;
+   this->mc_BufferLock.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Returns the current writer statistics
+
+   \return
+   Copy of statistics
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscComMessageLoggerFileStatistics C_OscComMessageLoggerFileBase::GetStatistics(void)
+{
+   C_OscComMessageLoggerFileStatistics c_Return;
+
+   this->mc_BufferLock.Acquire();
+   c_Return = this->mc_Statistics;
+   this->mc_BufferLock.Release();
+
+   return c_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Starts the writer thread
+
+   To be called by derived classes after the file was opened successfully.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComMessageLoggerFileBase::m_StartWriter(void)
+{
+   this->mc_BufferLock.Acquire();
+
+   if (this->mq_WriterRunning == false)
+   {
+      this->mq_StopRequested = false;
+      this->mq_WriterRunning = true;
+      // The thread waits for the lock, so it sees the flags set above
+      if (this->mc_WriterThread.Start(&C_OscComMessageLoggerFileBase::mh_WriterThread, this) != C_NO_ERR)
+      {
+         this->mq_WriterRunning = false;
+      }
+   }
+
+   this->mc_BufferLock.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Stops the writer thread
+
+   All buffered messages are written before the thread finishes.
+   To be called by derived classes before the file is closed.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComMessageLoggerFileBase::m_StopWriter(void)
+{
+   uint32_t u32_Counter;
+
+   this->mc_BufferLock.Acquire();
+   this->mq_StopRequested = true;
+   this->mc_DataAvailable.Signal();
+   this->mc_BufferLock.Release();
+
+   this->mc_WriterThread.WaitForFinish();
+
+   this->mc_BufferLock.Acquire();
+   this->mq_WriterRunning = false;
+   for (u32_Counter = 0U; u32_Counter < 2U; ++u32_Counter)
+   {
+      this->mac_Buffers[u32_Counter].u32_Count = 0U;
+      this->mac_Buffers[u32_Counter].c_Texts.clear();
+      this->mac_Buffers[u32_Counter].u32_ProtocolNameIndex = mhu32_NO_TEXT;
+   }
+   this->mc_SpaceAvailable.Signal();
+   this->mc_BufferLock.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Returns a message of the back buffer
+
+   Only to be called by the writer thread from m_WriteMessages.
+   The strings of the CAN frame and the time stamps are created here;
+   they are not created when only raw frames are buffered.
+   The returned reference is valid until the next call.
+
+   \param[in]   ou32_Index         Index of the message in the current batch
+   \param[out]  orc_ProtocolName   Protocol name set when the message was added; empty if there is no interpretation
+
+   \return
+   Rebuilt message
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_OscComMessageLoggerData & C_OscComMessageLoggerFileBase::m_GetBufferedMessage(const uint32_t ou32_Index,
+                                                                                     C_SclString & orc_ProtocolName)
+{
+   // Only the writer thread changes the front buffer index, so reading it here without lock is safe
+   const C_Buffer & rc_Buffer = this->mac_Buffers[1U - this->mu32_FrontBuffer];
+   const C_Entry & rc_Entry = rc_Buffer.c_Entries[ou32_Index];
+   C_OscComMessageLoggerData & rc_Message = this->mc_WriterMessage;
+
+   rc_Message.c_CanMsg = rc_Entry.c_CanMsg;
+   rc_Message.q_IsTx = rc_Entry.q_IsTx;
+   rc_Message.q_CanDlcError = rc_Entry.q_CanDlcError;
+   rc_Message.u64_TimeStampRelative = rc_Entry.u64_TimeStampRelative;
+   rc_Message.u64_TimeStampAbsoluteStart = rc_Entry.u64_TimeStampAbsoluteStart;
+   rc_Message.u64_TimeStampAbsoluteTimeOfDay = rc_Entry.u64_TimeStampAbsoluteTimeOfDay;
+
+   if (this->mq_RawFramesOnly == false)
+   {
+      rc_Message.UpdateCanMessageStrings();
+   }
+
+   if (rc_Entry.u32_ProtocolNameIndex != mhu32_NO_TEXT)
+   {
+      uint32_t u32_TextIndex = rc_Entry.u32_ProtocolNameIndex;
+      orc_ProtocolName = mh_GetNextText(rc_Buffer.c_Texts, u32_TextIndex);
+   }
+   else
+   {
+      orc_ProtocolName = "";
+   }
+
+   if (rc_Entry.u32_TextIndex != mhu32_NO_TEXT)
+   {
+      uint32_t u32_TextIndex = rc_Entry.u32_TextIndex;
+      uint32_t u32_Signal;
+
+      // Same order as in m_CopyToBuffer
+      rc_Message.c_ProtocolTextDec = mh_GetNextText(rc_Buffer.c_Texts, u32_TextIndex);
+      rc_Message.c_ProtocolTextHex = mh_GetNextText(rc_Buffer.c_Texts, u32_TextIndex);
+      rc_Message.c_Name = mh_GetNextText(rc_Buffer.c_Texts, u32_TextIndex);
+      rc_Message.c_Status = mh_GetNextText(rc_Buffer.c_Texts, u32_TextIndex);
+      rc_Message.c_Signals.resize(rc_Entry.u32_SignalCount);
+      for (u32_Signal = 0U; u32_Signal < rc_Entry.u32_SignalCount; ++u32_Signal)
+      {
+         C_OscComMessageLoggerDataSignal & rc_Signal = rc_Message.c_Signals[u32_Signal];
+         rc_Signal.c_Name = mh_GetNextText(rc_Buffer.c_Texts, u32_TextIndex);
+         rc_Signal.c_Value = mh_GetNextText(rc_Buffer.c_Texts, u32_TextIndex);
+         rc_Signal.c_Unit = mh_GetNextText(rc_Buffer.c_Texts, u32_TextIndex);
+      }
+   }
+   else
+   {
+      rc_Message.c_ProtocolTextDec = "";
+      rc_Message.c_ProtocolTextHex = "";
+      rc_Message.c_Name = "";
+      rc_Message.c_Status = "";
+      rc_Message.c_Signals.clear();
+   }
+
+   return rc_Message;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Thread function of the writer thread
+
+   \param[in]  opv_Instance   Instance of C_OscComMessageLoggerFileBase
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComMessageLoggerFileBase::mh_WriterThread(void * const opv_Instance)
+{
+   //lint -e{9079}  Result of generic interface
+   C_OscComMessageLoggerFileBase * const pc_Instance = reinterpret_cast<C_OscComMessageLoggerFileBase *>(opv_Instance);
+
+   pc_Instance->m_WriterThread();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Writer thread function
+
+   Swaps front and back buffer and hands the back buffer to m_WriteMessages outside of the lock.
+   Small batches are held back for a short time to get larger sequential writes.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComMessageLoggerFileBase::m_WriterThread(void)
+{
+   this->mc_BufferLock.Acquire();
+
+   while ((this->mq_StopRequested == false) || (this->mac_Buffers[this->mu32_FrontBuffer].u32_Count > 0U))
+   {
+      uint32_t u32_Count;
+
+      while ((this->mac_Buffers[this->mu32_FrontBuffer].u32_Count == 0U) && (this->mq_StopRequested == false))
+      {
+         this->m_WaitForEvent(this->mc_DataAvailable, mhu32_WAIT_TIMEOUT_MS);
+      }
+      if ((this->mac_Buffers[this->mu32_FrontBuffer].u32_Count < (hu32_BUFFER_SIZE / 2U)) &&
+          (this->mac_Buffers[this->mu32_FrontBuffer].c_Texts.size() < (mhu32_TEXT_BUFFER_SIZE / 2U)) &&
+          (this->mq_StopRequested == false) && (this->mq_FlushRequested == false))
+      {
+         this->m_WaitForEvent(this->mc_DataAvailable, mhu32_BATCH_TIMEOUT_MS);
+      }
+
+      u32_Count = this->mac_Buffers[this->mu32_FrontBuffer].u32_Count;
+      if (u32_Count > 0U)
+      {
+         C_Buffer & rc_NewFront = this->mac_Buffers[1U - this->mu32_FrontBuffer];
+
+         // The previous back buffer was completely written, so it can be reused as front buffer
+         rc_NewFront.u32_Count = 0U;
+         rc_NewFront.c_Texts.clear();
+         rc_NewFront.u32_ProtocolNameIndex = mhu32_NO_TEXT;
+         this->mu32_FrontBuffer = 1U - this->mu32_FrontBuffer;
+         this->mq_WriterBusy = true;
+         this->mc_SpaceAvailable.Signal();
+
+         this->mc_BufferLock.Release();
+         try
+         {
+            this->m_WriteMessages(u32_Count);
+         }
+         catch (...)
+         {
+            //not much we can do here, keep the thread alive for the next batch
+         }
+         this->mc_BufferLock.Acquire();
+
+         this->mq_WriterBusy = false;
+         this->mc_Statistics.u64_MessagesWritten += u32_Count;
+         ++this->mc_Statistics.u32_WriteBatches;
+         this->mc_SpaceAvailable.Signal();
+      }
+   }
+
+   this->mc_BufferLock.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Waits for an event with released buffer lock
+
+   Has to be called with acquired buffer lock; the lock is acquired again before returning.
+   The timeout is a backstop only, the conditions have to be checked by the caller again.
+
+   \param[in,out]  orc_Event        Event to wait for
+   \param[in]      ou32_TimeoutMs   Maximum time to wait in milliseconds
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComMessageLoggerFileBase::m_WaitForEvent(C_TglEvent & orc_Event, const uint32_t ou32_TimeoutMs)
+{
+   this->mc_BufferLock.Release();
+   orc_Event.Wait(ou32_TimeoutMs);
+   this->mc_BufferLock.Acquire();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Returns the size a message needs in the text buffer
+
+   Includes the protocol name, even if it is already stored in the buffer.
+
+   \param[in]  orc_MessageData   Current CAN message
+
+   \return
+   Number of characters including the terminating '\0' of each text
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscComMessageLoggerFileBase::m_GetTextSize(const C_OscComMessageLoggerData & orc_MessageData) const
+{
+   uint32_t u32_Size = 0U;
+
+   if (this->mq_RawFramesOnly == false)
+   {
+      uint32_t u32_Signal;
+
+      u32_Size = orc_MessageData.c_ProtocolTextDec.Length() + orc_MessageData.c_ProtocolTextHex.Length() +
+                 orc_MessageData.c_Name.Length() + orc_MessageData.c_Status.Length() + 4U;
+      if (orc_MessageData.c_ProtocolTextDec != "")
+      {
+         u32_Size += this->mc_ProtocolName.Length() + 1U;
+      }
+      for (u32_Signal = 0U; u32_Signal < orc_MessageData.c_Signals.size(); ++u32_Signal)
+      {
+         const C_OscComMessageLoggerDataSignal & rc_Signal = orc_MessageData.c_Signals[u32_Signal];
+         u32_Size += rc_Signal.c_Name.Length() + rc_Signal.c_Value.Length() + rc_Signal.c_Unit.Length() + 3U;
+      }
+   }
+   return u32_Size;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Checks if a buffer has a free entry and enough free text space for a message
+
+   The text buffer never grows beyond its preallocated size, so adding never allocates.
+
+   \param[in]  orc_Buffer      Buffer to check
+   \param[in]  ou32_TextSize   Text size of the message (see m_GetTextSize)
+
+   \return
+   true     message fits
+   false    buffer full
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscComMessageLoggerFileBase::mh_HasSpace(const C_Buffer & orc_Buffer, const uint32_t ou32_TextSize)
+{
+   return (orc_Buffer.u32_Count < hu32_BUFFER_SIZE) &&
+          ((orc_Buffer.c_Texts.size() + ou32_TextSize) <= mhu32_TEXT_BUFFER_SIZE);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Copies a message into the next free entry of a buffer
+
+   Only the characters of the interpretation are copied into the preallocated text buffer;
+   no strings are created per message.
+
+   \param[in]      orc_MessageData   Current CAN message
+   \param[in,out]  orc_Buffer        Front buffer with a free entry and enough text space (see mh_HasSpace)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComMessageLoggerFileBase::m_CopyToBuffer(const C_OscComMessageLoggerData & orc_MessageData,
+                                                   C_Buffer & orc_Buffer)
+{
+   C_Entry & rc_Entry = orc_Buffer.c_Entries[orc_Buffer.u32_Count];
+
+   rc_Entry.c_CanMsg = orc_MessageData.c_CanMsg;
+   rc_Entry.q_IsTx = orc_MessageData.q_IsTx;
+   rc_Entry.q_CanDlcError = orc_MessageData.q_CanDlcError;
+   rc_Entry.u64_TimeStampRelative = orc_MessageData.u64_TimeStampRelative;
+   rc_Entry.u64_TimeStampAbsoluteStart = orc_MessageData.u64_TimeStampAbsoluteStart;
+   rc_Entry.u64_TimeStampAbsoluteTimeOfDay = orc_MessageData.u64_TimeStampAbsoluteTimeOfDay;
+   rc_Entry.u32_TextIndex = mhu32_NO_TEXT;
+   rc_Entry.u32_SignalCount = 0U;
+   rc_Entry.u32_ProtocolNameIndex = mhu32_NO_TEXT;
+
+   if ((this->mq_RawFramesOnly == false) &&
+       ((orc_MessageData.c_ProtocolTextDec != "") || (orc_MessageData.c_ProtocolTextHex != "") ||
+        (orc_MessageData.c_Name != "") || (orc_MessageData.c_Status != "") ||
+        (orc_MessageData.c_Signals.empty() == false)))
+   {
+      uint32_t u32_Signal;
+
+      if (orc_MessageData.c_ProtocolTextDec != "")
+      {
+         // The protocol name is only stored once per buffer
+         if (orc_Buffer.u32_ProtocolNameIndex == mhu32_NO_TEXT)
+         {
+            orc_Buffer.u32_ProtocolNameIndex = static_cast<uint32_t>(orc_Buffer.c_Texts.size());
+            mh_AppendText(this->mc_ProtocolName, orc_Buffer.c_Texts);
+         }
+         rc_Entry.u32_ProtocolNameIndex = orc_Buffer.u32_ProtocolNameIndex;
+      }
+
+      rc_Entry.u32_TextIndex = static_cast<uint32_t>(orc_Buffer.c_Texts.size());
+      rc_Entry.u32_SignalCount = static_cast<uint32_t>(orc_MessageData.c_Signals.size());
+      mh_AppendText(orc_MessageData.c_ProtocolTextDec, orc_Buffer.c_Texts);
+      mh_AppendText(orc_MessageData.c_ProtocolTextHex, orc_Buffer.c_Texts);
+      mh_AppendText(orc_MessageData.c_Name, orc_Buffer.c_Texts);
+      mh_AppendText(orc_MessageData.c_Status, orc_Buffer.c_Texts);
+      for (u32_Signal = 0U; u32_Signal < orc_MessageData.c_Signals.size(); ++u32_Signal)
+      {
+         const C_OscComMessageLoggerDataSignal & rc_Signal = orc_MessageData.c_Signals[u32_Signal];
+         mh_AppendText(rc_Signal.c_Name, orc_Buffer.c_Texts);
+         mh_AppendText(rc_Signal.c_Value, orc_Buffer.c_Texts);
+         mh_AppendText(rc_Signal.c_Unit, orc_Buffer.c_Texts);
+      }
+   }
+
+   ++orc_Buffer.u32_Count;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Appends a text terminated by '\0' to the text buffer
+
+   \param[in]      orc_Text    Text to append
+   \param[in,out]  orc_Texts   Text buffer
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComMessageLoggerFileBase::mh_AppendText(const C_SclString & orc_Text, std::string & orc_Texts)
+{
+   orc_Texts.append(orc_Text.c_str(), orc_Text.Length());
+   orc_Texts.push_back('\0');
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Returns a text of the text buffer and moves the index to the following text
+
+   \param[in]      orc_Texts     Text buffer
+   \param[in,out]  oru32_Index   Position of the text; position of the following text after the call
+
+   \return
+   Text terminated by '\0'
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const char_t * C_OscComMessageLoggerFileBase::mh_GetNextText(const std::string & orc_Texts, uint32_t & oru32_Index)
+{
+   const char_t * const pcn_Text = &orc_Texts[oru32_Index];
+
+   oru32_Index += static_cast<uint32_t>(std::strlen(pcn_Text)) + 1U;
+   return pcn_Text;
 }
@@ -12,7 +12,11 @@
 #define C_OSCCOMMESSAGELOGGERFILEBASE_HPP
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
+#include <string>
+
 #include "stwtypes.hpp"
+#include "TglTasks.hpp"
 #include "C_OscComMessageLoggerData.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
@@ -24,25 +28,115 @@ namespace opensyde_core
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
+class C_OscComMessageLoggerFileStatistics
+{
+public:
+   C_OscComMessageLoggerFileStatistics(void);
+
+   uint64_t u64_MessagesWritten;  ///< Number of messages handed to the file by the writer thread
+   uint64_t u64_MessagesDropped;  ///< Number of messages dropped because the buffer was full
+   uint32_t u32_MaxBufferLevel;   ///< Highest number of messages waiting in the buffer at one time
+   uint32_t u32_WriteBatches;     ///< Number of batches written by the writer thread
+   uint32_t u32_ProducerBlocks;   ///< Number of times the producer had to wait for free buffer space
+};
+
 class C_OscComMessageLoggerFileBase
 {
 public:
+   enum E_OverflowMode
+   {
+      eOVERFLOW_DROP, ///< Drop new messages if the buffer is full (never stall the CAN thread)
+      eOVERFLOW_BLOCK ///< Wait for the writer thread if the buffer is full (lossless)
+   };
+
    C_OscComMessageLoggerFileBase(const stw::scl::C_SclString & orc_FilePath,
                                  const stw::scl::C_SclString & orc_ProtocolName);
    virtual ~C_OscComMessageLoggerFileBase(void);
 
    virtual int32_t OpenFile(void);
-   virtual void AddMessageToFile(const C_OscComMessageLoggerData & orc_MessageData) = 0;
+   virtual void AddMessageToFile(const C_OscComMessageLoggerData & orc_MessageData);
+   void Flush(void);
 
    void SetProtocolName(const stw::scl::C_SclString & orc_ProtocolName);
+   void SetOverflowMode(const E_OverflowMode oe_Mode);
+   C_OscComMessageLoggerFileStatistics GetStatistics(void);
+
+   static const uint32_t hu32_BUFFER_SIZE;
 
 protected:
+   void m_StartWriter(void);
+   void m_StopWriter(void);
+
+   //Called by the writer thread with the number of buffered messages; read them with m_GetBufferedMessage
+   virtual void m_WriteMessages(const uint32_t ou32_Count) = 0;
+   const C_OscComMessageLoggerData & m_GetBufferedMessage(const uint32_t ou32_Index,
+                                                          stw::scl::C_SclString & orc_ProtocolName);
+
    stw::scl::C_SclString mc_FilePath;
-   stw::scl::C_SclString mc_ProtocolName;
+   bool mq_RawFramesOnly; ///< true: only CAN frame, direction and timestamps are buffered (no interpretation)
 
 private:
    //Avoid call
    C_OscComMessageLoggerFileBase(const C_OscComMessageLoggerFileBase &);
+   C_OscComMessageLoggerFileBase & operator =(const C_OscComMessageLoggerFileBase &);
+
+   ///Buffered message: raw CAN frame and time stamps; the interpretation is stored in the text buffer
+   class C_Entry
+   {
+   public:
+      stw::can::T_STWCAN_Msg_RX c_CanMsg;
+      uint64_t u64_TimeStampRelative;
+      uint64_t u64_TimeStampAbsoluteStart;
+      uint64_t u64_TimeStampAbsoluteTimeOfDay;
+      uint32_t u32_TextIndex;         ///< Position of the interpretation texts; mhu32_NO_TEXT if none
+      uint32_t u32_SignalCount;       ///< Number of signal texts following the message texts
+      uint32_t u32_ProtocolNameIndex; ///< Position of the protocol name; mhu32_NO_TEXT if none
+      bool q_IsTx;
+      bool q_CanDlcError;
+   };
+
+   ///One half of the double buffer; all memory is allocated once and reused
+   class C_Buffer
+   {
+   public:
+      C_Buffer(void);
+
+      std::vector<C_Entry> c_Entries;
+      std::string c_Texts;            ///< Interpretation texts of all entries, each terminated by '\0'
+      uint32_t u32_Count;             ///< Number of valid entries
+      uint32_t u32_ProtocolNameIndex; ///< Position of the current protocol name; mhu32_NO_TEXT if not added yet
+   };
+
+   static void mh_WriterThread(void * const opv_Instance);
+   void m_WriterThread(void);
+   void m_WaitForEvent(stw::tgl::C_TglEvent & orc_Event, const uint32_t ou32_TimeoutMs);
+   uint32_t m_GetTextSize(const C_OscComMessageLoggerData & orc_MessageData) const;
+   static bool mh_HasSpace(const C_Buffer & orc_Buffer, const uint32_t ou32_TextSize);
+   void m_CopyToBuffer(const C_OscComMessageLoggerData & orc_MessageData, C_Buffer & orc_Buffer);
+   static void mh_AppendText(const stw::scl::C_SclString & orc_Text, std::string & orc_Texts);
+   static const char_t * mh_GetNextText(const std::string & orc_Texts, uint32_t & oru32_Index);
+
+   // Double buffer: the producer fills the front buffer, the writer thread drains the other one
+   C_Buffer mac_Buffers[2];
+   uint32_t mu32_FrontBuffer;                  ///< Index of the front buffer in mac_Buffers
+   stw::scl::C_SclString mc_ProtocolName;      ///< Only accessed with mc_BufferLock acquired
+   C_OscComMessageLoggerData mc_WriterMessage; ///< Message rebuilt from the back buffer; writer thread only
+
+   stw::tgl::C_TglCriticalSection mc_BufferLock;
+   stw::tgl::C_TglEvent mc_DataAvailable;
+   stw::tgl::C_TglEvent mc_SpaceAvailable;
+   stw::tgl::C_TglThread mc_WriterThread;
+   bool mq_WriterRunning;
+   bool mq_StopRequested;
+   bool mq_FlushRequested;
+   bool mq_WriterBusy;
+   E_OverflowMode me_OverflowMode;
+   C_OscComMessageLoggerFileStatistics mc_Statistics;
+
+   static const uint32_t mhu32_BATCH_TIMEOUT_MS;
+   static const uint32_t mhu32_WAIT_TIMEOUT_MS;
+   static const uint32_t mhu32_TEXT_BUFFER_SIZE;
+   static const uint32_t mhu32_NO_TEXT;
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
@@ -0,0 +1,235 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Class for writing interpreted CAN messages to a CSV file (implementation)
+
+   One line per CAN message, separated by ';':
+   Timestamp;ID;Direction;DLC;Data;Message;Protocol;Signals...
+
+   Each interpreted signal is appended as "<name>=<value> <unit>" in an own column.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include "stwtypes.hpp"
+#include "stwerrors.hpp"
+#include "C_OscComMessageLoggerFileCsv.hpp"
+#include "TglFile.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::scl;
+using namespace stw::tgl;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint32_t C_OscComMessageLoggerFileCsv::mhu32_WRITE_BUFFER_SIZE = 256U * 1024U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+
+   \param[in]  orc_FilePath                 Path for file
+   \param[in]  orc_ProtocolName             Name of current set protocol
+   \param[in]  oq_HexActive                 Mode for writing CAN Id and CAN data (hexadecimal or decimal)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscComMessageLoggerFileCsv::C_OscComMessageLoggerFileCsv(const C_SclString & orc_FilePath,
+                                                           const C_SclString & orc_ProtocolName,
+                                                           const bool oq_HexActive) :
+   C_OscComMessageLoggerFileBase(orc_FilePath, orc_ProtocolName),
+   mq_HexActive(oq_HexActive)
+{
+   this->mc_WriteBuffer.reserve(mhu32_WRITE_BUFFER_SIZE);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default destructor
+
+   Writes all buffered messages and closes the open file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscComMessageLoggerFileCsv::~C_OscComMessageLoggerFileCsv(void)
+{
+   try
+   {
+      this->m_StopWriter();
+      if (this->mc_File.is_open() == true)
+      {
+         this->mc_File.close();
+      }
+   }
+   catch (...)
+   {
+      //not much we can do here ...
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Creates, if necessary, and opens file and adds the column header line
+
+   An already opened file will be closed and deleted.
+
+   \return
+   C_NO_ERR    File successfully opened and created
+   C_RD_WR     Error on creating file, folders or deleting old file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscComMessageLoggerFileCsv::OpenFile(void)
+{
+   int32_t s32_Return;
+
+   // Write the pending messages of the previous file
+   this->m_StopWriter();
+
+   if (this->mc_File.is_open() == true)
+   {
+      // Close the file if it is open. The previous file will be deleted
+      this->mc_File.close();
+   }
+
+   if (this->mc_FilePath.SubString(this->mc_FilePath.Length() - 3U, 4U).LowerCase() != ".csv")
+   {
+      // Missing file extension
+      this->mc_FilePath += ".csv";
+   }
+
+   s32_Return = C_OscComMessageLoggerFileBase::OpenFile();
+
+   if (s32_Return == C_NO_ERR)
+   {
+      this->mc_File.open(this->mc_FilePath.c_str(), std::ios::out | std::ios::binary);
+
+      if (this->mc_File.is_open() == false)
+      {
+         s32_Return = C_RD_WR;
+      }
+      else
+      {
+         const C_SclString c_Header = "Timestamp[s];ID;Direction;DLC;Data;Message;Protocol;Signals\n";
+         this->mc_File.write(c_Header.c_str(), c_Header.Length());
+         this->m_StartWriter();
+      }
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Writes a batch of buffered CAN messages to the log file
+
+   Called by the writer thread.
+
+   \param[in]  ou32_Count     Number of buffered CAN messages
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComMessageLoggerFileCsv::m_WriteMessages(const uint32_t ou32_Count)
+{
+   if (this->mc_File.is_open() == true)
+   {
+      uint32_t u32_Counter;
+      C_SclString c_ProtocolName;
+
+      this->mc_WriteBuffer.clear();
+      for (u32_Counter = 0U; u32_Counter < ou32_Count; ++u32_Counter)
+      {
+         this->m_FormatMessage(this->m_GetBufferedMessage(u32_Counter, c_ProtocolName), this->mc_WriteBuffer);
+
+         if (this->mc_WriteBuffer.size() >= mhu32_WRITE_BUFFER_SIZE)
+         {
+            this->mc_File.write(this->mc_WriteBuffer.c_str(), this->mc_WriteBuffer.size());
+            this->mc_WriteBuffer.clear();
+         }
+      }
+      this->mc_File.write(this->mc_WriteBuffer.c_str(), this->mc_WriteBuffer.size());
+      this->mc_File.flush();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Formats a concrete CAN message as one CSV line
+
+   \param[in]      orc_MessageData      Current CAN message
+   \param[in,out]  orc_Output           Buffer the formatted line is appended to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComMessageLoggerFileCsv::m_FormatMessage(const C_OscComMessageLoggerData & orc_MessageData,
+                                                   std::string & orc_Output) const
+{
+   uint32_t u32_SignalCounter;
+
+   mh_AppendField(orc_MessageData.c_TimeStampAbsoluteStart, orc_Output);
+   orc_Output += ';';
+   mh_AppendField((this->mq_HexActive == true) ? orc_MessageData.c_CanIdHex : orc_MessageData.c_CanIdDec,
+                  orc_Output);
+   orc_Output += (orc_MessageData.q_IsTx == true) ? ";Tx;" : ";Rx;";
+   mh_AppendField(orc_MessageData.c_CanDlc, orc_Output);
+   orc_Output += ';';
+   if (orc_MessageData.c_CanMsg.u8_RTR == 0U)
+   {
+      mh_AppendField((this->mq_HexActive == true) ? orc_MessageData.c_CanDataHex : orc_MessageData.c_CanDataDec,
+                     orc_Output);
+   }
+   orc_Output += ';';
+   mh_AppendField(orc_MessageData.c_Name, orc_Output);
+   orc_Output += ';';
+   mh_AppendField((this->mq_HexActive == true) ? orc_MessageData.c_ProtocolTextHex :
+                  orc_MessageData.c_ProtocolTextDec, orc_Output);
+
+   for (u32_SignalCounter = 0U; u32_SignalCounter < orc_MessageData.c_Signals.size(); u32_SignalCounter++)
+   {
+      const C_OscComMessageLoggerDataSignal & rc_Signal = orc_MessageData.c_Signals[u32_SignalCounter];
+      C_SclString c_Signal = rc_Signal.c_Name + "=" + rc_Signal.c_Value;
+      if (rc_Signal.c_Unit != "")
+      {
+         c_Signal += " " + rc_Signal.c_Unit;
+      }
+      orc_Output += ';';
+      mh_AppendField(c_Signal, orc_Output);
+   }
+   orc_Output += '\n';
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Appends one field; fields containing separators or quotes are quoted
+
+   \param[in]      orc_Field    Field content
+   \param[in,out]  orc_Output   Output buffer
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComMessageLoggerFileCsv::mh_AppendField(const C_SclString & orc_Field, std::string & orc_Output)
+{
+   const std::string & rc_Field = *orc_Field.AsStdString();
+
+   if (rc_Field.find_first_of(";\"\n") == std::string::npos)
+   {
+      orc_Output += rc_Field;
+   }
+   else
+   {
+      uint32_t u32_Pos;
+      orc_Output += '"';
+      for (u32_Pos = 0U; u32_Pos < rc_Field.size(); ++u32_Pos)
+      {
+         if (rc_Field[u32_Pos] == '"')
+         {
+            orc_Output += '"';
+         }
+         orc_Output += rc_Field[u32_Pos];
+      }
+      orc_Output += '"';
+   }
+}
@@ -0,0 +1,63 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Class for writing interpreted CAN messages to a CSV file (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCCOMMESSAGELOGGERFILECSV_HPP
+#define C_OSCCOMMESSAGELOGGERFILECSV_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <fstream>
+#include <string>
+
+#include "C_SclString.hpp"
+
+#include "C_OscComMessageLoggerFileBase.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_OscComMessageLoggerFileCsv :
+   public C_OscComMessageLoggerFileBase
+{
+public:
+   C_OscComMessageLoggerFileCsv(const stw::scl::C_SclString & orc_FilePath,
+                                const stw::scl::C_SclString & orc_ProtocolName, const bool oq_HexActive);
+   virtual ~C_OscComMessageLoggerFileCsv(void);
+
+   virtual int32_t OpenFile(void);
+
+protected:
+   virtual void m_WriteMessages(const uint32_t ou32_Count);
+
+private:
+   //Avoid call
+   C_OscComMessageLoggerFileCsv(const C_OscComMessageLoggerFileCsv &);
+   C_OscComMessageLoggerFileCsv & operator =(const C_OscComMessageLoggerFileCsv &);
+
+   void m_FormatMessage(const C_OscComMessageLoggerData & orc_MessageData, std::string & orc_Output) const;
+   static void mh_AppendField(const stw::scl::C_SclString & orc_Field, std::string & orc_Output);
+
+   const bool mq_HexActive;
+   std::ofstream mc_File;
+   std::string mc_WriteBuffer; ///< Formatted batch; only accessed by the writer thread
+
+   static const uint32_t mhu32_WRITE_BUFFER_SIZE;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
@@ -0,0 +1,442 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Compiled CAN ID filter configuration of the message logger (implementation)
+
+   The configured pass and block filters are compiled once when the configuration changes:
+   - the result for all 11bit IDs is stored in a bitmap
+   - the ranges of 29bit IDs are sorted and merged, so they can be checked by a binary search
+   - filters with any other ID type are kept as configured and only checked for messages of exactly that ID type
+
+   The pass filters can be converted to ID/mask acceptance filters for CAN drivers which support filtering
+   before the message reaches the application.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <algorithm>
+
+#include "C_OscComMessageLoggerFilterSet.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::can;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint32_t C_OscComMessageLoggerFilterSet::mhu32_STANDARD_ID_COUNT = 0x800U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscComMessageLoggerFilter::C_OscComMessageLoggerFilter(void) :
+   u8_ExtendedId(0U),
+   u32_StartId(0U),
+   u32_EndId(0U),
+   q_PassFilter(false)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Check if current equal to orc_Cmp
+
+   \param[in] orc_Cmp Compared instance
+
+   \return
+   Current equal to orc_Cmp
+   Else false
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscComMessageLoggerFilter::operator ==(const C_OscComMessageLoggerFilter & orc_Cmp) const
+{
+   bool q_Return = false;
+
+   if ((this->u8_ExtendedId == orc_Cmp.u8_ExtendedId) &&
+       (this->q_PassFilter == orc_Cmp.q_PassFilter) &&
+       (this->u32_StartId == orc_Cmp.u32_StartId) &&
+       (this->u32_EndId == orc_Cmp.u32_EndId))
+   {
+      q_Return = true;
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Compare ranges by start ID
+
+   \param[in] orc_Cmp Compared instance
+
+   \return
+   true     Current range starts before orc_Cmp
+   false    Else
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscComMessageLoggerFilterSet::C_IdRange::operator <(const C_IdRange & orc_Cmp) const
+{
+   return (this->u32_StartId < orc_Cmp.u32_StartId);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+
+   No filter configured: all messages pass.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscComMessageLoggerFilterSet::C_OscComMessageLoggerFilterSet(void) :
+   mq_Active(false),
+   mq_PassFilterAvailable(false)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Compile filter configuration
+
+   Same semantics as checking the configured filters one by one:
+   - a message matching any block filter is not relevant
+   - if at least one pass filter is configured, only messages matching one pass filter are relevant
+   - if no pass filter is configured, all messages not blocked are relevant
+
+   \param[in] orc_Filters Complete filter configuration
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComMessageLoggerFilterSet::Compile(const std::vector<C_OscComMessageLoggerFilter> & orc_Filters)
+{
+   uint32_t u32_Counter;
+
+   this->mq_Active = (orc_Filters.size() > 0UL);
+   this->mq_PassFilterAvailable = false;
+   for (u32_Counter = 0U; u32_Counter < 2U; ++u32_Counter)
+   {
+      this->mac_BlockRanges[u32_Counter].clear();
+      this->mac_PassRanges[u32_Counter].clear();
+   }
+   this->mc_OtherIdTypeFilters.clear();
+
+   for (u32_Counter = 0U; u32_Counter < orc_Filters.size(); ++u32_Counter)
+   {
+      const C_OscComMessageLoggerFilter & rc_Filter = orc_Filters[u32_Counter];
+
+      if (rc_Filter.q_PassFilter == true)
+      {
+         // Even a pass filter which can never match blocks all other messages
+         this->mq_PassFilterAvailable = true;
+      }
+
+      if (rc_Filter.u8_ExtendedId > 1U)
+      {
+         // Rarely used ID type; matched by comparing the ID type of the message for equality as before
+         this->mc_OtherIdTypeFilters.push_back(rc_Filter);
+      }
+      // Filters with an empty range can never match a message
+      else if (rc_Filter.u32_StartId <= rc_Filter.u32_EndId)
+      {
+         C_IdRange c_Range;
+         c_Range.u32_StartId = rc_Filter.u32_StartId;
+         c_Range.u32_EndId = rc_Filter.u32_EndId;
+
+         if (rc_Filter.q_PassFilter == true)
+         {
+            this->mac_PassRanges[rc_Filter.u8_ExtendedId].push_back(c_Range);
+         }
+         else
+         {
+            this->mac_BlockRanges[rc_Filter.u8_ExtendedId].push_back(c_Range);
+         }
+      }
+   }
+
+   for (u32_Counter = 0U; u32_Counter < 2U; ++u32_Counter)
+   {
+      mh_MergeRanges(this->mac_BlockRanges[u32_Counter]);
+      mh_MergeRanges(this->mac_PassRanges[u32_Counter]);
+   }
+
+   // Evaluate the configuration once for each 11bit ID
+   this->mc_StandardIdPassBitmap.assign(mhu32_STANDARD_ID_COUNT / 32U, 0U);
+   for (u32_Counter = 0U; u32_Counter < mhu32_STANDARD_ID_COUNT; ++u32_Counter)
+   {
+      if ((mh_IsInRanges(this->mac_BlockRanges[0], u32_Counter) == false) &&
+          ((this->mq_PassFilterAvailable == false) || (mh_IsInRanges(this->mac_PassRanges[0], u32_Counter) == true)))
+      {
+         this->mc_StandardIdPassBitmap[u32_Counter >> 5U] |= (1UL << (u32_Counter & 0x1FU));
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Check if at least one filter is configured
+
+   \return
+   true     At least one filter configured
+   false    No filter configured, all messages pass
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscComMessageLoggerFilterSet::IsActive(void) const
+{
+   return this->mq_Active;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Checks a specific CAN message for matching the filter configuration
+
+   \param[in] orc_Msg Current CAN message
+
+   \return
+   true     CAN message is relevant
+   false    CAN message is not relevant
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscComMessageLoggerFilterSet::CheckMessage(const T_STWCAN_Msg_RX & orc_Msg) const
+{
+   bool q_Return;
+
+   if (this->mq_Active == false)
+   {
+      // No filter configured, all messages are welcome
+      q_Return = true;
+   }
+   else if ((orc_Msg.u8_XTD == 0U) && (orc_Msg.u32_ID < mhu32_STANDARD_ID_COUNT))
+   {
+      q_Return = ((this->mc_StandardIdPassBitmap[orc_Msg.u32_ID >> 5U] & (1UL << (orc_Msg.u32_ID & 0x1FU))) != 0U);
+   }
+   else if (orc_Msg.u8_XTD <= 1U)
+   {
+      if (mh_IsInRanges(this->mac_BlockRanges[orc_Msg.u8_XTD], orc_Msg.u32_ID) == true)
+      {
+         q_Return = false;
+      }
+      else if (this->mq_PassFilterAvailable == true)
+      {
+         q_Return = mh_IsInRanges(this->mac_PassRanges[orc_Msg.u8_XTD], orc_Msg.u32_ID);
+      }
+      else
+      {
+         q_Return = true;
+      }
+   }
+   else
+   {
+      q_Return = this->m_CheckOtherIdTypeFilters(orc_Msg);
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get pass filter configuration as ID/mask acceptance filters
+
+   Intended for CAN drivers which can filter messages before they reach the application (e.g. CAN_RAW_FILTER of
+   SocketCAN). The acceptance filters let pass all messages matching a pass filter; block filters are not
+   represented, so CheckMessage still needs to be called for each received message.
+   A message passes if it passes at least one of the returned acceptance filters.
+
+   \param[out] orc_Filters   Acceptance filters (empty if false is returned)
+   \param[in]  ou32_MaxCount Maximum number of acceptance filters supported by the driver
+
+   \return
+   true     Acceptance filters restricting the received messages available
+   false    No restriction possible (no pass filter configured or too many acceptance filters necessary);
+            the driver must let pass all messages
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscComMessageLoggerFilterSet::GetAcceptanceFilters(std::vector<C_CanRxFilter> & orc_Filters,
+                                                          const uint32_t ou32_MaxCount) const
+{
+   bool q_Return = false;
+
+   orc_Filters.clear();
+
+   if ((this->mq_Active == true) && (this->mq_PassFilterAvailable == true))
+   {
+      mh_AddAcceptanceFilters(this->mac_PassRanges[0], false, orc_Filters);
+      mh_AddAcceptanceFilters(this->mac_PassRanges[1], true, orc_Filters);
+
+      if (orc_Filters.size() <= ou32_MaxCount)
+      {
+         q_Return = true;
+      }
+      else
+      {
+         orc_Filters.clear();
+      }
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Sort ranges and merge overlapping and adjacent ranges
+
+   \param[in,out] orc_Ranges Ranges to merge
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComMessageLoggerFilterSet::mh_MergeRanges(std::vector<C_IdRange> & orc_Ranges)
+{
+   if (orc_Ranges.size() > 1UL)
+   {
+      uint32_t u32_Counter;
+      uint32_t u32_Last = 0U;
+
+      std::sort(orc_Ranges.begin(), orc_Ranges.end());
+
+      for (u32_Counter = 1U; u32_Counter < orc_Ranges.size(); ++u32_Counter)
+      {
+         const C_IdRange & rc_Next = orc_Ranges[u32_Counter];
+         C_IdRange & rc_Last = orc_Ranges[u32_Last];
+
+         // Calculated in 64bit, so the end ID 0xFFFFFFFF does not wrap around
+         if ((static_cast<uint64_t>(rc_Last.u32_EndId) + 1U) >= rc_Next.u32_StartId)
+         {
+            rc_Last.u32_EndId = std::max(rc_Last.u32_EndId, rc_Next.u32_EndId);
+         }
+         else
+         {
+            ++u32_Last;
+            orc_Ranges[u32_Last] = rc_Next;
+         }
+      }
+      orc_Ranges.resize(static_cast<size_t>(u32_Last) + 1U);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Checks a CAN message with an ID type other than 11bit or 29bit
+
+   Only filters configured with exactly the same ID type can match such a message.
+
+   \param[in] orc_Msg Current CAN message
+
+   \return
+   true     CAN message is relevant
+   false    CAN message is not relevant
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscComMessageLoggerFilterSet::m_CheckOtherIdTypeFilters(const T_STWCAN_Msg_RX & orc_Msg) const
+{
+   bool q_Return;
+   bool q_Blocked = false;
+   bool q_Passed = false;
+   uint32_t u32_Counter;
+
+   for (u32_Counter = 0U; u32_Counter < this->mc_OtherIdTypeFilters.size(); ++u32_Counter)
+   {
+      const C_OscComMessageLoggerFilter & rc_Filter = this->mc_OtherIdTypeFilters[u32_Counter];
+
+      if ((orc_Msg.u8_XTD == rc_Filter.u8_ExtendedId) &&
+          (orc_Msg.u32_ID >= rc_Filter.u32_StartId) &&
+          (orc_Msg.u32_ID <= rc_Filter.u32_EndId))
+      {
+         if (rc_Filter.q_PassFilter == true)
+         {
+            q_Passed = true;
+         }
+         else
+         {
+            q_Blocked = true;
+            break;
+         }
+      }
+   }
+
+   if (q_Blocked == true)
+   {
+      q_Return = false;
+   }
+   else if (this->mq_PassFilterAvailable == true)
+   {
+      q_Return = q_Passed;
+   }
+   else
+   {
+      q_Return = true;
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Check if ID is part of sorted and merged ranges
+
+   \param[in] orc_Ranges Sorted and merged ranges
+   \param[in] ou32_Id    CAN ID
+
+   \return
+   true     ID is part of one range
+   false    ID is not part of any range
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscComMessageLoggerFilterSet::mh_IsInRanges(const std::vector<C_IdRange> & orc_Ranges, const uint32_t ou32_Id)
+{
+   bool q_Return = false;
+   C_IdRange c_Key;
+
+   c_Key.u32_StartId = ou32_Id;
+   c_Key.u32_EndId = ou32_Id;
+
+   // First range starting after the ID; the range before is the only candidate
+   const std::vector<C_IdRange>::const_iterator c_ItRange =
+      std::upper_bound(orc_Ranges.begin(), orc_Ranges.end(), c_Key);
+   if (c_ItRange != orc_Ranges.begin())
+   {
+      q_Return = (ou32_Id <= (c_ItRange - 1)->u32_EndId);
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Split ranges into aligned blocks and add one ID/mask acceptance filter for each block
+
+   \param[in]     orc_Ranges  Sorted and merged ranges
+   \param[in]     oq_Extended true: 29bit IDs; false: 11bit IDs
+   \param[in,out] orc_Filters Acceptance filters
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComMessageLoggerFilterSet::mh_AddAcceptanceFilters(const std::vector<C_IdRange> & orc_Ranges,
+                                                             const bool oq_Extended,
+                                                             std::vector<C_CanRxFilter> & orc_Filters)
+{
+   const uint32_t u32_IdMask = (oq_Extended == true) ? 0x1FFFFFFFUL : 0x7FFUL;
+   uint32_t u32_Counter;
+
+   for (u32_Counter = 0U; u32_Counter < orc_Ranges.size(); ++u32_Counter)
+   {
+      const uint64_t u64_End = std::min(orc_Ranges[u32_Counter].u32_EndId, u32_IdMask);
+      uint64_t u64_Start = orc_Ranges[u32_Counter].u32_StartId;
+
+      while (u64_Start <= u64_End)
+      {
+         C_CanRxFilter c_Filter;
+         uint64_t u64_Size = 1U;
+
+         // Largest block aligned to its size which still fits into the range
+         while (((u64_Start & ((u64_Size * 2U) - 1U)) == 0U) && (((u64_Start + (u64_Size * 2U)) - 1U) <= u64_End))
+         {
+            u64_Size *= 2U;
+         }
+
+         c_Filter.u32_Code = static_cast<uint32_t>(u64_Start);
+         c_Filter.u32_Mask = u32_IdMask & (~static_cast<uint32_t>(u64_Size - 1U));
+         c_Filter.q_XTD = oq_Extended;
+         c_Filter.q_XTDMustMatch = true;
+         orc_Filters.push_back(c_Filter);
+
+         u64_Start += u64_Size;
+      }
+   }
+}
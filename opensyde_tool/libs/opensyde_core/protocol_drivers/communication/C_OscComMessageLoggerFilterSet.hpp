@@ -0,0 +1,89 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Compiled CAN ID filter configuration of the message logger (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCCOMMESSAGELOGGERFILTERSET_HPP
+#define C_OSCCOMMESSAGELOGGERFILTERSET_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
+
+#include "stwtypes.hpp"
+#include "stw_can.hpp"
+#include "C_CanDispatcher.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_OscComMessageLoggerFilter
+{
+public:
+   C_OscComMessageLoggerFilter(void);
+
+   bool operator ==(const C_OscComMessageLoggerFilter & orc_Cmp) const;
+
+   uint8_t u8_ExtendedId; ///< 0 -> 11bit ID; 1 -> 29bit ID
+   uint32_t u32_StartId;  ///< First CAN ID which is relevant for the filter configuration
+   uint32_t u32_EndId;    ///< Last CAN ID which is relevant for the filter configuration
+   bool q_PassFilter;     ///< true -> Filter for passing; false -> Filter for blocking configured CAN IDs
+};
+
+///Filter configuration compiled for fast per message checks
+class C_OscComMessageLoggerFilterSet
+{
+public:
+   C_OscComMessageLoggerFilterSet(void);
+
+   void Compile(const std::vector<C_OscComMessageLoggerFilter> & orc_Filters);
+   bool IsActive(void) const;
+   bool CheckMessage(const stw::can::T_STWCAN_Msg_RX & orc_Msg) const;
+   bool GetAcceptanceFilters(std::vector<stw::can::C_CanRxFilter> & orc_Filters,
+                             const uint32_t ou32_MaxCount) const;
+
+private:
+   ///Closed range of CAN IDs
+   class C_IdRange
+   {
+   public:
+      uint32_t u32_StartId;
+      uint32_t u32_EndId;
+
+      bool operator <(const C_IdRange & orc_Cmp) const;
+   };
+
+   static void mh_MergeRanges(std::vector<C_IdRange> & orc_Ranges);
+   static bool mh_IsInRanges(const std::vector<C_IdRange> & orc_Ranges, const uint32_t ou32_Id);
+   static void mh_AddAcceptanceFilters(const std::vector<C_IdRange> & orc_Ranges, const bool oq_Extended,
+                                       std::vector<stw::can::C_CanRxFilter> & orc_Filters);
+   bool m_CheckOtherIdTypeFilters(const stw::can::T_STWCAN_Msg_RX & orc_Msg) const;
+
+   bool mq_Active;
+   bool mq_PassFilterAvailable;
+   // Merged and sorted ranges; index 0: 11bit IDs, index 1: 29bit IDs
+   std::vector<C_IdRange> mac_BlockRanges[2];
+   std::vector<C_IdRange> mac_PassRanges[2];
+   // Result of the complete filter configuration for each 11bit ID (one bit per ID)
+   std::vector<uint32_t> mc_StandardIdPassBitmap;
+   // Filters with an ID type other than 11bit or 29bit; checked one by one
+   std::vector<C_OscComMessageLoggerFilter> mc_OtherIdTypeFilters;
+
+   static const uint32_t mhu32_STANDARD_ID_COUNT;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
@@ -0,0 +1,379 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Class for reading CAN messages from an ASC trace file (implementation)
+
+   Reads the file line by line with a large stream buffer and parses the CAN message lines directly on the
+   character data. Supported is the format written by C_OscComMessageLoggerFileAsc and the common Vector format:
+
+   <time> <channel> <id>[x] <Rx|Tx> d <dlc> <data bytes> ...
+   <time> <channel> <id>[x] <Rx|Tx> r
+
+   Header lines ("base hex|dec timestamps absolute|relative") are evaluated, all other lines are skipped.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <cstdlib>
+#include <cstring>
+
+#include "stwtypes.hpp"
+#include "stwerrors.hpp"
+#include "C_OscComTraceReaderAsc.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::scl;
+using namespace stw::can;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint32_t C_OscComTraceReaderAsc::mhu32_READ_BUFFER_SIZE = 1024U * 1024U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscComTraceReaderAsc::C_OscComTraceReaderAsc(void) :
+   C_OscComTraceReaderBase(),
+   ms32_NumberBase(16),
+   mq_RelativeTimeStamps(false),
+   mu64_LastTimeStamp(0ULL)
+{
+   this->mc_ReadBuffer.resize(mhu32_READ_BUFFER_SIZE);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default destructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscComTraceReaderAsc::~C_OscComTraceReaderAsc(void)
+{
+   try
+   {
+      C_OscComTraceReaderAsc::CloseFile();
+   }
+   catch (...)
+   {
+      //not much we can do here ...
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Opens an ASC file for reading
+
+   An already opened file will be closed.
+
+   \param[in]  orc_FilePath   Path of ASC file
+
+   \return
+   C_NO_ERR    File opened
+   C_RD_WR     File could not be opened
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscComTraceReaderAsc::OpenFile(const C_SclString & orc_FilePath)
+{
+   int32_t s32_Return = C_NO_ERR;
+
+   this->CloseFile();
+
+   this->ms32_NumberBase = 16;
+   this->mq_RelativeTimeStamps = false;
+   this->mu64_LastTimeStamp = 0ULL;
+   this->mu64_SkippedEntries = 0ULL;
+
+   // The buffer must be set before opening to take effect
+   this->mc_File.rdbuf()->pubsetbuf(&this->mc_ReadBuffer[0], this->mc_ReadBuffer.size());
+   this->mc_File.open(orc_FilePath.c_str(), std::ios::in | std::ios::binary);
+   if (this->mc_File.is_open() == false)
+   {
+      s32_Return = C_RD_WR;
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Reads the next CAN message of the file
+
+   \param[out]  orc_Msg    CAN message; time stamp in micro seconds relative to the start of the file
+   \param[out]  orq_IsTx   Message was sent by the logging node
+
+   \return
+   C_NO_ERR    Message read
+   C_NOACT     End of file reached
+   C_CONFIG    No file opened
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscComTraceReaderAsc::ReadNextMessage(T_STWCAN_Msg_RX & orc_Msg, bool & orq_IsTx)
+{
+   int32_t s32_Return = C_NOACT;
+
+   if (this->mc_File.is_open() == false)
+   {
+      s32_Return = C_CONFIG;
+   }
+   else
+   {
+      while (std::getline(this->mc_File, this->mc_Line))
+      {
+         if (this->m_ParseLine(orc_Msg, orq_IsTx) == true)
+         {
+            s32_Return = C_NO_ERR;
+            break;
+         }
+      }
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Closes the file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComTraceReaderAsc::CloseFile(void)
+{
+   if (this->mc_File.is_open() == true)
+   {
+      this->mc_File.close();
+   }
+   this->mc_File.clear();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Parses the current line
+
+   \param[out]  orc_Msg    CAN message
+   \param[out]  orq_IsTx   Message was sent by the logging node
+
+   \return
+   true     Line contained a CAN message
+   false    Line was no CAN message
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscComTraceReaderAsc::m_ParseLine(T_STWCAN_Msg_RX & orc_Msg, bool & orq_IsTx)
+{
+   bool q_Return = false;
+   const char_t * pcn_Pos = mh_SkipSpaces(this->mc_Line.c_str());
+
+   if ((*pcn_Pos >= '0') && (*pcn_Pos <= '9'))
+   {
+      uint64_t u64_TimeStamp;
+      char_t * pcn_End;
+
+      if (mh_ParseTimeStamp(pcn_Pos, u64_TimeStamp) == true)
+      {
+         // Channel
+         pcn_Pos = mh_SkipSpaces(pcn_Pos);
+         (void)std::strtoul(pcn_Pos, &pcn_End, 10);
+         if (pcn_End != pcn_Pos)
+         {
+            // CAN ID with optional "x" for extended IDs
+            pcn_Pos = mh_SkipSpaces(pcn_End);
+            orc_Msg.u32_ID = static_cast<uint32_t>(std::strtoul(pcn_Pos, &pcn_End, this->ms32_NumberBase));
+            if (pcn_End != pcn_Pos)
+            {
+               orc_Msg.u8_XTD = 0U;
+               pcn_Pos = pcn_End;
+               if ((*pcn_Pos == 'x') || (*pcn_Pos == 'X'))
+               {
+                  orc_Msg.u8_XTD = 1U;
+                  ++pcn_Pos;
+               }
+
+               // Direction
+               pcn_Pos = mh_SkipSpaces(pcn_Pos);
+               if ((pcn_Pos[0] == 'R') && (pcn_Pos[1] == 'x'))
+               {
+                  orq_IsTx = false;
+                  q_Return = true;
+               }
+               else if ((pcn_Pos[0] == 'T') && (pcn_Pos[1] == 'x'))
+               {
+                  orq_IsTx = true;
+                  q_Return = true;
+               }
+               else
+               {
+                  // Error frames and other events
+               }
+            }
+         }
+      }
+
+      if (q_Return == true)
+      {
+         pcn_Pos = mh_SkipSpaces(&pcn_Pos[2]);
+         orc_Msg.u8_RTR = 0U;
+         orc_Msg.u8_DLC = 0U;
+         (void)std::memset(&orc_Msg.au8_Data[0], 0, sizeof(orc_Msg.au8_Data));
+
+         if (*pcn_Pos == 'r')
+         {
+            orc_Msg.u8_RTR = 1U;
+            pcn_Pos = mh_SkipSpaces(&pcn_Pos[1]);
+            orc_Msg.u8_DLC = static_cast<uint8_t>(std::strtoul(pcn_Pos, &pcn_End, 16));
+         }
+         else if (*pcn_Pos == 'd')
+         {
+            uint8_t u8_Byte;
+            pcn_Pos = mh_SkipSpaces(&pcn_Pos[1]);
+            orc_Msg.u8_DLC = static_cast<uint8_t>(std::strtoul(pcn_Pos, &pcn_End, 16));
+            if (orc_Msg.u8_DLC > 8U)
+            {
+               orc_Msg.u8_DLC = 8U;
+            }
+            pcn_Pos = pcn_End;
+            for (u8_Byte = 0U; u8_Byte < orc_Msg.u8_DLC; ++u8_Byte)
+            {
+               orc_Msg.au8_Data[u8_Byte] =
+                  static_cast<uint8_t>(std::strtoul(pcn_Pos, &pcn_End, this->ms32_NumberBase));
+               if (pcn_End == pcn_Pos)
+               {
+                  // Fewer bytes than announced
+                  q_Return = false;
+                  break;
+               }
+               pcn_Pos = pcn_End;
+            }
+         }
+         else
+         {
+            q_Return = false;
+         }
+      }
+
+      if (q_Return == true)
+      {
+         if (this->mq_RelativeTimeStamps == true)
+         {
+            this->mu64_LastTimeStamp += u64_TimeStamp;
+            orc_Msg.u64_TimeStamp = this->mu64_LastTimeStamp;
+         }
+         else
+         {
+            orc_Msg.u64_TimeStamp = u64_TimeStamp;
+         }
+      }
+      else
+      {
+         ++this->mu64_SkippedEntries;
+      }
+   }
+   else if (std::strncmp(pcn_Pos, "base ", 5U) == 0)
+   {
+      this->m_ParseBaseLine(pcn_Pos);
+   }
+   else
+   {
+      // Header, trigger block and comment lines
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Evaluates the "base" header line
+
+   Format: base <hex|dec> timestamps <absolute|relative>
+
+   \param[in]  opcn_Line   Line starting with "base"
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComTraceReaderAsc::m_ParseBaseLine(const char_t * const opcn_Line)
+{
+   if (std::strstr(opcn_Line, " dec") != NULL)
+   {
+      this->ms32_NumberBase = 10;
+   }
+   else
+   {
+      this->ms32_NumberBase = 16;
+   }
+   this->mq_RelativeTimeStamps = (std::strstr(opcn_Line, "relative") != NULL);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Skips spaces and tabs
+
+   \param[in]  opcn_Pos    Current position
+
+   \return
+   First position which is no space or tab
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const char_t * C_OscComTraceReaderAsc::mh_SkipSpaces(const char_t * const opcn_Pos)
+{
+   const char_t * pcn_Pos = opcn_Pos;
+
+   while ((*pcn_Pos == ' ') || (*pcn_Pos == '\t'))
+   {
+      ++pcn_Pos;
+   }
+   return pcn_Pos;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Parses a time stamp in seconds with optional decimal places
+
+   \param[in,out]  orpcn_Pos        Current position; set behind the time stamp
+   \param[out]     oru64_TimeStamp  Time stamp in micro seconds
+
+   \return
+   true     Time stamp parsed
+   false    No valid time stamp
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscComTraceReaderAsc::mh_ParseTimeStamp(const char_t * & orpcn_Pos, uint64_t & oru64_TimeStamp)
+{
+   bool q_Return = false;
+   uint64_t u64_Seconds = 0ULL;
+   uint64_t u64_Micro = 0ULL;
+   uint32_t u32_Digits = 0U;
+
+   while ((*orpcn_Pos >= '0') && (*orpcn_Pos <= '9'))
+   {
+      u64_Seconds = (u64_Seconds * 10ULL) + static_cast<uint64_t>(*orpcn_Pos - '0');
+      ++orpcn_Pos;
+   }
+   if (*orpcn_Pos == '.')
+   {
+      ++orpcn_Pos;
+      while ((*orpcn_Pos >= '0') && (*orpcn_Pos <= '9'))
+      {
+         // Resolution beyond micro seconds is ignored
+         if (u32_Digits < 6U)
+         {
+            u64_Micro = (u64_Micro * 10ULL) + static_cast<uint64_t>(*orpcn_Pos - '0');
+            ++u32_Digits;
+         }
+         ++orpcn_Pos;
+      }
+      for (; u32_Digits < 6U; ++u32_Digits)
+      {
+         u64_Micro *= 10ULL;
+      }
+   }
+   if ((*orpcn_Pos == ' ') || (*orpcn_Pos == '\t'))
+   {
+      oru64_TimeStamp = (u64_Seconds * 1000000ULL) + u64_Micro;
+      q_Return = true;
+   }
+
+   return q_Return;
+}
@@ -0,0 +1,65 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Class for reading CAN messages from an ASC trace file (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCCOMTRACEREADERASC_HPP
+#define C_OSCCOMTRACEREADERASC_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "C_OscComTraceReaderBase.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_OscComTraceReaderAsc :
+   public C_OscComTraceReaderBase
+{
+public:
+   C_OscComTraceReaderAsc(void);
+   virtual ~C_OscComTraceReaderAsc(void);
+
+   virtual int32_t OpenFile(const stw::scl::C_SclString & orc_FilePath);
+   virtual int32_t ReadNextMessage(stw::can::T_STWCAN_Msg_RX & orc_Msg, bool & orq_IsTx);
+   virtual void CloseFile(void);
+
+private:
+   //Avoid call
+   C_OscComTraceReaderAsc(const C_OscComTraceReaderAsc &);
+   C_OscComTraceReaderAsc & operator =(const C_OscComTraceReaderAsc &);
+
+   bool m_ParseLine(stw::can::T_STWCAN_Msg_RX & orc_Msg, bool & orq_IsTx);
+   void m_ParseBaseLine(const char_t * const opcn_Line);
+   static const char_t * mh_SkipSpaces(const char_t * const opcn_Pos);
+   static bool mh_ParseTimeStamp(const char_t * & orpcn_Pos, uint64_t & oru64_TimeStamp);
+
+   std::ifstream mc_File;
+   std::vector<char_t> mc_ReadBuffer;
+   std::string mc_Line;
+   int32_t ms32_NumberBase;     ///< 16 or 10 as configured by the "base" line of the file
+   bool mq_RelativeTimeStamps;  ///< Time stamps in file are relative to the previous message
+   uint64_t mu64_LastTimeStamp; ///< Accumulated time stamp for relative time stamps
+
+   static const uint32_t mhu32_READ_BUFFER_SIZE;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
@@ -0,0 +1,61 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Class with generic interface to read CAN messages from a trace file (implementation)
+
+   Trace readers are streaming: each call of ReadNextMessage returns the next CAN message of the file
+   without loading the whole file into memory.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include "stwtypes.hpp"
+#include "C_OscComTraceReaderBase.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscComTraceReaderBase::C_OscComTraceReaderBase(void) :
+   mu64_SkippedEntries(0ULL)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default destructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscComTraceReaderBase::~C_OscComTraceReaderBase(void)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Returns the number of skipped file entries
+
+   \return
+   Number of entries which were no CAN message or could not be parsed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_OscComTraceReaderBase::GetSkippedEntries(void) const
+{
+   return this->mu64_SkippedEntries;
+}
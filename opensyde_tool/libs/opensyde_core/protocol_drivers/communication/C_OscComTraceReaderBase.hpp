@@ -0,0 +1,53 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Class with generic interface to read CAN messages from a trace file (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCCOMTRACEREADERBASE_HPP
+#define C_OSCCOMTRACEREADERBASE_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "stwtypes.hpp"
+#include "stw_can.hpp"
+#include "C_SclString.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_OscComTraceReaderBase
+{
+public:
+   C_OscComTraceReaderBase(void);
+   virtual ~C_OscComTraceReaderBase(void);
+
+   virtual int32_t OpenFile(const stw::scl::C_SclString & orc_FilePath) = 0;
+   virtual int32_t ReadNextMessage(stw::can::T_STWCAN_Msg_RX & orc_Msg, bool & orq_IsTx) = 0;
+   virtual void CloseFile(void) = 0;
+
+   uint64_t GetSkippedEntries(void) const;
+
+protected:
+   uint64_t mu64_SkippedEntries; ///< Number of file entries which were no CAN message or could not be parsed
+
+private:
+   //Avoid call
+   C_OscComTraceReaderBase(const C_OscComTraceReaderBase &);
+   C_OscComTraceReaderBase & operator =(const C_OscComTraceReaderBase &);
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
@@ -0,0 +1,171 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Class for replaying CAN trace files through a message logger (implementation)
+
+   Reads the messages of a trace file one by one and passes them to C_OscComMessageLogger::HandleCanMessage.
+   So the configured filters, database interpretations and log files are used the same way as for live traffic.
+
+   The messages are replayed either as fast as possible (speed factor 0) or paced by the time stamps of the
+   file scaled by the speed factor (1.0: real time, 2.0: double speed, ...).
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include "stwtypes.hpp"
+#include "stwerrors.hpp"
+#include "TglTime.hpp"
+#include "C_OscComTraceReplay.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::can;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscComTraceReplay::C_OscComTraceReplay(void) :
+   mq_AbortRequested(false),
+   mu64_ReplayedMessages(0ULL)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Replays all messages of an opened trace file
+
+   The logger is not started or stopped by this function. The caller has to call Start and Stop of the logger
+   around the replay (Stop writes all buffered log file entries).
+
+   The time stamps passed to the logger keep the distances of the file time stamps and start at the time of the
+   call, so the relative and absolute time stamps of the logger match the original trace.
+
+   \param[in,out]  orc_Reader         Reader with opened trace file
+   \param[in,out]  orc_Logger         Logger handling the messages
+   \param[in]      of64_SpeedFactor   0: as fast as possible; > 0: replay speed relative to real time
+
+   \return
+   C_NO_ERR    All messages replayed
+   C_BUSY      Replay aborted by RequestAbort
+   C_RANGE     Negative speed factor
+   C_CONFIG    Reader has no opened file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscComTraceReplay::Replay(C_OscComTraceReaderBase & orc_Reader, C_OscComMessageLogger & orc_Logger,
+                                    const float64_t of64_SpeedFactor)
+{
+   int32_t s32_Return = C_NO_ERR;
+
+   this->mq_AbortRequested = false;
+   this->mu64_ReplayedMessages = 0ULL;
+
+   if (of64_SpeedFactor < 0.0)
+   {
+      s32_Return = C_RANGE;
+   }
+   else
+   {
+      const uint64_t u64_ReplayStart = stw::tgl::TglGetTickCountUs();
+      uint64_t u64_FirstFileTimeStamp = 0ULL;
+      bool q_First = true;
+      T_STWCAN_Msg_RX c_Msg;
+      bool q_IsTx;
+      int32_t s32_ReadResult = orc_Reader.ReadNextMessage(c_Msg, q_IsTx);
+
+      while ((s32_ReadResult == C_NO_ERR) && (this->mq_AbortRequested == false))
+      {
+         uint64_t u64_Offset = 0ULL;
+
+         if (q_First == true)
+         {
+            u64_FirstFileTimeStamp = c_Msg.u64_TimeStamp;
+            q_First = false;
+         }
+         if (c_Msg.u64_TimeStamp > u64_FirstFileTimeStamp)
+         {
+            u64_Offset = c_Msg.u64_TimeStamp - u64_FirstFileTimeStamp;
+         }
+
+         if (of64_SpeedFactor > 0.0)
+         {
+            const uint64_t u64_Due = static_cast<uint64_t>(static_cast<float64_t>(u64_Offset) / of64_SpeedFactor);
+            const uint64_t u64_Elapsed = stw::tgl::TglGetTickCountUs() - u64_ReplayStart;
+
+            if (u64_Due > u64_Elapsed)
+            {
+               const uint64_t u64_Wait = u64_Due - u64_Elapsed;
+               // Sleep for longer gaps to not burn CPU time, delay precisely for short ones
+               if (u64_Wait > 2000ULL)
+               {
+                  stw::tgl::TglSleep(static_cast<uint32_t>(u64_Wait / 1000ULL));
+               }
+               else
+               {
+                  stw::tgl::TglDelayUs(static_cast<uint32_t>(u64_Wait));
+               }
+            }
+         }
+
+         c_Msg.u64_TimeStamp = u64_ReplayStart + u64_Offset;
+         orc_Logger.HandleCanMessage(c_Msg, q_IsTx);
+         ++this->mu64_ReplayedMessages;
+
+         s32_ReadResult = orc_Reader.ReadNextMessage(c_Msg, q_IsTx);
+      }
+
+      if (this->mq_AbortRequested == true)
+      {
+         s32_Return = C_BUSY;
+      }
+      else if (s32_ReadResult == C_CONFIG)
+      {
+         s32_Return = C_CONFIG;
+      }
+      else
+      {
+         // End of file reached
+      }
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Requests the abort of a running replay
+
+   Can be called from another thread.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComTraceReplay::RequestAbort(void)
+{
+   this->mq_AbortRequested = true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Returns the number of messages passed to the logger by the current or last replay
+
+   \return
+   Number of replayed messages
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_OscComTraceReplay::GetReplayedMessages(void) const
+{
+   return this->mu64_ReplayedMessages;
+}
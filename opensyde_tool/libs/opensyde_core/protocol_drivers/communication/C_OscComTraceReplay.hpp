@@ -0,0 +1,53 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Class for replaying CAN trace files through a message logger (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCCOMTRACEREPLAY_HPP
+#define C_OSCCOMTRACEREPLAY_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <atomic>
+
+#include "stwtypes.hpp"
+#include "C_OscComTraceReaderBase.hpp"
+#include "C_OscComMessageLogger.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_OscComTraceReplay
+{
+public:
+   C_OscComTraceReplay(void);
+
+   int32_t Replay(C_OscComTraceReaderBase & orc_Reader, C_OscComMessageLogger & orc_Logger,
+                  const float64_t of64_SpeedFactor);
+   void RequestAbort(void);
+   uint64_t GetReplayedMessages(void) const;
+
+private:
+   //Avoid call
+   C_OscComTraceReplay(const C_OscComTraceReplay &);
+   C_OscComTraceReplay & operator =(const C_OscComTraceReplay &);
+
+   std::atomic<bool> mq_AbortRequested;
+   std::atomic<uint64_t> mu64_ReplayedMessages;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
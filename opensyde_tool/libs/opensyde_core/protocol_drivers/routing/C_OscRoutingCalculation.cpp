@@ -64,6 +64,34 @@ C_OscRoutingCalculation::C_OscRoutingCalculation(const vector<C_OscNode> & orc_A
    this->m_SearchRoute();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Constructor for calculation of routes to all target nodes at once
+
+   Use local only! (uses reference on nodes)
+
+   All buses are searched one time only for all targets.
+   Use GetBestRouteToTarget to get the results for the specific targets.
+
+   \param[in]     orc_AllNodes         All nodes in the system definition
+   \param[in]     orc_ActiveNodes      Flags for all available nodes in the system
+   \param[in]     ou32_StartBusIndex   Start bus for the routing
+   \param[in]     oe_Mode              Decision for update or diagnostic routing
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscRoutingCalculation::C_OscRoutingCalculation(const vector<C_OscNode> & orc_AllNodes,
+                                                 const vector<uint8_t> & orc_ActiveNodes,
+                                                 const uint32_t ou32_StartBusIndex, const E_Mode oe_Mode) :
+   mu32_StartBusIndex(ou32_StartBusIndex),
+   mu32_TargetNodeIndex(hu32_ALL_TARGETS),
+   me_Mode(oe_Mode),
+   ms32_ResultState(C_COM),
+   mq_PcBus(true),
+   mrc_AllNodes(orc_AllNodes),
+   mrc_ActiveNodes(orc_ActiveNodes)
+{
+   this->m_SearchRoute();
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   default destructor
 
@@ -96,46 +124,210 @@ const vector<C_OscRoutingRoute> * C_OscRoutingCalculation::GetRoutes(void) const
 */
 //----------------------------------------------------------------------------------------------------------------------
 const C_OscRoutingRoute * C_OscRoutingCalculation::GetBestRoute(void) const
+{
+   return mh_GetBestRoute(this->mc_RoutesToTarget);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Returns the result state of the calculation
+
+   \return
+   C_NO_ERR    Routes were found
+   C_RANGE     Target node does not exist
+   C_COM       No routes were found
+   C_CONFIG    A route was removed due to not possible routing from CAN to Ethernet
+   C_NOACT     Target function (update or diagnostic) deactivated on all connected bus. No routing necessary.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscRoutingCalculation::GetState(void) const
+{
+   return this->ms32_ResultState;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get the best route to a specific target node
+
+   Intended for instances calculating the routes to all targets.
+   The result is the same as the one of a calculation for this specific target node (GetState and GetBestRoute).
+
+   Nodes not usable as router share the result of the common search of all buses.
+   For nodes which would route to further buses the search itself depends on the target,
+   so a dedicated calculation is done for them.
+
+   \param[in]   ou32_TargetNodeIndex   Target node at the end of the routing
+   \param[out]  orc_Route              Best route to target (only valid if C_NO_ERR is returned)
+
+   \return
+   C_NO_ERR    Route was found
+   C_RANGE     Target node does not exist
+   C_COM       No routes were found
+   C_CONFIG    A route was removed due to not possible routing from CAN to Ethernet
+   C_NOACT     Target function (update or diagnostic) deactivated on all connected bus. No routing necessary.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscRoutingCalculation::GetBestRouteToTarget(const uint32_t ou32_TargetNodeIndex,
+                                                      C_OscRoutingRoute & orc_Route) const
+{
+   int32_t s32_Return;
+
+   if (this->mu32_TargetNodeIndex != hu32_ALL_TARGETS)
+   {
+      // Calculation was done for one specific target
+      if (ou32_TargetNodeIndex == this->mu32_TargetNodeIndex)
+      {
+         s32_Return = this->ms32_ResultState;
+      }
+      else
+      {
+         s32_Return = C_RANGE;
+      }
+   }
+   else if (ou32_TargetNodeIndex >= this->mrc_AllNodes.size())
+   {
+      osc_write_log_error("Routing calculation", "Invalid node index");
+      s32_Return = C_RANGE;
+   }
+   else if (this->mc_RouterNodes[ou32_TargetNodeIndex] == 1U)
+   {
+      // As target the node must not route; this changes the search. Calculate it separately.
+      const C_OscRoutingCalculation c_Calculation(this->mrc_AllNodes, this->mrc_ActiveNodes, this->mu32_StartBusIndex,
+                                                  ou32_TargetNodeIndex, this->me_Mode);
+      s32_Return = c_Calculation.GetState();
+      if (s32_Return == C_NO_ERR)
+      {
+         orc_Route = *c_Calculation.GetBestRoute();
+      }
+   }
+   else
+   {
+      s32_Return = this->m_CheckTargetNodeConfig(ou32_TargetNodeIndex);
+      if (s32_Return == C_NO_ERR)
+      {
+         std::vector<C_OscRoutingRoute> c_RoutesToTarget;
+
+         if (this->mrc_ActiveNodes[ou32_TargetNodeIndex] == 1U)
+         {
+            const C_OscNode & rc_Target = this->mrc_AllNodes[ou32_TargetNodeIndex];
+            std::vector<C_BusVisit>::const_iterator c_ItVisit;
+
+            // Same order as in m_CalculateRoutes: all open routes reaching one of the target buses are final routes
+            for (c_ItVisit = this->mc_BusVisits.begin(); c_ItVisit != this->mc_BusVisits.end(); ++c_ItVisit)
+            {
+               bool q_TargetOnBus = false;
+               uint32_t u32_ItfCounter;
+
+               for (u32_ItfCounter = 0U; u32_ItfCounter < rc_Target.c_Properties.c_ComInterfaces.size();
+                    ++u32_ItfCounter)
+               {
+                  const C_OscNodeComInterfaceSettings & rc_Itf = rc_Target.c_Properties.c_ComInterfaces[u32_ItfCounter];
+                  if ((rc_Itf.u32_BusIndex == c_ItVisit->u32_BusIndex) && (this->m_CheckItfForRouting(true, rc_Itf)))
+                  {
+                     q_TargetOnBus = true;
+                     break;
+                  }
+               }
+
+               if (q_TargetOnBus == true)
+               {
+                  if (c_ItVisit->q_PcBus == true)
+                  {
+                     // The target is on the bus connected to the PC already
+                     mh_AddOneRouteToTarget(C_OscRoutingRoute(ou32_TargetNodeIndex), c_RoutesToTarget);
+                  }
+                  else
+                  {
+                     std::vector<const C_OscRoutingRoute *>::const_iterator c_ItRoute;
+                     for (c_ItRoute = c_ItVisit->c_OpenRoutes.begin(); c_ItRoute != c_ItVisit->c_OpenRoutes.end();
+                          ++c_ItRoute)
+                     {
+                        C_OscRoutingRoute c_Route = **c_ItRoute;
+                        c_Route.u32_TargetNodeIndex = ou32_TargetNodeIndex;
+                        mh_AddOneRouteToTarget(c_Route, c_RoutesToTarget);
+                     }
+                  }
+               }
+            }
+         }
+
+         s32_Return = this->m_EvaluateRoutesToTarget(ou32_TargetNodeIndex, c_RoutesToTarget);
+         if (s32_Return == C_NO_ERR)
+         {
+            orc_Route = *mh_GetBestRoute(c_RoutesToTarget);
+         }
+      }
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Checks a specific interface of a specific node if it is relevant and usable
+
+   \param[in]       ou32_TargetNodeIndex     Node index of node to check
+   \param[in]       orc_ComItfSettings       Interface of node for check
+
+   \retval   true   Interface can be used
+   \retval   false  Interface can not be used or is not relevant
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscRoutingCalculation::CheckItfNumberForRouting(const uint32_t ou32_TargetNodeIndex,
+                                                       const C_OscNodeComInterfaceSettings & orc_ComItfSettings) const
+{
+   return this->m_CheckItfForRouting(ou32_TargetNodeIndex == this->mu32_TargetNodeIndex, orc_ComItfSettings);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Returns the best route of a list of routes
+
+   \param[in]  orc_RoutesToTarget  All routes to the target
+
+   \return
+   Valid Pointer:    Best route to target
+   NULL:             No route found
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_OscRoutingRoute * C_OscRoutingCalculation::mh_GetBestRoute(
+   const std::vector<C_OscRoutingRoute> & orc_RoutesToTarget)
 {
    const C_OscRoutingRoute * pc_Result = NULL;
 
-   if (this->mc_RoutesToTarget.size() > 0)
+   if (orc_RoutesToTarget.size() > 0)
    {
       uint32_t u32_CountHops = 0xFFFFFFFFU;
       uint32_t u32_Counter;
 
       // Search the smallest count of hops
-      for (u32_Counter = 0U; u32_Counter < this->mc_RoutesToTarget.size(); ++u32_Counter)
+      for (u32_Counter = 0U; u32_Counter < orc_RoutesToTarget.size(); ++u32_Counter)
       {
-         if (this->mc_RoutesToTarget[u32_Counter].c_VecRoutePoints.size() < u32_CountHops)
+         if (orc_RoutesToTarget[u32_Counter].c_VecRoutePoints.size() < u32_CountHops)
          {
-            u32_CountHops = static_cast<uint32_t>(this->mc_RoutesToTarget[u32_Counter].c_VecRoutePoints.size());
+            u32_CountHops = static_cast<uint32_t>(orc_RoutesToTarget[u32_Counter].c_VecRoutePoints.size());
 
             if (pc_Result == NULL)
             {
                // Save as first result
-               pc_Result = &this->mc_RoutesToTarget[u32_Counter];
+               pc_Result = &orc_RoutesToTarget[u32_Counter];
             }
          }
       }
 
       // Search a route with smallest count of hops and an Ethernet connection
-      for (u32_Counter = 0U; u32_Counter < this->mc_RoutesToTarget.size(); ++u32_Counter)
+      for (u32_Counter = 0U; u32_Counter < orc_RoutesToTarget.size(); ++u32_Counter)
       {
-         if ((this->mc_RoutesToTarget[u32_Counter].c_VecRoutePoints.size() == u32_CountHops) &&
-             (this->mc_RoutesToTarget[u32_Counter].c_VecRoutePoints.size() > 0U))
+         if ((orc_RoutesToTarget[u32_Counter].c_VecRoutePoints.size() == u32_CountHops) &&
+             (orc_RoutesToTarget[u32_Counter].c_VecRoutePoints.size() > 0U))
          {
             uint32_t u32_PointCounter;
 
             for (u32_PointCounter = 0U;
-                 u32_PointCounter < this->mc_RoutesToTarget[u32_Counter].c_VecRoutePoints.size();
+                 u32_PointCounter < orc_RoutesToTarget[u32_Counter].c_VecRoutePoints.size();
                  ++u32_PointCounter)
             {
-               if (this->mc_RoutesToTarget[u32_Counter].c_VecRoutePoints[u32_PointCounter].e_OutInterfaceType ==
+               if (orc_RoutesToTarget[u32_Counter].c_VecRoutePoints[u32_PointCounter].e_OutInterfaceType ==
                    C_OscSystemBus::eETHERNET)
                {
                   // Route with Ethernet
-                  pc_Result = &this->mc_RoutesToTarget[u32_Counter];
+                  pc_Result = &orc_RoutesToTarget[u32_Counter];
                   break;
                }
             }
@@ -147,40 +339,24 @@ const C_OscRoutingRoute * C_OscRoutingCalculation::GetBestRoute(void) const
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-/*! \brief   Returns the result state of the calculation
+/*! \brief   Checks a specific interface of a node if it is relevant and usable
 
-   \return
-   C_NO_ERR    Routes were found
-   C_RANGE     Target node does not exist
-   C_COM       No routes were found
-   C_CONFIG    A route was removed due to not possible routing from CAN to Ethernet
-   C_NOACT     Target function (update or diagnostic) deactivated on all connected bus. No routing necessary.
-*/
-//----------------------------------------------------------------------------------------------------------------------
-int32_t C_OscRoutingCalculation::GetState(void) const
-{
-   return this->ms32_ResultState;
-}
-
-//----------------------------------------------------------------------------------------------------------------------
-/*! \brief   Checks a specific interface of a specific node if it is relevant and usable
-
-   \param[in]       ou32_TargetNodeIndex     Node index of node to check
+   \param[in]       oq_IsTarget              Flag if the node of the interface is the target node
    \param[in]       orc_ComItfSettings       Interface of node for check
 
    \retval   true   Interface can be used
    \retval   false  Interface can not be used or is not relevant
 */
 //----------------------------------------------------------------------------------------------------------------------
-bool C_OscRoutingCalculation::CheckItfNumberForRouting(const uint32_t ou32_TargetNodeIndex,
-                                                       const C_OscNodeComInterfaceSettings & orc_ComItfSettings) const
+bool C_OscRoutingCalculation::m_CheckItfForRouting(const bool oq_IsTarget,
+                                                   const C_OscNodeComInterfaceSettings & orc_ComItfSettings) const
 {
    // Check if the interface can be used for routing
    bool q_Return = false;
 
    if (orc_ComItfSettings.GetBusConnected() == true)
    {
-      if (ou32_TargetNodeIndex == this->mu32_TargetNodeIndex)
+      if (oq_IsTarget == true)
       {
          // Node is target and must support the function on the current interface
 
@@ -231,40 +407,30 @@ void C_OscRoutingCalculation::m_SearchRoute(void)
    // reset the search
    this->mq_PcBus = true;
    this->mc_AllRoutePoints.clear();
+   this->mc_AllRoutePointsSet.clear();
    this->mc_RoutesToTarget.clear();
    this->mc_AllOpenRoutes.clear();
+   this->mc_AllOpenRoutesSet.clear();
+   this->mc_BusVisits.clear();
+   this->mc_RouterNodes.assign(this->mrc_AllNodes.size(), 0U);
 
-   if (this->mu32_TargetNodeIndex < this->mrc_AllNodes.size())
+   if (this->mu32_TargetNodeIndex == hu32_ALL_TARGETS)
+   {
+      // Search without target; the routes to the targets are assembled in GetBestRouteToTarget
+      this->m_SearchRoutePointsOnBus(this->mu32_StartBusIndex);
+      this->m_CalculateRoutes(this->mu32_StartBusIndex);
+      this->ms32_ResultState = C_NO_ERR;
+   }
+   else if (this->mu32_TargetNodeIndex < this->mrc_AllNodes.size())
    {
       // Is the node configured for update or diagnostic on its connected buses and is connected to a bus
-      int32_t s32_Result = this->m_CheckTargetNodeConfig();
+      const int32_t s32_Result = this->m_CheckTargetNodeConfig(this->mu32_TargetNodeIndex);
       if (s32_Result == C_NO_ERR)
       {
          // Start searching
          this->m_SearchRoutePointsOnBus(this->mu32_StartBusIndex);
          this->m_CalculateRoutes(this->mu32_StartBusIndex);
-         s32_Result = this->m_CheckRoutesForLimitations();
-
-         if (this->mc_RoutesToTarget.size() > 0)
-         {
-            // Minimum one valid route was found. Success
-            this->ms32_ResultState = C_NO_ERR;
-         }
-         else if (s32_Result != C_NO_ERR)
-         {
-            osc_write_log_info("Routing calculation", "No valid route found (target node index: " +
-                               C_SclString::IntToStr(this->mu32_TargetNodeIndex) +
-                               "). CAN to Ethernet routing is not possible.");
-            // A route was available, but was removed due to limitations. No valid routes are left
-            this->ms32_ResultState = s32_Result;
-         }
-         else
-         {
-            osc_write_log_info("Routing calculation", "No route found (target node index: " +
-                               C_SclString::IntToStr(this->mu32_TargetNodeIndex) + ")");
-            // No route available
-            this->ms32_ResultState = C_COM;
-         }
+         this->ms32_ResultState = this->m_EvaluateRoutesToTarget(this->mu32_TargetNodeIndex, this->mc_RoutesToTarget);
       }
       else
       {
@@ -282,19 +448,21 @@ void C_OscRoutingCalculation::m_SearchRoute(void)
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Checks the target node configuration for a routable setting
 
+   \param[in]       ou32_TargetNodeIndex     Node index of target node
+
    \return
    C_NO_ERR    Node is configured for correct routing
    C_NOACT     Target node must not be routed, because the relevant function is deactivated on all connected buses
    C_COM       No bus is connected to minimum one activated relevant function
 */
 //----------------------------------------------------------------------------------------------------------------------
-int32_t C_OscRoutingCalculation::m_CheckTargetNodeConfig(void) const
+int32_t C_OscRoutingCalculation::m_CheckTargetNodeConfig(const uint32_t ou32_TargetNodeIndex) const
 {
    // Check if the target node must be routable
    int32_t s32_Return;
    bool q_UsableBusFound = false;
    bool q_AtLeastOneFunctionActive = false;
-   const C_OscNode * const pc_Node = &this->mrc_AllNodes[this->mu32_TargetNodeIndex];
+   const C_OscNode * const pc_Node = &this->mrc_AllNodes[ou32_TargetNodeIndex];
 
    tgl_assert(pc_Node->pc_DeviceDefinition != NULL);
    if (pc_Node->pc_DeviceDefinition != NULL)
@@ -373,14 +541,14 @@ int32_t C_OscRoutingCalculation::m_CheckTargetNodeConfig(void) const
       // Minimum one function (diagnosis or update) is active but no bus is connected to a matching interface
       // No routing possible
       osc_write_log_info("Routing calculation", "No connected bus found (target node index: " +
-                         C_SclString::IntToStr(this->mu32_TargetNodeIndex) + ")");
+                         C_SclString::IntToStr(ou32_TargetNodeIndex) + ")");
       s32_Return = C_COM;
    }
    else
    {
       // Target node must not be routed, because the relevant function is deactivated on all buses
       osc_write_log_info("Routing calculation", "No usable bus found (target node index: " +
-                         C_SclString::IntToStr(this->mu32_TargetNodeIndex) + ")");
+                         C_SclString::IntToStr(ou32_TargetNodeIndex) + ")");
       s32_Return = C_NOACT;
    }
 
@@ -525,6 +693,7 @@ vector<uint32_t> C_OscRoutingCalculation::m_GetAllRoutePointsOfNodeOnOneInput(
 
                // save the route point
                this->m_AddOneRoutePoint(c_Point);
+               this->mc_RouterNodes[c_Point.u32_NodeIndex] = 1U;
 
                // this bus must be searched for the next routing points
                c_VecBussesToSearch.push_back(pc_ActNode->c_Properties.c_ComInterfaces[u32_OutItfCounter].u32_BusIndex);
@@ -545,18 +714,7 @@ vector<uint32_t> C_OscRoutingCalculation::m_GetAllRoutePointsOfNodeOnOneInput(
 void C_OscRoutingCalculation::m_AddOneRoutePoint(const C_OscRoutingRoutePoint & orc_Point)
 {
    // add the point only if it is not already in the vector
-   std::vector<C_OscRoutingRoutePoint>::const_iterator c_ItPoint;
-   bool q_Found = false;
-
-   for (c_ItPoint = this->mc_AllRoutePoints.begin(); c_ItPoint != this->mc_AllRoutePoints.end(); ++c_ItPoint)
-   {
-      if (orc_Point == (*c_ItPoint))
-      {
-         q_Found = true;
-      }
-   }
-
-   if (q_Found == false)
+   if (this->mc_AllRoutePointsSet.insert(orc_Point).second == true)
    {
       this->mc_AllRoutePoints.push_back(orc_Point);
    }
@@ -575,6 +733,28 @@ void C_OscRoutingCalculation::m_CalculateRoutes(const uint32_t ou32_BusIndex)
    set<uint32_t> c_SetBussesToSearch;
    set<uint32_t>::const_iterator c_ItBusToSearch;
 
+   if (this->mu32_TargetNodeIndex == hu32_ALL_TARGETS)
+   {
+      // Remember the open routes reaching this bus; targets on this bus are reached by exactly these routes.
+      // Routes added below end on other buses, so this is the state seen by every point of this bus.
+      C_BusVisit c_Visit;
+      c_Visit.u32_BusIndex = ou32_BusIndex;
+      c_Visit.q_PcBus = this->mq_PcBus;
+      if (this->mq_PcBus == false)
+      {
+         list<C_OscRoutingRoute>::const_iterator c_ItRoute;
+         for (c_ItRoute = this->mc_AllOpenRoutes.begin(); c_ItRoute != this->mc_AllOpenRoutes.end(); ++c_ItRoute)
+         {
+            if ((c_ItRoute->c_VecRoutePoints.size() > 0) &&
+                (c_ItRoute->c_VecRoutePoints.back().u32_OutBusIndex == ou32_BusIndex))
+            {
+               c_Visit.c_OpenRoutes.push_back(&(*c_ItRoute));
+            }
+         }
+      }
+      this->mc_BusVisits.push_back(c_Visit);
+   }
+
    // search all points with this bus as input
    for (u32_PointCounter = 0U; u32_PointCounter < this->mc_AllRoutePoints.size(); ++u32_PointCounter)
    {
@@ -589,7 +769,7 @@ void C_OscRoutingCalculation::m_CalculateRoutes(const uint32_t ou32_BusIndex)
             {
                // Special case: The target is on the bus connected to the PC already
                // No routing points necessary
-               this->m_AddOneRouteToTarget(c_Route);
+               mh_AddOneRouteToTarget(c_Route, this->mc_RoutesToTarget);
             }
             else
             {
@@ -603,16 +783,17 @@ void C_OscRoutingCalculation::m_CalculateRoutes(const uint32_t ou32_BusIndex)
          else
          {
             // Searching the matching routing points on the previous routes
-            const list<C_OscRoutingRoute> c_AllOldOpenRoutes = this->mc_AllOpenRoutes;
-            list<C_OscRoutingRoute>::const_iterator c_ItOldRoute;
+            // Only the routes existing before this point are relevant. Routes added while iterating are appended at
+            // the end of the list and are not visited.
+            const uint32_t u32_OldOpenRouteCount = static_cast<uint32_t>(this->mc_AllOpenRoutes.size());
+            list<C_OscRoutingRoute>::const_iterator c_ItOldRoute = this->mc_AllOpenRoutes.begin();
 
             // Further searching
             // The input bus of the actual route point must be equal to the output bus of the last routing point
             // of the route
             // One node shall be used in a route maximum one time
-            for (c_ItOldRoute = c_AllOldOpenRoutes.begin();
-                 c_ItOldRoute != c_AllOldOpenRoutes.end();
-                 ++c_ItOldRoute)
+            for (uint32_t u32_OldRouteCounter = 0U; u32_OldRouteCounter < u32_OldOpenRouteCount;
+                 ++u32_OldRouteCounter)
             {
                if ((*c_ItOldRoute).c_VecRoutePoints.size() > 0)
                {
@@ -628,7 +809,7 @@ void C_OscRoutingCalculation::m_CalculateRoutes(const uint32_t ou32_BusIndex)
                         // Special case: The target is on the current bus
                         // A usable final route.
                         // No further analysis of this variant, do not add it the open routes again.
-                        this->m_AddOneRouteToTarget(*c_ItOldRoute);
+                        mh_AddOneRouteToTarget(*c_ItOldRoute, this->mc_RoutesToTarget);
                      }
                      else
                      {
@@ -661,6 +842,7 @@ void C_OscRoutingCalculation::m_CalculateRoutes(const uint32_t ou32_BusIndex)
                      }
                   }
                }
+               ++c_ItOldRoute;
             }
          }
       }
@@ -687,46 +869,83 @@ void C_OscRoutingCalculation::m_CalculateRoutes(const uint32_t ou32_BusIndex)
 void C_OscRoutingCalculation::m_AddOneOpenRoute(const C_OscRoutingRoute & orc_Route)
 {
    // add the route only if it is not already in the list
-   std::list<C_OscRoutingRoute>::const_iterator c_ItRoute;
-   bool q_Found = false;
-
-   for (c_ItRoute = this->mc_AllOpenRoutes.begin(); c_ItRoute != this->mc_AllOpenRoutes.end(); ++c_ItRoute)
+   // (all open routes have the same target, so the route points identify the route)
+   if (this->mc_AllOpenRoutesSet.insert(orc_Route.c_VecRoutePoints).second == true)
    {
-      if (orc_Route == (*c_ItRoute))
-      {
-         q_Found = true;
-      }
+      this->mc_AllOpenRoutes.push_back(orc_Route);
    }
+}
 
-   if (q_Found == false)
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Evaluate the found routes to the target
+
+   Removes not usable routes and determines the result state.
+
+   \param[in]       ou32_TargetNodeIndex  Node index of target node
+   \param[in,out]   orc_RoutesToTarget    All found routes to the target; not usable routes are removed
+
+   \return
+   C_NO_ERR    Routes were found
+   C_COM       No routes were found
+   C_CONFIG    A route was removed due to not possible routing from CAN to Ethernet
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscRoutingCalculation::m_EvaluateRoutesToTarget(const uint32_t ou32_TargetNodeIndex,
+                                                          std::vector<C_OscRoutingRoute> & orc_RoutesToTarget) const
+{
+   int32_t s32_Return;
+   const int32_t s32_Result = mh_CheckRoutesForLimitations(orc_RoutesToTarget);
+
+   if (orc_RoutesToTarget.size() > 0)
    {
-      this->mc_AllOpenRoutes.push_back(orc_Route);
+      // Minimum one valid route was found. Success
+      s32_Return = C_NO_ERR;
    }
+   else if (s32_Result != C_NO_ERR)
+   {
+      osc_write_log_info("Routing calculation", "No valid route found (target node index: " +
+                         C_SclString::IntToStr(ou32_TargetNodeIndex) +
+                         "). CAN to Ethernet routing is not possible.");
+      // A route was available, but was removed due to limitations. No valid routes are left
+      s32_Return = s32_Result;
+   }
+   else
+   {
+      osc_write_log_info("Routing calculation", "No route found (target node index: " +
+                         C_SclString::IntToStr(ou32_TargetNodeIndex) + ")");
+      // No route available
+      s32_Return = C_COM;
+   }
+
+   return s32_Return;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Adds a calculated route which is routs to the target
 
-   \param[in]       orc_Route     Calculated route
+   \param[in]       orc_Route            Calculated route
+   \param[in,out]   orc_RoutesToTarget   All routes to the target
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OscRoutingCalculation::m_AddOneRouteToTarget(const C_OscRoutingRoute & orc_Route)
+void C_OscRoutingCalculation::mh_AddOneRouteToTarget(const C_OscRoutingRoute & orc_Route,
+                                                     std::vector<C_OscRoutingRoute> & orc_RoutesToTarget)
 {
    // add the route only if it is not already in the vector
    std::vector<C_OscRoutingRoute>::const_iterator c_ItRoute;
    bool q_Found = false;
 
-   for (c_ItRoute = this->mc_RoutesToTarget.begin(); c_ItRoute != this->mc_RoutesToTarget.end(); ++c_ItRoute)
+   for (c_ItRoute = orc_RoutesToTarget.begin(); c_ItRoute != orc_RoutesToTarget.end(); ++c_ItRoute)
    {
       if (orc_Route == (*c_ItRoute))
       {
          q_Found = true;
+         break;
       }
    }
 
    if (q_Found == false)
    {
-      this->mc_RoutesToTarget.push_back(orc_Route);
+      orc_RoutesToTarget.push_back(orc_Route);
    }
 }
 
@@ -735,18 +954,20 @@ void C_OscRoutingCalculation::m_AddOneRouteToTarget(const C_OscRoutingRoute & or
 
    Routing from CAN as in and Ethernet as out is not supported. These routes are not usable.
 
+   \param[in,out]   orc_RoutesToTarget   All routes to the target
+
    \retval   C_NO_ERR    Route is valid and usable
    \retval   C_CONFIG    A route was removed due to not possible routing from CAN to Ethernet
 */
 //----------------------------------------------------------------------------------------------------------------------
-int32_t C_OscRoutingCalculation::m_CheckRoutesForLimitations(void)
+int32_t C_OscRoutingCalculation::mh_CheckRoutesForLimitations(std::vector<C_OscRoutingRoute> & orc_RoutesToTarget)
 {
    int32_t s32_Return = C_NO_ERR;
 
    std::vector<C_OscRoutingRoute>::iterator c_ItRoute;
 
    // Check all routes
-   for (c_ItRoute = this->mc_RoutesToTarget.begin(); c_ItRoute != this->mc_RoutesToTarget.end();)
+   for (c_ItRoute = orc_RoutesToTarget.begin(); c_ItRoute != orc_RoutesToTarget.end();)
    {
       const C_OscRoutingRoute & rc_Route = *c_ItRoute;
       bool q_Removed = false;
@@ -762,7 +983,7 @@ int32_t C_OscRoutingCalculation::m_CheckRoutesForLimitations(void)
              (rc_Point.e_InInterfaceType == C_OscSystemBus::eCAN) &&
              (rc_Point.e_OutInterfaceType == C_OscSystemBus::eETHERNET))
          {
-            this->mc_RoutesToTarget.erase(c_ItRoute);
+            c_ItRoute = orc_RoutesToTarget.erase(c_ItRoute);
             q_Removed = true;
             s32_Return = C_CONFIG;
             break;
@@ -12,6 +12,7 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include <vector>
 #include <list>
+#include <set>
 
 #include "stwtypes.hpp"
 
@@ -40,21 +41,36 @@ public:
    C_OscRoutingCalculation(const std::vector<C_OscNode> & orc_AllNodes, const std::vector<uint8_t> & orc_ActiveNodes,
                            const uint32_t ou32_StartBusIndex, const uint32_t ou32_TargetNodeIndex,
                            const E_Mode oe_Mode);
+   C_OscRoutingCalculation(const std::vector<C_OscNode> & orc_AllNodes, const std::vector<uint8_t> & orc_ActiveNodes,
+                           const uint32_t ou32_StartBusIndex, const E_Mode oe_Mode);
    ~C_OscRoutingCalculation();
 
    const std::vector<C_OscRoutingRoute> * GetRoutes(void) const;
    const C_OscRoutingRoute * GetBestRoute(void) const;
    int32_t GetState(void) const;
+   int32_t GetBestRouteToTarget(const uint32_t ou32_TargetNodeIndex, C_OscRoutingRoute & orc_Route) const;
    bool CheckItfNumberForRouting(const uint32_t ou32_TargetNodeIndex,
                                  const C_OscNodeComInterfaceSettings & orc_ComItfSettings) const;
 
+   static const uint32_t hu32_ALL_TARGETS = 0xFFFFFFFFU; ///< Target index used for the all targets calculation
+
 private:
+   ///one call of m_CalculateRoutes in the all targets calculation
+   class C_BusVisit
+   {
+   public:
+      uint32_t u32_BusIndex;
+      bool q_PcBus;
+      std::vector<const C_OscRoutingRoute *> c_OpenRoutes; ///< open routes ending on this bus at the time of the visit
+   };
+
    //Avoid call
    C_OscRoutingCalculation(const C_OscRoutingCalculation &);
    C_OscRoutingCalculation & operator =(const C_OscRoutingCalculation &);
 
    void m_SearchRoute(void);
-   int32_t m_CheckTargetNodeConfig(void) const;
+   int32_t m_CheckTargetNodeConfig(const uint32_t ou32_TargetNodeIndex) const;
+   bool m_CheckItfForRouting(const bool oq_IsTarget, const C_OscNodeComInterfaceSettings & orc_ComItfSettings) const;
    void m_SearchRoutePointsOnBus(const uint32_t ou32_BusIndex);
    std::vector<uint32_t> m_GetAllRoutePointsOfNodeOnOneInput(const C_OscRoutingRoutePoint & orc_InPoint,
                                                              const uint32_t ou32_InItfNumber);
@@ -62,19 +78,28 @@ private:
 
    void m_CalculateRoutes(const uint32_t ou32_BusIndex);
    void m_AddOneOpenRoute(const C_OscRoutingRoute & orc_Route);
-   void m_AddOneRouteToTarget(const C_OscRoutingRoute & orc_Route);
+   int32_t m_EvaluateRoutesToTarget(const uint32_t ou32_TargetNodeIndex,
+                                    std::vector<C_OscRoutingRoute> & orc_RoutesToTarget) const;
 
-   int32_t m_CheckRoutesForLimitations(void);
+   static void mh_AddOneRouteToTarget(const C_OscRoutingRoute & orc_Route,
+                                      std::vector<C_OscRoutingRoute> & orc_RoutesToTarget);
+   static int32_t mh_CheckRoutesForLimitations(std::vector<C_OscRoutingRoute> & orc_RoutesToTarget);
+   static const C_OscRoutingRoute * mh_GetBestRoute(const std::vector<C_OscRoutingRoute> & orc_RoutesToTarget);
 
    uint32_t mu32_StartBusIndex;
    uint32_t mu32_TargetNodeIndex;
    E_Mode me_Mode;
 
    std::vector<C_OscRoutingRoutePoint> mc_AllRoutePoints;
+   std::set<C_OscRoutingRoutePoint> mc_AllRoutePointsSet; ///< for fast duplicate check of mc_AllRoutePoints
    std::vector<C_OscRoutingRoute> mc_RoutesToTarget;
    std::list<C_OscRoutingRoute> mc_AllOpenRoutes;
+   std::set<std::vector<C_OscRoutingRoutePoint> > mc_AllOpenRoutesSet; ///< for fast duplicate check of open routes
    int32_t ms32_ResultState;
 
+   std::vector<C_BusVisit> mc_BusVisits; ///< only filled for all targets calculation
+   std::vector<uint8_t> mc_RouterNodes;  ///< flags for nodes providing route points to further buses
+
    std::vector<uint32_t> mc_CheckedBuses;
    bool mq_PcBus;
 
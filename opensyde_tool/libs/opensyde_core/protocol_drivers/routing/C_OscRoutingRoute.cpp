@@ -105,6 +105,68 @@ bool C_OscRoutingRoutePoint::operator ==(const C_OscRoutingRoutePoint & orc_Cmp)
    return q_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check if current is smaller than orc_Cmp
+
+   Strict weak ordering over all members; allows using route points as keys of sorted containers.
+
+   \param[in] orc_Cmp Compared instance
+
+   \return
+   true     Current smaller than orc_Cmp
+   false    Current equal or bigger than orc_Cmp
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscRoutingRoutePoint::operator <(const C_OscRoutingRoutePoint & orc_Cmp) const
+{
+   bool q_Return;
+
+   if (this->u32_NodeIndex != orc_Cmp.u32_NodeIndex)
+   {
+      q_Return = (this->u32_NodeIndex < orc_Cmp.u32_NodeIndex);
+   }
+   else if (this->u32_InBusIndex != orc_Cmp.u32_InBusIndex)
+   {
+      q_Return = (this->u32_InBusIndex < orc_Cmp.u32_InBusIndex);
+   }
+   else if (this->u32_OutBusIndex != orc_Cmp.u32_OutBusIndex)
+   {
+      q_Return = (this->u32_OutBusIndex < orc_Cmp.u32_OutBusIndex);
+   }
+   else if (this->u8_InNodeId != orc_Cmp.u8_InNodeId)
+   {
+      q_Return = (this->u8_InNodeId < orc_Cmp.u8_InNodeId);
+   }
+   else if (this->u8_InInterfaceNumber != orc_Cmp.u8_InInterfaceNumber)
+   {
+      q_Return = (this->u8_InInterfaceNumber < orc_Cmp.u8_InInterfaceNumber);
+   }
+   else if (this->e_InInterfaceType != orc_Cmp.e_InInterfaceType)
+   {
+      q_Return = (this->e_InInterfaceType < orc_Cmp.e_InInterfaceType);
+   }
+   else if (this->u8_OutNodeId != orc_Cmp.u8_OutNodeId)
+   {
+      q_Return = (this->u8_OutNodeId < orc_Cmp.u8_OutNodeId);
+   }
+   else if (this->u8_OutInterfaceNumber != orc_Cmp.u8_OutInterfaceNumber)
+   {
+      q_Return = (this->u8_OutInterfaceNumber < orc_Cmp.u8_OutInterfaceNumber);
+   }
+   else
+   {
+      q_Return = (this->e_OutInterfaceType < orc_Cmp.e_OutInterfaceType);
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+
+   \param[in] ou32_TargetNodeIndex Index of target node
+*/
+//----------------------------------------------------------------------------------------------------------------------
 C_OscRoutingRoute::C_OscRoutingRoute(const uint32_t ou32_TargetNodeIndex) :
    u32_TargetNodeIndex(ou32_TargetNodeIndex)
 {
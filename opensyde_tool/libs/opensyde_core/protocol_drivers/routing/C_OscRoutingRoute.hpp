@@ -31,6 +31,7 @@ public:
    C_OscRoutingRoutePoint();
    bool operator !=(const C_OscRoutingRoutePoint & orc_Cmp) const;
    bool operator ==(const C_OscRoutingRoutePoint & orc_Cmp) const;
+   bool operator <(const C_OscRoutingRoutePoint & orc_Cmp) const;
 
    uint32_t u32_NodeIndex;
 
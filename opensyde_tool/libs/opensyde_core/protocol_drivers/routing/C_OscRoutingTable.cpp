@@ -0,0 +1,215 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Best routes to all nodes of a system seen from one bus (implementation)
+
+   Calculates the best routes to all nodes with one C_OscRoutingCalculation for all targets instead of one
+   calculation per target node. The result is identical to the one of the single target calculations.
+
+   Results are remembered for the last hu32_MAX_CACHE_ENTRIES configurations.
+   A configuration is identified by all data the route calculation depends on:
+   start bus, routing mode, active nodes, flashloader types of the devices and the interface settings of all nodes.
+   So repeated connects with the same system definition do not need to calculate anything.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include "stwtypes.hpp"
+#include "stwerrors.hpp"
+#include "C_SclChecksums.hpp"
+#include "C_OscRoutingTable.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::scl;
+using namespace stw::tgl;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+std::list<C_OscRoutingTable::C_CacheEntry> C_OscRoutingTable::mhc_Cache;
+C_TglCriticalSection C_OscRoutingTable::mhc_CacheLock;
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscRoutingTable::C_TargetRoute::C_TargetRoute(void) :
+   s32_State(C_NOACT),
+   c_Route(0U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get best routes to all active nodes
+
+   Same result per node as of C_OscRoutingCalculation for this specific target node:
+   s32_State as of GetState, c_Route as of GetBestRoute.
+   Not active nodes are reported with state C_NOACT.
+
+   \param[in]   orc_AllNodes         All nodes in the system definition
+   \param[in]   orc_ActiveNodes      Flags for all available nodes in the system
+   \param[in]   ou32_StartBusIndex   Start bus for the routing
+   \param[in]   oe_Mode              Decision for update or diagnostic routing
+   \param[out]  orc_Routes           Results for all nodes (same index as orc_AllNodes)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscRoutingTable::h_GetBestRoutes(const std::vector<C_OscNode> & orc_AllNodes,
+                                        const std::vector<uint8_t> & orc_ActiveNodes,
+                                        const uint32_t ou32_StartBusIndex,
+                                        const C_OscRoutingCalculation::E_Mode oe_Mode,
+                                        std::vector<C_TargetRoute> & orc_Routes)
+{
+   std::vector<uint8_t> c_Signature;
+   uint32_t u32_Hash = 0xFFFFFFFFU;
+   bool q_Found = false;
+
+   std::list<C_CacheEntry>::iterator c_ItEntry;
+
+   mh_GetSignature(orc_AllNodes, orc_ActiveNodes, ou32_StartBusIndex, oe_Mode, c_Signature);
+   C_SclChecksums::CalcCRC32(&c_Signature[0], static_cast<uint32_t>(c_Signature.size()), u32_Hash);
+
+   mhc_CacheLock.Acquire();
+   for (c_ItEntry = mhc_Cache.begin(); c_ItEntry != mhc_Cache.end(); ++c_ItEntry)
+   {
+      if ((c_ItEntry->u32_Hash == u32_Hash) && (c_ItEntry->c_Signature == c_Signature))
+      {
+         orc_Routes = c_ItEntry->c_Routes;
+         //keep most recently used entry at the front
+         mhc_Cache.splice(mhc_Cache.begin(), mhc_Cache, c_ItEntry);
+         q_Found = true;
+         break;
+      }
+   }
+   mhc_CacheLock.Release();
+
+   if (q_Found == false)
+   {
+      //calculate (without lock; might take some time)
+      const C_OscRoutingCalculation c_Calculation(orc_AllNodes, orc_ActiveNodes, ou32_StartBusIndex, oe_Mode);
+      C_CacheEntry c_NewEntry;
+
+      orc_Routes.clear();
+      orc_Routes.resize(orc_AllNodes.size());
+      for (uint32_t u32_NodeIndex = 0U; u32_NodeIndex < orc_AllNodes.size(); ++u32_NodeIndex)
+      {
+         if ((u32_NodeIndex < orc_ActiveNodes.size()) && (orc_ActiveNodes[u32_NodeIndex] == 1U))
+         {
+            orc_Routes[u32_NodeIndex].s32_State =
+               c_Calculation.GetBestRouteToTarget(u32_NodeIndex, orc_Routes[u32_NodeIndex].c_Route);
+         }
+      }
+
+      c_NewEntry.u32_Hash = u32_Hash;
+      c_NewEntry.c_Signature = c_Signature;
+      c_NewEntry.c_Routes = orc_Routes;
+
+      mhc_CacheLock.Acquire();
+      mhc_Cache.push_front(c_NewEntry);
+      while (mhc_Cache.size() > hu32_MAX_CACHE_ENTRIES)
+      {
+         mhc_Cache.pop_back();
+      }
+      mhc_CacheLock.Release();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Forget all remembered results
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscRoutingTable::h_ClearCache(void)
+{
+   mhc_CacheLock.Acquire();
+   mhc_Cache.clear();
+   mhc_CacheLock.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Assemble all data the route calculation depends on
+
+   \param[in]   orc_AllNodes         All nodes in the system definition
+   \param[in]   orc_ActiveNodes      Flags for all available nodes in the system
+   \param[in]   ou32_StartBusIndex   Start bus for the routing
+   \param[in]   oe_Mode              Decision for update or diagnostic routing
+   \param[out]  orc_Signature        Serialized data
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscRoutingTable::mh_GetSignature(const std::vector<C_OscNode> & orc_AllNodes,
+                                        const std::vector<uint8_t> & orc_ActiveNodes,
+                                        const uint32_t ou32_StartBusIndex,
+                                        const C_OscRoutingCalculation::E_Mode oe_Mode,
+                                        std::vector<uint8_t> & orc_Signature)
+{
+   orc_Signature.clear();
+   orc_Signature.reserve(16U + (orc_AllNodes.size() * 64U));
+   mh_AppendU32(ou32_StartBusIndex, orc_Signature);
+   mh_AppendU32(static_cast<uint32_t>(oe_Mode), orc_Signature);
+   mh_AppendU32(static_cast<uint32_t>(orc_AllNodes.size()), orc_Signature);
+   mh_AppendU32(static_cast<uint32_t>(orc_ActiveNodes.size()), orc_Signature);
+   orc_Signature.insert(orc_Signature.end(), orc_ActiveNodes.begin(), orc_ActiveNodes.end());
+
+   for (uint32_t u32_NodeIndex = 0U; u32_NodeIndex < orc_AllNodes.size(); ++u32_NodeIndex)
+   {
+      const C_OscNode & rc_Node = orc_AllNodes[u32_NodeIndex];
+      uint8_t u8_Flashloaders = 0U;
+
+      if ((rc_Node.pc_DeviceDefinition != NULL) &&
+          (rc_Node.u32_SubDeviceIndex < rc_Node.pc_DeviceDefinition->c_SubDevices.size()))
+      {
+         const C_OscSubDeviceDefinition & rc_SubDevice =
+            rc_Node.pc_DeviceDefinition->c_SubDevices[rc_Node.u32_SubDeviceIndex];
+         u8_Flashloaders = 0x80U;
+         u8_Flashloaders |= (rc_SubDevice.q_FlashloaderOpenSydeEthernet == true) ? 0x01U : 0x00U;
+         u8_Flashloaders |= (rc_SubDevice.q_FlashloaderOpenSydeCan == true) ? 0x02U : 0x00U;
+         u8_Flashloaders |= (rc_SubDevice.q_FlashloaderStwCan == true) ? 0x04U : 0x00U;
+      }
+      orc_Signature.push_back(u8_Flashloaders);
+
+      mh_AppendU32(static_cast<uint32_t>(rc_Node.c_Properties.c_ComInterfaces.size()), orc_Signature);
+      for (uint32_t u32_ItfIndex = 0U; u32_ItfIndex < rc_Node.c_Properties.c_ComInterfaces.size(); ++u32_ItfIndex)
+      {
+         const C_OscNodeComInterfaceSettings & rc_Itf = rc_Node.c_Properties.c_ComInterfaces[u32_ItfIndex];
+         uint8_t u8_Flags = 0U;
+
+         u8_Flags |= (rc_Itf.GetBusConnected() == true) ? 0x01U : 0x00U;
+         u8_Flags |= (rc_Itf.q_IsDiagnosisEnabled == true) ? 0x02U : 0x00U;
+         u8_Flags |= (rc_Itf.q_IsUpdateEnabled == true) ? 0x04U : 0x00U;
+         u8_Flags |= (rc_Itf.q_IsRoutingEnabled == true) ? 0x08U : 0x00U;
+
+         mh_AppendU32(rc_Itf.u32_BusIndex, orc_Signature);
+         orc_Signature.push_back(u8_Flags);
+         orc_Signature.push_back(rc_Itf.u8_NodeId);
+         orc_Signature.push_back(rc_Itf.u8_InterfaceNumber);
+         orc_Signature.push_back(static_cast<uint8_t>(rc_Itf.e_InterfaceType));
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Append value to signature
+
+   \param[in]      ou32_Value      Value to append
+   \param[in,out]  orc_Signature   Signature
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscRoutingTable::mh_AppendU32(const uint32_t ou32_Value, std::vector<uint8_t> & orc_Signature)
+{
+   orc_Signature.push_back(static_cast<uint8_t>(ou32_Value));
+   orc_Signature.push_back(static_cast<uint8_t>(ou32_Value >> 8U));
+   orc_Signature.push_back(static_cast<uint8_t>(ou32_Value >> 16U));
+   orc_Signature.push_back(static_cast<uint8_t>(ou32_Value >> 24U));
+}
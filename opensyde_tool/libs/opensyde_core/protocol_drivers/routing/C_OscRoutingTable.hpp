@@ -0,0 +1,76 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Best routes to all nodes of a system seen from one bus (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCROUTINGTABLE_HPP
+#define C_OSCROUTINGTABLE_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
+#include <list>
+
+#include "stwtypes.hpp"
+#include "TglTasks.hpp"
+#include "C_OscNode.hpp"
+#include "C_OscRoutingRoute.hpp"
+#include "C_OscRoutingCalculation.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_OscRoutingTable
+{
+public:
+   ///result for one target node
+   class C_TargetRoute
+   {
+   public:
+      C_TargetRoute(void);
+
+      int32_t s32_State;         ///< result state as of C_OscRoutingCalculation::GetState
+      C_OscRoutingRoute c_Route; ///< best route to target (only valid if s32_State is C_NO_ERR)
+   };
+
+   static void h_GetBestRoutes(const std::vector<C_OscNode> & orc_AllNodes,
+                               const std::vector<uint8_t> & orc_ActiveNodes, const uint32_t ou32_StartBusIndex,
+                               const C_OscRoutingCalculation::E_Mode oe_Mode, std::vector<C_TargetRoute> & orc_Routes);
+   static void h_ClearCache(void);
+
+   static const uint32_t hu32_MAX_CACHE_ENTRIES = 8U; ///< number of remembered system configurations
+
+private:
+   class C_CacheEntry
+   {
+   public:
+      uint32_t u32_Hash;                  ///< hash of c_Signature for fast search
+      std::vector<uint8_t> c_Signature;   ///< all routing relevant configuration data
+      std::vector<C_TargetRoute> c_Routes; ///< calculated routes to all nodes
+   };
+
+   static std::list<C_CacheEntry> mhc_Cache; ///< most recently used entry first
+   static stw::tgl::C_TglCriticalSection mhc_CacheLock;
+
+   static void mh_GetSignature(const std::vector<C_OscNode> & orc_AllNodes,
+                               const std::vector<uint8_t> & orc_ActiveNodes, const uint32_t ou32_StartBusIndex,
+                               const C_OscRoutingCalculation::E_Mode oe_Mode,
+                               std::vector<uint8_t> & orc_Signature);
+   static void mh_AppendU32(const uint32_t ou32_Value, std::vector<uint8_t> & orc_Signature);
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
@@ -0,0 +1,61 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Journal of nodes finished by a system update (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCSUCHECKPOINTJOURNAL_HPP
+#define C_OSCSUCHECKPOINTJOURNAL_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <map>
+
+#include "stwtypes.hpp"
+#include "C_SclString.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_OscSuCheckpointJournal
+{
+public:
+   ///checkpoint of one node that was updated completely
+   class C_NodeCheckpoint
+   {
+   public:
+      stw::scl::C_SclString c_PackageDigest; ///< digest of all files and settings written to the node
+      stw::scl::C_SclString c_SerialNumber;  ///< serial number of the updated device
+      stw::scl::C_SclString c_Fingerprint;   ///< application information read back from the device after the update
+   };
+
+   C_OscSuCheckpointJournal(void);
+
+   int32_t Open(const stw::scl::C_SclString & orc_FilePath, const stw::scl::C_SclString & orc_SystemIdentity);
+   int32_t Clear(void);
+
+   bool GetNodeCheckpoint(const uint32_t ou32_NodeIndex, C_NodeCheckpoint & orc_Checkpoint) const;
+   int32_t SetNodeCheckpoint(const uint32_t ou32_NodeIndex, const C_NodeCheckpoint & orc_Checkpoint);
+
+private:
+   stw::scl::C_SclString mc_FilePath;
+   stw::scl::C_SclString mc_SystemIdentity;             ///< identifies the system definition or update package
+   std::map<uint32_t, C_NodeCheckpoint> mc_Checkpoints; ///< checkpoints by node index
+
+   int32_t m_Save(void) const;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
@@ -19,6 +19,7 @@
 #include "C_SclString.hpp"
 #include "C_SclDateTime.hpp"
 #include "C_SclChecksums.hpp"
+#include "C_Md5Checksum.hpp"
 #include "TglUtils.hpp"
 #include "TglTime.hpp"
 #include "TglFile.hpp"
@@ -1813,6 +1814,266 @@ int32_t C_OscSuSequences::m_WriteFingerPrintOsy(void)
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get digest of everything written to one node
+
+   Covers the node name and device type, the content of all HEX/file based application files, NVM parameter set
+   (PSI) files and the PEM file as well as the security and debugger settings.
+   So a checkpoint does not match anymore as soon as anything to write to the node was changed.
+
+   \param[in]  orc_Node                  node to update
+   \param[in]  orc_ApplicationsToWrite   files and settings for node
+
+   \return
+   digest (empty string if one of the files could not be read)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SclString C_OscSuSequences::mh_GetCheckpointDigest(const C_OscNode & orc_Node,
+                                                     const C_DoFlash & orc_ApplicationsToWrite)
+{
+   C_SclString c_Digest;
+   C_SclString c_Content = orc_Node.c_Properties.c_Name + ";";
+   std::vector<C_SclString> c_PemFiles;
+   bool q_FilesOk;
+
+   if (orc_Node.pc_DeviceDefinition != NULL)
+   {
+      c_Content += orc_Node.pc_DeviceDefinition->c_DeviceName + ";";
+   }
+   if (orc_ApplicationsToWrite.c_PemFile != "")
+   {
+      c_PemFiles.push_back(orc_ApplicationsToWrite.c_PemFile);
+   }
+
+   q_FilesOk = mh_AddFilesToCheckpointDigest("flash", orc_ApplicationsToWrite.c_FilesToFlash, c_Content);
+   if (mh_AddFilesToCheckpointDigest("nvm", orc_ApplicationsToWrite.c_FilesToWriteToNvm, c_Content) == false)
+   {
+      q_FilesOk = false;
+   }
+   if (mh_AddFilesToCheckpointDigest("pem", c_PemFiles, c_Content) == false)
+   {
+      q_FilesOk = false;
+   }
+   c_Content += C_SclString::IntToStr(static_cast<uint32_t>(orc_ApplicationsToWrite.q_SendSecurityEnabledState)) +
+                C_SclString::IntToStr(static_cast<uint32_t>(orc_ApplicationsToWrite.q_SecurityEnabled)) +
+                C_SclString::IntToStr(static_cast<uint32_t>(orc_ApplicationsToWrite.q_SendDebuggerEnabledState)) +
+                C_SclString::IntToStr(static_cast<uint32_t>(orc_ApplicationsToWrite.q_DebuggerEnabled));
+
+   if (q_FilesOk == true)
+   {
+      c_Digest = stw::md5::C_Md5Checksum::GetMD5(reinterpret_cast<const uint8_t *>(c_Content.c_str()),
+                                                  c_Content.Length());
+   }
+   return c_Digest;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Add name and content digest of files to checkpoint digest input
+
+   The path is not relevant as the files might be copied to a temporary folder for each update.
+
+   \param[in]      orc_Category   category of files (keeps e.g. a file moved from flash to NVM list distinguishable)
+   \param[in]      orc_Files      files to add
+   \param[in,out]  orc_Content    digest input to extend
+
+   \retval   true    all files read
+   \retval   false   at least one file could not be read
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscSuSequences::mh_AddFilesToCheckpointDigest(const C_SclString & orc_Category,
+                                                     const std::vector<C_SclString> & orc_Files,
+                                                     C_SclString & orc_Content)
+{
+   bool q_FilesOk = true;
+
+   orc_Content += orc_Category + "(" + C_SclString::IntToStr(static_cast<uint32_t>(orc_Files.size())) + "):";
+   for (uint32_t u32_File = 0U; u32_File < orc_Files.size(); ++u32_File)
+   {
+      //digest over the file content
+      const C_SclString c_FileDigest = stw::md5::C_Md5Checksum::GetMD5(orc_Files[u32_File]);
+      if (c_FileDigest == "")
+      {
+         q_FilesOk = false;
+      }
+      orc_Content += TglExtractFileName(orc_Files[u32_File]) + ":" + c_FileDigest + ";";
+   }
+   return q_FilesOk;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read information identifying the current state of an openSYDE node
+
+   Reads the serial number and the information about all applications (name, version, build time, memory range).
+   Only address based nodes provide the application information. For file based nodes C_NOACT is returned as the
+   state of the node cannot be verified.
+
+   Assumptions/prerequisites (not explicitly checked by this function):
+   * mc_CurrentNode contains ID of node to work with
+   * server node is in Flashloader mode and connected
+
+   \param[in]   ou32_NodeIndex          index of node within mpc_SystemDefinition
+   \param[in]   orc_ProtocolFeatures    available features of the flashloader of the node
+   \param[out]  orc_SerialNumber        serial number of node
+   \param[out]  orc_Fingerprint         digest over the application information
+
+   \return
+   C_NO_ERR    information read
+   C_NOACT     node is file based or at least one application is not valid
+   C_COM       communication driver reported problem
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscSuSequences::m_ReadCheckpointFingerprintOsy(
+   const uint32_t ou32_NodeIndex, const C_OscProtocolDriverOsy::C_ListOfFeatures & orc_ProtocolFeatures,
+   C_SclString & orc_SerialNumber, C_SclString & orc_Fingerprint)
+{
+   int32_t s32_Return = C_NOACT;
+   const C_OscNode & rc_Node = this->mpc_SystemDefinition->c_Nodes[ou32_NodeIndex];
+
+   tgl_assert(rc_Node.pc_DeviceDefinition != NULL);
+   if ((rc_Node.pc_DeviceDefinition != NULL) &&
+       (rc_Node.u32_SubDeviceIndex < rc_Node.pc_DeviceDefinition->c_SubDevices.size()) &&
+       (rc_Node.pc_DeviceDefinition->c_SubDevices[rc_Node.u32_SubDeviceIndex].q_FlashloaderOpenSydeIsFileBased ==
+        false))
+   {
+      C_OscProtocolSerialNumber c_SerialNumber;
+      std::vector<C_OscProtocolDriverOsy::C_FlashBlockInfo> c_Blocks;
+
+      //reading flash block information requires security level 1
+      s32_Return = this->mpc_ComDriver->SendOsySetPreProgrammingMode(mc_CurrentNode, false);
+      if (s32_Return == C_NO_ERR)
+      {
+         s32_Return = this->mpc_ComDriver->SendOsySetSecurityLevel(mc_CurrentNode, 1U);
+      }
+      if (s32_Return == C_NO_ERR)
+      {
+         if (orc_ProtocolFeatures.q_ExtendedSerialNumberModeImplemented == false)
+         {
+            s32_Return = this->mpc_ComDriver->SendOsyReadSerialNumber(mc_CurrentNode, c_SerialNumber);
+         }
+         else
+         {
+            s32_Return = this->mpc_ComDriver->SendOsyReadSerialNumberExt(mc_CurrentNode, c_SerialNumber);
+         }
+      }
+      if (s32_Return == C_NO_ERR)
+      {
+         s32_Return = this->mpc_ComDriver->SendOsyReadAllFlashBlockData(mc_CurrentNode, c_Blocks);
+      }
+
+      if (s32_Return == C_NO_ERR)
+      {
+         C_SclString c_Content;
+
+         for (uint32_t u32_Block = 0U; u32_Block < c_Blocks.size(); ++u32_Block)
+         {
+            const C_OscProtocolDriverOsy::C_FlashBlockInfo & rc_Block = c_Blocks[u32_Block];
+            if (rc_Block.u8_SignatureValid != 0U)
+            {
+               s32_Return = C_NOACT;
+            }
+            c_Content += rc_Block.c_ApplicationName + ";" + rc_Block.c_ApplicationVersion + ";" +
+                         rc_Block.c_BuildDate + ";" + rc_Block.c_BuildTime + ";" +
+                         C_SclString::IntToHex(rc_Block.u32_BlockStartAddress, 8U) + ";" +
+                         C_SclString::IntToHex(rc_Block.u32_BlockEndAddress, 8U) + "|";
+         }
+         if (c_Blocks.size() == 0)
+         {
+            s32_Return = C_NOACT;
+         }
+         orc_SerialNumber = c_SerialNumber.GetSerialNumberAsFormattedString();
+         orc_Fingerprint = stw::md5::C_Md5Checksum::GetMD5(reinterpret_cast<const uint8_t *>(c_Content.c_str()),
+                                                           c_Content.Length());
+      }
+      else
+      {
+         s32_Return = C_COM;
+      }
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check whether the node was updated completely by an interrupted previous run
+
+   Assumptions/prerequisites (not explicitly checked by this function):
+   * mpc_CheckpointJournal is not NULL
+   * mc_CurrentNode contains ID of node to work with
+   * server node is in Flashloader mode and connected
+
+   \param[in]  ou32_NodeIndex            index of node within mpc_SystemDefinition
+   \param[in]  orc_ApplicationsToWrite   files and settings for node
+   \param[in]  orc_ProtocolFeatures      available features of the flashloader of the node
+
+   \retval   true    node is up to date; nothing to do
+   \retval   false   node needs to be updated
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscSuSequences::m_IsNodeCheckpointValid(const uint32_t ou32_NodeIndex, const C_DoFlash & orc_ApplicationsToWrite,
+                                              const C_OscProtocolDriverOsy::C_ListOfFeatures & orc_ProtocolFeatures)
+{
+   bool q_Return = false;
+   C_OscSuCheckpointJournal::C_NodeCheckpoint c_Checkpoint;
+
+   if ((this->mpc_CheckpointJournal->GetNodeCheckpoint(ou32_NodeIndex, c_Checkpoint) == true) &&
+       (c_Checkpoint.c_PackageDigest ==
+        mh_GetCheckpointDigest(this->mpc_SystemDefinition->c_Nodes[ou32_NodeIndex], orc_ApplicationsToWrite)))
+   {
+      C_SclString c_SerialNumber;
+      C_SclString c_Fingerprint;
+
+      if ((this->m_ReadCheckpointFingerprintOsy(ou32_NodeIndex, orc_ProtocolFeatures, c_SerialNumber,
+                                                c_Fingerprint) == C_NO_ERR) &&
+          (c_SerialNumber == c_Checkpoint.c_SerialNumber) && (c_Fingerprint == c_Checkpoint.c_Fingerprint))
+      {
+         (void)m_ReportProgress(eUPDATE_SYSTEM_OSY_NODE_CHECKPOINT_SKIPPED, C_NO_ERR, 90U, mc_CurrentNode,
+                                "Device was already updated by previous update run. Skipping device ...");
+         q_Return = true;
+      }
+      else
+      {
+         osc_write_log_info("System Update", "Checkpoint of node " + C_SclString::IntToStr(ou32_NodeIndex) +
+                            " does not match the device. Updating device.");
+      }
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Record finished node in checkpoint journal
+
+   Nodes whose state cannot be verified later (see m_ReadCheckpointFingerprintOsy) are not recorded.
+   Problems are only logged as the update itself was successful.
+
+   Assumptions/prerequisites (not explicitly checked by this function):
+   * mpc_CheckpointJournal is not NULL
+   * mc_CurrentNode contains ID of node to work with
+   * server node is in Flashloader mode and connected
+
+   \param[in]  ou32_NodeIndex            index of node within mpc_SystemDefinition
+   \param[in]  orc_ApplicationsToWrite   files and settings written to node
+   \param[in]  orc_ProtocolFeatures      available features of the flashloader of the node
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscSuSequences::m_WriteNodeCheckpoint(const uint32_t ou32_NodeIndex, const C_DoFlash & orc_ApplicationsToWrite,
+                                             const C_OscProtocolDriverOsy::C_ListOfFeatures & orc_ProtocolFeatures)
+{
+   C_OscSuCheckpointJournal::C_NodeCheckpoint c_Checkpoint;
+
+   c_Checkpoint.c_PackageDigest = mh_GetCheckpointDigest(this->mpc_SystemDefinition->c_Nodes[ou32_NodeIndex],
+                                                         orc_ApplicationsToWrite);
+   if ((c_Checkpoint.c_PackageDigest != "") &&
+       (this->m_ReadCheckpointFingerprintOsy(ou32_NodeIndex, orc_ProtocolFeatures, c_Checkpoint.c_SerialNumber,
+                                             c_Checkpoint.c_Fingerprint) == C_NO_ERR))
+   {
+      (void)this->mpc_CheckpointJournal->SetNodeCheckpoint(ou32_NodeIndex, c_Checkpoint);
+   }
+   else
+   {
+      osc_write_log_info("System Update", "No checkpoint recorded for node " + C_SclString::IntToStr(
+                            ou32_NodeIndex) + ". State of device cannot be verified.");
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Flash one STW Flashloader based node
 
@@ -2145,7 +2406,8 @@ int32_t C_OscSuSequences::m_ReadDeviceInformationStwFlashloader(const uint8_t ou
 C_OscSuSequences::C_OscSuSequences(void) :
    C_OscComSequencesBase(true, true),
    mu32_CurrentNode(0U),
-   mu32_CurrentFile(0U)
+   mu32_CurrentFile(0U),
+   mpc_CheckpointJournal(NULL)
 {
 }
 
@@ -3491,6 +3753,11 @@ int32_t C_OscSuSequences::ReadDeviceInformation(const bool oq_FailOnFirstError)
    * Reports 0..100 for the overall process
    * Reports 0..100 for each file of each individual node being flashed
 
+   Checkpoints:
+   If a checkpoint journal was set with SetCheckpointJournal() each finished openSYDE node is recorded in it.
+   Nodes recorded by a previous, interrupted run are skipped if the files to write are unchanged and the node still
+   reports the same serial number and application information. The journal is cleared after a successful update.
+
    \param[in]  orc_ApplicationsToWrite   list of files to flash per node; must have the same size as the system
                                           definition contains nodes
    \param[in]  orc_NodesOrder            Vector with node update order (index is update position, value is node index)
@@ -3836,6 +4103,7 @@ int32_t C_OscSuSequences::UpdateSystem(const std::vector<C_OscSuSequences::C_DoF
                      {
                         C_OscProtocolDriverOsy::C_ListOfFeatures c_AvailableFeatures;
                         bool q_SetProgrammingMode = true;
+                        bool q_NodeUpToDate = false;
 
                         //if connected via Ethernet we might need to reconnect (in case we ran into the session timeout)
                         s32_Return = this->m_ReconnectToTargetServer();
@@ -3863,66 +4131,84 @@ int32_t C_OscSuSequences::UpdateSystem(const std::vector<C_OscSuSequences::C_DoF
                            }
                         }
 
-                        //files to flash ?
-                        if ((s32_Return == C_NO_ERR) &&
-                            (orc_ApplicationsToWrite[u32_NodeIndex].c_FilesToFlash.size() > 0))
+                        //node already updated completely by an interrupted previous run ?
+                        if ((s32_Return == C_NO_ERR) && (this->mpc_CheckpointJournal != NULL))
                         {
-                           tgl_assert(u32_SubDeviceIndex < pc_DeviceDefinition->c_SubDevices.size());
-                           //address based or file based ?
-                           if (pc_DeviceDefinition->c_SubDevices[u32_SubDeviceIndex].q_FlashloaderOpenSydeIsFileBased ==
-                               false)
-                           {
-                              s32_Return = m_FlashNodeOpenSydeHex(
-                                 orc_ApplicationsToWrite[u32_NodeIndex].c_FilesToFlash,
-                                 orc_ApplicationsToWrite[u32_NodeIndex].c_OtherAcceptedDeviceNames,
-                                 pc_DeviceDefinition->c_SubDevices[u32_SubDeviceIndex].u32_FlashloaderOpenSydeRequestDownloadTimeout,
-                                 pc_DeviceDefinition->c_SubDevices[u32_SubDeviceIndex].u32_FlashloaderOpenSydeTransferDataTimeout,
-                                 q_SetProgrammingMode,
-                                 rc_NodeUpdateStates.c_StateHexFiles);
-                           }
-                           else
-                           {
-                              s32_Return = m_FlashNodeOpenSydeFile(
-                                 orc_ApplicationsToWrite[u32_NodeIndex].c_FilesToFlash,
-                                 pc_DeviceDefinition->c_SubDevices[u32_SubDeviceIndex].u32_FlashloaderOpenSydeRequestDownloadTimeout,
-                                 pc_DeviceDefinition->c_SubDevices[u32_SubDeviceIndex].u32_FlashloaderOpenSydeTransferDataTimeout,
-                                 c_AvailableFeatures,
-                                 q_SetProgrammingMode,
-                                 rc_NodeUpdateStates.c_StateOtherFiles);
-                           }
+                           q_NodeUpToDate = this->m_IsNodeCheckpointValid(u32_NodeIndex,
+                                                                          orc_ApplicationsToWrite[u32_NodeIndex],
+                                                                          c_AvailableFeatures);
                         }
 
-                        //files to write to Nvm ?
-                        if ((s32_Return == C_NO_ERR) &&
-                            (orc_ApplicationsToWrite[u32_NodeIndex].c_FilesToWriteToNvm.size() > 0))
+                        if (q_NodeUpToDate == false)
                         {
-                           s32_Return =
-                              m_WriteNvmOpenSyde(orc_ApplicationsToWrite[u32_NodeIndex].c_FilesToWriteToNvm,
-                                                 c_AvailableFeatures,
-                                                 q_SetProgrammingMode,
-                                                 rc_NodeUpdateStates.c_StatePsiFiles);
-                        }
+                           //files to flash ?
+                           if ((s32_Return == C_NO_ERR) &&
+                               (orc_ApplicationsToWrite[u32_NodeIndex].c_FilesToFlash.size() > 0))
+                           {
+                              tgl_assert(u32_SubDeviceIndex < pc_DeviceDefinition->c_SubDevices.size());
+                              //address based or file based ?
+                              if (pc_DeviceDefinition->c_SubDevices[u32_SubDeviceIndex].
+                                  q_FlashloaderOpenSydeIsFileBased == false)
+                              {
+                                 s32_Return = m_FlashNodeOpenSydeHex(
+                                    orc_ApplicationsToWrite[u32_NodeIndex].c_FilesToFlash,
+                                    orc_ApplicationsToWrite[u32_NodeIndex].c_OtherAcceptedDeviceNames,
+                                    pc_DeviceDefinition->c_SubDevices[u32_SubDeviceIndex].u32_FlashloaderOpenSydeRequestDownloadTimeout,
+                                    pc_DeviceDefinition->c_SubDevices[u32_SubDeviceIndex].u32_FlashloaderOpenSydeTransferDataTimeout,
+                                    q_SetProgrammingMode,
+                                    rc_NodeUpdateStates.c_StateHexFiles);
+                              }
+                              else
+                              {
+                                 s32_Return = m_FlashNodeOpenSydeFile(
+                                    orc_ApplicationsToWrite[u32_NodeIndex].c_FilesToFlash,
+                                    pc_DeviceDefinition->c_SubDevices[u32_SubDeviceIndex].u32_FlashloaderOpenSydeRequestDownloadTimeout,
+                                    pc_DeviceDefinition->c_SubDevices[u32_SubDeviceIndex].u32_FlashloaderOpenSydeTransferDataTimeout,
+                                    c_AvailableFeatures,
+                                    q_SetProgrammingMode,
+                                    rc_NodeUpdateStates.c_StateOtherFiles);
+                              }
+                           }
 
-                        // Special case: An other security level is necessary for the next steps.
-                        // The next step must set the programming mode with the other security level again
-                        q_SetProgrammingMode = true;
+                           //files to write to Nvm ?
+                           if ((s32_Return == C_NO_ERR) &&
+                               (orc_ApplicationsToWrite[u32_NodeIndex].c_FilesToWriteToNvm.size() > 0))
+                           {
+                              s32_Return =
+                                 m_WriteNvmOpenSyde(orc_ApplicationsToWrite[u32_NodeIndex].c_FilesToWriteToNvm,
+                                                    c_AvailableFeatures,
+                                                    q_SetProgrammingMode,
+                                                    rc_NodeUpdateStates.c_StatePsiFiles);
+                           }
 
-                        // PEM file to write?
-                        if (s32_Return == C_NO_ERR)
-                        {
-                           s32_Return = m_WritePemOpenSydeFile(orc_ApplicationsToWrite[u32_NodeIndex].c_PemFile,
-                                                               c_AvailableFeatures,
-                                                               q_SetProgrammingMode,
-                                                               rc_NodeUpdateStates.c_StatePemFile);
-                        }
+                           // Special case: An other security level is necessary for the next steps.
+                           // The next step must set the programming mode with the other security level again
+                           q_SetProgrammingMode = true;
 
-                        // States to write?
-                        if (s32_Return == C_NO_ERR)
-                        {
-                           s32_Return = m_WriteOpenSydeNodeStates(orc_ApplicationsToWrite[u32_NodeIndex],
+                           // PEM file to write?
+                           if (s32_Return == C_NO_ERR)
+                           {
+                              s32_Return = m_WritePemOpenSydeFile(orc_ApplicationsToWrite[u32_NodeIndex].c_PemFile,
                                                                   c_AvailableFeatures,
                                                                   q_SetProgrammingMode,
                                                                   rc_NodeUpdateStates.c_StatePemFile);
+                           }
+
+                           // States to write?
+                           if (s32_Return == C_NO_ERR)
+                           {
+                              s32_Return = m_WriteOpenSydeNodeStates(orc_ApplicationsToWrite[u32_NodeIndex],
+                                                                     c_AvailableFeatures,
+                                                                     q_SetProgrammingMode,
+                                                                     rc_NodeUpdateStates.c_StatePemFile);
+                           }
+
+                           //remember finished node so an interrupted update can continue after it
+                           if ((s32_Return == C_NO_ERR) && (this->mpc_CheckpointJournal != NULL))
+                           {
+                              this->m_WriteNodeCheckpoint(u32_NodeIndex, orc_ApplicationsToWrite[u32_NodeIndex],
+                                                          c_AvailableFeatures);
+                           }
                         }
 
                         (void)this->m_DisconnectFromTargetServer();
@@ -3978,12 +4264,31 @@ int32_t C_OscSuSequences::UpdateSystem(const std::vector<C_OscSuSequences::C_DoF
 
    if (s32_Return == C_NO_ERR)
    {
+      if (this->mpc_CheckpointJournal != NULL)
+      {
+         //all done; a new update of the same system shall start over
+         (void)this->mpc_CheckpointJournal->Clear();
+      }
       (void)m_ReportProgress(eUPDATE_SYSTEM_FINISHED, C_NO_ERR, 100U, "Finished System Update.");
    }
 
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set journal of finished nodes used by UpdateSystem
+
+   With a journal an interrupted update can be repeated without updating the nodes finished before again.
+   See UpdateSystem for details.
+
+   \param[in]  opc_Journal   journal to use (must be opened); NULL: do not use a journal
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscSuSequences::SetCheckpointJournal(C_OscSuCheckpointJournal * const opc_Journal)
+{
+   this->mpc_CheckpointJournal = opc_Journal;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Reset all devices in the system
 
@@ -189,6 +189,7 @@ SOURCES += \
     ../src/table_base/tree_base/C_TblTreSimpleModel.cpp \
     ../src/util/C_Uti.cpp \
     ../src/util/C_UtiClipBoardHelper.cpp \
+    ../src/util/C_UtiClipBoardMimeData.cpp \
     ../src/util/C_UtiFindNameHelper.cpp
 
 PRECOMPILED_HEADER = ../src/precompiled_headers/syde_flash/precomp_headers.hpp
@@ -358,6 +359,7 @@ HEADERS  += \
     ../src/table_base/tree_base/C_TblTreSimpleModel.hpp \
     ../src/util/C_Uti.hpp \
     ../src/util/C_UtiClipBoardHelper.hpp \
+    ../src/util/C_UtiClipBoardMimeData.hpp \
     ../src/util/C_UtiFindNameHelper.hpp
 
 FORMS    += \
@@ -335,6 +335,7 @@ SOURCES += ../src/main.cpp \
     ../src/system_definition/node_edit/datapools/C_SdNdeDpListDataSetView.cpp \
     ../src/opensyde_gui_elements/C_OgeTreeWidgetToolBarSearch.cpp \
     ../src/navigable_gui/C_NagToolBarSearchResults.cpp \
+    ../src/system_definition/C_SdSearchIndex.cpp \
     ../src/system_definition/C_SdSearchTreeWidget.cpp \
     ../src/opensyde_gui_elements/C_OgeTreeWidgetToolBarSearchItemWidget.cpp \
     ../src/opensyde_gui_elements/label/C_OgeLabToolBarSearchResultTitle.cpp \
@@ -403,7 +404,9 @@ SOURCES += ../src/main.cpp \
     ../src/system_definition/bus_edit/undo/C_SdBueUnoSignalDeleteCommand.cpp \
     ../src/system_definition/bus_edit/undo/C_SdBueUnoSignalMoveCommand.cpp \
     ../src/scene_base/C_SebUtil.cpp \
+    ../src/util/C_UtiUndoCommandMemoryBase.cpp \
     ../src/util/C_UtiUndoStack.cpp \
+    ../src/util/C_UtiUndoStackEntryCommand.cpp \
     ../src/system_definition/bus_edit/undo/C_SdBueUnoBusProtNodeConnectCommand.cpp \
     ../src/system_definition/bus_edit/undo/C_SdBueUnoBusProtNodeDisconnectCommand.cpp \
     ../src/system_definition/bus_edit/undo/C_SdBueUnoBusProtNodeConnectAndCreateCommand.cpp \
@@ -522,6 +525,7 @@ SOURCES += ../src/main.cpp \
     ../src/system_views/dashboards/undo/C_SyvDaUnoAddSnapshotCommand.cpp \
     ../src/system_views/dashboards/C_SyvDaCopyPasteManager.cpp \
     ../src/util/C_UtiClipBoardHelper.cpp \
+    ../src/util/C_UtiClipBoardMimeData.cpp \
     ../src/system_views/C_SyvClipBoardHelper.cpp \
     ../src/scene_base/undo/C_SebUnoSetupStyleCommand.cpp \
     ../src/opensyde_gui_elements/widget/C_OgeWiFontConfig.cpp \
@@ -556,6 +560,7 @@ SOURCES += ../src/main.cpp \
     ../src/opensyde_gui_elements/C_OgeDashboardProgressBar.cpp \
     ../src/system_views/communication/C_SyvComDriverThread.cpp \
     ../src/system_views/communication/C_SyvComDataDealer.cpp \
+    ../src/system_views/communication/C_SyvComDatapoolVerificationCache.cpp \
     ../src/opensyde_gui_elements/label/C_OgeLabDashboardDefaultNonScaling.cpp \
     ../src/opensyde_gui_elements/label/C_OgeLabDashboardDefault.cpp \
     ../src/opensyde_gui_elements/label/C_OgeLabDashboardProgressBarMaximum.cpp \
@@ -1259,6 +1264,7 @@ HEADERS  += \
     ../src/system_definition/node_edit/datapools/C_SdNdeDpListDataSetView.hpp \
     ../src/opensyde_gui_elements/C_OgeTreeWidgetToolBarSearch.hpp \
     ../src/navigable_gui/C_NagToolBarSearchResults.hpp \
+    ../src/system_definition/C_SdSearchIndex.hpp \
     ../src/system_definition/C_SdSearchTreeWidget.hpp \
     ../src/opensyde_gui_elements/C_OgeTreeWidgetToolBarSearchItemWidget.hpp \
     ../src/opensyde_gui_elements/label/C_OgeLabToolBarSearchResultTitle.hpp \
@@ -1327,7 +1333,9 @@ HEADERS  += \
     ../src/system_definition/bus_edit/undo/C_SdBueUnoSignalDeleteCommand.hpp \
     ../src/system_definition/bus_edit/undo/C_SdBueUnoSignalMoveCommand.hpp \
     ../src/scene_base/C_SebUtil.hpp \
+    ../src/util/C_UtiUndoCommandMemoryBase.hpp \
     ../src/util/C_UtiUndoStack.hpp \
+    ../src/util/C_UtiUndoStackEntryCommand.hpp \
     ../src/system_definition/bus_edit/undo/C_SdBueUnoBusProtNodeConnectCommand.hpp \
     ../src/system_definition/bus_edit/undo/C_SdBueUnoBusProtNodeDisconnectCommand.hpp \
     ../src/system_definition/bus_edit/undo/C_SdBueUnoBusProtNodeConnectAndCreateCommand.hpp \
@@ -1446,6 +1454,7 @@ HEADERS  += \
     ../src/system_views/dashboards/undo/C_SyvDaUnoAddSnapshotCommand.hpp \
     ../src/system_views/dashboards/C_SyvDaCopyPasteManager.hpp \
     ../src/util/C_UtiClipBoardHelper.hpp \
+    ../src/util/C_UtiClipBoardMimeData.hpp \
     ../src/system_views/C_SyvClipBoardHelper.hpp \
     ../src/scene_base/undo/C_SebUnoSetupStyleCommand.hpp \
     ../src/opensyde_gui_elements/widget/C_OgeWiFontConfig.hpp \
@@ -1480,6 +1489,7 @@ HEADERS  += \
     ../src/opensyde_gui_elements/C_OgeDashboardProgressBar.hpp \
     ../src/system_views/communication/C_SyvComDriverThread.hpp \
     ../src/system_views/communication/C_SyvComDataDealer.hpp \
+    ../src/system_views/communication/C_SyvComDatapoolVerificationCache.hpp \
     ../src/opensyde_gui_elements/label/C_OgeLabDashboardDefaultNonScaling.hpp \
     ../src/opensyde_gui_elements/label/C_OgeLabDashboardDefault.hpp \
     ../src/opensyde_gui_elements/label/C_OgeLabDashboardProgressBarMaximum.hpp \
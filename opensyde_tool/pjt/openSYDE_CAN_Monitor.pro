@@ -32,12 +32,15 @@ SOURCES += \
     ../src/can_monitor/can_monitor_gui_elements/widget/C_CamOgeWiSettingsBase.cpp \
     ../src/can_monitor/can_monitor_settings/C_CamMosDllWidgetLogic.cpp \
     ../src/can_monitor/util/C_CamUtiGeneric.cpp \
+    ../src/can_monitor/util/C_CamUtiTraceConverter.cpp \
     ../src/gettext/C_GtGetText.cpp \
     ../src/util/C_Uti.cpp \
     ../src/system_views/communication/C_SyvComMessageMonitor.cpp \
     ../src/system_views/communication/C_SyvComMessageLoggerFileBlf.cpp \
+    ../src/system_views/communication/C_SyvComTraceReaderBlf.cpp \
     ../src/system_views/communication/C_SyvComDriverThread.cpp \
     ../src/com_import_export/C_CieImportDbc.cpp \
+    ../src/com_import_export/C_CieDbcCache.cpp \
     ../src/com_import_export/C_CieConverter.cpp \
     ../src/system_definition/node_edit/datapools/C_SdNdeDpContentUtil.cpp\
     ../src/can_monitor/cam_main.cpp \
@@ -116,6 +119,7 @@ SOURCES += \
     ../src/can_monitor/util/C_CamUtiStyleSheets.cpp \
     ../src/can_monitor/can_monitor_gui_elements/label/C_CamOgeLabStatusBar.cpp \
     ../src/util/C_UtiClipBoardHelper.cpp \
+    ../src/util/C_UtiClipBoardMimeData.cpp \
     ../src/can_monitor/message_trace/C_CamMetClipBoardHelper.cpp \
     ../src/can_monitor/can_monitor_gui_elements/splitter/C_CamOgeSpi.cpp \
     ../src/opensyde_gui_elements/splitter/C_OgeSpiBase.cpp \
@@ -176,6 +180,7 @@ SOURCES += \
     ../src/can_monitor/message_generator/signals/C_CamGenSigWidget.cpp \
     ../src/table_base/C_TblViewInteraction.cpp \
     ../src/can_monitor/message_trace/C_CamMetTreeLoggerData.cpp \
+    ../src/can_monitor/message_trace/C_CamMetTreeLoggerDataStorage.cpp \
     ../src/can_monitor/can_monitor_gui_elements/group_box/C_CamOgeGbxMessageSignalsBorder.cpp \
     ../src/can_monitor/can_monitor_settings/C_CamMosDatabaseItemWidget.cpp \
     ../src/can_monitor/project/C_CamProDatabaseData.cpp \
@@ -269,10 +274,12 @@ HEADERS  += \
     ../src/can_monitor/can_monitor_gui_elements/widget/C_CamOgeWiSettingsBase.hpp \
     ../src/can_monitor/can_monitor_settings/C_CamMosDllWidgetLogic.hpp \
     ../src/can_monitor/util/C_CamUtiGeneric.hpp \
+    ../src/can_monitor/util/C_CamUtiTraceConverter.hpp \
     ../src/gettext/C_GtGetText.hpp \
     ../src/util/C_Uti.hpp \
     ../src/system_views/communication/C_SyvComMessageMonitor.hpp \
     ../src/system_views/communication/C_SyvComMessageLoggerFileBlf.hpp \
+    ../src/system_views/communication/C_SyvComTraceReaderBlf.hpp \
     ../src/system_views/communication/C_SyvComDriverThread.hpp \
     ../libs/flexlexer/FlexLexer.h \
     ../libs/dbc_driver_library/src/Vector/DBC.h \
@@ -302,6 +309,7 @@ HEADERS  += \
     ../libs/dbc_driver_library/src/Vector/DBC/stack.hh \
     ../libs/dbc_driver_library/src/Vector/DBC/vector_dbc_export.h \
     ../src/com_import_export/C_CieImportDbc.hpp \
+    ../src/com_import_export/C_CieDbcCache.hpp \
     ../src/com_import_export/C_CieConverter.hpp \
     ../src/system_definition/node_edit/datapools/C_SdNdeDpContentUtil.hpp \
     ../src/project_operations/C_PopErrorHandling.hpp \
@@ -368,6 +376,7 @@ HEADERS  += \
     ../src/can_monitor/can_monitor_gui_elements/label/C_CamOgeLabStatusBar.hpp \
     ../src/constants.hpp \
     ../src/util/C_UtiClipBoardHelper.hpp \
+    ../src/util/C_UtiClipBoardMimeData.hpp \
     ../src/can_monitor/message_trace/C_CamMetClipBoardHelper.hpp \
     ../src/can_monitor/can_monitor_gui_elements/splitter/C_CamOgeSpi.hpp \
     ../src/opensyde_gui_elements/splitter/C_OgeSpiBase.hpp \
@@ -428,6 +437,7 @@ HEADERS  += \
     ../src/can_monitor/message_generator/signals/C_CamGenSigWidget.hpp \
     ../src/table_base/C_TblViewInteraction.hpp \
     ../src/can_monitor/message_trace/C_CamMetTreeLoggerData.hpp \
+    ../src/can_monitor/message_trace/C_CamMetTreeLoggerDataStorage.hpp \
     ../src/can_monitor/can_monitor_gui_elements/group_box/C_CamOgeGbxMessageSignalsBorder.hpp \
     ../src/can_monitor/can_monitor_settings/C_CamMosDatabaseItemWidget.hpp \
     ../src/can_monitor/project/C_CamProDatabaseData.hpp \
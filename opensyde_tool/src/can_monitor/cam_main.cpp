@@ -20,6 +20,7 @@
 #include "C_PopErrorHandling.hpp"
 #include "C_OscLoggingHandler.hpp"
 #include "C_CamUtiStyleSheets.hpp"
+#include "C_CamUtiTraceConverter.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 
@@ -52,42 +53,53 @@ int32_t main(int32_t os32_Argc, char_t * opacn_Argv[])
 {
    int32_t s32_Result;
 
-   // turn on the DPI support**
-   QApplication::setAttribute(Qt::AA_EnableHighDpiScaling);
-   QGuiApplication::setHighDpiScaleFactorRoundingPolicy(Qt::HighDpiScaleFactorRoundingPolicy::PassThrough);
-
-   QApplication c_Appl(os32_Argc, opacn_Argv);
-   {
-      const QString c_BinaryHash = stw::opensyde_gui_logic::C_Uti::h_GetHashValueAsQtString();
-      const QString c_FilePath = stw::opensyde_gui_logic::C_Uti::h_GetCompleteLogFileLocation(".syde_cam_log");
-
-      //Set up logging (FIRST)
-      stw::opensyde_core::C_OscLoggingHandler::h_SetWriteToConsoleActive(false);
-      stw::opensyde_core::C_OscLoggingHandler::h_SetWriteToFileActive(true);
-      stw::opensyde_core::C_OscLoggingHandler::h_SetCompleteLogFileLocation(c_FilePath.toStdString().c_str());
-
-      osc_write_log_info("Startup", static_cast<QString>("Starting openSYDE CAN Monitor(MD5-Checksum: " +
-                                                         c_BinaryHash + ")").toStdString().c_str());
-   }
+   if (stw::opensyde_gui_logic::C_CamUtiTraceConverter::h_IsConversionRequested(os32_Argc, opacn_Argv) == true)
    {
-      //Set stylesheet (SECOND)
-      c_Appl.setStyleSheet(stw::opensyde_gui_logic::C_CamUtiStyleSheets::h_GetStylesheet());
+      // Headless trace conversion without GUI
+      const QCoreApplication c_Appl(os32_Argc, opacn_Argv);
+      stw::opensyde_core::C_OscLoggingHandler::h_SetWriteToConsoleActive(true);
+      stw::opensyde_core::C_OscLoggingHandler::h_SetWriteToFileActive(false);
+      s32_Result = stw::opensyde_gui_logic::C_CamUtiTraceConverter::h_Convert(os32_Argc, opacn_Argv);
    }
+   else
    {
-      const QString c_TranslationLocation = stw::opensyde_gui_logic::C_Uti::h_GetExePath() + "/Translations";
-      //Set language (THIRD)
-      //stw::opensyde_core::C_OscGetText::h_SetLanguage("en_US");
-      stw::opensyde_gui_logic::C_PopErrorHandling::h_GetTextInitializeErr(
-         stw::opensyde_gui_logic::C_GtGetText::h_Initialize(c_TranslationLocation.toStdString().c_str(), "en_US"));
-   }
-   {
-      //Application (FOURTH)
-      stw::opensyde_gui::C_CamMainWindow c_Window;
-
-      c_Window.show();
-
-      //lint -e{1705} Working Qt example code
-      s32_Result = c_Appl.exec();
+      // turn on the DPI support**
+      QApplication::setAttribute(Qt::AA_EnableHighDpiScaling);
+      QGuiApplication::setHighDpiScaleFactorRoundingPolicy(Qt::HighDpiScaleFactorRoundingPolicy::PassThrough);
+
+      QApplication c_Appl(os32_Argc, opacn_Argv);
+      {
+         const QString c_BinaryHash = stw::opensyde_gui_logic::C_Uti::h_GetHashValueAsQtString();
+         const QString c_FilePath = stw::opensyde_gui_logic::C_Uti::h_GetCompleteLogFileLocation(".syde_cam_log");
+
+         //Set up logging (FIRST)
+         stw::opensyde_core::C_OscLoggingHandler::h_SetWriteToConsoleActive(false);
+         stw::opensyde_core::C_OscLoggingHandler::h_SetWriteToFileActive(true);
+         stw::opensyde_core::C_OscLoggingHandler::h_SetCompleteLogFileLocation(c_FilePath.toStdString().c_str());
+
+         osc_write_log_info("Startup", static_cast<QString>("Starting openSYDE CAN Monitor(MD5-Checksum: " +
+                                                            c_BinaryHash + ")").toStdString().c_str());
+      }
+      {
+         //Set stylesheet (SECOND)
+         c_Appl.setStyleSheet(stw::opensyde_gui_logic::C_CamUtiStyleSheets::h_GetStylesheet());
+      }
+      {
+         const QString c_TranslationLocation = stw::opensyde_gui_logic::C_Uti::h_GetExePath() + "/Translations";
+         //Set language (THIRD)
+         //stw::opensyde_core::C_OscGetText::h_SetLanguage("en_US");
+         stw::opensyde_gui_logic::C_PopErrorHandling::h_GetTextInitializeErr(
+            stw::opensyde_gui_logic::C_GtGetText::h_Initialize(c_TranslationLocation.toStdString().c_str(), "en_US"));
+      }
+      {
+         //Application (FOURTH)
+         stw::opensyde_gui::C_CamMainWindow c_Window;
+
+         c_Window.show();
+
+         //lint -e{1705} Working Qt example code
+         s32_Result = c_Appl.exec();
+      }
    }
    return s32_Result;
 }
@@ -252,6 +252,9 @@ void C_CamMetControlBarWidget::LoadUserSettings(void)
 
    Q_EMIT (this->SigDisplayTimestampTimeOfDay(this->mq_DisplayTimestampAbsoluteTimeOfDay));
    Q_EMIT (this->SigTraceBufferSize(this->mu32_TraceBufferSize));
+   // Memory limit is only configurable in user settings file
+   Q_EMIT (this->SigTraceBufferMemoryLimit(C_UsHandler::h_GetInstance()->GetTraceSettingBufferMemoryLimit(),
+                                           C_UsHandler::h_GetInstance()->GetTraceSettingBufferSpillToFile()));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -67,6 +67,7 @@ Q_SIGNALS:
    void SigDisplayTimestampRelative(const bool oq_Value);
    void SigDisplayTimestampTimeOfDay(const bool oq_Value);
    void SigTraceBufferSize(const uint32_t ou32_Value);
+   void SigTraceBufferMemoryLimit(const uint32_t ou32_LimitMiB, const bool oq_SpillToFile);
    void SigChangeProtocol(const stw::cmon_protocol::e_CanMonL7Protocols oe_Protocol);
    void SigDisplayTree(const bool oq_Show);
    void SigDisplayUniqueMessages(const bool oq_Unique);
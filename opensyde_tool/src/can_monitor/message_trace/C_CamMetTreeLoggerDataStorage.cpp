@@ -0,0 +1,779 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Chunked storage of compact trace records (implementation)
+
+   Stores the messages of the continuous trace as compact binary records instead of complete
+   C_CamMetTreeLoggerData instances.
+   A record only contains the raw CAN message, the time stamps and the interpreted texts
+   (name, protocol, signals). All strings which can be derived from the raw message (CAN ID, DLC, data bytes,
+   time stamps) are created again on decoding, which is only done for the rows the view actually requests.
+
+   The records are placed in chunks of (at least) hu32_CHUNK_SIZE bytes, so appending never moves already stored
+   records and dropping the oldest records releases complete chunks.
+
+   Two limits are applied on each append:
+   * Number of records (trace buffer size): the oldest records get dropped
+   * Memory: the oldest chunks get dropped, or, if activated, written to a temporary file and read back on demand
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <cstring>
+
+#include "stwtypes.hpp"
+#include "stwerrors.hpp"
+#include "C_CamMetTreeLoggerDataStorage.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::scl;
+using namespace stw::opensyde_core;
+using namespace stw::opensyde_gui_logic;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint8_t mu8_FLAG_IS_TX = 0x01U;
+const uint8_t mu8_FLAG_DLC_ERROR = 0x02U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_CamMetTreeLoggerDataStorage::C_Chunk::C_Chunk(void) :
+   u64_FirstSequence(0U),
+   u32_DataSize(0U),
+   u32_Capacity(0U),
+   q_Spilled(false),
+   u64_FileOffset(0U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+
+   No limits are active by default.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_CamMetTreeLoggerDataStorage::C_CamMetTreeLoggerDataStorage(void) :
+   mu64_FirstSequence(0U),
+   mu32_Count(0U),
+   mu64_MemoryUsed(0U),
+   mu32_MaxRecords(0xFFFFFFFFUL),
+   mu64_MaxMemoryBytes(0xFFFFFFFFFFFFFFFFULL),
+   mq_SpillToFile(false),
+   mu64_SpillFileSize(0U),
+   mu64_ReloadedSequence(0U),
+   mq_ReloadedValid(false)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Set limits of storage
+
+   The limits are applied with the next call of AppendRecord.
+
+   \param[in]  ou32_MaxRecords      Maximum number of stored records
+   \param[in]  ou64_MaxMemoryBytes  Maximum number of bytes held in memory
+                                    (at least one chunk is always kept in memory)
+   \param[in]  oq_SpillToFile       Flag to write the oldest chunks to a temporary file instead of dropping them
+                                    if the memory limit is reached
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeLoggerDataStorage::SetLimits(const uint32_t ou32_MaxRecords, const uint64_t ou64_MaxMemoryBytes,
+                                              const bool oq_SpillToFile)
+{
+   this->mu32_MaxRecords = ou32_MaxRecords;
+   this->mu64_MaxMemoryBytes = ou64_MaxMemoryBytes;
+   this->mq_SpillToFile = oq_SpillToFile;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Remove all records
+
+   The sequence numbers are not reset, so a sequence number is never reused.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeLoggerDataStorage::Clear(void)
+{
+   this->mu64_FirstSequence += this->mu32_Count;
+   this->mu32_Count = 0U;
+   this->mc_Chunks.clear();
+   this->mu64_MemoryUsed = 0U;
+   this->mc_FreeFileSlots.clear();
+   this->mu64_SpillFileSize = 0U;
+   if (this->mc_SpillFile.isOpen() == true)
+   {
+      this->mc_SpillFile.resize(0);
+   }
+   this->mc_ReloadedData.clear();
+   this->mq_ReloadedValid = false;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Encode message to compact record
+
+   Grey out information is not part of the record.
+
+   \param[in]   orc_Data     Message to encode
+   \param[out]  orc_Record   Encoded record
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeLoggerDataStorage::h_EncodeRecord(const C_OscComMessageLoggerData & orc_Data,
+                                                   std::vector<uint8_t> & orc_Record)
+{
+   uint8_t u8_Flags = 0U;
+   const uint16_t u16_SignalCount = static_cast<uint16_t>(orc_Data.c_Signals.size());
+
+   orc_Record.clear();
+   mh_AppendRaw(&orc_Data.u64_TimeStampRelative, sizeof(orc_Data.u64_TimeStampRelative), orc_Record);
+   mh_AppendRaw(&orc_Data.u64_TimeStampAbsoluteStart, sizeof(orc_Data.u64_TimeStampAbsoluteStart), orc_Record);
+   mh_AppendRaw(&orc_Data.u64_TimeStampAbsoluteTimeOfDay, sizeof(orc_Data.u64_TimeStampAbsoluteTimeOfDay),
+                orc_Record);
+   mh_AppendRaw(&orc_Data.c_CanMsg, sizeof(orc_Data.c_CanMsg), orc_Record);
+   if (orc_Data.q_IsTx == true)
+   {
+      u8_Flags |= mu8_FLAG_IS_TX;
+   }
+   if (orc_Data.q_CanDlcError == true)
+   {
+      u8_Flags |= mu8_FLAG_DLC_ERROR;
+   }
+   orc_Record.push_back(u8_Flags);
+   mh_AppendString(orc_Data.c_Name, orc_Record);
+   mh_AppendString(orc_Data.c_ProtocolTextDec, orc_Record);
+   mh_AppendString(orc_Data.c_ProtocolTextHex, orc_Record);
+   mh_AppendString(orc_Data.c_Counter, orc_Record);
+   mh_AppendString(orc_Data.c_Status, orc_Record);
+
+   mh_AppendRaw(&u16_SignalCount, sizeof(u16_SignalCount), orc_Record);
+   for (uint16_t u16_ItSignal = 0U; u16_ItSignal < u16_SignalCount; ++u16_ItSignal)
+   {
+      const C_OscComMessageLoggerDataSignal & rc_Signal = orc_Data.c_Signals[u16_ItSignal];
+      orc_Record.push_back((rc_Signal.q_DlcError == true) ? 1U : 0U);
+      mh_AppendRaw(&rc_Signal.c_OscSignal, sizeof(rc_Signal.c_OscSignal), orc_Record);
+      mh_AppendString(rc_Signal.c_Name, orc_Record);
+      mh_AppendString(rc_Signal.c_Value, orc_Record);
+      mh_AppendString(rc_Signal.c_Unit, orc_Record);
+      mh_AppendString(rc_Signal.c_RawValueDec, orc_Record);
+      mh_AppendString(rc_Signal.c_RawValueHex, orc_Record);
+      mh_AppendString(rc_Signal.c_Comment, orc_Record);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Check if records can be appended without dropping any stored record
+
+   The result is conservative: if spilling to file is active, records which would only cause a spill are
+   reported as drop too.
+
+   \param[in]  orc_Records    Encoded records to check
+
+   \retval   true    All records can be appended without dropping
+   \retval   false   Appending will drop the oldest records
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CamMetTreeLoggerDataStorage::CanAppendWithoutDrop(const std::vector<std::vector<uint8_t> > & orc_Records)
+const
+{
+   bool q_Retval = false;
+
+   if ((static_cast<uint64_t>(this->mu32_Count) + orc_Records.size()) <= this->mu32_MaxRecords)
+   {
+      uint64_t u64_Memory = this->mu64_MemoryUsed;
+      uint32_t u32_Free = 0U;
+
+      if (this->mc_Chunks.empty() == false)
+      {
+         u32_Free = this->mc_Chunks.back().u32_Capacity - this->mc_Chunks.back().u32_DataSize;
+      }
+      //Same steps as AppendRecord
+      for (uint32_t u32_ItRecord = 0U; u32_ItRecord < orc_Records.size(); ++u32_ItRecord)
+      {
+         const uint32_t u32_Size = static_cast<uint32_t>(orc_Records[u32_ItRecord].size());
+         if (u32_Size > u32_Free)
+         {
+            const uint32_t u32_Capacity = (u32_Size > hu32_CHUNK_SIZE) ? u32_Size : hu32_CHUNK_SIZE;
+            u64_Memory += u32_Capacity;
+            u32_Free = u32_Capacity;
+         }
+         u32_Free -= u32_Size;
+         u64_Memory += sizeof(uint32_t);
+      }
+      q_Retval = (u64_Memory <= this->mu64_MaxMemoryBytes);
+   }
+   return q_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Append encoded record as newest record and apply limits
+
+   \param[in]  orc_Record  Record encoded by h_EncodeRecord
+
+   \return
+   Number of oldest records dropped because of the limits
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_CamMetTreeLoggerDataStorage::AppendRecord(const std::vector<uint8_t> & orc_Record)
+{
+   uint32_t u32_Dropped = 0U;
+   const uint32_t u32_Size = static_cast<uint32_t>(orc_Record.size());
+
+   if ((this->mc_Chunks.empty() == true) ||
+       ((this->mc_Chunks.back().u32_DataSize + u32_Size) > this->mc_Chunks.back().u32_Capacity))
+   {
+      //Start new chunk; the capacity is reserved once so the chunk data is never moved
+      this->mc_Chunks.push_back(C_Chunk());
+      C_Chunk & rc_New = this->mc_Chunks.back();
+      rc_New.u64_FirstSequence = this->mu64_FirstSequence + this->mu32_Count;
+      rc_New.u32_Capacity = (u32_Size > hu32_CHUNK_SIZE) ? u32_Size : hu32_CHUNK_SIZE;
+      rc_New.c_Data.reserve(rc_New.u32_Capacity);
+      this->mu64_MemoryUsed += rc_New.u32_Capacity;
+   }
+   {
+      C_Chunk & rc_Chunk = this->mc_Chunks.back();
+      rc_Chunk.c_Offsets.push_back(rc_Chunk.u32_DataSize);
+      rc_Chunk.c_Data.insert(rc_Chunk.c_Data.end(), orc_Record.begin(), orc_Record.end());
+      rc_Chunk.u32_DataSize += u32_Size;
+      this->mu64_MemoryUsed += sizeof(uint32_t);
+      ++this->mu32_Count;
+   }
+
+   this->m_EnforceLimits(u32_Dropped);
+
+   return u32_Dropped;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get number of stored records
+
+   \return
+   Number of stored records
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_CamMetTreeLoggerDataStorage::GetCount(void) const
+{
+   return this->mu32_Count;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get unique sequence number of record
+
+   Can be used as key for caching decoded records.
+
+   \param[in]  ou32_Index  Index of record (0 = oldest)
+
+   \return
+   Sequence number of record
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_CamMetTreeLoggerDataStorage::GetSequenceNumber(const uint32_t ou32_Index) const
+{
+   return this->mu64_FirstSequence + ou32_Index;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Decode stored record
+
+   \param[in]   ou32_Index  Index of record (0 = oldest)
+   \param[out]  orc_Data    Decoded message with all strings
+
+   \return
+   C_NO_ERR    Record decoded
+   C_RANGE     Index out of range
+   C_RD_WR     Could not read record from spill file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_CamMetTreeLoggerDataStorage::GetRecord(const uint32_t ou32_Index, C_CamMetTreeLoggerData & orc_Data) const
+{
+   int32_t s32_Retval = C_RANGE;
+
+   if (ou32_Index < this->mu32_Count)
+   {
+      const uint64_t u64_Sequence = this->mu64_FirstSequence + ou32_Index;
+      const C_Chunk & rc_Chunk = this->mc_Chunks[this->m_GetChunkIndex(u64_Sequence)];
+      const uint8_t * const pu8_Data = this->m_GetChunkData(rc_Chunk);
+
+      if (pu8_Data != NULL)
+      {
+         const uint32_t u32_Offset = rc_Chunk.c_Offsets[static_cast<uint32_t>(u64_Sequence -
+                                                                              rc_Chunk.u64_FirstSequence)];
+         mh_DecodeRecord(&pu8_Data[u32_Offset], orc_Data);
+         orc_Data.c_GreyOutInformation = C_CamMetTreeLoggerDataGreyOutInformation();
+         s32_Retval = C_NO_ERR;
+      }
+      else
+      {
+         s32_Retval = C_RD_WR;
+      }
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get number of bytes currently held in memory
+
+   \return
+   Number of bytes reserved for records and record offsets
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_CamMetTreeLoggerDataStorage::GetMemoryUsage(void) const
+{
+   return this->mu64_MemoryUsed;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Update protocol texts of all stored records
+
+   Each chunk is decoded, updated and encoded again.
+
+   \param[in]  orc_Monitor    Monitor with current protocol
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeLoggerDataStorage::UpdateProtocolStrings(const C_SyvComMessageMonitor & orc_Monitor)
+{
+   std::vector<uint8_t> c_Record;
+   C_OscComMessageLoggerData c_Data;
+
+   for (uint32_t u32_ItChunk = 0U; u32_ItChunk < this->mc_Chunks.size(); ++u32_ItChunk)
+   {
+      C_Chunk & rc_Chunk = this->mc_Chunks[u32_ItChunk];
+      const uint8_t * const pu8_Data = this->m_GetChunkData(rc_Chunk);
+
+      if (pu8_Data != NULL)
+      {
+         std::vector<uint8_t> c_NewData;
+         std::vector<uint32_t> c_NewOffsets;
+
+         c_NewData.reserve(rc_Chunk.u32_Capacity);
+         c_NewOffsets.reserve(rc_Chunk.c_Offsets.size());
+         for (uint32_t u32_ItRecord = 0U; u32_ItRecord < rc_Chunk.c_Offsets.size(); ++u32_ItRecord)
+         {
+            mh_DecodeRecord(&pu8_Data[rc_Chunk.c_Offsets[u32_ItRecord]], c_Data);
+            orc_Monitor.UpdateProtocolString(c_Data);
+            h_EncodeRecord(c_Data, c_Record);
+            c_NewOffsets.push_back(static_cast<uint32_t>(c_NewData.size()));
+            c_NewData.insert(c_NewData.end(), c_Record.begin(), c_Record.end());
+         }
+
+         if (rc_Chunk.q_Spilled == false)
+         {
+            const uint32_t u32_NewCapacity = static_cast<uint32_t>(c_NewData.capacity());
+            this->mu64_MemoryUsed -= rc_Chunk.u32_Capacity;
+            this->mu64_MemoryUsed += u32_NewCapacity;
+            rc_Chunk.u32_Capacity = u32_NewCapacity;
+            rc_Chunk.c_Data.swap(c_NewData);
+            rc_Chunk.c_Offsets.swap(c_NewOffsets);
+            rc_Chunk.u32_DataSize = static_cast<uint32_t>(rc_Chunk.c_Data.size());
+         }
+         else
+         {
+            const uint32_t u32_NewSize = static_cast<uint32_t>(c_NewData.size());
+            bool q_Written = false;
+            if (u32_NewSize <= rc_Chunk.u32_Capacity)
+            {
+               //Fits into current slot
+               q_Written = (this->mc_SpillFile.seek(static_cast<int64_t>(rc_Chunk.u64_FileOffset)) == true) &&
+                           (this->mc_SpillFile.write(reinterpret_cast<const char_t *>(&c_NewData[0]),
+                                                     u32_NewSize) == static_cast<int64_t>(u32_NewSize));
+            }
+            else
+            {
+               uint64_t u64_Offset;
+               uint32_t u32_SlotSize;
+               q_Written = this->m_WriteToFile(&c_NewData[0], u32_NewSize, u64_Offset, u32_SlotSize);
+               if (q_Written == true)
+               {
+                  C_FileSlot c_OldSlot;
+                  c_OldSlot.u64_Offset = rc_Chunk.u64_FileOffset;
+                  c_OldSlot.u32_Size = rc_Chunk.u32_Capacity;
+                  this->mc_FreeFileSlots.push_back(c_OldSlot);
+                  rc_Chunk.u64_FileOffset = u64_Offset;
+                  rc_Chunk.u32_Capacity = u32_SlotSize;
+               }
+            }
+            if (q_Written == true)
+            {
+               rc_Chunk.c_Offsets.swap(c_NewOffsets);
+               rc_Chunk.u32_DataSize = u32_NewSize;
+            }
+            //Reloaded data is outdated in any case
+            this->mq_ReloadedValid = false;
+         }
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get index of chunk containing record
+
+   \param[in]  ou64_Sequence  Sequence number of valid record
+
+   \return
+   Index in mc_Chunks
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_CamMetTreeLoggerDataStorage::m_GetChunkIndex(const uint64_t ou64_Sequence) const
+{
+   //Binary search for last chunk starting at or before the sequence number
+   uint32_t u32_Low = 0U;
+   uint32_t u32_High = static_cast<uint32_t>(this->mc_Chunks.size());
+
+   while ((u32_High - u32_Low) > 1U)
+   {
+      const uint32_t u32_Mid = u32_Low + ((u32_High - u32_Low) / 2U);
+      if (this->mc_Chunks[u32_Mid].u64_FirstSequence <= ou64_Sequence)
+      {
+         u32_Low = u32_Mid;
+      }
+      else
+      {
+         u32_High = u32_Mid;
+      }
+   }
+   return u32_Low;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get data of chunk
+
+   Spilled chunks are read back into a buffer which is valid until the next call.
+
+   \param[in]  orc_Chunk   Chunk
+
+   \return
+   NULL     Data not available
+   Else     Pointer to first byte of chunk data
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const uint8_t * C_CamMetTreeLoggerDataStorage::m_GetChunkData(const C_Chunk & orc_Chunk) const
+{
+   const uint8_t * pu8_Retval = NULL;
+
+   if (orc_Chunk.q_Spilled == false)
+   {
+      if (orc_Chunk.c_Data.empty() == false)
+      {
+         pu8_Retval = &orc_Chunk.c_Data[0];
+      }
+   }
+   else if ((this->mq_ReloadedValid == true) && (this->mu64_ReloadedSequence == orc_Chunk.u64_FirstSequence))
+   {
+      pu8_Retval = &this->mc_ReloadedData[0];
+   }
+   else
+   {
+      this->mq_ReloadedValid = false;
+      this->mc_ReloadedData.resize(orc_Chunk.u32_DataSize);
+      if ((orc_Chunk.u32_DataSize > 0U) &&
+          (this->mc_SpillFile.seek(static_cast<int64_t>(orc_Chunk.u64_FileOffset)) == true) &&
+          (this->mc_SpillFile.read(reinterpret_cast<char_t *>(&this->mc_ReloadedData[0]),
+                                   orc_Chunk.u32_DataSize) == static_cast<int64_t>(orc_Chunk.u32_DataSize)))
+      {
+         this->mq_ReloadedValid = true;
+         this->mu64_ReloadedSequence = orc_Chunk.u64_FirstSequence;
+         pu8_Retval = &this->mc_ReloadedData[0];
+      }
+   }
+   return pu8_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Drop oldest record
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeLoggerDataStorage::m_DropOldest(void)
+{
+   if (this->mu32_Count > 0U)
+   {
+      const C_Chunk & rc_Front = this->mc_Chunks.front();
+      ++this->mu64_FirstSequence;
+      --this->mu32_Count;
+      if (this->mu64_FirstSequence >= (rc_Front.u64_FirstSequence + rc_Front.c_Offsets.size()))
+      {
+         this->m_ReleaseFrontChunk();
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Remove oldest chunk and release its memory or file slot
+
+   The caller has to update the first sequence number and count.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeLoggerDataStorage::m_ReleaseFrontChunk(void)
+{
+   const C_Chunk & rc_Front = this->mc_Chunks.front();
+
+   if (rc_Front.q_Spilled == true)
+   {
+      C_FileSlot c_Slot;
+      c_Slot.u64_Offset = rc_Front.u64_FileOffset;
+      c_Slot.u32_Size = rc_Front.u32_Capacity;
+      this->mc_FreeFileSlots.push_back(c_Slot);
+      if (this->mu64_ReloadedSequence == rc_Front.u64_FirstSequence)
+      {
+         this->mq_ReloadedValid = false;
+      }
+   }
+   else
+   {
+      this->mu64_MemoryUsed -= rc_Front.u32_Capacity;
+   }
+   this->mu64_MemoryUsed -= static_cast<uint64_t>(rc_Front.c_Offsets.size()) * sizeof(uint32_t);
+   this->mc_Chunks.pop_front();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Move chunk data from memory to spill file
+
+   \param[in,out]  orc_Chunk   Chunk to spill
+
+   \retval   true    Chunk spilled
+   \retval   false   Could not write to spill file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CamMetTreeLoggerDataStorage::m_SpillChunk(C_Chunk & orc_Chunk)
+{
+   bool q_Retval = false;
+
+   if ((this->mc_SpillFile.isOpen() == true) || (this->mc_SpillFile.open() == true))
+   {
+      uint64_t u64_Offset;
+      uint32_t u32_SlotSize;
+      if ((orc_Chunk.c_Data.empty() == false) &&
+          (this->m_WriteToFile(&orc_Chunk.c_Data[0], orc_Chunk.u32_DataSize, u64_Offset, u32_SlotSize) == true))
+      {
+         this->mu64_MemoryUsed -= orc_Chunk.u32_Capacity;
+         std::vector<uint8_t>().swap(orc_Chunk.c_Data);
+         orc_Chunk.q_Spilled = true;
+         orc_Chunk.u64_FileOffset = u64_Offset;
+         orc_Chunk.u32_Capacity = u32_SlotSize;
+         q_Retval = true;
+      }
+   }
+   return q_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Write data to free slot of spill file
+
+   Uses the first free slot which is big enough, else a new slot at the end of the file.
+
+   \param[in]   opu8_Data        Data to write
+   \param[in]   ou32_Size        Number of bytes to write
+   \param[out]  oru64_Offset     Position of used slot
+   \param[out]  oru32_SlotSize   Size of used slot
+
+   \retval   true    Data written
+   \retval   false   Write error
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CamMetTreeLoggerDataStorage::m_WriteToFile(const uint8_t * const opu8_Data, const uint32_t ou32_Size,
+                                                  uint64_t & oru64_Offset, uint32_t & oru32_SlotSize)
+{
+   bool q_Retval;
+   bool q_SlotReused = false;
+
+   for (std::vector<C_FileSlot>::iterator c_ItSlot = this->mc_FreeFileSlots.begin();
+        c_ItSlot != this->mc_FreeFileSlots.end(); ++c_ItSlot)
+   {
+      if (c_ItSlot->u32_Size >= ou32_Size)
+      {
+         oru64_Offset = c_ItSlot->u64_Offset;
+         oru32_SlotSize = c_ItSlot->u32_Size;
+         this->mc_FreeFileSlots.erase(c_ItSlot);
+         q_SlotReused = true;
+         break;
+      }
+   }
+   if (q_SlotReused == false)
+   {
+      oru64_Offset = this->mu64_SpillFileSize;
+      oru32_SlotSize = (ou32_Size > hu32_CHUNK_SIZE) ? ou32_Size : hu32_CHUNK_SIZE;
+   }
+
+   q_Retval = (this->mc_SpillFile.seek(static_cast<int64_t>(oru64_Offset)) == true) &&
+              (this->mc_SpillFile.write(reinterpret_cast<const char_t *>(opu8_Data),
+                                        ou32_Size) == static_cast<int64_t>(ou32_Size));
+   if (q_Retval == true)
+   {
+      if (q_SlotReused == false)
+      {
+         this->mu64_SpillFileSize += oru32_SlotSize;
+      }
+   }
+   else if (q_SlotReused == true)
+   {
+      C_FileSlot c_Slot;
+      c_Slot.u64_Offset = oru64_Offset;
+      c_Slot.u32_Size = oru32_SlotSize;
+      this->mc_FreeFileSlots.push_back(c_Slot);
+   }
+   else
+   {
+      //Nothing to give back
+   }
+   return q_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Apply record and memory limits
+
+   The newest chunk is never spilled or dropped because of the memory limit.
+
+   \param[in,out]  oru32_Dropped  Counter of dropped records, gets increased
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeLoggerDataStorage::m_EnforceLimits(uint32_t & oru32_Dropped)
+{
+   while (this->mu32_Count > this->mu32_MaxRecords)
+   {
+      this->m_DropOldest();
+      ++oru32_Dropped;
+   }
+
+   while ((this->mu64_MemoryUsed > this->mu64_MaxMemoryBytes) && (this->mc_Chunks.size() > 1UL))
+   {
+      bool q_Spilled = false;
+
+      if (this->mq_SpillToFile == true)
+      {
+         //Spill oldest chunk which is still in memory
+         for (uint32_t u32_ItChunk = 0U; u32_ItChunk < (this->mc_Chunks.size() - 1UL); ++u32_ItChunk)
+         {
+            if (this->mc_Chunks[u32_ItChunk].q_Spilled == false)
+            {
+               q_Spilled = this->m_SpillChunk(this->mc_Chunks[u32_ItChunk]);
+               break;
+            }
+         }
+      }
+      if (q_Spilled == false)
+      {
+         //Nothing left to spill or spill not possible: drop oldest chunk
+         const C_Chunk & rc_Front = this->mc_Chunks.front();
+         const uint32_t u32_Valid =
+            static_cast<uint32_t>((rc_Front.u64_FirstSequence + rc_Front.c_Offsets.size()) -
+                                  this->mu64_FirstSequence);
+         this->mu64_FirstSequence += u32_Valid;
+         this->mu32_Count -= u32_Valid;
+         oru32_Dropped += u32_Valid;
+         this->m_ReleaseFrontChunk();
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Append raw bytes to record
+
+   \param[in]      opv_Data    Data to append
+   \param[in]      ou32_Size   Number of bytes
+   \param[in,out]  orc_Record  Record to extend
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeLoggerDataStorage::mh_AppendRaw(const void * const opv_Data, const uint32_t ou32_Size,
+                                                 std::vector<uint8_t> & orc_Record)
+{
+   const uint8_t * const pu8_Data = static_cast<const uint8_t *>(opv_Data);
+
+   orc_Record.insert(orc_Record.end(), pu8_Data, pu8_Data + ou32_Size);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Append zero terminated string to record
+
+   \param[in]      orc_String  String to append
+   \param[in,out]  orc_Record  Record to extend
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeLoggerDataStorage::mh_AppendString(const C_SclString & orc_String, std::vector<uint8_t> & orc_Record)
+{
+   mh_AppendRaw(orc_String.c_str(), orc_String.Length() + 1U, orc_Record);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Decode record and create all derived strings
+
+   \param[in]   opu8_Record    Start of record
+   \param[out]  orc_Data       Decoded message
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeLoggerDataStorage::mh_DecodeRecord(const uint8_t * const opu8_Record,
+                                                    C_OscComMessageLoggerData & orc_Data)
+{
+   const uint8_t * pu8_Pos = opu8_Record;
+   uint8_t u8_Flags;
+   uint16_t u16_SignalCount;
+
+   (void)std::memcpy(&orc_Data.u64_TimeStampRelative, pu8_Pos, sizeof(orc_Data.u64_TimeStampRelative));
+   pu8_Pos += sizeof(orc_Data.u64_TimeStampRelative);
+   (void)std::memcpy(&orc_Data.u64_TimeStampAbsoluteStart, pu8_Pos, sizeof(orc_Data.u64_TimeStampAbsoluteStart));
+   pu8_Pos += sizeof(orc_Data.u64_TimeStampAbsoluteStart);
+   (void)std::memcpy(&orc_Data.u64_TimeStampAbsoluteTimeOfDay, pu8_Pos,
+                     sizeof(orc_Data.u64_TimeStampAbsoluteTimeOfDay));
+   pu8_Pos += sizeof(orc_Data.u64_TimeStampAbsoluteTimeOfDay);
+   (void)std::memcpy(&orc_Data.c_CanMsg, pu8_Pos, sizeof(orc_Data.c_CanMsg));
+   pu8_Pos += sizeof(orc_Data.c_CanMsg);
+   u8_Flags = *pu8_Pos;
+   ++pu8_Pos;
+   orc_Data.q_IsTx = ((u8_Flags & mu8_FLAG_IS_TX) != 0U);
+   orc_Data.q_CanDlcError = ((u8_Flags & mu8_FLAG_DLC_ERROR) != 0U);
+   orc_Data.c_Name = mh_ReadString(pu8_Pos);
+   orc_Data.c_ProtocolTextDec = mh_ReadString(pu8_Pos);
+   orc_Data.c_ProtocolTextHex = mh_ReadString(pu8_Pos);
+   orc_Data.c_Counter = mh_ReadString(pu8_Pos);
+   orc_Data.c_Status = mh_ReadString(pu8_Pos);
+
+   (void)std::memcpy(&u16_SignalCount, pu8_Pos, sizeof(u16_SignalCount));
+   pu8_Pos += sizeof(u16_SignalCount);
+   orc_Data.c_Signals.resize(u16_SignalCount);
+   for (uint16_t u16_ItSignal = 0U; u16_ItSignal < u16_SignalCount; ++u16_ItSignal)
+   {
+      C_OscComMessageLoggerDataSignal & rc_Signal = orc_Data.c_Signals[u16_ItSignal];
+      rc_Signal.q_DlcError = (*pu8_Pos != 0U);
+      ++pu8_Pos;
+      (void)std::memcpy(&rc_Signal.c_OscSignal, pu8_Pos, sizeof(rc_Signal.c_OscSignal));
+      pu8_Pos += sizeof(rc_Signal.c_OscSignal);
+      rc_Signal.c_Name = mh_ReadString(pu8_Pos);
+      rc_Signal.c_Value = mh_ReadString(pu8_Pos);
+      rc_Signal.c_Unit = mh_ReadString(pu8_Pos);
+      rc_Signal.c_RawValueDec = mh_ReadString(pu8_Pos);
+      rc_Signal.c_RawValueHex = mh_ReadString(pu8_Pos);
+      rc_Signal.c_Comment = mh_ReadString(pu8_Pos);
+   }
+
+   orc_Data.UpdateCanMessageStrings();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Read zero terminated string from record
+
+   \param[in,out]  orpu8_Pos   Position of string; set behind string
+
+   \return
+   Read string
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SclString C_CamMetTreeLoggerDataStorage::mh_ReadString(const uint8_t * & orpu8_Pos)
+{
+   const char_t * const pcn_String = reinterpret_cast<const char_t *>(orpu8_Pos);
+   const C_SclString c_Retval = pcn_String;
+
+   orpu8_Pos += std::strlen(pcn_String) + 1U;
+   return c_Retval;
+}
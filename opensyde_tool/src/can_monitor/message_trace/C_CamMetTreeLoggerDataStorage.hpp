@@ -0,0 +1,115 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Chunked storage of compact trace records (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_CAMMETTREELOGGERDATASTORAGE_HPP
+#define C_CAMMETTREELOGGERDATASTORAGE_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <deque>
+#include <vector>
+#include <QTemporaryFile>
+
+#include "stwtypes.hpp"
+#include "C_SclString.hpp"
+#include "C_CamMetTreeLoggerData.hpp"
+#include "C_SyvComMessageMonitor.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_gui_logic
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_CamMetTreeLoggerDataStorage
+{
+public:
+   C_CamMetTreeLoggerDataStorage(void);
+
+   void SetLimits(const uint32_t ou32_MaxRecords, const uint64_t ou64_MaxMemoryBytes, const bool oq_SpillToFile);
+   void Clear(void);
+
+   static void h_EncodeRecord(const stw::opensyde_core::C_OscComMessageLoggerData & orc_Data,
+                              std::vector<uint8_t> & orc_Record);
+   bool CanAppendWithoutDrop(const std::vector<std::vector<uint8_t> > & orc_Records) const;
+   uint32_t AppendRecord(const std::vector<uint8_t> & orc_Record);
+
+   uint32_t GetCount(void) const;
+   uint64_t GetSequenceNumber(const uint32_t ou32_Index) const;
+   int32_t GetRecord(const uint32_t ou32_Index, C_CamMetTreeLoggerData & orc_Data) const;
+   uint64_t GetMemoryUsage(void) const;
+
+   void UpdateProtocolStrings(const C_SyvComMessageMonitor & orc_Monitor);
+
+   static const uint32_t hu32_CHUNK_SIZE = 256U * 1024U; ///< Default number of bytes of one chunk
+
+private:
+   class C_Chunk
+   {
+   public:
+      C_Chunk(void);
+
+      std::vector<uint8_t> c_Data;     ///< Encoded records; empty if spilled to file
+      std::vector<uint32_t> c_Offsets; ///< Start of each record in c_Data
+      uint64_t u64_FirstSequence;      ///< Sequence number of first record in chunk
+      uint32_t u32_DataSize;           ///< Number of used bytes (also valid if spilled)
+      uint32_t u32_Capacity;           ///< Reserved bytes (in memory or of file slot if spilled)
+      bool q_Spilled;                  ///< Flag if data is only available in spill file
+      uint64_t u64_FileOffset;         ///< Position of data in spill file (only valid if spilled)
+   };
+
+   class C_FileSlot
+   {
+   public:
+      uint64_t u64_Offset; ///< Position in spill file
+      uint32_t u32_Size;   ///< Available bytes
+   };
+
+   //Avoid call
+   C_CamMetTreeLoggerDataStorage(const C_CamMetTreeLoggerDataStorage &);
+   C_CamMetTreeLoggerDataStorage & operator =(const C_CamMetTreeLoggerDataStorage &) &;
+
+   std::deque<C_Chunk> mc_Chunks;
+   uint64_t mu64_FirstSequence; ///< Sequence number of oldest valid record
+   uint32_t mu32_Count;         ///< Number of valid records
+   uint64_t mu64_MemoryUsed;    ///< Bytes held by chunks in memory
+   uint32_t mu32_MaxRecords;
+   uint64_t mu64_MaxMemoryBytes;
+   bool mq_SpillToFile;
+   mutable QTemporaryFile mc_SpillFile;
+   uint64_t mu64_SpillFileSize; ///< Bytes used or reserved in spill file
+   std::vector<C_FileSlot> mc_FreeFileSlots;
+   mutable std::vector<uint8_t> mc_ReloadedData; ///< Data of last chunk read back from spill file
+   mutable uint64_t mu64_ReloadedSequence;       ///< First sequence of chunk in mc_ReloadedData
+   mutable bool mq_ReloadedValid;
+
+   uint32_t m_GetChunkIndex(const uint64_t ou64_Sequence) const;
+   const uint8_t * m_GetChunkData(const C_Chunk & orc_Chunk) const;
+   void m_DropOldest(void);
+   void m_ReleaseFrontChunk(void);
+   bool m_SpillChunk(C_Chunk & orc_Chunk);
+   bool m_WriteToFile(const uint8_t * const opu8_Data, const uint32_t ou32_Size, uint64_t & oru64_Offset,
+                      uint32_t & oru32_SlotSize);
+   void m_EnforceLimits(uint32_t & oru32_Dropped);
+
+   static void mh_AppendRaw(const void * const opv_Data, const uint32_t ou32_Size, std::vector<uint8_t> & orc_Record);
+   static void mh_AppendString(const stw::scl::C_SclString & orc_String, std::vector<uint8_t> & orc_Record);
+   static void mh_DecodeRecord(const uint8_t * const opu8_Record,
+                               stw::opensyde_core::C_OscComMessageLoggerData & orc_Data);
+   static stw::scl::C_SclString mh_ReadString(const uint8_t * & orpu8_Pos);
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
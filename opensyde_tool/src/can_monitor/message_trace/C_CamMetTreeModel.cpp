@@ -19,6 +19,7 @@
 
 #include "TglTime.hpp"
 #include "stwtypes.hpp"
+#include "stwerrors.hpp"
 #include "constants.hpp"
 #include "C_GtGetText.hpp"
 #include "C_CamMetUtil.hpp"
@@ -29,6 +30,7 @@
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 using namespace stw::scl;
 using namespace stw::tgl;
+using namespace stw::errors;
 using namespace stw::opensyde_gui;
 using namespace stw::opensyde_gui_logic;
 using namespace stw::opensyde_core;
@@ -66,8 +68,9 @@ C_CamMetTreeModel::C_CamMetTreeModel(QObject * const opc_Parent) :
    mq_DisplayTimestampAbsoluteTimeOfDay(false),
    mu32_TraceBufferSizeUsed(1000U),
    mu32_TraceBufferSizeConfig(1000U),
+   mu32_TraceBufferMemoryLimitMiB(256U),
+   mq_TraceBufferSpillToFile(false),
    mq_DataUnlocked(false),
-   mu32_OldestItemIndex(0),
    ms32_SelectedParentRow(-1),
    mq_GrayOutPause(false),
    mu32_GrayOutPauseTimeStamp(0U),
@@ -217,8 +220,9 @@ void C_CamMetTreeModel::UnlockData(void)
 void C_CamMetTreeModel::ActionClearData(void)
 {
    this->beginResetModel();
-   this->mu32_OldestItemIndex = 0UL;
-   this->mc_DataBase.clear();
+   this->mc_DataBase.Clear();
+   this->mc_DecodedMessages.clear();
+   this->mc_DecodedMessagesOrder.clear();
    this->mc_UniqueMessages.clear();
    this->mc_UniqueMessagesOrdering.clear();
    //Tree
@@ -228,10 +232,7 @@ void C_CamMetTreeModel::ActionClearData(void)
    this->SetSelection(-1, -1);
    this->endResetModel();
 
-   if (this->mu32_TraceBufferSizeUsed != this->mu32_TraceBufferSizeConfig)
-   {
-      this->m_AdaptTraceBufferSize();
-   }
+   this->m_AdaptTraceBufferSize();
 
    this->m_ResetSearch();
 }
@@ -454,32 +455,40 @@ void C_CamMetTreeModel::SetTraceBufferSize(const uint32_t ou32_Value)
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-/*! \brief  Get all messages
+/*! \brief  Sets the memory limit of the trace buffer
 
-   Intended only for protocol changes
+   If the limit is reached the oldest messages are dropped or, if activated, moved to a temporary file.
 
-   \return
-   All messages
+   The new limit will be used on the next call of function ActionClearData.
+
+   \param[in]       ou32_LimitMiB     Maximum memory of stored messages in MiB
+   \param[in]       oq_SpillToFile    Flag to move oldest messages to a temporary file instead of dropping them
 */
 //----------------------------------------------------------------------------------------------------------------------
-std::vector<C_CamMetTreeLoggerData *> C_CamMetTreeModel::GetAllMessagesForProtocolChange(void)
+void C_CamMetTreeModel::SetTraceBufferMemoryLimit(const uint32_t ou32_LimitMiB, const bool oq_SpillToFile)
 {
-   std::vector<C_CamMetTreeLoggerData *> c_Retval;
-   const int32_t s32_CompleteSize = static_cast<int32_t>(this->mc_DataBase.size()) + this->mc_UniqueMessages.size();
-   //Reserve
-   c_Retval.reserve(s32_CompleteSize);
-   //Append vector
-   for (uint32_t u32_ItVec = 0; u32_ItVec < this->mc_DataBase.size(); ++u32_ItVec)
-   {
-      c_Retval.push_back(&this->mc_DataBase[u32_ItVec]);
-   }
-   //Append map
+   this->mu32_TraceBufferMemoryLimitMiB = ou32_LimitMiB;
+   this->mq_TraceBufferSpillToFile = oq_SpillToFile;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Update protocol texts of all messages
+
+   \param[in]  orc_Monitor    Monitor with new protocol
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeModel::UpdateProtocolStrings(const C_SyvComMessageMonitor & orc_Monitor)
+{
+   //Stored messages
+   this->mc_DataBase.UpdateProtocolStrings(orc_Monitor);
+   this->mc_DecodedMessages.clear();
+   this->mc_DecodedMessagesOrder.clear();
+   //Unique messages
    for (QMap<C_SclString, C_CamMetTreeLoggerData>::iterator c_It = this->mc_UniqueMessages.begin();
         c_It != this->mc_UniqueMessages.end(); ++c_It)
    {
-      c_Retval.push_back(&c_It.value());
+      orc_Monitor.UpdateProtocolString(c_It.value());
    }
-   return c_Retval;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -738,7 +747,7 @@ int32_t C_CamMetTreeModel::rowCount(const QModelIndex & orc_Parent) const
       }
       else
       {
-         s32_Retval = this->mc_DataBase.size();
+         s32_Retval = static_cast<int32_t>(this->mc_DataBase.GetCount());
       }
    }
    else
@@ -1281,10 +1290,28 @@ const C_CamMetTreeLoggerData * C_CamMetTreeModel::GetMessageData(const int32_t o
 
    if (this->mq_UniqueMessageMode == false)
    {
-      //If not unique messages: look in "queue"/vector
-      const uint32_t u32_Index = (this->mu32_OldestItemIndex + static_cast<uint32_t>(os32_Row)) %
-                                 this->mu32_TraceBufferSizeUsed;
-      pc_Retval = &this->mc_DataBase[u32_Index];
+      //If not unique messages: decode from storage, only recently requested rows are kept
+      const uint64_t u64_Sequence = this->mc_DataBase.GetSequenceNumber(static_cast<uint32_t>(os32_Row));
+      const std::map<uint64_t, C_CamMetTreeLoggerData>::const_iterator c_It =
+         this->mc_DecodedMessages.find(u64_Sequence);
+      if (c_It != this->mc_DecodedMessages.end())
+      {
+         pc_Retval = &c_It->second;
+      }
+      else
+      {
+         C_CamMetTreeLoggerData c_Message;
+         if (this->mc_DataBase.GetRecord(static_cast<uint32_t>(os32_Row), c_Message) == C_NO_ERR)
+         {
+            if (this->mc_DecodedMessagesOrder.size() >= mhu32_DECODED_MESSAGES_CACHE_SIZE)
+            {
+               this->mc_DecodedMessages.erase(this->mc_DecodedMessagesOrder.front());
+               this->mc_DecodedMessagesOrder.pop_front();
+            }
+            pc_Retval = &this->mc_DecodedMessages.insert(std::make_pair(u64_Sequence, c_Message)).first->second;
+            this->mc_DecodedMessagesOrder.push_back(u64_Sequence);
+         }
+      }
    }
    else
    {
@@ -1622,7 +1649,7 @@ Qt::ItemFlags C_CamMetTreeModel::flags(const QModelIndex & orc_Index) const
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-/*! \brief  Reserves new size by the necessary vectors and sets the configured buffer size as used value
+/*! \brief  Reserves new size by the necessary vectors and activates the configured buffer size and memory limit
 */
 //----------------------------------------------------------------------------------------------------------------------
 void C_CamMetTreeModel::m_AdaptTraceBufferSize(void)
@@ -1630,8 +1657,9 @@ void C_CamMetTreeModel::m_AdaptTraceBufferSize(void)
    // Activate the changed buffer size configuration
    this->mu32_TraceBufferSizeUsed = this->mu32_TraceBufferSizeConfig;
 
-   //lint -e{1938}  static const is guaranteed preinitialized before main
-   this->mc_DataBase.reserve(this->mu32_TraceBufferSizeUsed);
+   this->mc_DataBase.SetLimits(this->mu32_TraceBufferSizeUsed,
+                               static_cast<uint64_t>(this->mu32_TraceBufferMemoryLimitMiB) * 1024ULL * 1024ULL,
+                               this->mq_TraceBufferSpillToFile);
    //lint -e{1938}  static const is guaranteed preinitialized before main
    this->mpc_RootItemContinuous->ReserveChildrenSpace(this->mu32_TraceBufferSizeUsed);
 }
@@ -1652,113 +1680,72 @@ std::vector<int32_t> C_CamMetTreeModel::m_AddRowsContinuousMode(const std::list<
    std::vector<int32_t> c_Retval;
    if (orc_Data.empty() == false)
    {
-      //Columns which need to get updated on change of static message
-      const uint32_t u32_CompleteSize = static_cast<uint32_t>(this->mc_DataBase.size()) +
-                                        static_cast<uint32_t>(orc_Data.size());
+      std::vector<std::vector<uint8_t> > c_Records;
+      bool q_AppendOnly;
 
-      //Check if only append case
-      if (u32_CompleteSize <= this->mu32_TraceBufferSizeUsed)
+      //Encode first to know if any stored message will be dropped
+      c_Records.resize(orc_Data.size());
       {
-         //Appending so notify model of insert action
-         if (this->mq_UniqueMessageMode == false)
-         {
-            this->beginInsertRows(QModelIndex(), this->rowCount(),
-                                  this->rowCount() + (static_cast<int32_t>(orc_Data.size()) - 1));
-         }
-         //Appending items in reserved space
+         uint32_t u32_ItRecord = 0UL;
          for (std::list<C_CamMetTreeLoggerData>::const_iterator c_ItData = orc_Data.begin();
               c_ItData != orc_Data.end(); ++c_ItData)
          {
-            C_TblTreSimpleItem * const pc_Item = new C_TblTreSimpleItem();
-            this->mc_DataBase.push_back(*c_ItData);
-            //Add tree item
-            m_UpdateTreeItemBasedOnMessage(pc_Item, *c_ItData, false, -1);
-            this->mpc_RootItemContinuous->AddChild(pc_Item);
-         }
-         //Appending so notify model of insert action
-         if (this->mq_UniqueMessageMode == false)
-         {
-            this->endInsertRows();
+            C_CamMetTreeLoggerDataStorage::h_EncodeRecord(*c_ItData, c_Records[u32_ItRecord]);
+            ++u32_ItRecord;
          }
       }
-      //Check if we need to append any items to reach the max storage size
-      else if (this->mc_DataBase.size() < this->mu32_TraceBufferSizeUsed)
+      q_AppendOnly = this->mc_DataBase.CanAppendWithoutDrop(c_Records);
+
+      if (this->mq_UniqueMessageMode == false)
       {
-         //Simple model reset notification (if replaced: look at two segments: adding new and queuing mechanism)
-         if (this->mq_UniqueMessageMode == false)
+         if (q_AppendOnly == true)
          {
+            //Appending so notify model of insert action
+            this->beginInsertRows(QModelIndex(), this->rowCount(),
+                                  this->rowCount() + (static_cast<int32_t>(orc_Data.size()) - 1));
+         }
+         else
+         {
+            //Use reset model to avoid console output, warning: does have negative side effects, but also faster
             this->beginResetModel();
          }
-         //One time code doing both parts
+      }
+      {
+         uint32_t u32_ItRecord = 0UL;
+         uint32_t u32_Dropped = 0UL;
          for (std::list<C_CamMetTreeLoggerData>::const_iterator c_ItData = orc_Data.begin();
               c_ItData != orc_Data.end(); ++c_ItData)
          {
             C_TblTreSimpleItem * const pc_Item = new C_TblTreSimpleItem();
+            u32_Dropped += this->mc_DataBase.AppendRecord(c_Records[u32_ItRecord]);
+            //Add tree item
             m_UpdateTreeItemBasedOnMessage(pc_Item, *c_ItData, false, -1);
-            //1. insert until space is no longer available
-            if (this->mc_DataBase.size() < this->mu32_TraceBufferSizeUsed)
-            {
-               //Append in reserved space
-               this->mc_DataBase.push_back(*c_ItData);
-               //Add tree item
-               this->mpc_RootItemContinuous->AddChild(pc_Item);
-            }
-            //2. start replacing oldest ones
-            else
-            {
-               //Shift item
-               this->mc_DataBase[this->mu32_OldestItemIndex] = *c_ItData;
-               //Replace tree item
-               delete (this->mpc_RootItemContinuous->c_Children[0UL]);
-               this->mpc_RootItemContinuous->c_Children.erase(this->mpc_RootItemContinuous->c_Children.begin());
-               this->mpc_RootItemContinuous->AddChild(pc_Item);
-               //Iterate
-               ++this->mu32_OldestItemIndex;
-               this->mu32_OldestItemIndex %= this->mu32_TraceBufferSizeUsed;
-            }
+            this->mpc_RootItemContinuous->AddChild(pc_Item);
+            ++u32_ItRecord;
          }
-         //Simple model reset notification
-         if (this->mq_UniqueMessageMode == false)
+         //Remove tree items of dropped messages at once
+         if (u32_Dropped > 0UL)
          {
-            //Every reset will clear the selection
-            this->SetSelection(-1, -1);
-            this->endResetModel();
+            std::vector<C_TblTreSimpleItem *> & rc_Children = this->mpc_RootItemContinuous->c_Children;
+            for (uint32_t u32_ItChild = 0UL; u32_ItChild < u32_Dropped; ++u32_ItChild)
+            {
+               delete (rc_Children[u32_ItChild]);
+            }
+            rc_Children.erase(rc_Children.begin(), rc_Children.begin() + u32_Dropped);
          }
+         //Decoded messages of dropped rows are not requested anymore, the sequence number keeps the others valid
       }
-      else
+      if (this->mq_UniqueMessageMode == false)
       {
-         //Begin queue shift
-         if (this->mq_UniqueMessageMode == false)
-         {
-            //Use reset model to avoid console output, warning: does have negative side effects, but also faster
-            this->beginResetModel();
-            //this->beginRemoveRows(QModelIndex(), 0, orc_Data.size() - 1);
-            //this->beginInsertRows(QModelIndex(), this->rowCount() - (orc_Data.size() - 1), this->rowCount());
-         }
-         //Shift item in queue
-         for (std::list<C_CamMetTreeLoggerData>::const_iterator c_ItData = orc_Data.begin();
-              c_ItData != orc_Data.end(); ++c_ItData)
+         if (q_AppendOnly == true)
          {
-            C_TblTreSimpleItem * const pc_Item = new C_TblTreSimpleItem();
-            this->mc_DataBase[this->mu32_OldestItemIndex] = *c_ItData;
-            //Replace tree item
-            m_UpdateTreeItemBasedOnMessage(pc_Item, *c_ItData, false, -1);
-            delete (this->mpc_RootItemContinuous->c_Children[0UL]);
-            this->mpc_RootItemContinuous->c_Children.erase(this->mpc_RootItemContinuous->c_Children.begin());
-            this->mpc_RootItemContinuous->AddChild(pc_Item);
-            //Iterate
-            ++this->mu32_OldestItemIndex;
-            this->mu32_OldestItemIndex %= this->mu32_TraceBufferSizeUsed;
+            this->endInsertRows();
          }
-         //End queue shift
-         if (this->mq_UniqueMessageMode == false)
+         else
          {
             //Every reset will clear the selection
             this->SetSelection(-1, -1);
-            //Use reset model to avoid console output, warning: reset model does have negative side effects
             this->endResetModel();
-            //this->endInsertRows();
-            //this->endRemoveRows();
          }
       }
       //Every time count the actual indices
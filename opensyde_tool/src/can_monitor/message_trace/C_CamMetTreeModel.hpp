@@ -13,6 +13,8 @@
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include <vector>
+#include <map>
+#include <deque>
 #include <QMap>
 #include <QAbstractItemModel>
 #include <QColor>
@@ -22,6 +24,8 @@
 #include "C_SclString.hpp"
 #include "C_TblTreSimpleModel.hpp"
 #include "C_CamMetTreeLoggerData.hpp"
+#include "C_CamMetTreeLoggerDataStorage.hpp"
+#include "C_SyvComMessageMonitor.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 namespace stw
@@ -72,8 +76,9 @@ public:
    bool GetDisplayTimestampRelative(void) const;
    bool GetDisplayTimestampAbsoluteTimeOfDay(void) const;
    void SetTraceBufferSize(const uint32_t ou32_Value);
+   void SetTraceBufferMemoryLimit(const uint32_t ou32_LimitMiB, const bool oq_SpillToFile);
 
-   std::vector<C_CamMetTreeLoggerData *> GetAllMessagesForProtocolChange(void);
+   void UpdateProtocolStrings(const C_SyvComMessageMonitor & orc_Monitor);
    void SignalProtocolChange(void);
 
    QVariant headerData(const int32_t os32_Section, const Qt::Orientation oe_Orientation,
@@ -109,9 +114,13 @@ private:
    // communication
    QMap<stw::scl::C_SclString, C_CamMetTreeLoggerData> mc_UniqueMessages;
    QMap<stw::scl::C_SclString, stw::scl::C_SclString> mc_UniqueMessagesOrdering;
-   std::vector<C_CamMetTreeLoggerData> mc_DataBase;
+   uint32_t mu32_TraceBufferMemoryLimitMiB; // Memory limit of continuous storage. Will be set on next clear
+   bool mq_TraceBufferSpillToFile;           // Spill to file instead of dropping. Will be set on next clear
+   C_CamMetTreeLoggerDataStorage mc_DataBase;
+   // Decoded messages of continuous storage by sequence number, only the recently requested rows are kept
+   mutable std::map<uint64_t, C_CamMetTreeLoggerData> mc_DecodedMessages;
+   mutable std::deque<uint64_t> mc_DecodedMessagesOrder;
    bool mq_DataUnlocked;
-   uint32_t mu32_OldestItemIndex;
    int32_t ms32_SelectedParentRow;
    std::set<uint16_t> mc_SelectedChildBytes;
    std::vector<QColor> mc_FontTransparcencyColors;
@@ -129,6 +138,7 @@ private:
    static const QString mhc_ICON_MESSAGE_SELECTED;
    static const QString mhc_ICON_SIGNAL;
    static const QString mhc_ICON_SIGNAL_SELECTED;
+   static const uint32_t mhu32_DECODED_MESSAGES_CACHE_SIZE = 512U;
 
    //Avoid call
    C_CamMetTreeModel(const C_CamMetTreeModel &);
@@ -250,14 +250,9 @@ void C_CamMetTreeView::ActionClearData(void)
 //----------------------------------------------------------------------------------------------------------------------
 void C_CamMetTreeView::SetProtocol(const stw::cmon_protocol::e_CanMonL7Protocols oe_Protocol)
 {
-   std::vector<C_CamMetTreeLoggerData *> c_Messages;
    C_SyvComMessageMonitor::SetProtocol(oe_Protocol);
    //Change all existing messages
-   c_Messages = this->mc_Model.GetAllMessagesForProtocolChange();
-   for (uint32_t u32_ItMessage = 0UL; u32_ItMessage < c_Messages.size(); ++u32_ItMessage)
-   {
-      this->m_UpdateProtocolString(*c_Messages[u32_ItMessage]);
-   }
+   this->mc_Model.UpdateProtocolStrings(*this);
    //Update all related columns
    this->mc_Model.SignalProtocolChange();
 }
@@ -347,6 +342,18 @@ void C_CamMetTreeView::SetTraceBufferSize(const uint32_t ou32_Value)
    this->mc_Model.SetTraceBufferSize(ou32_Value);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Sets the memory limit of the trace buffer
+
+   \param[in]  ou32_LimitMiB   Maximum memory of stored messages in MiB
+   \param[in]  oq_SpillToFile  Flag to move oldest messages to a temporary file instead of dropping them
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeView::SetTraceBufferMemoryLimit(const uint32_t ou32_LimitMiB, const bool oq_SpillToFile)
+{
+   this->mc_Model.SetTraceBufferMemoryLimit(ou32_LimitMiB, oq_SpillToFile);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Returns display style for CAN ID and CAN data
 
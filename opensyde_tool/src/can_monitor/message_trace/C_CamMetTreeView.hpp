@@ -65,6 +65,7 @@ public:
    void SetDisplayTimestampRelative(const bool oq_Value);
    void SetDisplayTimestampAbsoluteTimeOfDay(const bool oq_Value);
    void SetTraceBufferSize(const uint32_t ou32_Value);
+   void SetTraceBufferMemoryLimit(const uint32_t ou32_LimitMiB, const bool oq_SpillToFile);
    bool GetDisplayAsHex(void) const;
    bool GetDisplayTimestampRelative(void) const;
 
@@ -78,6 +78,8 @@ C_CamMetWidget::C_CamMetWidget(QWidget * const opc_Parent) :
            this->mpc_Ui->pc_TraceView, &C_CamMetTreeView::SetDisplayTimestampAbsoluteTimeOfDay);
    connect(this->mpc_Ui->pc_ControlWidget, &C_CamMetControlBarWidget::SigTraceBufferSize,
            this->mpc_Ui->pc_TraceView, &C_CamMetTreeView::SetTraceBufferSize);
+   connect(this->mpc_Ui->pc_ControlWidget, &C_CamMetControlBarWidget::SigTraceBufferMemoryLimit,
+           this->mpc_Ui->pc_TraceView, &C_CamMetTreeView::SetTraceBufferMemoryLimit);
    connect(this->mpc_Ui->pc_ControlWidget, &C_CamMetControlBarWidget::SigChangeProtocol,
            this->mpc_Ui->pc_TraceView, &C_CamMetTreeView::SetProtocol);
    connect(this->mpc_Ui->pc_ControlWidget, &C_CamMetControlBarWidget::SigDisplayTree,
@@ -204,6 +204,9 @@ void C_UsFiler::mh_SaveProjectIndependentSection(const C_UsHandler & orc_UserSet
    orc_Ini.WriteBool("Trace_Settings", "TimeStampAbsoluteTimeOfDay",
                      orc_UserSettings.GetTraceSettingDisplayTimestampAbsoluteTimeOfDay());
    orc_Ini.WriteInteger("Trace_Settings", "TraceBufferSize", orc_UserSettings.GetTraceSettingBufferSize());
+   orc_Ini.WriteInteger("Trace_Settings", "TraceBufferMemoryLimit",
+                        orc_UserSettings.GetTraceSettingBufferMemoryLimit());
+   orc_Ini.WriteBool("Trace_Settings", "TraceBufferSpillToFile", orc_UserSettings.GetTraceSettingBufferSpillToFile());
 
    //Protocol
    orc_Ini.WriteInteger("Protocol", "Value", orc_UserSettings.GetSelectedProtocolIndex());
@@ -347,6 +350,10 @@ void C_UsFiler::mh_LoadProjectIndependentSection(C_UsHandler & orc_UserSettings,
    orc_UserSettings.SetTraceSettingDisplayTimestampAbsoluteTimeOfDay(q_Flag);
    s32_Value = orc_Ini.ReadInteger("Trace_Settings", "TraceBufferSize", 1000);
    orc_UserSettings.SetTraceSettingBufferSize(static_cast<uint32_t>(s32_Value));
+   s32_Value = orc_Ini.ReadInteger("Trace_Settings", "TraceBufferMemoryLimit", 256);
+   orc_UserSettings.SetTraceSettingBufferMemoryLimit(static_cast<uint32_t>(s32_Value));
+   q_Flag = orc_Ini.ReadBool("Trace_Settings", "TraceBufferSpillToFile", false);
+   orc_UserSettings.SetTraceSettingBufferSpillToFile(q_Flag);
 
    // Protocol
    s32_Value = orc_Ini.ReadInteger("Protocol", "Value", 0);
@@ -214,6 +214,31 @@ uint32_t C_UsHandler::GetTraceSettingBufferSize(void) const
    return this->mu32_TraceSettingBufferSize;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get memory limit of trace buffer
+
+   \return
+   Memory limit of trace buffer in MiB
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_UsHandler::GetTraceSettingBufferMemoryLimit(void) const
+{
+   return this->mu32_TraceSettingBufferMemoryLimit;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get trace buffer spill to file flag
+
+   \return
+   true     Oldest messages are moved to a temporary file if the memory limit is reached
+   false    Oldest messages are dropped if the memory limit is reached
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_UsHandler::GetTraceSettingBufferSpillToFile(void) const
+{
+   return this->mq_TraceSettingBufferSpillToFile;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Get last known selected protocol
 
@@ -613,6 +638,28 @@ void C_UsHandler::SetTraceSettingBufferSize(const uint32_t ou32_New)
    this->mu32_TraceSettingBufferSize = ou32_New;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set memory limit of trace buffer
+
+   \param[in] ou32_New New value in MiB
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_UsHandler::SetTraceSettingBufferMemoryLimit(const uint32_t ou32_New)
+{
+   this->mu32_TraceSettingBufferMemoryLimit = ou32_New;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set trace buffer spill to file flag
+
+   \param[in] oq_New New value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_UsHandler::SetTraceSettingBufferSpillToFile(const bool oq_New)
+{
+   this->mq_TraceSettingBufferSpillToFile = oq_New;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Set last known selected protocol index
 
@@ -935,6 +982,8 @@ C_UsHandler::C_UsHandler(void) :
    mq_ButtonUniqueViewActive(false),
    mq_TraceSettingDisplayTimestampAbsoluteTimeOfDay(false),
    mu32_TraceSettingBufferSize(1000U),
+   mu32_TraceSettingBufferMemoryLimit(256U),
+   mq_TraceSettingBufferSpillToFile(false),
    ms32_SelectedProtocolIndex(0),
    ms32_SplitterSettingsHorizontal(0),
    ms32_SplitterMessageGenVertical(0),
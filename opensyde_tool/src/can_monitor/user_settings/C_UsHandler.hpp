@@ -62,6 +62,8 @@ public:
    bool GetButtonUniqueViewActive(void) const;
    bool GetTraceSettingDisplayTimestampAbsoluteTimeOfDay(void) const;
    uint32_t GetTraceSettingBufferSize(void) const;
+   uint32_t GetTraceSettingBufferMemoryLimit(void) const;
+   bool GetTraceSettingBufferSpillToFile(void) const;
    int32_t GetSelectedProtocolIndex(void) const;
    static uint8_t h_GetMaxRecentProjects(void);
    QString GetLastKnownDatabasePath(void) const;
@@ -94,6 +96,8 @@ public:
    void SetButtonUniqueViewActive(const bool oq_New);
    void SetTraceSettingDisplayTimestampAbsoluteTimeOfDay(const bool oq_New);
    void SetTraceSettingBufferSize(const uint32_t ou32_New);
+   void SetTraceSettingBufferMemoryLimit(const uint32_t ou32_New);
+   void SetTraceSettingBufferSpillToFile(const bool oq_New);
    void SetSelectedProtocolIndex(const int32_t os32_New);
    void SetCurrentSaveAsPath(const QString & orc_Value);
    void SetLastKnownDatabasePath(const QString & orc_Value);
@@ -148,6 +152,8 @@ private:
    bool mq_ButtonUniqueViewActive;                        ///< History last known button unique state
    bool mq_TraceSettingDisplayTimestampAbsoluteTimeOfDay; ///< History last known timestamp absolute mode
    uint32_t mu32_TraceSettingBufferSize;                  ///< History last known trace buffer size
+   uint32_t mu32_TraceSettingBufferMemoryLimit;           ///< Memory limit of trace buffer in MiB
+   bool mq_TraceSettingBufferSpillToFile;                 ///< Flag to move oldest trace messages to temporary file
    int32_t ms32_SelectedProtocolIndex;                    ///< History last known selected protocol
    int32_t ms32_SplitterSettingsHorizontal;               ///< History of last known settings-splitter position x value
    int32_t ms32_SplitterMessageGenVertical;               ///< History of last known message generator splitter
@@ -0,0 +1,248 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Headless conversion of recorded CAN traces to decoded CSV files
+
+   Replays an ASC or BLF trace file through the message monitor of the CAN Monitor without showing the GUI.
+   All messages are interpreted with the given DBC files and openSYDE system definitions and written to a CSV file.
+
+   Usage:
+   openSYDE_CAN_Monitor --convert <trace file> <csv file> [--database <path> [--bus <index>]]... [--hex]
+
+   The bus index is mandatory for system definitions and must follow the corresponding database argument.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <iostream>
+
+#include "stwerrors.hpp"
+#include "TglFile.hpp"
+#include "TglTime.hpp"
+#include "C_CamUtiTraceConverter.hpp"
+#include "C_SyvComMessageMonitor.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::scl;
+using namespace stw::tgl;
+using namespace stw::opensyde_core;
+using namespace stw::opensyde_gui_logic;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const char_t * const mhpcn_ARG_CONVERT = "--convert";
+static const char_t * const mhpcn_ARG_DATABASE = "--database";
+static const char_t * const mhpcn_ARG_BUS = "--bus";
+static const char_t * const mhpcn_ARG_HEX = "--hex";
+static const uint32_t mhu32_POLL_INTERVAL_MS = 10U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Checks if the command line requests a headless trace conversion
+
+   \param[in]  os32_Argc      Number of command line arguments
+   \param[in]  oppcn_Argv     Command line arguments
+
+   \retval   true    First argument is "--convert"
+   \retval   false   Normal GUI start
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CamUtiTraceConverter::h_IsConversionRequested(const int32_t os32_Argc, const char_t * const * const oppcn_Argv)
+{
+   return (os32_Argc > 1) && (C_SclString(oppcn_Argv[1]) == mhpcn_ARG_CONVERT);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Converts a trace file to a decoded CSV file
+
+   \param[in]  os32_Argc      Number of command line arguments
+   \param[in]  oppcn_Argv     Command line arguments
+
+   \return
+   0: success
+   1: invalid command line
+   2: database could not be loaded
+   3: CSV file could not be created
+   4: trace file could not be read
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_CamUtiTraceConverter::h_Convert(const int32_t os32_Argc, const char_t * const * const oppcn_Argv)
+{
+   int32_t s32_Return = 0;
+   C_SclString c_TracePath;
+   C_SclString c_CsvPath;
+   bool q_Hex = false;
+
+   // Database path and bus index (-1 for DBC files)
+   std::vector<std::pair<C_SclString, int32_t> > c_Databases;
+
+   if (os32_Argc < 4)
+   {
+      s32_Return = 1;
+   }
+   else
+   {
+      c_TracePath = oppcn_Argv[2];
+      c_CsvPath = oppcn_Argv[3];
+
+      for (int32_t s32_Index = 4; (s32_Index < os32_Argc) && (s32_Return == 0); ++s32_Index)
+      {
+         const C_SclString c_Argument = oppcn_Argv[s32_Index];
+
+         if ((c_Argument == mhpcn_ARG_DATABASE) && ((s32_Index + 1) < os32_Argc))
+         {
+            ++s32_Index;
+            c_Databases.emplace_back(C_SclString(oppcn_Argv[s32_Index]), -1);
+         }
+         else if ((c_Argument == mhpcn_ARG_BUS) && ((s32_Index + 1) < os32_Argc) && (c_Databases.empty() == false))
+         {
+            ++s32_Index;
+            try
+            {
+               c_Databases.back().second = C_SclString(oppcn_Argv[s32_Index]).ToInt();
+            }
+            catch (...)
+            {
+               s32_Return = 1;
+            }
+         }
+         else if (c_Argument == mhpcn_ARG_HEX)
+         {
+            q_Hex = true;
+         }
+         else
+         {
+            s32_Return = 1;
+         }
+      }
+   }
+
+   if (s32_Return != 0)
+   {
+      mh_PrintUsage();
+   }
+   else
+   {
+      C_SyvComMessageMonitor c_Monitor;
+      int32_t s32_Result = C_NO_ERR;
+
+      // Nobody fetches the messages for a GUI
+      c_Monitor.SetMessageQueueActive(false);
+
+      for (uint32_t u32_Index = 0U; (u32_Index < c_Databases.size()) && (s32_Return == 0); ++u32_Index)
+      {
+         const C_SclString & rc_Path = c_Databases[u32_Index].first;
+         const C_SclString c_Extension = TglExtractFileExtension(rc_Path).LowerCase();
+         int32_t s32_StartResult;
+
+         if (c_Extension == ".dbc")
+         {
+            s32_StartResult = c_Monitor.StartAddDbcFile(rc_Path);
+         }
+         else if (c_Databases[u32_Index].second >= 0)
+         {
+            s32_StartResult =
+               c_Monitor.StartAddOsySysDef(rc_Path, static_cast<uint32_t>(c_Databases[u32_Index].second));
+         }
+         else
+         {
+            std::cerr << "Bus index missing for system definition " << rc_Path.c_str() << std::endl;
+            s32_StartResult = C_RANGE;
+         }
+
+         if (s32_StartResult == C_NO_ERR)
+         {
+            mh_WaitForMonitor(c_Monitor, s32_Result);
+         }
+         if ((s32_StartResult != C_NO_ERR) || (s32_Result != C_NO_ERR))
+         {
+            std::cerr << "Could not load database " << rc_Path.c_str() << std::endl;
+            s32_Return = 2;
+         }
+      }
+
+      if (s32_Return == 0)
+      {
+         if (c_Monitor.AddLogFileCsv(c_CsvPath, q_Hex) != C_NO_ERR)
+         {
+            std::cerr << "Could not create file " << c_CsvPath.c_str() << std::endl;
+            s32_Return = 3;
+         }
+      }
+
+      if (s32_Return == 0)
+      {
+         // A conversion must not lose messages
+         c_Monitor.SetLogFilesOverflowMode(C_OscComMessageLoggerFileBase::eOVERFLOW_BLOCK);
+         c_Monitor.Start();
+         if (c_Monitor.StartReplayTraceFile(c_TracePath, 0.0) == C_NO_ERR)
+         {
+            mh_WaitForMonitor(c_Monitor, s32_Result);
+         }
+         else
+         {
+            s32_Result = C_BUSY;
+         }
+         if (s32_Result != C_NO_ERR)
+         {
+            std::cerr << "Could not read trace file " << c_TracePath.c_str() << std::endl;
+            s32_Return = 4;
+         }
+         // Stop flushes the log files
+         c_Monitor.Stop();
+         std::cout << "Converted " << c_Monitor.GetReplayedMessages() << " messages to " << c_CsvPath.c_str() <<
+            std::endl;
+      }
+      c_Monitor.RemoveAllLogFiles();
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_CamUtiTraceConverter::C_CamUtiTraceConverter()
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Waits for the loading thread of the monitor
+
+   \param[in]   orc_Monitor   Monitor with started thread
+   \param[out]  ors32_Result  Result of the executed thread function
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamUtiTraceConverter::mh_WaitForMonitor(const C_SyvComMessageMonitor & orc_Monitor,
+                                                  int32_t & ors32_Result)
+{
+   while (orc_Monitor.GetResults(ors32_Result) == C_BUSY)
+   {
+      TglSleep(mhu32_POLL_INTERVAL_MS);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Prints the command line usage
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamUtiTraceConverter::mh_PrintUsage(void)
+{
+   std::cout << "Usage: " << mhpcn_ARG_CONVERT << " <trace file (.asc|.blf)> <csv file> " <<
+      "[" << mhpcn_ARG_DATABASE << " <path (.dbc|.syde_sysdef)> [" << mhpcn_ARG_BUS << " <index>]]... [" <<
+      mhpcn_ARG_HEX << "]" << std::endl;
+}
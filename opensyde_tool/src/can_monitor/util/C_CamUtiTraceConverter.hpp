@@ -0,0 +1,48 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Headless conversion of recorded CAN traces to decoded CSV files (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_CAMUTITRACECONVERTER_HPP
+#define C_CAMUTITRACECONVERTER_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
+
+#include "stwtypes.hpp"
+#include "C_SclString.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_gui_logic
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_SyvComMessageMonitor;
+
+class C_CamUtiTraceConverter
+{
+public:
+   static bool h_IsConversionRequested(const int32_t os32_Argc, const char_t * const * const oppcn_Argv);
+   static int32_t h_Convert(const int32_t os32_Argc, const char_t * const * const oppcn_Argv);
+
+private:
+   C_CamUtiTraceConverter();
+
+   static void mh_WaitForMonitor(const C_SyvComMessageMonitor & orc_Monitor, int32_t & ors32_Result);
+   static void mh_PrintUsage(void);
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
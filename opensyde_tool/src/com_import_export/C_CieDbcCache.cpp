@@ -0,0 +1,687 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Binary cache of imported DBC files (implementation)
+
+   Importing big DBC files with the Vector DBC library takes a long time.
+   This class stores the result of C_CieImportDbc::h_ImportNetwork in a compact binary file so the next load of the
+   same DBC file only needs to read that file.
+
+   One cache file is created per DBC file. Its name is derived from the absolute path of the DBC file.
+   Each cache file starts with the key of the source file (path, size, modification time and CRC32 of the content).
+   A cache file is only used if all of these still match the DBC file; otherwise the caller imports the DBC file
+   again and replaces the cache.
+
+   Stored is all information of C_CieConverter::C_CieCommDefinition except the import warnings of the messages.
+   Numbers are stored in the native byte order. The cache is meant for the local machine only.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <cstring>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QDateTime>
+#include <QSaveFile>
+
+#include "stwtypes.hpp"
+#include "stwerrors.hpp"
+#include "C_SclChecksums.hpp"
+#include "C_CieDbcCache.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::scl;
+using namespace stw::opensyde_core;
+using namespace stw::opensyde_gui_logic;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const uint8_t mhau8_MAGIC[4] =
+{
+   0x4FU, 0x44U, 0x42U, 0x43U // "ODBC"
+};
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Set up reader positioned at the start of the data
+
+   \param[in]  orc_Data    Data to read; must stay valid as long as the reader is used
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_CieDbcCache::C_Reader::C_Reader(const std::vector<uint8_t> & orc_Data) :
+   mrc_Data(orc_Data),
+   mu32_Position(0U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Read bytes and advance
+
+   \param[out]  opv_Target    Target for read bytes
+   \param[in]   ou32_Size     Number of bytes to read
+
+   \retval   true    bytes read
+   \retval   false   not enough data left
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CieDbcCache::C_Reader::ReadRaw(void * const opv_Target, const uint32_t ou32_Size)
+{
+   bool q_Retval = false;
+
+   if ((static_cast<uint64_t>(this->mu32_Position) + ou32_Size) <= this->mrc_Data.size())
+   {
+      if (ou32_Size > 0U)
+      {
+         (void)std::memcpy(opv_Target, &this->mrc_Data[this->mu32_Position], ou32_Size);
+         this->mu32_Position += ou32_Size;
+      }
+      q_Retval = true;
+   }
+   return q_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Read number of following entries
+
+   Each entry occupies at least one byte. So a count bigger than the number of remaining bytes can only be the
+   result of a damaged file. This prevents huge allocations for damaged files.
+
+   \param[out]  oru32_Count   Number of entries
+
+   \retval   true    count read and plausible
+   \retval   false   not enough data left or count not plausible
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CieDbcCache::C_Reader::ReadCount(uint32_t & oru32_Count)
+{
+   bool q_Retval = this->ReadRaw(&oru32_Count, sizeof(oru32_Count));
+
+   if ((q_Retval == true) && (oru32_Count > (this->mrc_Data.size() - this->mu32_Position)))
+   {
+      q_Retval = false;
+   }
+   return q_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Read string stored with its length
+
+   \param[out]  orc_String    Read string
+
+   \retval   true    string read
+   \retval   false   not enough data left
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CieDbcCache::C_Reader::ReadString(C_SclString & orc_String)
+{
+   uint32_t u32_Length;
+   bool q_Retval = this->ReadCount(u32_Length);
+
+   if (q_Retval == true)
+   {
+      if (u32_Length > 0U)
+      {
+         const std::string c_Tmp(reinterpret_cast<const char_t *>(&this->mrc_Data[this->mu32_Position]),
+                                 static_cast<size_t>(u32_Length));
+         orc_String = c_Tmp.c_str();
+         this->mu32_Position += u32_Length;
+      }
+      else
+      {
+         orc_String = "";
+      }
+   }
+   return q_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Check if all data was read
+
+   \retval   true    all data read
+   \retval   false   data left
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CieDbcCache::C_Reader::IsAtEnd(void) const
+{
+   return (this->mu32_Position == this->mrc_Data.size());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Load cached import result of DBC file
+
+   \param[in]   orc_DbcPath          Path of DBC file
+   \param[in]   orc_CacheDirectory   Directory of cache files
+   \param[out]  orc_Definition       Cached import result
+   \param[out]  ors32_ImportResult   Result of C_CieImportDbc::h_ImportNetwork when the cache was created
+                                     (C_NO_ERR or C_WARN)
+
+   \return
+   C_NO_ERR    cache loaded
+   C_RANGE     DBC file does not exist
+   C_NOACT     no cache file, cache file outdated (DBC file changed) or cache file damaged
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_CieDbcCache::h_Load(const QString & orc_DbcPath, const QString & orc_CacheDirectory,
+                              C_CieConverter::C_CieCommDefinition & orc_Definition, int32_t & ors32_ImportResult)
+{
+   C_SourceKey c_CurrentKey;
+   int32_t s32_Retval = mh_GetSourceKey(orc_DbcPath, c_CurrentKey);
+
+   if (s32_Retval == C_NO_ERR)
+   {
+      QFile c_File(mh_GetCacheFilePath(orc_CacheDirectory, c_CurrentKey.c_Path));
+
+      s32_Retval = C_NOACT;
+      if (c_File.open(QIODevice::ReadOnly) == true)
+      {
+         const QByteArray c_Content = c_File.readAll();
+         const std::vector<uint8_t> c_Data(c_Content.begin(), c_Content.end());
+         C_Reader c_Reader(c_Data);
+         uint8_t au8_Magic[sizeof(mhau8_MAGIC)];
+         uint32_t u32_Version = 0U;
+         C_SourceKey c_CachedKey;
+         C_CieConverter::C_CieCommDefinition c_Definition;
+         int32_t s32_ImportResult = C_NO_ERR;
+         uint32_t u32_NodeCount = 0U;
+
+         c_File.close();
+
+         bool q_Ok = (c_Reader.ReadRaw(&au8_Magic[0], sizeof(au8_Magic)) == true) &&
+                     (std::memcmp(&au8_Magic[0], &mhau8_MAGIC[0], sizeof(mhau8_MAGIC)) == 0) &&
+                     (c_Reader.ReadRaw(&u32_Version, sizeof(u32_Version)) == true) &&
+                     (u32_Version == mhu32_FORMAT_VERSION) &&
+                     (mh_ReadKey(c_Reader, c_CachedKey) == true) &&
+                     (c_CachedKey.c_Path == c_CurrentKey.c_Path) &&
+                     (c_CachedKey.u64_Size == c_CurrentKey.u64_Size) &&
+                     (c_CachedKey.s64_LastModified == c_CurrentKey.s64_LastModified) &&
+                     (c_CachedKey.u32_Crc == c_CurrentKey.u32_Crc) &&
+                     (c_Reader.ReadRaw(&s32_ImportResult, sizeof(s32_ImportResult)) == true) &&
+                     (c_Reader.ReadString(c_Definition.c_Bus.c_Name) == true) &&
+                     (c_Reader.ReadString(c_Definition.c_Bus.c_Comment) == true) &&
+                     (c_Reader.ReadCount(u32_NodeCount) == true);
+
+         if (q_Ok == true)
+         {
+            c_Definition.c_Nodes.resize(u32_NodeCount);
+            for (uint32_t u32_ItNode = 0U; (u32_ItNode < u32_NodeCount) && (q_Ok == true); ++u32_ItNode)
+            {
+               C_CieConverter::C_CieNode & rc_Node = c_Definition.c_Nodes[u32_ItNode];
+               q_Ok = (c_Reader.ReadString(rc_Node.c_Properties.c_Name) == true) &&
+                      (c_Reader.ReadString(rc_Node.c_Properties.c_Comment) == true) &&
+                      (mh_ReadMessages(c_Reader, rc_Node.c_TxMessages) == true) &&
+                      (mh_ReadMessages(c_Reader, rc_Node.c_RxMessages) == true);
+            }
+            q_Ok = (q_Ok == true) && (mh_ReadMessages(c_Reader, c_Definition.c_UnmappedMessages) == true) &&
+                   (c_Reader.IsAtEnd() == true);
+         }
+
+         if (q_Ok == true)
+         {
+            orc_Definition = c_Definition;
+            ors32_ImportResult = s32_ImportResult;
+            s32_Retval = C_NO_ERR;
+         }
+      }
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Store import result of DBC file in cache
+
+   The cache file is replaced atomically, so a parallel h_Load never sees a partly written file.
+
+   \param[in]  orc_DbcPath          Path of DBC file
+   \param[in]  orc_CacheDirectory   Directory of cache files (created if necessary)
+   \param[in]  orc_Definition       Import result
+   \param[in]  os32_ImportResult    Result of C_CieImportDbc::h_ImportNetwork (C_NO_ERR or C_WARN)
+
+   \return
+   C_NO_ERR    cache written
+   C_RANGE     DBC file does not exist
+   C_RD_WR     could not write cache file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_CieDbcCache::h_Save(const QString & orc_DbcPath, const QString & orc_CacheDirectory,
+                              const C_CieConverter::C_CieCommDefinition & orc_Definition,
+                              const int32_t os32_ImportResult)
+{
+   C_SourceKey c_Key;
+   int32_t s32_Retval = mh_GetSourceKey(orc_DbcPath, c_Key);
+
+   if (s32_Retval == C_NO_ERR)
+   {
+      std::vector<uint8_t> c_Buffer;
+      const uint32_t u32_Version = mhu32_FORMAT_VERSION;
+      const uint32_t u32_NodeCount = static_cast<uint32_t>(orc_Definition.c_Nodes.size());
+      QSaveFile c_File(mh_GetCacheFilePath(orc_CacheDirectory, c_Key.c_Path));
+
+      mh_AppendRaw(&mhau8_MAGIC[0], sizeof(mhau8_MAGIC), c_Buffer);
+      mh_AppendRaw(&u32_Version, sizeof(u32_Version), c_Buffer);
+      mh_AppendKey(c_Key, c_Buffer);
+      mh_AppendRaw(&os32_ImportResult, sizeof(os32_ImportResult), c_Buffer);
+      mh_AppendString(orc_Definition.c_Bus.c_Name, c_Buffer);
+      mh_AppendString(orc_Definition.c_Bus.c_Comment, c_Buffer);
+      mh_AppendRaw(&u32_NodeCount, sizeof(u32_NodeCount), c_Buffer);
+      for (uint32_t u32_ItNode = 0U; u32_ItNode < u32_NodeCount; ++u32_ItNode)
+      {
+         const C_CieConverter::C_CieNode & rc_Node = orc_Definition.c_Nodes[u32_ItNode];
+         mh_AppendString(rc_Node.c_Properties.c_Name, c_Buffer);
+         mh_AppendString(rc_Node.c_Properties.c_Comment, c_Buffer);
+         mh_AppendMessages(rc_Node.c_TxMessages, c_Buffer);
+         mh_AppendMessages(rc_Node.c_RxMessages, c_Buffer);
+      }
+      mh_AppendMessages(orc_Definition.c_UnmappedMessages, c_Buffer);
+
+      s32_Retval = C_RD_WR;
+      if ((QDir().mkpath(orc_CacheDirectory) == true) && (c_File.open(QIODevice::WriteOnly) == true))
+      {
+         if (c_File.write(reinterpret_cast<const char_t *>(&c_Buffer[0]),
+                          static_cast<int64_t>(c_Buffer.size())) == static_cast<int64_t>(c_Buffer.size()))
+         {
+            if (c_File.commit() == true)
+            {
+               s32_Retval = C_NO_ERR;
+            }
+         }
+         else
+         {
+            c_File.cancelWriting();
+         }
+      }
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get key of current state of DBC file
+
+   \param[in]   orc_DbcPath    Path of DBC file
+   \param[out]  orc_Key        Key of DBC file
+
+   \return
+   C_NO_ERR    key created
+   C_RANGE     DBC file does not exist or could not be read
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_CieDbcCache::mh_GetSourceKey(const QString & orc_DbcPath, C_SourceKey & orc_Key)
+{
+   int32_t s32_Retval = C_RANGE;
+   const QFileInfo c_Info(orc_DbcPath);
+   QFile c_File(orc_DbcPath);
+
+   if ((c_Info.isFile() == true) && (c_File.open(QIODevice::ReadOnly) == true))
+   {
+      orc_Key.c_Path = c_Info.absoluteFilePath().toStdString().c_str();
+      orc_Key.u64_Size = static_cast<uint64_t>(c_Info.size());
+      orc_Key.s64_LastModified = c_Info.lastModified().toMSecsSinceEpoch();
+      orc_Key.u32_Crc = 0xFFFFFFFFU;
+
+      //checksum in blocks; DBC files can be big
+      s32_Retval = C_NO_ERR;
+      while ((c_File.atEnd() == false) && (s32_Retval == C_NO_ERR))
+      {
+         const QByteArray c_Block = c_File.read(1024 * 1024);
+         if (c_Block.isEmpty() == true)
+         {
+            s32_Retval = C_RANGE;
+         }
+         else
+         {
+            C_SclChecksums::CalcCRC32(c_Block.constData(), static_cast<uint32_t>(c_Block.size()), orc_Key.u32_Crc);
+         }
+      }
+      c_File.close();
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get path of cache file for DBC file
+
+   \param[in]  orc_CacheDirectory   Directory of cache files
+   \param[in]  orc_DbcPath          Absolute path of DBC file
+
+   \return
+   Path of cache file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+QString C_CieDbcCache::mh_GetCacheFilePath(const QString & orc_CacheDirectory, const C_SclString & orc_DbcPath)
+{
+   uint32_t u32_PathCrc = 0xFFFFFFFFU;
+
+   C_SclChecksums::CalcCRC32(orc_DbcPath.c_str(), orc_DbcPath.Length(), u32_PathCrc);
+   //the full path is part of the key, so name collisions only lead to a rebuild of the cache
+   return orc_CacheDirectory + "/" + QFileInfo(orc_DbcPath.c_str()).completeBaseName() + "_" +
+          QString::number(u32_PathCrc, 16).rightJustified(8, '0') + ".dbccache";
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Append bytes to buffer
+
+   \param[in]      opv_Data     Data to append
+   \param[in]      ou32_Size    Number of bytes
+   \param[in,out]  orc_Buffer   Buffer to extend
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CieDbcCache::mh_AppendRaw(const void * const opv_Data, const uint32_t ou32_Size,
+                                 std::vector<uint8_t> & orc_Buffer)
+{
+   const uint8_t * const pu8_Data = static_cast<const uint8_t *>(opv_Data);
+
+   orc_Buffer.insert(orc_Buffer.end(), pu8_Data, pu8_Data + ou32_Size);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Append string with leading length to buffer
+
+   \param[in]      orc_String   String to append
+   \param[in,out]  orc_Buffer   Buffer to extend
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CieDbcCache::mh_AppendString(const C_SclString & orc_String, std::vector<uint8_t> & orc_Buffer)
+{
+   const uint32_t u32_Length = orc_String.Length();
+
+   mh_AppendRaw(&u32_Length, sizeof(u32_Length), orc_Buffer);
+   mh_AppendRaw(orc_String.c_str(), u32_Length, orc_Buffer);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Append source key to buffer
+
+   \param[in]      orc_Key      Key to append
+   \param[in,out]  orc_Buffer   Buffer to extend
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CieDbcCache::mh_AppendKey(const C_SourceKey & orc_Key, std::vector<uint8_t> & orc_Buffer)
+{
+   mh_AppendString(orc_Key.c_Path, orc_Buffer);
+   mh_AppendRaw(&orc_Key.u64_Size, sizeof(orc_Key.u64_Size), orc_Buffer);
+   mh_AppendRaw(&orc_Key.s64_LastModified, sizeof(orc_Key.s64_LastModified), orc_Buffer);
+   mh_AppendRaw(&orc_Key.u32_Crc, sizeof(orc_Key.u32_Crc), orc_Buffer);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Append content (type, array configuration and value) to buffer
+
+   \param[in]      orc_Content  Content to append
+   \param[in,out]  orc_Buffer   Buffer to extend
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CieDbcCache::mh_AppendContent(const C_OscNodeDataPoolContent & orc_Content, std::vector<uint8_t> & orc_Buffer)
+{
+   const uint8_t u8_Type = static_cast<uint8_t>(orc_Content.GetType());
+   const uint8_t u8_Array = (orc_Content.GetArray() == true) ? 1U : 0U;
+   const uint32_t u32_ArraySize = orc_Content.GetArraySize();
+   std::vector<uint8_t> c_Value;
+   uint32_t u32_ValueSize;
+
+   orc_Content.GetValueAsLittleEndianBlob(c_Value);
+   u32_ValueSize = static_cast<uint32_t>(c_Value.size());
+   mh_AppendRaw(&u8_Type, sizeof(u8_Type), orc_Buffer);
+   mh_AppendRaw(&u8_Array, sizeof(u8_Array), orc_Buffer);
+   mh_AppendRaw(&u32_ArraySize, sizeof(u32_ArraySize), orc_Buffer);
+   mh_AppendRaw(&u32_ValueSize, sizeof(u32_ValueSize), orc_Buffer);
+   if (u32_ValueSize > 0U)
+   {
+      mh_AppendRaw(&c_Value[0], u32_ValueSize, orc_Buffer);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Append signal to buffer
+
+   \param[in]      orc_Signal   Signal to append
+   \param[in,out]  orc_Buffer   Buffer to extend
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CieDbcCache::mh_AppendSignal(const C_CieConverter::C_CieCanSignal & orc_Signal,
+                                    std::vector<uint8_t> & orc_Buffer)
+{
+   const C_CieConverter::C_CieDataPoolElement & rc_Element = orc_Signal.c_Element;
+   const uint8_t u8_ByteOrder = static_cast<uint8_t>(orc_Signal.e_ComByteOrder);
+   const uint8_t u8_MultiplexerType = static_cast<uint8_t>(orc_Signal.e_MultiplexerType);
+   const uint32_t u32_DataSetCount = static_cast<uint32_t>(rc_Element.c_DataSetValues.size());
+   const uint32_t u32_ValueDescriptionCount = static_cast<uint32_t>(orc_Signal.c_ValueDescription.size());
+
+   mh_AppendRaw(&orc_Signal.u32_J1939Spn, sizeof(orc_Signal.u32_J1939Spn), orc_Buffer);
+   mh_AppendRaw(&u8_ByteOrder, sizeof(u8_ByteOrder), orc_Buffer);
+   mh_AppendRaw(&orc_Signal.u16_ComBitLength, sizeof(orc_Signal.u16_ComBitLength), orc_Buffer);
+   mh_AppendRaw(&orc_Signal.u16_ComBitStart, sizeof(orc_Signal.u16_ComBitStart), orc_Buffer);
+   mh_AppendRaw(&u8_MultiplexerType, sizeof(u8_MultiplexerType), orc_Buffer);
+   mh_AppendRaw(&orc_Signal.u16_MultiplexValue, sizeof(orc_Signal.u16_MultiplexValue), orc_Buffer);
+
+   mh_AppendString(rc_Element.c_Name, orc_Buffer);
+   mh_AppendString(rc_Element.c_Comment, orc_Buffer);
+   mh_AppendContent(rc_Element.c_MinValue, orc_Buffer);
+   mh_AppendContent(rc_Element.c_MaxValue, orc_Buffer);
+   mh_AppendRaw(&rc_Element.f64_Factor, sizeof(rc_Element.f64_Factor), orc_Buffer);
+   mh_AppendRaw(&rc_Element.f64_Offset, sizeof(rc_Element.f64_Offset), orc_Buffer);
+   mh_AppendString(rc_Element.c_Unit, orc_Buffer);
+   mh_AppendRaw(&u32_DataSetCount, sizeof(u32_DataSetCount), orc_Buffer);
+   for (uint32_t u32_ItDataSet = 0U; u32_ItDataSet < u32_DataSetCount; ++u32_ItDataSet)
+   {
+      mh_AppendContent(rc_Element.c_DataSetValues[u32_ItDataSet], orc_Buffer);
+   }
+
+   mh_AppendRaw(&u32_ValueDescriptionCount, sizeof(u32_ValueDescriptionCount), orc_Buffer);
+   for (std::map<int64_t, C_SclString>::const_iterator c_It = orc_Signal.c_ValueDescription.begin();
+        c_It != orc_Signal.c_ValueDescription.end(); ++c_It)
+   {
+      mh_AppendRaw(&c_It->first, sizeof(c_It->first), orc_Buffer);
+      mh_AppendString(c_It->second, orc_Buffer);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Append messages with their signals to buffer
+
+   \param[in]      orc_Messages    Messages to append
+   \param[in,out]  orc_Buffer      Buffer to extend
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CieDbcCache::mh_AppendMessages(const std::vector<C_CieConverter::C_CieNodeMessage> & orc_Messages,
+                                      std::vector<uint8_t> & orc_Buffer)
+{
+   const uint32_t u32_MessageCount = static_cast<uint32_t>(orc_Messages.size());
+
+   mh_AppendRaw(&u32_MessageCount, sizeof(u32_MessageCount), orc_Buffer);
+   for (uint32_t u32_ItMessage = 0U; u32_ItMessage < u32_MessageCount; ++u32_ItMessage)
+   {
+      const C_CieConverter::C_CieCanMessage & rc_Message = orc_Messages[u32_ItMessage].c_CanMessage;
+      const uint8_t u8_Extended = (rc_Message.q_IsExtended == true) ? 1U : 0U;
+      const uint8_t u8_TxMethod = static_cast<uint8_t>(rc_Message.e_TxMethod);
+      const uint32_t u32_SignalCount = static_cast<uint32_t>(rc_Message.c_Signals.size());
+
+      mh_AppendString(rc_Message.c_Name, orc_Buffer);
+      mh_AppendString(rc_Message.c_Comment, orc_Buffer);
+      mh_AppendRaw(&rc_Message.u32_CanId, sizeof(rc_Message.u32_CanId), orc_Buffer);
+      mh_AppendRaw(&u8_Extended, sizeof(u8_Extended), orc_Buffer);
+      mh_AppendRaw(&rc_Message.u16_Dlc, sizeof(rc_Message.u16_Dlc), orc_Buffer);
+      mh_AppendRaw(&u8_TxMethod, sizeof(u8_TxMethod), orc_Buffer);
+      mh_AppendRaw(&rc_Message.u32_CycleTimeMs, sizeof(rc_Message.u32_CycleTimeMs), orc_Buffer);
+      mh_AppendRaw(&u32_SignalCount, sizeof(u32_SignalCount), orc_Buffer);
+      for (uint32_t u32_ItSignal = 0U; u32_ItSignal < u32_SignalCount; ++u32_ItSignal)
+      {
+         mh_AppendSignal(rc_Message.c_Signals[u32_ItSignal], orc_Buffer);
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Read source key
+
+   \param[in,out]  orc_Reader   Reader positioned at the key
+   \param[out]     orc_Key      Read key
+
+   \retval   true    key read
+   \retval   false   damaged data
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CieDbcCache::mh_ReadKey(C_Reader & orc_Reader, C_SourceKey & orc_Key)
+{
+   return (orc_Reader.ReadString(orc_Key.c_Path) == true) &&
+          (orc_Reader.ReadRaw(&orc_Key.u64_Size, sizeof(orc_Key.u64_Size)) == true) &&
+          (orc_Reader.ReadRaw(&orc_Key.s64_LastModified, sizeof(orc_Key.s64_LastModified)) == true) &&
+          (orc_Reader.ReadRaw(&orc_Key.u32_Crc, sizeof(orc_Key.u32_Crc)) == true);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Read content
+
+   \param[in,out]  orc_Reader   Reader positioned at the content
+   \param[out]     orc_Content  Read content
+
+   \retval   true    content read
+   \retval   false   damaged data
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CieDbcCache::mh_ReadContent(C_Reader & orc_Reader, C_OscNodeDataPoolContent & orc_Content)
+{
+   uint8_t u8_Type = 0U;
+   uint8_t u8_Array = 0U;
+   uint32_t u32_ArraySize = 0U;
+   uint32_t u32_ValueSize = 0U;
+   bool q_Retval = (orc_Reader.ReadRaw(&u8_Type, sizeof(u8_Type)) == true) &&
+                   (u8_Type <= static_cast<uint8_t>(C_OscNodeDataPoolContent::eFLOAT64)) &&
+                   (orc_Reader.ReadRaw(&u8_Array, sizeof(u8_Array)) == true) &&
+                   (orc_Reader.ReadRaw(&u32_ArraySize, sizeof(u32_ArraySize)) == true) &&
+                   (orc_Reader.ReadCount(u32_ValueSize) == true);
+
+   if (q_Retval == true)
+   {
+      std::vector<uint8_t> c_Value(u32_ValueSize);
+
+      orc_Content.SetType(static_cast<C_OscNodeDataPoolContent::E_Type>(u8_Type));
+      orc_Content.SetArray(u8_Array != 0U);
+      if (u8_Array != 0U)
+      {
+         orc_Content.SetArraySize(u32_ArraySize);
+      }
+      q_Retval = ((u32_ValueSize == 0U) || (orc_Reader.ReadRaw(&c_Value[0], u32_ValueSize) == true)) &&
+                 (orc_Content.SetValueFromLittleEndianBlob(c_Value) == C_NO_ERR);
+   }
+   return q_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Read signal
+
+   \param[in,out]  orc_Reader   Reader positioned at the signal
+   \param[out]     orc_Signal   Read signal
+
+   \retval   true    signal read
+   \retval   false   damaged data
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CieDbcCache::mh_ReadSignal(C_Reader & orc_Reader, C_CieConverter::C_CieCanSignal & orc_Signal)
+{
+   C_CieConverter::C_CieDataPoolElement & rc_Element = orc_Signal.c_Element;
+   uint8_t u8_ByteOrder = 0U;
+   uint8_t u8_MultiplexerType = 0U;
+   uint32_t u32_DataSetCount = 0U;
+   uint32_t u32_ValueDescriptionCount = 0U;
+   bool q_Retval = (orc_Reader.ReadRaw(&orc_Signal.u32_J1939Spn, sizeof(orc_Signal.u32_J1939Spn)) == true) &&
+                   (orc_Reader.ReadRaw(&u8_ByteOrder, sizeof(u8_ByteOrder)) == true) &&
+                   (u8_ByteOrder <= static_cast<uint8_t>(C_OscCanSignal::eBYTE_ORDER_MOTOROLA)) &&
+                   (orc_Reader.ReadRaw(&orc_Signal.u16_ComBitLength, sizeof(orc_Signal.u16_ComBitLength)) == true) &&
+                   (orc_Reader.ReadRaw(&orc_Signal.u16_ComBitStart, sizeof(orc_Signal.u16_ComBitStart)) == true) &&
+                   (orc_Reader.ReadRaw(&u8_MultiplexerType, sizeof(u8_MultiplexerType)) == true) &&
+                   (u8_MultiplexerType <= static_cast<uint8_t>(C_OscCanSignal::eMUX_MULTIPLEXED_SIGNAL)) &&
+                   (orc_Reader.ReadRaw(&orc_Signal.u16_MultiplexValue,
+                                       sizeof(orc_Signal.u16_MultiplexValue)) == true) &&
+                   (orc_Reader.ReadString(rc_Element.c_Name) == true) &&
+                   (orc_Reader.ReadString(rc_Element.c_Comment) == true) &&
+                   (mh_ReadContent(orc_Reader, rc_Element.c_MinValue) == true) &&
+                   (mh_ReadContent(orc_Reader, rc_Element.c_MaxValue) == true) &&
+                   (orc_Reader.ReadRaw(&rc_Element.f64_Factor, sizeof(rc_Element.f64_Factor)) == true) &&
+                   (orc_Reader.ReadRaw(&rc_Element.f64_Offset, sizeof(rc_Element.f64_Offset)) == true) &&
+                   (orc_Reader.ReadString(rc_Element.c_Unit) == true) &&
+                   (orc_Reader.ReadCount(u32_DataSetCount) == true);
+
+   if (q_Retval == true)
+   {
+      orc_Signal.e_ComByteOrder = static_cast<C_OscCanSignal::E_ByteOrderType>(u8_ByteOrder);
+      orc_Signal.e_MultiplexerType = static_cast<C_OscCanSignal::E_MultiplexerType>(u8_MultiplexerType);
+      rc_Element.c_DataSetValues.resize(u32_DataSetCount);
+      for (uint32_t u32_ItDataSet = 0U; (u32_ItDataSet < u32_DataSetCount) && (q_Retval == true); ++u32_ItDataSet)
+      {
+         q_Retval = mh_ReadContent(orc_Reader, rc_Element.c_DataSetValues[u32_ItDataSet]);
+      }
+      q_Retval = (q_Retval == true) && (orc_Reader.ReadCount(u32_ValueDescriptionCount) == true);
+      for (uint32_t u32_ItValue = 0U; (u32_ItValue < u32_ValueDescriptionCount) && (q_Retval == true);
+           ++u32_ItValue)
+      {
+         int64_t s64_Value = 0;
+         C_SclString c_Description;
+         q_Retval = (orc_Reader.ReadRaw(&s64_Value, sizeof(s64_Value)) == true) &&
+                    (orc_Reader.ReadString(c_Description) == true);
+         orc_Signal.c_ValueDescription[s64_Value] = c_Description;
+      }
+   }
+   return q_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Read messages with their signals
+
+   \param[in,out]  orc_Reader     Reader positioned at the messages
+   \param[out]     orc_Messages   Read messages
+
+   \retval   true    messages read
+   \retval   false   damaged data
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CieDbcCache::mh_ReadMessages(C_Reader & orc_Reader, std::vector<C_CieConverter::C_CieNodeMessage> & orc_Messages)
+{
+   uint32_t u32_MessageCount = 0U;
+   bool q_Retval = orc_Reader.ReadCount(u32_MessageCount);
+
+   if (q_Retval == true)
+   {
+      orc_Messages.resize(u32_MessageCount);
+   }
+   for (uint32_t u32_ItMessage = 0U; (u32_ItMessage < u32_MessageCount) && (q_Retval == true); ++u32_ItMessage)
+   {
+      C_CieConverter::C_CieCanMessage & rc_Message = orc_Messages[u32_ItMessage].c_CanMessage;
+      uint8_t u8_Extended = 0U;
+      uint8_t u8_TxMethod = 0U;
+      uint32_t u32_SignalCount = 0U;
+
+      q_Retval = (orc_Reader.ReadString(rc_Message.c_Name) == true) &&
+                 (orc_Reader.ReadString(rc_Message.c_Comment) == true) &&
+                 (orc_Reader.ReadRaw(&rc_Message.u32_CanId, sizeof(rc_Message.u32_CanId)) == true) &&
+                 (orc_Reader.ReadRaw(&u8_Extended, sizeof(u8_Extended)) == true) &&
+                 (orc_Reader.ReadRaw(&rc_Message.u16_Dlc, sizeof(rc_Message.u16_Dlc)) == true) &&
+                 (orc_Reader.ReadRaw(&u8_TxMethod, sizeof(u8_TxMethod)) == true) &&
+                 (u8_TxMethod <= static_cast<uint8_t>(C_OscCanMessage::eTX_METHOD_CAN_OPEN_TYPE_255)) &&
+                 (orc_Reader.ReadRaw(&rc_Message.u32_CycleTimeMs, sizeof(rc_Message.u32_CycleTimeMs)) == true) &&
+                 (orc_Reader.ReadCount(u32_SignalCount) == true);
+      if (q_Retval == true)
+      {
+         rc_Message.q_IsExtended = (u8_Extended != 0U);
+         rc_Message.e_TxMethod = static_cast<C_OscCanMessage::E_TxMethodType>(u8_TxMethod);
+         rc_Message.c_Signals.resize(u32_SignalCount);
+         for (uint32_t u32_ItSignal = 0U; (u32_ItSignal < u32_SignalCount) && (q_Retval == true); ++u32_ItSignal)
+         {
+            q_Retval = mh_ReadSignal(orc_Reader, rc_Message.c_Signals[u32_ItSignal]);
+         }
+      }
+   }
+   return q_Retval;
+}
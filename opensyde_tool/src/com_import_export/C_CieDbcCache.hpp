@@ -0,0 +1,90 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Binary cache of imported DBC files (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_CIEDBCCACHE_HPP
+#define C_CIEDBCCACHE_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
+#include <QString>
+
+#include "stwtypes.hpp"
+#include "C_SclString.hpp"
+#include "C_CieConverter.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_gui_logic
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_CieDbcCache
+{
+public:
+   static int32_t h_Load(const QString & orc_DbcPath, const QString & orc_CacheDirectory,
+                         C_CieConverter::C_CieCommDefinition & orc_Definition, int32_t & ors32_ImportResult);
+   static int32_t h_Save(const QString & orc_DbcPath, const QString & orc_CacheDirectory,
+                         const C_CieConverter::C_CieCommDefinition & orc_Definition, const int32_t os32_ImportResult);
+
+private:
+   ///Identification of the source file a cache was created from
+   class C_SourceKey
+   {
+   public:
+      stw::scl::C_SclString c_Path; ///< Absolute path of DBC file
+      uint64_t u64_Size;            ///< File size in bytes
+      int64_t s64_LastModified;     ///< Last modification time (ms since epoch)
+      uint32_t u32_Crc;             ///< CRC32 over file content
+   };
+
+   ///Bounds checked reading of a cache file
+   class C_Reader
+   {
+   public:
+      explicit C_Reader(const std::vector<uint8_t> & orc_Data);
+
+      bool ReadRaw(void * const opv_Target, const uint32_t ou32_Size);
+      bool ReadCount(uint32_t & oru32_Count);
+      bool ReadString(stw::scl::C_SclString & orc_String);
+      bool IsAtEnd(void) const;
+
+   private:
+      const std::vector<uint8_t> & mrc_Data;
+      uint32_t mu32_Position;
+   };
+
+   static const uint32_t mhu32_FORMAT_VERSION = 1U;
+
+   static int32_t mh_GetSourceKey(const QString & orc_DbcPath, C_SourceKey & orc_Key);
+   static QString mh_GetCacheFilePath(const QString & orc_CacheDirectory, const stw::scl::C_SclString & orc_DbcPath);
+
+   static void mh_AppendRaw(const void * const opv_Data, const uint32_t ou32_Size, std::vector<uint8_t> & orc_Buffer);
+   static void mh_AppendString(const stw::scl::C_SclString & orc_String, std::vector<uint8_t> & orc_Buffer);
+   static void mh_AppendKey(const C_SourceKey & orc_Key, std::vector<uint8_t> & orc_Buffer);
+   static void mh_AppendContent(const stw::opensyde_core::C_OscNodeDataPoolContent & orc_Content,
+                                std::vector<uint8_t> & orc_Buffer);
+   static void mh_AppendSignal(const C_CieConverter::C_CieCanSignal & orc_Signal, std::vector<uint8_t> & orc_Buffer);
+   static void mh_AppendMessages(const std::vector<C_CieConverter::C_CieNodeMessage> & orc_Messages,
+                                 std::vector<uint8_t> & orc_Buffer);
+
+   static bool mh_ReadKey(C_Reader & orc_Reader, C_SourceKey & orc_Key);
+   static bool mh_ReadContent(C_Reader & orc_Reader, stw::opensyde_core::C_OscNodeDataPoolContent & orc_Content);
+   static bool mh_ReadSignal(C_Reader & orc_Reader, C_CieConverter::C_CieCanSignal & orc_Signal);
+   static bool mh_ReadMessages(C_Reader & orc_Reader, std::vector<C_CieConverter::C_CieNodeMessage> & orc_Messages);
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
@@ -11,6 +11,7 @@
 #include "precomp_headers.hpp"
 
 #include <QGraphicsItem>
+#include <QStyleOptionGraphicsItem>
 
 #include "stwtypes.hpp"
 #include "C_OscUtils.hpp"
@@ -22,6 +23,8 @@ using namespace stw::opensyde_core;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
 const float64_t C_GiCustomFunctions::hf64_SCENE_MIN_BORDER_SIZE = 6.0;
+//Scale factor (zoom 40 %) below which items are painted simplified
+const float64_t C_GiCustomFunctions::hf64_LOW_LEVEL_OF_DETAIL = 0.4;
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
@@ -211,3 +214,39 @@ QPointF C_GiCustomFunctions::h_AdaptDeltaForAspectRatio(const float64_t of64_Asp
 
    return c_Delta;
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check if items should be painted simplified for the current zoom
+
+   \param[in]  orc_Transform   Transformation from item to device coordinates
+
+   \return
+   true  Scale is below low level of detail threshold: skip text, effects and details
+   false Paint all details
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_GiCustomFunctions::h_IsLowLevelOfDetail(const QTransform & orc_Transform)
+{
+   return QStyleOptionGraphicsItem::levelOfDetailFromTransform(orc_Transform) < hf64_LOW_LEVEL_OF_DETAIL;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check if items should be painted simplified for the current painter transformation
+
+   \param[in]  opc_Painter  Painter of current paint event
+
+   \return
+   true  Scale is below low level of detail threshold: skip text, effects and details
+   false Paint all details
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_GiCustomFunctions::h_IsLowLevelOfDetail(const QPainter * const opc_Painter)
+{
+   bool q_Retval = false;
+
+   if (opc_Painter != NULL)
+   {
+      q_Retval = C_GiCustomFunctions::h_IsLowLevelOfDetail(opc_Painter->worldTransform());
+   }
+   return q_Retval;
+}
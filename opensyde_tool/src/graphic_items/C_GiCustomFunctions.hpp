@@ -11,6 +11,7 @@
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include <QVariant>
+#include <QPainter>
 #include <QGraphicsItem>
 
 #include "stwtypes.hpp"
@@ -43,8 +44,11 @@ public:
    static QPointF h_AdaptDeltaForAspectRatio(const float64_t of64_AspectRatio,
                                              const E_AspectRatioMovement oe_AspectRatioMovement,
                                              const QPointF & orc_Delta);
+   static bool h_IsLowLevelOfDetail(const QTransform & orc_Transform);
+   static bool h_IsLowLevelOfDetail(const QPainter * const opc_Painter);
 
    static const float64_t hf64_SCENE_MIN_BORDER_SIZE;
+   static const float64_t hf64_LOW_LEVEL_OF_DETAIL;
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
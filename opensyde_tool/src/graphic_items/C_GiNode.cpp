@@ -27,6 +27,7 @@
 #include "gitypes.hpp"
 #include "C_SdUtil.hpp"
 #include "C_PuiSdUtil.hpp"
+#include "C_GiCustomFunctions.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 
@@ -1062,6 +1063,26 @@ void C_GiNode::SetZetValueCustom(const float64_t of64_ZetValue)
    Q_EMIT this->SigChangedZeOrder();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Signal for update of current scaling
+
+   Switches the ports to simplified drawing for low zoom levels.
+
+   \param[in]  orc_Transform    Current scaling
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_GiNode::UpdateTransform(const QTransform & orc_Transform)
+{
+   const bool q_LowLevelOfDetail = C_GiCustomFunctions::h_IsLowLevelOfDetail(orc_Transform);
+
+   C_GiRectBaseGroup::UpdateTransform(orc_Transform);
+   for (QVector<C_GiPort *>::const_iterator c_ItPort = this->mc_Ports.begin(); c_ItPort != this->mc_Ports.end();
+        ++c_ItPort)
+   {
+      (*c_ItPort)->SetLowLevelOfDetail(q_LowLevelOfDetail);
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Returns the text
 
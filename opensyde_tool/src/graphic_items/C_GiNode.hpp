@@ -90,6 +90,7 @@ public:
 
    //GI base
    void SetZetValueCustom(const float64_t of64_ZetValue) override;
+   void UpdateTransform(const QTransform & orc_Transform) override;
 
    //The signals keyword is necessary for Qt signal slot functionality
    //lint -save -e1736
@@ -16,6 +16,7 @@
 #include "constants.hpp"
 #include "C_GiNodeBoundary.hpp"
 #include "C_Uti.hpp"
+#include "C_GiCustomFunctions.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 
@@ -56,6 +57,8 @@ C_GiNodeBoundary::C_GiNodeBoundary(const QString & orc_Text, const float64_t of6
    mu32_SubNodesCount(ou32_SubNodesCount)
 {
    this->setFlag(ItemIsMovable);
+   // Content only changes on explicit update, so panning can reuse the rendered pixmap
+   this->setCacheMode(QGraphicsItem::DeviceCoordinateCache);
 
    // Init z order
    this->setZValue(mf64_ZORDER_INIT_NODE);
@@ -102,30 +105,39 @@ void C_GiNodeBoundary::paint(QPainter * const opc_Painter, const QStyleOptionGra
    Q_UNUSED(opc_Option)
    Q_UNUSED(opc_Widget)
 
-   QPen c_Pen;
-
-   QRect c_Rect = this->boundingRect().toAlignedRect();
-   int32_t s32_Width;
-   const float64_t f64_HalfRectHeight = static_cast<float64_t>(c_Rect.height()) / 1.2;
-   //Text should not be painted center aligned
-   c_Rect.setHeight(static_cast<int32_t>(f64_HalfRectHeight));
-
-   m_DrawBackground(opc_Painter);
-
-   if (this->mq_DrawWhiteFilter == false)
+   if (C_GiCustomFunctions::h_IsLowLevelOfDetail(opc_Painter) == true)
    {
-      c_Pen.setColor(mc_STYLE_GUIDE_COLOR_4);
+      //Text is not readable anyway, so skip text layout and gradients
+      m_DrawBackgroundSimplified(opc_Painter);
    }
    else
    {
-      c_Pen.setColor(stw::opensyde_gui_logic::C_Uti::h_ScaleColor(mc_STYLE_GUIDE_COLOR_4, 54));
+      QPen c_Pen;
+
+      QRect c_Rect = this->boundingRect().toAlignedRect();
+      int32_t s32_Width;
+      const float64_t f64_HalfRectHeight = static_cast<float64_t>(c_Rect.height()) / 1.2;
+      //Text should not be painted center aligned
+      c_Rect.setHeight(static_cast<int32_t>(f64_HalfRectHeight));
+
+      m_DrawBackground(opc_Painter);
+
+      if (this->mq_DrawWhiteFilter == false)
+      {
+         c_Pen.setColor(mc_STYLE_GUIDE_COLOR_4);
+      }
+      else
+      {
+         c_Pen.setColor(stw::opensyde_gui_logic::C_Uti::h_ScaleColor(mc_STYLE_GUIDE_COLOR_4, 54));
+      }
+      opc_Painter->setPen(c_Pen);
+      opc_Painter->setFont(this->mc_Font);
+      s32_Width = c_Rect.width() - 20;
+      opc_Painter->drawText(c_Rect, static_cast<int32_t>(Qt::AlignCenter),
+                            stw::opensyde_gui_logic::C_Uti::h_AdaptStringToSize(this->mc_Text,
+                                                                                opc_Painter->fontMetrics(),
+                                                                                static_cast<float64_t>(s32_Width)));
    }
-   opc_Painter->setPen(c_Pen);
-   opc_Painter->setFont(this->mc_Font);
-   s32_Width = c_Rect.width() - 20;
-   opc_Painter->drawText(c_Rect, static_cast<int32_t>(Qt::AlignCenter),
-                         stw::opensyde_gui_logic::C_Uti::h_AdaptStringToSize(this->mc_Text, opc_Painter->fontMetrics(),
-                                                                             static_cast<float64_t>(s32_Width)));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -148,6 +160,8 @@ void C_GiNodeBoundary::Redraw(void)
 void C_GiNodeBoundary::SetText(const QString & orc_Text)
 {
    this->mc_Text = orc_Text;
+   //Refresh cached pixmap
+   this->update();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -162,6 +176,8 @@ void C_GiNodeBoundary::SetFont(const QFont & orc_Font)
 
    //Convert point to pixel
    this->mc_Font.setPixelSize(this->mc_Font.pointSize());
+   //Refresh cached pixmap
+   this->update();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -332,3 +348,32 @@ void C_GiNodeBoundary::m_DrawBackground(QPainter * const opc_Painter) const
       }
    }
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Draw the node as single rounded rect for low zoom levels
+
+   \param[in,out] opc_Painter Current painter to draw on
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_GiNodeBoundary::m_DrawBackgroundSimplified(QPainter * const opc_Painter) const
+{
+   if (opc_Painter != NULL)
+   {
+      QColor c_Color(237, 237, 237);
+
+      if (this->mq_DrawWhiteFilter == true)
+      {
+         c_Color = stw::opensyde_gui_logic::C_Uti::h_ScaleColor(c_Color, 54);
+      }
+      if (this->mq_DrawBoder == true)
+      {
+         opc_Painter->setPen(static_cast<QPen>(mc_STYLE_GUIDE_COLOR_3));
+      }
+      else
+      {
+         opc_Painter->setPen(QColor(206, 206, 217));
+      }
+      opc_Painter->setBrush(static_cast<QBrush>(c_Color));
+      opc_Painter->drawRoundedRect(this->boundingRect(), 10.0, 10.0);
+   }
+}
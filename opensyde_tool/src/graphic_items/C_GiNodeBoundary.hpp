@@ -56,6 +56,7 @@ private:
    QGraphicsDropShadowEffect * mpc_Shadow;
 
    void m_DrawBackground(QPainter * const opc_Painter) const;
+   void m_DrawBackgroundSimplified(QPainter * const opc_Painter) const;
    bool mq_DrawBoder;
    bool mq_DrawWhiteFilter;
    uint32_t mu32_SubNodesCount;
@@ -15,6 +15,7 @@
 #include "C_GiPort.hpp"
 #include "constants.hpp"
 #include "C_OscUtils.hpp"
+#include "C_GiCustomFunctions.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 
@@ -47,7 +48,8 @@ C_GiPort::C_GiPort(QGraphicsItem * const opc_Parent) :
    mc_BoundingRect(QRectF(0.0, 0.0, 40.0, 15.0)),
    ms32_RegisteredConnectors(0),
    mq_DrawBoder(false),
-   mq_DrawWhiteFilter(false)
+   mq_DrawWhiteFilter(false),
+   mq_LowLevelOfDetail(false)
 {
    this->setFlag(ItemIsMovable);
    //   this->setFlag(ItemStacksBehindParent);
@@ -103,6 +105,27 @@ void C_GiPort::paint(QPainter * const opc_Painter, const QStyleOptionGraphicsIte
    Q_UNUSED(opc_Option)
    Q_UNUSED(opc_Widget)
 
+   if (C_GiCustomFunctions::h_IsLowLevelOfDetail(opc_Painter) == true)
+   {
+      //Single polygon without surrounding and gradient
+      opc_Painter->setPen(Qt::NoPen);
+      opc_Painter->setBrush(static_cast<QBrush>(QColor(112, 112, 158)));
+      opc_Painter->drawPolygon(static_cast<QPolygonF>(this->mc_Points));
+   }
+   else
+   {
+      m_PaintDetailed(opc_Painter);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Paint port with all details
+
+   \param[in,out]  opc_Painter    Pointer to Painter
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_GiPort::m_PaintDetailed(QPainter * const opc_Painter) const
+{
    QFont c_Font;
    QLinearGradient c_Gradient;
    QVector<QPointF> c_PointsSurrounding;
@@ -343,5 +366,27 @@ void C_GiPort::SetShadow()
    {
       this->mpc_Shadow->setBlurRadius(0.0);
    }
+   //Effect rendering is not visible at low zoom levels
+   this->mpc_Shadow->setEnabled(this->mq_LowLevelOfDetail == false);
    this->setGraphicsEffect(this->mpc_Shadow);
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Activate simplified drawing for low zoom levels
+
+   Disables the shadow effect, which would render the port to an offscreen pixmap on each paint.
+
+   \param[in]     oq_Active       Flag for low level of detail
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_GiPort::SetLowLevelOfDetail(const bool oq_Active)
+{
+   if (this->mq_LowLevelOfDetail != oq_Active)
+   {
+      this->mq_LowLevelOfDetail = oq_Active;
+      if (this->mpc_Shadow != NULL)
+      {
+         this->mpc_Shadow->setEnabled(oq_Active == false);
+      }
+   }
+}
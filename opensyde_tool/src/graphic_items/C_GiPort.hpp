@@ -50,18 +50,22 @@ public:
    void SetDrawBorder(const bool oq_Active);
    void SetDrawWhiteFilter(const bool oq_Active);
    void SetShadow();
+   void SetLowLevelOfDetail(const bool oq_Active);
 
 private:
    //Avoid call
    C_GiPort(const C_GiPort &);
    C_GiPort & operator =(const C_GiPort &) &; //lint !e1511 //we want to hide the base func.
 
+   void m_PaintDetailed(QPainter * const opc_Painter) const;
+
    QGraphicsDropShadowEffect * mpc_Shadow;
    QVector<QPointF> mc_Points;
    QRectF mc_BoundingRect;
    int32_t ms32_RegisteredConnectors;
    bool mq_DrawBoder;
    bool mq_DrawWhiteFilter;
+   bool mq_LowLevelOfDetail;
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
@@ -16,12 +16,15 @@
 #include <QClipboard>
 #include <QKeyEvent>
 #include <QTextCursor>
+#include <QTextDocument>
+#include <QPainter>
 #include <QGraphicsSceneMouseEvent>
 
 #include "stwtypes.hpp"
 #include "C_GiText.hpp"
 #include "gitypes.hpp"
 #include "C_Uti.hpp"
+#include "C_GiCustomFunctions.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 using namespace stw::opensyde_gui;
@@ -100,6 +103,35 @@ QRectF C_GiText::boundingRect(void) const
    return QRectF(0.0, 0.0, this->f64_Width, this->f64_Height);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Overwritten paint event slot
+
+   Low zoom levels: text is not readable, so only the text area is indicated without text layout.
+
+   \param[in,out] opc_Painter Painter
+   \param[in,out] opc_Option  Option
+   \param[in,out] opc_Widget  Widget
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_GiText::paint(QPainter * const opc_Painter, const QStyleOptionGraphicsItem * const opc_Option,
+                     QWidget * const opc_Widget)
+{
+   if ((this->IsEditModeActive() == false) && (C_GiCustomFunctions::h_IsLowLevelOfDetail(opc_Painter) == true))
+   {
+      QColor c_Color = this->defaultTextColor();
+      const QRectF c_TextRect = QRectF(QPointF(0.0, 0.0), this->document()->size()).intersected(this->boundingRect());
+
+      c_Color.setAlpha(64);
+      opc_Painter->setPen(Qt::NoPen);
+      opc_Painter->setBrush(static_cast<QBrush>(c_Color));
+      opc_Painter->drawRect(c_TextRect);
+   }
+   else
+   {
+      QGraphicsTextItem::paint(opc_Painter, opc_Option, opc_Widget);
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Setting the flag if the text element is editable
 
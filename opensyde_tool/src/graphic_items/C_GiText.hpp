@@ -39,6 +39,8 @@ public:
    void Redraw(void) override;
 
    QRectF boundingRect(void) const override;
+   void paint(QPainter * const opc_Painter, const QStyleOptionGraphicsItem * const opc_Option,
+              QWidget * const opc_Widget = NULL) override;
 
    void SetEditable(const bool oq_Editable);
    void SetText(const QString & orc_Text);
@@ -304,6 +304,25 @@ void C_GiLiBusConnectorBase::SetZetValueCustom(const float64_t of64_ZetValue)
    //For bus connectors no data update should happen for the z value
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Returns an estimate of the area painted by the item
+
+   Uses the cached bounding rectangle of the line shape, the scene index requests it on each geometry change.
+
+   \return     Rectangle
+*/
+//----------------------------------------------------------------------------------------------------------------------
+QRectF C_GiLiBusConnectorBase::boundingRect(void) const
+{
+   QRectF c_Retval;
+
+   if (this->mpc_LinePath != NULL)
+   {
+      c_Retval = this->mpc_LinePath->GetShapeBoundingRect();
+   }
+   return c_Retval;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Overwritten mouse press event slot
 
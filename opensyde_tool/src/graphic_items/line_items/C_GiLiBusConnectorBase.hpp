@@ -62,6 +62,8 @@ public:
    //GI base
    void SetZetValueCustom(const float64_t of64_ZetValue) override;
 
+   QRectF boundingRect(void) const override;
+
    //The signals keyword is necessary for Qt signal slot functionality
    //lint -save -e1736
 
@@ -69,7 +69,8 @@ C_GiLiLine::C_GiLiLine(const std::vector<QPointF> * const opc_Points, const bool
    mq_ShowOriginalLine(true),
    mq_SpeedUpAnimation(false),
    mu8_AnimationStep(0),
-   mc_AnimationPackageColor(QColor(156, 60, 60))
+   mc_AnimationPackageColor(QColor(156, 60, 60)),
+   mq_ShapeValid(false)
 {
    //Pen (FIRST!)
    {
@@ -118,6 +119,7 @@ void C_GiLiLine::Init(const std::vector<QPointF> & orc_Points)
    QPointF c_AdaptedScenePos;
 
    //Points
+   this->m_InvalidateShape();
    this->mc_Points.clear();
    this->mc_Points.reserve(orc_Points.size());
    for (uint32_t u32_ItPoint = 0; u32_ItPoint < orc_Points.size(); ++u32_ItPoint)
@@ -325,6 +327,15 @@ uint8_t C_GiLiLine::m_GetAnimationStepCount(void) const
    return u8_Retval;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Discard cached shape after change of points or widths
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_GiLiLine::m_InvalidateShape(void)
+{
+   this->mq_ShapeValid = false;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Set interaction point width
 
@@ -335,6 +346,7 @@ void C_GiLiLine::SetInteractionWidth(const float64_t & orf64_Value)
 {
    this->prepareGeometryChange();
    this->mf64_InteractionWidth = orf64_Value;
+   this->m_InvalidateShape();
    for (QVector<C_GiLiLineConnection *>::iterator pc_ItLine = this->mc_Lines.begin(); pc_ItLine != this->mc_Lines.end();
         ++pc_ItLine)
    {
@@ -356,6 +368,7 @@ void C_GiLiLine::SetInteractionWidth(const float64_t & orf64_Value)
 void C_GiLiLine::AddPoint(const int32_t & ors32_Index, const QPointF & orc_Pos)
 {
    this->mc_Points.insert(ors32_Index, orc_Pos);
+   this->m_InvalidateShape();
 
    this->m_AddLineAt(ors32_Index);
 }
@@ -372,6 +385,7 @@ void C_GiLiLine::UpdatePoint(const int32_t & ors32_Index, const QPointF & orc_Po
    if (this->mc_Points.size() > ors32_Index)
    {
       this->mc_Points[ors32_Index] = orc_Pos;
+      this->m_InvalidateShape();
 
       //previous line
       this->m_UpdateLine(ors32_Index - 1L);
@@ -400,6 +414,7 @@ void C_GiLiLine::RemovePoint(const int32_t & ors32_Index)
    if (this->mc_Points.size() > 2L)
    {
       this->mc_Points.remove(ors32_Index);
+      this->m_InvalidateShape();
 
       this->m_RemoveLineAt(ors32_Index - 1L);
       //update last line
@@ -423,6 +438,7 @@ void C_GiLiLine::SetWidth(const int32_t & ors32_Width)
    QPen c_Pen = this->pen();
 
    c_Pen.setWidth(ors32_Width);
+   this->m_InvalidateShape();
    for (int32_t s32_ItLine = 0; s32_ItLine < mc_Lines.size(); ++s32_ItLine)
    {
       mc_Lines[s32_ItLine]->SetWidth(ors32_Width);
@@ -670,7 +686,8 @@ void C_GiLiLine::paint(QPainter * const opc_Painter, const QStyleOptionGraphicsI
       {
          QGraphicsPathItem::paint(opc_Painter, opc_Option, opc_Widget);
 
-         if (this->mq_MiddleLine)
+         //Middle line is not visible at low zoom levels
+         if ((this->mq_MiddleLine) && (C_GiCustomFunctions::h_IsLowLevelOfDetail(opc_Painter) == false))
          {
             opc_Painter->save();
             c_Pen = this->pen();
@@ -768,10 +785,34 @@ void C_GiLiLine::paint(QPainter * const opc_Painter, const QStyleOptionGraphicsI
 //----------------------------------------------------------------------------------------------------------------------
 QPainterPath C_GiLiLine::shape(void) const
 {
-   stw::opensyde_gui_logic::C_GiBiLineBounding c_LineBounding(this->mc_Points,
-                                                              static_cast<float64_t>(this->GetWidth()),
-                                                              this->mf64_InteractionWidth);
-   return c_LineBounding.GetShape();
+   if (this->mq_ShapeValid == false)
+   {
+      stw::opensyde_gui_logic::C_GiBiLineBounding c_LineBounding(this->mc_Points,
+                                                                 static_cast<float64_t>(this->GetWidth()),
+                                                                 this->mf64_InteractionWidth);
+      this->mc_Shape = c_LineBounding.GetShape();
+      this->mc_ShapeBoundingRect = this->mc_Shape.boundingRect();
+      this->mq_ShapeValid = true;
+   }
+   return this->mc_Shape;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get bounding rectangle of shape
+
+   Cached until the next change of points or widths, so index updates and paint requests do not rebuild the shape.
+
+   \return
+   Bounding rectangle of shape
+*/
+//----------------------------------------------------------------------------------------------------------------------
+QRectF C_GiLiLine::GetShapeBoundingRect(void) const
+{
+   if (this->mq_ShapeValid == false)
+   {
+      static_cast<void>(this->shape());
+   }
+   return this->mc_ShapeBoundingRect;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -70,6 +70,7 @@ public:
               QWidget * const opc_Widget = NULL) override;
 
    QPainterPath shape(void) const override;
+   QRectF GetShapeBoundingRect(void) const;
 
    void FindClosestPoint(const QPointF & orc_ScenePoint, QPointF & orc_Closest) const override;
 
@@ -91,6 +92,7 @@ private:
    void m_UpdateAnimation(void);
    void m_SetColor(const QColor & orc_Color, const bool oq_SendUpdate);
    uint8_t m_GetAnimationStepCount(void) const;
+   void m_InvalidateShape(void);
 
    bool mq_MiddleLine;        ///< Indicator if middle line should be drawn
    QColor mc_LineColor;       ///< Main line color
@@ -108,6 +110,9 @@ private:
    static const uint8_t mhu8_ANIMATION_STEP_COUNT;
    QColor mc_AnimationPackageColor;
    QPolygonF mc_AnimationPolygon;
+   mutable QPainterPath mc_Shape;        ///< Cached shape, only valid if flag is set
+   mutable QRectF mc_ShapeBoundingRect;  ///< Cached bounding rectangle of shape, only valid if flag is set
+   mutable bool mq_ShapeValid;
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
@@ -10,9 +10,11 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "precomp_headers.hpp"
 
+#include <QPainter>
 #include <QGraphicsSceneMouseEvent>
 
 #include "C_GiWiProxyBase.hpp"
+#include "C_GiCustomFunctions.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 using namespace stw::opensyde_gui;
@@ -58,6 +60,33 @@ void C_GiWiProxyBase::Redraw(void)
    this->setGeometry(this->GetSizeRect());
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Overwritten paint event slot
+
+   For low zoom levels only a placeholder is drawn instead of rendering the embedded widget.
+
+   \param[in,out] opc_Painter   Pointer to Painter
+   \param[in]     opc_Option    Style option
+   \param[in,out] opc_Widget    Optional widget to paint on
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_GiWiProxyBase::paint(QPainter * const opc_Painter, const QStyleOptionGraphicsItem * const opc_Option,
+                            QWidget * const opc_Widget)
+{
+   if (C_GiCustomFunctions::h_IsLowLevelOfDetail(opc_Painter) == true)
+   {
+      opc_Painter->save();
+      opc_Painter->setPen(QColor(160, 160, 160));
+      opc_Painter->setBrush(QColor(160, 160, 160, 64));
+      opc_Painter->drawRect(this->boundingRect());
+      opc_Painter->restore();
+   }
+   else
+   {
+      QGraphicsProxyWidget::paint(opc_Painter, opc_Option, opc_Widget);
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Trigger mouse press event
 
@@ -45,6 +45,9 @@ public:
    void TriggerHoverMoveEvent(QGraphicsSceneHoverEvent * const opc_Event);
    void TriggerHoverLeaveEvent(QGraphicsSceneHoverEvent * const opc_Event);
 
+   void paint(QPainter * const opc_Painter, const QStyleOptionGraphicsItem * const opc_Option,
+              QWidget * const opc_Widget) override;
+
 private:
    bool mq_GrabbedByWidget;
 };
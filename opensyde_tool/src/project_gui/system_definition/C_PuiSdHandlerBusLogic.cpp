@@ -686,6 +686,7 @@ void C_PuiSdHandlerBusLogic::AddConnection(const uint32_t ou32_NodeIndex, const
          if ((u32_CurIndex < this->mc_CoreDefinition.c_Nodes.size()) && (pc_Bus != NULL))
          {
             C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[u32_CurIndex];
+            rc_Node.InvalidateErrorCheckCache();
             const C_OscNodeComInterfaceSettings * const pc_CurComInterface = rc_Node.c_Properties.GetComInterface(
                pc_Bus->e_Type, ou8_InterfaceNumber);
             if (pc_CurComInterface != NULL)
@@ -747,6 +748,7 @@ void C_PuiSdHandlerBusLogic::RemoveConnection(const uint32_t ou32_NodeIndex, con
       {
          C_PuiSdNode & rc_UiNode = this->mc_UiNodes[u32_CurIndex];
          C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[u32_CurIndex];
+         rc_OscNode.InvalidateErrorCheckCache();
 
          rc_OscNode.c_Properties.DisconnectComInterface(orc_Id.e_InterfaceType, orc_Id.u8_InterfaceNumber);
          rc_UiNode.DeleteConnection(orc_Id);
@@ -812,6 +814,7 @@ void C_PuiSdHandlerBusLogic::ChangeCompleteConnection(const uint32_t ou32_NodeIn
       {
          C_PuiSdNode & rc_UiNode = this->mc_UiNodes[u32_CurIndex];
          C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[u32_CurIndex];
+         rc_OscNode.InvalidateErrorCheckCache();
          uint32_t u32_LastBus = 0;
          //Unregister
          for (uint32_t u32_ItComInterface = 0; u32_ItComInterface < rc_OscNode.c_Properties.c_ComInterfaces.size();
@@ -1618,6 +1621,7 @@ void C_PuiSdHandlerBusLogic::SetCanProtocolMessageContainerConnected(const uint3
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_Node.InvalidateErrorCheckCache();
       // get necessary datapool
       std::vector<C_OscCanProtocol *> c_Protocols = rc_Node.GetCanProtocols(oe_ComType);
       uint32_t u32_Counter;
@@ -1676,6 +1680,7 @@ int32_t C_PuiSdHandlerBusLogic::SetCanMessageProperties(const C_OscCanMessageIde
          {
             std::vector<C_OscNodeDataPoolListElement> c_Signals;
             C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[orc_MessageId.u32_NodeIndex];
+            rc_Node.InvalidateErrorCheckCache();
             //Copy signals
             c_Signals.reserve(pc_Message->c_Signals.size());
             for (uint32_t u32_ItSignals = 0; u32_ItSignals < pc_Message->c_Signals.size(); ++u32_ItSignals)
@@ -1748,6 +1753,12 @@ int32_t C_PuiSdHandlerBusLogic::SetCanMessageProperties(const C_OscCanMessageIde
    {
       s32_Retval = C_RANGE;
    }
+
+   if (s32_Retval == C_NO_ERR)
+   {
+      Q_EMIT (this->SigSyncNodeNamesChanged(orc_MessageId.u32_NodeIndex));
+   }
+
    return s32_Retval;
 }
 
@@ -1831,6 +1842,7 @@ int32_t C_PuiSdHandlerBusLogic::SetCanSignal(const C_OscCanMessageIdentification
    if (orc_MessageId.u32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[orc_MessageId.u32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
       const C_OscCanProtocol * const pc_Protocol = rc_OscNode.GetCanProtocolConst(orc_MessageId.e_ComProtocol,
                                                                                   orc_MessageId.u32_DatapoolIndex);
       C_PuiSdNodeCanProtocol * const pc_UiProtocol = this->m_GetUiCanProtocol(orc_MessageId.u32_NodeIndex,
@@ -1924,6 +1936,12 @@ int32_t C_PuiSdHandlerBusLogic::SetCanSignal(const C_OscCanMessageIdentification
    {
       s32_Retval = C_RANGE;
    }
+
+   if (s32_Retval == C_NO_ERR)
+   {
+      Q_EMIT (this->SigSyncNodeNamesChanged(orc_MessageId.u32_NodeIndex));
+   }
+
    return s32_Retval;
 }
 
@@ -1950,6 +1968,7 @@ int32_t C_PuiSdHandlerBusLogic::SetCanSignalMuxValue(const C_OscCanMessageIdenti
    if (orc_MessageId.u32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[orc_MessageId.u32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
       s32_Retval = rc_OscNode.SetSignalMuxValue(orc_MessageId.e_ComProtocol, orc_MessageId.u32_InterfaceIndex,
                                                 orc_MessageId.u32_DatapoolIndex,
                                                 orc_MessageId.q_MessageIsTx, orc_MessageId.u32_MessageIndex,
@@ -2041,6 +2060,7 @@ int32_t C_PuiSdHandlerBusLogic::InsertCanMessage(const C_OscCanMessageIdentifica
    if (orc_MessageId.u32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[orc_MessageId.u32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
       C_OscCanMessage c_AdaptedMessage = orc_Message;
       if (orq_AutomatedPropertiesAdaption == true)
       {
@@ -2070,6 +2090,12 @@ int32_t C_PuiSdHandlerBusLogic::InsertCanMessage(const C_OscCanMessageIdentifica
          s32_Retval = m_InsertUiCanMessage(orc_MessageId, orc_UiSignalCommons, orc_UiMessage);
       }
    }
+
+   if (s32_Retval == C_NO_ERR)
+   {
+      Q_EMIT (this->SigSyncNodeNamesChanged(orc_MessageId.u32_NodeIndex));
+   }
+
    return s32_Retval;
 }
 
@@ -2092,6 +2118,7 @@ int32_t C_PuiSdHandlerBusLogic::DeleteCanMessage(const C_OscCanMessageIdentifica
    {
       const C_OscCanMessage * const pc_Message = this->GetCanMessage(orc_MessageId);
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[orc_MessageId.u32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
       if (pc_Message != NULL)
       {
          //Signal each deleted signal to the sync engine (descending order is important, do this before actually
@@ -2114,6 +2141,12 @@ int32_t C_PuiSdHandlerBusLogic::DeleteCanMessage(const C_OscCanMessageIdentifica
                                           orc_MessageId.q_MessageIsTx,
                                           orc_MessageId.u32_MessageIndex) == C_NO_ERR);
    }
+
+   if (s32_Retval == C_NO_ERR)
+   {
+      Q_EMIT (this->SigSyncNodeNamesChanged(orc_MessageId.u32_NodeIndex));
+   }
+
    return s32_Retval;
 }
 
@@ -2180,6 +2213,7 @@ int32_t C_PuiSdHandlerBusLogic::InsertCanSignal(const C_OscCanMessageIdentificat
    if (orc_MessageId.u32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[orc_MessageId.u32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
       C_OscNodeDataPoolListElement c_OscAdaptedSignalCommon = orc_OscSignalCommon;
       C_OscNodeDataPoolListElementId c_Id;
 
@@ -2315,6 +2349,12 @@ int32_t C_PuiSdHandlerBusLogic::InsertCanSignal(const C_OscCanMessageIdentificat
    {
       s32_Retval = C_RANGE;
    }
+
+   if (s32_Retval == C_NO_ERR)
+   {
+      Q_EMIT (this->SigSyncNodeNamesChanged(orc_MessageId.u32_NodeIndex));
+   }
+
    return s32_Retval;
 }
 
@@ -2338,6 +2378,7 @@ int32_t C_PuiSdHandlerBusLogic::DeleteCanSignal(const C_OscCanMessageIdentificat
    if (orc_MessageId.u32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[orc_MessageId.u32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
       C_OscNodeDataPoolListElementId c_Id;
 
       //Signal deleted signal to the sync engine
@@ -2466,6 +2507,12 @@ int32_t C_PuiSdHandlerBusLogic::DeleteCanSignal(const C_OscCanMessageIdentificat
    {
       s32_Retval = C_RANGE;
    }
+
+   if (s32_Retval == C_NO_ERR)
+   {
+      Q_EMIT (this->SigSyncNodeNamesChanged(orc_MessageId.u32_NodeIndex));
+   }
+
    return s32_Retval;
 }
 
@@ -444,6 +444,7 @@ int32_t C_PuiSdHandlerCanOpenLogic::SetCanOpenManagerCommonProperties(const uint
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_Node.InvalidateErrorCheckCache();
       const std::map<uint8_t,
                      C_OscCanOpenManagerInfo>::iterator c_ItManager = rc_Node.c_CanOpenManagers.find(
          ou8_InterfaceNumber);
@@ -495,6 +496,7 @@ int32_t C_PuiSdHandlerCanOpenLogic::SetCanOpenManagerProducerHeartbeat(const uin
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_Node.InvalidateErrorCheckCache();
       const std::map<uint8_t,
                      C_OscCanOpenManagerInfo>::iterator c_ItManager = rc_Node.c_CanOpenManagers.find(
          ou8_InterfaceNumber);
@@ -566,6 +568,7 @@ int32_t C_PuiSdHandlerCanOpenLogic::SetCanOpenManagerPdoSync(const uint32_t ou32
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_Node.InvalidateErrorCheckCache();
       const std::map<uint8_t,
                      C_OscCanOpenManagerInfo>::iterator c_ItManager = rc_Node.c_CanOpenManagers.find(
          ou8_InterfaceNumber);
@@ -632,6 +635,7 @@ int32_t C_PuiSdHandlerCanOpenLogic::SetCanOpenManagerDeviceCommonProperties(cons
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_Node.InvalidateErrorCheckCache();
       const std::map<uint8_t,
                      C_OscCanOpenManagerInfo>::iterator c_ItManager = rc_Node.c_CanOpenManagers.find(
          ou8_InterfaceNumber);
@@ -698,6 +702,7 @@ int32_t C_PuiSdHandlerCanOpenLogic::SetCanOpenManagerDeviceNodeId(const uint32_t
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_Node.InvalidateErrorCheckCache();
       const std::map<uint8_t,
                      C_OscCanOpenManagerInfo>::iterator c_ItManager = rc_Node.c_CanOpenManagers.find(
          ou8_InterfaceNumber);
@@ -754,6 +759,7 @@ int32_t C_PuiSdHandlerCanOpenLogic::AddCanOpenManager(const uint32_t ou32_NodeIn
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_Node.InvalidateErrorCheckCache();
       const std::map<uint8_t,
                      C_OscCanOpenManagerInfo>::const_iterator c_ItManager = rc_Node.c_CanOpenManagers.find(
          ou8_InterfaceNumber);
@@ -808,6 +814,7 @@ int32_t C_PuiSdHandlerCanOpenLogic::DeleteCanOpenManager(const uint32_t ou32_Nod
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_Node.InvalidateErrorCheckCache();
       const std::map<uint8_t,
                      C_OscCanOpenManagerInfo>::const_iterator c_ItManager = rc_Node.c_CanOpenManagers.find(
          ou8_InterfaceNumber);
@@ -873,6 +880,7 @@ int32_t C_PuiSdHandlerCanOpenLogic::AddCanOpenManagerDevice(const uint32_t ou32_
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_Node.InvalidateErrorCheckCache();
       const std::map<uint8_t,
                      C_OscCanOpenManagerInfo>::iterator c_ItManager = rc_Node.c_CanOpenManagers.find(
          ou8_InterfaceNumber);
@@ -929,6 +937,7 @@ int32_t C_PuiSdHandlerCanOpenLogic::ReplaceCanOpenManagerDevice(const uint32_t o
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_Node.InvalidateErrorCheckCache();
       const std::map<uint8_t,
                      C_OscCanOpenManagerInfo>::iterator c_ItManager = rc_Node.c_CanOpenManagers.find(
          ou8_InterfaceNumber);
@@ -983,6 +992,7 @@ int32_t C_PuiSdHandlerCanOpenLogic::DeleteCanOpenManagerDevice(const uint32_t ou
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_Node.InvalidateErrorCheckCache();
       const std::map<uint8_t,
                      C_OscCanOpenManagerInfo>::iterator c_ItManager = rc_Node.c_CanOpenManagers.find(
          ou8_InterfaceNumber);
@@ -1036,6 +1046,7 @@ int32_t C_PuiSdHandlerCanOpenLogic::DeleteAllCanOpenManagerDevices(const uint32_
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_Node.InvalidateErrorCheckCache();
       const std::map<uint8_t,
                      C_OscCanOpenManagerInfo>::const_iterator c_ItManager = rc_Node.c_CanOpenManagers.find(
          ou8_InterfaceNumber);
@@ -1383,6 +1394,7 @@ void C_PuiSdHandlerCanOpenLogic::m_HandleSyncNodeAddedForCanOpenDevices(const ui
    for (uint32_t u32_ItNode = 0UL; u32_ItNode < this->mc_CoreDefinition.c_Nodes.size(); ++u32_ItNode)
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[u32_ItNode];
+      rc_Node.InvalidateErrorCheckCache();
       for (std::map<uint8_t, C_OscCanOpenManagerInfo>::iterator c_ItManager =
               rc_Node.c_CanOpenManagers.begin();
            c_ItManager != rc_Node.c_CanOpenManagers.end(); ++c_ItManager)
@@ -1428,6 +1440,7 @@ void C_PuiSdHandlerCanOpenLogic::m_HandleSyncNodeAddedForCanOpenMessages(const u
    for (uint32_t u32_ItNode = 0UL; u32_ItNode < this->mc_CoreDefinition.c_Nodes.size(); ++u32_ItNode)
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[u32_ItNode];
+      rc_Node.InvalidateErrorCheckCache();
       for (uint32_t u32_ItProt = 0UL; u32_ItProt < rc_Node.c_ComProtocols.size(); ++u32_ItProt)
       {
          C_OscCanProtocol & rc_Prot = rc_Node.c_ComProtocols[u32_ItProt];
@@ -1490,6 +1503,7 @@ void C_PuiSdHandlerCanOpenLogic::m_HandleSyncNodeAboutToBeDeletedForCanOpenDevic
    for (uint32_t u32_ItNode = 0UL; u32_ItNode < this->mc_CoreDefinition.c_Nodes.size(); ++u32_ItNode)
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[u32_ItNode];
+      rc_Node.InvalidateErrorCheckCache();
       for (std::map<uint8_t, C_OscCanOpenManagerInfo>::iterator c_ItManager =
               rc_Node.c_CanOpenManagers.begin();
            c_ItManager != rc_Node.c_CanOpenManagers.end(); ++c_ItManager)
@@ -1542,6 +1556,7 @@ void C_PuiSdHandlerCanOpenLogic::m_HandleSyncNodeAboutToBeDeletedForCanOpenMessa
    for (uint32_t u32_ItNode = 0UL; u32_ItNode < this->mc_CoreDefinition.c_Nodes.size(); ++u32_ItNode)
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[u32_ItNode];
+      rc_Node.InvalidateErrorCheckCache();
       for (uint32_t u32_ItProt = 0UL; u32_ItProt < rc_Node.c_ComProtocols.size(); ++u32_ItProt)
       {
          C_OscCanProtocol & rc_Prot = rc_Node.c_ComProtocols[u32_ItProt];
@@ -1632,6 +1647,7 @@ void C_PuiSdHandlerCanOpenLogic::m_HandleChangeConnectionForCanOpenDevices(const
       for (uint32_t u32_ItNode = 0UL; u32_ItNode < this->mc_CoreDefinition.c_Nodes.size(); ++u32_ItNode)
       {
          C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[u32_ItNode];
+         rc_Node.InvalidateErrorCheckCache();
          for (std::map<uint8_t, C_OscCanOpenManagerInfo>::iterator c_ItManager =
                  rc_Node.c_CanOpenManagers.begin();
               c_ItManager != rc_Node.c_CanOpenManagers.end(); ++c_ItManager)
@@ -1686,6 +1702,7 @@ void C_PuiSdHandlerCanOpenLogic::m_HandleChangeConnectionForCanOpenManager(const
       if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
       {
          C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+         rc_Node.InvalidateErrorCheckCache();
 
          const std::map<uint8_t,
                         C_OscCanOpenManagerInfo>::const_iterator c_ItPrev = rc_Node.c_CanOpenManagers.find(
@@ -1722,6 +1739,7 @@ void C_PuiSdHandlerCanOpenLogic::m_HandleChangeConnectionForCanOpenDeviceMessage
    for (uint32_t u32_ItNode = 0UL; u32_ItNode < this->mc_CoreDefinition.c_Nodes.size(); ++u32_ItNode)
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[u32_ItNode];
+      rc_Node.InvalidateErrorCheckCache();
       for (uint32_t u32_ItProt = 0UL; u32_ItProt < rc_Node.c_ComProtocols.size(); ++u32_ItProt)
       {
          C_OscCanProtocol & rc_Prot = rc_Node.c_ComProtocols[u32_ItProt];
@@ -1828,6 +1846,7 @@ void C_PuiSdHandlerCanOpenLogic::m_MoveMessagesInOscDatapool(const uint32_t ou32
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_Node.InvalidateErrorCheckCache();
       for (uint32_t u32_ItProt = 0UL; u32_ItProt < rc_Node.c_ComProtocols.size(); ++u32_ItProt)
       {
          const C_OscCanProtocol & rc_Prot = rc_Node.c_ComProtocols[u32_ItProt];
@@ -1994,6 +2013,7 @@ void C_PuiSdHandlerCanOpenLogic::m_MoveMessagesInOscProtocol(const uint32_t ou32
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_Node.InvalidateErrorCheckCache();
       for (uint32_t u32_ItProt = 0UL; u32_ItProt < rc_Node.c_ComProtocols.size(); ++u32_ItProt)
       {
          C_OscCanProtocol & rc_Prot = rc_Node.c_ComProtocols[u32_ItProt];
@@ -2040,6 +2060,7 @@ void C_PuiSdHandlerCanOpenLogic::m_MoveMessagesInUiProtocol(const uint32_t ou32_
    {
       C_PuiSdNode & rc_UiNode = this->mc_UiNodes[ou32_NodeIndex];
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_Node.InvalidateErrorCheckCache();
       tgl_assert(rc_UiNode.c_UiCanProtocols.size() == rc_Node.c_ComProtocols.size());
       if (rc_UiNode.c_UiCanProtocols.size() == rc_Node.c_ComProtocols.size())
       {
@@ -2193,6 +2214,7 @@ void C_PuiSdHandlerCanOpenLogic::m_HandleOsyNodeIdChangeForCanOpenManager(const
       if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
       {
          C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+         rc_OscNode.InvalidateErrorCheckCache();
          const std::map<uint8_t,
                         C_OscCanOpenManagerInfo>::iterator c_ItCanOpenManager = rc_OscNode.c_CanOpenManagers.find(
             u8_InterfaceNumber);
@@ -2228,6 +2250,7 @@ void C_PuiSdHandlerCanOpenLogic::m_HandleOsyNodeIdChangeForCanOpenDevice(const u
       for (uint32_t u32_ItNode = 0UL; u32_ItNode < this->mc_CoreDefinition.c_Nodes.size(); ++u32_ItNode)
       {
          C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[u32_ItNode];
+         rc_OscNode.InvalidateErrorCheckCache();
          for (std::map<uint8_t,
                        C_OscCanOpenManagerInfo>::iterator c_ItCanOpenManager = rc_OscNode.c_CanOpenManagers.begin();
               c_ItCanOpenManager != rc_OscNode.c_CanOpenManagers.end(); ++c_ItCanOpenManager)
@@ -2267,6 +2290,7 @@ void C_PuiSdHandlerCanOpenLogic::m_HandleNodeIdChangeForCanOpenMessages(const ui
       if (pc_FoundDevice != NULL)
       {
          C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[u32_ItNode];
+         rc_Node.InvalidateErrorCheckCache();
          for (uint32_t u32_ItProt = 0UL; u32_ItProt < rc_Node.c_ComProtocols.size(); ++u32_ItProt)
          {
             C_OscCanProtocol & rc_Prot = rc_Node.c_ComProtocols[u32_ItProt];
@@ -2328,6 +2352,7 @@ void C_PuiSdHandlerCanOpenLogic::m_HandlePdoSyncChangeForCanOpenMessages(const u
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_Node.InvalidateErrorCheckCache();
       uint32_t u32_InterfaceIndex;
 
       // Searching the matching interface index
@@ -892,6 +892,7 @@ void C_PuiSdHandlerData::m_FixNameIssues(void)
    for (uint32_t u32_ItNode = 0; u32_ItNode < this->mc_CoreDefinition.c_Nodes.size(); ++u32_ItNode)
    {
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[u32_ItNode];
+      rc_OscNode.InvalidateErrorCheckCache();
       rc_OscNode.c_Properties.c_Name = C_PuiSdHandlerData::h_AutomaticCeStringAdaptation(
          rc_OscNode.c_Properties.c_Name.c_str()).toStdString().c_str();
    }
@@ -912,6 +913,7 @@ void C_PuiSdHandlerData::m_FixAddressIssues(void)
    for (uint32_t u32_ItNode = 0; u32_ItNode < this->mc_CoreDefinition.c_Nodes.size(); ++u32_ItNode)
    {
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[u32_ItNode];
+      rc_OscNode.InvalidateErrorCheckCache();
       rc_OscNode.RecalculateAddress();
    }
 }
@@ -931,6 +933,7 @@ void C_PuiSdHandlerData::m_FixCommInconsistencyErrors(void)
            ++u32_ItNode)
       {
          C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[u32_ItNode];
+         rc_OscNode.InvalidateErrorCheckCache();
          C_PuiSdNode & rc_UiNode = this->mc_UiNodes[u32_ItNode];
 
          //Protocols
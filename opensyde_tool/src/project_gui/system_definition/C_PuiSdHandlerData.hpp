@@ -113,6 +113,8 @@ Q_SIGNALS:
    void SigSyncNodeAdded(const uint32_t ou32_Index);
    void SigSyncNodeHalc(const uint32_t ou32_Index);
    void SigSyncNodeReplace(const uint32_t ou32_Index);
+   // Name of any node content (Datapool, list, element, message, data block, HALC channel) might have changed
+   void SigSyncNodeNamesChanged(const uint32_t ou32_NodeIndex);
    void SigSyncNodeAboutToBeDeleted(const uint32_t ou32_Index, const bool oq_OnlyMarkInvalid);
    void SigSyncNodeDataPoolAdded(const uint32_t ou32_NodeIndex, const uint32_t ou32_DataPoolIndex);
    void SigSyncNodeDataPoolMoved(const uint32_t ou32_NodeIndex, const uint32_t ou32_DataPoolSourceIndex,
@@ -545,12 +545,19 @@ int32_t C_PuiSdHandlerHalc::SetHalcConfig(const uint32_t ou32_NodeIndex, const C
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
       rc_Node.c_HalcConfig = orc_Config;
+      //Changes of replaced configuration are unknown
+      rc_Node.c_HalcConfig.InvalidateChangeTracking();
    }
    else
    {
       s32_Retval = C_RANGE;
    }
 
+   if (s32_Retval == C_NO_ERR)
+   {
+      Q_EMIT (this->SigSyncNodeNamesChanged(ou32_NodeIndex));
+   }
+
    return s32_Retval;
 }
 
@@ -581,6 +588,11 @@ int32_t C_PuiSdHandlerHalc::SetHalcDomainConfig(const uint32_t ou32_NodeIndex, c
       s32_Retval = C_RANGE;
    }
 
+   if (s32_Retval == C_NO_ERR)
+   {
+      Q_EMIT (this->SigSyncNodeNamesChanged(ou32_NodeIndex));
+   }
+
    return s32_Retval;
 }
 
@@ -643,6 +655,11 @@ int32_t C_PuiSdHandlerHalc::SetHalcDomainChannelConfig(const uint32_t ou32_NodeI
       s32_Retval = C_RANGE;
    }
 
+   if (s32_Retval == C_NO_ERR)
+   {
+      Q_EMIT (this->SigSyncNodeNamesChanged(ou32_NodeIndex));
+   }
+
    return s32_Retval;
 }
 
@@ -746,6 +763,11 @@ int32_t C_PuiSdHandlerHalc::SetHalcDomainChannelConfigName(const uint32_t ou32_N
       s32_Retval = C_RANGE;
    }
 
+   if (s32_Retval == C_NO_ERR)
+   {
+      Q_EMIT (this->SigSyncNodeNamesChanged(ou32_NodeIndex));
+   }
+
    return s32_Retval;
 }
 
@@ -1720,10 +1742,13 @@ const
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  HALC generate datapools
 
+   If only domain or channel values changed since the last generation, the existing HAL Datapools are updated in
+   place instead of being regenerated.
+
    \param[in]  ou32_NodeIndex    Node index
 
    \return
-   C_NO_ERR Datapool generated
+   C_NO_ERR Datapool generated or updated
    C_NOACT  No datapool generated because nothing changed
    C_CONFIG Configuration invalid
    C_RANGE  Parameter invalid
@@ -1737,13 +1762,31 @@ int32_t C_PuiSdHandlerHalc::HalcGenerateDatapools(const uint32_t ou32_NodeIndex)
        (ou32_NodeIndex < this->mc_UiNodes.size()))
    {
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
       const std::map<uint32_t, uint32_t>::const_iterator c_ItPrevHash = mc_PreviousHashes.find(ou32_NodeIndex);
 
       uint32_t u32_CurrentHash = 0xFFFFFFFFUL;
+      int32_t s32_UpdateResult = C_NOACT;
       rc_OscNode.c_HalcConfig.CalcHash(u32_CurrentHash);
+      const bool q_Changed = (c_ItPrevHash == mc_PreviousHashes.end()) || (c_ItPrevHash->second != u32_CurrentHash);
 
+      // in case only values changed the existing HAL Datapools can be updated in place
+      if ((q_Changed == true) && (rc_OscNode.c_HalcConfig.c_FileString.IsEmpty() == false))
+      {
+         const C_OscHalcMagicianGenerator c_Magician(&rc_OscNode);
+         s32_UpdateResult = c_Magician.UpdateHalcDatapools(rc_OscNode.c_DataPools);
+      }
+
+      if (s32_UpdateResult == C_NO_ERR)
+      {
+         mc_PreviousHashes[ou32_NodeIndex] = u32_CurrentHash;
+         s32_Retval = C_NO_ERR;
+
+         //Trigger sync
+         m_HandleSyncNodeHalc(ou32_NodeIndex);
+      }
       // check if HALC configuration changed since last HALC Datapool generation
-      if ((c_ItPrevHash == mc_PreviousHashes.end()) || (c_ItPrevHash->second != u32_CurrentHash))
+      else if (q_Changed == true)
       {
          std::vector<C_OscNodeDataPool> c_Tmp;
          mc_PreviousHashes[ou32_NodeIndex] = u32_CurrentHash;
@@ -1829,6 +1872,12 @@ int32_t C_PuiSdHandlerHalc::HalcGenerateDatapools(const uint32_t ou32_NodeIndex)
       {
          s32_Retval = C_NOACT;
       }
+
+      // HAL Datapools match the configuration now
+      if ((s32_Retval == C_NO_ERR) || (s32_Retval == C_NOACT))
+      {
+         rc_OscNode.c_HalcConfig.ResetChangeTracking();
+      }
    }
    else
    {
@@ -1903,6 +1952,7 @@ int32_t C_PuiSdHandlerHalc::HalcResetDataBlocks(const uint32_t ou32_NodeIndex)
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
       uint32_t u32_Counter;
 
       // reset applications of type parameter set to binary
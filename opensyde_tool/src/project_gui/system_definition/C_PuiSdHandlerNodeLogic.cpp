@@ -261,6 +261,8 @@ const C_OscNode * C_PuiSdHandlerNodeLogic::GetOscNodeConst(const uint32_t & oru3
    if (oru32_Index < this->mc_CoreDefinition.c_Nodes.size())
    {
       pc_Retval = &(this->mc_CoreDefinition.c_Nodes[oru32_Index]);
+      //Caller might change the node content
+      pc_Retval->InvalidateErrorCheckCache();
    }
    else
    {
@@ -467,6 +469,7 @@ void C_PuiSdHandlerNodeLogic::SetOscNodeProperties(const uint32_t ou32_NodeIndex
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
       rc_OscNode.c_Properties = orc_Properties;
       //Signal new name!
       Q_EMIT (this->SigNodeChanged(ou32_NodeIndex));
@@ -495,6 +498,7 @@ void C_PuiSdHandlerNodeLogic::SetOscNodePropertiesDetailed(const uint32_t ou32_N
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
 
       //set name (special handling)
       this->mc_CoreDefinition.SetNodeName(ou32_NodeIndex, orc_Name.toStdString().c_str());
@@ -1553,6 +1557,7 @@ int32_t C_PuiSdHandlerNodeLogic::InsertDataPool(const uint32_t & oru32_NodeIndex
    {
       C_PuiSdNode & rc_UiNode = this->mc_UiNodes[oru32_NodeIndex];
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
       //Unique name
       C_OscNodeDataPool c_NodeDataPool = orc_OscContent;
       if (orq_AllowNameAdaptation == true)
@@ -1611,6 +1616,7 @@ int32_t C_PuiSdHandlerNodeLogic::RemoveDataPool(const uint32_t & oru32_NodeIndex
    {
       C_PuiSdNode & rc_UiNode = this->mc_UiNodes[oru32_NodeIndex];
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
       //Check size & consistency
       tgl_assert(rc_UiNode.c_UiDataPools.size() == rc_OscNode.c_DataPools.size());
       if (oru32_DataPoolIndex < rc_UiNode.c_UiDataPools.size())
@@ -1672,6 +1678,7 @@ int32_t C_PuiSdHandlerNodeLogic::SetDataPool(const uint32_t & oru32_NodeIndex, c
    {
       C_PuiSdNode & rc_UiNode = this->mc_UiNodes[oru32_NodeIndex];
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
 
       //Check size & consistency
       tgl_assert(rc_UiNode.c_UiDataPools.size() == rc_OscNode.c_DataPools.size());
@@ -1714,6 +1721,12 @@ int32_t C_PuiSdHandlerNodeLogic::SetDataPool(const uint32_t & oru32_NodeIndex, c
    {
       s32_Retval = C_RANGE;
    }
+
+   if (s32_Retval == C_NO_ERR)
+   {
+      Q_EMIT (this->SigSyncNodeNamesChanged(oru32_NodeIndex));
+   }
+
    return s32_Retval;
 }
 
@@ -1736,6 +1749,7 @@ int32_t C_PuiSdHandlerNodeLogic::UnassignDataPoolApplication(const uint32_t & or
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
+      rc_Node.InvalidateErrorCheckCache();
       if (oru32_DataPoolIndex < rc_Node.c_DataPools.size())
       {
          C_OscNodeDataPool & rc_DataPool = rc_Node.c_DataPools[oru32_DataPoolIndex];
@@ -1775,6 +1789,7 @@ int32_t C_PuiSdHandlerNodeLogic::AssignDataPoolApplication(const uint32_t ou32_N
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_Node.InvalidateErrorCheckCache();
       if (ou32_DataPoolIndex < rc_Node.c_DataPools.size())
       {
          C_OscNodeDataPool & rc_DataPool = rc_Node.c_DataPools[ou32_DataPoolIndex];
@@ -1873,8 +1888,12 @@ int32_t C_PuiSdHandlerNodeLogic::GetDataPool(const uint32_t & oru32_NodeIndex, c
 
    if ((pc_OscDataPool != NULL) && (pc_UiDataPool != NULL))
    {
+      const C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
       orc_UiContent = *pc_UiDataPool;
+      // The values might be accessed by the data dealers of an active communication
+      rc_OscNode.GetValuesLock().Acquire();
       orc_OscContent = *pc_OscDataPool;
+      rc_OscNode.GetValuesLock().Release();
    }
    else
    {
@@ -2462,6 +2481,7 @@ int32_t C_PuiSdHandlerNodeLogic::InsertApplication(const uint32_t ou32_NodeIndex
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_Node.InvalidateErrorCheckCache();
       if (ou32_ApplicationIndex <= rc_Node.c_Applications.size())
       {
          orc_OscContent.c_Name = this->GetUniqueApplicationName(ou32_NodeIndex, orc_OscContent.c_Name);
@@ -2501,6 +2521,7 @@ int32_t C_PuiSdHandlerNodeLogic::RemoveApplication(const uint32_t ou32_NodeIndex
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_Node.InvalidateErrorCheckCache();
       if (ou32_ApplicationIndex < rc_Node.c_Applications.size())
       {
          //Synchronization engine (First!)
@@ -2542,6 +2563,7 @@ int32_t C_PuiSdHandlerNodeLogic::SetApplication(const uint32_t ou32_NodeIndex, c
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_Node.InvalidateErrorCheckCache();
       if (ou32_ApplicationIndex < rc_Node.c_Applications.size())
       {
          const C_OscNodeApplication::E_Type e_PreviousType = rc_Node.c_Applications[ou32_ApplicationIndex].e_Type;
@@ -2577,6 +2599,12 @@ int32_t C_PuiSdHandlerNodeLogic::SetApplication(const uint32_t ou32_NodeIndex, c
    {
       s32_Retval = C_RANGE;
    }
+
+   if (s32_Retval == C_NO_ERR)
+   {
+      Q_EMIT (this->SigSyncNodeNamesChanged(ou32_NodeIndex));
+   }
+
    return s32_Retval;
 }
 
@@ -2627,6 +2655,7 @@ int32_t C_PuiSdHandlerNodeLogic::MoveApplication(const uint32_t ou32_NodeIndex,
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_Node.InvalidateErrorCheckCache();
       if ((ou32_SourceIndex < rc_Node.c_Applications.size()) &&
           (ou32_TargetIndex < rc_Node.c_Applications.size()))
       {
@@ -2929,6 +2958,7 @@ int32_t C_PuiSdHandlerNodeLogic::InsertDataPoolList(const uint32_t & oru32_NodeI
    {
       C_PuiSdNode & rc_UiNode = this->mc_UiNodes[oru32_NodeIndex];
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
 
       //Check size & consistency
       tgl_assert(rc_UiNode.c_UiDataPools.size() == rc_OscNode.c_DataPools.size());
@@ -3033,6 +3063,7 @@ int32_t C_PuiSdHandlerNodeLogic::RemoveDataPoolList(const uint32_t & oru32_NodeI
    {
       C_PuiSdNode & rc_UiNode = this->mc_UiNodes[oru32_NodeIndex];
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
 
       //Check size & consistency
       tgl_assert(rc_UiNode.c_UiDataPools.size() == rc_OscNode.c_DataPools.size());
@@ -3122,6 +3153,7 @@ int32_t C_PuiSdHandlerNodeLogic::SetDataPoolList(const uint32_t & oru32_NodeInde
    {
       C_PuiSdNode & rc_UiNode = this->mc_UiNodes[oru32_NodeIndex];
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
 
       //Check size & consistency
       tgl_assert(rc_UiNode.c_UiDataPools.size() == rc_OscNode.c_DataPools.size());
@@ -3178,6 +3210,11 @@ int32_t C_PuiSdHandlerNodeLogic::SetDataPoolList(const uint32_t & oru32_NodeInde
       s32_Retval = C_RANGE;
    }
 
+   if (s32_Retval == C_NO_ERR)
+   {
+      Q_EMIT (this->SigSyncNodeNamesChanged(oru32_NodeIndex));
+   }
+
    return s32_Retval;
 }
 
@@ -3208,6 +3245,7 @@ int32_t C_PuiSdHandlerNodeLogic::SetDataPoolListName(const uint32_t & oru32_Node
    {
       C_PuiSdNode & rc_UiNode = this->mc_UiNodes[oru32_NodeIndex];
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
 
       //Check size & consistency
       tgl_assert(rc_UiNode.c_UiDataPools.size() == rc_OscNode.c_DataPools.size());
@@ -3263,6 +3301,11 @@ int32_t C_PuiSdHandlerNodeLogic::SetDataPoolListName(const uint32_t & oru32_Node
       s32_Retval = C_RANGE;
    }
 
+   if (s32_Retval == C_NO_ERR)
+   {
+      Q_EMIT (this->SigSyncNodeNamesChanged(oru32_NodeIndex));
+   }
+
    return s32_Retval;
 }
 
@@ -3293,6 +3336,7 @@ int32_t C_PuiSdHandlerNodeLogic::SetDataPoolListComment(const uint32_t & oru32_N
    {
       C_PuiSdNode & rc_UiNode = this->mc_UiNodes[oru32_NodeIndex];
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
 
       //Check size & consistency
       tgl_assert(rc_UiNode.c_UiDataPools.size() == rc_OscNode.c_DataPools.size());
@@ -3378,6 +3422,7 @@ int32_t C_PuiSdHandlerNodeLogic::SetDataPoolListNvmSize(const uint32_t & oru32_N
    {
       C_PuiSdNode & rc_UiNode = this->mc_UiNodes[oru32_NodeIndex];
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
 
       //Check size & consistency
       tgl_assert(rc_UiNode.c_UiDataPools.size() == rc_OscNode.c_DataPools.size());
@@ -3462,6 +3507,7 @@ int32_t C_PuiSdHandlerNodeLogic::SetDataPoolListNvmCrc(const uint32_t & oru32_No
    {
       C_PuiSdNode & rc_UiNode = this->mc_UiNodes[oru32_NodeIndex];
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
 
       //Check size & consistency
       tgl_assert(rc_UiNode.c_UiDataPools.size() == rc_OscNode.c_DataPools.size());
@@ -3541,8 +3587,12 @@ int32_t C_PuiSdHandlerNodeLogic::GetDataPoolList(const uint32_t & oru32_NodeInde
 
    if ((pc_OscList != NULL) && (pc_UiList != NULL))
    {
+      const C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
       orc_UiContent = *pc_UiList;
+      // The values might be accessed by the data dealers of an active communication
+      rc_OscNode.GetValuesLock().Acquire();
       orc_OscContent = *pc_OscList;
+      rc_OscNode.GetValuesLock().Release();
    }
    else
    {
@@ -3673,6 +3723,7 @@ int32_t C_PuiSdHandlerNodeLogic::SetOscNodeDataPoolDataSet(const uint32_t & oru3
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
 
       //Check size
       if (oru32_DataPoolIndex < rc_OscNode.c_DataPools.size())
@@ -3766,6 +3817,7 @@ int32_t C_PuiSdHandlerNodeLogic::InsertDataPoolListDataSet(const uint32_t & oru3
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
 
       //Check size
       if (oru32_DataPoolIndex < rc_OscNode.c_DataPools.size())
@@ -3884,6 +3936,7 @@ int32_t C_PuiSdHandlerNodeLogic::RemoveDataPoolListDataSet(const uint32_t & oru3
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
 
       //Check size
       if (oru32_DataPoolIndex < rc_OscNode.c_DataPools.size())
@@ -3993,6 +4046,7 @@ int32_t C_PuiSdHandlerNodeLogic::MoveDataPoolListDataSet(const uint32_t & oru32_
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
 
       //Check size
       if (oru32_DataPoolIndex < rc_OscNode.c_DataPools.size())
@@ -4176,6 +4230,7 @@ int32_t C_PuiSdHandlerNodeLogic::MoveDataPoolList(const uint32_t & oru32_NodeInd
    {
       C_PuiSdNode & rc_UiNode = this->mc_UiNodes[oru32_NodeIndex];
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
 
       //Check size & consistency
       tgl_assert(rc_UiNode.c_UiDataPools.size() == rc_OscNode.c_DataPools.size());
@@ -4362,6 +4417,7 @@ int32_t C_PuiSdHandlerNodeLogic::ReserveDataPoolListElements(const uint32_t & or
    {
       C_PuiSdNode & rc_UiNode = this->mc_UiNodes[oru32_NodeIndex];
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
 
       //Check size & consistency
       tgl_assert(rc_UiNode.c_UiDataPools.size() == rc_OscNode.c_DataPools.size());
@@ -4462,6 +4518,7 @@ int32_t C_PuiSdHandlerNodeLogic::InsertDataPoolListElement(const uint32_t & oru3
    {
       C_PuiSdNode & rc_UiNode = this->mc_UiNodes[oru32_NodeIndex];
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
 
       //Check size & consistency
       tgl_assert(rc_UiNode.c_UiDataPools.size() == rc_OscNode.c_DataPools.size());
@@ -4582,6 +4639,7 @@ int32_t C_PuiSdHandlerNodeLogic::RemoveDataPoolListElement(const uint32_t & oru3
    {
       C_PuiSdNode & rc_UiNode = this->mc_UiNodes[oru32_NodeIndex];
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
 
       //Check size & consistency
       tgl_assert(rc_UiNode.c_UiDataPools.size() == rc_OscNode.c_DataPools.size());
@@ -4690,6 +4748,7 @@ int32_t C_PuiSdHandlerNodeLogic::SetDataPoolListElement(const uint32_t & oru32_N
    {
       C_PuiSdNode & rc_UiNode = this->mc_UiNodes[oru32_NodeIndex];
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
 
       //Check size & consistency
       tgl_assert(rc_UiNode.c_UiDataPools.size() == rc_OscNode.c_DataPools.size());
@@ -4746,7 +4805,10 @@ int32_t C_PuiSdHandlerNodeLogic::SetDataPoolListElement(const uint32_t & oru32_N
                                                                            c_NewValuesContent.e_Access);
                }
                rc_UiList.c_DataPoolListElements[oru32_DataPoolListElementIndex] = orc_UiContent;
+               // The values might be accessed by the data dealers of an active communication
+               rc_OscNode.GetValuesLock().Acquire();
                rc_OscDataElement = c_NewValuesContent;
+               rc_OscNode.GetValuesLock().Release();
                //Update addresses
                rc_OscDataPool.RecalculateAddress();
 
@@ -4779,6 +4841,11 @@ int32_t C_PuiSdHandlerNodeLogic::SetDataPoolListElement(const uint32_t & oru32_N
       s32_Retval = C_RANGE;
    }
 
+   if (s32_Retval == C_NO_ERR)
+   {
+      Q_EMIT (this->SigSyncNodeNamesChanged(oru32_NodeIndex));
+   }
+
    return s32_Retval;
 }
 
@@ -4816,8 +4883,12 @@ int32_t C_PuiSdHandlerNodeLogic::GetDataPoolListElement(const uint32_t & oru32_N
 
    if ((pc_OscListElement != NULL) && (pc_UiListElement != NULL))
    {
+      const C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
       orc_UiContent = *pc_UiListElement;
+      // The values might be accessed by the data dealers of an active communication
+      rc_OscNode.GetValuesLock().Acquire();
       orc_OscContent = *pc_OscListElement;
+      rc_OscNode.GetValuesLock().Release();
    }
    else
    {
@@ -4929,6 +5000,7 @@ int32_t C_PuiSdHandlerNodeLogic::SetDataPoolListElementMinArray(const uint32_t &
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
 
       //Check size
       if (oru32_DataPoolIndex < rc_OscNode.c_DataPools.size())
@@ -5070,6 +5142,7 @@ int32_t C_PuiSdHandlerNodeLogic::SetDataPoolListElementMaxArray(const uint32_t &
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
 
       //Check size
       if (oru32_DataPoolIndex < rc_OscNode.c_DataPools.size())
@@ -5211,6 +5284,7 @@ int32_t C_PuiSdHandlerNodeLogic::SetDataPoolListElementDataSetArray(const uint32
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
 
       //Check size
       if (oru32_DataPoolIndex < rc_OscNode.c_DataPools.size())
@@ -5359,6 +5433,7 @@ int32_t C_PuiSdHandlerNodeLogic::SetDataPoolListElementNvmValue(const uint32_t &
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
 
       //Check size
       if (oru32_DataPoolIndex < rc_OscNode.c_DataPools.size())
@@ -5374,8 +5449,11 @@ int32_t C_PuiSdHandlerNodeLogic::SetDataPoolListElementNvmValue(const uint32_t &
             if (oru32_DataPoolListElementIndex < rc_OscList.c_Elements.size())
             {
                C_OscNodeDataPoolListElement & rc_Element = rc_OscList.c_Elements[oru32_DataPoolListElementIndex];
+               // The values might be accessed by the data dealers of an active communication
+               rc_OscNode.GetValuesLock().Acquire();
                rc_Element.c_NvmValue = orc_OscContent;
                rc_Element.q_NvmValueChanged = true;
+               rc_OscNode.GetValuesLock().Release();
             }
             else
             {
@@ -5426,6 +5504,7 @@ int32_t C_PuiSdHandlerNodeLogic::SetDataPoolListElementNvmValueChanged(const uin
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
 
       //Check size
       if (oru32_DataPoolIndex < rc_OscNode.c_DataPools.size())
@@ -5441,7 +5520,9 @@ int32_t C_PuiSdHandlerNodeLogic::SetDataPoolListElementNvmValueChanged(const uin
             if (oru32_DataPoolListElementIndex < rc_OscList.c_Elements.size())
             {
                C_OscNodeDataPoolListElement & rc_Element = rc_OscList.c_Elements[oru32_DataPoolListElementIndex];
+               rc_OscNode.GetValuesLock().Acquire();
                rc_Element.q_NvmValueChanged = oq_NvmValueChanged;
+               rc_OscNode.GetValuesLock().Release();
             }
             else
             {
@@ -5466,6 +5547,70 @@ int32_t C_PuiSdHandlerNodeLogic::SetDataPoolListElementNvmValueChanged(const uin
    return s32_Retval;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get data pool list element value
+
+   Safe to use while the data dealers of an active communication write the value.
+
+   \param[in]   oru32_NodeIndex                  Node index
+   \param[in]   oru32_DataPoolIndex              Data pool index
+   \param[in]   oru32_DataPoolListIndex          Data pool list index
+   \param[in]   oru32_DataPoolListElementIndex   Data pool list element index
+   \param[out]  orc_OscContent                   Current value (c_Value)
+
+   \return
+   C_NO_ERR OK
+   C_RANGE  Something out of range
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_PuiSdHandlerNodeLogic::GetDataPoolListElementValue(const uint32_t & oru32_NodeIndex,
+                                                             const uint32_t & oru32_DataPoolIndex,
+                                                             const uint32_t & oru32_DataPoolListIndex,
+                                                             const uint32_t & oru32_DataPoolListElementIndex,
+                                                             C_OscNodeDataPoolContent & orc_OscContent) const
+{
+   int32_t s32_Retval = C_RANGE;
+
+   if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
+   {
+      s32_Retval = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex].GetDataPoolListElementValue(
+         oru32_DataPoolIndex, oru32_DataPoolListIndex, oru32_DataPoolListElementIndex, orc_OscContent);
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get data pool list element NVM value
+
+   Safe to use while the data dealers of an active communication write the value.
+
+   \param[in]   oru32_NodeIndex                  Node index
+   \param[in]   oru32_DataPoolIndex              Data pool index
+   \param[in]   oru32_DataPoolListIndex          Data pool list index
+   \param[in]   oru32_DataPoolListElementIndex   Data pool list element index
+   \param[out]  orc_OscContent                   NVM value (c_NvmValue)
+
+   \return
+   C_NO_ERR OK
+   C_RANGE  Something out of range
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_PuiSdHandlerNodeLogic::GetDataPoolListElementNvmValue(const uint32_t & oru32_NodeIndex,
+                                                                const uint32_t & oru32_DataPoolIndex,
+                                                                const uint32_t & oru32_DataPoolListIndex,
+                                                                const uint32_t & oru32_DataPoolListElementIndex,
+                                                                C_OscNodeDataPoolContent & orc_OscContent) const
+{
+   int32_t s32_Retval = C_RANGE;
+
+   if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
+   {
+      s32_Retval = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex].GetDataPoolListElementNvmValue(
+         oru32_DataPoolIndex, oru32_DataPoolListIndex, oru32_DataPoolListElementIndex, orc_OscContent);
+   }
+   return s32_Retval;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Get OSC data pool list element
 
@@ -5579,6 +5724,7 @@ int32_t C_PuiSdHandlerNodeLogic::MoveDataPoolListElement(const uint32_t & oru32_
    {
       C_PuiSdNode & rc_UiNode = this->mc_UiNodes[oru32_NodeIndex];
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
 
       //Check size & consistency
       tgl_assert(rc_UiNode.c_UiDataPools.size() == rc_OscNode.c_DataPools.size());
@@ -5906,6 +6052,7 @@ void C_PuiSdHandlerNodeLogic::m_SyncNodeApplicationAdded(const uint32_t ou32_Nod
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_Node.InvalidateErrorCheckCache();
       //Data pools
       for (uint32_t u32_ItDataPool = 0; u32_ItDataPool < rc_Node.c_DataPools.size(); ++u32_ItDataPool)
       {
@@ -5953,6 +6100,7 @@ void C_PuiSdHandlerNodeLogic::m_SyncNodeApplicationMoved(const uint32_t ou32_Nod
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_Node.InvalidateErrorCheckCache();
       //Data pools
       for (uint32_t u32_ItDataPool = 0; u32_ItDataPool < rc_Node.c_DataPools.size(); ++u32_ItDataPool)
       {
@@ -6046,6 +6194,7 @@ void C_PuiSdHandlerNodeLogic::m_SyncNodeApplicationAboutToBeDeleted(const uint32
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_Node.InvalidateErrorCheckCache();
       //Data pools
       for (uint32_t u32_ItDataPool = 0; u32_ItDataPool < rc_Node.c_DataPools.size(); ++u32_ItDataPool)
       {
@@ -6147,6 +6296,7 @@ void C_PuiSdHandlerNodeLogic::m_SetUpComDataPool(const uint32_t & oru32_NodeInde
    {
       C_PuiSdNode & rc_UiNode = this->mc_UiNodes[oru32_NodeIndex];
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
       //Check size & consistency
       tgl_assert(rc_UiNode.c_UiDataPools.size() == rc_OscNode.c_DataPools.size());
       if (oru32_DataPoolIndex < rc_OscNode.c_DataPools.size())
@@ -6281,6 +6431,7 @@ void C_PuiSdHandlerNodeLogic::m_CleanUpComDataPool(const uint32_t & oru32_NodeIn
    if (oru32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_Node = this->mc_CoreDefinition.c_Nodes[oru32_NodeIndex];
+      rc_Node.InvalidateErrorCheckCache();
       C_PuiSdNode & rc_UiNode = this->mc_UiNodes[oru32_NodeIndex];
       tgl_assert(rc_Node.c_ComProtocols.size() == rc_UiNode.c_UiCanProtocols.size());
       for (uint32_t u32_ItProtocol = rc_Node.c_ComProtocols.size(); u32_ItProtocol > 0UL; --u32_ItProtocol)
@@ -6576,6 +6727,7 @@ void C_PuiSdHandlerNodeLogic::m_SetOscNodeIds(const uint32_t ou32_NodeIndex, con
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
       for (uint32_t u32_ItInt = 0UL;
            (u32_ItInt < rc_OscNode.c_Properties.c_ComInterfaces.size()) && (u32_ItInt < orc_NodeIds.size());
            ++u32_ItInt)
@@ -6600,6 +6752,7 @@ void C_PuiSdHandlerNodeLogic::m_SetOscNodeId(const uint32_t ou32_NodeIndex, cons
    if (ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size())
    {
       C_OscNode & rc_OscNode = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+      rc_OscNode.InvalidateErrorCheckCache();
       tgl_assert(ou32_InterfaceIndex < rc_OscNode.c_Properties.c_ComInterfaces.size());
       if (ou32_InterfaceIndex < rc_OscNode.c_Properties.c_ComInterfaces.size())
       {
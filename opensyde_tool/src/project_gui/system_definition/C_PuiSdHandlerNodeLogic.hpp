@@ -305,6 +305,14 @@ public:
                                                  const uint32_t & oru32_DataPoolListIndex,
                                                  const uint32_t & oru32_DataPoolListElementIndex,
                                                  const bool oq_NvmValueChanged);
+   int32_t GetDataPoolListElementValue(const uint32_t & oru32_NodeIndex, const uint32_t & oru32_DataPoolIndex,
+                                       const uint32_t & oru32_DataPoolListIndex,
+                                       const uint32_t & oru32_DataPoolListElementIndex,
+                                       stw::opensyde_core::C_OscNodeDataPoolContent & orc_OscContent) const;
+   int32_t GetDataPoolListElementNvmValue(const uint32_t & oru32_NodeIndex, const uint32_t & oru32_DataPoolIndex,
+                                          const uint32_t & oru32_DataPoolListIndex,
+                                          const uint32_t & oru32_DataPoolListElementIndex,
+                                          stw::opensyde_core::C_OscNodeDataPoolContent & orc_OscContent) const;
    const stw::opensyde_core::C_OscNodeDataPoolListElement * GetOscDataPoolListElement(const uint32_t & oru32_NodeIndex,
                                                                                       const uint32_t & oru32_DataPoolIndex, const uint32_t & oru32_DataPoolListIndex, const uint32_t & oru32_DataPoolListElementIndex)
    const;
@@ -34,6 +34,7 @@
 #include "C_OscUtils.hpp"
 #include "constants.hpp"
 #include "C_PuiSdNodeCanUtil.hpp"
+#include "C_OscSystemNameMultiset.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 using namespace stw::errors;
@@ -1258,9 +1259,25 @@ void C_PuiSdNodeCanMessageSyncManager::CheckErrorBus(bool * const opq_MessageNam
 
    if ((opq_MessageNameInvalid != NULL) || (opq_MessageIdInvalid != NULL))
    {
+      //Names of all unique messages of all protocols (same scope as CheckMessageNameBus), counted once for all checks
+      std::vector<const C_OscCanMessage *> c_AllMessages;
+      C_OscSystemNameMultiset c_AllMessageNames(true);
       if (opq_MessageNameInvalid != NULL)
       {
+         const std::vector<C_OscCanMessageIdentificationIndices> c_AllUniqueMessageIds =
+            this->m_GetAllUniqueMessages();
          *opq_MessageNameInvalid = false;
+         c_AllMessages.reserve(c_AllUniqueMessageIds.size());
+         for (uint32_t u32_ItMessage = 0UL; u32_ItMessage < c_AllUniqueMessageIds.size(); ++u32_ItMessage)
+         {
+            const C_OscCanMessage * const pc_Message =
+               C_PuiSdHandler::h_GetInstance()->GetCanMessage(c_AllUniqueMessageIds[u32_ItMessage]);
+            c_AllMessages.push_back(pc_Message);
+            if (pc_Message != NULL)
+            {
+               c_AllMessageNames.Add(pc_Message->c_Name);
+            }
+         }
       }
       if (opq_MessageIdInvalid != NULL)
       {
@@ -1275,13 +1292,30 @@ void C_PuiSdNodeCanMessageSyncManager::CheckErrorBus(bool * const opq_MessageNam
          {
             if (opq_MessageNameInvalid != NULL)
             {
-               bool q_MessageNameValid;
-               this->CheckMessageNameBus(pc_Message->c_Name, q_MessageNameValid,
-                                         &c_UniqueMessageIds[u32_ItUniqueMessageId]);
-               if (q_MessageNameValid == false)
+               if (C_OscUtils::h_CheckValidCeName(pc_Message->c_Name) == false)
                {
                   *opq_MessageNameInvalid = true;
                }
+               else
+               {
+                  uint32_t u32_Count = c_AllMessageNames.GetCount(pc_Message->c_Name);
+                  //Skip the message itself (unique messages of this protocol are usually one per match group)
+                  uint32_t u32_SkipIndex = u32_ItUniqueMessageId;
+                  if (c_UniqueMessageIds.size() != this->mc_MessageMatches.size())
+                  {
+                     u32_SkipIndex =
+                        this->m_GetMatchingMessageVectorIndex(c_UniqueMessageIds[u32_ItUniqueMessageId]);
+                  }
+                  if (((u32_SkipIndex < c_AllMessages.size()) && (c_AllMessages[u32_SkipIndex] != NULL)) &&
+                      ((c_AllMessages[u32_SkipIndex]->c_Name == pc_Message->c_Name) && (u32_Count > 0UL)))
+                  {
+                     --u32_Count;
+                  }
+                  if (u32_Count > 0UL)
+                  {
+                     *opq_MessageNameInvalid = true;
+                  }
+               }
             }
             if (opq_MessageIdInvalid != NULL)
             {
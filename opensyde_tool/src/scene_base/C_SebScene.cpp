@@ -72,7 +72,9 @@ C_SebScene::C_SebScene(QObject * const opc_Parent) :
    mq_LeftButtonPressed(false),
    mq_DrawCustomBackground(true),
    mq_DarkModeActive(false),
-   mc_LastKnownMouseScenePosition(0.0, 0.0)
+   mc_LastKnownMouseScenePosition(0.0, 0.0),
+   mf64_HighestUsedZetValue(0.0),
+   mq_HighestUsedZetValueValid(false)
 {
    connect(this, &QGraphicsScene::changed, this, &C_SebScene::m_AdaptSceneRect);
 
@@ -157,6 +159,46 @@ float64_t C_SebScene::GetHighestUsedZetValueList(const QList<QGraphicsItem *> &
    return f64_Retval;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get highest used Z value of all scene items without scanning the scene
+
+   The value is maintained on each item add and Z order change. Only the first call after a clear scans all items.
+   Items which were removed or sent to back are not considered, so the result is an upper bound,
+   which is sufficient to place new items on top.
+
+   \return
+   Highest used Z value of all scene items
+*/
+//----------------------------------------------------------------------------------------------------------------------
+float64_t C_SebScene::GetHighestUsedZetValue(void) const
+{
+   if (this->mq_HighestUsedZetValueValid == false)
+   {
+      this->mf64_HighestUsedZetValue = this->GetHighestUsedZetValueList(this->items());
+      this->mq_HighestUsedZetValueValid = true;
+   }
+   return this->mf64_HighestUsedZetValue;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Register the current Z value of an item for the highest used Z value
+
+   Call after each Z value change which is not covered by adding the item to the scene.
+
+   \param[in]  opc_Item   Item with new Z value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SebScene::RegisterZetValue(const QGraphicsItem * const opc_Item)
+{
+   if ((this->mq_HighestUsedZetValueValid == true) && (opc_Item != NULL))
+   {
+      if ((this->IsZetOrderChangeable(opc_Item) == true) && (opc_Item->zValue() > this->mf64_HighestUsedZetValue))
+      {
+         this->mf64_HighestUsedZetValue = opc_Item->zValue();
+      }
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Sets the drawing of the background active
 
@@ -997,10 +1039,25 @@ void C_SebScene::m_AddAnyItemToScene(QGraphicsItem * const opc_Item)
 {
    this->addItem(opc_Item);
    m_SetItemSelectionAndMoveAvailability(opc_Item);
+   this->m_RegisterItem(opc_Item);
    //Trigger update of all existing (and new!) interaction points
    Q_EMIT this->SigTriggerUpdateTransform();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Register new item in scene bookkeeping
+
+   Default: only register the Z value of the item.
+   Derived scenes may keep their own item registries in addition.
+
+   \param[in]  opc_Item   New item
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SebScene::m_RegisterItem(QGraphicsItem * const opc_Item)
+{
+   this->RegisterZetValue(opc_Item);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Set initial state of actions select and move
 
@@ -1375,6 +1432,7 @@ void C_SebScene::m_Clear(void)
    {
       this->m_GetUndoManager()->DoDelete(this->items());
    }
+   this->mq_HighestUsedZetValueValid = false;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
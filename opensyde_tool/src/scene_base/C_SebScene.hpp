@@ -53,6 +53,8 @@ public:
 
    void FilterChangableZetValues(QList<QGraphicsItem *> & orc_ZetValues) const;
    float64_t GetHighestUsedZetValueList(const QList<QGraphicsItem *> & orc_Items) const;
+   float64_t GetHighestUsedZetValue(void) const;
+   void RegisterZetValue(const QGraphicsItem * const opc_Item);
 
    void SetDrawingBackground(const bool oq_Active);
    QRectF GetMinimumSceneRect(void) const;
@@ -122,6 +124,7 @@ protected:
    virtual void m_AddRectBaseGroupToScene(C_GiBiRectBaseGroup * const opc_Item);
    virtual void m_AddLineGroupToScene(C_GiLiLineGroup * const opc_Item);
    void m_AddAnyItemToScene(QGraphicsItem * const opc_Item);
+   virtual void m_RegisterItem(QGraphicsItem * const opc_Item);
    void m_SetItemSelectionAndMoveAvailability(QGraphicsItem * const opc_Item) const;
 
    //Move
@@ -235,6 +238,8 @@ private:
    bool mq_DrawCustomBackground;
    bool mq_DarkModeActive;
    QPointF mc_LastKnownMouseScenePosition;
+   mutable float64_t mf64_HighestUsedZetValue; ///< Upper bound of all used Z values, only valid if flag is set
+   mutable bool mq_HighestUsedZetValueValid;
 
    QTimer mc_ToolTipTimer;
 
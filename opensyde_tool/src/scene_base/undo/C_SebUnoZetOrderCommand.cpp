@@ -130,6 +130,7 @@ void C_SebUnoZetOrderCommand::h_AdaptZetOrder(const QGraphicsScene * const opc_S
 void C_SebUnoZetOrderCommand::m_ApplyZetValues(const std::vector<float64_t> & orc_Values) const
 {
    const vector<QGraphicsItem *> c_AffectedItems = this->m_GetSceneItems();
+   C_SebScene * const pc_Scene = dynamic_cast<C_SebScene * const>(this->mpc_Scene);
 
    if (c_AffectedItems.size() == orc_Values.size())
    {
@@ -144,6 +145,10 @@ void C_SebUnoZetOrderCommand::m_ApplyZetValues(const std::vector<float64_t> & or
          {
             c_AffectedItems[u32_ItAffectedItem]->setZValue(orc_Values[u32_ItAffectedItem]);
          }
+         if (pc_Scene != NULL)
+         {
+            pc_Scene->RegisterZetValue(c_AffectedItems[u32_ItAffectedItem]);
+         }
       }
    }
 }
@@ -22,6 +22,7 @@
 #include "C_PuiSdHandlerFiler.hpp"
 #include "C_PuiBsElementsFiler.hpp"
 #include "C_OscNodeDataPoolFiler.hpp"
+#include "C_OscNodeDataPoolBinaryFiler.hpp"
 #include "C_OscNodeFiler.hpp"
 #include "TglUtils.hpp"
 #include "C_OscNodeCommFiler.hpp"
@@ -36,6 +37,10 @@ using namespace stw::errors;
 using namespace stw::tgl;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const QString C_SdClipBoardHelper::mhc_MIME_TYPE_DATA_POOL = "application/x-opensyde-datapool-v1";
+const QString C_SdClipBoardHelper::mhc_MIME_TYPE_LISTS = "application/x-opensyde-datapool-lists-v1";
+const QString C_SdClipBoardHelper::mhc_MIME_TYPE_LIST_ELEMENTS = "application/x-opensyde-datapool-list-elements-v1";
+const QString C_SdClipBoardHelper::mhc_MIME_TYPE_DATA_SETS = "application/x-opensyde-datapool-list-datasets-v1";
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
@@ -57,31 +62,19 @@ using namespace stw::tgl;
 void C_SdClipBoardHelper::h_StoreDataPool(const C_OscNodeDataPool & orc_OscContent,
                                           const C_PuiSdNodeDataPool & orc_UiContent)
 {
-   stw::scl::C_SclString c_XmlContent;
-   C_OscXmlParser c_StringXml;
-
-   c_StringXml.CreateAndSelectNodeChild("clip-board");
-   c_StringXml.CreateAndSelectNodeChild("gui");
-   c_StringXml.CreateAndSelectNodeChild("data-pool");
-
-   C_PuiSdHandlerFiler::h_SaveDataPool(orc_UiContent, c_StringXml);
-
-   //Return
-   tgl_assert(c_StringXml.SelectNodeParent() == "gui");
-   //Return
-   tgl_assert(c_StringXml.SelectNodeParent() == "clip-board");
-   c_StringXml.CreateAndSelectNodeChild("core");
-   c_StringXml.CreateAndSelectNodeChild("data-pool");
-
-   C_OscNodeDataPoolFiler::h_SaveDataPool(orc_OscContent, c_StringXml);
+   std::vector<uint8_t> c_Buffer;
 
-   c_StringXml.SaveToString(c_XmlContent);
-   mh_SetClipBoard(c_XmlContent.c_str());
+   C_OscNodeDataPoolBinaryFiler::h_SaveHeader(C_OscNodeDataPoolBinaryFiler::eDATA_POOL, c_Buffer);
+   C_OscNodeDataPoolBinaryFiler::h_SaveDataPool(orc_OscContent, c_Buffer);
+   mh_SaveUiDataPoolLists(orc_UiContent.c_DataPoolLists, c_Buffer);
+   mh_SetClipBoardData(mhc_MIME_TYPE_DATA_POOL, mh_ToByteArray(c_Buffer), &C_SdClipBoardHelper::mh_DataPoolToText);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Load node data pool from clip board
 
+   Uses the binary clipboard format if available, the XML text otherwise.
+
    \param[out]  orc_OscContent   OSC content
    \param[out]  orc_UiContent    UI content
 
@@ -92,56 +85,17 @@ void C_SdClipBoardHelper::h_StoreDataPool(const C_OscNodeDataPool & orc_OscConte
 //----------------------------------------------------------------------------------------------------------------------
 int32_t C_SdClipBoardHelper::h_LoadToDataPool(C_OscNodeDataPool & orc_OscContent, C_PuiSdNodeDataPool & orc_UiContent)
 {
-   int32_t s32_Retval = C_NO_ERR;
-   C_OscXmlParser c_StringXml;
-
-   c_StringXml.LoadFromString(mh_GetClipBoard().toStdString().c_str());
+   int32_t s32_Retval;
+   QByteArray c_Data;
 
-   if (c_StringXml.SelectRoot() == "clip-board")
+   if (mh_GetClipBoardData(mhc_MIME_TYPE_DATA_POOL, c_Data) == true)
    {
-      if (c_StringXml.SelectNodeChild("gui") == "gui")
-      {
-         if (c_StringXml.SelectNodeChild("data-pool") == "data-pool")
-         {
-            s32_Retval = C_PuiSdHandlerFiler::h_LoadDataPool(orc_UiContent, c_StringXml);
-            if (s32_Retval == C_NO_ERR)
-            {
-               //Return
-               tgl_assert(c_StringXml.SelectNodeParent() == "gui");
-               //Return
-               tgl_assert(c_StringXml.SelectNodeParent() == "clip-board");
-               if (c_StringXml.SelectNodeChild("core") == "core")
-               {
-                  if (c_StringXml.SelectNodeChild("data-pool") == "data-pool")
-                  {
-                     s32_Retval = C_OscNodeDataPoolFiler::h_LoadDataPool(orc_OscContent, c_StringXml);
-                  }
-                  else
-                  {
-                     s32_Retval = C_CONFIG;
-                  }
-               }
-               else
-               {
-                  s32_Retval = C_CONFIG;
-               }
-            }
-         }
-         else
-         {
-            s32_Retval = C_CONFIG;
-         }
-      }
-      else
-      {
-         s32_Retval = C_CONFIG;
-      }
+      s32_Retval = mh_LoadDataPoolFromBinary(orc_OscContent, orc_UiContent, c_Data);
    }
    else
    {
-      s32_Retval = C_CONFIG;
+      s32_Retval = mh_LoadDataPoolFromString(orc_OscContent, orc_UiContent, mh_GetClipBoard());
    }
-
    return s32_Retval;
 }
 
@@ -157,37 +111,19 @@ void C_SdClipBoardHelper::h_StoreDataPoolLists(const std::vector<C_OscNodeDataPo
                                                const std::vector<C_PuiSdNodeDataPoolList> & orc_UiContent,
                                                const C_OscNodeDataPool::E_Type & ore_Type)
 {
-   stw::scl::C_SclString c_XmlContent;
-   C_OscXmlParser c_StringXml;
-
-   c_StringXml.CreateAndSelectNodeChild("clip-board");
-   c_StringXml.CreateAndSelectNodeChild("gui");
-   c_StringXml.CreateAndSelectNodeChild("type");
-
-   c_StringXml.SetNodeContent(C_OscNodeDataPoolFiler::h_DataPoolToString(ore_Type));
-
-   //Return
-   tgl_assert(c_StringXml.SelectNodeParent() == "gui");
-   c_StringXml.CreateAndSelectNodeChild("lists");
-
-   C_PuiSdHandlerFiler::h_SaveDataPoolLists(orc_UiContent, c_StringXml);
-
-   //Return
-   tgl_assert(c_StringXml.SelectNodeParent() == "gui");
-   //Return
-   tgl_assert(c_StringXml.SelectNodeParent() == "clip-board");
-   c_StringXml.CreateAndSelectNodeChild("core");
-   c_StringXml.CreateAndSelectNodeChild("lists");
+   std::vector<uint8_t> c_Buffer;
 
-   C_OscNodeDataPoolFiler::h_SaveDataPoolLists(orc_OscContent, c_StringXml, ore_Type);
-
-   c_StringXml.SaveToString(c_XmlContent);
-   mh_SetClipBoard(c_XmlContent.c_str());
+   C_OscNodeDataPoolBinaryFiler::h_SaveHeader(C_OscNodeDataPoolBinaryFiler::eLISTS, c_Buffer);
+   C_OscNodeDataPoolBinaryFiler::h_SaveDataPoolLists(orc_OscContent, ore_Type, c_Buffer);
+   mh_SaveUiDataPoolLists(orc_UiContent, c_Buffer);
+   mh_SetClipBoardData(mhc_MIME_TYPE_LISTS, mh_ToByteArray(c_Buffer), &C_SdClipBoardHelper::mh_DataPoolListsToText);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Load node data pool lists from clip board
 
+   Uses the binary clipboard format if available, the XML text otherwise.
+
    \param[out]  orc_OscContent   OSC content
    \param[out]  orc_UiContent    UI content
    \param[out]  ore_Type         Data pool type
@@ -201,69 +137,17 @@ int32_t C_SdClipBoardHelper::h_LoadToDataPoolLists(std::vector<C_OscNodeDataPool
                                                    std::vector<C_PuiSdNodeDataPoolList> & orc_UiContent,
                                                    C_OscNodeDataPool::E_Type & ore_Type)
 {
-   int32_t s32_Retval = C_NO_ERR;
-   C_OscXmlParser c_StringXml;
-
-   c_StringXml.LoadFromString(mh_GetClipBoard().toStdString().c_str());
+   int32_t s32_Retval;
+   QByteArray c_Data;
 
-   if (c_StringXml.SelectRoot() == "clip-board")
+   if (mh_GetClipBoardData(mhc_MIME_TYPE_LISTS, c_Data) == true)
    {
-      if (c_StringXml.SelectNodeChild("gui") == "gui")
-      {
-         if (c_StringXml.SelectNodeChild("type") == "type")
-         {
-            s32_Retval = C_OscNodeDataPoolFiler::h_StringToDataPool(c_StringXml.GetNodeContent(), ore_Type);
-            if (s32_Retval == C_NO_ERR)
-            {
-               //Return
-               tgl_assert(c_StringXml.SelectNodeParent() == "gui");
-               if (c_StringXml.SelectNodeChild("lists") == "lists")
-               {
-                  s32_Retval = C_PuiSdHandlerFiler::h_LoadDataPoolLists(orc_UiContent, c_StringXml);
-                  if (s32_Retval == C_NO_ERR)
-                  {
-                     //Return
-                     tgl_assert(c_StringXml.SelectNodeParent() == "gui");
-                     //Return
-                     tgl_assert(c_StringXml.SelectNodeParent() == "clip-board");
-                     if (c_StringXml.SelectNodeChild("core") == "core")
-                     {
-                        if (c_StringXml.SelectNodeChild("lists") == "lists")
-                        {
-                           s32_Retval = C_OscNodeDataPoolFiler::h_LoadDataPoolLists(orc_OscContent, c_StringXml);
-                        }
-                        else
-                        {
-                           s32_Retval = C_CONFIG;
-                        }
-                     }
-                     else
-                     {
-                        s32_Retval = C_CONFIG;
-                     }
-                  }
-               }
-               else
-               {
-                  s32_Retval = C_CONFIG;
-               }
-            }
-         }
-         else
-         {
-            s32_Retval = C_CONFIG;
-         }
-      }
-      else
-      {
-         s32_Retval = C_CONFIG;
-      }
+      s32_Retval = mh_LoadDataPoolListsFromBinary(orc_OscContent, orc_UiContent, ore_Type, c_Data);
    }
    else
    {
-      s32_Retval = C_CONFIG;
+      s32_Retval = mh_LoadDataPoolListsFromString(orc_OscContent, orc_UiContent, ore_Type, mh_GetClipBoard());
    }
-
    return s32_Retval;
 }
 
@@ -279,15 +163,20 @@ void C_SdClipBoardHelper::h_StoreDataPoolListElementsToClipBoard(
    const std::vector<C_OscNodeDataPoolListElement> & orc_OscContent,
    const std::vector<C_PuiSdNodeDataPoolListElement> & orc_UiContent, const C_OscNodeDataPool::E_Type oe_DatapoolType)
 {
-   QString c_Tmp;
+   std::vector<uint8_t> c_Buffer;
 
-   h_StoreDataPoolListElementsToString(orc_OscContent, orc_UiContent, oe_DatapoolType, c_Tmp);
-   mh_SetClipBoard(c_Tmp);
+   C_OscNodeDataPoolBinaryFiler::h_SaveHeader(C_OscNodeDataPoolBinaryFiler::eLIST_ELEMENTS, c_Buffer);
+   C_OscNodeDataPoolBinaryFiler::h_SaveDataPoolListElements(orc_OscContent, oe_DatapoolType, c_Buffer);
+   mh_SaveUiDataPoolListElements(orc_UiContent, c_Buffer);
+   mh_SetClipBoardData(mhc_MIME_TYPE_LIST_ELEMENTS, mh_ToByteArray(c_Buffer),
+                       &C_SdClipBoardHelper::mh_DataPoolListElementsToText);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Load node data pool list elements from clip board
 
+   Uses the binary clipboard format if available, the XML text otherwise.
+
    \param[in]  orc_OscContent    OSC content
    \param[in]  orc_UiContent     UI content
 
@@ -300,7 +189,19 @@ int32_t C_SdClipBoardHelper::h_LoadToDataPoolListElementsFromClipBoard(
    std::vector<C_OscNodeDataPoolListElement> & orc_OscContent,
    std::vector<C_PuiSdNodeDataPoolListElement> & orc_UiContent)
 {
-   return h_LoadToDataPoolListElementsFromString(orc_OscContent, orc_UiContent, mh_GetClipBoard());
+   int32_t s32_Retval;
+   QByteArray c_Data;
+
+   if (mh_GetClipBoardData(mhc_MIME_TYPE_LIST_ELEMENTS, c_Data) == true)
+   {
+      C_OscNodeDataPool::E_Type e_Type = C_OscNodeDataPool::eDIAG;
+      s32_Retval = mh_LoadDataPoolListElementsFromBinary(orc_OscContent, orc_UiContent, e_Type, c_Data);
+   }
+   else
+   {
+      s32_Retval = h_LoadToDataPoolListElementsFromString(orc_OscContent, orc_UiContent, mh_GetClipBoard());
+   }
+   return s32_Retval;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -487,15 +388,19 @@ void C_SdClipBoardHelper::h_StoreDataPoolListDataSetsToClipBoard(
    const std::vector<C_OscNodeDataPoolDataSet> & orc_OscNames,
    const std::vector<std::vector<C_OscNodeDataPoolContent> > & orc_OscDataSetValues)
 {
-   QString c_Tmp;
+   std::vector<uint8_t> c_Buffer;
 
-   h_StoreDataPoolListDataSetsToString(orc_OscNames, orc_OscDataSetValues, c_Tmp);
-   mh_SetClipBoard(c_Tmp);
+   C_OscNodeDataPoolBinaryFiler::h_SaveHeader(C_OscNodeDataPoolBinaryFiler::eDATA_SETS, c_Buffer);
+   C_OscNodeDataPoolBinaryFiler::h_SaveDataPoolListDataSets(orc_OscNames, orc_OscDataSetValues, c_Buffer);
+   mh_SetClipBoardData(mhc_MIME_TYPE_DATA_SETS, mh_ToByteArray(c_Buffer),
+                       &C_SdClipBoardHelper::mh_DataPoolListDataSetsToText);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Load data sets from clipboard
 
+   Uses the binary clipboard format if available, the XML text otherwise.
+
    \param[out]  orc_OscNames           Data set names
    \param[out]  orc_OscDataSetValues   Data set values
 
@@ -508,7 +413,18 @@ int32_t C_SdClipBoardHelper::h_LoadToDataPoolListDataSetsFromClipBoard(
    std::vector<C_OscNodeDataPoolDataSet> & orc_OscNames,
    std::vector<std::vector<C_OscNodeDataPoolContent> > & orc_OscDataSetValues)
 {
-   return h_LoadToDataPoolListDataSetsFromString(orc_OscNames, orc_OscDataSetValues, mh_GetClipBoard());
+   int32_t s32_Retval;
+   QByteArray c_Data;
+
+   if (mh_GetClipBoardData(mhc_MIME_TYPE_DATA_SETS, c_Data) == true)
+   {
+      s32_Retval = mh_LoadDataPoolListDataSetsFromBinary(orc_OscNames, orc_OscDataSetValues, c_Data);
+   }
+   else
+   {
+      s32_Retval = h_LoadToDataPoolListDataSetsFromString(orc_OscNames, orc_OscDataSetValues, mh_GetClipBoard());
+   }
+   return s32_Retval;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -1458,3 +1374,591 @@ int32_t C_SdClipBoardHelper::mh_LoadSignalsFromString(const QString & orc_Input,
 
    return s32_Retval;
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Store node data pool to string
+
+   \param[in]   orc_OscContent   OSC content
+   \param[in]   orc_UiContent    UI content
+   \param[out]  orc_Output       String output
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdClipBoardHelper::mh_StoreDataPoolToString(const C_OscNodeDataPool & orc_OscContent,
+                                                   const C_PuiSdNodeDataPool & orc_UiContent, QString & orc_Output)
+{
+   stw::scl::C_SclString c_XmlContent;
+   C_OscXmlParser c_StringXml;
+
+   c_StringXml.CreateAndSelectNodeChild("clip-board");
+   c_StringXml.CreateAndSelectNodeChild("gui");
+   c_StringXml.CreateAndSelectNodeChild("data-pool");
+
+   C_PuiSdHandlerFiler::h_SaveDataPool(orc_UiContent, c_StringXml);
+
+   //Return
+   tgl_assert(c_StringXml.SelectNodeParent() == "gui");
+   //Return
+   tgl_assert(c_StringXml.SelectNodeParent() == "clip-board");
+   c_StringXml.CreateAndSelectNodeChild("core");
+   c_StringXml.CreateAndSelectNodeChild("data-pool");
+
+   C_OscNodeDataPoolFiler::h_SaveDataPool(orc_OscContent, c_StringXml);
+
+   c_StringXml.SaveToString(c_XmlContent);
+   orc_Output = c_XmlContent.c_str();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Load node data pool from string
+
+   \param[out]  orc_OscContent   OSC content
+   \param[out]  orc_UiContent    UI content
+   \param[in]   orc_Input        String input
+
+   \return
+   C_NO_ERR Found and loaded
+   C_CONFIG String invalid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SdClipBoardHelper::mh_LoadDataPoolFromString(C_OscNodeDataPool & orc_OscContent,
+                                                       C_PuiSdNodeDataPool & orc_UiContent, const QString & orc_Input)
+{
+   int32_t s32_Retval = C_NO_ERR;
+   C_OscXmlParser c_StringXml;
+
+   c_StringXml.LoadFromString(orc_Input.toStdString().c_str());
+
+   if (c_StringXml.SelectRoot() == "clip-board")
+   {
+      if (c_StringXml.SelectNodeChild("gui") == "gui")
+      {
+         if (c_StringXml.SelectNodeChild("data-pool") == "data-pool")
+         {
+            s32_Retval = C_PuiSdHandlerFiler::h_LoadDataPool(orc_UiContent, c_StringXml);
+            if (s32_Retval == C_NO_ERR)
+            {
+               //Return
+               tgl_assert(c_StringXml.SelectNodeParent() == "gui");
+               //Return
+               tgl_assert(c_StringXml.SelectNodeParent() == "clip-board");
+               if (c_StringXml.SelectNodeChild("core") == "core")
+               {
+                  if (c_StringXml.SelectNodeChild("data-pool") == "data-pool")
+                  {
+                     s32_Retval = C_OscNodeDataPoolFiler::h_LoadDataPool(orc_OscContent, c_StringXml);
+                  }
+                  else
+                  {
+                     s32_Retval = C_CONFIG;
+                  }
+               }
+               else
+               {
+                  s32_Retval = C_CONFIG;
+               }
+            }
+         }
+         else
+         {
+            s32_Retval = C_CONFIG;
+         }
+      }
+      else
+      {
+         s32_Retval = C_CONFIG;
+      }
+   }
+   else
+   {
+      s32_Retval = C_CONFIG;
+   }
+
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Store node data pool lists to string
+
+   \param[in]   orc_OscContent   OSC content
+   \param[in]   orc_UiContent    UI content
+   \param[in]   ore_Type         Data pool type
+   \param[out]  orc_Output       String output
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdClipBoardHelper::mh_StoreDataPoolListsToString(const std::vector<C_OscNodeDataPoolList> & orc_OscContent,
+                                                        const std::vector<C_PuiSdNodeDataPoolList> & orc_UiContent,
+                                                        const C_OscNodeDataPool::E_Type & ore_Type,
+                                                        QString & orc_Output)
+{
+   stw::scl::C_SclString c_XmlContent;
+   C_OscXmlParser c_StringXml;
+
+   c_StringXml.CreateAndSelectNodeChild("clip-board");
+   c_StringXml.CreateAndSelectNodeChild("gui");
+   c_StringXml.CreateAndSelectNodeChild("type");
+
+   c_StringXml.SetNodeContent(C_OscNodeDataPoolFiler::h_DataPoolToString(ore_Type));
+
+   //Return
+   tgl_assert(c_StringXml.SelectNodeParent() == "gui");
+   c_StringXml.CreateAndSelectNodeChild("lists");
+
+   C_PuiSdHandlerFiler::h_SaveDataPoolLists(orc_UiContent, c_StringXml);
+
+   //Return
+   tgl_assert(c_StringXml.SelectNodeParent() == "gui");
+   //Return
+   tgl_assert(c_StringXml.SelectNodeParent() == "clip-board");
+   c_StringXml.CreateAndSelectNodeChild("core");
+   c_StringXml.CreateAndSelectNodeChild("lists");
+
+   C_OscNodeDataPoolFiler::h_SaveDataPoolLists(orc_OscContent, c_StringXml, ore_Type);
+
+   c_StringXml.SaveToString(c_XmlContent);
+   orc_Output = c_XmlContent.c_str();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Load node data pool lists from string
+
+   \param[out]  orc_OscContent   OSC content
+   \param[out]  orc_UiContent    UI content
+   \param[out]  ore_Type         Data pool type
+   \param[in]   orc_Input        String input
+
+   \return
+   C_NO_ERR Found and loaded
+   C_CONFIG String invalid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SdClipBoardHelper::mh_LoadDataPoolListsFromString(std::vector<C_OscNodeDataPoolList> & orc_OscContent,
+                                                            std::vector<C_PuiSdNodeDataPoolList> & orc_UiContent,
+                                                            C_OscNodeDataPool::E_Type & ore_Type,
+                                                            const QString & orc_Input)
+{
+   int32_t s32_Retval = C_NO_ERR;
+   C_OscXmlParser c_StringXml;
+
+   c_StringXml.LoadFromString(orc_Input.toStdString().c_str());
+
+   if (c_StringXml.SelectRoot() == "clip-board")
+   {
+      if (c_StringXml.SelectNodeChild("gui") == "gui")
+      {
+         if (c_StringXml.SelectNodeChild("type") == "type")
+         {
+            s32_Retval = C_OscNodeDataPoolFiler::h_StringToDataPool(c_StringXml.GetNodeContent(), ore_Type);
+            if (s32_Retval == C_NO_ERR)
+            {
+               //Return
+               tgl_assert(c_StringXml.SelectNodeParent() == "gui");
+               if (c_StringXml.SelectNodeChild("lists") == "lists")
+               {
+                  s32_Retval = C_PuiSdHandlerFiler::h_LoadDataPoolLists(orc_UiContent, c_StringXml);
+                  if (s32_Retval == C_NO_ERR)
+                  {
+                     //Return
+                     tgl_assert(c_StringXml.SelectNodeParent() == "gui");
+                     //Return
+                     tgl_assert(c_StringXml.SelectNodeParent() == "clip-board");
+                     if (c_StringXml.SelectNodeChild("core") == "core")
+                     {
+                        if (c_StringXml.SelectNodeChild("lists") == "lists")
+                        {
+                           s32_Retval = C_OscNodeDataPoolFiler::h_LoadDataPoolLists(orc_OscContent, c_StringXml);
+                        }
+                        else
+                        {
+                           s32_Retval = C_CONFIG;
+                        }
+                     }
+                     else
+                     {
+                        s32_Retval = C_CONFIG;
+                     }
+                  }
+               }
+               else
+               {
+                  s32_Retval = C_CONFIG;
+               }
+            }
+         }
+         else
+         {
+            s32_Retval = C_CONFIG;
+         }
+      }
+      else
+      {
+         s32_Retval = C_CONFIG;
+      }
+   }
+   else
+   {
+      s32_Retval = C_CONFIG;
+   }
+
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Load node data pool from binary clipboard content
+
+   \param[out]  orc_OscContent   OSC content
+   \param[out]  orc_UiContent    UI content
+   \param[in]   orc_Data         Binary clipboard content
+
+   \return
+   C_NO_ERR Found and loaded
+   C_CONFIG Content invalid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SdClipBoardHelper::mh_LoadDataPoolFromBinary(C_OscNodeDataPool & orc_OscContent,
+                                                       C_PuiSdNodeDataPool & orc_UiContent, const QByteArray & orc_Data)
+{
+   const std::vector<uint8_t> c_Buffer = mh_ToVector(orc_Data);
+   uint32_t u32_Position = 0UL;
+   int32_t s32_Retval = C_OscNodeDataPoolBinaryFiler::h_LoadHeader(C_OscNodeDataPoolBinaryFiler::eDATA_POOL,
+                                                                    c_Buffer, u32_Position);
+
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = C_OscNodeDataPoolBinaryFiler::h_LoadDataPool(orc_OscContent, c_Buffer, u32_Position);
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = mh_LoadUiDataPoolLists(orc_UiContent.c_DataPoolLists, c_Buffer, u32_Position);
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Load node data pool lists from binary clipboard content
+
+   \param[out]  orc_OscContent   OSC content
+   \param[out]  orc_UiContent    UI content
+   \param[out]  ore_Type         Data pool type
+   \param[in]   orc_Data         Binary clipboard content
+
+   \return
+   C_NO_ERR Found and loaded
+   C_CONFIG Content invalid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SdClipBoardHelper::mh_LoadDataPoolListsFromBinary(std::vector<C_OscNodeDataPoolList> & orc_OscContent,
+                                                            std::vector<C_PuiSdNodeDataPoolList> & orc_UiContent,
+                                                            C_OscNodeDataPool::E_Type & ore_Type,
+                                                            const QByteArray & orc_Data)
+{
+   const std::vector<uint8_t> c_Buffer = mh_ToVector(orc_Data);
+   uint32_t u32_Position = 0UL;
+   int32_t s32_Retval = C_OscNodeDataPoolBinaryFiler::h_LoadHeader(C_OscNodeDataPoolBinaryFiler::eLISTS,
+                                                                    c_Buffer, u32_Position);
+
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = C_OscNodeDataPoolBinaryFiler::h_LoadDataPoolLists(orc_OscContent, ore_Type, c_Buffer,
+                                                                     u32_Position);
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = mh_LoadUiDataPoolLists(orc_UiContent, c_Buffer, u32_Position);
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Load node data pool list elements from binary clipboard content
+
+   \param[out]  orc_OscContent   OSC content
+   \param[out]  orc_UiContent    UI content
+   \param[out]  ore_Type         Type of the data pool the elements were copied from
+   \param[in]   orc_Data         Binary clipboard content
+
+   \return
+   C_NO_ERR Found and loaded
+   C_CONFIG Content invalid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SdClipBoardHelper::mh_LoadDataPoolListElementsFromBinary(
+   std::vector<C_OscNodeDataPoolListElement> & orc_OscContent,
+   std::vector<C_PuiSdNodeDataPoolListElement> & orc_UiContent, C_OscNodeDataPool::E_Type & ore_Type,
+   const QByteArray & orc_Data)
+{
+   const std::vector<uint8_t> c_Buffer = mh_ToVector(orc_Data);
+   uint32_t u32_Position = 0UL;
+   int32_t s32_Retval = C_OscNodeDataPoolBinaryFiler::h_LoadHeader(C_OscNodeDataPoolBinaryFiler::eLIST_ELEMENTS,
+                                                                    c_Buffer, u32_Position);
+
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = C_OscNodeDataPoolBinaryFiler::h_LoadDataPoolListElements(orc_OscContent, ore_Type, c_Buffer,
+                                                                            u32_Position);
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = mh_LoadUiDataPoolListElements(orc_UiContent, c_Buffer, u32_Position);
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Load node data pool list data sets from binary clipboard content
+
+   \param[out]  orc_OscNames           Data set names
+   \param[out]  orc_OscDataSetValues   Data set values
+   \param[in]   orc_Data               Binary clipboard content
+
+   \return
+   C_NO_ERR Found and loaded
+   C_CONFIG Content invalid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SdClipBoardHelper::mh_LoadDataPoolListDataSetsFromBinary(
+   std::vector<C_OscNodeDataPoolDataSet> & orc_OscNames,
+   std::vector<std::vector<C_OscNodeDataPoolContent> > & orc_OscDataSetValues, const QByteArray & orc_Data)
+{
+   const std::vector<uint8_t> c_Buffer = mh_ToVector(orc_Data);
+   uint32_t u32_Position = 0UL;
+   int32_t s32_Retval = C_OscNodeDataPoolBinaryFiler::h_LoadHeader(C_OscNodeDataPoolBinaryFiler::eDATA_SETS,
+                                                                    c_Buffer, u32_Position);
+
+   if (s32_Retval == C_NO_ERR)
+   {
+      s32_Retval = C_OscNodeDataPoolBinaryFiler::h_LoadDataPoolListDataSets(orc_OscNames, orc_OscDataSetValues,
+                                                                            c_Buffer, u32_Position);
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Append UI part of node data pool lists to binary clipboard content
+
+   \param[in]      orc_UiContent    UI content
+   \param[in,out]  orc_Buffer       Binary clipboard content
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdClipBoardHelper::mh_SaveUiDataPoolLists(const std::vector<C_PuiSdNodeDataPoolList> & orc_UiContent,
+                                                 std::vector<uint8_t> & orc_Buffer)
+{
+   C_OscNodeDataPoolBinaryFiler::h_AppendU32(static_cast<uint32_t>(orc_UiContent.size()), orc_Buffer);
+   for (uint32_t u32_ItList = 0UL; u32_ItList < orc_UiContent.size(); ++u32_ItList)
+   {
+      mh_SaveUiDataPoolListElements(orc_UiContent[u32_ItList].c_DataPoolListElements, orc_Buffer);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read UI part of node data pool lists from binary clipboard content
+
+   \param[out]     orc_UiContent    UI content
+   \param[in]      orc_Buffer       Binary clipboard content
+   \param[in,out]  oru32_Position   Read position
+
+   \return
+   C_NO_ERR Found and loaded
+   C_CONFIG Content invalid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SdClipBoardHelper::mh_LoadUiDataPoolLists(std::vector<C_PuiSdNodeDataPoolList> & orc_UiContent,
+                                                    const std::vector<uint8_t> & orc_Buffer,
+                                                    uint32_t & oru32_Position)
+{
+   uint32_t u32_Count = 0UL;
+   int32_t s32_Retval = C_OscNodeDataPoolBinaryFiler::h_ReadCount(orc_Buffer, oru32_Position, u32_Count);
+
+   orc_UiContent.clear();
+   if (s32_Retval == C_NO_ERR)
+   {
+      orc_UiContent.resize(u32_Count);
+   }
+   for (uint32_t u32_ItList = 0UL; (u32_ItList < u32_Count) && (s32_Retval == C_NO_ERR); ++u32_ItList)
+   {
+      s32_Retval = mh_LoadUiDataPoolListElements(orc_UiContent[u32_ItList].c_DataPoolListElements, orc_Buffer,
+                                                 oru32_Position);
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Append UI part of node data pool list elements to binary clipboard content
+
+   \param[in]      orc_UiContent    UI content
+   \param[in,out]  orc_Buffer       Binary clipboard content
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdClipBoardHelper::mh_SaveUiDataPoolListElements(
+   const std::vector<C_PuiSdNodeDataPoolListElement> & orc_UiContent, std::vector<uint8_t> & orc_Buffer)
+{
+   C_OscNodeDataPoolBinaryFiler::h_AppendU32(static_cast<uint32_t>(orc_UiContent.size()), orc_Buffer);
+   for (uint32_t u32_ItElement = 0UL; u32_ItElement < orc_UiContent.size(); ++u32_ItElement)
+   {
+      C_OscNodeDataPoolBinaryFiler::h_AppendBool(orc_UiContent[u32_ItElement].q_AutoMinMaxActive, orc_Buffer);
+      C_OscNodeDataPoolBinaryFiler::h_AppendBool(orc_UiContent[u32_ItElement].q_InterpretAsString, orc_Buffer);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read UI part of node data pool list elements from binary clipboard content
+
+   \param[out]     orc_UiContent    UI content
+   \param[in]      orc_Buffer       Binary clipboard content
+   \param[in,out]  oru32_Position   Read position
+
+   \return
+   C_NO_ERR Found and loaded
+   C_CONFIG Content invalid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SdClipBoardHelper::mh_LoadUiDataPoolListElements(std::vector<C_PuiSdNodeDataPoolListElement> & orc_UiContent,
+                                                           const std::vector<uint8_t> & orc_Buffer,
+                                                           uint32_t & oru32_Position)
+{
+   uint32_t u32_Count = 0UL;
+   int32_t s32_Retval = C_OscNodeDataPoolBinaryFiler::h_ReadCount(orc_Buffer, oru32_Position, u32_Count);
+
+   orc_UiContent.clear();
+   if (s32_Retval == C_NO_ERR)
+   {
+      orc_UiContent.resize(u32_Count);
+   }
+   for (uint32_t u32_ItElement = 0UL; (u32_ItElement < u32_Count) && (s32_Retval == C_NO_ERR); ++u32_ItElement)
+   {
+      C_PuiSdNodeDataPoolListElement & rc_Element = orc_UiContent[u32_ItElement];
+      s32_Retval = C_OscNodeDataPoolBinaryFiler::h_ReadBool(orc_Buffer, oru32_Position,
+                                                            rc_Element.q_AutoMinMaxActive);
+      if (s32_Retval == C_NO_ERR)
+      {
+         s32_Retval = C_OscNodeDataPoolBinaryFiler::h_ReadBool(orc_Buffer, oru32_Position,
+                                                               rc_Element.q_InterpretAsString);
+      }
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create XML text of binary node data pool clipboard content
+
+   \param[in]  orc_Data    Binary clipboard content
+
+   \return
+   XML text (empty if content invalid)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+QString C_SdClipBoardHelper::mh_DataPoolToText(const QByteArray & orc_Data)
+{
+   QString c_Retval;
+   C_OscNodeDataPool c_OscContent;
+   C_PuiSdNodeDataPool c_UiContent;
+
+   if (mh_LoadDataPoolFromBinary(c_OscContent, c_UiContent, orc_Data) == C_NO_ERR)
+   {
+      mh_StoreDataPoolToString(c_OscContent, c_UiContent, c_Retval);
+   }
+   return c_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create XML text of binary node data pool lists clipboard content
+
+   \param[in]  orc_Data    Binary clipboard content
+
+   \return
+   XML text (empty if content invalid)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+QString C_SdClipBoardHelper::mh_DataPoolListsToText(const QByteArray & orc_Data)
+{
+   QString c_Retval;
+   std::vector<C_OscNodeDataPoolList> c_OscContent;
+   std::vector<C_PuiSdNodeDataPoolList> c_UiContent;
+   C_OscNodeDataPool::E_Type e_Type = C_OscNodeDataPool::eDIAG;
+
+   if (mh_LoadDataPoolListsFromBinary(c_OscContent, c_UiContent, e_Type, orc_Data) == C_NO_ERR)
+   {
+      mh_StoreDataPoolListsToString(c_OscContent, c_UiContent, e_Type, c_Retval);
+   }
+   return c_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create XML text of binary node data pool list elements clipboard content
+
+   \param[in]  orc_Data    Binary clipboard content
+
+   \return
+   XML text (empty if content invalid)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+QString C_SdClipBoardHelper::mh_DataPoolListElementsToText(const QByteArray & orc_Data)
+{
+   QString c_Retval;
+   std::vector<C_OscNodeDataPoolListElement> c_OscContent;
+   std::vector<C_PuiSdNodeDataPoolListElement> c_UiContent;
+   C_OscNodeDataPool::E_Type e_Type = C_OscNodeDataPool::eDIAG;
+
+   if (mh_LoadDataPoolListElementsFromBinary(c_OscContent, c_UiContent, e_Type, orc_Data) == C_NO_ERR)
+   {
+      h_StoreDataPoolListElementsToString(c_OscContent, c_UiContent, e_Type, c_Retval);
+   }
+   return c_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create XML text of binary node data pool list data sets clipboard content
+
+   \param[in]  orc_Data    Binary clipboard content
+
+   \return
+   XML text (empty if content invalid)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+QString C_SdClipBoardHelper::mh_DataPoolListDataSetsToText(const QByteArray & orc_Data)
+{
+   QString c_Retval;
+   std::vector<C_OscNodeDataPoolDataSet> c_OscNames;
+   std::vector<std::vector<C_OscNodeDataPoolContent> > c_OscDataSetValues;
+
+   if (mh_LoadDataPoolListDataSetsFromBinary(c_OscNames, c_OscDataSetValues, orc_Data) == C_NO_ERR)
+   {
+      h_StoreDataPoolListDataSetsToString(c_OscNames, c_OscDataSetValues, c_Retval);
+   }
+   return c_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Convert binary content to clipboard data
+
+   \param[in]  orc_Buffer  Binary content
+
+   \return
+   Clipboard data
+*/
+//----------------------------------------------------------------------------------------------------------------------
+QByteArray C_SdClipBoardHelper::mh_ToByteArray(const std::vector<uint8_t> & orc_Buffer)
+{
+   QByteArray c_Retval;
+
+   if (orc_Buffer.empty() == false)
+   {
+      c_Retval = QByteArray(reinterpret_cast<const char_t *>(&orc_Buffer[0]), static_cast<int32_t>(orc_Buffer.size()));
+   }
+   return c_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Convert clipboard data to binary content
+
+   \param[in]  orc_Data    Clipboard data
+
+   \return
+   Binary content
+*/
+//----------------------------------------------------------------------------------------------------------------------
+std::vector<uint8_t> C_SdClipBoardHelper::mh_ToVector(const QByteArray & orc_Data)
+{
+   const uint8_t * const pu8_Data = reinterpret_cast<const uint8_t *>(orc_Data.constData());
+
+   return std::vector<uint8_t>(pu8_Data, pu8_Data + orc_Data.size());
+}
@@ -15,6 +15,7 @@
 
 #include <vector>
 #include <QString>
+#include <QByteArray>
 #include <QModelIndexList>
 #include "stwtypes.hpp"
 #include "C_OscNodeDataPool.hpp"
@@ -119,11 +120,56 @@ public:
 private:
    C_SdClipBoardHelper(void);
 
+   static const QString mhc_MIME_TYPE_DATA_POOL;
+   static const QString mhc_MIME_TYPE_LISTS;
+   static const QString mhc_MIME_TYPE_LIST_ELEMENTS;
+   static const QString mhc_MIME_TYPE_DATA_SETS;
+
    static void mh_StoreSignalsToString(const std::vector<stw::opensyde_core::C_OscCanSignal> & orc_Signals,
                                        const std::vector<stw::opensyde_core::C_OscNodeDataPoolListElement> & orc_OscSignalCommons, const std::vector<C_PuiSdNodeDataPoolListElement> & orc_UiSignalCommons, const std::vector<C_PuiSdNodeCanSignal> & orc_UiSignals, const opensyde_core::C_OscCanProtocol::E_Type oe_ProtocolType, QString & orc_Output);
    static int32_t mh_LoadSignalsFromString(const QString & orc_Input,
                                            std::vector<stw::opensyde_core::C_OscCanSignal> & orc_Signals,
                                            std::vector<stw::opensyde_core::C_OscNodeDataPoolListElement> & orc_OscSignalCommons, std::vector<C_PuiSdNodeDataPoolListElement> & orc_UiSignalCommons, std::vector<C_PuiSdNodeCanSignal> & orc_UiSignals);
+   static void mh_StoreDataPoolToString(const stw::opensyde_core::C_OscNodeDataPool & orc_OscContent,
+                                        const C_PuiSdNodeDataPool & orc_UiContent, QString & orc_Output);
+   static int32_t mh_LoadDataPoolFromString(stw::opensyde_core::C_OscNodeDataPool & orc_OscContent,
+                                            C_PuiSdNodeDataPool & orc_UiContent, const QString & orc_Input);
+   static void mh_StoreDataPoolListsToString(
+      const std::vector<stw::opensyde_core::C_OscNodeDataPoolList> & orc_OscContent,
+      const std::vector<C_PuiSdNodeDataPoolList> & orc_UiContent,
+      const stw::opensyde_core::C_OscNodeDataPool::E_Type & ore_Type, QString & orc_Output);
+   static int32_t mh_LoadDataPoolListsFromString(
+      std::vector<stw::opensyde_core::C_OscNodeDataPoolList> & orc_OscContent,
+      std::vector<C_PuiSdNodeDataPoolList> & orc_UiContent, stw::opensyde_core::C_OscNodeDataPool::E_Type & ore_Type,
+      const QString & orc_Input);
+   static int32_t mh_LoadDataPoolFromBinary(stw::opensyde_core::C_OscNodeDataPool & orc_OscContent,
+                                            C_PuiSdNodeDataPool & orc_UiContent, const QByteArray & orc_Data);
+   static int32_t mh_LoadDataPoolListsFromBinary(
+      std::vector<stw::opensyde_core::C_OscNodeDataPoolList> & orc_OscContent,
+      std::vector<C_PuiSdNodeDataPoolList> & orc_UiContent, stw::opensyde_core::C_OscNodeDataPool::E_Type & ore_Type,
+      const QByteArray & orc_Data);
+   static int32_t mh_LoadDataPoolListElementsFromBinary(
+      std::vector<stw::opensyde_core::C_OscNodeDataPoolListElement> & orc_OscContent,
+      std::vector<C_PuiSdNodeDataPoolListElement> & orc_UiContent,
+      stw::opensyde_core::C_OscNodeDataPool::E_Type & ore_Type, const QByteArray & orc_Data);
+   static int32_t mh_LoadDataPoolListDataSetsFromBinary(
+      std::vector<stw::opensyde_core::C_OscNodeDataPoolDataSet> & orc_OscNames,
+      std::vector<std::vector<stw::opensyde_core::C_OscNodeDataPoolContent> > & orc_OscDataSetValues,
+      const QByteArray & orc_Data);
+   static void mh_SaveUiDataPoolLists(const std::vector<C_PuiSdNodeDataPoolList> & orc_UiContent,
+                                      std::vector<uint8_t> & orc_Buffer);
+   static int32_t mh_LoadUiDataPoolLists(std::vector<C_PuiSdNodeDataPoolList> & orc_UiContent,
+                                         const std::vector<uint8_t> & orc_Buffer, uint32_t & oru32_Position);
+   static void mh_SaveUiDataPoolListElements(const std::vector<C_PuiSdNodeDataPoolListElement> & orc_UiContent,
+                                             std::vector<uint8_t> & orc_Buffer);
+   static int32_t mh_LoadUiDataPoolListElements(std::vector<C_PuiSdNodeDataPoolListElement> & orc_UiContent,
+                                                const std::vector<uint8_t> & orc_Buffer, uint32_t & oru32_Position);
+   static QString mh_DataPoolToText(const QByteArray & orc_Data);
+   static QString mh_DataPoolListsToText(const QByteArray & orc_Data);
+   static QString mh_DataPoolListElementsToText(const QByteArray & orc_Data);
+   static QString mh_DataPoolListDataSetsToText(const QByteArray & orc_Data);
+   static QByteArray mh_ToByteArray(const std::vector<uint8_t> & orc_Buffer);
+   static std::vector<uint8_t> mh_ToVector(const QByteArray & orc_Data);
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
@@ -0,0 +1,529 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Trigram index of all searchable system definition names
+
+   Holds the case folded names of all nodes, buses, Datapools, lists, elements, messages, data blocks and
+   HALC channels with the indices to find them again. Each name is registered with all of its trigrams so a search
+   only has to verify the entries of the shortest matching posting list.
+
+   The entries are grouped in one bucket per node and one bucket for all buses. The buckets are marked dirty by the
+   change signals of the system definition and rebuilt on the next search, so typing a search string never walks
+   the complete system definition again.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <algorithm>
+
+#include "stwtypes.hpp"
+#include "C_SdSearchIndex.hpp"
+#include "C_PuiSdHandler.hpp"
+#include "C_OscCanProtocol.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::opensyde_gui_logic;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+
+   \param[in]  opc_Parent  Optional parent
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SdSearchIndex::C_SdSearchIndex(QObject * const opc_Parent) :
+   QObject(opc_Parent),
+   mq_NodeCountDirty(true)
+{
+   const C_PuiSdHandler * const pc_Handler = C_PuiSdHandler::h_GetInstance();
+
+   //Changes of the node count or node order
+   connect(pc_Handler, &C_PuiSdHandler::SigNodesChanged, this, &C_SdSearchIndex::m_OnNodesChanged);
+   connect(pc_Handler, &C_PuiSdHandler::SigSyncNodeAdded, this, &C_SdSearchIndex::m_OnNodesChanged);
+   connect(pc_Handler, &C_PuiSdHandler::SigSyncNodeAboutToBeDeleted, this, &C_SdSearchIndex::m_OnNodesChanged);
+   connect(pc_Handler, &C_PuiSdHandler::SigSyncClear, this, &C_SdSearchIndex::m_OnNodesChanged);
+   connect(pc_Handler, &C_PuiSdHandler::SigSyncClear, this, &C_SdSearchIndex::m_OnBussesChanged);
+
+   //Changes of one node
+   connect(pc_Handler, &C_PuiSdHandler::SigNodeChanged, this, &C_SdSearchIndex::m_OnNodeChanged);
+   connect(pc_Handler, &C_PuiSdHandler::SigSyncNodeHalc, this, &C_SdSearchIndex::m_OnNodeChanged);
+   connect(pc_Handler, &C_PuiSdHandler::SigSyncNodeReplace, this, &C_SdSearchIndex::m_OnNodeChanged);
+   connect(pc_Handler, &C_PuiSdHandler::SigSyncNodeNamesChanged, this, &C_SdSearchIndex::m_OnNodeChanged);
+   connect(pc_Handler, &C_PuiSdHandler::SigSyncNodeDataPoolAdded, this, &C_SdSearchIndex::m_OnNodeChanged);
+   connect(pc_Handler, &C_PuiSdHandler::SigSyncNodeDataPoolMoved, this, &C_SdSearchIndex::m_OnNodeChanged);
+   connect(pc_Handler, &C_PuiSdHandler::SigSyncNodeDataPoolAboutToBeDeleted, this,
+           &C_SdSearchIndex::m_OnNodeChanged);
+   connect(pc_Handler, &C_PuiSdHandler::SigSyncNodeApplicationAdded, this, &C_SdSearchIndex::m_OnNodeChanged);
+   connect(pc_Handler, &C_PuiSdHandler::SigSyncNodeApplicationMoved, this, &C_SdSearchIndex::m_OnNodeChanged);
+   connect(pc_Handler, &C_PuiSdHandler::SigSyncNodeApplicationAboutToBeDeleted, this,
+           &C_SdSearchIndex::m_OnNodeChanged);
+   connect(pc_Handler, &C_PuiSdHandler::SigSyncNodeDataPoolListAdded, this, &C_SdSearchIndex::m_OnNodeChanged);
+   connect(pc_Handler, &C_PuiSdHandler::SigSyncNodeDataPoolListMoved, this, &C_SdSearchIndex::m_OnNodeChanged);
+   connect(pc_Handler, &C_PuiSdHandler::SigSyncNodeDataPoolListAboutToBeDeleted, this,
+           &C_SdSearchIndex::m_OnNodeChanged);
+   connect(pc_Handler, &C_PuiSdHandler::SigSyncNodeDataPoolListElementAdded, this,
+           &C_SdSearchIndex::m_OnNodeChanged);
+   connect(pc_Handler, &C_PuiSdHandler::SigSyncNodeDataPoolListElementMoved, this,
+           &C_SdSearchIndex::m_OnNodeChanged);
+   connect(pc_Handler, &C_PuiSdHandler::SigSyncNodeDataPoolListElementAboutToBeDeleted, this,
+           &C_SdSearchIndex::m_OnNodeChanged);
+
+   //Changes of buses
+   connect(pc_Handler, &C_PuiSdHandler::SigBussesChanged, this, &C_SdSearchIndex::m_OnBussesChanged);
+   connect(pc_Handler, &C_PuiSdHandler::SigBusChanged, this, &C_SdSearchIndex::m_OnBussesChanged);
+   connect(pc_Handler, &C_PuiSdHandler::SigSyncBusAdded, this, &C_SdSearchIndex::m_OnBussesChanged);
+   connect(pc_Handler, &C_PuiSdHandler::SigSyncBusDeleted, this, &C_SdSearchIndex::m_OnBussesChanged);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Search all names containing the search string
+
+   Outdated parts of the index are rebuilt first.
+   The results are sorted by node index (buses last) and keep the order of the system definition.
+
+   \param[in]   orc_SearchString    Search string (case insensitive)
+   \param[out]  orc_Results         All entries containing the search string
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdSearchIndex::Search(const QString & orc_SearchString, std::vector<C_Entry> & orc_Results)
+{
+   orc_Results.clear();
+
+   if (orc_SearchString.isEmpty() == false)
+   {
+      const QString c_FoldedSearchString = orc_SearchString.toCaseFolded();
+
+      this->m_UpdateDirtyBuckets();
+
+      for (uint32_t u32_ItBucket = 0U; u32_ItBucket < this->mc_NodeBuckets.size(); ++u32_ItBucket)
+      {
+         this->mc_NodeBuckets[u32_ItBucket].Search(c_FoldedSearchString, orc_Results);
+      }
+      this->mc_BusBucket.Search(c_FoldedSearchString, orc_Results);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SdSearchIndex::C_Bucket::C_Bucket(void) :
+   q_Dirty(true)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Remove all entries
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdSearchIndex::C_Bucket::Clear(void)
+{
+   this->c_Entries.clear();
+   this->c_Postings.clear();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Add entry and register it for all trigrams of its name
+
+   \param[in]  orc_Entry   Entry to add
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdSearchIndex::C_Bucket::AddEntry(const C_Entry & orc_Entry)
+{
+   const uint32_t u32_EntryIndex = static_cast<uint32_t>(this->c_Entries.size());
+
+   for (int32_t s32_Pos = 0; (s32_Pos + 2) < orc_Entry.c_FoldedName.size(); ++s32_Pos)
+   {
+      std::vector<uint32_t> & rc_Posting = this->c_Postings[mh_GetTrigram(orc_Entry.c_FoldedName, s32_Pos)];
+      //Entries are added in ascending order so a repeated trigram of the same name is always the last one
+      if ((rc_Posting.empty() == true) || (rc_Posting.back() != u32_EntryIndex))
+      {
+         rc_Posting.push_back(u32_EntryIndex);
+      }
+   }
+   this->c_Entries.push_back(orc_Entry);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Append all entries containing the search string
+
+   Search strings with at least three characters intersect the posting lists starting with the shortest one,
+   shorter search strings check all names of the bucket.
+
+   \param[in]      orc_FoldedSearchString    Case folded search string
+   \param[in,out]  orc_Results               Results to append to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdSearchIndex::C_Bucket::Search(const QString & orc_FoldedSearchString, std::vector<C_Entry> & orc_Results) const
+{
+   if (orc_FoldedSearchString.size() < 3)
+   {
+      for (uint32_t u32_ItEntry = 0U; u32_ItEntry < this->c_Entries.size(); ++u32_ItEntry)
+      {
+         if (this->c_Entries[u32_ItEntry].c_FoldedName.contains(orc_FoldedSearchString, Qt::CaseSensitive))
+         {
+            orc_Results.push_back(this->c_Entries[u32_ItEntry]);
+         }
+      }
+   }
+   else
+   {
+      std::vector<const std::vector<uint32_t> *> c_Postings;
+      bool q_AllFound = true;
+
+      for (int32_t s32_Pos = 0; (s32_Pos + 2) < orc_FoldedSearchString.size(); ++s32_Pos)
+      {
+         const QHash<uint64_t, std::vector<uint32_t> >::const_iterator c_It =
+            this->c_Postings.find(mh_GetTrigram(orc_FoldedSearchString, s32_Pos));
+         if (c_It == this->c_Postings.end())
+         {
+            q_AllFound = false;
+            break;
+         }
+         c_Postings.push_back(&c_It.value());
+      }
+
+      if (q_AllFound == true)
+      {
+         const std::vector<uint32_t> * pc_Shortest = c_Postings[0];
+         for (uint32_t u32_ItPosting = 1U; u32_ItPosting < c_Postings.size(); ++u32_ItPosting)
+         {
+            if (c_Postings[u32_ItPosting]->size() < pc_Shortest->size())
+            {
+               pc_Shortest = c_Postings[u32_ItPosting];
+            }
+         }
+
+         for (uint32_t u32_ItCandidate = 0U; u32_ItCandidate < pc_Shortest->size(); ++u32_ItCandidate)
+         {
+            const uint32_t u32_EntryIndex = (*pc_Shortest)[u32_ItCandidate];
+            bool q_InAll = true;
+
+            for (uint32_t u32_ItPosting = 0U; u32_ItPosting < c_Postings.size(); ++u32_ItPosting)
+            {
+               if ((c_Postings[u32_ItPosting] != pc_Shortest) &&
+                   (std::binary_search(c_Postings[u32_ItPosting]->begin(), c_Postings[u32_ItPosting]->end(),
+                                       u32_EntryIndex) == false))
+               {
+                  q_InAll = false;
+                  break;
+               }
+            }
+
+            //Trigrams do not guarantee the order, so verify the candidate
+            if ((q_InAll == true) &&
+                (this->c_Entries[u32_EntryIndex].c_FoldedName.contains(orc_FoldedSearchString, Qt::CaseSensitive)))
+            {
+               orc_Results.push_back(this->c_Entries[u32_EntryIndex]);
+            }
+         }
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Rebuild all outdated buckets
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdSearchIndex::m_UpdateDirtyBuckets(void)
+{
+   const C_OscSystemDefinition & rc_SystemDefinition =
+      C_PuiSdHandler::h_GetInstance()->GetOscSystemDefinitionConst();
+
+   if ((this->mq_NodeCountDirty == true) || (this->mc_NodeBuckets.size() != rc_SystemDefinition.c_Nodes.size()))
+   {
+      this->mc_NodeBuckets.clear();
+      this->mc_NodeBuckets.resize(rc_SystemDefinition.c_Nodes.size());
+      this->mq_NodeCountDirty = false;
+   }
+
+   for (uint32_t u32_ItNode = 0U; u32_ItNode < this->mc_NodeBuckets.size(); ++u32_ItNode)
+   {
+      C_Bucket & rc_Bucket = this->mc_NodeBuckets[u32_ItNode];
+      if (rc_Bucket.q_Dirty == true)
+      {
+         rc_Bucket.Clear();
+         mh_FillNodeBucket(rc_SystemDefinition.c_Nodes[u32_ItNode], u32_ItNode, rc_Bucket);
+         rc_Bucket.q_Dirty = false;
+      }
+   }
+
+   if (this->mc_BusBucket.q_Dirty == true)
+   {
+      this->mc_BusBucket.Clear();
+      for (uint32_t u32_ItBus = 0U; u32_ItBus < rc_SystemDefinition.c_Buses.size(); ++u32_ItBus)
+      {
+         this->mc_BusBucket.AddEntry(mh_CreateEntry(eBUS, u32_ItBus,
+                                                    rc_SystemDefinition.c_Buses[u32_ItBus].c_Name.c_str()));
+      }
+      this->mc_BusBucket.q_Dirty = false;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Add all names of one node
+
+   \param[in]      orc_Node         Node
+   \param[in]      ou32_NodeIndex   Node index
+   \param[in,out]  orc_Bucket       Bucket of the node
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdSearchIndex::mh_FillNodeBucket(const C_OscNode & orc_Node, const uint32_t ou32_NodeIndex,
+                                        C_Bucket & orc_Bucket)
+{
+   uint32_t u32_Counter;
+
+   orc_Bucket.AddEntry(mh_CreateEntry(eNODE, ou32_NodeIndex, orc_Node.c_Properties.c_Name.c_str()));
+
+   for (u32_Counter = 0U; u32_Counter < orc_Node.c_DataPools.size(); ++u32_Counter)
+   {
+      mh_FillDataPoolEntries(orc_Node.c_DataPools[u32_Counter], u32_Counter, ou32_NodeIndex, orc_Bucket);
+   }
+
+   for (u32_Counter = 0U; u32_Counter < orc_Node.c_ComProtocols.size(); ++u32_Counter)
+   {
+      mh_FillCanProtocolEntries(orc_Node, u32_Counter, ou32_NodeIndex, orc_Bucket);
+   }
+
+   for (u32_Counter = 0U; u32_Counter < orc_Node.c_Applications.size(); ++u32_Counter)
+   {
+      C_Entry c_Entry = mh_CreateEntry(eAPPLICATION, ou32_NodeIndex,
+                                       orc_Node.c_Applications[u32_Counter].c_Name.c_str());
+      c_Entry.au32_Indices[0] = u32_Counter;
+      orc_Bucket.AddEntry(c_Entry);
+   }
+
+   mh_FillHalcEntries(orc_Node.c_HalcConfig, ou32_NodeIndex, orc_Bucket);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Add names of Datapool, lists and elements
+
+   \param[in]      orc_DataPool        Datapool
+   \param[in]      ou32_DataPoolIndex  Datapool index
+   \param[in]      ou32_NodeIndex      Node index
+   \param[in,out]  orc_Bucket          Bucket of the node
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdSearchIndex::mh_FillDataPoolEntries(const C_OscNodeDataPool & orc_DataPool, const uint32_t ou32_DataPoolIndex,
+                                             const uint32_t ou32_NodeIndex, C_Bucket & orc_Bucket)
+{
+   C_Entry c_Entry = mh_CreateEntry(eDATAPOOL, ou32_NodeIndex, orc_DataPool.c_Name.c_str());
+
+   c_Entry.au32_Indices[0] = ou32_DataPoolIndex;
+   orc_Bucket.AddEntry(c_Entry);
+
+   for (uint32_t u32_ListCounter = 0U; u32_ListCounter < orc_DataPool.c_Lists.size(); ++u32_ListCounter)
+   {
+      const C_OscNodeDataPoolList & rc_List = orc_DataPool.c_Lists[u32_ListCounter];
+
+      c_Entry = mh_CreateEntry(eLIST, ou32_NodeIndex, rc_List.c_Name.c_str());
+      c_Entry.au32_Indices[0] = ou32_DataPoolIndex;
+      c_Entry.au32_Indices[1] = u32_ListCounter;
+      orc_Bucket.AddEntry(c_Entry);
+
+      for (uint32_t u32_ElementCounter = 0U; u32_ElementCounter < rc_List.c_Elements.size(); ++u32_ElementCounter)
+      {
+         c_Entry = mh_CreateEntry(eDATA_ELEMENT, ou32_NodeIndex, rc_List.c_Elements[u32_ElementCounter].c_Name.c_str());
+         c_Entry.au32_Indices[0] = ou32_DataPoolIndex;
+         c_Entry.au32_Indices[1] = u32_ListCounter;
+         c_Entry.au32_Indices[2] = u32_ElementCounter;
+         orc_Bucket.AddEntry(c_Entry);
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Add names of all messages of one protocol
+
+   \param[in]      orc_Node            Node
+   \param[in]      ou32_ProtocolIndex  Protocol index
+   \param[in]      ou32_NodeIndex      Node index
+   \param[in,out]  orc_Bucket          Bucket of the node
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdSearchIndex::mh_FillCanProtocolEntries(const C_OscNode & orc_Node, const uint32_t ou32_ProtocolIndex,
+                                                const uint32_t ou32_NodeIndex, C_Bucket & orc_Bucket)
+{
+   const C_OscCanProtocol & rc_Protocol = orc_Node.c_ComProtocols[ou32_ProtocolIndex];
+
+   if (rc_Protocol.u32_DataPoolIndex < orc_Node.c_DataPools.size())
+   {
+      const C_OscNodeDataPool & rc_DataPool = orc_Node.c_DataPools[rc_Protocol.u32_DataPoolIndex];
+
+      for (uint32_t u32_ContainerCounter = 0U; u32_ContainerCounter < rc_Protocol.c_ComMessages.size();
+           ++u32_ContainerCounter)
+      {
+         for (uint32_t u32_Direction = 0U; u32_Direction < 2U; ++u32_Direction)
+         {
+            const bool q_IsTx = (u32_Direction == 0U);
+            const std::vector<C_OscCanMessage> & rc_Messages = q_IsTx ?
+                                                               rc_Protocol.c_ComMessages[u32_ContainerCounter].
+                                                               c_TxMessages :
+                                                               rc_Protocol.c_ComMessages[u32_ContainerCounter].
+                                                               c_RxMessages;
+            const int32_t s32_ListIndex = C_OscCanProtocol::h_GetListIndex(rc_DataPool, u32_ContainerCounter,
+                                                                           q_IsTx);
+
+            for (uint32_t u32_MessageCounter = 0U; u32_MessageCounter < rc_Messages.size(); ++u32_MessageCounter)
+            {
+               C_Entry c_Entry = mh_CreateEntry(eMESSAGE, ou32_NodeIndex,
+                                                rc_Messages[u32_MessageCounter].c_Name.c_str());
+               c_Entry.au32_Indices[0] = rc_Protocol.u32_DataPoolIndex;
+               c_Entry.au32_Indices[1] = static_cast<uint32_t>(s32_ListIndex);
+               c_Entry.au32_Indices[2] = u32_MessageCounter;
+               c_Entry.au32_Indices[3] = q_IsTx ? 1U : 0U;
+               c_Entry.au32_Indices[4] = ou32_ProtocolIndex;
+               orc_Bucket.AddEntry(c_Entry);
+            }
+         }
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Add names of all HALC channels
+
+   Domains without channels are found by the domain name,
+   channels by the user defined name or the name of the definition.
+
+   \param[in]      orc_HalcConfig   HALC configuration
+   \param[in]      ou32_NodeIndex   Node index
+   \param[in,out]  orc_Bucket       Bucket of the node
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdSearchIndex::mh_FillHalcEntries(const C_OscHalcConfig & orc_HalcConfig, const uint32_t ou32_NodeIndex,
+                                         C_Bucket & orc_Bucket)
+{
+   const uint32_t u32_DomainCount = orc_HalcConfig.GetDomainSize();
+
+   for (uint32_t u32_DomainCounter = 0U; u32_DomainCounter < u32_DomainCount; ++u32_DomainCounter)
+   {
+      const C_OscHalcDefDomain * const pc_HalcDef = orc_HalcConfig.GetDomainDefDataConst(u32_DomainCounter);
+
+      if (pc_HalcDef != NULL)
+      {
+         if (pc_HalcDef->c_Channels.size() == 0)
+         {
+            C_Entry c_Entry = mh_CreateEntry(eHALC_CHANNEL, ou32_NodeIndex, pc_HalcDef->c_Name.c_str());
+            c_Entry.au32_Indices[0] = u32_DomainCounter;
+            c_Entry.au32_Indices[2] = 0U;
+            orc_Bucket.AddEntry(c_Entry);
+         }
+         else
+         {
+            const C_OscHalcConfigDomain * const pc_HalcConf =
+               orc_HalcConfig.GetDomainConfigDataConst(u32_DomainCounter);
+
+            if ((pc_HalcConf != NULL) && (pc_HalcConf->c_ChannelConfigs.size() == pc_HalcDef->c_Channels.size()))
+            {
+               for (uint32_t u32_ChannelCounter = 0U; u32_ChannelCounter < pc_HalcDef->c_Channels.size();
+                    ++u32_ChannelCounter)
+               {
+                  const QString c_UserName = pc_HalcConf->c_ChannelConfigs[u32_ChannelCounter].c_Name.c_str();
+                  const QString c_DefName = pc_HalcDef->c_Channels[u32_ChannelCounter].c_Name.c_str();
+                  C_Entry c_Entry = mh_CreateEntry(eHALC_CHANNEL, ou32_NodeIndex, c_UserName + " (" + c_DefName + ")");
+                  c_Entry.c_FoldedName = c_UserName.toCaseFolded() + QChar(0) + c_DefName.toCaseFolded();
+                  c_Entry.au32_Indices[0] = u32_DomainCounter;
+                  c_Entry.au32_Indices[1] = u32_ChannelCounter;
+                  c_Entry.au32_Indices[2] = 1U;
+                  orc_Bucket.AddEntry(c_Entry);
+               }
+            }
+         }
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Create entry with folded name and cleared indices
+
+   \param[in]  oe_Type           Entry type
+   \param[in]  ou32_ParentIndex  Node or bus index
+   \param[in]  orc_Name          Name
+
+   \return
+   New entry
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SdSearchIndex::C_Entry C_SdSearchIndex::mh_CreateEntry(const E_EntryType oe_Type, const uint32_t ou32_ParentIndex,
+                                                         const QString & orc_Name)
+{
+   C_Entry c_Entry;
+
+   c_Entry.e_Type = oe_Type;
+   c_Entry.u32_ParentIndex = ou32_ParentIndex;
+   std::fill(&c_Entry.au32_Indices[0], &c_Entry.au32_Indices[5], 0U);
+   c_Entry.c_Name = orc_Name;
+   c_Entry.c_FoldedName = orc_Name.toCaseFolded();
+   return c_Entry;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get key of the three characters starting at the position
+
+   \param[in]  orc_Text       Text
+   \param[in]  os32_Position  Position of first character (at least three characters must be available)
+
+   \return
+   Trigram key
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_SdSearchIndex::mh_GetTrigram(const QString & orc_Text, const int32_t os32_Position)
+{
+   return (static_cast<uint64_t>(orc_Text.at(os32_Position).unicode()) << 32U) |
+          (static_cast<uint64_t>(orc_Text.at(os32_Position + 1).unicode()) << 16U) |
+          static_cast<uint64_t>(orc_Text.at(os32_Position + 2).unicode());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Mark all nodes outdated (node count or node order changed)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdSearchIndex::m_OnNodesChanged(void)
+{
+   this->mq_NodeCountDirty = true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Mark the content of one node outdated
+
+   \param[in]  ou32_NodeIndex    Node index
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdSearchIndex::m_OnNodeChanged(const uint32_t ou32_NodeIndex)
+{
+   if (ou32_NodeIndex < this->mc_NodeBuckets.size())
+   {
+      this->mc_NodeBuckets[ou32_NodeIndex].q_Dirty = true;
+   }
+   else
+   {
+      this->mq_NodeCountDirty = true;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Mark all buses outdated
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdSearchIndex::m_OnBussesChanged(void)
+{
+   this->mc_BusBucket.q_Dirty = true;
+}
@@ -0,0 +1,116 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Trigram index of all searchable system definition names (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_SDSEARCHINDEX_HPP
+#define C_SDSEARCHINDEX_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
+#include <QObject>
+#include <QHash>
+#include <QString>
+
+#include "stwtypes.hpp"
+#include "C_OscNode.hpp"
+#include "C_OscSystemBus.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_gui_logic
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_SdSearchIndex :
+   public QObject
+{
+   Q_OBJECT
+
+public:
+   enum E_EntryType
+   {
+      eNODE,
+      eBUS,
+      eDATAPOOL,
+      eLIST,
+      eMESSAGE,
+      eDATA_ELEMENT,
+      eAPPLICATION,
+      eHALC_CHANNEL
+   };
+
+   ///One searchable name and the indices to find the item in the system definition
+   class C_Entry
+   {
+   public:
+      E_EntryType e_Type;
+      uint32_t u32_ParentIndex; ///< Node index or bus index
+      // eDATAPOOL: Datapool; eLIST: Datapool, list; eDATA_ELEMENT: Datapool, list, element
+      // eMESSAGE: Datapool, list, message, Tx flag, protocol; eAPPLICATION: data block
+      // eHALC_CHANNEL: domain, channel, use channel flag
+      uint32_t au32_Indices[5];
+      QString c_Name;       ///< Name as shown in the search result
+      QString c_FoldedName; ///< Case folded name(s); multiple names are separated by a null character
+   };
+
+   C_SdSearchIndex(QObject * const opc_Parent = NULL);
+
+   void Search(const QString & orc_SearchString, std::vector<C_Entry> & orc_Results);
+
+private:
+   ///Entries of one node or all buses
+   class C_Bucket
+   {
+   public:
+      C_Bucket(void);
+
+      void Clear(void);
+      void AddEntry(const C_Entry & orc_Entry);
+      void Search(const QString & orc_FoldedSearchString, std::vector<C_Entry> & orc_Results) const;
+
+      bool q_Dirty;
+      std::vector<C_Entry> c_Entries;
+      QHash<uint64_t, std::vector<uint32_t> > c_Postings; ///< Entry indices per trigram, sorted ascending
+   };
+
+   //Avoid call
+   C_SdSearchIndex(const C_SdSearchIndex &);
+   C_SdSearchIndex & operator =(const C_SdSearchIndex &) &;
+
+   void m_UpdateDirtyBuckets(void);
+   static void mh_FillNodeBucket(const stw::opensyde_core::C_OscNode & orc_Node, const uint32_t ou32_NodeIndex,
+                                 C_Bucket & orc_Bucket);
+   static void mh_FillDataPoolEntries(const stw::opensyde_core::C_OscNodeDataPool & orc_DataPool,
+                                      const uint32_t ou32_DataPoolIndex, const uint32_t ou32_NodeIndex,
+                                      C_Bucket & orc_Bucket);
+   static void mh_FillCanProtocolEntries(const stw::opensyde_core::C_OscNode & orc_Node,
+                                         const uint32_t ou32_ProtocolIndex, const uint32_t ou32_NodeIndex,
+                                         C_Bucket & orc_Bucket);
+   static void mh_FillHalcEntries(const stw::opensyde_core::C_OscHalcConfig & orc_HalcConfig,
+                                  const uint32_t ou32_NodeIndex, C_Bucket & orc_Bucket);
+   static C_Entry mh_CreateEntry(const E_EntryType oe_Type, const uint32_t ou32_ParentIndex, const QString & orc_Name);
+   static uint64_t mh_GetTrigram(const QString & orc_Text, const int32_t os32_Position);
+
+   void m_OnNodesChanged(void);
+   void m_OnNodeChanged(const uint32_t ou32_NodeIndex);
+   void m_OnBussesChanged(void);
+
+   std::vector<C_Bucket> mc_NodeBuckets;
+   C_Bucket mc_BusBucket;
+   bool mq_NodeCountDirty;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
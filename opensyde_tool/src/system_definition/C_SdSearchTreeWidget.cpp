@@ -11,6 +11,7 @@
 #include "precomp_headers.hpp"
 
 #include <vector>
+#include <algorithm>
 #include <QKeyEvent>
 
 #include "stwtypes.hpp"
@@ -43,6 +44,8 @@ const uint8_t C_SdSearchTreeWidget::mhu8_DATAELEMENT_TYPE_VARIABLE = 1U;
 const uint8_t C_SdSearchTreeWidget::mhu8_DATAELEMENT_TYPE_SIGNAL = 2U;
 const uint8_t C_SdSearchTreeWidget::mhu8_DATAELEMENT_TYPE_HALC = 3U;
 
+const uint32_t C_SdSearchTreeWidget::mhu32_RESULT_BATCH_SIZE = 250U;
+
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
 /* -- Global Variables ---------------------------------------------------------------------------------------------- */
@@ -60,7 +63,8 @@ const uint8_t C_SdSearchTreeWidget::mhu8_DATAELEMENT_TYPE_HALC = 3U;
 */
 //----------------------------------------------------------------------------------------------------------------------
 C_SdSearchTreeWidget::C_SdSearchTreeWidget(QWidget * const opc_Parent) :
-   C_OgeTreeWidgetToolBarSearch(opc_Parent)
+   C_OgeTreeWidgetToolBarSearch(opc_Parent),
+   mu32_NextPendingResult(0U)
 {
    QPixmap c_Pixmap;
 
@@ -109,6 +113,10 @@ C_SdSearchTreeWidget::C_SdSearchTreeWidget(QWidget * const opc_Parent) :
    this->mc_IconHalcInputChannel.addPixmap(c_Pixmap);
 
    connect(this, &QTreeWidget::itemClicked, this, &C_SdSearchTreeWidget::m_ItemClicked);
+
+   this->mc_FillTimer.setSingleShot(true);
+   this->mc_FillTimer.setInterval(0);
+   connect(&this->mc_FillTimer, &QTimer::timeout, this, &C_SdSearchTreeWidget::m_FillNextResults);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -191,6 +199,10 @@ bool C_SdSearchTreeWidget::Search(const QString & orc_SearchString)
 //----------------------------------------------------------------------------------------------------------------------
 void C_SdSearchTreeWidget::ClearResult(void)
 {
+   this->mc_FillTimer.stop();
+   this->mc_PendingResults.clear();
+   this->mu32_NextPendingResult = 0U;
+
    this->clear();
 
    m_SetupStartingState();
@@ -307,275 +319,217 @@ void C_SdSearchTreeWidget::focusOutEvent(QFocusEvent * const opc_Event)
    C_OgeTreeWidgetToolBarSearch::focusOutEvent(opc_Event);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Search the index and show the first results
+
+   The result counters are known immediately, the remaining result items are added in batches
+   so the GUI stays responsive for search strings matching a large part of the system definition.
+*/
 //----------------------------------------------------------------------------------------------------------------------
 void C_SdSearchTreeWidget::m_StartSearch(void)
 {
-   const std::vector<C_OscNode> & rc_Nodes = C_PuiSdHandler::h_GetInstance()->GetOscSystemDefinitionConst().c_Nodes;
-   const std::vector<C_OscSystemBus> & rc_Busses =
-      C_PuiSdHandler::h_GetInstance()->GetOscSystemDefinitionConst().c_Buses;
    uint32_t u32_Counter;
 
-   // search nodes and the content of nodes
-   for (u32_Counter = 0U; u32_Counter < rc_Nodes.size(); ++u32_Counter)
-   {
-      this->m_SearchNodeContent(rc_Nodes[u32_Counter], u32_Counter);
-   }
+   this->mc_SearchIndex.Search(this->mc_SearchString, this->mc_PendingResults);
+   this->mu32_NextPendingResult = 0U;
 
-   // search busses and the content of busses
-   for (u32_Counter = 0U; u32_Counter < rc_Busses.size(); ++u32_Counter)
+   for (u32_Counter = 0U; u32_Counter < this->mc_PendingResults.size(); ++u32_Counter)
    {
-      this->m_SearchBusContent(rc_Busses[u32_Counter], u32_Counter);
+      switch (this->mc_PendingResults[u32_Counter].e_Type)
+      {
+      case C_SdSearchIndex::eNODE:
+         ++this->mu32_NodesFound;
+         break;
+      case C_SdSearchIndex::eBUS:
+         ++this->mu32_BussesFound;
+         break;
+      case C_SdSearchIndex::eDATAPOOL:
+         ++this->mu32_DataPoolsFound;
+         break;
+      case C_SdSearchIndex::eLIST:
+         ++this->mu32_ListsFound;
+         break;
+      case C_SdSearchIndex::eMESSAGE:
+         ++this->mu32_MessagesFound;
+         break;
+      case C_SdSearchIndex::eDATA_ELEMENT:
+         ++this->mu32_DataElementsFound;
+         break;
+      case C_SdSearchIndex::eAPPLICATION:
+         ++this->mu32_ApplicationsFound;
+         break;
+      case C_SdSearchIndex::eHALC_CHANNEL:
+         ++this->mu32_HalcChannelsFound;
+         break;
+      default:
+         tgl_assert(false);
+         break;
+      }
    }
+
+   this->m_FillNextResults();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-void C_SdSearchTreeWidget::m_SearchNodeContent(const C_OscNode & orc_Node, const uint32_t ou32_NodeIndex)
-{
-   uint32_t u32_Counter;
-   QString c_Name;
-   QString c_DataBlockName;
+/*! \brief   Add the next batch of pending results to the tree
 
-   c_Name = orc_Node.c_Properties.c_Name.c_str();
-
-   if (c_Name.contains(this->mc_SearchString, Qt::CaseInsensitive) == true)
-   {
-      this->m_AddNodeResult(c_Name, ou32_NodeIndex, orc_Node.pc_DeviceDefinition->c_DeviceName.c_str());
-   }
+   Restarts the fill timer as long as results are pending.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdSearchTreeWidget::m_FillNextResults(void)
+{
+   const uint32_t u32_End = std::min(static_cast<uint32_t>(this->mc_PendingResults.size()),
+                                     this->mu32_NextPendingResult + mhu32_RESULT_BATCH_SIZE);
 
-   // search datapools and the content of the datapools
-   for (u32_Counter = 0U; u32_Counter < orc_Node.c_DataPools.size(); ++u32_Counter)
+   for (; this->mu32_NextPendingResult < u32_End; ++this->mu32_NextPendingResult)
    {
-      this->m_SearchDataPoolContent(orc_Node.c_DataPools[u32_Counter], u32_Counter, c_Name, ou32_NodeIndex);
+      this->m_AddResult(this->mc_PendingResults[this->mu32_NextPendingResult]);
    }
 
-   // search CAN protocol content
-   for (u32_Counter = 0U; u32_Counter < orc_Node.c_ComProtocols.size(); ++u32_Counter)
+   if (this->mu32_NextPendingResult < this->mc_PendingResults.size())
    {
-      this->m_SearchCanProtocolContent(orc_Node.c_ComProtocols[u32_Counter], c_Name, ou32_NodeIndex);
+      this->mc_FillTimer.start();
    }
-
-   // search data block / application content
-   for (u32_Counter = 0U; u32_Counter < orc_Node.c_Applications.size(); ++u32_Counter)
+   else
    {
-      c_DataBlockName = orc_Node.c_Applications[u32_Counter].c_Name.c_str();
-
-      if (c_DataBlockName.contains(this->mc_SearchString, Qt::CaseInsensitive) == true)
-      {
-         this->m_AddApplicationResult(c_DataBlockName, u32_Counter, c_Name, ou32_NodeIndex);
-      }
+      this->mc_PendingResults.clear();
    }
-
-   // search HALC elements
-   this->m_SearchHalcConfigurationContent(orc_Node.c_HalcConfig, c_Name, ou32_NodeIndex);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-void C_SdSearchTreeWidget::m_SearchDataPoolContent(const C_OscNodeDataPool & orc_DataPool,
-                                                   const uint32_t ou32_DataPoolIndex, const QString & orc_NodeName,
-                                                   const uint32_t ou32_NodeIndex)
-{
-   uint32_t u32_ListCounter;
-   uint32_t u32_DataElementCounter;
-   QString c_DataPoolName;
-   QString c_ListName;
-   QString c_DataElementName;
-
-   c_DataPoolName = orc_DataPool.c_Name.c_str();
+/*! \brief   Add tree item for one search result
 
-   if (c_DataPoolName.contains(this->mc_SearchString, Qt::CaseInsensitive) == true)
-   {
-      this->m_AddDataPoolResult(c_DataPoolName, ou32_DataPoolIndex, orc_NodeName, ou32_NodeIndex);
-   }
-
-   // search datapool content
-   for (u32_ListCounter = 0U; u32_ListCounter < orc_DataPool.c_Lists.size(); ++u32_ListCounter)
+   \param[in]  orc_Result  Search result
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdSearchTreeWidget::m_AddResult(const C_SdSearchIndex::C_Entry & orc_Result)
+{
+   if (orc_Result.e_Type == C_SdSearchIndex::eBUS)
    {
-      c_ListName = orc_DataPool.c_Lists[u32_ListCounter].c_Name.c_str();
+      const C_OscSystemBus * const pc_Bus = C_PuiSdHandler::h_GetInstance()->GetOscBus(orc_Result.u32_ParentIndex);
 
-      if (c_ListName.contains(this->mc_SearchString, Qt::CaseInsensitive) == true)
+      if (pc_Bus != NULL)
       {
-         this->m_AddListResult(c_ListName, u32_ListCounter, c_DataPoolName, ou32_DataPoolIndex, orc_NodeName,
-                               ou32_NodeIndex);
+         this->m_AddBusResult(orc_Result.c_Name, orc_Result.u32_ParentIndex,
+                              pc_Bus->e_Type == C_OscSystemBus::eETHERNET);
       }
+   }
+   else
+   {
+      const C_OscNode * const pc_Node =
+         C_PuiSdHandler::h_GetInstance()->GetOscNodeConst(orc_Result.u32_ParentIndex);
 
-      // search list content
-      for (u32_DataElementCounter = 0U;
-           u32_DataElementCounter < orc_DataPool.c_Lists[u32_ListCounter].c_Elements.size();
-           ++u32_DataElementCounter)
+      if (pc_Node != NULL)
       {
-         c_DataElementName =
-            orc_DataPool.c_Lists[u32_ListCounter].c_Elements[u32_DataElementCounter].c_Name.c_str();
-
-         if (c_DataElementName.contains(this->mc_SearchString, Qt::CaseInsensitive) == true)
+         const QString c_NodeName = pc_Node->c_Properties.c_Name.c_str();
+         const C_OscNodeDataPool * pc_DataPool = NULL;
+         const C_OscNodeDataPoolList * pc_List = NULL;
+
+         if ((orc_Result.e_Type == C_SdSearchIndex::eDATAPOOL) ||
+             (orc_Result.e_Type == C_SdSearchIndex::eLIST) ||
+             (orc_Result.e_Type == C_SdSearchIndex::eDATA_ELEMENT) ||
+             (orc_Result.e_Type == C_SdSearchIndex::eMESSAGE))
          {
-            uint8_t u8_Type = mhu8_DATAELEMENT_TYPE_VARIABLE;
-
-            switch (orc_DataPool.e_Type)
+            if (orc_Result.au32_Indices[0] < pc_Node->c_DataPools.size())
             {
-            case C_OscNodeDataPool::eDIAG:
-               u8_Type = mhu8_DATAELEMENT_TYPE_VARIABLE;
-               break;
-            case C_OscNodeDataPool::eNVM:
-               u8_Type = mhu8_DATAELEMENT_TYPE_PARAMETER;
-               break;
-            case C_OscNodeDataPool::eCOM:
-               u8_Type = mhu8_DATAELEMENT_TYPE_SIGNAL;
-               break;
-            case C_OscNodeDataPool::eHALC:
-            case C_OscNodeDataPool::eHALC_NVM:
-               u8_Type = mhu8_DATAELEMENT_TYPE_HALC;
-               break;
-            default:
-               tgl_assert(false);
-               break;
+               pc_DataPool = &pc_Node->c_DataPools[orc_Result.au32_Indices[0]];
+               if (orc_Result.au32_Indices[1] < pc_DataPool->c_Lists.size())
+               {
+                  pc_List = &pc_DataPool->c_Lists[orc_Result.au32_Indices[1]];
+               }
             }
-
-            this->m_AddDataElementsResult(c_DataElementName, u32_DataElementCounter, c_ListName, u32_ListCounter,
-                                          c_DataPoolName, ou32_DataPoolIndex, orc_NodeName, ou32_NodeIndex, u8_Type);
          }
-      }
-   }
-}
 
-//----------------------------------------------------------------------------------------------------------------------
-void C_SdSearchTreeWidget::m_SearchCanProtocolContent(const C_OscCanProtocol & orc_CanProtocol,
-                                                      const QString & orc_NodeName, const uint32_t ou32_NodeIndex)
-{
-   QString c_MessageName;
-   const QString c_ProtocolName = C_PuiSdUtil::h_ConvertProtocolTypeToString(orc_CanProtocol.e_Type);
-   const C_OscNodeDataPool * const pc_DataPool = C_PuiSdHandler::h_GetInstance()->GetOscDataPool(
-      ou32_NodeIndex, orc_CanProtocol.u32_DataPoolIndex);
-
-   if (pc_DataPool != NULL)
-   {
-      uint32_t u32_MessageContainerCounter;
-      // Search CAN messages
-      for (u32_MessageContainerCounter = 0U;
-           u32_MessageContainerCounter < orc_CanProtocol.c_ComMessages.size();
-           ++u32_MessageContainerCounter)
-      {
-         const std::vector<C_OscCanMessage> & rc_TxMessages =
-            orc_CanProtocol.c_ComMessages[u32_MessageContainerCounter].c_TxMessages;
-         const std::vector<C_OscCanMessage> & rc_RxMessages =
-            orc_CanProtocol.c_ComMessages[u32_MessageContainerCounter].c_RxMessages;
-         const int32_t s32_ListIndexTx =
-            C_OscCanProtocol::h_GetListIndex(*pc_DataPool, u32_MessageContainerCounter, true);
-         const int32_t s32_ListIndexRx =
-            C_OscCanProtocol::h_GetListIndex(*pc_DataPool, u32_MessageContainerCounter, false);
-         uint32_t u32_MessageCounter;
-
-         // search the Tx messages
-         for (u32_MessageCounter = 0U; u32_MessageCounter < rc_TxMessages.size(); ++u32_MessageCounter)
+         switch (orc_Result.e_Type)
          {
-            c_MessageName = rc_TxMessages[u32_MessageCounter].c_Name.c_str();
-
-            if (c_MessageName.contains(this->mc_SearchString, Qt::CaseInsensitive) == true)
+         case C_SdSearchIndex::eNODE:
+            if (pc_Node->pc_DeviceDefinition != NULL)
             {
-               this->m_AddMessageResult(c_MessageName, u32_MessageCounter, true, static_cast<uint32_t>(s32_ListIndexTx),
-                                        c_ProtocolName, orc_CanProtocol.u32_DataPoolIndex, orc_NodeName,
-                                        ou32_NodeIndex);
+               this->m_AddNodeResult(orc_Result.c_Name, orc_Result.u32_ParentIndex,
+                                     pc_Node->pc_DeviceDefinition->c_DeviceName.c_str());
             }
-         }
-
-         // search the Rx messages
-         for (u32_MessageCounter = 0U; u32_MessageCounter < rc_RxMessages.size(); ++u32_MessageCounter)
-         {
-            c_MessageName = rc_RxMessages[u32_MessageCounter].c_Name.c_str();
-
-            if (c_MessageName.contains(this->mc_SearchString, Qt::CaseInsensitive) == true)
+            break;
+         case C_SdSearchIndex::eDATAPOOL:
+            if (pc_DataPool != NULL)
             {
-               this->m_AddMessageResult(c_MessageName, u32_MessageCounter, false,
-                                        static_cast<uint32_t>(s32_ListIndexRx),
-                                        c_ProtocolName, orc_CanProtocol.u32_DataPoolIndex, orc_NodeName,
-                                        ou32_NodeIndex);
+               this->m_AddDataPoolResult(orc_Result.c_Name, orc_Result.au32_Indices[0], c_NodeName,
+                                         orc_Result.u32_ParentIndex);
             }
-         }
-      }
-   }
-}
-//----------------------------------------------------------------------------------------------------------------------
-/*! \brief  Searching in HALC configuration of node
-
-   \param[in]  orc_HalcConfig    HALC configuration for searching
-   \param[in]  orc_NodeName      Name of node
-   \param[in]  ou32_NodeIndex    Index of node
-*/
-//----------------------------------------------------------------------------------------------------------------------
-void C_SdSearchTreeWidget::m_SearchHalcConfigurationContent(const stw::opensyde_core::C_OscHalcConfig & orc_HalcConfig,
-                                                            const QString & orc_NodeName, const uint32_t ou32_NodeIndex)
-{
-   const uint32_t u32_DomainCount = orc_HalcConfig.GetDomainSize();
-   uint32_t u32_DomainCounter;
-
-   for (u32_DomainCounter = 0U; u32_DomainCounter < u32_DomainCount; ++u32_DomainCounter)
-   {
-      const C_OscHalcDefDomain * const pc_HalcDef = orc_HalcConfig.GetDomainDefDataConst(u32_DomainCounter);
-
-      if (pc_HalcDef != NULL)
-      {
-         QString c_DomainName;
-         c_DomainName = pc_HalcDef->c_Name.c_str();
-
-         if (pc_HalcDef->c_Channels.size() == 0)
-         {
-            // Handling domains without any channels
-            if (c_DomainName.contains(this->mc_SearchString, Qt::CaseInsensitive) == true)
+            break;
+         case C_SdSearchIndex::eLIST:
+            if (pc_List != NULL)
             {
-               this->m_AddHalcChannelResult(c_DomainName, u32_DomainCounter, "", 0U, false, orc_NodeName,
-                                            ou32_NodeIndex, pc_HalcDef->e_Category);
+               this->m_AddListResult(orc_Result.c_Name, orc_Result.au32_Indices[1], pc_DataPool->c_Name.c_str(),
+                                     orc_Result.au32_Indices[0], c_NodeName, orc_Result.u32_ParentIndex);
             }
-         }
-         else
-         {
-            // Handling domains with channels
-            // Search for domain name is not possible in this case
-            const C_OscHalcConfigDomain * const pc_HalcConf =
-               orc_HalcConfig.GetDomainConfigDataConst(u32_DomainCounter);
-
-            if (pc_HalcConf != NULL)
+            break;
+         case C_SdSearchIndex::eDATA_ELEMENT:
+            if (pc_List != NULL)
             {
-               uint32_t u32_ChannelCounter;
-               tgl_assert(pc_HalcDef->c_Channels.size() == pc_HalcConf->c_ChannelConfigs.size());
+               uint8_t u8_Type = mhu8_DATAELEMENT_TYPE_VARIABLE;
 
-               for (u32_ChannelCounter = 0U; u32_ChannelCounter < pc_HalcDef->c_Channels.size(); ++u32_ChannelCounter)
+               switch (pc_DataPool->e_Type)
                {
-                  const QString c_UserName = pc_HalcConf->c_ChannelConfigs[u32_ChannelCounter].c_Name.c_str();
-                  const QString c_DefName = pc_HalcDef->c_Channels[u32_ChannelCounter].c_Name.c_str();
+               case C_OscNodeDataPool::eDIAG:
+                  u8_Type = mhu8_DATAELEMENT_TYPE_VARIABLE;
+                  break;
+               case C_OscNodeDataPool::eNVM:
+                  u8_Type = mhu8_DATAELEMENT_TYPE_PARAMETER;
+                  break;
+               case C_OscNodeDataPool::eCOM:
+                  u8_Type = mhu8_DATAELEMENT_TYPE_SIGNAL;
+                  break;
+               case C_OscNodeDataPool::eHALC:
+               case C_OscNodeDataPool::eHALC_NVM:
+                  u8_Type = mhu8_DATAELEMENT_TYPE_HALC;
+                  break;
+               default:
+                  tgl_assert(false);
+                  break;
+               }
 
-                  if ((c_UserName.contains(this->mc_SearchString, Qt::CaseInsensitive) == true) ||
-                      (c_DefName.contains(this->mc_SearchString, Qt::CaseInsensitive) == true))
-                  {
-                     const QString c_ShownName = c_UserName + " (" + c_DefName + ")";
-                     this->m_AddHalcChannelResult(c_DomainName, u32_DomainCounter, c_ShownName, u32_ChannelCounter,
-                                                  true, orc_NodeName, ou32_NodeIndex, pc_HalcDef->e_Category);
-                  }
+               this->m_AddDataElementsResult(orc_Result.c_Name, orc_Result.au32_Indices[2], pc_List->c_Name.c_str(),
+                                             orc_Result.au32_Indices[1], pc_DataPool->c_Name.c_str(),
+                                             orc_Result.au32_Indices[0], c_NodeName, orc_Result.u32_ParentIndex,
+                                             u8_Type);
+            }
+            break;
+         case C_SdSearchIndex::eMESSAGE:
+            if ((pc_DataPool != NULL) && (orc_Result.au32_Indices[4] < pc_Node->c_ComProtocols.size()))
+            {
+               this->m_AddMessageResult(orc_Result.c_Name, orc_Result.au32_Indices[2],
+                                        orc_Result.au32_Indices[3] == 1U, orc_Result.au32_Indices[1],
+                                        C_PuiSdUtil::h_ConvertProtocolTypeToString(
+                                           pc_Node->c_ComProtocols[orc_Result.au32_Indices[4]].e_Type),
+                                        orc_Result.au32_Indices[0], c_NodeName, orc_Result.u32_ParentIndex);
+            }
+            break;
+         case C_SdSearchIndex::eAPPLICATION:
+            this->m_AddApplicationResult(orc_Result.c_Name, orc_Result.au32_Indices[0], c_NodeName,
+                                         orc_Result.u32_ParentIndex);
+            break;
+         case C_SdSearchIndex::eHALC_CHANNEL:
+            {
+               const C_OscHalcDefDomain * const pc_HalcDef =
+                  pc_Node->c_HalcConfig.GetDomainDefDataConst(orc_Result.au32_Indices[0]);
+               if (pc_HalcDef != NULL)
+               {
+                  const bool q_UseChannelIndex = (orc_Result.au32_Indices[2] == 1U);
+                  this->m_AddHalcChannelResult(pc_HalcDef->c_Name.c_str(), orc_Result.au32_Indices[0],
+                                               q_UseChannelIndex ? orc_Result.c_Name : QString(""),
+                                               orc_Result.au32_Indices[1], q_UseChannelIndex, c_NodeName,
+                                               orc_Result.u32_ParentIndex, pc_HalcDef->e_Category);
                }
             }
+            break;
+         case C_SdSearchIndex::eBUS:
+         default:
+            break;
          }
       }
    }
 }
 
-//----------------------------------------------------------------------------------------------------------------------
-void C_SdSearchTreeWidget::m_SearchBusContent(const C_OscSystemBus & orc_Bus, const uint32_t ou32_BusIndex)
-{
-   QString c_Name;
-
-   c_Name = orc_Bus.c_Name.c_str();
-
-   if (c_Name.contains(this->mc_SearchString, Qt::CaseInsensitive) == true)
-   {
-      if (orc_Bus.e_Type == C_OscSystemBus::eETHERNET)
-      {
-         this->m_AddBusResult(c_Name, ou32_BusIndex, true);
-      }
-      else
-      {
-         this->m_AddBusResult(c_Name, ou32_BusIndex, false);
-      }
-   }
-}
-
 //----------------------------------------------------------------------------------------------------------------------
 bool C_SdSearchTreeWidget::m_CheckWhereToJumpCan(const QTreeWidgetItem * const opc_Item,
                                                  uint32_t & oru32_InterfaceIndex) const
@@ -822,7 +776,6 @@ void C_SdSearchTreeWidget::m_AddNodeResult(const QString & orc_NodeName, const u
    pc_Item->setData(0, mhs32_DATAROLE_INDEX_1, static_cast<int32_t>(ou32_NodeIndex));
    pc_Item->setData(0, static_cast<int32_t>(Qt::DecorationRole), this->mc_IconNode);
 
-   ++this->mu32_NodesFound;
    this->mq_ResultsFound = true;
 
    mpc_TreeItemRootNodes->addChild(pc_Item);
@@ -854,7 +807,6 @@ void C_SdSearchTreeWidget::m_AddBusResult(const QString & orc_BusName, const uin
    }
    pc_Item->setData(0, mhs32_DATAROLE_INDEX_1, static_cast<int32_t>(ou32_BusIndex));
 
-   ++this->mu32_BussesFound;
    this->mq_ResultsFound = true;
 
    mpc_TreeItemRootBusses->addChild(pc_Item);
@@ -878,7 +830,6 @@ void C_SdSearchTreeWidget::m_AddDataPoolResult(const QString & orc_DataPoolName,
    pc_Item->setData(0, mhs32_DATAROLE_INDEX_2, static_cast<int32_t>(ou32_DataPoolIndex));
    pc_Item->setData(0, static_cast<int32_t>(Qt::DecorationRole), this->mc_IconDataPool);
 
-   ++this->mu32_DataPoolsFound;
    this->mq_ResultsFound = true;
 
    mpc_TreeItemRootDataPools->addChild(pc_Item);
@@ -904,7 +855,6 @@ void C_SdSearchTreeWidget::m_AddListResult(const QString & orc_ListName, const u
    pc_Item->setData(0, mhs32_DATAROLE_INDEX_3, static_cast<int32_t>(ou32_ListIndex));
    pc_Item->setData(0, static_cast<int32_t>(Qt::DecorationRole), this->mc_IconList);
 
-   ++this->mu32_ListsFound;
    this->mq_ResultsFound = true;
 
    mpc_TreeItemRootLists->addChild(pc_Item);
@@ -942,7 +892,6 @@ void C_SdSearchTreeWidget::m_AddMessageResult(const QString & orc_MessageName, c
    pc_Item->setData(0, mhs32_DATAROLE_INDEX_4, static_cast<int32_t>(ou32_MessageIndex));
    pc_Item->setData(0, static_cast<int32_t>(Qt::DecorationRole), this->mc_IconMessage);
 
-   ++this->mu32_MessagesFound;
    this->mq_ResultsFound = true;
 
    mpc_TreeItemRootMessages->addChild(pc_Item);
@@ -988,7 +937,6 @@ void C_SdSearchTreeWidget::m_AddDataElementsResult(const QString & orc_DataEleme
       pc_Item->setData(0, static_cast<int32_t>(Qt::DecorationRole), this->mc_IconVariable);
    }
 
-   ++this->mu32_DataElementsFound;
    this->mq_ResultsFound = true;
 
    mpc_TreeItemRootDataElements->addChild(pc_Item);
@@ -1013,7 +961,6 @@ void C_SdSearchTreeWidget::m_AddApplicationResult(const QString & orc_Applicatio
    pc_Item->setData(0, mhs32_DATAROLE_INDEX_2, static_cast<int32_t>(ou32_ApplicationIndex));
    pc_Item->setData(0, static_cast<int32_t>(Qt::DecorationRole), this->mc_IconApplication);
 
-   ++this->mu32_ApplicationsFound;
    this->mq_ResultsFound = true;
 
    mpc_TreeItemRootApplications->addChild(pc_Item);
@@ -1077,7 +1024,6 @@ void C_SdSearchTreeWidget::m_AddHalcChannelResult(const QString & orc_HalcDomain
       pc_Item->setData(0, static_cast<int32_t>(Qt::DecorationRole), this->mc_IconHalcChannel);
    }
 
-   ++this->mu32_HalcChannelsFound;
    this->mq_ResultsFound = true;
 
    mpc_TreeItemRootHalcChannels->addChild(pc_Item);
@@ -11,9 +11,13 @@
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 
+#include <vector>
+#include <QTimer>
+
 #include "C_OgeTreeWidgetToolBarSearch.hpp"
 #include "C_OscNode.hpp"
 #include "C_OscSystemBus.hpp"
+#include "C_SdSearchIndex.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 namespace stw
@@ -55,15 +59,8 @@ private:
    C_SdSearchTreeWidget & operator =(const C_SdSearchTreeWidget &) &;
 
    void m_StartSearch(void);
-   void m_SearchNodeContent(const stw::opensyde_core::C_OscNode & orc_Node, const uint32_t ou32_NodeIndex);
-   void m_SearchDataPoolContent(const stw::opensyde_core::C_OscNodeDataPool & orc_DataPool,
-                                const uint32_t ou32_DataPoolIndex, const QString & orc_NodeName,
-                                const uint32_t ou32_NodeIndex);
-   void m_SearchCanProtocolContent(const stw::opensyde_core::C_OscCanProtocol & orc_CanProtocol,
-                                   const QString & orc_NodeName, const uint32_t ou32_NodeIndex);
-   void m_SearchHalcConfigurationContent(const stw::opensyde_core::C_OscHalcConfig & orc_HalcConfig,
-                                         const QString & orc_NodeName, const uint32_t ou32_NodeIndex);
-   void m_SearchBusContent(const stw::opensyde_core::C_OscSystemBus & orc_Bus, const uint32_t ou32_BusIndex);
+   void m_FillNextResults(void);
+   void m_AddResult(const stw::opensyde_gui_logic::C_SdSearchIndex::C_Entry & orc_Result);
 
    bool m_CheckWhereToJumpCan(const QTreeWidgetItem * const opc_Item, uint32_t & oru32_InterfaceIndex) const;
    void m_ItemClicked(void);
@@ -109,6 +106,11 @@ private:
    uint32_t mu32_ApplicationsFound;
    uint32_t mu32_HalcChannelsFound;
 
+   stw::opensyde_gui_logic::C_SdSearchIndex mc_SearchIndex;
+   std::vector<stw::opensyde_gui_logic::C_SdSearchIndex::C_Entry> mc_PendingResults;
+   uint32_t mu32_NextPendingResult;
+   QTimer mc_FillTimer;
+
    QIcon mc_IconNode;
    QIcon mc_IconBusCan;
    QIcon mc_IconBusEthernet;
@@ -136,6 +138,8 @@ private:
    static const uint8_t mhu8_DATAELEMENT_TYPE_VARIABLE;
    static const uint8_t mhu8_DATAELEMENT_TYPE_SIGNAL;
    static const uint8_t mhu8_DATAELEMENT_TYPE_HALC;
+
+   static const uint32_t mhu32_RESULT_BATCH_SIZE;
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
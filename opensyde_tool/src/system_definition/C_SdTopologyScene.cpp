@@ -193,7 +193,7 @@ void C_SdTopologyScene::AddNode(const QString & orc_NodeType, const QPointF & or
       this->clearSelection();
 
       //UI
-      c_UiNode.f64_ZetOrder = this->GetHighestUsedZetValueList(this->items()) + 1.0;
+      c_UiNode.f64_ZetOrder = this->GetHighestUsedZetValue() + 1.0;
       if (u32_SubDevicesSize == 1UL)
       {
          stw::opensyde_core::C_OscNode c_OscNode;
@@ -417,7 +417,7 @@ void C_SdTopologyScene::AddBoundary(const QPointF & orc_Pos, const uint64_t * co
    c_BoundaryData.c_UiPosition = orc_Pos;
    c_BoundaryData.f64_Height = 100.0;
    c_BoundaryData.f64_Width = 100.0;
-   c_BoundaryData.f64_ZetOrder = this->GetHighestUsedZetValueList(this->items()) + 1.0;
+   c_BoundaryData.f64_ZetOrder = this->GetHighestUsedZetValue() + 1.0;
 
    C_PuiSdHandler::h_GetInstance()->c_Elements.c_Boundaries.push_back(c_BoundaryData);
 
@@ -463,7 +463,7 @@ void C_SdTopologyScene::AddTextElement(const QString & orc_Text, const QPointF &
    //Default
    c_TextElementData.c_UiText = orc_Text;
    c_TextElementData.c_UiPosition = orc_Pos;
-   c_TextElementData.f64_ZetOrder = this->GetHighestUsedZetValueList(this->items()) + 1.0;
+   c_TextElementData.f64_ZetOrder = this->GetHighestUsedZetValue() + 1.0;
 
    C_PuiSdHandler::h_GetInstance()->c_Elements.c_TextElements.push_back(c_TextElementData);
 
@@ -511,7 +511,7 @@ C_GiTextElementBus * C_SdTopologyScene::AddTextElementBus(const uint64_t * const
 
    s32_Index = static_cast<int32_t>(C_PuiSdHandler::h_GetInstance()->c_BusTextElements.size());
    //Get next free z value
-   orf64_BusZetValue = this->GetHighestUsedZetValueList(this->items()) + 2.0;
+   orf64_BusZetValue = this->GetHighestUsedZetValue() + 2.0;
    //Place text element under the bus
    c_Data.f64_ZetOrder = orf64_BusZetValue - 1.0;
    C_PuiSdHandler::h_GetInstance()->c_BusTextElements.push_back(c_Data);
@@ -553,7 +553,7 @@ void C_SdTopologyScene::AddLine(const QPointF & orc_Pos, const uint64_t * const
    s32_Index = static_cast<int32_t>(C_PuiSdHandler::h_GetInstance()->c_Elements.c_LineArrows.size());
 
    //Default c_LineArrowData
-   c_LineArrowData.f64_ZetOrder = this->GetHighestUsedZetValueList(this->items()) + 1.0;
+   c_LineArrowData.f64_ZetOrder = this->GetHighestUsedZetValue() + 1.0;
    c_LineArrowData.c_UiInteractionPoints.push_back(orc_Pos);
    c_LineArrowData.c_UiInteractionPoints.push_back(orc_Pos + QPointF(200.0, 0.0));
 
@@ -677,7 +677,7 @@ void C_SdTopologyScene::AddImage(const QString & orc_FilePath, const QPointF & o
    }
 
    //Default
-   c_ImageData.f64_ZetOrder = this->GetHighestUsedZetValueList(this->items()) + 1.0;
+   c_ImageData.f64_ZetOrder = this->GetHighestUsedZetValue() + 1.0;
 
    s32_Index = static_cast<int32_t>(C_PuiSdHandler::h_GetInstance()->c_Elements.c_Images.size());
    C_PuiSdHandler::h_GetInstance()->c_Elements.c_Images.push_back(c_ImageData);
@@ -733,7 +733,7 @@ void C_SdTopologyScene::CopyFromManagerToScene(const QPointF * const opc_Pos)
          c_UniqueIds[u32_ItItem] = m_GetNewUniqueId();
       }
       this->mc_UndoManager.DoAddSnapshot(c_UniqueIds, *pc_SnapShot, c_TotalOffset,
-                                         this->GetHighestUsedZetValueList(this->items()));
+                                         this->GetHighestUsedZetValue());
    }
    osc_write_log_performance_stop(u16_Timer, "System Defintion Scene Paste");
 }
@@ -921,6 +921,7 @@ void C_SdTopologyScene::DeleteItem(QGraphicsItem * const opc_Item)
          {
             pc_DataElement->DeleteData();
          }
+         this->m_UnregisterItem(pc_Item);
 
          // remove from scene TODO: investigate delete bug
          //this->removeItem(pc_Item);
@@ -1252,22 +1253,18 @@ void C_SdTopologyScene::mouseMoveEvent(QGraphicsSceneMouseEvent * const opc_Even
             {
                if (this->mpc_BusNameLine == NULL)
                {
-                  const QList<QGraphicsItem *> & rc_Items = this->items();
-                  QList<QGraphicsItem *>::const_iterator c_ItItem;
+                  QSet<C_GiLiBus *>::const_iterator c_ItBus;
 
                   // search the associated bus
                   this->mpc_BusNameLineBus = NULL;
 
-                  for (c_ItItem = rc_Items.begin(); c_ItItem != rc_Items.end(); ++c_ItItem)
+                  for (c_ItBus = this->mc_BusItems.begin(); c_ItBus != this->mc_BusItems.end(); ++c_ItBus)
                   {
-                     const C_GiLiBus * const pc_Bus = dynamic_cast<const C_GiLiBus * const>(*c_ItItem);
-                     if (pc_Bus != NULL)
+                     const C_GiLiBus * const pc_Bus = *c_ItBus;
+                     if (static_cast<int32_t>(pc_BusName->GetBusIndex()) == pc_Bus->GetIndex())
                      {
-                        if (static_cast<int32_t>(pc_BusName->GetBusIndex()) == pc_Bus->GetIndex())
-                        {
-                           this->mpc_BusNameLineBus = pc_Bus;
-                           break;
-                        }
+                        this->mpc_BusNameLineBus = pc_Bus;
+                        break;
                      }
                   }
 
@@ -1872,6 +1869,41 @@ void C_SdTopologyScene::m_AddTextElementToScene(C_GiBiTextElement * const opc_It
    C_SebTopologyBaseScene::m_AddTextElementToScene(opc_Item);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Register new item in item registries
+
+   Keeps nodes, buses, bus connectors and data elements available without scanning all scene items.
+
+   \param[in,out]  opc_Item   New item
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdTopologyScene::m_RegisterItem(QGraphicsItem * const opc_Item)
+{
+   C_PuiSdDataElement * const pc_DataElement = dynamic_cast<C_PuiSdDataElement *>(opc_Item);
+   C_GiNode * const pc_Node = dynamic_cast<C_GiNode *>(opc_Item);
+   C_GiLiBus * const pc_Bus = dynamic_cast<C_GiLiBus *>(opc_Item);
+   C_GiLiBusConnector * const pc_BusConnector = dynamic_cast<C_GiLiBusConnector *>(opc_Item);
+
+   C_SebTopologyBaseScene::m_RegisterItem(opc_Item);
+
+   if (pc_DataElement != NULL)
+   {
+      this->mc_DataElementItems.insert(pc_DataElement);
+   }
+   if (pc_Node != NULL)
+   {
+      this->mc_NodeItems.insert(pc_Node);
+   }
+   if (pc_Bus != NULL)
+   {
+      this->mc_BusItems.insert(pc_Bus);
+   }
+   if (pc_BusConnector != NULL)
+   {
+      this->mc_BusConnectorItems.insert(pc_BusConnector);
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Handle after resize action
 
@@ -2175,7 +2207,8 @@ void C_SdTopologyScene::m_SelectionChanged(void)
             this->mpc_SelectedBusConnectorItem = dynamic_cast<C_GiLiBusConnector *>(c_SelectedItems[0]);
             if (this->mpc_SelectedBusConnectorItem != NULL)
             {
-               this->mpc_SelectedBusConnectorItem->setZValue(this->GetHighestUsedZetValueList(this->items()) + 1.0);
+               this->mpc_SelectedBusConnectorItem->setZValue(this->GetHighestUsedZetValue() + 1.0);
+               this->RegisterZetValue(this->mpc_SelectedBusConnectorItem);
             }
          }
       }
@@ -2331,17 +2364,13 @@ void C_SdTopologyScene::m_Edit(const QGraphicsItem * const opc_Item, const bool
 //----------------------------------------------------------------------------------------------------------------------
 void C_SdTopologyScene::UpdateSystemDefinition(void) const
 {
-   QList<QGraphicsItem *> c_Items = this->items();
+   const QSet<C_PuiSdDataElement *> c_DataElements = this->mc_DataElementItems;
+
    //Fill
-   for (QList<QGraphicsItem *>::iterator c_ItItem = c_Items.begin(); c_ItItem != c_Items.end();
-        ++c_ItItem)
+   for (QSet<C_PuiSdDataElement *>::const_iterator c_ItItem = c_DataElements.begin();
+        c_ItItem != c_DataElements.end(); ++c_ItItem)
    {
-      //Node
-      C_PuiSdDataElement * const pc_DataElement = dynamic_cast<C_PuiSdDataElement *>(*c_ItItem);
-      if (pc_DataElement != NULL)
-      {
-         pc_DataElement->UpdateData();
-      }
+      (*c_ItItem)->UpdateData();
    }
 }
 
@@ -2370,27 +2399,13 @@ void C_SdTopologyScene::m_SyncIndex(const stw::opensyde_gui_logic::C_PuiSdDataEl
                                     const int32_t & ors32_Index,
                                     const stw::opensyde_gui_logic::C_PuiSdDataElement::E_Action & ore_Action) const
 {
-   C_PuiSdDataElement * pc_DataElement;
-
-   QList<QGraphicsItem *> c_Items = this->items();
+   const QSet<C_PuiSdDataElement *> c_DataElements = this->mc_DataElementItems;
 
    //Fill
-   for (QList<QGraphicsItem *>::iterator c_ItItem = c_Items.begin(); c_ItItem != c_Items.end();
-        ++c_ItItem)
+   for (QSet<C_PuiSdDataElement *>::const_iterator c_ItItem = c_DataElements.begin();
+        c_ItItem != c_DataElements.end(); ++c_ItItem)
    {
-      //Node
-      try
-      {
-         pc_DataElement = dynamic_cast<C_PuiSdDataElement *>(*c_ItItem);
-         if (pc_DataElement != NULL)
-         {
-            pc_DataElement->SyncIndex(ore_Type, ors32_Index, ore_Action);
-         }
-      }
-      catch (...)
-      {
-         //Cast failed
-      }
+      (*c_ItItem)->SyncIndex(ore_Type, ors32_Index, ore_Action);
    }
 }
 
@@ -2455,6 +2470,37 @@ void C_SdTopologyScene::m_ChangeInterface(const uint8_t & oru8_InterfaceNumber,
    }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Remove deleted item from item registries
+
+   \param[in]  opc_Item   Deleted item
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdTopologyScene::m_UnregisterItem(QGraphicsItem * const opc_Item)
+{
+   C_PuiSdDataElement * const pc_DataElement = dynamic_cast<C_PuiSdDataElement *>(opc_Item);
+   C_GiNode * const pc_Node = dynamic_cast<C_GiNode *>(opc_Item);
+   C_GiLiBus * const pc_Bus = dynamic_cast<C_GiLiBus *>(opc_Item);
+   C_GiLiBusConnector * const pc_BusConnector = dynamic_cast<C_GiLiBusConnector *>(opc_Item);
+
+   if (pc_DataElement != NULL)
+   {
+      this->mc_DataElementItems.remove(pc_DataElement);
+   }
+   if (pc_Node != NULL)
+   {
+      this->mc_NodeItems.remove(pc_Node);
+   }
+   if (pc_Bus != NULL)
+   {
+      this->mc_BusItems.remove(pc_Bus);
+   }
+   if (pc_BusConnector != NULL)
+   {
+      this->mc_BusConnectorItems.remove(pc_BusConnector);
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Restore default ToolTips for all items
 */
@@ -2524,22 +2570,18 @@ void C_SdTopologyScene::m_RemoveNodeOfScene(const C_GiNode * const opc_NodeGraph
 //----------------------------------------------------------------------------------------------------------------------
 void C_SdTopologyScene::m_RemoveBusOfScene(const C_GiLiBus * const opc_BusGraphicsItem)
 {
-   QList<QGraphicsItem *> c_Items = this->items();
+   const QSet<C_GiLiBus *> c_Buses = this->mc_BusItems;
+
    disconnect(opc_BusGraphicsItem, &C_GiLiBus::SigHideToolTip, this,
               &C_SdTopologyScene::m_HandleHideToolTip);
    m_RemoveLineGroupOfScene(opc_BusGraphicsItem);
 
    this->m_SyncIndex(C_PuiSdDataElement::eBUS, opc_BusGraphicsItem->GetIndex(), C_PuiSdDataElement::eDELETE);
    //Fill
-   for (QList<QGraphicsItem *>::iterator c_ItItem = c_Items.begin(); c_ItItem != c_Items.end(); ++c_ItItem)
+   for (QSet<C_GiLiBus *>::const_iterator c_ItBus = c_Buses.begin(); c_ItBus != c_Buses.end(); ++c_ItBus)
    {
       // update all other busses and its bus text elements because of the possible new bus index
-
-      C_GiLiBus * const pc_Bus = dynamic_cast<C_GiLiBus *>(*c_ItItem);
-      if (pc_Bus != NULL)
-      {
-         pc_Bus->UpdateData();
-      }
+      (*c_ItBus)->UpdateData();
    }
 }
 
@@ -2908,28 +2950,21 @@ void C_SdTopologyScene::m_LeaveConnectState(void)
    //lint -e{948,774,506} Variable necessary to deactivate feature until finished
    if (C_SdTopologyScene::mhq_NEW_CONNECT_STATE == true)
    {
-      const QList<QGraphicsItem *> c_Items = this->items();
       //Reenable all nodes and busses
-      for (QList<QGraphicsItem *>::const_iterator c_It = c_Items.begin(); c_It != c_Items.end(); ++c_It)
+      for (QSet<C_GiNode *>::const_iterator c_ItNode = this->mc_NodeItems.begin();
+           c_ItNode != this->mc_NodeItems.end(); ++c_ItNode)
       {
-         C_GiNode * const pc_Node = dynamic_cast<C_GiNode * const>(*c_It);
-
-         C_GiLiBus * const pc_Bus = dynamic_cast<C_GiLiBus * const>(*c_It);
-
-         C_GiLiBusConnector * const pc_BusConnector =
-            dynamic_cast<C_GiLiBusConnector * const>(C_SebUtil::h_GetHighestParent(*c_It));
-         if (pc_Node != NULL)
-         {
-            pc_Node->SetDrawWhiteFilter(false);
-         }
-         if (pc_Bus != NULL)
-         {
-            pc_Bus->SetDisabledLook(false);
-         }
-         if (pc_BusConnector != NULL)
-         {
-            pc_BusConnector->SetDisabledLook(false);
-         }
+         (*c_ItNode)->SetDrawWhiteFilter(false);
+      }
+      for (QSet<C_GiLiBus *>::const_iterator c_ItBus = this->mc_BusItems.begin();
+           c_ItBus != this->mc_BusItems.end(); ++c_ItBus)
+      {
+         (*c_ItBus)->SetDisabledLook(false);
+      }
+      for (QSet<C_GiLiBusConnector *>::const_iterator c_ItBusConnector = this->mc_BusConnectorItems.begin();
+           c_ItBusConnector != this->mc_BusConnectorItems.end(); ++c_ItBusConnector)
+      {
+         (*c_ItBusConnector)->SetDisabledLook(false);
       }
    }
 }
@@ -2957,30 +2992,25 @@ void C_SdTopologyScene::m_DisableEverythingForConnectState(const C_GiNode * cons
    //lint -e{948,774,506} Variable necessary to deactivate feature until finished
    if (C_SdTopologyScene::mhq_NEW_CONNECT_STATE == true)
    {
-      const QList<QGraphicsItem *> c_Items = this->items();
-
       //Disable all nodes and busses
-      for (QList<QGraphicsItem *>::const_iterator c_It = c_Items.begin(); c_It != c_Items.end(); ++c_It)
+      for (QSet<C_GiNode *>::const_iterator c_ItNode = this->mc_NodeItems.begin();
+           c_ItNode != this->mc_NodeItems.end(); ++c_ItNode)
       {
-         C_GiNode * const pc_Node = dynamic_cast<C_GiNode * const>(*c_It);
-
-         C_GiLiBus * const pc_Bus = dynamic_cast<C_GiLiBus * const>(*c_It);
-
-         C_GiLiBusConnector * const pc_BusConnector =
-            dynamic_cast<C_GiLiBusConnector * const>(C_SebUtil::h_GetHighestParent(*c_It));
-         if ((pc_Node != NULL) && (pc_Node != opc_Node))
+         if ((*c_ItNode) != opc_Node)
          {
-            pc_Node->SetDrawWhiteFilter(true);
-         }
-         if (pc_Bus != NULL)
-         {
-            pc_Bus->SetDisabledLook(true);
-         }
-         if (pc_BusConnector != NULL)
-         {
-            pc_BusConnector->SetDisabledLook(true);
+            (*c_ItNode)->SetDrawWhiteFilter(true);
          }
       }
+      for (QSet<C_GiLiBus *>::const_iterator c_ItBus = this->mc_BusItems.begin();
+           c_ItBus != this->mc_BusItems.end(); ++c_ItBus)
+      {
+         (*c_ItBus)->SetDisabledLook(true);
+      }
+      for (QSet<C_GiLiBusConnector *>::const_iterator c_ItBusConnector = this->mc_BusConnectorItems.begin();
+           c_ItBusConnector != this->mc_BusConnectorItems.end(); ++c_ItBusConnector)
+      {
+         (*c_ItBusConnector)->SetDisabledLook(true);
+      }
    }
 }
 
@@ -3194,26 +3224,22 @@ void C_SdTopologyScene::m_ShowNewNodeToNodeConnectionPopUp(const C_GiNode * cons
                uint64_t u64_UniqueBusId = 0;
                std::vector<C_PuiSdNodeInterfaceAutomaticProperties> c_Properties;
                const QPointF c_Node1Center = opc_Node1->sceneBoundingRect().center();
-               QList<QGraphicsItem *>::const_iterator c_ItItem;
-               const QList<QGraphicsItem *> & rc_Items = this->items();
+               QSet<C_GiLiBus *>::const_iterator c_ItBus;
 
                //2 unique ids
                c_Ids.push_back(this->m_GetNewUniqueId());
                c_Ids.push_back(this->m_GetNewUniqueId());
 
                //Map data index to unique index
-               for (c_ItItem = rc_Items.begin(); c_ItItem != rc_Items.end(); ++c_ItItem)
+               for (c_ItBus = this->mc_BusItems.begin(); c_ItBus != this->mc_BusItems.end(); ++c_ItBus)
                {
-                  C_GiLiBus * const pc_Item = dynamic_cast<C_GiLiBus * const>(C_SebUtil::h_GetHighestParent(*c_ItItem));
+                  const C_GiLiBus * const pc_Item = *c_ItBus;
 
-                  if (pc_Item != NULL)
+                  if (pc_Item->GetIndex() >= 0)
                   {
-                     if (pc_Item->GetIndex() >= 0)
+                     if (static_cast<uint32_t>(pc_Item->GetIndex()) == u32_BusDataIndex)
                      {
-                        if (static_cast<uint32_t>(pc_Item->GetIndex()) == u32_BusDataIndex)
-                        {
-                           u64_UniqueBusId = pc_Item->GetId();
-                        }
+                        u64_UniqueBusId = pc_Item->GetId();
                      }
                   }
                }
@@ -3641,27 +3667,11 @@ void C_SdTopologyScene::m_ShowBusConnectorReconnectionContextMenu(const QPointF
 //----------------------------------------------------------------------------------------------------------------------
 void C_SdTopologyScene::m_CleanUpPorts(void) const
 {
-   C_GiNode * pc_Node;
-
-   QList<QGraphicsItem *> c_Items = this->items();
-
    //Fill
-   for (QList<QGraphicsItem *>::iterator c_ItItem = c_Items.begin(); c_ItItem != c_Items.end();
-        ++c_ItItem)
+   for (QSet<C_GiNode *>::const_iterator c_ItNode = this->mc_NodeItems.begin(); c_ItNode != this->mc_NodeItems.end();
+        ++c_ItNode)
    {
-      //Node
-      try
-      {
-         pc_Node = dynamic_cast<C_GiNode *>(C_SebUtil::h_GetHighestParent(*c_ItItem));
-         if (pc_Node != NULL)
-         {
-            pc_Node->ReevaluatePortState();
-         }
-      }
-      catch (...)
-      {
-         //Cast failed
-      }
+      (*c_ItNode)->ReevaluatePortState();
    }
 }
 
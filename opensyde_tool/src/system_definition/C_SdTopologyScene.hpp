@@ -12,6 +12,7 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include <QMimeData>
 #include <QMap>
+#include <QSet>
 #include <QTransform>
 
 #include "stwtypes.hpp"
@@ -143,6 +144,7 @@ protected:
    void m_AddNodeToScene(C_GiNode * const opc_NodeGraphicsItem) override;
    void m_AddBusConnectorToScene(C_GiLiBusConnector * const opc_BusConnectorGraphicsItem) override;
    void m_AddTextElementToScene(C_GiBiTextElement * const opc_Item) override;
+   void m_RegisterItem(QGraphicsItem * const opc_Item) override;
    //Move
    void m_HandleRevertableResizeLine(const int32_t & ors32_InteractionPointIndex,
                                      const QPointF & orc_PositionDifference) override;
@@ -179,6 +181,7 @@ private:
    void m_ChangeInterface(const uint8_t & oru8_InterfaceNumber,
                           const std::vector<stw::opensyde_gui_logic::C_PuiSdNodeInterfaceAutomaticProperties> & orc_Properties, C_GiLiBusConnector * const opc_Connector);
    void m_RestoreToolTips(void) const;
+   void m_UnregisterItem(QGraphicsItem * const opc_Item);
    void m_RemoveNodeOfScene(const C_GiNode * const opc_NodeGraphicsItem);
    void m_RemoveBusOfScene(const C_GiLiBus * const opc_BusGraphicsItem);
    void m_RemoveBusConnectorOfScene(C_GiLiBusConnector * const opc_BusConnectorGraphicsItem);
@@ -274,6 +277,10 @@ private:
    C_GiLiBusConnector * mpc_SelectedBusConnectorItem;
    bool mq_RestoreMouseCursorWhenPossible;
    uint64_t mu64_MouseOverrideCounter;
+   QSet<C_GiNode *> mc_NodeItems;                                           ///< All nodes of scene
+   QSet<C_GiLiBus *> mc_BusItems;                                           ///< All buses of scene
+   QSet<C_GiLiBusConnector *> mc_BusConnectorItems;                         ///< All bus connectors of scene
+   QSet<stw::opensyde_gui_logic::C_PuiSdDataElement *> mc_DataElementItems; ///< All items with system definition data
    static const bool mhq_NEW_CONNECT_STATE;
 };
 
@@ -489,7 +489,7 @@ C_SebUnoSetupStyleCommand * C_SdManUnoTopologyManager::m_GetNewStyleCommand(cons
 void C_SdManUnoTopologyManager::m_MergeWithPrev(QUndoCommand * const opc_Command)
 {
    const int32_t s32_LastIndex = static_cast<int32_t>(this->count()) - 1L;
-   const QUndoCommand * const opc_LastCommand = this->command(s32_LastIndex);
+   const QUndoCommand * const opc_LastCommand = this->GetCommand(s32_LastIndex);
 
    if (opc_LastCommand != NULL)
    {
@@ -516,7 +516,7 @@ void C_SdManUnoTopologyManager::m_OnErrorChange(void)
 void C_SdManUnoTopologyManager::m_DoPushAndSignalError(QUndoCommand * const opc_UndoCommand)
 {
    this->m_PrepareAction();
-   this->push(opc_UndoCommand);
+   this->m_Push(opc_UndoCommand);
    Q_EMIT this->SigErrorChanged();
    this->m_CleanupAction();
 }
@@ -63,22 +63,22 @@ int32_t C_SdNdeDpImportRamView::h_ImportDataPoolFromRamViewDefProject(const C_Sc
       orc_GuiDataPool.c_DataPoolLists.resize(orc_DataPool.c_Lists.size());
       for (uint32_t u32_List = 0U; u32_List < orc_DataPool.c_Lists.size(); u32_List++)
       {
-         const uint32_t u32_NumElements = orc_DataPool.c_Lists[u32_List].c_Elements.size();
+         C_OscNodeDataPoolList & rc_List = orc_DataPool.c_Lists[u32_List];
+         C_PuiSdNodeDataPoolList & rc_GuiList = orc_GuiDataPool.c_DataPoolLists[u32_List];
+         const uint32_t u32_NumElements = rc_List.c_Elements.size();
 
-         orc_GuiDataPool.c_DataPoolLists[u32_List].c_DataPoolListElements.resize(u32_NumElements);
+         rc_GuiList.c_DataPoolListElements.resize(u32_NumElements);
 
          for (uint32_t u32_Element = 0U; u32_Element < u32_NumElements; u32_Element++)
          {
-            C_OscNodeDataPoolListElement & rc_Element = orc_DataPool.c_Lists[u32_List].c_Elements[u32_Element];
-            C_SclString c_Comment;
+            C_OscNodeDataPoolListElement & rc_Element = rc_List.c_Elements[u32_Element];
+            C_PuiSdNodeDataPoolListElement & rc_GuiElement = rc_GuiList.c_DataPoolListElements[u32_Element];
 
             //Set GUI-only properties:
             //RAMView projects have a clear logic: arrays of sint8 are generally interpreted as strings
-            orc_GuiDataPool.c_DataPoolLists[u32_List].c_DataPoolListElements[u32_Element].q_AutoMinMaxActive = false;
-            orc_GuiDataPool.c_DataPoolLists[u32_List].c_DataPoolListElements[u32_Element].q_InterpretAsString =
-               ((orc_DataPool.c_Lists[u32_List].c_Elements[u32_Element].GetType() ==
-                 C_OscNodeDataPoolContent::eSINT8) &&
-                (orc_DataPool.c_Lists[u32_List].c_Elements[u32_Element].GetArray() == true));
+            rc_GuiElement.q_AutoMinMaxActive = false;
+            rc_GuiElement.q_InterpretAsString =
+               ((rc_Element.GetType() == C_OscNodeDataPoolContent::eSINT8) && (rc_Element.GetArray() == true));
 
             //Try to cope with non-ASCII characters in variable comments as good as possible
             //RAMView projects are basically stored in single-byte ASCII format.
@@ -86,35 +86,64 @@ int32_t C_SdNdeDpImportRamView::h_ImportDataPoolFromRamViewDefProject(const C_Sc
             //Knowing that RAMView did not allow to save Unicode strings a good guess could be that it's a latin
             // extended ASCII encoding. So for many cases (e.g. most common European special characters)
             // storing the byte value as UTF8 will have the expected results in openSYDE.
-            //Approach taken does not have high performance. But this is not considered an issue as importing typically
-            // is a single shot procedure.
-            for (uint32_t u32_Character = 0; u32_Character < rc_Element.c_Comment.Length(); u32_Character++)
+            //Comments are only rebuilt if they contain such characters; plain ASCII comments are kept as they are.
+            if (mh_ContainsNonAsciiCharacter(rc_Element.c_Comment) == true)
             {
-               const uint8_t u8_CharacterValue = static_cast<uint8_t>(rc_Element.c_Comment.c_str()[u32_Character]);
-               if (u8_CharacterValue > 127U)
+               C_SclString c_Comment;
+               for (uint32_t u32_Character = 0; u32_Character < rc_Element.c_Comment.Length(); u32_Character++)
                {
-                  //Convert to UTF8 encoding:
-                  //We could have values from 0x80 to 0xFF.
-                  //This will result in two bytes:
-                  //[0] = 0b11000000 + ((value & 0xC0) >> 6)
-                  //[1] = 0x10000000 + (value & 0x3F)
-                  uint8_t au8_Utf8Value[2];
-                  au8_Utf8Value[0] = (0xC0U + ((u8_CharacterValue & 0xC0U) >> 6U));
-                  au8_Utf8Value[1] = (0x80U + (u8_CharacterValue & 0x3FU));
-                  //hack unsigned values into C_SCLString:
-                  c_Comment += static_cast<char_t>(au8_Utf8Value[0]);
-                  c_Comment += static_cast<char_t>(au8_Utf8Value[1]);
-               }
-               else
-               {
-                  //plain old character ...
-                  c_Comment += static_cast<char_t>(u8_CharacterValue);
+                  const uint8_t u8_CharacterValue = static_cast<uint8_t>(rc_Element.c_Comment.c_str()[u32_Character]);
+                  if (u8_CharacterValue > 127U)
+                  {
+                     //Convert to UTF8 encoding:
+                     //We could have values from 0x80 to 0xFF.
+                     //This will result in two bytes:
+                     //[0] = 0b11000000 + ((value & 0xC0) >> 6)
+                     //[1] = 0x10000000 + (value & 0x3F)
+                     uint8_t au8_Utf8Value[2];
+                     au8_Utf8Value[0] = (0xC0U + ((u8_CharacterValue & 0xC0U) >> 6U));
+                     au8_Utf8Value[1] = (0x80U + (u8_CharacterValue & 0x3FU));
+                     //hack unsigned values into C_SCLString:
+                     c_Comment += static_cast<char_t>(au8_Utf8Value[0]);
+                     c_Comment += static_cast<char_t>(au8_Utf8Value[1]);
+                  }
+                  else
+                  {
+                     //plain old character ...
+                     c_Comment += static_cast<char_t>(u8_CharacterValue);
+                  }
                }
+               rc_Element.c_Comment = c_Comment;
             }
-            rc_Element.c_Comment = c_Comment;
          }
       }
    }
 
    return s32_Result;
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Check if text contains any character > 127
+
+   \param[in]  orc_Text   Text to check
+
+   \return
+   true   at least one non-ASCII character
+   false  plain ASCII text
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_SdNdeDpImportRamView::mh_ContainsNonAsciiCharacter(const C_SclString & orc_Text)
+{
+   bool q_Retval = false;
+   const char_t * const pcn_Text = orc_Text.c_str();
+
+   for (uint32_t u32_Character = 0U; u32_Character < orc_Text.Length(); u32_Character++)
+   {
+      if (static_cast<uint8_t>(pcn_Text[u32_Character]) > 127U)
+      {
+         q_Retval = true;
+         break;
+      }
+   }
+   return q_Retval;
+}
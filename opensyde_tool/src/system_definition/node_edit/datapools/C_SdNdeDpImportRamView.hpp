@@ -31,6 +31,9 @@ public:
                                                         stw::opensyde_core::C_OscNodeDataPool & orc_DataPool,
                                                         C_PuiSdNodeDataPool & orc_GuiDataPool,
                                                         stw::scl::C_SclStringList & orc_ImportInformation);
+
+private:
+   static bool mh_ContainsNonAsciiCharacter(const stw::scl::C_SclString & orc_Text);
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
@@ -81,7 +81,7 @@ C_SdNdeDpListPopUp::C_SdNdeDpListPopUp(C_OgePopUpDialog & orc_Parent, const uint
    //undo
    if (this->mpc_UndoManager != NULL)
    {
-      this->ms32_UndoStartCount = static_cast<int32_t>(this->mpc_UndoManager->index());
+      this->ms32_UndoStartCount = this->mpc_UndoManager->GetHistoryIndex();
    }
 
    //-- Init header widget --
@@ -269,7 +269,7 @@ void C_SdNdeDpListPopUp::keyPressEvent(QKeyEvent * const opc_Event)
       case Qt::Key_Z:
          if (opc_Event->modifiers().testFlag(Qt::ControlModifier) == true)
          {
-            if (this->ms32_UndoStartCount < static_cast<int32_t>(this->mpc_UndoManager->index()))
+            if (this->ms32_UndoStartCount < this->mpc_UndoManager->GetHistoryIndex())
             {
                this->mpc_UndoManager->DoUndo();
             }
@@ -27,8 +27,11 @@
 #include "C_TblTreDelegateUtil.hpp"
 #include "C_SdNdeDpContentUtil.hpp"
 #include "C_PuiSdHandler.hpp"
+#include "C_OscLoggingHandler.hpp"
+#include "stwerrors.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
 using namespace stw::opensyde_gui_logic;
 using namespace stw::opensyde_gui_elements;
 using namespace stw::opensyde_gui;
@@ -401,9 +404,9 @@ void C_SdNdeDpListTableDelegate::setModelData(QWidget * const opc_Editor, QAbstr
          {
             const int32_t s32_NewValue = pc_ComboBox->currentIndex();
             //Clean up undo stack
-            if ((this->mq_ChangeInProgress == false) && (this->mpc_UndoStack != NULL))
+            if (this->mq_ChangeInProgress == false)
             {
-               this->mpc_UndoStack->setIndex(this->ms32_UndoStartIndex);
+               this->m_RevertPreview();
             }
             opc_Model->setData(orc_Index, s32_NewValue);
          }
@@ -413,9 +416,9 @@ void C_SdNdeDpListTableDelegate::setModelData(QWidget * const opc_Editor, QAbstr
          {
             const int32_t s32_NewValue = pc_SpinBoxInt->value();
             //Clean up undo stack
-            if ((this->mq_ChangeInProgress == false) && (this->mpc_UndoStack != NULL))
+            if (this->mq_ChangeInProgress == false)
             {
-               this->mpc_UndoStack->setIndex(this->ms32_UndoStartIndex);
+               this->m_RevertPreview();
             }
             opc_Model->setData(orc_Index, s32_NewValue);
          }
@@ -611,7 +614,7 @@ void C_SdNdeDpListTableDelegate::SetModel(C_SdNdeDpListTableModel * const opc_Va
    \param[in,out] opc_Value Current undo stack
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_SdNdeDpListTableDelegate::SetUndoStack(QUndoStack * const opc_Value)
+void C_SdNdeDpListTableDelegate::SetUndoStack(C_UtiUndoStack * const opc_Value)
 {
    this->mpc_UndoStack = opc_Value;
 }
@@ -804,7 +807,7 @@ void C_SdNdeDpListTableDelegate::m_PrepareForNewOne(void)
    this->mq_ChangeDetected = false;
    if (this->mpc_UndoStack != NULL)
    {
-      this->ms32_UndoStartIndex = this->mpc_UndoStack->index();
+      this->ms32_UndoStartIndex = this->mpc_UndoStack->GetHistoryIndex();
    }
 }
 
@@ -814,8 +817,28 @@ void C_SdNdeDpListTableDelegate::m_PrepareForNewOne(void)
 //----------------------------------------------------------------------------------------------------------------------
 void C_SdNdeDpListTableDelegate::m_CleanUpLastOne(void)
 {
-   if (((this->mq_ChangeDetected == false) && (this->mpc_UndoStack != NULL)) && (this->ms32_UndoStartIndex > -1))
+   if (this->mq_ChangeDetected == false)
    {
-      this->mpc_UndoStack->setIndex(this->ms32_UndoStartIndex);
+      this->m_RevertPreview();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Undo the preview steps of the current editor
+
+   If the oldest preview steps were deleted to keep the undo byte budget, the state before the editor cannot be
+   reached anymore. Then all preview steps are kept, as undoing only the remaining ones would leave the list in a
+   state the user never saw.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdNdeDpListTableDelegate::m_RevertPreview(void) const
+{
+   if ((this->mpc_UndoStack != NULL) && (this->ms32_UndoStartIndex > -1))
+   {
+      if (this->mpc_UndoStack->SetHistoryIndex(this->ms32_UndoStartIndex) != C_NO_ERR)
+      {
+         osc_write_log_warning("Datapool list edit",
+                               "Undo history was shortened during edit, preview changes are kept as undo steps.");
+      }
    }
 }
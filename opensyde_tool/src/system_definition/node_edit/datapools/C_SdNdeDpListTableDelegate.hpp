@@ -15,7 +15,7 @@
 
 #include <QWidget>
 #include <QStyledItemDelegate>
-#include <QUndoStack>
+#include "C_UtiUndoStack.hpp"
 #include "C_SdNdeDpListTableModel.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
@@ -46,7 +46,7 @@ public:
 
    void SetModel(C_SdNdeDpListTableModel * const opc_Value);
 
-   void SetUndoStack(QUndoStack * const opc_Value);
+   void SetUndoStack(C_UtiUndoStack * const opc_Value);
    //The signals keyword is necessary for Qt signal slot functionality
    //lint -save -e1736
 
@@ -61,12 +61,12 @@ Q_SIGNALS:
 
 private:
    C_SdNdeDpListTableModel * mpc_Model;
-   QUndoStack * mpc_UndoStack;
+   C_UtiUndoStack * mpc_UndoStack;
    const QPixmap mc_DisabledPixmapDark;
    const QPixmap mc_DisabledPixmapLight;
    const QPixmap mc_CheckMark;
    int32_t ms32_EditCount;
-   int32_t ms32_UndoStartIndex;
+   int32_t ms32_UndoStartIndex; ///< History index of the undo stack when the editor was created
    QModelIndex mc_Edit;
    bool mq_ChangeInProgress;
    bool mq_Inital;
@@ -83,6 +83,7 @@ private:
    void m_OnArraySizeChange(const int32_t & ors32_NewSize);
    void m_PrepareForNewOne(void);
    void m_CleanUpLastOne(void);
+   void m_RevertPreview(void) const;
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
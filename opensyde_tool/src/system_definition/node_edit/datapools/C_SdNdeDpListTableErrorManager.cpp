@@ -41,7 +41,8 @@ C_SdNdeDpListTableErrorManager::C_SdNdeDpListTableErrorManager(void) :
    mu32_NodeIndex(0),
    mu32_DataPoolIndex(0),
    mu32_ListIndex(0),
-   mq_ElementsInvalid(false)
+   mq_ElementsInvalid(false),
+   mu32_InvalidElementCount(0UL)
 {
 }
 
@@ -56,35 +57,141 @@ C_SdNdeDpListTableErrorManager::C_SdNdeDpListTableErrorManager(void) :
 void C_SdNdeDpListTableErrorManager::Init(const uint32_t & oru32_NodeIndex, const uint32_t & oru32_DataPoolIndex,
                                           const uint32_t & oru32_ListIndex)
 {
-   const C_OscNodeDataPool * pc_DataPool;
-
    this->mu32_NodeIndex = oru32_NodeIndex;
    this->mu32_DataPoolIndex = oru32_DataPoolIndex;
    this->mu32_ListIndex = oru32_ListIndex;
-   pc_DataPool = C_PuiSdHandler::h_GetInstance()->GetOscDataPool(this->mu32_NodeIndex, this->mu32_DataPoolIndex);
-   if (pc_DataPool != NULL)
-   {
-      pc_DataPool->CheckErrorList(this->mu32_ListIndex, NULL, NULL, NULL, NULL, NULL, &this->mq_ElementsInvalid, NULL,
-                                  NULL);
-   }
+   this->m_CheckAllElements();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Check error state change
+
+   Checks all elements again, necessary if elements were added, removed or moved.
 */
 //----------------------------------------------------------------------------------------------------------------------
 void C_SdNdeDpListTableErrorManager::OnErrorChange(void)
 {
    const bool q_PreviousErrorState = this->mq_ElementsInvalid;
-   const C_OscNodeDataPool * const pc_DataPool = C_PuiSdHandler::h_GetInstance()->GetOscDataPool(this->mu32_NodeIndex,
-                                                                                                 this->mu32_DataPoolIndex);
 
-   if (pc_DataPool != NULL)
+   this->m_CheckAllElements();
+   this->m_UpdateErrorState(q_PreviousErrorState);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check error state change after change of one element
+
+   Only the changed element is checked again.
+   A name change may also change the name conflict state of other elements so use OnErrorChange in this case.
+
+   \param[in]  ou32_ElementIndex   Changed element index
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdNdeDpListTableErrorManager::OnElementChange(const uint32_t ou32_ElementIndex)
+{
+   const bool q_PreviousErrorState = this->mq_ElementsInvalid;
+   const C_OscNode * const pc_Node = C_PuiSdHandler::h_GetInstance()->GetOscNodeConst(this->mu32_NodeIndex);
+
+   if ((pc_Node != NULL) && (ou32_ElementIndex < this->mc_ElementInvalid.size()))
+   {
+      const bool q_Invalid = this->m_CheckElement(*pc_Node, ou32_ElementIndex);
+      if (q_Invalid != this->mc_ElementInvalid[ou32_ElementIndex])
+      {
+         this->mc_ElementInvalid[ou32_ElementIndex] = q_Invalid;
+         if (q_Invalid == true)
+         {
+            ++this->mu32_InvalidElementCount;
+         }
+         else
+         {
+            --this->mu32_InvalidElementCount;
+         }
+         this->mq_ElementsInvalid = (this->mu32_InvalidElementCount > 0UL);
+      }
+   }
+   else
+   {
+      this->m_CheckAllElements();
+   }
+   this->m_UpdateErrorState(q_PreviousErrorState);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check all elements of the list and store the result per element
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdNdeDpListTableErrorManager::m_CheckAllElements(void)
+{
+   const C_OscNode * const pc_Node = C_PuiSdHandler::h_GetInstance()->GetOscNodeConst(this->mu32_NodeIndex);
+
+   this->mc_ElementInvalid.clear();
+   this->mu32_InvalidElementCount = 0UL;
+   if ((pc_Node != NULL) && (this->mu32_DataPoolIndex < pc_Node->c_DataPools.size()))
+   {
+      const C_OscNodeDataPool & rc_DataPool = pc_Node->c_DataPools[this->mu32_DataPoolIndex];
+      if (this->mu32_ListIndex < rc_DataPool.c_Lists.size())
+      {
+         const uint32_t u32_ElementCount = rc_DataPool.c_Lists[this->mu32_ListIndex].c_Elements.size();
+         this->mc_ElementInvalid.resize(u32_ElementCount, false);
+         for (uint32_t u32_ItElement = 0UL; u32_ItElement < u32_ElementCount; ++u32_ItElement)
+         {
+            if (this->m_CheckElement(*pc_Node, u32_ItElement) == true)
+            {
+               this->mc_ElementInvalid[u32_ItElement] = true;
+               ++this->mu32_InvalidElementCount;
+            }
+         }
+      }
+   }
+   this->mq_ElementsInvalid = (this->mu32_InvalidElementCount > 0UL);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check one element
+
+   Same element checks as C_OscNodeDataPool::CheckErrorList but the name conflict is looked up in the names cached
+   by the node instead of comparing with each element of the list.
+
+   \param[in]  orc_Node            Node
+   \param[in]  ou32_ElementIndex   Element index
+
+   \return
+   true  Element invalid
+   false Element valid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_SdNdeDpListTableErrorManager::m_CheckElement(const C_OscNode & orc_Node, const uint32_t ou32_ElementIndex) const
+{
+   bool q_Retval = false;
+
+   if ((this->mu32_DataPoolIndex < orc_Node.c_DataPools.size()) &&
+       (this->mu32_ListIndex < orc_Node.c_DataPools[this->mu32_DataPoolIndex].c_Lists.size()))
    {
-      pc_DataPool->CheckErrorList(this->mu32_ListIndex, NULL, NULL, NULL, NULL, NULL, &this->mq_ElementsInvalid, NULL,
-                                  NULL);
+      const C_OscNodeDataPoolList & rc_List =
+         orc_Node.c_DataPools[this->mu32_DataPoolIndex].c_Lists[this->mu32_ListIndex];
+      if (ou32_ElementIndex < rc_List.c_Elements.size())
+      {
+         bool q_NameInvalid = false;
+         bool q_MinOverMax = false;
+         bool q_DataSetInvalid = false;
+         rc_List.CheckErrorElement(ou32_ElementIndex, NULL, &q_NameInvalid, &q_MinOverMax, &q_DataSetInvalid,
+                                   NULL);
+         q_Retval = (((orc_Node.CheckElementNameConflict(this->mu32_DataPoolIndex, this->mu32_ListIndex,
+                                                         ou32_ElementIndex) == true) ||
+                      (q_NameInvalid == true)) || (q_MinOverMax == true)) || (q_DataSetInvalid == true);
+      }
    }
-   if (q_PreviousErrorState != this->mq_ElementsInvalid)
+   return q_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Signal error state change if necessary
+
+   \param[in]  oq_PreviousErrorState  Error state before the check
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdNdeDpListTableErrorManager::m_UpdateErrorState(const bool oq_PreviousErrorState)
+{
+   if (oq_PreviousErrorState != this->mq_ElementsInvalid)
    {
       Q_EMIT (this->SigErrorChange());
    }
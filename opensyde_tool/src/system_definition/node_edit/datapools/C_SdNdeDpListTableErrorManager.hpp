@@ -12,8 +12,10 @@
 #define C_SDNDEDPLISTTABLEERRORMANAGER_HPP
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
 #include <QObject>
 #include "stwtypes.hpp"
+#include "C_OscNode.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 namespace stw
@@ -33,6 +35,7 @@ public:
    C_SdNdeDpListTableErrorManager(void);
    void Init(const uint32_t & oru32_NodeIndex, const uint32_t & oru32_DataPoolIndex, const uint32_t & oru32_ListIndex);
    void OnErrorChange(void);
+   void OnElementChange(const uint32_t ou32_ElementIndex);
 
    //The signals keyword is necessary for Qt signal slot functionality
    //lint -save -e1736
@@ -46,6 +49,12 @@ private:
    uint32_t mu32_DataPoolIndex;
    uint32_t mu32_ListIndex;
    bool mq_ElementsInvalid;
+   std::vector<bool> mc_ElementInvalid; ///< Last check result (true: error) per list element
+   uint32_t mu32_InvalidElementCount;
+
+   void m_CheckAllElements(void);
+   bool m_CheckElement(const stw::opensyde_core::C_OscNode & orc_Node, const uint32_t ou32_ElementIndex) const;
+   void m_UpdateErrorState(const bool oq_PreviousErrorState);
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
@@ -12,6 +12,7 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "precomp_headers.hpp"
 
+#include <algorithm>
 #include <QMimeData>
 #include <QIcon>
 
@@ -61,10 +62,19 @@ C_SdNdeDpListTableModel::C_SdNdeDpListTableModel(QObject * const opc_Parent) :
    mu32_NodeIndex(0),
    mu32_DataPoolIndex(0),
    mu32_ListIndex(0),
-   mq_DpIsSafety(false)
+   mu32_CacheGeneration(1UL),
+   mq_DpIsSafety(false),
+   ms32_ChangedRowFirst(-1),
+   ms32_ChangedRowLast(-1),
+   ms32_ChangedColumnFirst(-1),
+   ms32_ChangedColumnLast(-1)
 {
    connect(&this->mc_ErrorManager, &C_SdNdeDpListTableErrorManager::SigErrorChange, this,
            &C_SdNdeDpListTableModel::m_OnErrorChange);
+   //Report all changes of one event loop iteration (e.g. multi row edit) with one dataChanged signal
+   this->mc_DataChangedTimer.setInterval(0);
+   this->mc_DataChangedTimer.setSingleShot(true);
+   connect(&this->mc_DataChangedTimer, &QTimer::timeout, this, &C_SdNdeDpListTableModel::m_EmitDataChanges);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -446,7 +456,7 @@ QVariant C_SdNdeDpListTableModel::data(const QModelIndex & orc_Index, const int3
          const uint32_t u32_Index = static_cast<uint32_t>(orc_Index.row());
          if (u32_Index < this->mc_DpListInfoAll.size())
          {
-            const C_DpListTableData & rc_Data = this->mc_DpListInfoAll[u32_Index];
+            const C_DpListTableData & rc_Data = this->m_GetRowData(u32_Index);
             switch (e_Col)
             {
             case eINVALID:
@@ -558,7 +568,7 @@ QVariant C_SdNdeDpListTableModel::data(const QModelIndex & orc_Index, const int3
             const uint32_t u32_Index = static_cast<uint32_t>(orc_Index.row());
             if (u32_Index < this->mc_DpListInfoAll.size())
             {
-               const C_DpListTableData & rc_Data = this->mc_DpListInfoAll[u32_Index];
+               const C_DpListTableData & rc_Data = this->m_GetRowData(u32_Index);
 
                c_Retval = rc_Data.c_InvalidToolTipHeading;
             }
@@ -581,7 +591,7 @@ QVariant C_SdNdeDpListTableModel::data(const QModelIndex & orc_Index, const int3
          const uint32_t u32_Index = static_cast<uint32_t>(orc_Index.row());
          if (u32_Index < this->mc_DpListInfoAll.size())
          {
-            const C_DpListTableData & rc_Data = this->mc_DpListInfoAll[u32_Index];
+            const C_DpListTableData & rc_Data = this->m_GetRowData(u32_Index);
 
             switch (e_Col) //lint !e788 //not all columns get a tooltip
             {
@@ -615,7 +625,7 @@ QVariant C_SdNdeDpListTableModel::data(const QModelIndex & orc_Index, const int3
          const uint32_t u32_Index = static_cast<uint32_t>(orc_Index.row());
          if (u32_Index < this->mc_DpListInfoAll.size())
          {
-            const C_DpListTableData & rc_Data = this->mc_DpListInfoAll[u32_Index];
+            const C_DpListTableData & rc_Data = this->m_GetRowData(u32_Index);
             switch (e_Col) //lint !e788 //not all columns handled on purpose
             {
             case eAUTO_MIN_MAX:
@@ -640,7 +650,7 @@ QVariant C_SdNdeDpListTableModel::data(const QModelIndex & orc_Index, const int3
                const uint32_t u32_Index = static_cast<uint32_t>(orc_Index.row());
                if (u32_Index < this->mc_DpListInfoAll.size())
                {
-                  c_Font = this->mc_DpListInfoAll[u32_Index].c_DataSetFont;
+                  c_Font = this->m_GetRowData(u32_Index).c_DataSetFont;
                }
             }
             break;
@@ -650,7 +660,7 @@ QVariant C_SdNdeDpListTableModel::data(const QModelIndex & orc_Index, const int3
                const uint32_t u32_Index = static_cast<uint32_t>(orc_Index.row());
                if (u32_Index < this->mc_DpListInfoAll.size())
                {
-                  c_Font = this->mc_DpListInfoAll[u32_Index].c_MinMaxFont;
+                  c_Font = this->m_GetRowData(u32_Index).c_MinMaxFont;
                }
             }
             break;
@@ -692,7 +702,7 @@ QVariant C_SdNdeDpListTableModel::data(const QModelIndex & orc_Index, const int3
                const uint32_t u32_Index = static_cast<uint32_t>(orc_Index.row());
                if (u32_Index < this->mc_DpListInfoAll.size())
                {
-                  c_Retval = this->mc_DpListInfoAll[u32_Index].c_MinMaxForeground;
+                  c_Retval = this->m_GetRowData(u32_Index).c_MinMaxForeground;
                }
             }
             break;
@@ -706,7 +716,7 @@ QVariant C_SdNdeDpListTableModel::data(const QModelIndex & orc_Index, const int3
                const uint32_t u32_Index = static_cast<uint32_t>(orc_Index.row());
                if (u32_Index < this->mc_DpListInfoAll.size())
                {
-                  c_Retval = this->mc_DpListInfoAll[u32_Index].c_NameForeground;
+                  c_Retval = this->m_GetRowData(u32_Index).c_NameForeground;
                }
             }
             break;
@@ -716,7 +726,7 @@ QVariant C_SdNdeDpListTableModel::data(const QModelIndex & orc_Index, const int3
                const uint32_t u32_Index = static_cast<uint32_t>(orc_Index.row());
                if (u32_Index < this->mc_DpListInfoAll.size())
                {
-                  const C_DpListTableData & rc_Data = this->mc_DpListInfoAll[u32_Index];
+                  const C_DpListTableData & rc_Data = this->m_GetRowData(u32_Index);
 
                   if (u32_DataSetIndex < rc_Data.c_DataSetData.size())
                   {
@@ -757,14 +767,14 @@ QVariant C_SdNdeDpListTableModel::data(const QModelIndex & orc_Index, const int3
          case eINVALID:
             if (u32_Index < this->mc_DpListInfoAll.size())
             {
-               const C_DpListTableData & rc_Data = this->mc_DpListInfoAll[u32_Index];
+               const C_DpListTableData & rc_Data = this->m_GetRowData(u32_Index);
                c_Tmp = rc_Data.c_InvalidIconRole;
             }
             break;
          case eICON:
             if (u32_Index < this->mc_DpListInfoAll.size())
             {
-               const C_DpListTableData & rc_Data = this->mc_DpListInfoAll[u32_Index];
+               const C_DpListTableData & rc_Data = this->m_GetRowData(u32_Index);
                c_Tmp = rc_Data.c_IconIconRole;
             }
             break;
@@ -1048,7 +1058,7 @@ Qt::ItemFlags C_SdNdeDpListTableModel::flags(const QModelIndex & orc_Index) cons
             const uint32_t u32_Index = static_cast<uint32_t>(orc_Index.row());
             if (u32_Index < this->mc_DpListInfoAll.size())
             {
-               const C_DpListTableData & rc_Data = this->mc_DpListInfoAll[u32_Index];
+               const C_DpListTableData & rc_Data = this->m_GetRowData(u32_Index);
 
                if (rc_Data.q_InterpretAsString == true)
                {
@@ -1073,7 +1083,7 @@ Qt::ItemFlags C_SdNdeDpListTableModel::flags(const QModelIndex & orc_Index) cons
             const uint32_t u32_Index = static_cast<uint32_t>(orc_Index.row());
             if (u32_Index < this->mc_DpListInfoAll.size())
             {
-               const C_DpListTableData & rc_Data = this->mc_DpListInfoAll[u32_Index];
+               const C_DpListTableData & rc_Data = this->m_GetRowData(u32_Index);
 
                if ((rc_Data.q_AutoMinMaxActive == true) ||
                    (rc_Data.q_InterpretAsString == true))
@@ -1190,7 +1200,7 @@ bool C_SdNdeDpListTableModel::insertColumns(const int32_t os32_Col, const int32_
 
    if ((os32_Count > 0) && (os32_Col >= 0))
    {
-      this->m_FillDpListInfo();
+      this->m_InvalidateAllRows();
       beginInsertColumns(orc_Parent, os32_Col, (os32_Col + os32_Count) - 1);
       //No action as change was already done before (function call just for signals)
       endInsertColumns();
@@ -1255,7 +1265,7 @@ bool C_SdNdeDpListTableModel::removeColumns(const int32_t os32_Col, const int32_
 
    if ((os32_Count > 0) && (os32_Col >= 0))
    {
-      this->m_FillDpListInfo();
+      this->m_InvalidateAllRows();
       beginRemoveColumns(orc_Parent, os32_Col, (os32_Col + os32_Count) - 1);
       //No action as change was already done before (function call just for signals)
       endRemoveColumns();
@@ -1320,7 +1330,9 @@ void C_SdNdeDpListTableModel::DoMoveRows(const std::vector<uint32_t> & orc_Selec
             u32_TargetAccessIndex += rc_Section.size();
          }
       }
-      this->m_FillDpListInfo();
+      //Element indices changed
+      this->mc_ErrorManager.OnErrorChange();
+      this->m_InvalidateAllRows();
    }
 }
 
@@ -1608,7 +1620,7 @@ bool C_SdNdeDpListTableModel::IsElementInterpretedAsString(const QModelIndex & o
       const uint32_t u32_Index = static_cast<uint32_t>(orc_Index.row());
       if (u32_Index < this->mc_DpListInfoAll.size())
       {
-         q_Return = this->mc_DpListInfoAll[u32_Index].q_InterpretAsString;
+         q_Return = this->m_GetRowData(u32_Index).q_InterpretAsString;
       }
    }
 
@@ -1697,22 +1709,34 @@ void C_SdNdeDpListTableModel::HandleDataChange(const uint32_t ou32_Row,
 
    if (q_ReloadAll == false)
    {
-      this->m_FillDpListElementInfo(ou32_Row);
+      this->m_InvalidateRow(ou32_Row);
    }
    else
    {
-      this->m_FillDpListInfo();
+      //Other rows are affected as well (name conflicts, sizes and addresses)
+      this->m_InvalidateAllRows();
+      this->m_RegisterDataChange(0, this->rowCount() - 1, 0, this->columnCount() - 1);
    }
 
    if (q_ErrorChange == true)
    {
-      const QModelIndex c_Index = this->index(ou32_Row, this->EnumToColumn(eINVALID));
-      this->mc_ErrorManager.OnErrorChange();
-      Q_EMIT this->dataChanged(c_Index, c_Index);
+      const int32_t s32_InvalidColumn = this->EnumToColumn(eINVALID);
+      if (ore_ChangeType == C_SdNdeDpUtil::E_ElementDataChangeType::eELEMENT_NAME)
+      {
+         //Name conflict state of other elements might have changed
+         this->mc_ErrorManager.OnErrorChange();
+      }
+      else
+      {
+         this->mc_ErrorManager.OnElementChange(ou32_Row);
+      }
+      this->m_RegisterDataChange(static_cast<int32_t>(ou32_Row), static_cast<int32_t>(ou32_Row),
+                                 s32_InvalidColumn, s32_InvalidColumn);
    }
    if (s32_Column >= 0)
    {
-      Q_EMIT this->dataChanged(this->index(ou32_Row, s32_Column), this->index(ou32_Row, s32_Column));
+      this->m_RegisterDataChange(static_cast<int32_t>(ou32_Row), static_cast<int32_t>(ou32_Row), s32_Column,
+                                 s32_Column);
    }
 }
 
@@ -1790,7 +1814,7 @@ uint32_t C_SdNdeDpListTableModel::GetArraySize(const uint32_t ou32_Index) const
 
    if (ou32_Index < this->mc_DpListInfoAll.size())
    {
-      u32_Retval = this->mc_DpListInfoAll[ou32_Index].u32_ArraySize;
+      u32_Retval = this->m_GetRowData(ou32_Index).u32_ArraySize;
    }
 
    return u32_Retval;
@@ -1817,40 +1841,152 @@ bool C_SdNdeDpListTableModel::IsString(const QModelIndex & orc_Index) const
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-/*! \brief   Collects all Datapool list information for table
+/*! \brief   Prepares the row cache for all Datapool list elements of the table
+
+   The rows are only filled on first access (see m_GetRowData) so opening a huge list
+   does not format elements which are never displayed.
 */
 //----------------------------------------------------------------------------------------------------------------------
 void C_SdNdeDpListTableModel::m_FillDpListInfo(void)
 {
-   this->mc_DpListInfoAll.clear();
-
    const C_OscNodeDataPool * const pc_Datapool =
       C_PuiSdHandler::h_GetInstance()->GetOscDataPool(this->mu32_NodeIndex, this->mu32_DataPoolIndex);
 
+   this->mc_DpListInfoAll.clear();
+
    if ((pc_Datapool != NULL) &&
        (this->mu32_ListIndex < pc_Datapool->c_Lists.size()))
    {
-      uint32_t u32_ElementCounter;
-
       this->mq_DpIsSafety = pc_Datapool->q_IsSafety;
 
-      this->mc_DpListInfoAll.resize(pc_Datapool->c_Lists[this->mu32_ListIndex].c_Elements.size());
+      //Value initialized rows are not filled yet (generation 0)
+      this->mc_DpListInfoAll.resize(pc_Datapool->c_Lists[this->mu32_ListIndex].c_Elements.size(),
+                                    C_DpListTableData());
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get cached data of one row
+
+   Fills the row if it was not filled since its last invalidation.
+
+   \param[in]  ou32_Row   Row (Expected: in range of mc_DpListInfoAll)
+
+   \return
+   Cached row data
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_SdNdeDpListTableModel::C_DpListTableData & C_SdNdeDpListTableModel::m_GetRowData(const uint32_t ou32_Row)
+const
+{
+   C_DpListTableData & rc_Data = this->mc_DpListInfoAll[ou32_Row];
+
+   if (rc_Data.u32_CacheGeneration != this->mu32_CacheGeneration)
+   {
+      this->m_FillDpListElementInfo(ou32_Row);
+      rc_Data.u32_CacheGeneration = this->mu32_CacheGeneration;
+   }
+   return rc_Data;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Mark one row for refill on next access
+
+   \param[in]  ou32_Row   Row
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdNdeDpListTableModel::m_InvalidateRow(const uint32_t ou32_Row)
+{
+   if (ou32_Row < this->mc_DpListInfoAll.size())
+   {
+      this->mc_DpListInfoAll[ou32_Row].u32_CacheGeneration = 0UL;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Mark all rows for refill on next access without touching each row
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdNdeDpListTableModel::m_InvalidateAllRows(void)
+{
+   ++this->mu32_CacheGeneration;
+   if (this->mu32_CacheGeneration == 0UL)
+   {
+      //Overflow: 0 is reserved for "never filled" so reset all rows explicitly
+      for (uint32_t u32_ItRow = 0UL; u32_ItRow < this->mc_DpListInfoAll.size(); ++u32_ItRow)
+      {
+         this->mc_DpListInfoAll[u32_ItRow].u32_CacheGeneration = 0UL;
+      }
+      this->mu32_CacheGeneration = 1UL;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Register changed cells for the next dataChanged signal
 
-      for (u32_ElementCounter = 0U; u32_ElementCounter < pc_Datapool->c_Lists[this->mu32_ListIndex].c_Elements.size();
-           ++u32_ElementCounter)
+   \param[in]  os32_RowFirst       First changed row
+   \param[in]  os32_RowLast        Last changed row
+   \param[in]  os32_ColumnFirst    First changed column
+   \param[in]  os32_ColumnLast     Last changed column
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdNdeDpListTableModel::m_RegisterDataChange(const int32_t os32_RowFirst, const int32_t os32_RowLast,
+                                                   const int32_t os32_ColumnFirst, const int32_t os32_ColumnLast)
+{
+   if ((os32_RowFirst >= 0) && (os32_ColumnFirst >= 0))
+   {
+      if (this->ms32_ChangedRowFirst < 0)
+      {
+         this->ms32_ChangedRowFirst = os32_RowFirst;
+         this->ms32_ChangedRowLast = os32_RowLast;
+         this->ms32_ChangedColumnFirst = os32_ColumnFirst;
+         this->ms32_ChangedColumnLast = os32_ColumnLast;
+      }
+      else
+      {
+         this->ms32_ChangedRowFirst = std::min(this->ms32_ChangedRowFirst, os32_RowFirst);
+         this->ms32_ChangedRowLast = std::max(this->ms32_ChangedRowLast, os32_RowLast);
+         this->ms32_ChangedColumnFirst = std::min(this->ms32_ChangedColumnFirst, os32_ColumnFirst);
+         this->ms32_ChangedColumnLast = std::max(this->ms32_ChangedColumnLast, os32_ColumnLast);
+      }
+      if (this->mc_DataChangedTimer.isActive() == false)
       {
-         this->m_FillDpListElementInfo(u32_ElementCounter);
+         this->mc_DataChangedTimer.start();
       }
    }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Signal all registered cell changes as one range
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdNdeDpListTableModel::m_EmitDataChanges(void)
+{
+   if (this->ms32_ChangedRowFirst >= 0)
+   {
+      //Rows or columns might have been removed in the meantime
+      const int32_t s32_RowLast = std::min(this->ms32_ChangedRowLast, this->rowCount() - 1);
+      const int32_t s32_ColumnLast = std::min(this->ms32_ChangedColumnLast, this->columnCount() - 1);
+
+      if ((this->ms32_ChangedRowFirst <= s32_RowLast) && (this->ms32_ChangedColumnFirst <= s32_ColumnLast))
+      {
+         Q_EMIT this->dataChanged(this->index(this->ms32_ChangedRowFirst, this->ms32_ChangedColumnFirst),
+                                  this->index(s32_RowLast, s32_ColumnLast));
+      }
+   }
+   this->ms32_ChangedRowFirst = -1;
+   this->ms32_ChangedRowLast = -1;
+   this->ms32_ChangedColumnFirst = -1;
+   this->ms32_ChangedColumnLast = -1;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Collects all Datapool list element information for one row of table and updates the data
 
    \param[in]       ou32_ElementIndex     Datapool element index which equals the row
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_SdNdeDpListTableModel::m_FillDpListElementInfo(const uint32_t ou32_ElementIndex)
+void C_SdNdeDpListTableModel::m_FillDpListElementInfo(const uint32_t ou32_ElementIndex) const
 {
    const C_PuiSdNodeDataPoolListElement * const pc_UiElement =
       C_PuiSdHandler::h_GetInstance()->GetUiDataPoolListElement(this->mu32_NodeIndex, this->mu32_DataPoolIndex,
@@ -1878,12 +2014,19 @@ void C_SdNdeDpListTableModel::m_FillDpListElementInfo(const uint32_t ou32_Elemen
 
       std::vector<uint32_t> c_InvalidDataSetIndices;
       const C_OscNodeDataPoolList & rc_List = pc_Datapool->c_Lists[this->mu32_ListIndex];
+      const C_OscNode * const pc_Node = C_PuiSdHandler::h_GetInstance()->GetOscNodeConst(this->mu32_NodeIndex);
 
       // Reset error icon
       rc_Data.c_InvalidIconRole.clear();
 
-      rc_List.CheckErrorElement(ou32_ElementIndex, &q_NameConflict, &q_NameInvalid, &q_MinOverMax, &q_DataSetInvalid,
+      //Name conflict via the names cached by the node instead of comparing with each element of the list
+      rc_List.CheckErrorElement(ou32_ElementIndex, NULL, &q_NameInvalid, &q_MinOverMax, &q_DataSetInvalid,
                                 &c_InvalidDataSetIndices);
+      if (pc_Node != NULL)
+      {
+         q_NameConflict = pc_Node->CheckElementNameConflict(this->mu32_DataPoolIndex, this->mu32_ListIndex,
+                                                            ou32_ElementIndex);
+      }
 
       // Name
       C_SdNdeDpUtil::h_ConvertToElementGeneric(*pc_OscElement, *pc_UiElement,
@@ -2304,8 +2447,8 @@ void C_SdNdeDpListTableModel::m_DataChange(const uint32_t & oru32_NodeIndex, con
                               ore_DataChangeType,
                               oru32_ArrayIndex, ors32_DataSetIndex);
 
-   // Update the local data
-   this->m_FillDpListElementInfo(oru32_DataPoolListElementIndex);
+   // Update the local data on next access
+   this->m_InvalidateRow(oru32_DataPoolListElementIndex);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
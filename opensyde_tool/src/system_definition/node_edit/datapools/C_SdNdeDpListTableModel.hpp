@@ -13,6 +13,7 @@
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 
+#include <QTimer>
 #include <QAbstractTableModel>
 #include "stwtypes.hpp"
 #include "C_OscNodeDataPoolList.hpp"
@@ -178,17 +179,32 @@ private:
 
       QStringList c_IconIconRole;
       bool q_InterpretAsString;
+
+      uint32_t u32_CacheGeneration; ///< Cache generation the row was filled for (0: never filled)
    };
 
    uint32_t mu32_NodeIndex;
    uint32_t mu32_DataPoolIndex;
    uint32_t mu32_ListIndex;
-   std::vector<C_DpListTableData> mc_DpListInfoAll;
+   mutable std::vector<C_DpListTableData> mc_DpListInfoAll; ///< Row cache, rows are only filled when displayed
+   uint32_t mu32_CacheGeneration;
    bool mq_DpIsSafety;
    C_SdNdeDpListTableErrorManager mc_ErrorManager;
+   QTimer mc_DataChangedTimer;
+   // Bounding range of all changed cells not yet reported by dataChanged (-1: none)
+   int32_t ms32_ChangedRowFirst;
+   int32_t ms32_ChangedRowLast;
+   int32_t ms32_ChangedColumnFirst;
+   int32_t ms32_ChangedColumnLast;
 
    void m_FillDpListInfo(void);
-   void m_FillDpListElementInfo(const uint32_t ou32_ElementIndex);
+   void m_FillDpListElementInfo(const uint32_t ou32_ElementIndex) const;
+   const C_DpListTableData & m_GetRowData(const uint32_t ou32_Row) const;
+   void m_InvalidateRow(const uint32_t ou32_Row);
+   void m_InvalidateAllRows(void);
+   void m_RegisterDataChange(const int32_t os32_RowFirst, const int32_t os32_RowLast, const int32_t os32_ColumnFirst,
+                             const int32_t os32_ColumnLast);
+   void m_EmitDataChanges(void);
 
    void m_DataChange(const uint32_t & oru32_NodeIndex, const uint32_t & oru32_DataPoolIndex,
                      const uint32_t & oru32_DataPoolListIndex, const uint32_t & oru32_DataPoolListElementIndex,
@@ -17,6 +17,7 @@
 #include "C_OscLoggingHandler.hpp"
 #include "C_PuiSdHandler.hpp"
 #include "C_SdUtil.hpp"
+#include "C_SdNdeUnoUtil.hpp"
 #include "TglUtils.hpp"
 
 #include "C_SdNdeUnoDataPoolListAddDeleteBaseCommand.hpp"
@@ -61,6 +62,31 @@ C_SdNdeUnoDataPoolListAddDeleteBaseCommand::C_SdNdeUnoDataPoolListAddDeleteBaseC
 {
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get memory held by command
+
+   \return
+   Estimated memory usage in bytes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_SdNdeUnoDataPoolListAddDeleteBaseCommand::GetMemoryUsage(void) const
+{
+   uint64_t u64_Retval = static_cast<uint64_t>(sizeof(C_SdNdeUnoDataPoolListAddDeleteBaseCommand)) +
+                         (static_cast<uint64_t>(this->mc_Indices.size()) * static_cast<uint64_t>(sizeof(uint32_t)));
+
+   for (uint32_t u32_It = 0UL; u32_It < this->mc_OscContent.size(); ++u32_It)
+   {
+      u64_Retval += C_SdNdeUnoUtil::h_GetMemoryUsage(this->mc_OscContent[u32_It]);
+   }
+   for (uint32_t u32_It = 0UL; u32_It < this->mc_UiContent.size(); ++u32_It)
+   {
+      u64_Retval += static_cast<uint64_t>(sizeof(C_PuiSdNodeDataPoolList)) +
+                    (static_cast<uint64_t>(this->mc_UiContent[u32_It].c_DataPoolListElements.size()) *
+                     static_cast<uint64_t>(sizeof(C_PuiSdNodeDataPoolListElement)));
+   }
+   return u64_Retval;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Add from internal data
 */
@@ -78,6 +104,8 @@ void C_SdNdeUnoDataPoolListAddDeleteBaseCommand::m_Add(void)
                                                                      this->mc_OscContent[u32_Index],
                                                                      this->mc_UiContent[u32_Index]) == C_NO_ERR);
    }
+   //Only keep content while it is not part of the data model, delete reads it back
+   m_ReleaseContent();
    //Before selection: update UI
    m_UpdateModels();
    this->mpc_DataPoolListsTreeWidget->UpdateUi();
@@ -223,3 +251,13 @@ void C_SdNdeUnoDataPoolListAddDeleteBaseCommand::m_UpdateModels(void)
       this->mpc_DataPoolListsTreeWidget->UpdateModels();
    }
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Free stored list content
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdNdeUnoDataPoolListAddDeleteBaseCommand::m_ReleaseContent(void)
+{
+   std::vector<C_OscNodeDataPoolList>().swap(this->mc_OscContent);
+   std::vector<C_PuiSdNodeDataPoolList>().swap(this->mc_UiContent);
+}
@@ -18,6 +18,7 @@
 #include "C_PuiSdNodeDataPoolList.hpp"
 #include "C_OscNodeDataPoolList.hpp"
 #include "C_SdNdeUnoDataPoolListBaseCommand.hpp"
+#include "C_UtiUndoCommandMemoryBase.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 namespace stw
@@ -29,7 +30,8 @@ namespace opensyde_gui_logic
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
 class C_SdNdeUnoDataPoolListAddDeleteBaseCommand :
-   public C_SdNdeUnoDataPoolListBaseCommand
+   public C_SdNdeUnoDataPoolListBaseCommand,
+   public C_UtiUndoCommandMemoryBase
 {
 public:
    C_SdNdeUnoDataPoolListAddDeleteBaseCommand(const uint32_t & oru32_NodeIndex, const uint32_t & oru32_DataPoolIndex,
@@ -37,6 +39,8 @@ public:
                                               const std::vector<uint32_t> & orc_Indices, const QString & orc_Text = "",
                                               QUndoCommand * const opc_Parent = NULL);
 
+   uint64_t GetMemoryUsage(void) const override;
+
 protected:
    void m_Add(void);
    void m_Delete(void);
@@ -52,6 +56,7 @@ private:
    void m_SortDescending(void);
    void m_SortAscending(void);
    void m_UpdateModels(void);
+   void m_ReleaseContent(void);
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
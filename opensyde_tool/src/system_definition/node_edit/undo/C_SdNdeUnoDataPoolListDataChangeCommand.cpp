@@ -20,6 +20,7 @@
 #include "TglUtils.hpp"
 #include "C_SdNdeUnoDataPoolListDataChangeCommand.hpp"
 #include "C_PuiSdHandler.hpp"
+#include "C_SdNdeUnoUtil.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 using namespace stw::tgl;
@@ -29,6 +30,7 @@ using namespace stw::opensyde_core;
 using namespace stw::errors;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const int32_t C_SdNdeUnoDataPoolListDataChangeCommand::mhs32_COMMAND_ID = 1;
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
@@ -86,6 +88,65 @@ void C_SdNdeUnoDataPoolListDataChangeCommand::undo(void)
    C_SdNdeUnoDataPoolListBaseCommand::undo();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get command ID for merging
+
+   \return
+   Command ID
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SdNdeUnoDataPoolListDataChangeCommand::id(void) const
+{
+   return mhs32_COMMAND_ID;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Attempt merge with current command
+
+   Consecutive changes of the same property of the same list are combined into one step,
+   which keeps the oldest previous value and the newest value.
+
+   \param[in] opc_Command Command to merge with
+
+   \return
+   true: merged into current command
+   false: no merge possible
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_SdNdeUnoDataPoolListDataChangeCommand::mergeWith(const QUndoCommand * const opc_Command)
+{
+   bool q_Retval = false;
+   const C_SdNdeUnoDataPoolListDataChangeCommand * const pc_Command =
+      dynamic_cast<const C_SdNdeUnoDataPoolListDataChangeCommand * const>(opc_Command);
+
+   //Follow-up changes of child commands are not covered by the merged values
+   if (((pc_Command != NULL) && (this->childCount() == 0)) && (pc_Command->childCount() == 0))
+   {
+      if ((((pc_Command->mu32_NodeIndex == this->mu32_NodeIndex) &&
+            (pc_Command->mu32_DataPoolIndex == this->mu32_DataPoolIndex)) &&
+           (pc_Command->mu32_DataPoolListIndex == this->mu32_DataPoolListIndex)) &&
+          (pc_Command->me_DataChangeType == this->me_DataChangeType))
+      {
+         this->mc_NewData = pc_Command->mc_NewData;
+         q_Retval = true;
+      }
+   }
+   return q_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get memory held by command
+
+   \return
+   Estimated memory usage in bytes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_SdNdeUnoDataPoolListDataChangeCommand::GetMemoryUsage(void) const
+{
+   return static_cast<uint64_t>(sizeof(C_SdNdeUnoDataPoolListDataChangeCommand)) +
+          C_SdNdeUnoUtil::h_GetMemoryUsage(this->mc_NewData) + C_SdNdeUnoUtil::h_GetMemoryUsage(this->mc_PreviousData);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Change data values and store previous value
 
@@ -15,6 +15,7 @@
 
 #include "C_SdNdeUnoDataPoolListBaseCommand.hpp"
 #include "C_SdNdeDpUtil.hpp"
+#include "C_UtiUndoCommandMemoryBase.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 namespace stw
@@ -26,7 +27,8 @@ namespace opensyde_gui_logic
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
 class C_SdNdeUnoDataPoolListDataChangeCommand :
-   public C_SdNdeUnoDataPoolListBaseCommand
+   public C_SdNdeUnoDataPoolListBaseCommand,
+   public C_UtiUndoCommandMemoryBase
 {
 public:
    C_SdNdeUnoDataPoolListDataChangeCommand(const uint32_t & oru32_NodeIndex, const uint32_t & oru32_DataPoolIndex,
@@ -34,8 +36,14 @@ public:
                                            QUndoCommand * const opc_Parent = NULL);
    void redo(void) override;
    void undo(void) override;
+   int32_t id(void) const override;
+   bool mergeWith(const QUndoCommand * const opc_Command) override;
+
+   uint64_t GetMemoryUsage(void) const override;
 
 private:
+   static const int32_t mhs32_COMMAND_ID;
+
    const uint32_t mu32_DataPoolListIndex;
    QVariant mc_NewData;
    QVariant mc_PreviousData;
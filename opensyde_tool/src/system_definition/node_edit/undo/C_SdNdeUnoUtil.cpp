@@ -17,6 +17,8 @@
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 using namespace stw::opensyde_gui_logic;
+using namespace stw::opensyde_core;
+using namespace stw::scl;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
 
@@ -54,6 +56,86 @@ void C_SdNdeUnoUtil::h_AdaptTargetToDeletedSource(const std::vector<uint32_t> &
    }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Estimate memory held by list copy
+
+   \param[in]  orc_List   List
+
+   \return
+   Estimated memory usage in bytes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_SdNdeUnoUtil::h_GetMemoryUsage(const C_OscNodeDataPoolList & orc_List)
+{
+   uint64_t u64_Retval = static_cast<uint64_t>(sizeof(C_OscNodeDataPoolList)) +
+                         mh_GetMemoryUsage(orc_List.c_Name) + mh_GetMemoryUsage(orc_List.c_Comment);
+
+   for (uint32_t u32_ItElement = 0UL; u32_ItElement < orc_List.c_Elements.size(); ++u32_ItElement)
+   {
+      u64_Retval += C_SdNdeUnoUtil::h_GetMemoryUsage(orc_List.c_Elements[u32_ItElement]);
+   }
+   for (uint32_t u32_ItDataSet = 0UL; u32_ItDataSet < orc_List.c_DataSets.size(); ++u32_ItDataSet)
+   {
+      const C_OscNodeDataPoolDataSet & rc_DataSet = orc_List.c_DataSets[u32_ItDataSet];
+      u64_Retval += static_cast<uint64_t>(sizeof(C_OscNodeDataPoolDataSet)) + mh_GetMemoryUsage(rc_DataSet.c_Name) +
+                    mh_GetMemoryUsage(rc_DataSet.c_Comment);
+   }
+   return u64_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Estimate memory held by list element copy
+
+   \param[in]  orc_Element   List element
+
+   \return
+   Estimated memory usage in bytes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_SdNdeUnoUtil::h_GetMemoryUsage(const C_OscNodeDataPoolListElement & orc_Element)
+{
+   uint64_t u64_Retval = static_cast<uint64_t>(sizeof(C_OscNodeDataPoolListElement)) +
+                         mh_GetMemoryUsage(orc_Element.c_Name) + mh_GetMemoryUsage(orc_Element.c_Comment) +
+                         mh_GetMemoryUsage(orc_Element.c_Unit) + mh_GetMemoryUsage(orc_Element.c_MinValue) +
+                         mh_GetMemoryUsage(orc_Element.c_MaxValue) + mh_GetMemoryUsage(orc_Element.c_Value) +
+                         mh_GetMemoryUsage(orc_Element.c_NvmValue);
+
+   for (uint32_t u32_ItDataSet = 0UL; u32_ItDataSet < orc_Element.c_DataSetValues.size(); ++u32_ItDataSet)
+   {
+      u64_Retval += static_cast<uint64_t>(sizeof(C_OscNodeDataPoolContent)) +
+                    mh_GetMemoryUsage(orc_Element.c_DataSetValues[u32_ItDataSet]);
+   }
+   return u64_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Estimate memory held by generic value
+
+   \param[in]  orc_Value  Value
+
+   \return
+   Estimated memory usage in bytes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_SdNdeUnoUtil::h_GetMemoryUsage(const QVariant & orc_Value)
+{
+   uint64_t u64_Retval = static_cast<uint64_t>(sizeof(QVariant));
+
+   if (orc_Value.type() == QVariant::String)
+   {
+      u64_Retval += static_cast<uint64_t>(orc_Value.toString().size()) * static_cast<uint64_t>(sizeof(QChar));
+   }
+   else if (orc_Value.type() == QVariant::ByteArray)
+   {
+      u64_Retval += static_cast<uint64_t>(orc_Value.toByteArray().size());
+   }
+   else
+   {
+      //Value stored in variant itself
+   }
+   return u64_Retval;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Default constructor
 */
@@ -61,3 +143,31 @@ void C_SdNdeUnoUtil::h_AdaptTargetToDeletedSource(const std::vector<uint32_t> &
 C_SdNdeUnoUtil::C_SdNdeUnoUtil()
 {
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Estimate heap memory held by string
+
+   \param[in]  orc_Value  String
+
+   \return
+   Estimated memory usage in bytes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_SdNdeUnoUtil::mh_GetMemoryUsage(const C_SclString & orc_Value)
+{
+   return static_cast<uint64_t>(orc_Value.Length());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Estimate memory held by content outside of its containing object
+
+   \param[in]  orc_Value  Content
+
+   \return
+   Estimated memory usage in bytes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_SdNdeUnoUtil::mh_GetMemoryUsage(const C_OscNodeDataPoolContent & orc_Value)
+{
+   return static_cast<uint64_t>(orc_Value.GetSizeByte());
+}
@@ -13,7 +13,9 @@
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include <vector>
+#include <QVariant>
 #include "stwtypes.hpp"
+#include "C_OscNodeDataPoolList.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 namespace stw
@@ -29,9 +31,15 @@ class C_SdNdeUnoUtil
 public:
    static void h_AdaptTargetToDeletedSource(const std::vector<uint32_t> & orc_Source,
                                             std::vector<uint32_t> & orc_Target);
+   static uint64_t h_GetMemoryUsage(const stw::opensyde_core::C_OscNodeDataPoolList & orc_List);
+   static uint64_t h_GetMemoryUsage(const stw::opensyde_core::C_OscNodeDataPoolListElement & orc_Element);
+   static uint64_t h_GetMemoryUsage(const QVariant & orc_Value);
 
 private:
    C_SdNdeUnoUtil();
+
+   static uint64_t mh_GetMemoryUsage(const stw::scl::C_SclString & orc_Value);
+   static uint64_t mh_GetMemoryUsage(const stw::opensyde_core::C_OscNodeDataPoolContent & orc_Value);
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
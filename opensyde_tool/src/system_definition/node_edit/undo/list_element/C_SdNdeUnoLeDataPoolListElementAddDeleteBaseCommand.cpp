@@ -18,6 +18,7 @@
 #include "C_PuiSdHandler.hpp"
 #include "C_SdUtil.hpp"
 #include "C_SdNdeDpListTableView.hpp"
+#include "C_SdNdeUnoUtil.hpp"
 #include "TglUtils.hpp"
 #include "C_SdNdeUnoLeDataPoolListElementAddDeleteBaseCommand.hpp"
 
@@ -63,6 +64,27 @@ C_SdNdeUnoLeDataPoolListElementAddDeleteBaseCommand::C_SdNdeUnoLeDataPoolListEle
 {
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get memory held by command
+
+   \return
+   Estimated memory usage in bytes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_SdNdeUnoLeDataPoolListElementAddDeleteBaseCommand::GetMemoryUsage(void) const
+{
+   uint64_t u64_Retval = static_cast<uint64_t>(sizeof(C_SdNdeUnoLeDataPoolListElementAddDeleteBaseCommand)) +
+                         (static_cast<uint64_t>(this->mc_Indices.size()) * static_cast<uint64_t>(sizeof(uint32_t))) +
+                         (static_cast<uint64_t>(this->mc_UiContent.size()) *
+                          static_cast<uint64_t>(sizeof(C_PuiSdNodeDataPoolListElement)));
+
+   for (uint32_t u32_It = 0UL; u32_It < this->mc_OscContent.size(); ++u32_It)
+   {
+      u64_Retval += C_SdNdeUnoUtil::h_GetMemoryUsage(this->mc_OscContent[u32_It]);
+   }
+   return u64_Retval;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Add from internal data
 */
@@ -82,6 +104,8 @@ void C_SdNdeUnoLeDataPoolListElementAddDeleteBaseCommand::m_Add(void)
          std::vector<std::vector<uint32_t> > c_Continous;
          //Insert
          c_Continous = pc_Model->DoInsertRows(this->mc_OscContent, this->mc_UiContent, this->mc_Indices);
+         //Only keep content while it is not part of the data model, delete reads it back
+         m_ReleaseContent();
          m_ReSelect(c_Continous, true);
       }
    }
@@ -269,3 +293,13 @@ void C_SdNdeUnoLeDataPoolListElementAddDeleteBaseCommand::m_SortAscending(void)
    C_SdUtil::h_SortIndicesAscendingAndSync<C_OscNodeDataPoolListElement, C_PuiSdNodeDataPoolListElement>(
       this->mc_Indices, this->mc_OscContent, this->mc_UiContent);
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Free stored list element content
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SdNdeUnoLeDataPoolListElementAddDeleteBaseCommand::m_ReleaseContent(void)
+{
+   std::vector<C_OscNodeDataPoolListElement>().swap(this->mc_OscContent);
+   std::vector<C_PuiSdNodeDataPoolListElement>().swap(this->mc_UiContent);
+}
@@ -18,6 +18,7 @@
 #include "C_PuiSdNodeDataPoolListElement.hpp"
 #include "C_OscNodeDataPoolListElement.hpp"
 #include "C_SdNdeUnoLeDataPoolListElementBaseCommand.hpp"
+#include "C_UtiUndoCommandMemoryBase.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 namespace stw
@@ -29,7 +30,8 @@ namespace opensyde_gui_logic
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
 class C_SdNdeUnoLeDataPoolListElementAddDeleteBaseCommand :
-   public C_SdNdeUnoLeDataPoolListElementBaseCommand
+   public C_SdNdeUnoLeDataPoolListElementBaseCommand,
+   public C_UtiUndoCommandMemoryBase
 {
 public:
    C_SdNdeUnoLeDataPoolListElementAddDeleteBaseCommand(const uint32_t & oru32_NodeIndex,
@@ -39,6 +41,8 @@ public:
                                                        const std::vector<uint32_t> & orc_Indices, const QString & orc_Text = "",
                                                        QUndoCommand * const opc_Parent = NULL);
 
+   uint64_t GetMemoryUsage(void) const override;
+
 protected:
    void m_Add(void);
    void m_Delete(void);
@@ -54,6 +58,7 @@ private:
 
    void m_SortDescending(void);
    void m_SortAscending(void);
+   void m_ReleaseContent(void);
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
@@ -20,6 +20,7 @@
 #include "C_PuiSdHandler.hpp"
 #include "TglUtils.hpp"
 #include "C_SdNdeDpContentUtil.hpp"
+#include "C_SdNdeUnoUtil.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 using namespace stw::tgl;
@@ -28,6 +29,7 @@ using namespace stw::opensyde_gui_logic;
 using namespace stw::opensyde_core;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const int32_t C_SdNdeUnoLeDataPoolListElementDataChangeCommand::mhs32_COMMAND_ID = 2;
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
@@ -95,6 +97,113 @@ void C_SdNdeUnoLeDataPoolListElementDataChangeCommand::undo(void)
    C_SdNdeUnoLeDataPoolListElementBaseCommand::undo();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get command ID for merging
+
+   \return
+   Command ID
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SdNdeUnoLeDataPoolListElementDataChangeCommand::id(void) const
+{
+   return mhs32_COMMAND_ID;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Attempt merge with current command
+
+   Consecutive changes of the same cell (element, property, array index and data set) are combined into one step,
+   which keeps the oldest previous value and the newest value.
+
+   \param[in] opc_Command Command to merge with
+
+   \return
+   true: merged into current command
+   false: no merge possible
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_SdNdeUnoLeDataPoolListElementDataChangeCommand::mergeWith(const QUndoCommand * const opc_Command)
+{
+   bool q_Retval = false;
+   const C_SdNdeUnoLeDataPoolListElementDataChangeCommand * const pc_Command =
+      dynamic_cast<const C_SdNdeUnoLeDataPoolListElementDataChangeCommand * const>(opc_Command);
+
+   //Follow-up changes of child commands are not covered by the merged values
+   if (((pc_Command != NULL) && (this->childCount() == 0)) && (pc_Command->childCount() == 0))
+   {
+      if (((((pc_Command->mu32_NodeIndex == this->mu32_NodeIndex) &&
+             (pc_Command->mu32_DataPoolIndex == this->mu32_DataPoolIndex)) &&
+            (pc_Command->mu32_DataPoolListIndex == this->mu32_DataPoolListIndex)) &&
+           (pc_Command->mu32_DataPoolListElementIndex == this->mu32_DataPoolListElementIndex)) &&
+          (((pc_Command->me_DataChangeType == this->me_DataChangeType) &&
+            (pc_Command->mu32_ArrayIndex == this->mu32_ArrayIndex)) &&
+           (pc_Command->ms32_DataSetIndex == this->ms32_DataSetIndex)))
+      {
+         if (mh_IsMergeable(this->me_DataChangeType) == true)
+         {
+            this->mc_NewData = pc_Command->mc_NewData;
+            q_Retval = true;
+         }
+      }
+   }
+   return q_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get memory held by command
+
+   \return
+   Estimated memory usage in bytes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_SdNdeUnoLeDataPoolListElementDataChangeCommand::GetMemoryUsage(void) const
+{
+   return static_cast<uint64_t>(sizeof(C_SdNdeUnoLeDataPoolListElementDataChangeCommand)) +
+          C_SdNdeUnoUtil::h_GetMemoryUsage(this->mc_NewData) + C_SdNdeUnoUtil::h_GetMemoryUsage(this->mc_PreviousData);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check if changes of this type can be merged
+
+   Type, array and auto min/max changes adapt further properties directly,
+   so only the last change could be undone after merging.
+
+   \param[in]  oe_DataChangeType   Data change type
+
+   \return
+   true  Changes can be merged
+   false Changes have to stay separate steps
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_SdNdeUnoLeDataPoolListElementDataChangeCommand::mh_IsMergeable(
+   const C_SdNdeDpUtil::E_ElementDataChangeType oe_DataChangeType)
+{
+   bool q_Retval;
+
+   switch (oe_DataChangeType)
+   {
+   case C_SdNdeDpUtil::eELEMENT_VALUE_TYPE:
+   case C_SdNdeDpUtil::eELEMENT_ARRAY:
+   case C_SdNdeDpUtil::eELEMENT_AUTO_MIN_MAX:
+      q_Retval = false;
+      break;
+   case C_SdNdeDpUtil::eELEMENT_NAME:
+   case C_SdNdeDpUtil::eELEMENT_COMMENT:
+   case C_SdNdeDpUtil::eELEMENT_MIN:
+   case C_SdNdeDpUtil::eELEMENT_MAX:
+   case C_SdNdeDpUtil::eELEMENT_FACTOR:
+   case C_SdNdeDpUtil::eELEMENT_OFFSET:
+   case C_SdNdeDpUtil::eELEMENT_UNIT:
+   case C_SdNdeDpUtil::eELEMENT_DATA_SET:
+   case C_SdNdeDpUtil::eELEMENT_ACCESS:
+   case C_SdNdeDpUtil::eELEMENT_EVENT_CALL:
+   default:
+      q_Retval = true;
+      break;
+   }
+   return q_Retval;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Change data values and store previous value
 
@@ -16,6 +16,7 @@
 #include <QVariant>
 #include "C_SdNdeUnoLeDataPoolListElementBaseCommand.hpp"
 #include "C_SdNdeDpUtil.hpp"
+#include "C_UtiUndoCommandMemoryBase.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 namespace stw
@@ -27,7 +28,8 @@ namespace opensyde_gui_logic
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
 class C_SdNdeUnoLeDataPoolListElementDataChangeCommand :
-   public C_SdNdeUnoLeDataPoolListElementBaseCommand
+   public C_SdNdeUnoLeDataPoolListElementBaseCommand,
+   public C_UtiUndoCommandMemoryBase
 {
 public:
    C_SdNdeUnoLeDataPoolListElementDataChangeCommand(const uint32_t & oru32_NodeIndex,
@@ -37,8 +39,14 @@ public:
                                                     QUndoCommand * const opc_Parent = NULL);
    void redo(void) override;
    void undo(void) override;
+   int32_t id(void) const override;
+   bool mergeWith(const QUndoCommand * const opc_Command) override;
+
+   uint64_t GetMemoryUsage(void) const override;
 
 private:
+   static const int32_t mhs32_COMMAND_ID;
+
    QVariant mc_PreviousData;
    QVariant mc_NewData;
    const uint32_t mu32_DataPoolListElementIndex;
@@ -48,6 +56,7 @@ private:
    bool mq_Initial;
 
    void m_Change(QVariant & orc_PreviousData, const QVariant & orc_NewData);
+   static bool mh_IsMergeable(const C_SdNdeDpUtil::E_ElementDataChangeType oe_DataChangeType);
    void m_ApplyAutoMin(void);
    void m_ApplyAutoMax(void);
    stw::opensyde_core::C_OscNodeDataPoolContent m_GetCurrentTypeMinGeneric(void) const;
@@ -15,6 +15,7 @@
 #include "precomp_headers.hpp"
 
 #include "stwerrors.hpp"
+#include "TglUtils.hpp"
 
 #include "C_SyvComDataDealer.hpp"
 #include "C_OscLoggingHandler.hpp"
@@ -323,10 +324,11 @@ void C_SyvComDataDealer::m_OnReadDataPoolEventReceivedForWidget(const uint8_t ou
    {
       const C_OscNodeDataPoolListElementId c_ElementId(this->mu32_NodeIndex, ou8_DataPoolIndex, ou16_ListIndex,
                                                        ou16_ElementIndex);
-      const C_OscNodeDataPoolContent * const pc_ElementContent =
-         &this->mpc_Node->GetDataPoolListElement(ou8_DataPoolIndex, ou16_ListIndex, ou16_ElementIndex)->c_Value;
+      C_OscNodeDataPoolContent c_ElementContent;
+      tgl_assert(this->mpc_Node->GetDataPoolListElementValue(ou8_DataPoolIndex, ou16_ListIndex, ou16_ElementIndex,
+                                                             c_ElementContent) == C_NO_ERR);
       // Create the necessary instance with a copy of the content. The timestamp will be filled in the constructor
-      const C_PuiSvDbDataElementContent c_DbContent(*pc_ElementContent);
+      const C_PuiSvDbDataElementContent c_DbContent(c_ElementContent);
 
       // Update the value
       opc_DashboardWidget->InsertNewValueIntoQueue(C_PuiSvDbNodeDataPoolListElementId(c_ElementId,
@@ -355,10 +357,11 @@ void C_SyvComDataDealer::m_OnReadDataPoolEventReceived(const uint8_t ou8_DataPoo
       {
          const QList<C_PuiSvDbDataElementHandler *> & rc_ListWidgets = c_ItElement.value();
          QList<C_PuiSvDbDataElementHandler *>::const_iterator c_ItWidget;
-         const C_OscNodeDataPoolContent * const pc_ElementContent =
-            &this->mpc_Node->GetDataPoolListElement(ou8_DataPoolIndex, ou16_ListIndex, ou16_ElementIndex)->c_Value;
+         C_OscNodeDataPoolContent c_ElementContent;
+         tgl_assert(this->mpc_Node->GetDataPoolListElementValue(ou8_DataPoolIndex, ou16_ListIndex, ou16_ElementIndex,
+                                                                c_ElementContent) == C_NO_ERR);
          // Create the necessary instance with a copy of the content. The timestamp will be filled in the constructor
-         const C_PuiSvDbDataElementContent c_DbContent(*pc_ElementContent);
+         const C_PuiSvDbDataElementContent c_DbContent(c_ElementContent);
 
          for (c_ItWidget = rc_ListWidgets.begin(); c_ItWidget != rc_ListWidgets.end(); ++c_ItWidget)
          {
@@ -454,10 +457,11 @@ void C_SyvComDataDealer::m_OnReadDataPoolNvmEventReceived(const uint8_t ou8_Data
       {
          const QList<C_PuiSvDbDataElementHandler *> & rc_ListWidgets = c_ItElement.value();
          QList<C_PuiSvDbDataElementHandler *>::const_iterator c_ItWidget;
-         const C_OscNodeDataPoolContent * const pc_ElementContent =
-            &this->mpc_Node->GetDataPoolListElement(ou8_DataPoolIndex, ou16_ListIndex, ou16_ElementIndex)->c_NvmValue;
+         C_OscNodeDataPoolContent c_ElementContent;
+         tgl_assert(this->mpc_Node->GetDataPoolListElementNvmValue(ou8_DataPoolIndex, ou16_ListIndex,
+                                                                   ou16_ElementIndex, c_ElementContent) == C_NO_ERR);
          // Create the necessary instance with a copy of the content. The timestamp will be filled in the constructor
-         const C_PuiSvDbDataElementContent c_DbContent(*pc_ElementContent);
+         const C_PuiSvDbDataElementContent c_DbContent(c_ElementContent);
 
          for (c_ItWidget = rc_ListWidgets.begin(); c_ItWidget != rc_ListWidgets.end(); ++c_ItWidget)
          {
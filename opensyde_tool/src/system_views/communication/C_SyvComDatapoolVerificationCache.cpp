@@ -0,0 +1,315 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Persistent cache of verified Datapools per device (implementation)
+
+   Connecting a dashboard reads the metadata of up to 32 Datapools per node and verifies each used Datapool.
+   With many nodes this dominates the connect time although the devices rarely change between two connects.
+
+   This cache remembers the result of a successful verification per device serial number.
+   An entry is only reused if both the device fingerprint (application version and software fingerprint as
+   reported by the device) and the hash over the local definition of the verified Datapools are unchanged.
+   So flashing the device or changing the project invalidates the entry automatically.
+
+   The entries are stored in an ini file in the user settings directory so they survive application restarts.
+   All access functions are thread safe as the nodes might be connected by several threads in parallel.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <QDir>
+#include <QFileInfo>
+
+#include "stwtypes.hpp"
+#include "stwerrors.hpp"
+#include "C_SclIniFile.hpp"
+#include "C_SclStringList.hpp"
+#include "C_SyvComDatapoolVerificationCache.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::scl;
+using namespace stw::opensyde_core;
+using namespace stw::opensyde_gui_logic;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const C_SclString C_SyvComDatapoolVerificationCache::mhc_SECTION_PREFIX = "Node_";
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SyvComDatapoolVerificationCache::C_Entry::C_Entry(void) :
+   u32_DefinitionHash(0U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SyvComDatapoolVerificationCache::C_SyvComDatapoolVerificationCache(void) :
+   mq_Changed(false)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Load all entries from file
+
+   Previously known entries are discarded.
+   A missing file is no error; the cache is empty in this case.
+   Incomplete entries are ignored.
+
+   \param[in]  orc_FilePath   Path of ini file; also used by Save
+
+   \return
+   C_NO_ERR   entries loaded
+   C_NOACT    file could not be parsed; cache is empty
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SyvComDatapoolVerificationCache::Load(const C_SclString & orc_FilePath)
+{
+   int32_t s32_Retval = C_NO_ERR;
+
+   this->mc_CriticalSection.Acquire();
+   this->mc_FilePath = orc_FilePath;
+   this->mc_Entries.clear();
+   this->mq_Changed = false;
+
+   if (QFileInfo::exists(orc_FilePath.c_str()) == true)
+   {
+      try
+      {
+         C_SclIniFile c_Ini(orc_FilePath);
+         C_SclStringList c_Sections;
+
+         c_Ini.ReadSections(&c_Sections);
+         for (uint32_t u32_ItSection = 0U; u32_ItSection < c_Sections.GetCount(); ++u32_ItSection)
+         {
+            const C_SclString & rc_Section = c_Sections.Strings[u32_ItSection];
+            if ((rc_Section.Length() > mhc_SECTION_PREFIX.Length()) &&
+                (rc_Section.SubString(1U, mhc_SECTION_PREFIX.Length()) == mhc_SECTION_PREFIX))
+            {
+               C_Entry c_Entry;
+               const int32_t s32_MetadataCount = c_Ini.ReadInteger(rc_Section, "MetadataCount", -1);
+               const int32_t s32_MappingCount = c_Ini.ReadInteger(rc_Section, "MappingCount", -1);
+               bool q_Valid = (s32_MetadataCount >= 0) && (s32_MappingCount >= 0);
+
+               c_Entry.c_DeviceFingerprint = c_Ini.ReadString(rc_Section, "DeviceFingerprint", "");
+               c_Entry.u32_DefinitionHash =
+                  static_cast<uint32_t>(c_Ini.ReadString(rc_Section, "DefinitionHash", "0").ToInt64());
+               for (int32_t s32_It = 0; (s32_It < s32_MetadataCount) && (q_Valid == true); ++s32_It)
+               {
+                  const C_SclString c_Key = "Metadata" + C_SclString::IntToStr(s32_It);
+                  C_OscProtocolDriverOsy::C_DataPoolMetaData c_Metadata;
+                  c_Metadata.c_Name = c_Ini.ReadString(rc_Section, c_Key + "Name", "");
+                  c_Metadata.au8_Version[0] = c_Ini.ReadUint8(rc_Section, c_Key + "VersionMajor", 0U);
+                  c_Metadata.au8_Version[1] = c_Ini.ReadUint8(rc_Section, c_Key + "VersionMinor", 0U);
+                  c_Metadata.au8_Version[2] = c_Ini.ReadUint8(rc_Section, c_Key + "VersionRelease", 0U);
+                  c_Entry.c_Metadata.push_back(c_Metadata);
+               }
+               for (int32_t s32_It = 0; (s32_It < s32_MappingCount) && (q_Valid == true); ++s32_It)
+               {
+                  const C_SclString c_Key = "Mapping" + C_SclString::IntToStr(s32_It);
+                  const int32_t s32_Client = c_Ini.ReadInteger(rc_Section, c_Key + "Client", -1);
+                  const int32_t s32_Server = c_Ini.ReadInteger(rc_Section, c_Key + "Server", -1);
+                  if ((s32_Client >= 0) && (s32_Client <= 255) && (s32_Server >= 0) && (s32_Server <= 255))
+                  {
+                     c_Entry.c_DatapoolMapping[static_cast<uint8_t>(s32_Client)] = static_cast<uint8_t>(s32_Server);
+                  }
+                  else
+                  {
+                     q_Valid = false;
+                  }
+               }
+               if ((q_Valid == true) && (c_Entry.c_DeviceFingerprint != ""))
+               {
+                  this->mc_Entries[rc_Section.SubString(mhc_SECTION_PREFIX.Length() + 1U,
+                                                        rc_Section.Length() - mhc_SECTION_PREFIX.Length())] =
+                     c_Entry;
+               }
+            }
+         }
+      }
+      catch (...)
+      {
+         this->mc_Entries.clear();
+         s32_Retval = C_NOACT;
+      }
+   }
+   this->mc_CriticalSection.Release();
+
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Save all entries to the file of the last Load call
+
+   Nothing is written if no entry was changed since the last Load or Save.
+
+   \return
+   C_NO_ERR   entries saved or nothing to do
+   C_CONFIG   Load was not called before
+   C_NOACT    file could not be written
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SyvComDatapoolVerificationCache::Save(void)
+{
+   int32_t s32_Retval = C_NO_ERR;
+
+   this->mc_CriticalSection.Acquire();
+   if (this->mc_FilePath == "")
+   {
+      s32_Retval = C_CONFIG;
+   }
+   else if (this->mq_Changed == true)
+   {
+      {
+         //Check if directory exists
+         const QDir c_Dir(QFileInfo(this->mc_FilePath.c_str()).path());
+         if (c_Dir.exists() == false)
+         {
+            c_Dir.mkpath(".");
+         }
+      }
+      try
+      {
+         C_SclIniFile c_Ini(this->mc_FilePath);
+         C_SclStringList c_Sections;
+         std::map<C_SclString, C_Entry>::const_iterator c_ItEntry;
+
+         //Rewrite the whole content so removed entries and stale keys disappear
+         c_Ini.ReadSections(&c_Sections);
+         for (uint32_t u32_ItSection = 0U; u32_ItSection < c_Sections.GetCount(); ++u32_ItSection)
+         {
+            c_Ini.EraseSection(c_Sections.Strings[u32_ItSection]);
+         }
+
+         for (c_ItEntry = this->mc_Entries.begin(); c_ItEntry != this->mc_Entries.end(); ++c_ItEntry)
+         {
+            const C_SclString c_Section = mhc_SECTION_PREFIX + c_ItEntry->first;
+            const C_Entry & rc_Entry = c_ItEntry->second;
+            std::list<C_OscProtocolDriverOsy::C_DataPoolMetaData>::const_iterator c_ItMetadata;
+            std::map<uint8_t, uint8_t>::const_iterator c_ItMapping;
+            int32_t s32_Counter = 0;
+
+            c_Ini.WriteString(c_Section, "DeviceFingerprint", rc_Entry.c_DeviceFingerprint);
+            c_Ini.WriteString(c_Section, "DefinitionHash", C_SclString::IntToStr(rc_Entry.u32_DefinitionHash));
+            c_Ini.WriteInteger(c_Section, "MetadataCount", static_cast<int32_t>(rc_Entry.c_Metadata.size()));
+            for (c_ItMetadata = rc_Entry.c_Metadata.begin(); c_ItMetadata != rc_Entry.c_Metadata.end();
+                 ++c_ItMetadata)
+            {
+               const C_SclString c_Key = "Metadata" + C_SclString::IntToStr(s32_Counter);
+               c_Ini.WriteString(c_Section, c_Key + "Name", c_ItMetadata->c_Name);
+               c_Ini.WriteInteger(c_Section, c_Key + "VersionMajor", c_ItMetadata->au8_Version[0]);
+               c_Ini.WriteInteger(c_Section, c_Key + "VersionMinor", c_ItMetadata->au8_Version[1]);
+               c_Ini.WriteInteger(c_Section, c_Key + "VersionRelease", c_ItMetadata->au8_Version[2]);
+               ++s32_Counter;
+            }
+            s32_Counter = 0;
+            c_Ini.WriteInteger(c_Section, "MappingCount", static_cast<int32_t>(rc_Entry.c_DatapoolMapping.size()));
+            for (c_ItMapping = rc_Entry.c_DatapoolMapping.begin(); c_ItMapping != rc_Entry.c_DatapoolMapping.end();
+                 ++c_ItMapping)
+            {
+               const C_SclString c_Key = "Mapping" + C_SclString::IntToStr(s32_Counter);
+               c_Ini.WriteInteger(c_Section, c_Key + "Client", c_ItMapping->first);
+               c_Ini.WriteInteger(c_Section, c_Key + "Server", c_ItMapping->second);
+               ++s32_Counter;
+            }
+         }
+         this->mq_Changed = false;
+      }
+      catch (...)
+      {
+         s32_Retval = C_NOACT;
+      }
+   }
+   else
+   {
+      //Nothing to do
+   }
+   this->mc_CriticalSection.Release();
+
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get cached verification result of device
+
+   \param[in]   orc_SerialNumber       Serial number of device
+   \param[in]   orc_DeviceFingerprint  Current fingerprint of device
+   \param[in]   ou32_DefinitionHash    Current hash over the local definition of the used Datapools
+   \param[out]  orc_Entry              Cached entry (only valid if true is returned)
+
+   \retval   true    entry found and still valid
+   \retval   false   no valid entry; Datapools have to be verified
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_SyvComDatapoolVerificationCache::GetEntry(const C_SclString & orc_SerialNumber,
+                                                 const C_SclString & orc_DeviceFingerprint,
+                                                 const uint32_t ou32_DefinitionHash, C_Entry & orc_Entry) const
+{
+   bool q_Retval = false;
+
+   std::map<C_SclString, C_Entry>::const_iterator c_It;
+
+   this->mc_CriticalSection.Acquire();
+   c_It = this->mc_Entries.find(orc_SerialNumber);
+   if ((c_It != this->mc_Entries.end()) &&
+       (c_It->second.c_DeviceFingerprint == orc_DeviceFingerprint) &&
+       (c_It->second.u32_DefinitionHash == ou32_DefinitionHash))
+   {
+      orc_Entry = c_It->second;
+      q_Retval = true;
+   }
+   this->mc_CriticalSection.Release();
+
+   return q_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Store verification result of device
+
+   Replaces an existing entry of the same device.
+
+   \param[in]  orc_SerialNumber  Serial number of device
+   \param[in]  orc_Entry         Result of successful verification
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComDatapoolVerificationCache::SetEntry(const C_SclString & orc_SerialNumber, const C_Entry & orc_Entry)
+{
+   this->mc_CriticalSection.Acquire();
+   this->mc_Entries[orc_SerialNumber] = orc_Entry;
+   this->mq_Changed = true;
+   this->mc_CriticalSection.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Remove entry of device
+
+   \param[in]  orc_SerialNumber  Serial number of device
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComDatapoolVerificationCache::RemoveEntry(const C_SclString & orc_SerialNumber)
+{
+   this->mc_CriticalSection.Acquire();
+   if (this->mc_Entries.erase(orc_SerialNumber) > 0U)
+   {
+      this->mq_Changed = true;
+   }
+   this->mc_CriticalSection.Release();
+}
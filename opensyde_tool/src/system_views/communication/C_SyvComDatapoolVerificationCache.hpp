@@ -0,0 +1,74 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Persistent cache of verified Datapools per device (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_SYVCOMDATAPOOLVERIFICATIONCACHE_HPP
+#define C_SYVCOMDATAPOOLVERIFICATIONCACHE_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <list>
+#include <map>
+
+#include "stwtypes.hpp"
+#include "C_SclString.hpp"
+#include "C_OscProtocolDriverOsy.hpp"
+#include "TglTasks.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_gui_logic
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_SyvComDatapoolVerificationCache
+{
+public:
+   class C_Entry
+   {
+   public:
+      C_Entry(void);
+
+      stw::scl::C_SclString c_DeviceFingerprint; ///< Application version and software fingerprint of device
+      uint32_t u32_DefinitionHash;               ///< Hash over the local definition of all verified Datapools
+      ///< Datapool metadata as read from the device
+      std::list<stw::opensyde_core::C_OscProtocolDriverOsy::C_DataPoolMetaData> c_Metadata;
+      std::map<uint8_t, uint8_t> c_DatapoolMapping; ///< Datapool index on client to index on server
+   };
+
+   C_SyvComDatapoolVerificationCache(void);
+
+   int32_t Load(const stw::scl::C_SclString & orc_FilePath);
+   int32_t Save(void);
+
+   bool GetEntry(const stw::scl::C_SclString & orc_SerialNumber, const stw::scl::C_SclString & orc_DeviceFingerprint,
+                 const uint32_t ou32_DefinitionHash, C_Entry & orc_Entry) const;
+   void SetEntry(const stw::scl::C_SclString & orc_SerialNumber, const C_Entry & orc_Entry);
+   void RemoveEntry(const stw::scl::C_SclString & orc_SerialNumber);
+
+private:
+   //Avoid call
+   C_SyvComDatapoolVerificationCache(const C_SyvComDatapoolVerificationCache &);
+   C_SyvComDatapoolVerificationCache & operator =(const C_SyvComDatapoolVerificationCache &) &;
+
+   stw::scl::C_SclString mc_FilePath;
+   std::map<stw::scl::C_SclString, C_Entry> mc_Entries; ///< Entries by serial number of device
+   bool mq_Changed;                                      ///< Flag if entries differ from file content
+   mutable stw::tgl::C_TglCriticalSection mc_CriticalSection;
+
+   static const stw::scl::C_SclString mhc_SECTION_PREFIX;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
@@ -14,6 +14,8 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "precomp_headers.hpp"
 
+#include <algorithm>
+
 #include "stwerrors.hpp"
 
 #include "C_SyvComDriverDiag.hpp"
@@ -25,7 +27,7 @@
 #include "C_Uti.hpp"
 #include "C_GtGetText.hpp"
 #include "C_SyvComDriverUtil.hpp"
-#include "C_OscCanUtil.hpp"
+#include "C_SclChecksums.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 using namespace stw::errors;
@@ -60,7 +62,9 @@ C_SyvComDriverDiag::C_SyvComDriverDiag(const uint32_t ou32_ViewIndex) :
    C_OscComDriverProtocol(),
    mu32_ViewIndex(ou32_ViewIndex),
    mpc_CanDllDispatcher(NULL),
-   mpc_EthernetDispatcher(NULL)
+   mpc_EthernetDispatcher(NULL),
+   mq_UseVerificationCache(false),
+   mq_ForceVerification(false)
 {
    mpc_AsyncThread = new C_SyvComDriverThread(&C_SyvComDriverDiag::mh_ThreadFunc, this);
 
@@ -244,6 +248,23 @@ int32_t C_SyvComDriverDiag::InitDiag(void)
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Activate or deactivate the Datapool verification cache
+
+   If active, the Datapool metadata read and verification on connect is skipped for openSYDE nodes which were
+   verified successfully before, still report the same application fingerprint and whose used Datapools did not
+   change in the project. The cache is stored in the user settings directory.
+
+   \param[in]  oq_Active               Flag if verification cache shall be used
+   \param[in]  oq_ForceVerification    Flag if all Datapools shall be verified anyway and the cache be refreshed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComDriverDiag::SetDatapoolVerificationCache(const bool oq_Active, const bool oq_ForceVerification)
+{
+   this->mq_UseVerificationCache = oq_Active;
+   this->mq_ForceVerification = oq_ForceVerification;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Sets all node into diagnostic mode with necessary security access
 
@@ -285,12 +306,10 @@ int32_t C_SyvComDriverDiag::SetDiagnosticMode(QString & orc_ErrorDetails)
       // Bring all nodes to the same session and security level
       // But check if the server is already in the correct session. The routing init has set some servers
       // to the session already
-      s32_Return = this->m_SetNodesSessionId(this->mc_ActiveDiagNodes,
-                                             C_OscProtocolDriverOsy::hu8_DIAGNOSTIC_SESSION_EXTENDED_DIAGNOSIS, true,
-                                             this->mc_DefectNodeIndices);
+      s32_Return = this->m_SetDiagNodesSessionId();
       if (s32_Return == C_NO_ERR)
       {
-         s32_Return = this->m_SetNodesSecurityAccess(this->mc_ActiveDiagNodes, 1U, this->mc_DefectNodeIndices);
+         s32_Return = this->m_SetDiagNodesSecurityAccess();
          if (s32_Return != C_NO_ERR)
          {
             osc_write_log_error("Initializing diagnostic protocol", "Could not get security access");
@@ -363,43 +382,15 @@ int32_t C_SyvComDriverDiag::SetUpCyclicTransmissions(QString & orc_ErrorDetails,
    else
    {
       uint32_t u32_DiagNodeCounter;
+
       //set up rails:
-      for (u32_DiagNodeCounter = 0U; u32_DiagNodeCounter < this->mc_ActiveDiagNodes.size(); u32_DiagNodeCounter++)
+      this->m_RunConnectStep(eCS_EVENT_DATA_RATES);
+      for (u32_DiagNodeCounter = 0U; u32_DiagNodeCounter < this->mc_ConnectResults.size(); u32_DiagNodeCounter++)
       {
-         // Get the original active node index
-         const uint32_t u32_ActiveNode = this->mc_ActiveDiagNodes[u32_DiagNodeCounter];
-         uint16_t u16_RateMs;
-         u16_RateMs = pc_View->GetUpdateRateFast();
-         s32_Return = this->mc_DiagProtocols[u32_ActiveNode]->DataPoolSetEventDataRate(0, u16_RateMs);
-         if (s32_Return == C_NO_ERR)
+         if (this->mc_ConnectResults[u32_DiagNodeCounter].s32_Result != C_NO_ERR)
          {
-            u16_RateMs = pc_View->GetUpdateRateMedium();
-            s32_Return = this->mc_DiagProtocols[u32_ActiveNode]->DataPoolSetEventDataRate(1, u16_RateMs);
-         }
-
-         if (s32_Return == C_NO_ERR)
-         {
-            u16_RateMs = pc_View->GetUpdateRateSlow();
-            s32_Return = this->mc_DiagProtocols[u32_ActiveNode]->DataPoolSetEventDataRate(2, u16_RateMs);
-         }
-
-         if (s32_Return != C_NO_ERR)
-         {
-            osc_write_log_warning(
-               "Asynchronous communication",
-               static_cast<QString>("Node \"%1\" - DataPoolSetEventDataRate - error: %2\n"
-                                    "C_RANGE    parameter out of range (checked by client-side function)\n"
-                                    "C_TIMEOUT  expected response not received within timeout\n"
-                                    "C_NOACT    could not send request (e.g. Tx buffer full)\n"
-                                    "C_CONFIG   pre-requisites not correct; e.g. driver not initialized\n"
-                                    "C_WARN     error response\n"
-                                    "C_RD_WR    malformed protocol response\n").arg(static_cast<QString>(
-                                                                                       m_GetActiveNodeName(
-                                                                                          u32_ActiveNode)
-                                                                                       .c_str())).arg(
-                  C_Uti::h_StwError(s32_Return)).toStdString().c_str());
-            s32_Return = C_COM;
-            orc_ErrorDetails += m_GetActiveNodeName(u32_ActiveNode).c_str();
+            s32_Return = this->mc_ConnectResults[u32_DiagNodeCounter].s32_Result;
+            orc_ErrorDetails += this->mc_ConnectResults[u32_DiagNodeCounter].c_ErrorDetails;
             break;
          }
       }
@@ -411,152 +402,44 @@ int32_t C_SyvComDriverDiag::SetUpCyclicTransmissions(QString & orc_ErrorDetails,
       //request all transmissions that are configured for the current view
       const QMap<C_OscNodeDataPoolListElementId, C_PuiSvReadDataConfiguration> & rc_Transmissions =
          pc_View->GetReadRailAssignments();
+      std::vector<uint32_t> c_FailedIdPositions;
+      uint32_t u32_DiagNodeCounter;
+
+      this->m_RunConnectStep(eCS_TRANSMISSIONS);
 
+      //report failed registrations in order of the view configuration
+      c_FailedIdPositions.resize(this->mc_ConnectResults.size(), 0U);
       for (QMap<C_OscNodeDataPoolListElementId, C_PuiSvReadDataConfiguration>::const_iterator c_It =
               rc_Transmissions.begin(); c_It != rc_Transmissions.end(); ++c_It)
       {
          bool q_Found;
-         //we need the node index within the list of active nodes:
          const uint32_t u32_ActiveDiagNodeIndex = this->m_GetActiveDiagIndex(c_It.key().u32_NodeIndex, &q_Found);
-         //Skip inactive nodes
          if (q_Found == true)
          {
-            const uint32_t u32_ActiveNodeIndex = this->mc_ActiveDiagNodes[u32_ActiveDiagNodeIndex];
-            uint8_t u8_NegResponseCode = 0;
-            //check for valid value ranges (node index is checked in "GetActiveIndex" function)
-            tgl_assert(c_It.key().u32_DataPoolIndex <= 0xFFU);
-            tgl_assert(c_It.key().u32_ListIndex <= 0xFFFFU);
-            tgl_assert(c_It.key().u32_ElementIndex <= 0xFFFFU);
-
-            if ((c_It.value().e_TransmissionMode == C_PuiSvReadDataConfiguration::eTM_CYCLIC) ||
-                (c_It.value().e_TransmissionMode == C_PuiSvReadDataConfiguration::eTM_ON_CHANGE))
+            const C_SyvComDriverDiagConnectResult & rc_Result = this->mc_ConnectResults[u32_ActiveDiagNodeIndex];
+            uint32_t & ru32_Position = c_FailedIdPositions[u32_ActiveDiagNodeIndex];
+            if ((ru32_Position < rc_Result.c_FailedIds.size()) &&
+                (rc_Result.c_FailedIds[ru32_Position] == c_It.key()))
             {
-               const std::map<uint32_t, uint32_t>::iterator c_ItNodesElementNumber = orc_NodesElementNumber.find(
-                  c_It.key().u32_NodeIndex);
-               if (c_ItNodesElementNumber == orc_NodesElementNumber.end())
-               {
-                  orc_NodesElementNumber[c_It.key().u32_NodeIndex] = 1U;
-               }
-               else
-               {
-                  c_ItNodesElementNumber->second = c_ItNodesElementNumber->second + 1;
-               }
+               orc_FailedIdRegisters.push_back(rc_Result.c_FailedIds[ru32_Position]);
+               orc_FailedIdErrorDetails.push_back(rc_Result.c_FailedIdErrorDetails[ru32_Position]);
+               ++ru32_Position;
             }
+         }
+      }
 
-            if (c_It.value().e_TransmissionMode == C_PuiSvReadDataConfiguration::eTM_CYCLIC)
-            {
-               s32_Return = this->mc_DiagProtocols[u32_ActiveNodeIndex]->DataPoolReadCyclic(
-                  static_cast<uint8_t>(c_It.key().u32_DataPoolIndex), static_cast<uint16_t>(c_It.key().u32_ListIndex),
-                  static_cast<uint16_t>(c_It.key().u32_ElementIndex), c_It.value().u8_RailIndex, &u8_NegResponseCode);
-            }
-            else if (c_It.value().e_TransmissionMode == C_PuiSvReadDataConfiguration::eTM_ON_CHANGE)
-            {
-               //convert the type dependent threshold to a uint32_t representation
-               std::vector<uint8_t> c_Threshold;
-               uint32_t u32_Threshold;
-               c_It.value().c_ChangeThreshold.GetValueAsLittleEndianBlob(c_Threshold);
-               //defensive measure: as element may only be up to 32bit the threshold may also not be > 32bit
-               tgl_assert(c_Threshold.size() <= 4);
-               //fill up to 4 bytes with zeroes
-               c_Threshold.resize(4, 0U);
-               //finally compose the uint32_t:
-               u32_Threshold = c_Threshold[0] +
-                               (static_cast<uint32_t>(c_Threshold[1]) << 8U) +
-                               (static_cast<uint32_t>(c_Threshold[2]) << 16U) +
-                               (static_cast<uint32_t>(c_Threshold[3]) << 24U);
-
-               s32_Return = this->mc_DiagProtocols[u32_ActiveNodeIndex]->DataPoolReadChangeDriven(
-                  static_cast<uint8_t>(c_It.key().u32_DataPoolIndex), static_cast<uint16_t>(c_It.key().u32_ListIndex),
-                  static_cast<uint16_t>(c_It.key().u32_ElementIndex),
-                  c_It.value().u8_RailIndex, u32_Threshold, &u8_NegResponseCode);
-            }
-            else
-            {
-               // No registration necessary
-               s32_Return = C_NO_ERR;
-            }
-            //Both services map to the same error
-            if (s32_Return != C_NO_ERR)
-            {
-               QString c_AdditionalInfo;
-               QString c_Details;
-               std::map<uint32_t, uint32_t>::iterator c_ItFailedNodesElementNumber;
-
-               switch (s32_Return)
-               {
-               case C_RANGE:
-                  c_Details = C_GtGetText::h_GetText("Parameter out of range (checked by client-side function)");
-                  break;
-               case C_NOACT:
-                  c_Details = C_GtGetText::h_GetText("Could not send request (e.g. Tx buffer full)");
-                  break;
-               case C_CONFIG:
-                  c_Details = C_GtGetText::h_GetText("Pre-requisites not correct; e.g. driver not initialized");
-                  break;
-               case C_WARN:
-                  switch (u8_NegResponseCode)
-                  {
-                  case 0x13:
-                     c_AdditionalInfo = C_GtGetText::h_GetText("Incorrect length of request");
-                     break;
-                  case 0x22:
-                     c_AdditionalInfo = C_GtGetText::h_GetText(
-                        "Datapool element specified by data identifier cannot be transferred event driven (invalid data type)");
-                     break;
-                  case 0x70:
-                     c_AdditionalInfo = C_GtGetText::h_GetText("Too many transmissions already registered");
-
-                     c_ItFailedNodesElementNumber = orc_FailedNodesElementNumber.find(c_It.key().u32_NodeIndex);
-
-                     if (c_ItFailedNodesElementNumber == orc_FailedNodesElementNumber.end())
-                     {
-                        // Save the information about the number of the first element which failed
-                        orc_FailedNodesElementNumber[c_It.key().u32_NodeIndex] =
-                           orc_NodesElementNumber[c_It.key().u32_NodeIndex];
-                     }
-                     break;
-                  case 0x31:
-                     c_AdditionalInfo = C_GtGetText::h_GetText("Invalid transmission mode.\n"
-                                                               "\n"
-                                                               "When initiating transmission:\n"
-                                                               "- Datapool element specified by data identifier is not available\n"
-                                                               "- changeDrivenThreshold is zero\n"
-                                                               "\n"
-                                                               "When stopping transmission:\n"
-                                                               "- Datapool element specified by data identifier is currently not transferred event driven");
-                     break;
-                  case 0x33:
-                     c_AdditionalInfo = C_GtGetText::h_GetText("Required security level was not unlocked");
-                     break;
-                  case 0x14:
-                     c_AdditionalInfo = C_GtGetText::h_GetText(
-                        "The total length of the event driven response messages would exceed the available buffer size");
-                     break;
-                  case 0x7F:
-                     c_AdditionalInfo = C_GtGetText::h_GetText(
-                        "The requested service is not available in the session currently active");
-                     break;
-                  default:
-                     c_AdditionalInfo =
-                        static_cast<QString>(C_GtGetText::h_GetText("Unknown NRC: 0x%1")).arg(QString::number(
-                                                                                                 u8_NegResponseCode,
-                                                                                                 16));
-                     break;
-                  }
-                  c_Details = static_cast<QString>(C_GtGetText::h_GetText("Error response (%1)")).arg(c_AdditionalInfo);
-                  break;
-               case C_RD_WR:
-                  c_Details = C_GtGetText::h_GetText("Malformed protocol response");
-                  break;
-               default:
-                  c_Details = C_GtGetText::h_GetText("Unknown error");
-                  break;
-               }
-               orc_FailedIdErrorDetails.push_back(c_Details);
-               orc_FailedIdRegisters.push_back(c_It.key());
-               //Error can be ignored, user feedback is different
-               s32_Return = C_NO_ERR;
-            }
+      for (u32_DiagNodeCounter = 0U; u32_DiagNodeCounter < this->mc_ConnectResults.size(); u32_DiagNodeCounter++)
+      {
+         const C_SyvComDriverDiagConnectResult & rc_Result = this->mc_ConnectResults[u32_DiagNodeCounter];
+         const uint32_t u32_NodeIndex =
+            this->mc_ActiveNodesIndexes[this->mc_ActiveDiagNodes[u32_DiagNodeCounter]];
+         if (rc_Result.u32_ElementNumber > 0U)
+         {
+            orc_NodesElementNumber[u32_NodeIndex] = rc_Result.u32_ElementNumber;
+         }
+         if (rc_Result.u32_FailedElementNumber > 0U)
+         {
+            orc_FailedNodesElementNumber[u32_NodeIndex] = rc_Result.u32_FailedElementNumber;
          }
       }
    }
@@ -1368,6 +1251,11 @@ void C_SyvComDriverDiag::RegisterWidget(C_PuiSvDbDataElementHandler * const opc_
                         {
                            // Save the multiplexer signal
                            c_WidgetRegistration.c_MultiplexerSignal = pc_CanMsg->c_Signals[u32_SignalCounter];
+                           // Multiplexer can be maximum 16 bit
+                           c_WidgetRegistration.c_MultiplexerExtraction.Compile(
+                              c_WidgetRegistration.c_MultiplexerSignal,
+                              (c_WidgetRegistration.c_MultiplexerSignal.u16_ComBitLength > 8U) ?
+                              C_OscNodeDataPoolContent::eUINT16 : C_OscNodeDataPoolContent::eUINT8);
                            q_MultiplexerSignalFound = true;
                            break;
                         }
@@ -1383,7 +1271,12 @@ void C_SyvComDriverDiag::RegisterWidget(C_PuiSvDbDataElementHandler * const opc_
                   c_WidgetRegistration.c_ElementId = c_DpElementId;
                   // Save the value content to have the content instance with the correct type as template for
                   // the new values
-                  c_WidgetRegistration.c_ElementContent = pc_Element->c_Value;
+                  tgl_assert(C_PuiSdHandler::h_GetInstance()->GetDataPoolListElementValue(
+                                c_DpElementId.u32_NodeIndex, c_DpElementId.u32_DataPoolIndex,
+                                c_DpElementId.u32_ListIndex, c_DpElementId.u32_ElementIndex,
+                                c_WidgetRegistration.c_ElementContent) == C_NO_ERR);
+                  c_WidgetRegistration.c_SignalExtraction.Compile(c_WidgetRegistration.c_Signal,
+                                                                  pc_Element->c_Value.GetType());
 
                   c_ItElement = this->mc_AllWidgets.find(c_MsgCanId);
 
@@ -1605,43 +1498,24 @@ void C_SyvComDriverDiag::m_HandleCanMessage(const T_STWCAN_Msg_RX & orc_Msg, con
             if (rc_WidgetRegistration.c_Signal.e_MultiplexerType != C_OscCanSignal::eMUX_MULTIPLEXED_SIGNAL)
             {
                // No multiplexed signal, no dependency of a multiplexer value
-               q_SignalFits = C_OscCanUtil::h_IsSignalInMessage(orc_Msg.u8_DLC, rc_WidgetRegistration.c_Signal);
+               q_SignalFits = rc_WidgetRegistration.c_SignalExtraction.IsInMessage(orc_Msg.u8_DLC);
             }
             else
             {
                // Multiplexed signal. Checking the multiplexer signal first
-               q_SignalFits = C_OscCanUtil::h_IsSignalInMessage(orc_Msg.u8_DLC,
-                                                                rc_WidgetRegistration.c_MultiplexerSignal);
+               q_SignalFits = rc_WidgetRegistration.c_MultiplexerExtraction.IsInMessage(orc_Msg.u8_DLC);
 
                if (q_SignalFits == true)
                {
                   // Multiplexer fits into the message. Get the multiplexer value
-                  C_PuiSvDbDataElementContent c_MultiplexerContent;
-                  C_OscCanUtil::h_GetSignalValue(orc_Msg.au8_Data, rc_WidgetRegistration.c_MultiplexerSignal,
-                                                 c_MultiplexerContent);
-                  const C_OscNodeDataPoolContent::E_Type e_Type = c_MultiplexerContent.GetType();
-                  uint16_t u16_MultiplexerValue;
-
-                  // Multiplexer can be maximum 16 bit
-                  if (e_Type == C_OscNodeDataPoolContent::eUINT8)
-                  {
-                     u16_MultiplexerValue = c_MultiplexerContent.GetValueU8();
-                  }
-                  else if (e_Type == C_OscNodeDataPoolContent::eUINT16)
-                  {
-                     u16_MultiplexerValue = c_MultiplexerContent.GetValueU16();
-                  }
-                  else
-                  {
-                     // May not happen
-                     tgl_assert(false);
-                     u16_MultiplexerValue = 0;
-                  }
+                  const uint16_t u16_MultiplexerValue =
+                     static_cast<uint16_t>(rc_WidgetRegistration.c_MultiplexerExtraction.ExtractRawValue(
+                                              orc_Msg.au8_Data));
 
                   if (rc_WidgetRegistration.c_Signal.u16_MultiplexValue == u16_MultiplexerValue)
                   {
                      // The multiplexer value is matching. The signal is in the message.
-                     q_SignalFits = C_OscCanUtil::h_IsSignalInMessage(orc_Msg.u8_DLC, rc_WidgetRegistration.c_Signal);
+                     q_SignalFits = rc_WidgetRegistration.c_SignalExtraction.IsInMessage(orc_Msg.u8_DLC);
                   }
                   else
                   {
@@ -1659,7 +1533,8 @@ void C_SyvComDriverDiag::m_HandleCanMessage(const T_STWCAN_Msg_RX & orc_Msg, con
 
                // Get the content
                c_Content = rc_WidgetRegistration.c_ElementContent;
-               C_OscCanUtil::h_GetSignalValue(orc_Msg.au8_Data, rc_WidgetRegistration.c_Signal, c_Content);
+               rc_WidgetRegistration.c_SignalExtraction.SetContentValue(
+                  rc_WidgetRegistration.c_SignalExtraction.ExtractRawValue(orc_Msg.au8_Data), c_Content);
                c_Content.SetTimeStamp(static_cast<uint32_t>(u64_TimeStamp));
 
                rc_WidgetRegistration.pc_Handler->InsertNewValueIntoQueue(rc_WidgetRegistration.c_ElementId,
@@ -1720,6 +1595,17 @@ bool C_SyvComDriverDiag::C_SyvComDriverDiagWidgetRegistration::operator ==(
    return q_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SyvComDriverDiag::C_SyvComDriverDiagConnectResult::C_SyvComDriverDiagConnectResult(void) :
+   s32_Result(C_NO_ERR),
+   u32_ElementNumber(0U),
+   u32_FailedElementNumber(0U)
+{
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Detects all nodes which are used in current dashboard
 
@@ -2010,6 +1896,124 @@ int32_t C_SyvComDriverDiag::m_StartRoutingDiag(QString & orc_ErrorDetails, std::
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Sets all active diag nodes into the extended diagnostic session
+
+   Same behavior as m_SetNodesSessionId, the requests are distributed by m_RunConnectStep.
+   Nodes with previous errors registered in mc_DefectNodeIndices will be skipped.
+
+   \return
+   C_NO_ERR    All nodes set to session successfully
+   C_CONFIG    Init function was not called or not successful or protocol was not initialized properly.
+   C_COM       Error of service
+   C_TIMEOUT   Expected response not received within timeout
+               or at least one node was registered in mc_DefectNodeIndices
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SyvComDriverDiag::m_SetDiagNodesSessionId(void)
+{
+   int32_t s32_Retval = C_NO_ERR;
+
+   if (this->mq_Initialized == true)
+   {
+      uint32_t u32_DiagNodeCounter;
+
+      this->m_RunConnectStep(eCS_SESSION);
+
+      for (u32_DiagNodeCounter = 0U; u32_DiagNodeCounter < this->mc_ConnectResults.size(); ++u32_DiagNodeCounter)
+      {
+         const uint32_t u32_ActiveNode = this->mc_ActiveDiagNodes[u32_DiagNodeCounter];
+         const int32_t s32_Return = this->mc_ConnectResults[u32_DiagNodeCounter].s32_Result;
+
+         if (this->mc_DefectNodeIndices.find(u32_ActiveNode) != this->mc_DefectNodeIndices.end())
+         {
+            // It was a previous error. Only in case of a previous timeout it would be continued to here
+            s32_Retval = C_TIMEOUT;
+         }
+         else if ((s32_Return != C_NO_ERR) && (s32_Return != C_NOACT))
+         {
+            // Do not change the C_TIMEOUT error
+            if ((s32_Return != C_TIMEOUT) && (s32_Return != C_WARN))
+            {
+               s32_Retval = C_COM;
+            }
+            else
+            {
+               s32_Retval = s32_Return;
+            }
+            this->mc_DefectNodeIndices.insert(u32_ActiveNode);
+         }
+         else
+         {
+            // Node is in session or has no openSYDE protocol
+         }
+      }
+   }
+   else
+   {
+      s32_Retval = C_CONFIG;
+   }
+
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Sets all active diag nodes into the security level for diagnostics
+
+   Same behavior as m_SetNodesSecurityAccess, the requests are distributed by m_RunConnectStep.
+   The first failed node (in order of mc_ActiveDiagNodes) is registered in mc_DefectNodeIndices.
+
+   \return
+   C_NO_ERR    All nodes set to security level successfully
+   C_CONFIG    Init function was not called or not successful or protocol was not initialized properly.
+   C_COM       Error of service
+   C_TIMEOUT   Expected response not received within timeout
+   C_CHECKSUM  Security related error (something went wrong while handshaking with the server)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SyvComDriverDiag::m_SetDiagNodesSecurityAccess(void)
+{
+   int32_t s32_Retval = C_CONFIG;
+
+   if (this->mq_Initialized == true)
+   {
+      uint32_t u32_DiagNodeCounter;
+
+      s32_Retval = C_NO_ERR;
+
+      this->m_RunConnectStep(eCS_SECURITY_ACCESS);
+
+      for (u32_DiagNodeCounter = 0U; u32_DiagNodeCounter < this->mc_ConnectResults.size(); ++u32_DiagNodeCounter)
+      {
+         const uint32_t u32_ActiveNode = this->mc_ActiveDiagNodes[u32_DiagNodeCounter];
+         const int32_t s32_Return = this->mc_ConnectResults[u32_DiagNodeCounter].s32_Result;
+
+         if ((s32_Return != C_NO_ERR) &&
+             (s32_Return != C_NOACT))
+         {
+            //Store invalid node
+            if (u32_ActiveNode < this->mc_ActiveNodesIndexes.size())
+            {
+               this->mc_DefectNodeIndices.insert(this->mc_ActiveNodesIndexes[u32_ActiveNode]);
+            }
+            // Do not change the C_TIMEOUT and C_CHECKSUM error
+            if ((s32_Return != C_TIMEOUT) &&
+                (s32_Return != C_CHECKSUM))
+            {
+               s32_Retval = C_COM;
+            }
+            else
+            {
+               s32_Retval = s32_Return;
+            }
+            break;
+         }
+      }
+   }
+
+   return s32_Retval;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Starts the diagnose servers
 
@@ -2041,99 +2045,204 @@ int32_t C_SyvComDriverDiag::m_StartDiagServers(QString & orc_ErrorDetails)
 
       this->mc_ReadDatapoolMetadata.resize(this->mc_ActiveDiagNodes.size());
 
-      for (u32_DiagNodeCounter = 0U; u32_DiagNodeCounter < this->mc_ActiveDiagNodes.size(); ++u32_DiagNodeCounter)
+      if (this->mq_UseVerificationCache == true)
       {
-         // Get the original active node index
-         const uint32_t u32_ActiveNode = this->mc_ActiveDiagNodes[u32_DiagNodeCounter];
-         // Check only if Datapool of node is really used
-         if (this->mc_DiagNodesWithElements.find(this->mc_ActiveNodesIndexes[u32_ActiveNode]) !=
-             this->mc_DiagNodesWithElements.end())
+         // Reload each time as other instances of the application might have updated the file
+         if (this->mc_VerificationCache.Load((C_Uti::h_GetExePath() +
+                                              "/User/dashboard_verification_cache.ini").toStdString().c_str()) !=
+             C_NO_ERR)
          {
-            const C_OscNode * const pc_Node =
-               C_PuiSdHandler::h_GetInstance()->GetOscNodeConst(this->mc_ActiveNodesIndexes[u32_ActiveNode]);
+            osc_write_log_warning("Starting diagnostics", "Could not load Datapool verification cache.");
+         }
+      }
 
-            if (pc_Node != NULL)
+      this->m_RunConnectStep(eCS_DIAG_SERVERS);
+
+      if (this->mq_UseVerificationCache == true)
+      {
+         if (this->mc_VerificationCache.Save() != C_NO_ERR)
+         {
+            osc_write_log_warning("Starting diagnostics", "Could not save Datapool verification cache.");
+         }
+      }
+      for (u32_DiagNodeCounter = 0U; u32_DiagNodeCounter < this->mc_ConnectResults.size(); ++u32_DiagNodeCounter)
+      {
+         orc_ErrorDetails += this->mc_ConnectResults[u32_DiagNodeCounter].c_ErrorDetails;
+         if (this->mc_ConnectResults[u32_DiagNodeCounter].s32_Result != C_NO_ERR)
+         {
+            // Do not overwrite previous errors with C_NO_ERR
+            s32_Retval = this->mc_ConnectResults[u32_DiagNodeCounter].s32_Result;
+         }
+      }
+   }
+   else if ((this->mq_Initialized == true) &&
+            (this->mc_DiagProtocols.size() == 0U) &&
+            (this->mc_ActiveDiagNodes.size() == 0U))
+   {
+      // Special case: No error. No connectable nodes, but nodes third party nodes could be active
+      s32_Retval = C_NO_ERR;
+   }
+   else
+   {
+      s32_Retval = C_CONFIG;
+   }
+
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Starts the diagnose server of one node
+
+   Reads the Datapool metadata of the node and verifies all used Datapools.
+
+   \param[in]      ou32_ActiveDiagNodeIndex   Active diag node index (mc_ActiveDiagNodes)
+   \param[in,out]  orc_ErrorDetails           Details for current error
+
+   \return
+   C_NO_ERR   Datapools verified or node does not use any Datapool on this dashboard
+   C_TIMEOUT  expected response not received within timeout
+   C_NOACT    could not send request (e.g. Tx buffer full)
+   C_CONFIG   pre-requisites not correct; e.g. driver not initialized
+   C_WARN     error response
+   C_RD_WR    malformed protocol response
+   C_DEFAULT  checksum of datapool does not match
+              Datapool with the name orc_DatapoolName does not exist on the server
+   C_COM      communication driver reported error
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SyvComDriverDiag::m_StartDiagServer(const uint32_t ou32_ActiveDiagNodeIndex, QString & orc_ErrorDetails)
+{
+   int32_t s32_Retval = C_NO_ERR;
+   // Get the original active node index
+   const uint32_t u32_ActiveNode = this->mc_ActiveDiagNodes[ou32_ActiveDiagNodeIndex];
+
+   // Check only if Datapool of node is really used
+   if (this->mc_DiagNodesWithElements.find(this->mc_ActiveNodesIndexes[u32_ActiveNode]) !=
+       this->mc_DiagNodesWithElements.end())
+   {
+      const C_OscNode * const pc_Node =
+         C_PuiSdHandler::h_GetInstance()->GetOscNodeConst(this->mc_ActiveNodesIndexes[u32_ActiveNode]);
+
+      if (pc_Node != NULL)
+      {
+         if (pc_Node->c_Properties.e_DiagnosticServer == C_OscNodeProperties::eDS_KEFEX)
+         {
+            // Activate when supporting Kefex on dashboard
+            /*
+            uint8_t u8_DataPoolIndex;
+            uint16_t u16_NumberOfDataPoolElements;
+            uint16_t u16_DataPoolVersion;
+
+            u8_DataPoolIndex = 0U;
+            u16_NumberOfDataPoolElements = 0x0049U;
+            u16_DataPoolVersion = 0x0000U;
+            u32_DataPoolChecksum = 0xC4CBU;
+            s32_Return = this->mc_DiagProtocols[u32_Counter]->DataPoolVerify(u8_DataPoolIndex,
+                                                                             u16_NumberOfDataPoolElements,
+                                                                             u16_DataPoolVersion,
+                                                                             u32_DataPoolChecksum,
+                                                                             q_Match);
+
+            if ((s32_Return != C_NO_ERR) || (q_Match == false))
             {
-               if (pc_Node->c_Properties.e_DiagnosticServer == C_OscNodeProperties::eDS_KEFEX)
+               if ((s32_Return == C_NO_ERR) && (q_Match == false))
                {
-                  // Activate when supporting Kefex on dashboard
-                  /*
-                  uint8_t u8_DataPoolIndex;
-                  uint16_t u16_NumberOfDataPoolElements;
-                  uint16_t u16_DataPoolVersion;
-
-                  u8_DataPoolIndex = 0U;
-                  u16_NumberOfDataPoolElements = 0x0049U;
-                  u16_DataPoolVersion = 0x0000U;
-                  u32_DataPoolChecksum = 0xC4CBU;
-                  s32_Return = this->mc_DiagProtocols[u32_Counter]->DataPoolVerify(u8_DataPoolIndex,
-                                                                                   u16_NumberOfDataPoolElements,
-                                                                                   u16_DataPoolVersion,
-                                                                                   u32_DataPoolChecksum,
-                                                                                   q_Match);
-
-                  if ((s32_Return != C_NO_ERR) || (q_Match == false))
-                  {
-                     if ((s32_Return == C_NO_ERR) && (q_Match == false))
-                     {
-                        stw::scl::C_SclString c_Error;
-                        c_Error.PrintFormatted("Datapool verify failed between client and server. Node: %s " \
-                                               "Datapool: %s", pc_Node->c_Properties.c_Name.c_str(),
-                                               pc_Node->c_DataPools[u8_DataPoolIndex].c_Name.c_str());
-                        osc_write_log_error("Starting diagnostics", c_Error);
-                        // Datapool checksum does not match
-                        s32_Retval = C_DEFAULT;
-                     }
-                     else
-                     {
-                        s32_Retval = s32_Return;
-                     }
-                     if (s32_Retval != C_NO_ERR)
-                     {
-                        orc_ErrorDetails += static_cast<QString>("- ") + pc_Node->c_Properties.c_Name.c_str() +
-                                            ", Datapool: \"" +
-                                            pc_Node->c_DataPools[u8_DataPoolIndex].c_Name.c_str() + "\"\n";
-                     }
-                  }
-                  */
+                  stw::scl::C_SclString c_Error;
+                  c_Error.PrintFormatted("Datapool verify failed between client and server. Node: %s " \
+                                         "Datapool: %s", pc_Node->c_Properties.c_Name.c_str(),
+                                         pc_Node->c_DataPools[u8_DataPoolIndex].c_Name.c_str());
+                  osc_write_log_error("Starting diagnostics", c_Error);
+                  // Datapool checksum does not match
+                  s32_Retval = C_DEFAULT;
                }
                else
                {
-                  int32_t s32_Return;
+                  s32_Retval = s32_Return;
+               }
+               if (s32_Retval != C_NO_ERR)
+               {
+                  orc_ErrorDetails += static_cast<QString>("- ") + pc_Node->c_Properties.c_Name.c_str() +
+                                      ", Datapool: \"" +
+                                      pc_Node->c_DataPools[u8_DataPoolIndex].c_Name.c_str() + "\"\n";
+               }
+            }
+            */
+         }
+         else
+         {
+            int32_t s32_Return;
+            C_SclString c_SerialNumber;
+            C_SyvComDatapoolVerificationCache::C_Entry c_CacheEntry;
+            bool q_CacheUsable = false;
 
-                  // Get all Datapool names on node to create the mapping
-                  s32_Return = this->m_GetAllDatapoolMetadata(u32_DiagNodeCounter, orc_ErrorDetails);
+            if (this->mq_UseVerificationCache == true)
+            {
+               q_CacheUsable = this->m_GetVerificationCacheKeys(ou32_ActiveDiagNodeIndex, c_SerialNumber,
+                                                                c_CacheEntry.c_DeviceFingerprint,
+                                                                c_CacheEntry.u32_DefinitionHash);
+            }
 
+            if ((q_CacheUsable == true) && (this->mq_ForceVerification == false) &&
+                (this->mc_VerificationCache.GetEntry(c_SerialNumber, c_CacheEntry.c_DeviceFingerprint,
+                                                     c_CacheEntry.u32_DefinitionHash, c_CacheEntry) == true))
+            {
+               // Device and used Datapools did not change since last successful verification
+               C_OscDiagProtocolOsy * const pc_Protocol =
+                  dynamic_cast<C_OscDiagProtocolOsy *>(this->mc_DiagProtocols[u32_ActiveNode]);
+               if (pc_Protocol != NULL)
+               {
+                  this->mc_ReadDatapoolMetadata[ou32_ActiveDiagNodeIndex] = c_CacheEntry.c_Metadata;
+                  pc_Protocol->RegisterDataPoolMapping(c_CacheEntry.c_DatapoolMapping);
+                  osc_write_log_info("Starting diagnostics",
+                                     "Datapools of node " + pc_Node->c_Properties.c_Name +
+                                     " unchanged since last verification. Using cached result.");
+                  s32_Return = C_NO_ERR;
+               }
+               else
+               {
+                  s32_Return = C_CONFIG;
+               }
+            }
+            else
+            {
+               std::map<uint8_t, uint8_t> c_DatapoolMapping;
+
+               // Get all Datapool names on node to create the mapping
+               s32_Return = this->m_GetAllDatapoolMetadata(ou32_ActiveDiagNodeIndex, orc_ErrorDetails);
+
+               if (s32_Return == C_NO_ERR)
+               {
+                  // Verify all used Datapools for checksum and version
+                  s32_Return = this->m_CheckOsyDatapoolsAndCreateMapping(ou32_ActiveDiagNodeIndex, orc_ErrorDetails,
+                                                                         c_DatapoolMapping);
+               }
+
+               if (q_CacheUsable == true)
+               {
                   if (s32_Return == C_NO_ERR)
                   {
-                     // Verify all used Datapools for checksum and version
-                     s32_Return = this->m_CheckOsyDatapoolsAndCreateMapping(u32_DiagNodeCounter, orc_ErrorDetails);
+                     c_CacheEntry.c_Metadata = this->mc_ReadDatapoolMetadata[ou32_ActiveDiagNodeIndex];
+                     c_CacheEntry.c_DatapoolMapping = c_DatapoolMapping;
+                     this->mc_VerificationCache.SetEntry(c_SerialNumber, c_CacheEntry);
                   }
-
-                  if (s32_Return != C_NO_ERR)
+                  else
                   {
-                     // Do not overwrite previous errors with C_NO_ERR
-                     s32_Retval = s32_Return;
+                     this->mc_VerificationCache.RemoveEntry(c_SerialNumber);
                   }
                }
             }
-            else
+
+            if (s32_Return != C_NO_ERR)
             {
-               s32_Retval = C_CONFIG;
+               // Do not overwrite previous errors with C_NO_ERR
+               s32_Retval = s32_Return;
             }
          }
       }
-   }
-   else if ((this->mq_Initialized == true) &&
-            (this->mc_DiagProtocols.size() == 0U) &&
-            (this->mc_ActiveDiagNodes.size() == 0U))
-   {
-      // Special case: No error. No connectable nodes, but nodes third party nodes could be active
-      s32_Retval = C_NO_ERR;
-   }
-   else
-   {
-      s32_Retval = C_CONFIG;
+      else
+      {
+         s32_Retval = C_CONFIG;
+      }
    }
 
    return s32_Retval;
@@ -2242,6 +2351,7 @@ int32_t C_SyvComDriverDiag::m_GetAllDatapoolMetadata(const uint32_t ou32_ActiveD
 
    \param[in]      ou32_ActiveDiagNodeIndex  Active diag node index (mc_ActiveDiagNodes)
    \param[in,out]  orc_ErrorDetails          Details for current error
+   \param[out]     orc_DatapoolMapping       Registered mapping of Datapool indices from client to server
 
    \return
    C_NO_ERR   Datapools are as expected
@@ -2254,7 +2364,8 @@ int32_t C_SyvComDriverDiag::m_GetAllDatapoolMetadata(const uint32_t ou32_ActiveD
 */
 //----------------------------------------------------------------------------------------------------------------------
 int32_t C_SyvComDriverDiag::m_CheckOsyDatapoolsAndCreateMapping(const uint32_t ou32_ActiveDiagNodeIndex,
-                                                                QString & orc_ErrorDetails)
+                                                                QString & orc_ErrorDetails,
+                                                                std::map<uint8_t, uint8_t> & orc_DatapoolMapping)
 {
    int32_t s32_Retval = C_CONFIG;
    QString c_DataPoolErrorString = "";
@@ -2272,30 +2383,16 @@ int32_t C_SyvComDriverDiag::m_CheckOsyDatapoolsAndCreateMapping(const uint32_t o
        (pc_Node != NULL) &&
        (pc_Protocol != NULL))
    {
-      // Get all registered Datapool elements for comparing. Check only used Datapools
-      std::set<C_OscNodeDataPoolListElementId> c_RegisteredElementIds;
-      pc_View->GetAllRegisteredDashboardElements(c_RegisteredElementIds);
-      std::map<uint8_t, uint8_t> c_DatapoolMapping;
+      // Check only used Datapools
+      std::vector<uint32_t> c_UsedDatapools;
+      this->m_GetUsedDatapools(u32_NodeIndex, c_UsedDatapools);
+      orc_DatapoolMapping.clear();
 
       s32_Retval = C_NO_ERR;
 
       for (uint32_t u32_ItDataPool = 0; u32_ItDataPool < pc_Node->c_DataPools.size(); ++u32_ItDataPool)
       {
-         std::set<C_OscNodeDataPoolListElementId>::const_iterator c_ItElement;
-         bool q_DatapoolRelevant = false;
-
-         // Search for a usage of the Datapool
-         for (c_ItElement = c_RegisteredElementIds.begin(); c_ItElement != c_RegisteredElementIds.end(); ++c_ItElement)
-         {
-            if (((*c_ItElement).u32_NodeIndex == u32_NodeIndex) &&
-                ((*c_ItElement).u32_DataPoolIndex == u32_ItDataPool))
-            {
-               q_DatapoolRelevant = true;
-               break;
-            }
-         }
-
-         if (q_DatapoolRelevant == true)
+         if (std::find(c_UsedDatapools.begin(), c_UsedDatapools.end(), u32_ItDataPool) != c_UsedDatapools.end())
          {
             // Datapool is used on dashboard
             const C_OscNodeDataPool & rc_Datapool = pc_Node->c_DataPools[u32_ItDataPool];
@@ -2363,7 +2460,7 @@ int32_t C_SyvComDriverDiag::m_CheckOsyDatapoolsAndCreateMapping(const uint32_t o
                      else
                      {
                         // Datapool is fine. Add to mapping
-                        c_DatapoolMapping[static_cast<uint8_t>(u32_ItDataPool)] =
+                        orc_DatapoolMapping[static_cast<uint8_t>(u32_ItDataPool)] =
                            static_cast<uint8_t>(u32_ServerDatapoolIndex);
 
                         // Log the registered mapping
@@ -2423,7 +2520,7 @@ int32_t C_SyvComDriverDiag::m_CheckOsyDatapoolsAndCreateMapping(const uint32_t o
       if (s32_Retval == C_NO_ERR)
       {
          // Register the mapping
-         pc_Protocol->RegisterDataPoolMapping(c_DatapoolMapping);
+         pc_Protocol->RegisterDataPoolMapping(orc_DatapoolMapping);
       }
       else
       {
@@ -2440,6 +2537,127 @@ int32_t C_SyvComDriverDiag::m_CheckOsyDatapoolsAndCreateMapping(const uint32_t o
    return s32_Retval;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get indices of all Datapools of node which are used on any dashboard of the view
+
+   \param[in]   ou32_NodeIndex        Node index
+   \param[out]  orc_DatapoolIndices   Used Datapool indices in ascending order
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComDriverDiag::m_GetUsedDatapools(const uint32_t ou32_NodeIndex,
+                                            std::vector<uint32_t> & orc_DatapoolIndices) const
+{
+   const C_PuiSvData * const pc_View = C_PuiSvHandler::h_GetInstance()->GetView(this->mu32_ViewIndex);
+
+   orc_DatapoolIndices.clear();
+   if (pc_View != NULL)
+   {
+      std::set<C_OscNodeDataPoolListElementId> c_RegisteredElementIds;
+      std::set<C_OscNodeDataPoolListElementId>::const_iterator c_ItElement;
+
+      pc_View->GetAllRegisteredDashboardElements(c_RegisteredElementIds);
+      // Ids are sorted by node and Datapool so each used Datapool appears as one continuous block
+      for (c_ItElement = c_RegisteredElementIds.begin(); c_ItElement != c_RegisteredElementIds.end(); ++c_ItElement)
+      {
+         if ((c_ItElement->u32_NodeIndex == ou32_NodeIndex) &&
+             ((orc_DatapoolIndices.empty() == true) ||
+              (orc_DatapoolIndices.back() != c_ItElement->u32_DataPoolIndex)))
+         {
+            orc_DatapoolIndices.push_back(c_ItElement->u32_DataPoolIndex);
+         }
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get the keys to look up the Datapool verification of a node in the verification cache
+
+   Reads serial number, application version and application software fingerprint from the device and calculates
+   a hash over the local definition of all used Datapools.
+   Devices which can not report all of these are always verified.
+
+   \param[in]   ou32_ActiveDiagNodeIndex  Active diag node index (mc_ActiveDiagNodes)
+   \param[out]  orc_SerialNumber          Serial number of device
+   \param[out]  orc_DeviceFingerprint     Application version and software fingerprint of device
+   \param[out]  oru32_DefinitionHash      Hash over the local definition of all used Datapools
+
+   \retval   true    keys are valid, cache can be used
+   \retval   false   device could not be identified, cache must not be used
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_SyvComDriverDiag::m_GetVerificationCacheKeys(const uint32_t ou32_ActiveDiagNodeIndex,
+                                                    C_SclString & orc_SerialNumber,
+                                                    C_SclString & orc_DeviceFingerprint,
+                                                    uint32_t & oru32_DefinitionHash)
+{
+   bool q_Retval = false;
+   const uint32_t u32_ActiveNode = this->mc_ActiveDiagNodes[ou32_ActiveDiagNodeIndex];
+   const uint32_t u32_NodeIndex = this->mc_ActiveNodesIndexes[u32_ActiveNode];
+   const C_OscNode * const pc_Node = C_PuiSdHandler::h_GetInstance()->GetOscNodeConst(u32_NodeIndex);
+   C_OscDiagProtocolOsy * const pc_Protocol =
+      dynamic_cast<C_OscDiagProtocolOsy *>(this->mc_DiagProtocols[u32_ActiveNode]);
+
+   if ((pc_Node != NULL) && (pc_Protocol != NULL))
+   {
+      C_OscProtocolSerialNumber c_SerialNumber;
+      int32_t s32_Return = pc_Protocol->OsyReadEcuSerialNumber(c_SerialNumber);
+
+      if (s32_Return != C_NO_ERR)
+      {
+         // Not supported by older devices, try the extended format
+         s32_Return = pc_Protocol->OsyReadEcuSerialNumberExt(c_SerialNumber);
+      }
+      if ((s32_Return == C_NO_ERR) && (c_SerialNumber.q_IsValid == true))
+      {
+         C_SclString c_ApplicationVersion;
+         uint8_t au8_Date[3];
+         uint8_t au8_Time[3];
+         C_SclString c_Username;
+
+         orc_SerialNumber = c_SerialNumber.GetSerialNumberAsFormattedString();
+         s32_Return = pc_Protocol->OsyReadApplicationVersion(c_ApplicationVersion);
+         if (s32_Return == C_NO_ERR)
+         {
+            s32_Return = pc_Protocol->OsyReadApplicationSoftwareFingerprint(au8_Date, au8_Time, c_Username);
+         }
+         if (s32_Return == C_NO_ERR)
+         {
+            std::vector<uint32_t> c_UsedDatapools;
+
+            orc_DeviceFingerprint.PrintFormatted("%s|%02d%02d%02d-%02d%02d%02d|%s", c_ApplicationVersion.c_str(),
+                                                 au8_Date[0], au8_Date[1], au8_Date[2],
+                                                 au8_Time[0], au8_Time[1], au8_Time[2], c_Username.c_str());
+
+            this->m_GetUsedDatapools(u32_NodeIndex, c_UsedDatapools);
+            oru32_DefinitionHash = 0xFFFFFFFFU;
+            for (uint32_t u32_It = 0U; u32_It < c_UsedDatapools.size(); ++u32_It)
+            {
+               const uint32_t u32_DatapoolIndex = c_UsedDatapools[u32_It];
+               if (u32_DatapoolIndex < pc_Node->c_DataPools.size())
+               {
+                  const C_OscNodeDataPool & rc_Datapool = pc_Node->c_DataPools[u32_DatapoolIndex];
+                  uint32_t u32_GeneratedHash = 0U;
+                  uint32_t u32_CompatHash = 0U;
+
+                  rc_Datapool.CalcGeneratedDefinitionHash(u32_GeneratedHash);
+                  rc_Datapool.CalcDefinitionHash(u32_CompatHash, C_OscNodeDataPool::eCT_NON_NVM_DEFAULT_COMPAT_V1);
+                  C_SclChecksums::CalcCRC32(&u32_DatapoolIndex, sizeof(u32_DatapoolIndex), oru32_DefinitionHash);
+                  C_SclChecksums::CalcCRC32(rc_Datapool.c_Name.c_str(), rc_Datapool.c_Name.Length(),
+                                            oru32_DefinitionHash);
+                  C_SclChecksums::CalcCRC32(&rc_Datapool.au8_Version[0], sizeof(rc_Datapool.au8_Version),
+                                            oru32_DefinitionHash);
+                  C_SclChecksums::CalcCRC32(&u32_GeneratedHash, sizeof(u32_GeneratedHash), oru32_DefinitionHash);
+                  C_SclChecksums::CalcCRC32(&u32_CompatHash, sizeof(u32_CompatHash), oru32_DefinitionHash);
+               }
+            }
+            q_Retval = true;
+         }
+      }
+   }
+
+   return q_Retval;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Gets the Datapool metadata and its index on the server with a specific Datapool name
 
@@ -2771,3 +2989,324 @@ void C_SyvComDriverDiag::m_GetRoutingErrorDetails(QString & orc_ErrorDetails, st
       }
    }
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set up the rails of one node
+
+   \param[in]      ou32_ActiveNode     Active node index (mc_ActiveNodesIndexes)
+   \param[in]      orc_View            View with configured update rates
+   \param[in,out]  orc_ErrorDetails    Error details (if any)
+
+   \return
+   C_NO_ERR   rails configured
+   C_COM      Communication error
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SyvComDriverDiag::m_SetUpEventDataRates(const uint32_t ou32_ActiveNode, const C_PuiSvData & orc_View,
+                                                  QString & orc_ErrorDetails)
+{
+   int32_t s32_Return;
+   uint16_t u16_RateMs = orc_View.GetUpdateRateFast();
+
+   s32_Return = this->mc_DiagProtocols[ou32_ActiveNode]->DataPoolSetEventDataRate(0, u16_RateMs);
+   if (s32_Return == C_NO_ERR)
+   {
+      u16_RateMs = orc_View.GetUpdateRateMedium();
+      s32_Return = this->mc_DiagProtocols[ou32_ActiveNode]->DataPoolSetEventDataRate(1, u16_RateMs);
+   }
+
+   if (s32_Return == C_NO_ERR)
+   {
+      u16_RateMs = orc_View.GetUpdateRateSlow();
+      s32_Return = this->mc_DiagProtocols[ou32_ActiveNode]->DataPoolSetEventDataRate(2, u16_RateMs);
+   }
+
+   if (s32_Return != C_NO_ERR)
+   {
+      osc_write_log_warning(
+         "Asynchronous communication",
+         static_cast<QString>("Node \"%1\" - DataPoolSetEventDataRate - error: %2\n"
+                              "C_RANGE    parameter out of range (checked by client-side function)\n"
+                              "C_TIMEOUT  expected response not received within timeout\n"
+                              "C_NOACT    could not send request (e.g. Tx buffer full)\n"
+                              "C_CONFIG   pre-requisites not correct; e.g. driver not initialized\n"
+                              "C_WARN     error response\n"
+                              "C_RD_WR    malformed protocol response\n").arg(static_cast<QString>(
+                                                                                 m_GetActiveNodeName(
+                                                                                    ou32_ActiveNode)
+                                                                                 .c_str())).arg(
+            C_Uti::h_StwError(s32_Return)).toStdString().c_str());
+      s32_Return = C_COM;
+      orc_ErrorDetails += m_GetActiveNodeName(ou32_ActiveNode).c_str();
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Request all cyclic and change driven transmissions of all active diag nodes
+
+   Failed registrations are stored in mc_ConnectResults of the affected node.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComDriverDiag::m_SetUpTransmissions(void)
+{
+   const C_PuiSvData * const pc_View = C_PuiSvHandler::h_GetInstance()->GetView(this->mu32_ViewIndex);
+
+   if (pc_View != NULL)
+   {
+      const QMap<C_OscNodeDataPoolListElementId, C_PuiSvReadDataConfiguration> & rc_Transmissions =
+         pc_View->GetReadRailAssignments();
+
+      for (QMap<C_OscNodeDataPoolListElementId, C_PuiSvReadDataConfiguration>::const_iterator c_It =
+              rc_Transmissions.begin(); c_It != rc_Transmissions.end(); ++c_It)
+      {
+         bool q_Found;
+         //we need the node index within the list of active nodes:
+         const uint32_t u32_ActiveDiagNodeIndex = this->m_GetActiveDiagIndex(c_It.key().u32_NodeIndex, &q_Found);
+         //Skip inactive nodes
+         if (q_Found == true)
+         {
+            C_SyvComDriverDiagConnectResult & rc_Result = this->mc_ConnectResults[u32_ActiveDiagNodeIndex];
+            uint8_t u8_NegResponseCode = 0;
+            int32_t s32_Return;
+
+            if ((c_It.value().e_TransmissionMode == C_PuiSvReadDataConfiguration::eTM_CYCLIC) ||
+                (c_It.value().e_TransmissionMode == C_PuiSvReadDataConfiguration::eTM_ON_CHANGE))
+            {
+               ++rc_Result.u32_ElementNumber;
+            }
+
+            s32_Return = this->m_RequestTransmission(this->mc_ActiveDiagNodes[u32_ActiveDiagNodeIndex], c_It.key(),
+                                                     c_It.value(), u8_NegResponseCode);
+            //Both services map to the same error
+            if (s32_Return != C_NO_ERR)
+            {
+               if ((s32_Return == C_WARN) && (u8_NegResponseCode == 0x70) &&
+                   (rc_Result.u32_FailedElementNumber == 0U))
+               {
+                  // Save the information about the number of the first element which failed
+                  rc_Result.u32_FailedElementNumber = rc_Result.u32_ElementNumber;
+               }
+               //Error can be ignored, user feedback is different
+               rc_Result.c_FailedIdErrorDetails.push_back(C_SyvComDriverDiag::mh_GetTransmissionErrorDetails(
+                                                             s32_Return, u8_NegResponseCode));
+               rc_Result.c_FailedIds.push_back(c_It.key());
+            }
+         }
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Request one cyclic or change driven transmission
+
+   \param[in]   ou32_ActiveNode        Active node index (mc_ActiveNodesIndexes)
+   \param[in]   orc_Id                 Element to transmit
+   \param[in]   orc_Config             Transmission configuration
+   \param[out]  oru8_NegResponseCode   Negative response code (only valid for C_WARN)
+
+   \return
+   C_NO_ERR   transmission requested or no registration necessary
+   C_RANGE    parameter out of range (checked by client-side function)
+   C_NOACT    could not send request (e.g. Tx buffer full)
+   C_CONFIG   pre-requisites not correct; e.g. driver not initialized
+   C_WARN     error response
+   C_RD_WR    malformed protocol response
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SyvComDriverDiag::m_RequestTransmission(const uint32_t ou32_ActiveNode,
+                                                  const C_OscNodeDataPoolListElementId & orc_Id,
+                                                  const C_PuiSvReadDataConfiguration & orc_Config,
+                                                  uint8_t & oru8_NegResponseCode)
+{
+   int32_t s32_Return;
+
+   //check for valid value ranges (node index is checked in "GetActiveIndex" function)
+   tgl_assert(orc_Id.u32_DataPoolIndex <= 0xFFU);
+   tgl_assert(orc_Id.u32_ListIndex <= 0xFFFFU);
+   tgl_assert(orc_Id.u32_ElementIndex <= 0xFFFFU);
+
+   if (orc_Config.e_TransmissionMode == C_PuiSvReadDataConfiguration::eTM_CYCLIC)
+   {
+      s32_Return = this->mc_DiagProtocols[ou32_ActiveNode]->DataPoolReadCyclic(
+         static_cast<uint8_t>(orc_Id.u32_DataPoolIndex), static_cast<uint16_t>(orc_Id.u32_ListIndex),
+         static_cast<uint16_t>(orc_Id.u32_ElementIndex), orc_Config.u8_RailIndex, &oru8_NegResponseCode);
+   }
+   else if (orc_Config.e_TransmissionMode == C_PuiSvReadDataConfiguration::eTM_ON_CHANGE)
+   {
+      //convert the type dependent threshold to a uint32_t representation
+      std::vector<uint8_t> c_Threshold;
+      uint32_t u32_Threshold;
+      orc_Config.c_ChangeThreshold.GetValueAsLittleEndianBlob(c_Threshold);
+      //defensive measure: as element may only be up to 32bit the threshold may also not be > 32bit
+      tgl_assert(c_Threshold.size() <= 4);
+      //fill up to 4 bytes with zeroes
+      c_Threshold.resize(4, 0U);
+      //finally compose the uint32_t:
+      u32_Threshold = c_Threshold[0] +
+                      (static_cast<uint32_t>(c_Threshold[1]) << 8U) +
+                      (static_cast<uint32_t>(c_Threshold[2]) << 16U) +
+                      (static_cast<uint32_t>(c_Threshold[3]) << 24U);
+
+      s32_Return = this->mc_DiagProtocols[ou32_ActiveNode]->DataPoolReadChangeDriven(
+         static_cast<uint8_t>(orc_Id.u32_DataPoolIndex), static_cast<uint16_t>(orc_Id.u32_ListIndex),
+         static_cast<uint16_t>(orc_Id.u32_ElementIndex),
+         orc_Config.u8_RailIndex, u32_Threshold, &oru8_NegResponseCode);
+   }
+   else
+   {
+      // No registration necessary
+      s32_Return = C_NO_ERR;
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get user readable error details of a failed transmission request
+
+   \param[in]  os32_Result            Result of m_RequestTransmission
+   \param[in]  ou8_NegResponseCode    Negative response code (only relevant for C_WARN)
+
+   \return
+   Error details
+*/
+//----------------------------------------------------------------------------------------------------------------------
+QString C_SyvComDriverDiag::mh_GetTransmissionErrorDetails(const int32_t os32_Result,
+                                                           const uint8_t ou8_NegResponseCode)
+{
+   QString c_AdditionalInfo;
+   QString c_Details;
+
+   switch (os32_Result)
+   {
+   case C_RANGE:
+      c_Details = C_GtGetText::h_GetText("Parameter out of range (checked by client-side function)");
+      break;
+   case C_NOACT:
+      c_Details = C_GtGetText::h_GetText("Could not send request (e.g. Tx buffer full)");
+      break;
+   case C_CONFIG:
+      c_Details = C_GtGetText::h_GetText("Pre-requisites not correct; e.g. driver not initialized");
+      break;
+   case C_WARN:
+      switch (ou8_NegResponseCode)
+      {
+      case 0x13:
+         c_AdditionalInfo = C_GtGetText::h_GetText("Incorrect length of request");
+         break;
+      case 0x22:
+         c_AdditionalInfo = C_GtGetText::h_GetText(
+            "Datapool element specified by data identifier cannot be transferred event driven (invalid data type)");
+         break;
+      case 0x70:
+         c_AdditionalInfo = C_GtGetText::h_GetText("Too many transmissions already registered");
+         break;
+      case 0x31:
+         c_AdditionalInfo = C_GtGetText::h_GetText("Invalid transmission mode.\n"
+                                                   "\n"
+                                                   "When initiating transmission:\n"
+                                                   "- Datapool element specified by data identifier is not available\n"
+                                                   "- changeDrivenThreshold is zero\n"
+                                                   "\n"
+                                                   "When stopping transmission:\n"
+                                                   "- Datapool element specified by data identifier is currently not transferred event driven");
+         break;
+      case 0x33:
+         c_AdditionalInfo = C_GtGetText::h_GetText("Required security level was not unlocked");
+         break;
+      case 0x14:
+         c_AdditionalInfo = C_GtGetText::h_GetText(
+            "The total length of the event driven response messages would exceed the available buffer size");
+         break;
+      case 0x7F:
+         c_AdditionalInfo = C_GtGetText::h_GetText(
+            "The requested service is not available in the session currently active");
+         break;
+      default:
+         c_AdditionalInfo =
+            static_cast<QString>(C_GtGetText::h_GetText("Unknown NRC: 0x%1")).arg(QString::number(
+                                                                                     ou8_NegResponseCode,
+                                                                                     16));
+         break;
+      }
+      c_Details = static_cast<QString>(C_GtGetText::h_GetText("Error response (%1)")).arg(c_AdditionalInfo);
+      break;
+   case C_RD_WR:
+      c_Details = C_GtGetText::h_GetText("Malformed protocol response");
+      break;
+   default:
+      c_Details = C_GtGetText::h_GetText("Unknown error");
+      break;
+   }
+
+   return c_Details;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Execute one connect step for all active diag nodes
+
+   The nodes are handled in the order of mc_ActiveDiagNodes. Results are stored in mc_ConnectResults.
+   Steps which stop on the first error (security access and rails) skip all following nodes.
+
+   \param[in]  oe_Step  Step to execute
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComDriverDiag::m_RunConnectStep(const E_ConnectStep oe_Step)
+{
+   this->mc_ConnectResults.assign(this->mc_ActiveDiagNodes.size(), C_SyvComDriverDiagConnectResult());
+
+   if (oe_Step == eCS_TRANSMISSIONS)
+   {
+      this->m_SetUpTransmissions();
+   }
+   else
+   {
+      const C_PuiSvData * const pc_View = C_PuiSvHandler::h_GetInstance()->GetView(this->mu32_ViewIndex);
+
+      for (uint32_t u32_ActiveDiagNodeIndex = 0U; u32_ActiveDiagNodeIndex < this->mc_ActiveDiagNodes.size();
+           ++u32_ActiveDiagNodeIndex)
+      {
+         const uint32_t u32_ActiveNode = this->mc_ActiveDiagNodes[u32_ActiveDiagNodeIndex];
+         C_SyvComDriverDiagConnectResult & rc_Result = this->mc_ConnectResults[u32_ActiveDiagNodeIndex];
+         bool q_Abort = false;
+
+         switch (oe_Step)
+         {
+         case eCS_SESSION:
+            // Further communication is only necessary if the node was ok in the first place
+            if (this->mc_DefectNodeIndices.find(u32_ActiveNode) == this->mc_DefectNodeIndices.end())
+            {
+               rc_Result.s32_Result = this->m_SetNodeSessionId(
+                  u32_ActiveNode, C_OscProtocolDriverOsy::hu8_DIAGNOSTIC_SESSION_EXTENDED_DIAGNOSIS, true, NULL);
+            }
+            break;
+         case eCS_SECURITY_ACCESS:
+            rc_Result.s32_Result = this->m_SetNodeSecurityAccess(u32_ActiveNode, 1U, NULL);
+            q_Abort = ((rc_Result.s32_Result != C_NO_ERR) && (rc_Result.s32_Result != C_NOACT));
+            break;
+         case eCS_DIAG_SERVERS:
+            rc_Result.s32_Result = this->m_StartDiagServer(u32_ActiveDiagNodeIndex, rc_Result.c_ErrorDetails);
+            break;
+         case eCS_EVENT_DATA_RATES:
+            tgl_assert(pc_View != NULL);
+            if (pc_View != NULL)
+            {
+               rc_Result.s32_Result = this->m_SetUpEventDataRates(u32_ActiveNode, *pc_View, rc_Result.c_ErrorDetails);
+            }
+            q_Abort = (rc_Result.s32_Result != C_NO_ERR);
+            break;
+         case eCS_TRANSMISSIONS:
+         default:
+            // Handled above
+            break;
+         }
+
+         if (q_Abort == true)
+         {
+            break;
+         }
+      }
+   }
+}
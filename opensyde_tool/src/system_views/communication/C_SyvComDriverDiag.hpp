@@ -13,6 +13,7 @@
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include <QObject>
+#include <map>
 #include <set>
 
 #include "stwtypes.hpp"
@@ -25,8 +26,11 @@
 #include "C_Can.hpp"
 #include "C_OscIpDispatcherWinSock.hpp"
 #include "C_OscCanSignal.hpp"
+#include "C_OscCanSignalExtraction.hpp"
 #include "C_OscSecurityPemDatabase.hpp"
 #include "C_OscDiagProtocolOsy.hpp"
+#include "C_PuiSvData.hpp"
+#include "C_SyvComDatapoolVerificationCache.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 namespace stw
@@ -48,6 +52,7 @@ public:
    ~C_SyvComDriverDiag(void) override;
 
    int32_t InitDiag(void);
+   void SetDatapoolVerificationCache(const bool oq_Active, const bool oq_ForceVerification = false);
 
    int32_t SetDiagnosticMode(QString & orc_ErrorDetails);
    int32_t SetUpCyclicTransmissions(QString & orc_ErrorDetails,
@@ -123,6 +128,30 @@ protected:
    void m_HandleCanMessage(const stw::can::T_STWCAN_Msg_RX & orc_Msg, const bool oq_IsTx) override;
 
 private:
+   enum E_ConnectStep
+   {
+      eCS_SESSION,
+      eCS_SECURITY_ACCESS,
+      eCS_DIAG_SERVERS,
+      eCS_EVENT_DATA_RATES,
+      eCS_TRANSMISSIONS
+   };
+
+   class C_SyvComDriverDiagConnectResult
+   {
+   public:
+      C_SyvComDriverDiagConnectResult(void);
+
+      int32_t s32_Result;
+      QString c_ErrorDetails;
+      // Number of transmissions requested for node (with and without error)
+      uint32_t u32_ElementNumber;
+      // Number of the first element rejected with "too many transmissions"; 0 if none
+      uint32_t u32_FailedElementNumber;
+      std::vector<stw::opensyde_core::C_OscNodeDataPoolListElementId> c_FailedIds;
+      std::vector<QString> c_FailedIdErrorDetails;
+   };
+
    class C_SyvComDriverDiagWidgetRegistration
    {
    public:
@@ -143,6 +172,9 @@ private:
       stw::opensyde_core::C_OscCanSignal c_MultiplexerSignal;
       // And the content as information about the type
       stw::opensyde_core::C_OscNodeDataPoolContent c_ElementContent;
+      // Precompiled extraction of c_Signal and c_MultiplexerSignal
+      stw::opensyde_core::C_OscCanSignalExtraction c_SignalExtraction;
+      stw::opensyde_core::C_OscCanSignalExtraction c_MultiplexerExtraction;
    };
 
    C_SyvComDriverThread * mpc_AsyncThread; ///< Thread for handling all async messages
@@ -177,14 +209,36 @@ private:
    // Security PEM database
    stw::opensyde_core::C_OscSecurityPemDatabase mc_PemDatabase;
 
+   std::vector<C_SyvComDriverDiagConnectResult> mc_ConnectResults; ///< Result per entry of mc_ActiveDiagNodes
+
+   // Skip Datapool verification of devices which were verified before and did not change
+   bool mq_UseVerificationCache;
+   bool mq_ForceVerification; ///< Verify all Datapools and refresh the cache entries
+   C_SyvComDatapoolVerificationCache mc_VerificationCache;
+
    int32_t m_InitDiagNodes(void);
    void m_InitDiagProtocolKfx(stw::opensyde_core::C_OscDiagProtocolKfx * const opc_DiagProtocolKefex) const;
    int32_t m_InitDiagProtocol(void);
    int32_t m_InitDataDealer(void);
    int32_t m_StartRoutingDiag(QString & orc_ErrorDetails, std::set<uint32_t> & orc_ErrorActiveNodes);
+   int32_t m_SetDiagNodesSessionId(void);
+   int32_t m_SetDiagNodesSecurityAccess(void);
    int32_t m_StartDiagServers(QString & orc_ErrorDetails);
+   int32_t m_StartDiagServer(const uint32_t ou32_ActiveDiagNodeIndex, QString & orc_ErrorDetails);
+   int32_t m_SetUpEventDataRates(const uint32_t ou32_ActiveNode, const C_PuiSvData & orc_View,
+                                 QString & orc_ErrorDetails);
+   void m_SetUpTransmissions(void);
+   int32_t m_RequestTransmission(const uint32_t ou32_ActiveNode,
+                                 const stw::opensyde_core::C_OscNodeDataPoolListElementId & orc_Id,
+                                 const C_PuiSvReadDataConfiguration & orc_Config, uint8_t & oru8_NegResponseCode);
+   static QString mh_GetTransmissionErrorDetails(const int32_t os32_Result, const uint8_t ou8_NegResponseCode);
+   void m_RunConnectStep(const E_ConnectStep oe_Step);
    int32_t m_GetAllDatapoolMetadata(const uint32_t ou32_ActiveDiagNodeIndex, QString & orc_ErrorDetails);
-   int32_t m_CheckOsyDatapoolsAndCreateMapping(const uint32_t ou32_ActiveDiagNodeIndex, QString & orc_ErrorDetails);
+   int32_t m_CheckOsyDatapoolsAndCreateMapping(const uint32_t ou32_ActiveDiagNodeIndex, QString & orc_ErrorDetails,
+                                               std::map<uint8_t, uint8_t> & orc_DatapoolMapping);
+   void m_GetUsedDatapools(const uint32_t ou32_NodeIndex, std::vector<uint32_t> & orc_DatapoolIndices) const;
+   bool m_GetVerificationCacheKeys(const uint32_t ou32_ActiveDiagNodeIndex, stw::scl::C_SclString & orc_SerialNumber,
+                                   stw::scl::C_SclString & orc_DeviceFingerprint, uint32_t & oru32_DefinitionHash);
    int32_t m_GetReadDatapoolMetadata(const uint32_t ou32_ActiveDiagNodeIndex,
                                      const stw::scl::C_SclString & orc_DatapoolName,
                                      uint32_t & oru32_ServerDatapoolIndex,
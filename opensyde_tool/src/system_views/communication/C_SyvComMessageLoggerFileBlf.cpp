@@ -45,18 +45,21 @@ using namespace BLF;
 C_SyvComMessageLoggerFileBlf::C_SyvComMessageLoggerFileBlf(const stw::scl::C_SclString & orc_FilePath) :
    C_OscComMessageLoggerFileBase(orc_FilePath, "")
 {
+   // BLF only stores the raw CAN frames
+   this->mq_RawFramesOnly = true;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Default destructor
 
-   Writes the end line and closes the open file
+   Writes all buffered messages and closes the open file
 */
 //----------------------------------------------------------------------------------------------------------------------
 C_SyvComMessageLoggerFileBlf::~C_SyvComMessageLoggerFileBlf(void) noexcept
 {
    try
    {
+      this->m_StopWriter();
       if (this->mc_File.is_open() == true)
       {
          this->mc_File.close();
@@ -82,6 +85,9 @@ int32_t C_SyvComMessageLoggerFileBlf::OpenFile(void)
 {
    int32_t s32_Return;
 
+   // Write the pending messages of the previous file
+   this->m_StopWriter();
+
    if (this->mc_File.is_open() == true)
    {
       // Close the file if it is open. The previous file will be deleted
@@ -105,53 +111,66 @@ int32_t C_SyvComMessageLoggerFileBlf::OpenFile(void)
          // Error on opening the BLF file
          s32_Return = C_RD_WR;
       }
+      else
+      {
+         this->m_StartWriter();
+      }
    }
 
    return s32_Return;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-/*! \brief   Adding of a concrete CAN message to the log file
+/*! \brief   Writes a batch of buffered CAN messages to the log file
+
+   Called by the writer thread.
 
-   \param[in]     orc_MessageData      Current CAN message
+   \param[in]  ou32_Count     Number of buffered CAN messages
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_SyvComMessageLoggerFileBlf::AddMessageToFile(const C_OscComMessageLoggerData & orc_MessageData)
+void C_SyvComMessageLoggerFileBlf::m_WriteMessages(const uint32_t ou32_Count)
 {
    if (this->mc_File.is_open() == true)
    {
+      uint32_t u32_Counter;
+      stw::scl::C_SclString c_ProtocolName;
       Vector::BLF::CanMessage c_CanObj;
 
-      c_CanObj.channel = 1U;
-      c_CanObj.dlc = orc_MessageData.c_CanMsg.u8_DLC;
-
-      // Tx and RTR information
-      c_CanObj.flags = 0U;
-      if (orc_MessageData.q_IsTx == true)
-      {
-         c_CanObj.flags |= static_cast<uint8_t>(0x01);
-      }
-      if (orc_MessageData.c_CanMsg.u8_RTR > 0U)
+      for (u32_Counter = 0U; u32_Counter < ou32_Count; ++u32_Counter)
       {
-         c_CanObj.flags |= static_cast<uint8_t>(0x80);
+         const C_OscComMessageLoggerData & rc_MessageData = this->m_GetBufferedMessage(u32_Counter, c_ProtocolName);
+
+         c_CanObj.channel = 1U;
+         c_CanObj.dlc = rc_MessageData.c_CanMsg.u8_DLC;
+
+         // Tx and RTR information
+         c_CanObj.flags = 0U;
+         if (rc_MessageData.q_IsTx == true)
+         {
+            c_CanObj.flags |= static_cast<uint8_t>(0x01);
+         }
+         if (rc_MessageData.c_CanMsg.u8_RTR > 0U)
+         {
+            c_CanObj.flags |= static_cast<uint8_t>(0x80);
+         }
+
+         // CAN Id and extended flag
+         c_CanObj.id = rc_MessageData.c_CanMsg.u32_ID;
+         if (rc_MessageData.c_CanMsg.u8_XTD > 0U)
+         {
+            // Vector magic for extended identifier
+            c_CanObj.id |= 0x80000000U;
+         }
+
+         // CAN data
+         std::memcpy(&c_CanObj.data[0], rc_MessageData.c_CanMsg.au8_Data, 8);
+
+         // Timestamp in ns
+         c_CanObj.objectFlags = ObjectHeader::TimeOneNans;
+         // us into ns
+         c_CanObj.objectTimeStamp = rc_MessageData.u64_TimeStampAbsoluteStart * 1000U;
+
+         this->mc_File.write(&c_CanObj);
       }
-
-      // CAN Id and extended flag
-      c_CanObj.id = orc_MessageData.c_CanMsg.u32_ID;
-      if (orc_MessageData.c_CanMsg.u8_XTD > 0U)
-      {
-         // Vector magic for extended identifier
-         c_CanObj.id |= 0x80000000U;
-      }
-
-      // CAN data
-      std::memcpy(&c_CanObj.data[0], orc_MessageData.c_CanMsg.au8_Data, 8);
-
-      // Timestamp in ns
-      c_CanObj.objectFlags = ObjectHeader::TimeOneNans;
-      // us into ns
-      c_CanObj.objectTimeStamp = orc_MessageData.u64_TimeStampAbsoluteStart * 1000U;
-
-      this->mc_File.write(&c_CanObj);
    }
 }
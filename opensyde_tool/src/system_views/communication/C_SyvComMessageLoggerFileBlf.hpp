@@ -34,7 +34,9 @@ public:
    ~C_SyvComMessageLoggerFileBlf(void) noexcept override;
 
    int32_t OpenFile(void) override;
-   void AddMessageToFile(const stw::opensyde_core::C_OscComMessageLoggerData & orc_MessageData) override;
+
+protected:
+   void m_WriteMessages(const uint32_t ou32_Count) override;
 
 private:
    Vector::BLF::File mc_File;
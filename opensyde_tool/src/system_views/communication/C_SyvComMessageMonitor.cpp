@@ -14,16 +14,22 @@
 #include "stwerrors.hpp"
 
 #include "TglUtils.hpp"
+#include "TglFile.hpp"
 
 #include "C_SyvComMessageMonitor.hpp"
 #include "C_CieImportDbc.hpp"
+#include "C_CieDbcCache.hpp"
+#include "C_Uti.hpp"
 #include "C_OscLoggingHandler.hpp"
 #include "C_SyvComMessageLoggerFileBlf.hpp"
+#include "C_SyvComTraceReaderBlf.hpp"
+#include "C_OscComTraceReaderAsc.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 using namespace stw::errors;
 using namespace stw::scl;
 using namespace stw::can;
+using namespace stw::tgl;
 using namespace stw::opensyde_core;
 using namespace stw::opensyde_gui_logic;
 
@@ -48,7 +54,9 @@ C_SyvComMessageMonitor::C_SyvComMessageMonitor(void) :
    me_LoadingActivity(eNOT_ACTIVE),
    mc_Path(""),
    mu32_BusIndex(0U),
+   mf64_ReplaySpeedFactor(0.0),
    ms32_Result(0),
+   mq_MessageQueueActive(true),
    mu8_BusLoad(0U),
    mu32_TxMessages(0U),
    mu32_TxErrors(0U)
@@ -68,6 +76,7 @@ C_SyvComMessageMonitor::~C_SyvComMessageMonitor(void) noexcept
       {
          if (this->mpc_LoadingThread->isRunning() == true)
          {
+            this->mc_TraceReplay.RequestAbort();
             this->mpc_LoadingThread->requestInterruption();
 
             if (this->mpc_LoadingThread->wait(2000U) == false)
@@ -311,6 +320,8 @@ int32_t C_SyvComMessageMonitor::RemoveDatabase(const C_SclString & orc_Path)
    {
       // Remove the entry
       this->mc_DbcFiles.erase(c_ItDbc);
+      // The plans may refer to messages of the removed file
+      this->mc_DbcExtractionPlans.clear();
 
       s32_Return = C_NO_ERR;
    }
@@ -398,6 +409,28 @@ int32_t C_SyvComMessageMonitor::AddLogFileBlf(const C_SclString & orc_FilePath)
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Adds a CSV log file with decoded signal values
+
+   \param[in]  orc_FilePath   Path with file name. File extension must be .csv
+   \param[in]  oq_HexActive   Mode for writing CAN Id and CAN data (hexadecimal or decimal)
+
+   \return
+   C_NO_ERR    File added successfully
+   C_RD_WR     Error on creating file, folders or deleting old file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SyvComMessageMonitor::AddLogFileCsv(const C_SclString & orc_FilePath, const bool oq_HexActive)
+{
+   int32_t s32_Return;
+
+   this->mc_CriticalSectionConfig.Acquire();
+   s32_Return = C_OscComMessageLogger::AddLogFileCsv(orc_FilePath, oq_HexActive);
+   this->mc_CriticalSectionConfig.Release();
+
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Remove an specific ASC log file
 
@@ -521,7 +554,10 @@ int32_t C_SyvComMessageMonitor::HandleCanMessage(const T_STWCAN_Msg_RX & orc_Msg
    {
       // Add the interpreted data to the list
       this->mc_CriticalSectionMsg.Acquire();
-      this->mc_ReceivedMessages.push_back(this->m_GetHandledCanMessage());
+      if (this->mq_MessageQueueActive == true)
+      {
+         this->mc_ReceivedMessages.push_back(this->m_GetHandledCanMessage());
+      }
       this->mc_CriticalSectionMsg.Release();
    }
 
@@ -655,6 +691,89 @@ uint32_t C_SyvComMessageMonitor::GetTxErrors(void) const
    return u32_TxErrors;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Starts thread to replay a recorded trace file
+
+   The messages of the file are passed through the same interpretation, filter and logging path as live messages.
+   Start must be called before and Stop after the replay has finished.
+   The result is available with GetResults when the thread has finished.
+
+   \param[in]  orc_FilePath       Path of trace file (.asc or .blf)
+   \param[in]  of64_SpeedFactor   0.0: as fast as possible; > 0.0: replay in real time scaled by this factor
+
+   \return
+   C_NO_ERR   started sequence
+   C_BUSY     previously started sequence still going on
+   C_RANGE    speed factor negative
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SyvComMessageMonitor::StartReplayTraceFile(const C_SclString & orc_FilePath,
+                                                     const float64_t of64_SpeedFactor)
+{
+   int32_t s32_Return = C_NO_ERR;
+
+   if (this->mpc_LoadingThread->isRunning() == true)
+   {
+      s32_Return = C_BUSY;
+   }
+   else if (of64_SpeedFactor < 0.0)
+   {
+      s32_Return = C_RANGE;
+   }
+   else
+   {
+      this->mc_Path = orc_FilePath;
+      this->mf64_ReplaySpeedFactor = of64_SpeedFactor;
+      this->me_LoadingActivity = eREPLAY_TRACE_FILE;
+      this->mpc_LoadingThread->start();
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Requests the abort of a running trace file replay
+
+   The replay thread stops after the current message. The result of GetResults will be C_BUSY.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComMessageMonitor::StopReplayTraceFile(void)
+{
+   this->mc_TraceReplay.RequestAbort();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of messages passed to the monitor by the current or last trace file replay
+
+   \return
+   Number of replayed messages
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_SyvComMessageMonitor::GetReplayedMessages(void) const
+{
+   return this->mc_TraceReplay.GetReplayedMessages();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Activates or deactivates the queue of handled messages for the GUI
+
+   Without a GUI fetching the messages with m_GetCanMessage the queue would grow without limit.
+   Headless users (e.g. the trace conversion) must deactivate it.
+
+   \param[in]  oq_Active  Flag if handled messages are queued
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComMessageMonitor::SetMessageQueueActive(const bool oq_Active)
+{
+   this->mc_CriticalSectionMsg.Acquire();
+   this->mq_MessageQueueActive = oq_Active;
+   if (oq_Active == false)
+   {
+      this->mc_ReceivedMessages.clear();
+   }
+   this->mc_CriticalSectionMsg.Release();
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Get result of previously started service execution
 
@@ -749,7 +868,7 @@ int32_t C_SyvComMessageMonitor::m_GetCanMessage(C_OscComMessageLoggerData & orc_
    \param[in,out]  orc_MessageData  Message data for updating
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_SyvComMessageMonitor::m_UpdateProtocolString(C_OscComMessageLoggerData & orc_MessageData) const
+void C_SyvComMessageMonitor::UpdateProtocolString(C_OscComMessageLoggerData & orc_MessageData) const
 {
    // If the name is not empty, the message was already interpreted by DBC or openSYDE system definition interpretation
    if (orc_MessageData.c_Name == "")
@@ -934,8 +1053,25 @@ int32_t C_SyvComMessageMonitor::m_AddDbcFile(const C_SclString & orc_PathDbc)
       C_CieConverter::C_CieCommDefinition c_DbcDefinition;
       C_SclStringList c_WarningMsgs;
       C_SclString c_ErrorMsg;
+      const QString c_CacheDirectory = C_Uti::h_GetExePath() + "/User/dbc_cache";
+      int32_t s32_CachedResult;
 
-      s32_Return = C_CieImportDbc::h_ImportNetwork(orc_PathDbc, c_DbcDefinition, c_WarningMsgs, c_ErrorMsg, true);
+      // Importing big DBC files takes long; use the binary cache if it matches the current file
+      if (C_CieDbcCache::h_Load(orc_PathDbc.c_str(), c_CacheDirectory, c_DbcDefinition,
+                                s32_CachedResult) == C_NO_ERR)
+      {
+         s32_Return = s32_CachedResult;
+      }
+      else
+      {
+         s32_Return = C_CieImportDbc::h_ImportNetwork(orc_PathDbc, c_DbcDefinition, c_WarningMsgs, c_ErrorMsg,
+                                                      true);
+         if (((s32_Return == C_NO_ERR) || (s32_Return == C_WARN)) &&
+             (C_CieDbcCache::h_Save(orc_PathDbc.c_str(), c_CacheDirectory, c_DbcDefinition, s32_Return) != C_NO_ERR))
+         {
+            osc_write_log_warning("Loading DBC file", "Could not write cache for DBC file \"" + orc_PathDbc + "\".");
+         }
+      }
 
       if ((s32_Return == C_NO_ERR) ||
           (s32_Return == C_WARN))
@@ -1076,59 +1212,48 @@ bool C_SyvComMessageMonitor::m_InterpretDbcFile(const C_CieConverter::C_CieCanMe
    if (opc_DbcMessage != NULL)
    {
       uint32_t u32_Counter;
-      bool q_MultiplexerFound = false;
-      uint32_t u32_MultiplexerIndex = 0U;
-      uint16_t u16_MultiplexerValue = 0U;
-
-      orc_MessageData.c_Name = opc_DbcMessage->c_Name.c_str();
+      uint32_t u32_MultiplexerIndex;
+      std::map<const C_CieConverter::C_CieCanMessage *, C_OscCanMessageExtractionPlan>::iterator c_ItPlan =
+         this->mc_DbcExtractionPlans.find(opc_DbcMessage);
 
-      // Check if a multiplexer signal exists
-      for (u32_Counter = 0U; u32_Counter < opc_DbcMessage->c_Signals.size(); ++u32_Counter)
+      if (c_ItPlan == this->mc_DbcExtractionPlans.end())
       {
-         const C_CieConverter::C_CieCanSignal & rc_DbcSignal = opc_DbcMessage->c_Signals[u32_Counter];
+         // First reception of this message. Compile the plan once.
+         c_ItPlan = this->mc_DbcExtractionPlans.insert(
+            std::pair<const C_CieConverter::C_CieCanMessage *, C_OscCanMessageExtractionPlan>(
+               opc_DbcMessage, C_OscCanMessageExtractionPlan())).first;
 
-         if (rc_DbcSignal.e_MultiplexerType == C_OscCanSignal::eMUX_MULTIPLEXER_SIGNAL)
+         for (u32_Counter = 0U; u32_Counter < opc_DbcMessage->c_Signals.size(); ++u32_Counter)
          {
-            mh_InterpretDbcFileCanSignal(orc_MessageData, rc_DbcSignal);
-
-            if (orc_MessageData.c_Signals.size() > 0)
-            {
-               C_OscComMessageLoggerDataSignal & rc_Signal =
-                  orc_MessageData.c_Signals[orc_MessageData.c_Signals.size() - 1];
-
-               if (rc_Signal.q_DlcError == false)
-               {
-                  try
-                  {
-                     u16_MultiplexerValue = static_cast<uint16_t>(rc_Signal.c_RawValueDec.ToInt());
-                     rc_Signal.c_Name += " (Multiplexer)";
-                     q_MultiplexerFound = true;
-                     u32_MultiplexerIndex = u32_Counter;
-                  }
-                  catch (...)
-                  {
-                  }
-               }
-            }
-            break;
+            const C_CieConverter::C_CieCanSignal & rc_DbcSignal = opc_DbcMessage->c_Signals[u32_Counter];
+            // The minimum value has the correct type configuration
+            c_ItPlan->second.AddSignal(mh_GetOscSignal(rc_DbcSignal), rc_DbcSignal.c_Element.c_MinValue.GetType(),
+                                       rc_DbcSignal.c_Element.f64_Factor, rc_DbcSignal.c_Element.f64_Offset);
          }
       }
 
+      C_OscCanMessageExtractionPlan & rc_Plan = c_ItPlan->second;
+      const bool q_HasMultiplexer = rc_Plan.GetMultiplexerSignalIndex(u32_MultiplexerIndex);
+
+      orc_MessageData.c_Name = opc_DbcMessage->c_Name.c_str();
+
+      // Extract all signals in one step. Multiplexed signals are only extracted for the matching multiplexer value.
+      rc_Plan.Decode(orc_MessageData.c_CanMsg.au8_Data, orc_MessageData.c_CanMsg.u8_DLC);
+
       // Interpret the signals
-      for (u32_Counter = 0U; u32_Counter < opc_DbcMessage->c_Signals.size(); ++u32_Counter)
+      for (u32_Counter = 0U; u32_Counter < rc_Plan.GetSignalCount(); ++u32_Counter)
       {
-         // Skip the multiplexer signal if one was found. It was added already.
-         if ((q_MultiplexerFound == false) ||
-             (u32_Counter != u32_MultiplexerIndex))
+         const C_OscCanMessageExtractionPlan::E_SignalState e_State = rc_Plan.GetSignalState(u32_Counter);
+
+         if (e_State != C_OscCanMessageExtractionPlan::eSIGNAL_NOT_PRESENT)
          {
-            const C_CieConverter::C_CieCanSignal & rc_DbcSignal = opc_DbcMessage->c_Signals[u32_Counter];
+            mh_InterpretDbcFileCanSignal(orc_MessageData, opc_DbcMessage->c_Signals[u32_Counter], rc_Plan,
+                                         u32_Counter);
 
-            // Interpret all not multiplexed signals and all multiplexed signals with the matching multiplexer value
-            if ((rc_DbcSignal.e_MultiplexerType == C_OscCanSignal::eMUX_DEFAULT) ||
-                ((q_MultiplexerFound == true) &&
-                 (u16_MultiplexerValue == rc_DbcSignal.u16_MultiplexValue)))
+            if ((q_HasMultiplexer == true) && (u32_Counter == u32_MultiplexerIndex) &&
+                (e_State == C_OscCanMessageExtractionPlan::eSIGNAL_DECODED))
             {
-               mh_InterpretDbcFileCanSignal(orc_MessageData, rc_DbcSignal);
+               orc_MessageData.c_Signals[orc_MessageData.c_Signals.size() - 1].c_Name += " (Multiplexer)";
             }
          }
       }
@@ -1152,30 +1277,25 @@ bool C_SyvComMessageMonitor::m_InterpretDbcFile(const C_CieConverter::C_CieCanMe
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Interprets the DBC message signal
 
-   \param[in,out]  orc_MessageData  Message data target for the interpretation
-   \param[in]      orc_DbcSignal    CAN signal of DBC file
+   \param[in,out]  orc_MessageData    Message data target for the interpretation
+   \param[in]      orc_DbcSignal      CAN signal of DBC file
+   \param[in]      orc_Plan           Extraction plan of message after Decode
+   \param[in]      ou32_SignalIndex   Index of signal in message and plan
 */
 //----------------------------------------------------------------------------------------------------------------------
 void C_SyvComMessageMonitor::mh_InterpretDbcFileCanSignal(C_OscComMessageLoggerData & orc_MessageData,
-                                                          const C_CieConverter::C_CieCanSignal & orc_DbcSignal)
+                                                          const C_CieConverter::C_CieCanSignal & orc_DbcSignal,
+                                                          const C_OscCanMessageExtractionPlan & orc_Plan,
+                                                          const uint32_t ou32_SignalIndex)
 {
    C_OscComMessageLoggerDataSignal c_Signal;
-   C_OscCanSignal c_OscSignal;
 
    c_Signal.c_Name = orc_DbcSignal.c_Element.c_Name.c_str();
    c_Signal.c_Unit = orc_DbcSignal.c_Element.c_Unit.c_str();
    c_Signal.c_Comment = orc_DbcSignal.c_Element.c_Comment.c_str();
 
-   // Using of the openSYDE signal class for using common utility functions
-   c_OscSignal.e_ComByteOrder = orc_DbcSignal.e_ComByteOrder;
-   c_OscSignal.u16_ComBitLength = orc_DbcSignal.u16_ComBitLength;
-   c_OscSignal.u16_ComBitStart = orc_DbcSignal.u16_ComBitStart;
-   c_OscSignal.e_MultiplexerType = orc_DbcSignal.e_MultiplexerType;
-   c_OscSignal.u16_MultiplexValue = orc_DbcSignal.u16_MultiplexValue;
-
    // Get the the minimum value for the correct type configuration
-   mh_InterpretCanSignalValue(c_Signal, orc_MessageData.c_CanMsg.au8_Data, orc_MessageData.c_CanMsg.u8_DLC,
-                              c_OscSignal,
+   mh_InterpretCanSignalValue(c_Signal, orc_Plan, ou32_SignalIndex, mh_GetOscSignal(orc_DbcSignal),
                               orc_DbcSignal.c_Element.c_MinValue,
                               orc_DbcSignal.c_Element.f64_Factor,
                               orc_DbcSignal.c_Element.f64_Offset);
@@ -1202,6 +1322,84 @@ void C_SyvComMessageMonitor::mh_InterpretDbcFileCanSignal(C_OscComMessageLoggerD
    orc_MessageData.c_Signals.push_back(c_Signal);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Converts a DBC signal to the openSYDE signal class for using common utility functions
+
+   \param[in]  orc_DbcSignal    CAN signal of DBC file
+
+   \return
+   openSYDE signal with the layout of the DBC signal
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscCanSignal C_SyvComMessageMonitor::mh_GetOscSignal(const C_CieConverter::C_CieCanSignal & orc_DbcSignal)
+{
+   C_OscCanSignal c_OscSignal;
+
+   c_OscSignal.e_ComByteOrder = orc_DbcSignal.e_ComByteOrder;
+   c_OscSignal.u16_ComBitLength = orc_DbcSignal.u16_ComBitLength;
+   c_OscSignal.u16_ComBitStart = orc_DbcSignal.u16_ComBitStart;
+   c_OscSignal.e_MultiplexerType = orc_DbcSignal.e_MultiplexerType;
+   c_OscSignal.u16_MultiplexValue = orc_DbcSignal.u16_MultiplexValue;
+
+   return c_OscSignal;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Replays a trace file into the monitor
+
+   The reader is chosen by the file extension.
+
+   \param[in]  orc_FilePath   Path of trace file (.asc or .blf)
+
+   \return
+   C_NO_ERR    all messages replayed
+   C_BUSY      replay aborted
+   C_RD_WR     file could not be opened
+   C_NOACT     unknown file extension
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SyvComMessageMonitor::m_ReplayTraceFile(const C_SclString & orc_FilePath)
+{
+   int32_t s32_Return = C_NOACT;
+   C_OscComTraceReaderBase * pc_Reader = NULL;
+   const C_SclString c_Extension = TglExtractFileExtension(orc_FilePath).LowerCase();
+
+   if (c_Extension == ".asc")
+   {
+      pc_Reader = new C_OscComTraceReaderAsc();
+   }
+   else if (c_Extension == ".blf")
+   {
+      pc_Reader = new C_SyvComTraceReaderBlf();
+   }
+   else
+   {
+      osc_write_log_error("Trace replay", "Unknown trace file type: " + orc_FilePath);
+   }
+
+   if (pc_Reader != NULL)
+   {
+      s32_Return = pc_Reader->OpenFile(orc_FilePath);
+      if (s32_Return == C_NO_ERR)
+      {
+         s32_Return = this->mc_TraceReplay.Replay(*pc_Reader, *this, this->mf64_ReplaySpeedFactor);
+         if (pc_Reader->GetSkippedEntries() > 0ULL)
+         {
+            osc_write_log_info("Trace replay", "Skipped " + C_SclString::IntToStr(pc_Reader->GetSkippedEntries()) +
+                               " entries without CAN message in file " + orc_FilePath);
+         }
+         pc_Reader->CloseFile();
+      }
+      else
+      {
+         osc_write_log_error("Trace replay", "Could not open trace file: " + orc_FilePath);
+      }
+      delete pc_Reader;
+   }
+
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Function for continuous calling by thread.
 */
@@ -1237,6 +1435,9 @@ void C_SyvComMessageMonitor::m_ThreadFunc(void)
    case eADD_DBC_FILE:
       this->ms32_Result = this->m_AddDbcFile(this->mc_Path);
       break;
+   case eREPLAY_TRACE_FILE:
+      this->ms32_Result = this->m_ReplayTraceFile(this->mc_Path);
+      break;
    case eNOT_ACTIVE:
    default:
       // Nothing to do. Should not happen.
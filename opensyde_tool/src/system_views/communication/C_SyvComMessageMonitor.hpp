@@ -23,6 +23,7 @@
 
 #include "C_OscComMessageLogger.hpp"
 #include "C_OscComMessageLoggerData.hpp"
+#include "C_OscComTraceReplay.hpp"
 
 #include "C_SyvComDriverThread.hpp"
 #include "C_OscSystemBus.hpp"
@@ -70,6 +71,7 @@ public:
    int32_t AddLogFileAsc(const stw::scl::C_SclString & orc_FilePath, const bool oq_HexActive,
                          const bool oq_RelativeTimeStampActive) override;
    virtual int32_t AddLogFileBlf(const stw::scl::C_SclString & orc_FilePath);
+   int32_t AddLogFileCsv(const stw::scl::C_SclString & orc_FilePath, const bool oq_HexActive) override;
    int32_t RemoveLogFile(const stw::scl::C_SclString & orc_FilePath) override;
    void RemoveAllLogFiles(void) override;
 
@@ -93,14 +95,20 @@ public:
    uint32_t GetTxCount(void) const;
    uint32_t GetTxErrors(void) const;
 
+   // Offline trace replay
+   int32_t StartReplayTraceFile(const stw::scl::C_SclString & orc_FilePath, const float64_t of64_SpeedFactor);
+   void StopReplayTraceFile(void);
+   uint64_t GetReplayedMessages(void) const;
+   void SetMessageQueueActive(const bool oq_Active);
+
    int32_t GetResults(int32_t & ors32_Result) const;
    int32_t GetResultBusses(std::vector<stw::opensyde_core::C_OscSystemBus> & orc_Busses) const;
 
+   void UpdateProtocolString(stw::opensyde_core::C_OscComMessageLoggerData & orc_MessageData) const;
+
 protected:
    int32_t m_GetCanMessage(stw::opensyde_core::C_OscComMessageLoggerData & orc_Message);
 
-   void m_UpdateProtocolString(stw::opensyde_core::C_OscComMessageLoggerData & orc_MessageData) const;
-
    bool m_CheckFilter(const stw::can::T_STWCAN_Msg_RX & orc_Msg) override;
 
    void m_InsertOsySysDef(const stw::scl::C_SclString & orc_PathSystemDefinition,
@@ -119,7 +127,8 @@ private:
       eNOT_ACTIVE,
       eADD_OSY_SYSDEF_WITHOUT_BUSINDEX,
       eADD_OSY_SYSDEF_WITH_BUSINDEX,
-      eADD_DBC_FILE
+      eADD_DBC_FILE,
+      eREPLAY_TRACE_FILE
    };
 
    int32_t m_AddDbcFile(const stw::scl::C_SclString & orc_PathDbc);
@@ -127,7 +136,12 @@ private:
    bool m_InterpretDbcFile(const C_CieConverter::C_CieCanMessage * const opc_DbcMessage,
                            stw::opensyde_core::C_OscComMessageLoggerData & orc_MessageData) const;
    static void mh_InterpretDbcFileCanSignal(stw::opensyde_core::C_OscComMessageLoggerData & orc_MessageData,
-                                            const C_CieConverter::C_CieCanSignal & orc_DbcSignal);
+                                            const C_CieConverter::C_CieCanSignal & orc_DbcSignal,
+                                            const stw::opensyde_core::C_OscCanMessageExtractionPlan & orc_Plan,
+                                            const uint32_t ou32_SignalIndex);
+   static stw::opensyde_core::C_OscCanSignal mh_GetOscSignal(const C_CieConverter::C_CieCanSignal & orc_DbcSignal);
+
+   int32_t m_ReplayTraceFile(const stw::scl::C_SclString & orc_FilePath);
 
    static void mh_ThreadFunc(void * const opv_Instance);
    void m_ThreadFunc(void);
@@ -138,6 +152,7 @@ private:
    // Loading execution parameter
    stw::scl::C_SclString mc_Path;
    uint32_t mu32_BusIndex;
+   float64_t mf64_ReplaySpeedFactor;
 
    // Loading execution result
    std::vector<stw::opensyde_core::C_OscSystemBus> mc_Busses;
@@ -151,6 +166,9 @@ private:
    mutable stw::tgl::C_TglCriticalSection mc_CriticalSectionCounter;
 
    QList<stw::opensyde_core::C_OscComMessageLoggerData> mc_ReceivedMessages;
+   bool mq_MessageQueueActive;
+
+   stw::opensyde_core::C_OscComTraceReplay mc_TraceReplay;
 
    uint8_t mu8_BusLoad;
    uint32_t mu32_TxMessages;
@@ -158,6 +176,9 @@ private:
 
    // DBC files
    std::map<stw::scl::C_SclString, C_CieConverter::C_CieCommDefinition> mc_DbcFiles;
+   // Compiled signal extraction per DBC message. Filled on first reception of a message.
+   mutable std::map<const C_CieConverter::C_CieCanMessage *,
+                    stw::opensyde_core::C_OscCanMessageExtractionPlan> mc_DbcExtractionPlans;
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
@@ -0,0 +1,198 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Class for reading CAN messages from a BLF trace file (implementation)
+
+   Reads the objects of the file one by one with the Vector BLF library.
+   CAN_MESSAGE and CAN_MESSAGE2 objects are returned, all other objects are skipped.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <cstring>
+
+#include "stwtypes.hpp"
+#include "stwerrors.hpp"
+
+#include "C_SyvComTraceReaderBlf.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::can;
+using namespace stw::opensyde_gui_logic;
+using namespace stw::opensyde_core;
+using namespace Vector;
+using namespace BLF;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SyvComTraceReaderBlf::C_SyvComTraceReaderBlf(void) :
+   C_OscComTraceReaderBase()
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default destructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SyvComTraceReaderBlf::~C_SyvComTraceReaderBlf(void) noexcept
+{
+   try
+   {
+      C_SyvComTraceReaderBlf::CloseFile();
+   }
+   catch (...)
+   {
+      //not much we can do here ...
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Opens a BLF file for reading
+
+   An already opened file will be closed.
+
+   \param[in]  orc_FilePath   Path of BLF file
+
+   \return
+   C_NO_ERR    File opened
+   C_RD_WR     File could not be opened
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SyvComTraceReaderBlf::OpenFile(const stw::scl::C_SclString & orc_FilePath)
+{
+   int32_t s32_Return = C_NO_ERR;
+
+   this->CloseFile();
+   this->mu64_SkippedEntries = 0ULL;
+
+   this->mc_File.open(orc_FilePath.c_str(), File::OpenMode::Read);
+   if (this->mc_File.is_open() == false)
+   {
+      s32_Return = C_RD_WR;
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Reads the next CAN message of the file
+
+   \param[out]  orc_Msg    CAN message; time stamp in micro seconds
+   \param[out]  orq_IsTx   Message was sent by the logging node
+
+   \return
+   C_NO_ERR    Message read
+   C_NOACT     End of file reached
+   C_CONFIG    No file opened
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SyvComTraceReaderBlf::ReadNextMessage(T_STWCAN_Msg_RX & orc_Msg, bool & orq_IsTx)
+{
+   int32_t s32_Return = C_NOACT;
+
+   if (this->mc_File.is_open() == false)
+   {
+      s32_Return = C_CONFIG;
+   }
+   else
+   {
+      bool q_Found = false;
+
+      while ((q_Found == false) && (this->mc_File.eof() == false))
+      {
+         ObjectHeaderBase * const pc_Object = this->mc_File.read();
+
+         if (pc_Object == NULL)
+         {
+            break;
+         }
+
+         if (pc_Object->objectType == ObjectType::CAN_MESSAGE)
+         {
+            //lint -e{929,9176} //type is defined by object type of BLF library
+            mh_ConvertCanObject(*reinterpret_cast<const CanMessage *>(pc_Object), orc_Msg, orq_IsTx);
+            q_Found = true;
+         }
+         else if (pc_Object->objectType == ObjectType::CAN_MESSAGE2)
+         {
+            //lint -e{929,9176} //type is defined by object type of BLF library
+            mh_ConvertCanObject(*reinterpret_cast<const CanMessage2 *>(pc_Object), orc_Msg, orq_IsTx);
+            q_Found = true;
+         }
+         else
+         {
+            ++this->mu64_SkippedEntries;
+         }
+
+         delete pc_Object;
+      }
+
+      if (q_Found == true)
+      {
+         s32_Return = C_NO_ERR;
+      }
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Closes the file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComTraceReaderBlf::CloseFile(void)
+{
+   if (this->mc_File.is_open() == true)
+   {
+      this->mc_File.close();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Converts a BLF CAN object to the CAN message structure
+
+   \param[in]   orc_Object   BLF CAN object (CanMessage or CanMessage2)
+   \param[out]  orc_Msg      CAN message
+   \param[out]  orq_IsTx     Message was sent by the logging node
+*/
+//----------------------------------------------------------------------------------------------------------------------
+template <typename T>
+void C_SyvComTraceReaderBlf::mh_ConvertCanObject(const T & orc_Object, T_STWCAN_Msg_RX & orc_Msg, bool & orq_IsTx)
+{
+   orc_Msg.u32_ID = orc_Object.id & 0x7FFFFFFFU;
+   // Vector magic for extended identifier
+   orc_Msg.u8_XTD = ((orc_Object.id & 0x80000000U) != 0U) ? 1U : 0U;
+   orc_Msg.u8_DLC = (orc_Object.dlc > 8U) ? 8U : orc_Object.dlc;
+   orc_Msg.u8_RTR = ((orc_Object.flags & 0x80U) != 0U) ? 1U : 0U;
+   orq_IsTx = ((orc_Object.flags & 0x01U) != 0U);
+   (void)std::memcpy(&orc_Msg.au8_Data[0], &orc_Object.data[0], sizeof(orc_Msg.au8_Data));
+
+   if (orc_Object.objectFlags == ObjectHeader::TimeOneNans)
+   {
+      orc_Msg.u64_TimeStamp = orc_Object.objectTimeStamp / 1000U;
+   }
+   else
+   {
+      // Ten micro seconds
+      orc_Msg.u64_TimeStamp = orc_Object.objectTimeStamp * 10U;
+   }
+}
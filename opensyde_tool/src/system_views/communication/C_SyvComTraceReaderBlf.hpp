@@ -0,0 +1,51 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Class for reading CAN messages from a BLF trace file (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_SYVCOMTRACEREADERBLF_HPP
+#define C_SYVCOMTRACEREADERBLF_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+
+#include "C_OscComTraceReaderBase.hpp"
+
+#include "BLF.h"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_gui_logic
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_SyvComTraceReaderBlf :
+   public stw::opensyde_core::C_OscComTraceReaderBase
+{
+public:
+   C_SyvComTraceReaderBlf(void);
+   ~C_SyvComTraceReaderBlf(void) noexcept override;
+
+   int32_t OpenFile(const stw::scl::C_SclString & orc_FilePath) override;
+   int32_t ReadNextMessage(stw::can::T_STWCAN_Msg_RX & orc_Msg, bool & orq_IsTx) override;
+   void CloseFile(void) override;
+
+private:
+   template <typename T>
+   static void mh_ConvertCanObject(const T & orc_Object, stw::can::T_STWCAN_Msg_RX & orc_Msg, bool & orq_IsTx);
+
+   Vector::BLF::File mc_File;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
@@ -14,6 +14,7 @@
 #include "TglUtils.hpp"
 #include "C_GtGetText.hpp"
 #include "C_PuiSvHandler.hpp"
+#include "C_UsHandler.hpp"
 #include "C_SyvDaDashboardSettings.hpp"
 #include "ui_C_SyvDaDashboardSettings.h"
 
@@ -137,6 +138,8 @@ void C_SyvDaDashboardSettings::InitStaticNames(void) const
    this->mpc_Ui->pc_SpinBoxFast->setSuffix(C_GtGetText::h_GetText(" ms"));
    this->mpc_Ui->pc_SpinBoxMedium->setSuffix(C_GtGetText::h_GetText(" ms"));
    this->mpc_Ui->pc_SpinBoxSlow->setSuffix(C_GtGetText::h_GetText(" ms"));
+   this->mpc_Ui->pc_CheckBoxVerificationCache->setText(C_GtGetText::h_GetText(
+                                                          "Skip Datapool verification of unchanged devices"));
    this->mpc_Ui->pc_PushButtonOk->setText(C_GtGetText::h_GetText("OK"));
    this->mpc_Ui->pc_PushButtonCancel->setText(C_GtGetText::h_GetText("Cancel"));
    //Tooltips
@@ -148,6 +151,11 @@ void C_SyvDaDashboardSettings::InitStaticNames(void) const
    this->mpc_Ui->pc_LabelSlow->SetToolTipInformation(C_GtGetText::h_GetText("Slow"),
                                                      C_GtGetText::h_GetText(
                                                         "Data elements configured using the cyclic interval \"Slow\" will use this cyclic transmission time"));
+   this->mpc_Ui->pc_CheckBoxVerificationCache->SetToolTipInformation(
+      C_GtGetText::h_GetText("Skip Datapool verification of unchanged devices"),
+      C_GtGetText::h_GetText("Devices which were verified successfully before and did not change since then are not "
+                             "verified again on connect.\nUncheck to verify all Datapools of all devices on connect "
+                             "and refresh the stored verification results."));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -171,6 +179,8 @@ void C_SyvDaDashboardSettings::Save(void) const
                                                                                            ->
                                                                                            value())) ==
               C_NO_ERR);
+   C_UsHandler::h_GetInstance()->SetDatapoolVerificationCacheActive(
+      this->mpc_Ui->pc_CheckBoxVerificationCache->isChecked());
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -220,6 +230,8 @@ void C_SyvDaDashboardSettings::m_Load(void) const
       this->mpc_Ui->pc_SpinBoxMedium->setValue(static_cast<int32_t>(pc_View->GetUpdateRateMedium()));
       this->mpc_Ui->pc_SpinBoxSlow->setValue(static_cast<int32_t>(pc_View->GetUpdateRateSlow()));
    }
+   this->mpc_Ui->pc_CheckBoxVerificationCache->setChecked(
+      C_UsHandler::h_GetInstance()->GetDatapoolVerificationCacheActive());
 }
 
 //----------------------------------------------------------------------------------------------------------------------
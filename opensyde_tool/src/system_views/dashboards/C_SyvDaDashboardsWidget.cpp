@@ -1016,6 +1016,10 @@ void C_SyvDaDashboardsWidget::m_ConnectStepFinished(void)
       QString c_Message;
 
       mpc_ComDriver = new C_SyvComDriverDiag(this->mu32_ViewIndex);
+      // Skip Datapool verification of unchanged devices unless the user requested a full verification.
+      // The cache stays active in both cases to refresh the stored results.
+      mpc_ComDriver->SetDatapoolVerificationCache(
+         true, !C_UsHandler::h_GetInstance()->GetDatapoolVerificationCacheActive());
       connect(mpc_ComDriver, &C_SyvComDriverDiag::SigPollingFinished, this,
               &C_SyvDaDashboardsWidget::m_HandleManualOperationFinished);
 
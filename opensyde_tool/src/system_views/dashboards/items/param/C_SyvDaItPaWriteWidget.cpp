@@ -276,9 +276,11 @@ void C_SyvDaItPaWriteWidget::m_StartWriteChangedElements(
             if ((this->mc_AllAffectedValues.find(c_Id) == this->mc_AllAffectedValues.end()) ||
                 (q_Changed == true))
             {
-               const C_OscNodeDataPoolListElement & rc_Element = pc_List->c_Elements[u32_ItElement];
-               const C_SyvDaItPaValuePairs c_Pair(rc_Element.c_NvmValue, q_Changed);
-               this->mc_AllAffectedValues[c_Id] = c_Pair;
+               C_OscNodeDataPoolContent c_NvmValue;
+               tgl_assert(C_PuiSdHandler::h_GetInstance()->GetDataPoolListElementNvmValue(
+                             c_Id.u32_NodeIndex, c_Id.u32_DataPoolIndex, c_Id.u32_ListIndex,
+                             c_Id.u32_ElementIndex, c_NvmValue) == C_NO_ERR);
+               this->mc_AllAffectedValues[c_Id] = C_SyvDaItPaValuePairs(c_NvmValue, q_Changed);
             }
          }
       }
@@ -332,9 +334,11 @@ void C_SyvDaItPaWriteWidget::m_StartWriteChangedElements(
             //Only add if not already containing
             if (this->mc_AllAffectedValues.find(c_ElementId) == this->mc_AllAffectedValues.end())
             {
-               const C_OscNodeDataPoolListElement & rc_Element = pc_List->c_Elements[u32_ItElement];
-               const C_SyvDaItPaValuePairs c_Pair(rc_Element.c_NvmValue, false);
-               this->mc_AllAffectedValues[c_ElementId] = c_Pair;
+               C_OscNodeDataPoolContent c_NvmValue;
+               tgl_assert(C_PuiSdHandler::h_GetInstance()->GetDataPoolListElementNvmValue(
+                             c_ElementId.u32_NodeIndex, c_ElementId.u32_DataPoolIndex, c_ElementId.u32_ListIndex,
+                             c_ElementId.u32_ElementIndex, c_NvmValue) == C_NO_ERR);
+               this->mc_AllAffectedValues[c_ElementId] = C_SyvDaItPaValuePairs(c_NvmValue, false);
             }
          }
       }
@@ -647,7 +651,6 @@ void C_SyvDaItPaWriteWidget::m_ShowParameterValues(const bool oq_ShowReadValues)
 
             for (u32_ElementCounter = 0U; u32_ElementCounter < pc_OscList->c_Elements.size(); ++u32_ElementCounter)
             {
-               const C_OscNodeDataPoolListElement * pc_OscElement;
                const C_PuiSdNodeDataPoolListElement & rc_CurUiListElement =
                   pc_UiList->c_DataPoolListElements[u32_ElementCounter];
                std::vector<QString> c_NvmValues;
@@ -671,30 +674,41 @@ void C_SyvDaItPaWriteWidget::m_ShowParameterValues(const bool oq_ShowReadValues)
                c_ElementNumber = "#" + QString::number(u32_ElementCounter + 1U);
                c_ElementText = pc_OscList->c_Elements[u32_ElementCounter].c_Name.c_str();
 
+               C_OscNodeDataPoolContent c_NvmValue;
+               bool q_ValueAvailable = false;
                if (oq_ShowReadValues == true)
                {
-                  pc_OscElement = m_GetReadElementById(u32_CurNodeIndex,
-                                                       (*c_ItItem).u32_DataPoolIndex,
-                                                       (*c_ItItem).u32_ListIndex,
-                                                       u32_ElementCounter);
+                  //The read values are only accessed by the data dealer while polling
+                  const C_OscNodeDataPoolListElement * const pc_OscElement =
+                     m_GetReadElementById(u32_CurNodeIndex, (*c_ItItem).u32_DataPoolIndex,
+                                          (*c_ItItem).u32_ListIndex, u32_ElementCounter);
                   tgl_assert(pc_OscElement != NULL);
+                  if (pc_OscElement != NULL)
+                  {
+                     c_NvmValue = pc_OscElement->c_NvmValue;
+                     q_ValueAvailable = true;
+                  }
                }
                else
                {
-                  pc_OscElement = &pc_OscList->c_Elements[u32_ElementCounter];
+                  q_ValueAvailable =
+                     (C_PuiSdHandler::h_GetInstance()->GetDataPoolListElementNvmValue(u32_CurNodeIndex,
+                                                                                     (*c_ItItem).u32_DataPoolIndex,
+                                                                                     (*c_ItItem).u32_ListIndex,
+                                                                                     u32_ElementCounter,
+                                                                                     c_NvmValue) == C_NO_ERR);
                }
-               if (pc_OscElement != NULL)
+               if (q_ValueAvailable == true)
                {
                   if (rc_CurUiListElement.q_InterpretAsString == true)
                   {
-                     const QString c_Tmp = "\"" + C_SdNdeDpContentUtil::h_ConvertToString(pc_OscElement->c_NvmValue) +
-                                           "\"";
+                     const QString c_Tmp = "\"" + C_SdNdeDpContentUtil::h_ConvertToString(c_NvmValue) + "\"";
                      c_NvmValues.push_back(c_Tmp);
                   }
                   else
                   {
                      C_SdNdeDpContentUtil::h_GetValuesAsScaledString(
-                        pc_OscElement->c_NvmValue,
+                        c_NvmValue,
                         pc_OscList->c_Elements[u32_ElementCounter].f64_Factor,
                         pc_OscList->c_Elements[u32_ElementCounter].f64_Offset,
                         c_NvmValues, false);
@@ -1646,6 +1660,7 @@ QString C_SyvDaItPaWriteWidget::m_ReadAndStoreUpdatedValues(void)
                                                                                    c_It->first.u32_ListIndex,
                                                                                    c_It->first.u32_ElementIndex);
       tgl_assert(pc_Element != NULL);
+      //The read values are only accessed by the data dealer while polling
       if (pc_Element != NULL)
       {
          c_It->second.c_Actual = pc_Element->c_NvmValue;
@@ -196,12 +196,22 @@ QVariant C_SyvDaItPaArModel::data(const QModelIndex & orc_Index, const int32_t o
          {
             if (this->mq_EcuValues == true)
             {
-               c_Retval = C_SdNdeDpContentUtil::h_ConvertScaledContentToGeneric(pc_Element->c_NvmValue,
-                                                                                pc_Element->f64_Factor,
-                                                                                pc_Element->f64_Offset,
-                                                                                static_cast<uint32_t>(orc_Index.
-                                                                                                      column()),
-                                                                                false);
+               const C_PuiSvDbNodeDataPoolListElementId * const pc_Id = this->m_GetElementId();
+               C_OscNodeDataPoolContent c_NvmValue;
+               if ((pc_Id != NULL) &&
+                   (C_PuiSdHandler::h_GetInstance()->GetDataPoolListElementNvmValue(pc_Id->u32_NodeIndex,
+                                                                                   pc_Id->u32_DataPoolIndex,
+                                                                                   pc_Id->u32_ListIndex,
+                                                                                   pc_Id->u32_ElementIndex,
+                                                                                   c_NvmValue) == C_NO_ERR))
+               {
+                  c_Retval = C_SdNdeDpContentUtil::h_ConvertScaledContentToGeneric(c_NvmValue,
+                                                                                   pc_Element->f64_Factor,
+                                                                                   pc_Element->f64_Offset,
+                                                                                   static_cast<uint32_t>(orc_Index.
+                                                                                                         column()),
+                                                                                   false);
+               }
             }
             else
             {
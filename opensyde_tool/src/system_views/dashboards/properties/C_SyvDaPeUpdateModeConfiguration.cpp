@@ -187,7 +187,7 @@ void C_SyvDaPeUpdateModeConfiguration::m_ConfigureClicked(void) const
    C_SyvDaDashboardSettings * const pc_Dialog = new C_SyvDaDashboardSettings(*c_New, this->mu32_ViewIndex);
 
    //Resize
-   c_New->SetSize(QSize(600, 430));
+   c_New->SetSize(QSize(600, 480));
 
    if (c_New->exec() == static_cast<int32_t>(QDialog::Accepted))
    {
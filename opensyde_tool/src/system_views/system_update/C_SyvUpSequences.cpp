@@ -28,6 +28,7 @@
 #include "C_GtGetText.hpp"
 #include "C_OscLoggingHandler.hpp"
 #include "C_PuiSdHandler.hpp"
+#include "C_PuiProject.hpp"
 #include "C_SyvUpSequences.hpp"
 #include "C_SyvComDriverUtil.hpp"
 #include "DLLocalize.hpp"
@@ -746,6 +747,9 @@ QString C_SyvUpSequences::GetStepName(const E_ProgressStep oe_Step) const
    case eRESET_SYSTEM_FINISHED:
       c_Text = C_GtGetText::h_GetText("Reset System: Finished");
       break;
+   case eUPDATE_SYSTEM_OSY_NODE_CHECKPOINT_SKIPPED:
+      c_Text = C_GtGetText::h_GetText("Update System: Node already updated by previous update run; skipped");
+      break;
    default:
       tgl_assert(false);
       break;
@@ -840,6 +844,15 @@ int32_t C_SyvUpSequences::StartUpdateSystem(const std::vector<C_DoFlash> & orc_A
       this->mc_NodesOrder = orc_NodesOrder;
       this->mq_AbortFlag = false;
 
+      // Reload each time as the previous update might have been done by another instance of the application
+      if (this->mc_CheckpointJournal.Open((C_Uti::h_GetExePath() +
+                                           "/User/system_update_checkpoints.ini").toStdString().c_str(),
+                                          this->m_GetCheckpointSystemIdentity().toStdString().c_str()) != C_NO_ERR)
+      {
+         osc_write_log_warning("Starting system update", "Could not load update checkpoints.");
+      }
+      this->SetCheckpointJournal(&this->mc_CheckpointJournal);
+
       this->mpc_Thread->start();
    }
    return s32_Return;
@@ -1130,6 +1143,25 @@ void C_SyvUpSequences::m_ThreadFunc(void)
    this->mpc_Thread->requestInterruption();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get identity of the updated system for the checkpoint journal
+
+   \return
+   Project path and view name
+*/
+//----------------------------------------------------------------------------------------------------------------------
+QString C_SyvUpSequences::m_GetCheckpointSystemIdentity(void) const
+{
+   QString c_Identity = C_PuiProject::h_GetInstance()->GetPath();
+   const C_PuiSvData * const pc_View = C_PuiSvHandler::h_GetInstance()->GetView(this->mu32_ViewIndex);
+
+   if (pc_View != NULL)
+   {
+      c_Identity += static_cast<QString>("|") + pc_View->GetName().c_str();
+   }
+   return c_Identity;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 
 void C_SyvUpSequences::mh_WriteLog(const C_OscSuSequences::E_ProgressStep oe_Step,
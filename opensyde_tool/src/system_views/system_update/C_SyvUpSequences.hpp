@@ -107,6 +107,7 @@ private:
 
    static void mh_ThreadFunc(void * const opv_Instance);
    void m_ThreadFunc(void);
+   QString m_GetCheckpointSystemIdentity(void) const;
 
    static void mh_WriteLog(const C_OscSuSequences::E_ProgressStep oe_Step, const stw::scl::C_SclString & orc_Text);
 
@@ -136,6 +137,9 @@ private:
 
    // Security PEM database
    stw::opensyde_core::C_OscSecurityPemDatabase mc_PemDatabase;
+
+   // Nodes finished by previous (interrupted) updates
+   stw::opensyde_core::C_OscSuCheckpointJournal mc_CheckpointJournal;
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
@@ -875,6 +875,13 @@ void C_UsFiler::mh_SaveCommon(const C_UsHandler & orc_UserSettings, C_SclIniFile
 
    // TSP shortcut
    orc_Ini.WriteBool("Common", "TSPShortcutActive", orc_UserSettings.GetTspShortcutActive());
+
+   // Datapool verification cache
+   orc_Ini.WriteBool("Common", "DatapoolVerificationCacheActive",
+                     orc_UserSettings.GetDatapoolVerificationCacheActive());
+
+   // Undo memory budget
+   orc_Ini.WriteInteger("Common", "UndoByteBudgetMiB", static_cast<int32_t>(orc_UserSettings.GetUndoByteBudgetMib()));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -1930,6 +1937,7 @@ void C_UsFiler::mh_LoadDashboard(C_SclIniFile & orc_Ini, const QString & orc_Sec
 void C_UsFiler::mh_LoadCommon(C_UsHandler & orc_UserSettings, C_SclIniFile & orc_Ini)
 {
    QString c_Tmp;
+   int32_t s32_Tmp;
 
    //Language
    c_Tmp = orc_Ini.ReadString("Common", "Language", "American english").c_str();
@@ -1947,6 +1955,18 @@ void C_UsFiler::mh_LoadCommon(C_UsHandler & orc_UserSettings, C_SclIniFile & orc
 
    // Enable|Disable TSP shortcut
    orc_UserSettings.SetTspShortcutActive(orc_Ini.ReadBool("Common", "TSPShortcutActive", true));
+
+   // Datapool verification cache
+   orc_UserSettings.SetDatapoolVerificationCacheActive(orc_Ini.ReadBool("Common", "DatapoolVerificationCacheActive",
+                                                                        true));
+
+   // Undo memory budget
+   s32_Tmp = orc_Ini.ReadInteger("Common", "UndoByteBudgetMiB", 64);
+   if (s32_Tmp < 0)
+   {
+      s32_Tmp = 64;
+   }
+   orc_UserSettings.SetUndoByteBudgetMib(static_cast<uint32_t>(s32_Tmp));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
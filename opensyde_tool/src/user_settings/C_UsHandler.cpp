@@ -139,6 +139,8 @@ void C_UsHandler::SetDefault(void)
 
    ms32_ScreenshotGifSucessTimeout = 3000;
    mq_ActiveTspShortcut = false;
+   mq_DatapoolVerificationCacheActive = true;
+   mu32_UndoByteBudgetMib = 64U;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -432,6 +434,33 @@ bool C_UsHandler::GetTspShortcutActive() const
    return this->mq_ActiveTspShortcut;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get Datapool verification cache activation
+
+   \return
+   bool
+
+   \retval   true    Devices which did not change since their last successful verification are not verified again
+   \retval   false   All Datapools of all devices are verified on dashboard connect
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_UsHandler::GetDatapoolVerificationCacheActive(void) const
+{
+   return this->mq_DatapoolVerificationCacheActive;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get memory budget of each undo stack
+
+   \return
+   Budget in MiB, 0: unlimited
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_UsHandler::GetUndoByteBudgetMib(void) const
+{
+   return this->mu32_UndoByteBudgetMib;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Get most recent folder
 
@@ -1173,6 +1202,30 @@ void C_UsHandler::SetTspShortcutActive(const bool oq_Active)
    mq_ActiveTspShortcut = oq_Active;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set Datapool verification cache activation
+
+   \param[in]       oq_Active     skip Datapool verification of unchanged devices on dashboard connect
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_UsHandler::SetDatapoolVerificationCacheActive(const bool oq_Active)
+{
+   mq_DatapoolVerificationCacheActive = oq_Active;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set memory budget of each undo stack
+
+   Applied to undo stacks created afterwards.
+
+   \param[in]       ou32_Value     Budget in MiB, 0: unlimited
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_UsHandler::SetUndoByteBudgetMib(const uint32_t ou32_Value)
+{
+   mu32_UndoByteBudgetMib = ou32_Value;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Add path & file to recent projects list
 
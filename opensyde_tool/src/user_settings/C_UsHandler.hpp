@@ -72,6 +72,8 @@ public:
    int32_t GetNextRecentColorButtonNumber(void) const;
    int32_t GetScreenshotGifSucessTimeout(void) const;
    bool GetTspShortcutActive(void) const;
+   bool GetDatapoolVerificationCacheActive(void) const;
+   uint32_t GetUndoByteBudgetMib(void) const;
 
    void GetMostRecentFolder(QString & orc_Str) const;
    void GetRecentFolders(QStringList & orc_Folders) const;
@@ -134,6 +136,8 @@ public:
    void SetRecentColors(const QVector<QColor> & orc_RecentColorsVector);
    void SetNextRecentColorButtonNumber(const int32_t os32_NextRecentColorButtonNumber);
    void SetTspShortcutActive(const bool oq_Active);
+   void SetDatapoolVerificationCacheActive(const bool oq_Active);
+   void SetUndoByteBudgetMib(const uint32_t ou32_Value);
 
    void AddToRecentProjects(const QString & orc_Str);
    void RemoveOfRecentProjects(const QString & orc_Str);
@@ -275,6 +279,8 @@ private:
    QString mc_Lang;                               ///< Current language
    bool mq_PerformanceMeasurementActive;          ///< Flag if performance measurement is active (log entries)
    bool mq_ActiveTspShortcut;                     ///< Flag if TSP shortcut is active
+   bool mq_DatapoolVerificationCacheActive;       ///< Flag if unchanged devices skip Datapool verification
+   uint32_t mu32_UndoByteBudgetMib;               ///< Memory budget of each undo stack in MiB, 0: unlimited
    QString mc_CurrentSaveAsPath;                  ///< Current save as base path
    QVector<QColor> mc_RecentColors;               ///< Recent colors from color picker
    int32_t ms32_NextRecentColorButtonNumber;      ///< Next recent color button for color from color picker
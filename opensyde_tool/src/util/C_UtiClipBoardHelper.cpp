@@ -76,3 +76,54 @@ void C_UtiClipBoardHelper::mh_SetClipBoard(const QString & orc_Text)
       pc_Clipboard->setText(orc_Text);
    }
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get current clipboard content of specific format
+
+   \param[in]   orc_MimeType   MIME type
+   \param[out]  orc_Data       Clipboard content of format
+
+   \return
+   true  Format found
+   false Format not in clipboard
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_UtiClipBoardHelper::mh_GetClipBoardData(const QString & orc_MimeType, QByteArray & orc_Data)
+{
+   bool q_Retval = false;
+   QClipboard * const pc_Clipboard = QApplication::clipboard();
+
+   if (pc_Clipboard != NULL)
+   {
+      const QMimeData * const pc_MimeData = pc_Clipboard->mimeData();
+      if ((pc_MimeData != NULL) && (pc_MimeData->hasFormat(orc_MimeType) == true))
+      {
+         orc_Data = pc_MimeData->data(orc_MimeType);
+         q_Retval = true;
+      }
+   }
+   return q_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set current clipboard content in binary format
+
+   The text representation is only created if requested (e.g. by another application).
+
+   \param[in]  orc_MimeType        MIME type of binary content
+   \param[in]  orc_Data            Binary content
+   \param[in]  opr_TextFallback    Function to create the text representation of the binary content
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_UtiClipBoardHelper::mh_SetClipBoardData(const QString & orc_MimeType, const QByteArray & orc_Data,
+                                               const C_UtiClipBoardMimeData::PR_TextFallback opr_TextFallback)
+{
+   QClipboard * const pc_Clipboard = QApplication::clipboard();
+
+   if (pc_Clipboard != NULL)
+   {
+      //Copy to clipboard (takes ownership)
+      pc_Clipboard->clear();
+      pc_Clipboard->setMimeData(new C_UtiClipBoardMimeData(orc_MimeType, orc_Data, opr_TextFallback));
+   }
+}
@@ -13,6 +13,8 @@
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include <QString>
+#include <QByteArray>
+#include "C_UtiClipBoardMimeData.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 namespace stw
@@ -30,6 +32,9 @@ protected:
 
    static QString mh_GetClipBoard(void);
    static void mh_SetClipBoard(const QString & orc_Text);
+   static bool mh_GetClipBoardData(const QString & orc_MimeType, QByteArray & orc_Data);
+   static void mh_SetClipBoardData(const QString & orc_MimeType, const QByteArray & orc_Data,
+                                   const C_UtiClipBoardMimeData::PR_TextFallback opr_TextFallback);
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
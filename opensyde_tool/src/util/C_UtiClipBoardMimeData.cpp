@@ -0,0 +1,121 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Clipboard content with binary format and lazy text fallback (implementation)
+
+   Holds one binary clipboard payload under its own (versioned) MIME type. The plain text representation expected
+   by external applications is only created by the fallback function when the text format is actually requested,
+   so copy and paste inside the application never pays for it.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include "C_UtiClipBoardMimeData.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::opensyde_gui_logic;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const QString C_UtiClipBoardMimeData::mhc_MIME_TYPE_TEXT = "text/plain";
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+
+   \param[in]  orc_MimeType      MIME type of binary content
+   \param[in]  orc_Data          Binary content
+   \param[in]  opr_TextFallback  Function to create the text representation of the binary content (optional)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_UtiClipBoardMimeData::C_UtiClipBoardMimeData(const QString & orc_MimeType, const QByteArray & orc_Data,
+                                               const PR_TextFallback opr_TextFallback) :
+   QMimeData(),
+   mc_MimeType(orc_MimeType),
+   mc_Data(orc_Data),
+   mpr_TextFallback(opr_TextFallback),
+   mq_TextValid(false)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get available formats
+
+   \return
+   Binary format and, if a fallback is available, plain text
+*/
+//----------------------------------------------------------------------------------------------------------------------
+QStringList C_UtiClipBoardMimeData::formats(void) const
+{
+   QStringList c_Retval;
+
+   c_Retval.append(this->mc_MimeType);
+   if (this->mpr_TextFallback != NULL)
+   {
+      c_Retval.append(mhc_MIME_TYPE_TEXT);
+   }
+   return c_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Check if format is available
+
+   \param[in]  orc_MimeType   MIME type
+
+   \return
+   true  Format available
+   false Format not available
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_UtiClipBoardMimeData::hasFormat(const QString & orc_MimeType) const
+{
+   return this->formats().contains(orc_MimeType);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get data for format
+
+   The text representation is created on first request only.
+
+   \param[in]  orc_MimeType   MIME type
+   \param[in]  oe_Type        Requested type
+
+   \return
+   Data for format, invalid variant if format not available
+*/
+//----------------------------------------------------------------------------------------------------------------------
+QVariant C_UtiClipBoardMimeData::retrieveData(const QString & orc_MimeType, const QVariant::Type oe_Type) const
+{
+   QVariant c_Retval;
+
+   if (orc_MimeType == this->mc_MimeType)
+   {
+      c_Retval = this->mc_Data;
+   }
+   else if ((orc_MimeType == mhc_MIME_TYPE_TEXT) && (this->mpr_TextFallback != NULL))
+   {
+      if (this->mq_TextValid == false)
+      {
+         this->mc_Text = this->mpr_TextFallback(this->mc_Data);
+         this->mq_TextValid = true;
+      }
+      c_Retval = this->mc_Text;
+   }
+   else
+   {
+      c_Retval = QMimeData::retrieveData(orc_MimeType, oe_Type);
+   }
+   return c_Retval;
+}
@@ -0,0 +1,62 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Clipboard content with binary format and lazy text fallback (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_UTICLIPBOARDMIMEDATA_HPP
+#define C_UTICLIPBOARDMIMEDATA_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <QMimeData>
+#include <QByteArray>
+#include <QStringList>
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_gui_logic
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_UtiClipBoardMimeData :
+   public QMimeData
+{
+public:
+   ///Converts the binary content to its text representation
+   typedef QString (* PR_TextFallback)(const QByteArray & orc_Data);
+
+   C_UtiClipBoardMimeData(const QString & orc_MimeType, const QByteArray & orc_Data,
+                          const PR_TextFallback opr_TextFallback);
+
+   QStringList formats(void) const override;
+   bool hasFormat(const QString & orc_MimeType) const override;
+
+protected:
+   QVariant retrieveData(const QString & orc_MimeType, const QVariant::Type oe_Type) const override;
+
+private:
+   //Avoid call
+   C_UtiClipBoardMimeData(const C_UtiClipBoardMimeData &);
+   C_UtiClipBoardMimeData & operator =(const C_UtiClipBoardMimeData &) &;
+
+   static const QString mhc_MIME_TYPE_TEXT;
+
+   const QString mc_MimeType;
+   const QByteArray mc_Data;
+   const PR_TextFallback mpr_TextFallback;
+   mutable bool mq_TextValid;
+   mutable QString mc_Text; ///< Text representation, only created on first request
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
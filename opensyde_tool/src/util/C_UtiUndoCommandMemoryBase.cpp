@@ -0,0 +1,48 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Base class for undo commands reporting their held memory (implementation)
+
+   Undo commands which hold a relevant payload (e.g. copies of deleted items) derive from this class in addition to
+   their QUndoCommand base. The undo stack uses the reported size to keep the memory held by all commands within its
+   byte budget.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include "C_UtiUndoCommandMemoryBase.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::opensyde_gui_logic;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_UtiUndoCommandMemoryBase::C_UtiUndoCommandMemoryBase(void)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default destructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_UtiUndoCommandMemoryBase::~C_UtiUndoCommandMemoryBase(void)
+{
+}
@@ -0,0 +1,39 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Base class for undo commands reporting their held memory (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_UTIUNDOCOMMANDMEMORYBASE_HPP
+#define C_UTIUNDOCOMMANDMEMORYBASE_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "stwtypes.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_gui_logic
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_UtiUndoCommandMemoryBase
+{
+public:
+   C_UtiUndoCommandMemoryBase(void);
+   virtual ~C_UtiUndoCommandMemoryBase(void);
+
+   virtual uint64_t GetMemoryUsage(void) const = 0;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
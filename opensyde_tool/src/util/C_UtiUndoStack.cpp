@@ -5,6 +5,12 @@
 
    Common base class for undo stacks
 
+   The memory held by the commands is kept within the byte budget of the user settings:
+   Before a command is pushed which would exceed the budget, the oldest commands are deleted. As QUndoStack can only
+   delete all of its commands, each command is wrapped in a C_UtiUndoStackEntryCommand and the kept commands are
+   pushed again in new entries without redoing them. Users of stack indices which have to stay valid across this use
+   the history index, which also counts the deleted commands.
+
    \copyright   Copyright 2017 Sensor-Technik Wiedemann GmbH. All rights reserved.
 */
 //----------------------------------------------------------------------------------------------------------------------
@@ -12,10 +18,16 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "precomp_headers.hpp"
 
+#include <vector>
 #include <QApplication>
 #include "C_UtiUndoStack.hpp"
+#include "stwerrors.hpp"
+#include "C_UtiUndoCommandMemoryBase.hpp"
+#include "C_UtiUndoStackEntryCommand.hpp"
+#include "C_UsHandler.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
 using namespace stw::opensyde_gui_logic;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
@@ -38,7 +50,9 @@ using namespace stw::opensyde_gui_logic;
 //----------------------------------------------------------------------------------------------------------------------
 C_UtiUndoStack::C_UtiUndoStack(QObject * const opc_Parent) :
    QUndoStack(opc_Parent),
-   mpc_UndoView(new QUndoView(this))
+   mpc_UndoView(new QUndoView(this)),
+   mu64_ByteBudget(static_cast<uint64_t>(C_UsHandler::h_GetInstance()->GetUndoByteBudgetMib()) * 1024ULL * 1024ULL),
+   ms32_NumDiscardedCommands(0)
 {
    //View
    mpc_UndoView->setWindowTitle("Command List");
@@ -66,7 +80,7 @@ void C_UtiUndoStack::DoPush(QUndoCommand * const opc_UndoCommand)
    if (opc_UndoCommand != NULL)
    {
       this->m_PrepareAction();
-      this->push(opc_UndoCommand);
+      this->m_Push(opc_UndoCommand);
       this->m_CleanupAction();
    }
 }
@@ -115,6 +129,150 @@ void C_UtiUndoStack::ToggleCommandDisplay(void)
    }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set byte budget for the memory held by the commands
+
+   Initialized from the user settings, only applied on the next push.
+
+   \param[in]  ou64_Value  Budget in bytes, 0: unlimited
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_UtiUndoStack::SetByteBudget(const uint64_t ou64_Value)
+{
+   this->mu64_ByteBudget = ou64_Value;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get byte budget for the memory held by the commands
+
+   \return
+   Budget in bytes, 0: unlimited
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_UtiUndoStack::GetByteBudget(void) const
+{
+   return this->mu64_ByteBudget;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get memory held by all commands
+
+   \return
+   Estimated memory usage in bytes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_UtiUndoStack::GetMemoryUsage(void) const
+{
+   uint64_t u64_Retval = 0ULL;
+
+   for (int32_t s32_It = 0; s32_It < this->count(); ++s32_It)
+   {
+      const QUndoCommand * const pc_Command = this->GetCommand(s32_It);
+      if (pc_Command != NULL)
+      {
+         u64_Retval += C_UtiUndoStack::h_GetMemoryUsage(*pc_Command);
+      }
+   }
+   return u64_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get pushed command
+
+   \param[in]  os32_Index   Stack index
+
+   \return
+   Command as pushed, NULL if index invalid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const QUndoCommand * C_UtiUndoStack::GetCommand(const int32_t os32_Index) const
+{
+   const QUndoCommand * pc_Retval = NULL;
+   const C_UtiUndoStackEntryCommand * const pc_Entry =
+      dynamic_cast<const C_UtiUndoStackEntryCommand * const>(this->command(os32_Index));
+
+   if (pc_Entry != NULL)
+   {
+      pc_Retval = pc_Entry->GetCommand();
+   }
+   return pc_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get index which stays valid when the history is cleared to keep the byte budget
+
+   \return
+   Current index plus number of commands deleted to keep the byte budget
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_UtiUndoStack::GetHistoryIndex(void) const
+{
+   return this->index() + this->ms32_NumDiscardedCommands;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Undo or redo up to an index returned by GetHistoryIndex
+
+   \param[in]  os32_HistoryIndex   Index returned by GetHistoryIndex
+
+   \return
+   C_NO_ERR   index reached
+   C_RANGE    nothing changed: commands up to this index were deleted to keep the byte budget or index invalid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_UtiUndoStack::SetHistoryIndex(const int32_t os32_HistoryIndex)
+{
+   int32_t s32_Retval = C_NO_ERR;
+   const int32_t s32_Index = os32_HistoryIndex - this->ms32_NumDiscardedCommands;
+
+   if ((s32_Index >= 0) && (s32_Index <= this->count()))
+   {
+      this->setIndex(s32_Index);
+   }
+   else
+   {
+      s32_Retval = C_RANGE;
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get memory held by command and its children
+
+   Commands not derived from C_UtiUndoCommandMemoryBase are estimated by their object and text size.
+
+   \param[in]  orc_Command   Command
+
+   \return
+   Estimated memory usage in bytes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_UtiUndoStack::h_GetMemoryUsage(const QUndoCommand & orc_Command)
+{
+   uint64_t u64_Retval;
+   const C_UtiUndoCommandMemoryBase * const pc_Memory =
+      dynamic_cast<const C_UtiUndoCommandMemoryBase * const>(&orc_Command);
+
+   if (pc_Memory != NULL)
+   {
+      u64_Retval = pc_Memory->GetMemoryUsage();
+   }
+   else
+   {
+      u64_Retval = static_cast<uint64_t>(sizeof(QUndoCommand)) +
+                   (static_cast<uint64_t>(orc_Command.text().size()) * static_cast<uint64_t>(sizeof(QChar)));
+   }
+   for (int32_t s32_It = 0; s32_It < orc_Command.childCount(); ++s32_It)
+   {
+      const QUndoCommand * const pc_Child = orc_Command.child(s32_It);
+      if (pc_Child != NULL)
+      {
+         u64_Retval += C_UtiUndoStack::h_GetMemoryUsage(*pc_Child);
+      }
+   }
+   return u64_Retval;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 void C_UtiUndoStack::m_PrepareAction(void)
 {
@@ -126,3 +284,87 @@ void C_UtiUndoStack::m_CleanupAction(void)
 {
    QApplication::restoreOverrideCursor();
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Push command within byte budget
+
+   \param[in,out]  opc_UndoCommand  New undo command to add to the stack, ownership is taken over
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_UtiUndoStack::m_Push(QUndoCommand * const opc_UndoCommand)
+{
+   this->m_EnforceByteBudget(C_UtiUndoStack::h_GetMemoryUsage(*opc_UndoCommand));
+   this->push(new C_UtiUndoStackEntryCommand(opc_UndoCommand));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Delete the oldest commands if the new command would exceed the byte budget
+
+   Only the commands up to the current index are considered, the others are deleted by the push anyway.
+   The new command itself is always kept.
+
+   \param[in]  ou64_NewCommandUsage   Memory held by the command to push
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_UtiUndoStack::m_EnforceByteBudget(const uint64_t ou64_NewCommandUsage)
+{
+   if ((this->mu64_ByteBudget > 0ULL) && (this->index() > 0))
+   {
+      uint64_t u64_Usage = ou64_NewCommandUsage;
+      int32_t s32_NumKept = 0;
+
+      //Newest commands first, stop at the first one not fitting anymore
+      for (int32_t s32_It = this->index() - 1; s32_It >= 0; --s32_It)
+      {
+         const QUndoCommand * const pc_Command = this->GetCommand(s32_It);
+         if (pc_Command != NULL)
+         {
+            u64_Usage += C_UtiUndoStack::h_GetMemoryUsage(*pc_Command);
+         }
+         if (u64_Usage > this->mu64_ByteBudget)
+         {
+            break;
+         }
+         ++s32_NumKept;
+      }
+      if (s32_NumKept < this->index())
+      {
+         this->m_DeleteOldestCommands(this->index() - s32_NumKept);
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Delete the oldest commands and all commands which could be redone
+
+   The kept commands are handed over to new entries and pushed again without being redone.
+   Signals are blocked meanwhile, the following push reports the new state.
+
+   \param[in]  os32_NumCommands   Number of commands to delete from the bottom of the stack
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_UtiUndoStack::m_DeleteOldestCommands(const int32_t os32_NumCommands)
+{
+   std::vector<C_UtiUndoStackEntryCommand *> c_KeptEntries;
+   const bool q_SignalsBlocked = this->blockSignals(true);
+
+   for (int32_t s32_It = os32_NumCommands; s32_It < this->index(); ++s32_It)
+   {
+      //lint -e{9005} QUndoStack only offers const access to its commands, ownership is handed over explicitly
+      C_UtiUndoStackEntryCommand * const pc_Entry =
+         dynamic_cast<C_UtiUndoStackEntryCommand *>(const_cast<QUndoCommand *>(this->command(s32_It)));
+      if (pc_Entry != NULL)
+      {
+         c_KeptEntries.push_back(pc_Entry->TakeOverForRestore());
+      }
+   }
+   this->clear();
+   for (uint32_t u32_It = 0UL; u32_It < c_KeptEntries.size(); ++u32_It)
+   {
+      C_UtiUndoStackEntryCommand * const pc_Entry = c_KeptEntries[u32_It];
+      this->push(pc_Entry);
+      pc_Entry->FinishRestore();
+   }
+   this->ms32_NumDiscardedCommands += os32_NumCommands;
+   this->blockSignals(q_SignalsBlocked);
+}
@@ -14,6 +14,7 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include <QUndoStack>
 #include <QUndoView>
+#include "stwtypes.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 namespace stw
@@ -35,13 +36,28 @@ public:
    void DoRedo(void);
    void DoUndo(void);
    void ToggleCommandDisplay(void);
+   void SetByteBudget(const uint64_t ou64_Value);
+   uint64_t GetByteBudget(void) const;
+   uint64_t GetMemoryUsage(void) const;
+   int32_t GetHistoryIndex(void) const;
+   int32_t SetHistoryIndex(const int32_t os32_HistoryIndex);
+   const QUndoCommand * GetCommand(const int32_t os32_Index) const;
+
+   static uint64_t h_GetMemoryUsage(const QUndoCommand & orc_Command);
 
 protected:
    virtual void m_PrepareAction(void);
    virtual void m_CleanupAction(void);
+   void m_Push(QUndoCommand * const opc_UndoCommand);
 
 private:
    QUndoView * const mpc_UndoView;
+   uint64_t mu64_ByteBudget;           ///< Maximum memory held by the commands, 0: unlimited
+   int32_t ms32_NumDiscardedCommands; ///< Number of commands deleted to keep the byte budget
+
+   void m_EnforceByteBudget(const uint64_t ou64_NewCommandUsage);
+   void m_DeleteOldestCommands(const int32_t os32_NumCommands);
+
    //Avoid call
    C_UtiUndoStack(const C_UtiUndoStack &);
    C_UtiUndoStack & operator =(const C_UtiUndoStack &) &;
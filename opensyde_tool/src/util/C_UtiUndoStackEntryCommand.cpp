@@ -0,0 +1,173 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Undo stack entry owning the actual undo command (implementation)
+
+   QUndoStack owns its commands and can only delete all of them at once.
+   Each command pushed by C_UtiUndoStack is therefore wrapped in an entry, so the actual commands which shall be kept
+   can be handed over to new entries before the old entries are deleted.
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include "C_UtiUndoStackEntryCommand.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::opensyde_gui_logic;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+
+   \param[in,out]  opc_Command   Actual command, ownership is taken over
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_UtiUndoStackEntryCommand::C_UtiUndoStackEntryCommand(QUndoCommand * const opc_Command) :
+   QUndoCommand(),
+   mpc_Command(opc_Command),
+   mq_Restoring(false)
+{
+   if (this->mpc_Command != NULL)
+   {
+      this->setText(this->mpc_Command->text());
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default destructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_UtiUndoStackEntryCommand::~C_UtiUndoStackEntryCommand(void)
+{
+   delete this->mpc_Command;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Redo actual command
+
+   Skipped once for a restored entry, as its command is done already.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_UtiUndoStackEntryCommand::redo(void)
+{
+   if ((this->mq_Restoring == false) && (this->mpc_Command != NULL))
+   {
+      this->mpc_Command->redo();
+      this->setObsolete(this->mpc_Command->isObsolete());
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Undo actual command
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_UtiUndoStackEntryCommand::undo(void)
+{
+   if (this->mpc_Command != NULL)
+   {
+      this->mpc_Command->undo();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get merge ID of actual command
+
+   A restored entry is never merged while it is pushed again.
+
+   \return
+   Merge ID, -1: no merge
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_UtiUndoStackEntryCommand::id(void) const
+{
+   int32_t s32_Retval = -1;
+
+   if ((this->mq_Restoring == false) && (this->mpc_Command != NULL))
+   {
+      s32_Retval = this->mpc_Command->id();
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Attempt merge of actual commands
+
+   \param[in]  opc_Command    Newer entry to merge with
+
+   \return
+   true: merged into current command
+   false: no merge possible
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_UtiUndoStackEntryCommand::mergeWith(const QUndoCommand * const opc_Command)
+{
+   bool q_Retval = false;
+   const C_UtiUndoStackEntryCommand * const pc_Entry =
+      dynamic_cast<const C_UtiUndoStackEntryCommand * const>(opc_Command);
+
+   if (((pc_Entry != NULL) && (pc_Entry->mpc_Command != NULL)) && (this->mpc_Command != NULL))
+   {
+      q_Retval = this->mpc_Command->mergeWith(pc_Entry->mpc_Command);
+      if (q_Retval == true)
+      {
+         this->setText(this->mpc_Command->text());
+         this->setObsolete(this->mpc_Command->isObsolete());
+      }
+   }
+   return q_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get actual command
+
+   \return
+   Actual command, NULL if taken over by another entry
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const QUndoCommand * C_UtiUndoStackEntryCommand::GetCommand(void) const
+{
+   return this->mpc_Command;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Hand the actual command over to a new entry
+
+   The new entry does not redo the command when pushed, until FinishRestore is called.
+   This entry does nothing afterwards and can be deleted.
+
+   \return
+   New entry, ownership is passed to the caller
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_UtiUndoStackEntryCommand * C_UtiUndoStackEntryCommand::TakeOverForRestore(void)
+{
+   C_UtiUndoStackEntryCommand * const pc_Retval = new C_UtiUndoStackEntryCommand(this->mpc_Command);
+
+   pc_Retval->mq_Restoring = true;
+   this->mpc_Command = NULL;
+   return pc_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Enable redo and merge again after the restored entry was pushed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_UtiUndoStackEntryCommand::FinishRestore(void)
+{
+   this->mq_Restoring = false;
+}
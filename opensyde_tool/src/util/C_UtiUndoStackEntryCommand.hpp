@@ -0,0 +1,56 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Undo stack entry owning the actual undo command (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2024 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_UTIUNDOSTACKENTRYCOMMAND_HPP
+#define C_UTIUNDOSTACKENTRYCOMMAND_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <QUndoCommand>
+#include "stwtypes.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_gui_logic
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_UtiUndoStackEntryCommand :
+   public QUndoCommand
+{
+public:
+   C_UtiUndoStackEntryCommand(QUndoCommand * const opc_Command);
+   ~C_UtiUndoStackEntryCommand(void) override;
+
+   void redo(void) override;
+   void undo(void) override;
+   int32_t id(void) const override;
+   bool mergeWith(const QUndoCommand * const opc_Command) override;
+
+   const QUndoCommand * GetCommand(void) const;
+   C_UtiUndoStackEntryCommand * TakeOverForRestore(void);
+   void FinishRestore(void);
+
+private:
+   QUndoCommand * mpc_Command; ///< Owned actual command, NULL after it was taken over by another entry
+   bool mq_Restoring;          ///< Command is already done and pushed again after older entries were deleted
+
+   //Avoid call
+   C_UtiUndoStackEntryCommand(const C_UtiUndoStackEntryCommand &);
+   C_UtiUndoStackEntryCommand & operator =(const C_UtiUndoStackEntryCommand &) &;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif